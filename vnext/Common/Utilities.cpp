@@ -3,57 +3,130 @@
 
 #include "Utilities.h"
 
-// Boost Library
-#include <boost/archive/iterators/base64_from_binary.hpp>
-#include <boost/archive/iterators/binary_from_base64.hpp>
-#include <boost/archive/iterators/ostream_iterator.hpp>
-#include <boost/archive/iterators/transform_width.hpp>
-
-// Windows API
-#include <winrt/Windows.Security.Cryptography.h>
-
 // Standard Library
-#include <sstream>
+#include <array>
 
 using std::string;
 using std::string_view;
-using std::wstring_view;
-using winrt::array_view;
-
-using winrt::Windows::Security::Cryptography::BinaryStringEncoding;
-using winrt::Windows::Security::Cryptography::CryptographicBuffer;
+using std::vector;
 
 namespace Microsoft::React::Utilities {
 
-string DecodeBase64(string_view base64) noexcept {
-  typedef array_view<char const> av_t;
-  auto bytes = av_t(base64.data(), static_cast<av_t::size_type>(base64.size()));
+namespace {
+
+constexpr char s_base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Maps each character to its 6-bit value, or to 0xFF if it is not in the alphabet.
+constexpr std::array<uint8_t, 256> s_base64Values = []() {
+  std::array<uint8_t, 256> values{};
+  for (auto &value : values) {
+    value = 0xFF;
+  }
+  for (uint8_t i = 0; i < 64; ++i) {
+    values[static_cast<uint8_t>(s_base64Alphabet[i])] = i;
+  }
+  return values;
+}();
 
-  using namespace boost::archive::iterators;
-  typedef transform_width<binary_from_base64<const char *>, 8, 6> decode_base64;
-  std::ostringstream oss;
-  std::copy(decode_base64(bytes.cbegin()), decode_base64(bytes.cend()), ostream_iterator<char>(oss));
+} // namespace
 
-  return oss.str();
+// The codec works on whole 3-byte groups with table lookups and writes into pre-sized buffers.
+// Invalid characters are detected by OR-ing the looked up values, so the inner loops have no branches.
+
+void AppendBase64(string_view bytes, string &output) noexcept {
+  auto in = reinterpret_cast<const uint8_t *>(bytes.data());
+  const auto size = bytes.size();
+
+  const auto start = output.size();
+  output.resize(start + Base64EncodedLength(size));
+  auto out = output.data() + start;
+
+  size_t i = 0;
+  for (; i + 3 <= size; i += 3) {
+    const uint32_t group = (uint32_t{in[i]} << 16) | (uint32_t{in[i + 1]} << 8) | in[i + 2];
+    out[0] = s_base64Alphabet[(group >> 18) & 0x3F];
+    out[1] = s_base64Alphabet[(group >> 12) & 0x3F];
+    out[2] = s_base64Alphabet[(group >> 6) & 0x3F];
+    out[3] = s_base64Alphabet[group & 0x3F];
+    out += 4;
+  }
+
+  if (const auto remaining = size - i) {
+    const uint32_t group = (uint32_t{in[i]} << 16) | (remaining == 2 ? uint32_t{in[i + 1]} << 8 : 0);
+    out[0] = s_base64Alphabet[(group >> 18) & 0x3F];
+    out[1] = s_base64Alphabet[(group >> 12) & 0x3F];
+    out[2] = remaining == 2 ? s_base64Alphabet[(group >> 6) & 0x3F] : '=';
+    out[3] = '=';
+  }
 }
 
-// https://www.boost.org/doc/libs/1_76_0/libs/serialization/doc/dataflow.html
-string EncodeBase64(string_view text) noexcept {
-  typedef array_view<char const> av_t;
-  auto bytes = av_t(text.data(), static_cast<av_t::size_type>(text.size()));
+bool TryDecodeBase64(string_view text, vector<uint8_t> &output) noexcept {
+  // Strip up to two padding characters.
+  auto length = text.size();
+  if (length % 4 == 0 && length > 0 && text[length - 1] == '=') {
+    length -= text[length - 2] == '=' ? 2 : 1;
+  }
+  if (length % 4 == 1) {
+    return false;
+  }
+
+  auto in = reinterpret_cast<const uint8_t *>(text.data());
+  const auto start = output.size();
+  output.resize(start + length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1));
+  auto out = output.data() + start;
+
+  uint32_t invalid = 0;
+  size_t i = 0;
+  for (; i + 4 <= length; i += 4) {
+    const uint32_t a = s_base64Values[in[i]];
+    const uint32_t b = s_base64Values[in[i + 1]];
+    const uint32_t c = s_base64Values[in[i + 2]];
+    const uint32_t d = s_base64Values[in[i + 3]];
+    invalid |= a | b | c | d;
+
+    const uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+    out[0] = static_cast<uint8_t>(group >> 16);
+    out[1] = static_cast<uint8_t>(group >> 8);
+    out[2] = static_cast<uint8_t>(group);
+    out += 3;
+  }
+
+  if (const auto remaining = length - i) {
+    const uint32_t a = s_base64Values[in[i]];
+    const uint32_t b = s_base64Values[in[i + 1]];
+    const uint32_t c = remaining == 3 ? s_base64Values[in[i + 2]] : 0;
+    invalid |= a | b | c;
+
+    const uint32_t group = (a << 18) | (b << 12) | (c << 6);
+    out[0] = static_cast<uint8_t>(group >> 16);
+    if (remaining == 3) {
+      out[1] = static_cast<uint8_t>(group >> 8);
+    }
+  }
 
-  using namespace boost::archive::iterators;
-  typedef base64_from_binary<transform_width<const char *, 6, 8>> encode_base64;
-  std::ostringstream oss;
-  std::copy(encode_base64(bytes.cbegin()), encode_base64(bytes.cend()), ostream_iterator<char>(oss));
+  // Valid values fit in 6 bits.
+  if (invalid & 0xC0) {
+    output.resize(start);
+    return false;
+  }
+
+  return true;
+}
 
-  // https://unix.stackexchange.com/questions/631501
-  size_t padLength = (4 - (oss.tellp() % 4)) % 4;
-  for (size_t i = 0; i < padLength; ++i) {
-    oss << '=';
+string DecodeBase64(string_view base64) noexcept {
+  vector<uint8_t> bytes;
+  if (!TryDecodeBase64(base64, bytes)) {
+    return {};
   }
 
-  return oss.str();
+  return string(bytes.cbegin(), bytes.cend());
+}
+
+string EncodeBase64(string_view text) noexcept {
+  string result;
+  AppendBase64(text, result);
+
+  return result;
 }
 
 } // namespace Microsoft::React::Utilities
@@ -8,13 +8,88 @@
 
 #include "stringapiset.h"
 
+#if defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#elif defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
+
 #include <cassert>
 #include <cstring>
 #include <exception>
+#include <limits>
 #include <string>
 
 namespace Microsoft::Common::Unicode {
 
+namespace {
+
+// Most strings crossing into DirectWrite and WinRT are entirely or mostly ASCII.  The helpers below convert the
+// leading ASCII run of a string 16 code units at a time, checking that the units are ASCII as they go, and return how
+// many units were converted.  The rest of the string, starting at its first non ASCII unit, is left to the Win32
+// converters, which do the validation and U+FFFD replacement of everything else.  Since an ASCII character is always a
+// complete UTF-8 sequence and a complete UTF-16 code point, splitting the string there does not change the result.
+
+size_t WidenAsciiPrefix(const char *utf8, size_t utf8Len, wchar_t *utf16) noexcept {
+  size_t i = 0;
+#if defined(_M_X64) || defined(_M_IX86)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= utf8Len; i += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8 + i));
+    if (_mm_movemask_epi8(chunk) != 0) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(utf16 + i), _mm_unpacklo_epi8(chunk, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(utf16 + i + 8), _mm_unpackhi_epi8(chunk, zero));
+  }
+#elif defined(_M_ARM64)
+  for (; i + 16 <= utf8Len; i += 16) {
+    const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(utf8 + i));
+    if (vmaxvq_u8(chunk) >= 0x80) {
+      break;
+    }
+    vst1q_u16(reinterpret_cast<uint16_t *>(utf16 + i), vmovl_u8(vget_low_u8(chunk)));
+    vst1q_u16(reinterpret_cast<uint16_t *>(utf16 + i + 8), vmovl_high_u8(chunk));
+  }
+#endif
+  for (; i < utf8Len && static_cast<unsigned char>(utf8[i]) < 0x80; ++i) {
+    utf16[i] = static_cast<wchar_t>(utf8[i]);
+  }
+  return i;
+}
+
+size_t NarrowAsciiPrefix(const wchar_t *utf16, size_t utf16Len, char *utf8) noexcept {
+  size_t i = 0;
+#if defined(_M_X64) || defined(_M_IX86)
+  const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xff80));
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= utf16Len; i += 16) {
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i));
+    const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i + 8));
+    const __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiMask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xffff) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(utf8 + i), _mm_packus_epi16(low, high));
+  }
+#elif defined(_M_ARM64)
+  for (; i + 16 <= utf16Len; i += 16) {
+    const uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t *>(utf16 + i));
+    const uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t *>(utf16 + i + 8));
+    if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80) {
+      break;
+    }
+    vst1q_u8(reinterpret_cast<uint8_t *>(utf8 + i), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+  }
+#endif
+  for (; i < utf16Len && static_cast<uint16_t>(utf16[i]) < 0x80; ++i) {
+    utf8[i] = static_cast<char>(utf16[i]);
+  }
+  return i;
+}
+
+} // namespace
+
 // The implementations of the following functions heavily reference the MSDN article at
 // https://docs.microsoft.com/en-us/archive/msdn-magazine/2016/september/c-unicode-encoding-conversions-with-stl-strings-and-win32-apis.
 
@@ -32,49 +107,34 @@ std::wstring Utf8ToUtf16(const char *utf8, size_t utf8Len) {
     throw std::overflow_error("Length of input string to Utf8ToUtf16() must fit into an int.");
   }
 
-  const int utf8Length = static_cast<int>(utf8Len);
+  // Every UTF-8 sequence, and every invalid byte replaced with U+FFFD, becomes
+  // at most as many UTF-16 code units as it has bytes. So a buffer of utf8Len
+  // wchar_ts is always large enough, and the result can be converted in a
+  // single pass instead of first asking MultiByteToWideChar for its length.
+  utf16.resize(utf8Len);
+
+  const size_t asciiLength = WidenAsciiPrefix(utf8, utf8Len, &utf16[0]);
+  if (asciiLength == utf8Len) {
+    return utf16;
+  }
 
   // We do not specify MB_ERR_INVALID_CHARS here, which means that invalid UTF-8
   // characters are replaced with U+FFFD.
   constexpr DWORD flags = 0;
 
-  const int utf16Length = ::MultiByteToWideChar(
-      CP_UTF8, // Source string is in UTF-8.
-      flags, // Conversion flags.
-      utf8, // Source UTF-8 string pointer.
-      utf8Length, // Length of the source UTF-8 string, in chars.
-      nullptr, // Do not convert during this step, instead, request the size
-      0 //   of the destination buffer, in wchar_ts, excluding the
-      //   null termination character.
-  );
-
-  if (utf16Length == 0) {
-    throw UnicodeConversionException(
-        "Cannot get result string length when converting from UTF-8 to UTF-16 "
-        "(MultiByteToWideChar failed).",
-        GetLastError());
-  }
-
-  // Note that because the length of the input UTF-8 string was explicitly
-  // passed to MultiByteToWideChar (instead of just passing -1 and asking
-  // MultiByteToWideChar to scan the whole input string until a null terminator
-  // is found), MultiByteToWideChar won't add an additional null terminator to
-  // the result string. Therefore, there's no need to invoke
-  // std::wstring::resize with a "utf16Length + 1" value.
-  utf16.resize(utf16Length);
-
-  // Convert from UTF-8 to UTF-16
+  // Convert the rest of the string from UTF-8 to UTF-16
   // Note that MultiByteToWideChar converts the UTF-8 BOM into the UTF-16BE BOM.
   // So we do not have to do anything extra here to ensure correct BOM behavior.
-  int result = ::MultiByteToWideChar(
+  const int remainingLength = static_cast<int>(utf8Len - asciiLength);
+  const int result = ::MultiByteToWideChar(
       CP_UTF8, // Source string is in UTF-8.
       flags, // Conversion flags.
-      utf8, // Source UTF-8 string pointer.
-      utf8Length, // Length of source UTF-8 string, in chars.
-      &utf16[0], // Pointer to destination buffer. This is fine because the
+      utf8 + asciiLength, // Source UTF-8 string pointer, past the ASCII prefix.
+      remainingLength, // Length of the rest of the source UTF-8 string, in chars.
+      &utf16[asciiLength], // Pointer to destination buffer. This is fine because
       //   the C++11 standard specifies that the elements of a
       //   std::basic_string are stored continuously.
-      utf16Length // Size of destination buffer, in wchar_ts.
+      remainingLength // Size of destination buffer, in wchar_ts.
   );
 
   if (result == 0) {
@@ -82,6 +142,10 @@ std::wstring Utf8ToUtf16(const char *utf8, size_t utf8Len) {
         "Cannot convert from UTF-8 to UTF-16 (MultiByteToWideChar failed).", GetLastError());
   }
 
+  // Because the length of the input UTF-8 string was explicitly passed to
+  // MultiByteToWideChar, it won't add a null terminator to the result string.
+  utf16.resize(asciiLength + result);
+
   return utf16;
 }
 
@@ -113,48 +177,56 @@ std::string Utf16ToUtf8(const wchar_t *utf16, size_t utf16Len) {
     throw std::overflow_error("Length of input string to Utf16ToUtf8() must fit into an int.");
   }
 
-  const int utf16Length = static_cast<int>(utf16Len);
+  utf8.resize(utf16Len);
+
+  const size_t asciiLength = NarrowAsciiPrefix(utf16, utf16Len, &utf8[0]);
+  if (asciiLength == utf16Len) {
+    return utf8;
+  }
+
+  const int remainingLength = static_cast<int>(utf16Len - asciiLength);
 
   // We do not specify WC_ERR_INVALID_CHARS here, which means that invalid
   // UTF-16 characters are replaced with U+FFFD.
   constexpr DWORD flags = 0;
 
-  const int utf8Length = ::WideCharToMultiByte(
-      CP_UTF8, // Destination string is in UTF-8.
-      flags, // Conversion flags.
-      utf16, // Source UTF-16 string pointer.
-      utf16Length, // Length of the source UTF-16 string, in wchar_ts.
-      nullptr, // Do not convert during this step, instead, request the size
-      0, //   of the destination buffer, in chars, excluding the
-      //   null termination character.
-      nullptr, // WideCharToMultiByte requires the last two parameters to be
-      nullptr //   nullptrs when converting to UTF-8.
-  );
-
-  if (utf8Length == 0) {
-    throw UnicodeConversionException(
-        "Cannot get result string length when converting from UTF-16 to UTF-8 "
-        "(WideCharToMultiByte failed).",
-        GetLastError());
+  // Every UTF-16 code unit, and every unpaired surrogate replaced with U+FFFD,
+  // becomes at most 3 UTF-8 bytes, so when that bound fits into an int the rest
+  // of the string is converted in a single pass. Otherwise WideCharToMultiByte
+  // is first asked for the length of the result.
+  int utf8Length = 0;
+  if (remainingLength <= (std::numeric_limits<int>::max)() / 3) {
+    utf8Length = remainingLength * 3;
+  } else {
+    utf8Length = ::WideCharToMultiByte(
+        CP_UTF8, // Destination string is in UTF-8.
+        flags, // Conversion flags.
+        utf16 + asciiLength, // Source UTF-16 string pointer, past the ASCII prefix.
+        remainingLength, // Length of the rest of the source UTF-16 string, in wchar_ts.
+        nullptr, // Do not convert during this step, instead, request the size
+        0, //   of the destination buffer, in chars, excluding the
+        //   null termination character.
+        nullptr, // WideCharToMultiByte requires the last two parameters to be
+        nullptr //   nullptrs when converting to UTF-8.
+    );
+
+    if (utf8Length == 0) {
+      throw UnicodeConversionException(
+          "Cannot get result string length when converting from UTF-16 to UTF-8 "
+          "(WideCharToMultiByte failed).",
+          GetLastError());
+    }
   }
 
-  // Note that because the length of the input UTF-16 string was explicitly
-  // passed to WideCharToMultiByte (instead of just passing -1 and asking
-  // WideCharToMultiByte to scan the whole input string until a null terminator
-  // is found), WideCharToMultiByte won't add an additional null terminator to
-  // the result string. Therefore, there's no need to invoke
-  // std::string::resize with a "utf8Length + 1" value.
-  utf8.resize(utf8Length);
+  utf8.resize(asciiLength + utf8Length);
 
-  // Convert from UTF-8 to UTF-16
-  // Note that MultiByteToWideChar converts the UTF-8 BOM into the UTF-16BE BOM.
-  // So we do not have to do anything extra here to ensure correct BOM behavior.
-  int result = ::WideCharToMultiByte(
+  // Convert the rest of the string from UTF-16 to UTF-8
+  const int result = ::WideCharToMultiByte(
       CP_UTF8, // Destination string is in UTF-8.
       flags, // Conversion flags.
-      utf16, // Source UTF-16 string pointer.
-      utf16Length, // Length of the source UTF-16 string, in wchar_ts.
-      &utf8[0], // Pointer to destination buffer. This is fine because the
+      utf16 + asciiLength, // Source UTF-16 string pointer, past the ASCII prefix.
+      remainingLength, // Length of the rest of the source UTF-16 string, in wchar_ts.
+      &utf8[asciiLength], // Pointer to destination buffer. This is fine because
       //   the C++11 standard specifies that the elements of a
       //   std::basic_string are stored continuously.
       utf8Length, // Size of destination buffer, in chars.
@@ -167,6 +239,10 @@ std::string Utf16ToUtf8(const wchar_t *utf16, size_t utf16Len) {
         "Cannot convert from UTF-16 to UTF-8 (WideCharToMultiByte failed).", GetLastError());
   }
 
+  // Because the length of the input UTF-16 string was explicitly passed to
+  // WideCharToMultiByte, it won't add a null terminator to the result string.
+  utf8.resize(asciiLength + result);
+
   return utf8;
 }
 
@@ -4,9 +4,12 @@
 #pragma once
 
 // Standard Library
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace Microsoft::Common::Utilities {
 
@@ -47,4 +50,17 @@ std::string DecodeBase64(std::string_view text) noexcept;
 
 std::string EncodeBase64(std::string_view text) noexcept;
 
+// Number of characters in the padded Base64 encoding of the given number of bytes.
+constexpr size_t Base64EncodedLength(size_t byteCount) noexcept {
+  return (byteCount + 2) / 3 * 4;
+}
+
+// Appends the padded Base64 encoding of bytes to output.
+// Use it to build data URIs and message payloads in place, without intermediate strings.
+void AppendBase64(std::string_view bytes, std::string &output) noexcept;
+
+// Appends the bytes encoded by the Base64 text to output.
+// Padding is optional. Returns false, leaving output unchanged, if the text is not valid Base64.
+bool TryDecodeBase64(std::string_view text, std::vector<uint8_t> &output) noexcept;
+
 } // namespace Microsoft::React::Utilities
@@ -43,6 +43,7 @@ TEST_CLASS (HttpResourceIntegrationTest) {
   TEST_METHOD_CLEANUP(MethodCleanup) {
     // Clear any runtime options that may be used by tests in this class.
     MicrosoftReactSetRuntimeOptionString("Http.UserAgent", nullptr);
+    MicrosoftReactSetRuntimeOptionBool("Http.WinHttp", false);
 
     // Bug in test HTTP server does not correctly release TCP port between test methods.
     // Using a different por per test for now.
@@ -96,6 +97,177 @@ TEST_CLASS (HttpResourceIntegrationTest) {
     Assert::AreEqual(200, statusCode);
   }
 
+  TEST_METHOD(RequestGetWinHttpSucceeds) {
+    MicrosoftReactSetRuntimeOptionBool("Http.WinHttp", true);
+    string url = "http://localhost:" + std::to_string(s_port);
+
+    promise<void> resPromise;
+    string error;
+    string content;
+    int statusCode = 0;
+    string contentType;
+
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [](const DynamicRequest &request) -> ResponseWrapper {
+      DynamicResponse response;
+      response.result(http::status::ok);
+      response.set(http::field::content_type, "text/plain");
+      response.body() = Test::CreateStringResponseBody("some response content");
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    resource->SetOnResponse([&statusCode, &contentType](int64_t, IHttpResource::Response response) {
+      statusCode = static_cast<int>(response.StatusCode);
+      if (auto header = response.Headers.find("Content-Type"); header != response.Headers.end()) {
+        contentType = header->second;
+      }
+    });
+    resource->SetOnData([&resPromise, &content](int64_t, string &&responseData) {
+      content = std::move(responseData);
+      resPromise.set_value();
+    });
+    resource->SetOnError([&resPromise, &error](int64_t, string &&message, bool) {
+      error = std::move(message);
+      resPromise.set_value();
+    });
+    resource->SendRequest(
+        "GET",
+        std::move(url),
+        0, /*requestId*/
+        {}, /*header*/
+        {}, /*data*/
+        "text",
+        false,
+        0 /*timeout*/,
+        false /*withCredentials*/,
+        [](int64_t) {});
+
+    // Synchronize response.
+    resPromise.get_future().wait();
+    server->Stop();
+
+    Assert::AreEqual({}, error);
+    Assert::AreEqual(200, statusCode);
+    Assert::AreEqual({"text/plain"}, contentType);
+    Assert::AreEqual({"some response content"}, content);
+  }
+
+  TEST_METHOD(RequestGetWinHttpDecodesContent) {
+    MicrosoftReactSetRuntimeOptionBool("Http.WinHttp", true);
+    string url = "http://localhost:" + std::to_string(s_port);
+
+    promise<void> resPromise;
+    string error;
+    string content;
+    bool hasContentEncoding = true;
+
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [](const DynamicRequest &request) -> ResponseWrapper {
+      // "some response content", compressed with gzip
+      constexpr uint8_t gzipContent[] = {0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x2b, 0xce, 0xcf,
+                                         0x4d, 0x55, 0x28, 0x4a, 0x2d, 0x2e, 0xc8, 0xcf, 0x2b, 0x4e, 0x55, 0x48, 0xce,
+                                         0xcf, 0x2b, 0x49, 0xcd, 0x2b, 0x01, 0x00, 0x61, 0x92, 0xcd, 0xfc, 0x15, 0x00,
+                                         0x00, 0x00};
+      Test::StringResponse response;
+      response.result(http::status::ok);
+      response.set(http::field::content_encoding, "gzip");
+      response.body() = string{std::begin(gzipContent), std::end(gzipContent)};
+      response.prepare_payload();
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    resource->SetOnResponse([&hasContentEncoding](int64_t, IHttpResource::Response response) {
+      hasContentEncoding = response.Headers.find("Content-Encoding") != response.Headers.end();
+    });
+    resource->SetOnData([&resPromise, &content](int64_t, string &&responseData) {
+      content = std::move(responseData);
+      resPromise.set_value();
+    });
+    resource->SetOnError([&resPromise, &error](int64_t, string &&message, bool) {
+      error = std::move(message);
+      resPromise.set_value();
+    });
+    resource->SendRequest(
+        "GET",
+        std::move(url),
+        0, /*requestId*/
+        {}, /*header*/
+        {}, /*data*/
+        "text",
+        false,
+        0 /*timeout*/,
+        false /*withCredentials*/,
+        [](int64_t) {});
+
+    // Synchronize response.
+    resPromise.get_future().wait();
+    server->Stop();
+
+    Assert::AreEqual({}, error);
+    Assert::IsFalse(hasContentEncoding);
+    Assert::AreEqual({"some response content"}, content);
+  }
+
+  TEST_METHOD(RequestGetArrayBufferStreamSucceeds) {
+    string url = "http://localhost:" + std::to_string(s_port);
+
+    promise<void> resPromise;
+    string error;
+    string content;
+    int64_t lastProgress = 0;
+
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [](const DynamicRequest &request) -> ResponseWrapper {
+      DynamicResponse response;
+      response.result(http::status::ok);
+      response.body() = Test::CreateStringResponseBody("some streamed response content");
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    resource->SetOnIncrementalBinaryData(
+        [&resource, &content, &lastProgress](
+            int64_t requestId,
+            winrt::Windows::Storage::Streams::IBuffer &&responseData,
+            int64_t progress,
+            int64_t /*total*/) {
+          content.append(reinterpret_cast<char *>(responseData.data()), responseData.Length());
+          lastProgress = progress;
+          resource->AcknowledgeIncrementalData(requestId, responseData.Length());
+        });
+    resource->SetOnResponseComplete([&resPromise](int64_t) { resPromise.set_value(); });
+    resource->SetOnError([&resPromise, &error](int64_t, string &&message, bool) {
+      error = std::move(message);
+      resPromise.set_value();
+    });
+    resource->SendRequest(
+        "GET",
+        std::move(url),
+        0, /*requestId*/
+        {}, /*headers*/
+        {}, /*data*/
+        "arraybuffer", /*responseType*/
+        true, /*useIncrementalUpdates*/
+        0, /*timeout*/
+        false, /*withCredentials*/
+        [](int64_t) {} /*callback*/);
+
+    resPromise.get_future().wait();
+    server->Stop();
+
+    Assert::AreEqual({}, error);
+    Assert::AreEqual({"some streamed response content"}, content);
+    Assert::AreEqual(static_cast<int64_t>(content.size()), lastProgress);
+  }
+
   TEST_METHOD(RequestGetHeadersSucceeds) {
     string url = "http://localhost:" + std::to_string(s_port);
 
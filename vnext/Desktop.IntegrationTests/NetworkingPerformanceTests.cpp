@@ -0,0 +1,359 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// C4996: 'gethostbyaddr': Use getnameinfo() or GetNameInfoW() instead
+#define _WINSOCK_DEPRECATED_NO_WARNINGS
+
+#include <CppUnitTest.h>
+
+#include <Modules/IHttpModuleProxy.h>
+#include <Networking/IHttpResource.h>
+#include <Networking/IWebSocketResource.h>
+#include <RuntimeOptions.h>
+#include <Test/HttpServer.h>
+#include <Test/WebSocketServer.h>
+#include <unicode.h>
+
+// Boost Library
+#include <boost/beast/http.hpp>
+
+// Windows API
+#include <crtdbg.h>
+
+// Standard Library
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Microsoft::React;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace http = boost::beast::http;
+
+using Microsoft::Common::Unicode::Utf8ToUtf16;
+using Networking::IHttpResource;
+using Networking::IWebSocketResource;
+using std::make_shared;
+using std::promise;
+using std::string;
+using std::vector;
+using std::chrono::steady_clock;
+using Test::DynamicRequest;
+using Test::HttpServer;
+using Test::ResponseWrapper;
+using Test::StringResponse;
+
+namespace {
+
+// Counts the CRT heap allocations of the process while in scope.
+// Only the debug CRT reports its allocations, so release builds report no count.
+class AllocationCounter {
+  static std::atomic<int64_t> s_count;
+
+#ifdef _DEBUG
+  _CRT_ALLOC_HOOK m_previousHook;
+
+  static int __cdecl AllocHook(int allocType, void *, size_t, int, long, const unsigned char *, int) {
+    if (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC) {
+      ++s_count;
+    }
+    return TRUE;
+  }
+#endif // _DEBUG
+
+ public:
+  AllocationCounter() noexcept {
+    s_count = 0;
+#ifdef _DEBUG
+    m_previousHook = _CrtSetAllocHook(AllocHook);
+#endif // _DEBUG
+  }
+
+  ~AllocationCounter() noexcept {
+#ifdef _DEBUG
+    _CrtSetAllocHook(m_previousHook);
+#endif // _DEBUG
+  }
+
+  // Returns -1 when the allocations are not counted
+  int64_t Count() const noexcept {
+#ifdef _DEBUG
+    return s_count;
+#else
+    return -1;
+#endif // _DEBUG
+  }
+};
+
+/*static*/ std::atomic<int64_t> AllocationCounter::s_count{0};
+
+// Stands in for the Blob module, so that blob responses take the path that hands over the response buffer
+struct CountingResponseHandler final : IResponseHandler {
+  bool Supports(string &responseType) override {
+    return responseType == "blob";
+  }
+
+  winrt::Microsoft::ReactNative::JSValueObject ToResponseData(vector<uint8_t> &&content) override {
+    return {{"size", static_cast<int64_t>(content.size())}};
+  }
+};
+
+struct Measurements {
+  vector<steady_clock::duration> Latencies;
+  steady_clock::duration Duration{};
+  size_t ByteCount{0};
+  int64_t AllocationCount{-1};
+  string Error;
+};
+
+void Report(const char *name, Measurements &measurements) {
+  std::sort(measurements.Latencies.begin(), measurements.Latencies.end());
+  auto toMicroseconds = [](steady_clock::duration duration) {
+    return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+  };
+  double seconds = std::chrono::duration<double>(measurements.Duration).count();
+  size_t count = measurements.Latencies.size();
+
+  char line[512];
+  std::snprintf(
+      line,
+      sizeof(line),
+      "%s: %zu in %.0f ms, %.2f MB/s, %.0f/s, p50 %lld us, p99 %lld us, %lld allocations\n",
+      name,
+      count,
+      seconds * 1000,
+      seconds > 0 ? measurements.ByteCount / seconds / (1024 * 1024) : 0,
+      seconds > 0 ? count / seconds : 0,
+      count ? toMicroseconds(measurements.Latencies[count / 2]) : 0,
+      count ? toMicroseconds(measurements.Latencies[count * 99 / 100]) : 0,
+      static_cast<long long>(measurements.AllocationCount));
+  Logger::WriteMessage(line);
+}
+
+} // namespace
+
+namespace Microsoft::React::Test {
+
+// Loopback baselines for the networking resources. They print their measurements and are not run by default.
+TEST_CLASS (NetworkingPerformanceTest) {
+  static uint16_t s_port;
+
+  TEST_METHOD_CLEANUP(MethodCleanup) {
+    MicrosoftReactSetRuntimeOptionBool("WebSocket.ResourceV2", false);
+
+    // Bug in test servers does not correctly release TCP port between test methods.
+    // Using a different port per test for now.
+    s_port++;
+  }
+
+  // Sends the requests one at a time, so that the latency of each is measured alone
+  Measurements MeasureHttpRequests(
+      const string &responseType, bool useIncrementalUpdates, size_t bodySize, int requestCount) {
+    string url = "http://localhost:" + std::to_string(s_port);
+    const string body(bodySize, 'a');
+
+    auto server = make_shared<HttpServer>(s_port);
+    server->Callbacks().OnGet = [&body](const DynamicRequest &) -> ResponseWrapper {
+      StringResponse response;
+      response.result(http::status::ok);
+      response.body() = body;
+      response.prepare_payload();
+
+      return {std::move(response)};
+    };
+    server->Start();
+
+    auto resource = IHttpResource::Make();
+    auto responseHandler = make_shared<CountingResponseHandler>();
+    if (auto moduleProxy = std::dynamic_pointer_cast<IHttpModuleProxy>(resource)) {
+      moduleProxy->AddResponseHandler(responseHandler);
+    }
+
+    Measurements measurements;
+    std::unique_ptr<promise<void>> completed;
+    resource->SetOnData([&measurements](int64_t, string &&content) { measurements.ByteCount += content.size(); });
+    resource->SetOnData([&measurements, bodySize](int64_t, winrt::Microsoft::ReactNative::JSValueObject &&) {
+      measurements.ByteCount += bodySize;
+    });
+    resource->SetOnIncrementalData([&measurements](int64_t, string &&content, int64_t, int64_t) {
+      measurements.ByteCount += content.size();
+    });
+    resource->SetOnResponseComplete([&completed](int64_t) { completed->set_value(); });
+    resource->SetOnError([&completed, &measurements](int64_t, string &&message, bool) {
+      measurements.Error = std::move(message);
+      completed->set_value();
+    });
+
+    measurements.Latencies.reserve(requestCount);
+    AllocationCounter allocations;
+    auto start = steady_clock::now();
+    for (int i = 0; i < requestCount && measurements.Error.empty(); i++) {
+      completed = std::make_unique<promise<void>>();
+      auto requestStart = steady_clock::now();
+      resource->SendRequest(
+          "GET",
+          string{url},
+          i, /*requestId*/
+          {}, /*headers*/
+          {}, /*data*/
+          string{responseType},
+          useIncrementalUpdates,
+          0 /*timeout*/,
+          false /*withCredentials*/,
+          [](int64_t) {});
+      completed->get_future().wait();
+      measurements.Latencies.push_back(steady_clock::now() - requestStart);
+    }
+    measurements.Duration = steady_clock::now() - start;
+    measurements.AllocationCount = allocations.Count();
+
+    server->Stop();
+    return measurements;
+  }
+
+  // Keeps up to windowSize messages in flight to an echo server, and measures the time until each echo arrives
+  Measurements MeasureWebSocketMessages(bool isBinary, size_t messageSize, int messageCount, int windowSize) {
+    MicrosoftReactSetRuntimeOptionBool("WebSocket.ResourceV2", true);
+
+    auto server = make_shared<Test::WebSocketServer>(s_port);
+    server->SetMessageFactory([](string &&message) { return std::move(message); });
+    server->SetMessageFactory([](vector<uint8_t> &&message) { return std::move(message); });
+    server->Start();
+
+    Measurements measurements;
+    measurements.Latencies.reserve(messageCount);
+    std::mutex mutex;
+    std::condition_variable received;
+    std::deque<steady_clock::time_point> sendTimes;
+    int receivedCount = 0;
+    auto onEcho = [&](size_t size) {
+      std::scoped_lock lock{mutex};
+      measurements.Latencies.push_back(steady_clock::now() - sendTimes.front());
+      measurements.ByteCount += size;
+      sendTimes.pop_front();
+      receivedCount++;
+      received.notify_all();
+    };
+
+    promise<void> connected;
+    auto ws = IWebSocketResource::Make();
+    ws->SetOnConnect([&connected]() { connected.set_value(); });
+    ws->SetOnMessage([&onEcho](size_t size, const string &, bool) { onEcho(size); });
+    ws->SetOnBinaryMessage([&onEcho](vector<uint8_t> &&message) { onEcho(message.size()); });
+    ws->SetOnError([&](IWebSocketResource::Error &&error) {
+      std::scoped_lock lock{mutex};
+      measurements.Error = std::move(error.Message);
+      received.notify_all();
+    });
+    ws->Connect("ws://localhost:" + std::to_string(s_port));
+    if (connected.get_future().wait_for(std::chrono::seconds(10)) != std::future_status::ready) {
+      measurements.Error = "Connection timed out";
+      server->Stop();
+      return measurements;
+    }
+
+    const string textMessage(messageSize, 'a');
+    const vector<uint8_t> binaryMessage(messageSize, 0xAB);
+    AllocationCounter allocations;
+    auto start = steady_clock::now();
+    for (int i = 0; i < messageCount; i++) {
+      {
+        std::unique_lock lock{mutex};
+        received.wait(lock, [&]() {
+          return static_cast<int>(sendTimes.size()) < windowSize || !measurements.Error.empty();
+        });
+        if (!measurements.Error.empty()) {
+          break;
+        }
+        sendTimes.push_back(steady_clock::now());
+      }
+
+      if (isBinary) {
+        ws->SendBinary(vector<uint8_t>{binaryMessage});
+      } else {
+        ws->Send(string{textMessage});
+      }
+    }
+
+    {
+      std::unique_lock lock{mutex};
+      received.wait_for(lock, std::chrono::seconds(30), [&]() {
+        return receivedCount == messageCount || !measurements.Error.empty();
+      });
+    }
+    measurements.Duration = steady_clock::now() - start;
+    measurements.AllocationCount = allocations.Count();
+
+    ws->Close(IWebSocketResource::CloseCode::Normal, "Closing after measuring");
+    server->Stop();
+    return measurements;
+  }
+
+  BEGIN_TEST_METHOD_ATTRIBUTE(HttpResourceThroughput)
+  TEST_IGNORE()
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(HttpResourceThroughput) {
+    struct Case {
+      const char *Name;
+      const char *ResponseType;
+      bool UseIncrementalUpdates;
+      size_t BodySize;
+      int RequestCount;
+    };
+    const Case cases[] = {
+        {"HTTP text 1 KB", "text", false, 1024, 500},
+        {"HTTP text 8 MB", "text", false, 8 * 1024 * 1024, 20},
+        {"HTTP base64 8 MB", "base64", false, 8 * 1024 * 1024, 20},
+        {"HTTP blob 1 KB", "blob", false, 1024, 500},
+        {"HTTP blob 8 MB", "blob", false, 8 * 1024 * 1024, 20},
+        {"HTTP incremental text 8 MB", "text", true, 8 * 1024 * 1024, 20},
+    };
+
+    for (const auto &c : cases) {
+      auto measurements = MeasureHttpRequests(c.ResponseType, c.UseIncrementalUpdates, c.BodySize, c.RequestCount);
+      Assert::IsTrue(measurements.Error.empty(), Utf8ToUtf16(c.Name + (": " + measurements.Error)).c_str());
+      Report(c.Name, measurements);
+      s_port++;
+    }
+  }
+
+  BEGIN_TEST_METHOD_ATTRIBUTE(WebSocketResourceThroughput)
+  TEST_IGNORE()
+  END_TEST_METHOD_ATTRIBUTE()
+  TEST_METHOD(WebSocketResourceThroughput) {
+    struct Case {
+      const char *Name;
+      bool IsBinary;
+      size_t MessageSize;
+      int MessageCount;
+      int WindowSize;
+    };
+    const Case cases[] = {
+        {"WebSocket text 64 B, one at a time", false, 64, 2000, 1},
+        {"WebSocket text 64 B, 64 in flight", false, 64, 20000, 64},
+        {"WebSocket text 64 KB, 8 in flight", false, 64 * 1024, 1000, 8},
+        {"WebSocket binary 64 B, one at a time", true, 64, 2000, 1},
+        {"WebSocket binary 64 B, 64 in flight", true, 64, 20000, 64},
+        {"WebSocket binary 64 KB, 8 in flight", true, 64 * 1024, 1000, 8},
+        {"WebSocket binary 1 MB, 2 in flight", true, 1024 * 1024, 100, 2},
+    };
+
+    for (const auto &c : cases) {
+      auto measurements = MeasureWebSocketMessages(c.IsBinary, c.MessageSize, c.MessageCount, c.WindowSize);
+      Assert::IsTrue(measurements.Error.empty(), Utf8ToUtf16(c.Name + (": " + measurements.Error)).c_str());
+      Assert::IsTrue(static_cast<size_t>(c.MessageCount) == measurements.Latencies.size());
+      Report(c.Name, measurements);
+      s_port++;
+    }
+  }
+};
+
+/*static*/ uint16_t NetworkingPerformanceTest::s_port = 5650;
+
+} // namespace Microsoft::React::Test
@@ -4,6 +4,7 @@
 #include <CppUnitTest.h>
 
 #include <BaseFileReaderResource.h>
+#include <utilities.h>
 
 // Windows Libraries
 #include <winrt/Windows.Security.Cryptography.h>
@@ -17,44 +18,56 @@ using winrt::array_view;
 
 namespace Microsoft::React::Test {
 
-TEST_CLASS (BaseFileReaderResourceUnitTest) {
-  TEST_METHOD(Base64EncodesCorrectly) {
-    class DummyBlobPersistor final : public IBlobPersistor {
-      std::unordered_map<string, vector<uint8_t>> m_blobs;
+namespace {
+
+class DummyBlobPersistor final : public IBlobPersistor {
+  std::unordered_map<string, vector<uint8_t>> m_blobs;
 
-     public:
+ public:
 #pragma region IBlobPersistor
 
-      array_view<uint8_t const> ResolveMessage(string &&blobId, int64_t offset, int64_t size) override {
-        auto dataItr = m_blobs.find(std::move(blobId));
-        // Not found.
-        if (dataItr == m_blobs.cend())
-          throw std::invalid_argument("Blob object not found");
+  array_view<uint8_t const> ResolveMessage(string &&blobId, int64_t offset, int64_t size) override {
+    auto dataItr = m_blobs.find(std::move(blobId));
+    // Not found.
+    if (dataItr == m_blobs.cend())
+      throw std::invalid_argument("Blob object not found");
+
+    auto &bytes = (*dataItr).second;
+    auto endBound = static_cast<size_t>(offset + size);
+    // Out of bounds.
+    if (endBound > bytes.size() || offset >= static_cast<int64_t>(bytes.size()) || offset < 0)
+      throw std::out_of_range("Offset or size out of range");
+
+    return array_view<uint8_t const>(bytes.data() + offset, bytes.data() + endBound);
+  }
 
-        auto &bytes = (*dataItr).second;
-        auto endBound = static_cast<size_t>(offset + size);
-        // Out of bounds.
-        if (endBound > bytes.size() || offset >= static_cast<int64_t>(bytes.size()) || offset < 0)
-          throw std::out_of_range("Offset or size out of range");
+  void RemoveMessage(string && /*blobId*/) noexcept override {
+    // Not implemented
+  }
 
-        return array_view<uint8_t const>(bytes.data() + offset, bytes.data() + endBound);
-      }
+  void StoreMessage(vector<uint8_t> &&message, string &&blobId) noexcept override {
+    m_blobs.insert_or_assign(std::move(blobId), std::move(message));
+  }
 
-      void RemoveMessage(string && /*blobId*/) noexcept override {
-        // Not implemented
-      }
+  string StoreMessage(vector<uint8_t> && /*message*/) noexcept override {
+    return "Not implemented";
+  }
 
-      void StoreMessage(vector<uint8_t> &&message, string &&blobId) noexcept override {
-        m_blobs.insert_or_assign(std::move(blobId), std::move(message));
-      }
+  size_t BlobCount() noexcept override {
+    return m_blobs.size();
+  }
 
-      string StoreMessage(vector<uint8_t> && /*message*/) noexcept override {
-        return "Not implemented";
-      }
+  size_t MemoryUsage() noexcept override {
+    return 0;
+  }
 
 #pragma endregion IBlobPersistor
-    };
+};
 
+} // namespace
+
+TEST_CLASS (BaseFileReaderResourceUnitTest) {
+  TEST_METHOD(Base64EncodesCorrectly) {
     string messageStr = "abcde";
     // Computed using [System.Convert]::ToBase64String('abcd'.ToCharArray())
     constexpr char expected[] = "data:string;base64,YWJjZGU=";
@@ -76,6 +89,55 @@ TEST_CLASS (BaseFileReaderResourceUnitTest) {
 
     Assert::AreEqual(expected, result.c_str());
   }
+
+  TEST_METHOD(ReadsInChunks) {
+    // Larger than two chunks, and not a multiple of 3
+    constexpr size_t size = 7 * 1024 * 1024 + 1;
+    constexpr char guid[] = "0d4f7a3e-5c1b-4b7e-9f5a-2e8c6d1a3b90";
+
+    vector<uint8_t> message(size);
+    for (size_t i = 0; i < size; ++i) {
+      message[i] = static_cast<uint8_t>(i * 7);
+    }
+    string messageStr{message.begin(), message.end()};
+
+    shared_ptr<IBlobPersistor> persistor = std::make_shared<DummyBlobPersistor>();
+    persistor->StoreMessage(std::move(message), string{guid});
+    shared_ptr<IFileReaderResource> reader = std::make_shared<BaseFileReaderResource>(persistor);
+
+    vector<int64_t> progress;
+    reader->SetOnProgress([&progress](int64_t loaded, int64_t total) {
+      Assert::AreEqual(static_cast<int64_t>(size), total);
+      progress.push_back(loaded);
+    });
+
+    string text;
+    reader->ReadAsText(
+        guid,
+        0 /*offset*/,
+        size,
+        "UTF-8",
+        [&text](string &&value) { text = std::move(value); },
+        [](string &&) { Assert::Fail(L"Rejected"); });
+
+    Assert::IsTrue(messageStr == text);
+    Assert::AreEqual(3, static_cast<int>(progress.size()));
+    Assert::AreEqual(static_cast<int64_t>(size), progress.back());
+
+    progress.clear();
+    string dataUrl;
+    reader->ReadAsDataUrl(
+        guid,
+        0 /*offset*/,
+        size,
+        "application/octet-stream",
+        [&dataUrl](string &&value) { dataUrl = std::move(value); },
+        [](string &&) { Assert::Fail(L"Rejected"); });
+
+    Assert::IsTrue("data:application/octet-stream;base64," + Utilities::EncodeBase64(messageStr) == dataUrl);
+    Assert::AreEqual(3, static_cast<int>(progress.size()));
+    Assert::AreEqual(static_cast<int64_t>(size), progress.back());
+  }
 };
 
 } // namespace Microsoft::React::Test
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <CxxMessageQueue.h>
+#include <Threading/BatchingMessageQueue.h>
+
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using facebook::react::CxxMessageQueue;
+using Mso::React::BatchingMessageQueue;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+// Batches onto a CxxMessageQueue, which like the UI queue runs the sync tasks inline when called on its own thread
+struct RunningBatchingQueue {
+  std::shared_ptr<CxxMessageQueue> innerQueue{std::make_shared<CxxMessageQueue>()};
+  std::thread thread{CxxMessageQueue::getRunLoop(innerQueue)};
+  std::shared_ptr<BatchingMessageQueue> queue{std::make_shared<BatchingMessageQueue>(innerQueue)};
+
+  ~RunningBatchingQueue() {
+    queue->quitSynchronous();
+    thread.join();
+  }
+
+  // Keeps the inner queue busy until the returned promise is set, so that the tasks posted meanwhile join one batch
+  std::promise<void> block() {
+    std::promise<void> release;
+    innerQueue->runOnQueue([released = release.get_future().share()]() { released.wait(); });
+    return release;
+  }
+};
+
+} // namespace
+
+TEST_CLASS (BatchingMessageQueueTests) {
+  TEST_METHOD(SyncRunsPendingBatchFirst) {
+    RunningBatchingQueue running;
+    // Only touched on the inner queue thread, then read after the sync task
+    std::vector<int> order;
+
+    auto release = running.block();
+    running.queue->runOnQueue([&order]() { order.push_back(1); });
+    running.queue->runOnQueue([&order]() { order.push_back(2); });
+    release.set_value();
+    running.queue->runOnQueueSync([&order]() { order.push_back(3); });
+
+    Assert::IsTrue(order == std::vector<int>{1, 2, 3});
+  }
+
+  TEST_METHOD(SyncFromBatchedTaskKeepsBatchOrder) {
+    RunningBatchingQueue running;
+    std::vector<int> order;
+    auto queue = running.queue;
+
+    auto release = running.block();
+    queue->runOnQueue([&order, queue]() {
+      order.push_back(1);
+      // Starts a new batch, which must not run ahead of the rest of this one
+      queue->runOnQueue([&order]() { order.push_back(4); });
+      queue->runOnQueueSync([&order]() { order.push_back(2); });
+    });
+    queue->runOnQueue([&order]() { order.push_back(3); });
+    release.set_value();
+    queue->runOnQueueSync([]() {});
+
+    Assert::IsTrue(order == std::vector<int>{1, 2, 3, 4});
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,169 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/CachingHttpFilter.h>
+#include <Networking/WinRTTypes.h>
+#include "WinRTNetworkingMocks.h"
+
+// Windows API
+#include <winrt/Windows.Web.Http.Headers.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace winrt::Windows::Web::Http;
+
+using Microsoft::React::Networking::CachingHttpFilter;
+using Microsoft::React::Networking::ResponseOperation;
+using winrt::Windows::Foundation::Uri;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (CachingHttpFilterUnitTest) {
+  TEST_CLASS_INITIALIZE(Initialize) {
+    winrt::uninit_apartment();
+  }
+
+  static HttpResponseMessage MakeResponse(HttpStatusCode status, winrt::hstring const &body) {
+    HttpResponseMessage response{status};
+    HttpStringContent content{body};
+    content.Headers().ContentLength(winrt::to_string(body).size());
+    response.Content(content);
+
+    return response;
+  }
+
+  static HttpResponseMessage Send(HttpClient const &client, HttpMethod const &method, winrt::hstring const &url) {
+    auto sendOp = client.SendRequestAsync(HttpRequestMessage{method, Uri{url}});
+    sendOp.get();
+
+    return sendOp.GetResults();
+  }
+
+  static winrt::hstring ReadContent(HttpResponseMessage const &response) {
+    auto contentOp = response.Content().ReadAsStringAsync();
+    contentOp.get();
+
+    return contentOp.GetResults();
+  }
+
+  TEST_METHOD(ParseCacheControlSucceeds) {
+    auto directives = CachingHttpFilter::ParseCacheControl(L"No-Cache, max-age=\"120\" ,must-revalidate");
+
+    Assert::IsTrue(directives.NoCache);
+    Assert::IsTrue(directives.MustRevalidate);
+    Assert::IsFalse(directives.NoStore);
+    Assert::IsTrue(directives.MaxAge.has_value());
+    Assert::AreEqual(int64_t{120}, *directives.MaxAge);
+
+    auto invalid = CachingHttpFilter::ParseCacheControl(L"max-age=abc");
+    Assert::AreEqual(int64_t{0}, *invalid.MaxAge);
+  }
+
+  TEST_METHOD(FreshResponseIsServedFromCache) {
+    int requestCount = 0;
+    auto mockFilter = winrt::make<MockHttpBaseFilter>();
+    mockFilter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [&requestCount](HttpRequestMessage const &request) -> ResponseOperation {
+      ++requestCount;
+      auto response = MakeResponse(HttpStatusCode::Ok, L"Response Content");
+      response.Headers().TryAppendWithoutValidation(L"Cache-Control", L"max-age=60");
+
+      co_return response;
+    };
+
+    auto filter = winrt::make<CachingHttpFilter>(mockFilter, 1024 * 1024);
+    auto client = HttpClient{filter};
+
+    auto response1 = Send(client, HttpMethod::Get(), L"http://somehost/resource");
+    auto response2 = Send(client, HttpMethod::Get(), L"http://somehost/resource");
+
+    Assert::AreEqual(1, requestCount);
+    Assert::AreEqual(L"Response Content", ReadContent(response1).c_str());
+    Assert::AreEqual(L"Response Content", ReadContent(response2).c_str());
+    Assert::IsTrue(HttpResponseMessageSource::Cache == response2.Source());
+
+    auto statistics = filter.as<CachingHttpFilter>()->GetStatistics();
+    Assert::AreEqual(uint64_t{1}, statistics.Hits);
+    Assert::AreEqual(uint64_t{1}, statistics.Misses);
+    Assert::AreEqual(uint64_t{1}, statistics.Stores);
+  }
+
+  TEST_METHOD(StaleResponseIsRevalidated) {
+    int requestCount = 0;
+    auto mockFilter = winrt::make<MockHttpBaseFilter>();
+    mockFilter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [&requestCount](HttpRequestMessage const &request) -> ResponseOperation {
+      ++requestCount;
+      auto etag = request.Headers().TryLookup(L"If-None-Match");
+      if (etag && *etag == L"\"v1\"") {
+        co_return MakeResponse(HttpStatusCode::NotModified, L"");
+      }
+
+      auto response = MakeResponse(HttpStatusCode::Ok, L"Response Content");
+      response.Headers().TryAppendWithoutValidation(L"Cache-Control", L"no-cache");
+      response.Headers().TryAppendWithoutValidation(L"ETag", L"\"v1\"");
+
+      co_return response;
+    };
+
+    auto filter = winrt::make<CachingHttpFilter>(mockFilter, 1024 * 1024);
+    auto client = HttpClient{filter};
+
+    Send(client, HttpMethod::Get(), L"http://somehost/resource");
+    auto response = Send(client, HttpMethod::Get(), L"http://somehost/resource");
+
+    Assert::AreEqual(2, requestCount);
+    Assert::IsTrue(HttpStatusCode::Ok == response.StatusCode());
+    Assert::AreEqual(L"Response Content", ReadContent(response).c_str());
+    Assert::AreEqual(uint64_t{1}, filter.as<CachingHttpFilter>()->GetStatistics().Revalidations);
+  }
+
+  TEST_METHOD(NoStoreResponseIsNotCached) {
+    int requestCount = 0;
+    auto mockFilter = winrt::make<MockHttpBaseFilter>();
+    mockFilter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [&requestCount](HttpRequestMessage const &request) -> ResponseOperation {
+      ++requestCount;
+      auto response = MakeResponse(HttpStatusCode::Ok, L"Response Content");
+      response.Headers().TryAppendWithoutValidation(L"Cache-Control", L"no-store, max-age=60");
+
+      co_return response;
+    };
+
+    auto filter = winrt::make<CachingHttpFilter>(mockFilter, 1024 * 1024);
+    auto client = HttpClient{filter};
+
+    Send(client, HttpMethod::Get(), L"http://somehost/resource");
+    Send(client, HttpMethod::Get(), L"http://somehost/resource");
+
+    Assert::AreEqual(2, requestCount);
+    Assert::AreEqual(uint64_t{0}, filter.as<CachingHttpFilter>()->GetStatistics().Stores);
+  }
+
+  TEST_METHOD(UnsafeMethodInvalidatesStoredResponse) {
+    int getCount = 0;
+    auto mockFilter = winrt::make<MockHttpBaseFilter>();
+    mockFilter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [&getCount](HttpRequestMessage const &request) -> ResponseOperation {
+      if (request.Method().Method() == L"GET") {
+        ++getCount;
+      }
+      auto response = MakeResponse(HttpStatusCode::Ok, L"Response Content");
+      response.Headers().TryAppendWithoutValidation(L"Cache-Control", L"max-age=60");
+
+      co_return response;
+    };
+
+    auto filter = winrt::make<CachingHttpFilter>(mockFilter, 1024 * 1024);
+    auto client = HttpClient{filter};
+
+    Send(client, HttpMethod::Get(), L"http://somehost/resource");
+    Send(client, HttpMethod::Post(), L"http://somehost/resource");
+    Send(client, HttpMethod::Get(), L"http://somehost/resource");
+
+    Assert::AreEqual(2, getCount);
+  }
+};
+
+} // namespace Microsoft::React::Test
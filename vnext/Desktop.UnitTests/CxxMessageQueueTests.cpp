@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <CxxMessageQueue.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using facebook::react::CxxMessageQueue;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+constexpr auto c_timeout = std::chrono::seconds(5);
+
+// Runs the queue on its own thread for the lifetime of the test
+struct RunningQueue {
+  std::shared_ptr<CxxMessageQueue> queue{std::make_shared<CxxMessageQueue>()};
+  std::thread thread{CxxMessageQueue::getRunLoop(queue)};
+
+  ~RunningQueue() {
+    queue->quitSynchronous();
+    thread.join();
+  }
+
+  // Keeps the queue thread busy until the returned promise is set, so that the tasks posted meanwhile are all pending
+  // together
+  std::promise<void> block() {
+    std::promise<void> release;
+    queue->runOnQueue([released = std::make_shared<std::shared_future<void>>(release.get_future())]() {
+      released->wait();
+    });
+    return release;
+  }
+
+  // Waits until the tasks posted so far have run
+  void flush() {
+    queue->runOnQueueSync([]() {});
+  }
+};
+
+} // namespace
+
+TEST_CLASS (CxxMessageQueueTests) {
+  TEST_METHOD(ZeroDelayRunsAfterEarlierPostedTasks) {
+    RunningQueue running;
+    // Only touched on the queue thread, then read after flush
+    std::vector<int> order;
+
+    auto release = running.block();
+    running.queue->runOnQueue([&order]() { order.push_back(1); });
+    running.queue->runOnQueueDelayed([&order]() { order.push_back(2); }, 0);
+    running.queue->runOnQueue([&order]() { order.push_back(3); });
+    release.set_value();
+    running.flush();
+
+    Assert::IsTrue(order == std::vector<int>{1, 2, 3});
+  }
+
+  TEST_METHOD(SameDelayRunsInPostingOrder) {
+    RunningQueue running;
+    std::vector<int> order;
+    std::promise<void> done;
+
+    auto release = running.block();
+    for (int i = 0; i < 5; i++) {
+      running.queue->runOnQueueDelayed(
+          [&order, &done, i]() {
+            order.push_back(i);
+            if (order.size() == 5) {
+              done.set_value();
+            }
+          },
+          20);
+    }
+    release.set_value();
+
+    Assert::IsTrue(done.get_future().wait_for(c_timeout) == std::future_status::ready);
+    Assert::IsTrue(order == std::vector<int>{0, 1, 2, 3, 4});
+  }
+
+  TEST_METHOD(CancelDelayedBeforeAndAfterRun) {
+    RunningQueue running;
+    std::vector<int> order;
+
+    auto release = running.block();
+    auto immediateId = running.queue->runOnQueueDelayed([&order]() { order.push_back(1); }, 0);
+    auto delayedId = running.queue->runOnQueueDelayed([&order]() { order.push_back(2); }, 10);
+    Assert::IsTrue(running.queue->cancelDelayed(immediateId));
+    Assert::IsTrue(running.queue->cancelDelayed(delayedId));
+    // Canceling twice has no effect
+    Assert::IsFalse(running.queue->cancelDelayed(immediateId));
+    Assert::IsFalse(running.queue->cancelDelayed(delayedId));
+
+    std::promise<void> ran;
+    auto ranId = running.queue->runOnQueueDelayed(
+        [&order, &ran]() {
+          order.push_back(3);
+          ran.set_value();
+        },
+        10);
+    release.set_value();
+
+    Assert::IsTrue(ran.get_future().wait_for(c_timeout) == std::future_status::ready);
+    running.flush();
+    // The task already ran
+    Assert::IsFalse(running.queue->cancelDelayed(ranId));
+    Assert::IsTrue(order == std::vector<int>{3});
+  }
+
+  TEST_METHOD(CompactionKeepsLiveDelayedTasks) {
+    RunningQueue running;
+    constexpr int TaskCount = 200;
+    std::vector<int> order;
+    std::vector<int> expected;
+    std::promise<void> done;
+
+    std::vector<CxxMessageQueue::DelayedTaskId> ids;
+    auto release = running.block();
+    for (int i = 0; i < TaskCount; i++) {
+      if (i % 4 == 0) {
+        expected.push_back(i);
+      }
+      ids.push_back(running.queue->runOnQueueDelayed(
+          [&order, &done, &expected, i]() {
+            order.push_back(i);
+            if (order.size() == expected.size()) {
+              done.set_value();
+            }
+          },
+          30));
+    }
+
+    // Once the canceled tasks are more than half of the heap, it is compacted
+    for (int i = 0; i < TaskCount; i++) {
+      if (i % 4 != 0) {
+        Assert::IsTrue(running.queue->cancelDelayed(ids[i]));
+      }
+    }
+    release.set_value();
+
+    Assert::IsTrue(done.get_future().wait_for(c_timeout) == std::future_status::ready);
+    running.flush();
+    Assert::IsTrue(order == expected);
+    for (int i = 0; i < TaskCount; i++) {
+      Assert::IsFalse(running.queue->cancelDelayed(ids[i]));
+    }
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,197 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <DynamicReader.h>
+#include <DynamicWriter.h>
+#include <Modules/CxxModuleUtilities.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using folly::dynamic;
+using winrt::Microsoft::ReactNative::JSValue;
+using winrt::Microsoft::ReactNative::JSValueType;
+
+namespace Microsoft::React::Test {
+
+namespace {
+
+// The conversions that ToJSValue and ToDynamic replaced
+JSValue ReadWithDynamicReader(const dynamic &value) {
+  return JSValue::ReadFrom(winrt::make<winrt::Microsoft::ReactNative::DynamicReader>(value));
+}
+
+dynamic WriteWithDynamicWriter(const JSValue &value) {
+  auto writer = winrt::make<winrt::Microsoft::ReactNative::DynamicWriter>();
+  value.WriteTo(writer);
+  return winrt::get_self<winrt::Microsoft::ReactNative::DynamicWriter>(writer)->TakeValue();
+}
+
+// Unlike operator==, does not take an integer as equal to a double of the same value
+bool StrictEquals(const dynamic &left, const dynamic &right) {
+  if (left.type() != right.type()) {
+    return false;
+  }
+  switch (left.type()) {
+    case dynamic::Type::ARRAY:
+      return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin(), StrictEquals);
+    case dynamic::Type::OBJECT:
+      if (left.size() != right.size()) {
+        return false;
+      }
+      for (const auto &[key, item] : left.items()) {
+        auto it = right.find(key);
+        if (it == right.items().end() || !StrictEquals(item, it->second)) {
+          return false;
+        }
+      }
+      return true;
+    default:
+      return left == right;
+  }
+}
+
+dynamic MakeNestedDynamic() {
+  return dynamic::object("int", 42)("negative", -7)("bigInt", int64_t{9007199254740993})("double", 1.5)(
+      "integralDouble", 2.0)("true", true)("false", false)("null", nullptr)("string", "text \xE2\x9C\x93")(
+      "emptyString", "")("emptyObject", dynamic::object())("emptyArray", dynamic::array())(
+      "array",
+      dynamic::array(
+          1,
+          0.25,
+          "two",
+          nullptr,
+          false,
+          dynamic::array(dynamic::array(), dynamic::object("inner", dynamic::array(3, 4))),
+          dynamic::object("nested", dynamic::object("deeper", "value"))));
+}
+
+// The keys of a dynamic object do not have to be strings
+dynamic MakeNonStringKeyDynamic() {
+  dynamic value = dynamic::object();
+  value[7] = "seven";
+  value[true] = "yes";
+  value[2.5] = dynamic::array(1);
+  return value;
+}
+
+JSValue MakeNestedJSValue() {
+  return JSValue{winrt::Microsoft::ReactNative::JSValueObject{
+      {"int", 42},
+      {"double", 1.5},
+      {"true", true},
+      {"null", nullptr},
+      {"string", "text"},
+      {"emptyObject", winrt::Microsoft::ReactNative::JSValueObject{}},
+      {"emptyArray", winrt::Microsoft::ReactNative::JSValueArray{}},
+      {"array",
+       winrt::Microsoft::ReactNative::JSValueArray{
+           1,
+           0.25,
+           "two",
+           nullptr,
+           false,
+           winrt::Microsoft::ReactNative::JSValueArray{winrt::Microsoft::ReactNative::JSValueArray{}},
+           winrt::Microsoft::ReactNative::JSValueObject{
+               {"nested", winrt::Microsoft::ReactNative::JSValueObject{{"deeper", "value"}}}}}}}};
+}
+
+} // namespace
+
+TEST_CLASS (CxxModuleUtilitiesTests) {
+  TEST_METHOD(ToJSValueMatchesDynamicReader) {
+    for (const dynamic &value : std::initializer_list<dynamic>{
+             MakeNestedDynamic(),
+             MakeNonStringKeyDynamic(),
+             nullptr,
+             true,
+             int64_t{-1},
+             3.0,
+             0.5,
+             "",
+             dynamic::object(),
+             dynamic::array()}) {
+      Assert::IsTrue(Modules::ToJSValue(value).Equals(ReadWithDynamicReader(value)));
+    }
+  }
+
+  TEST_METHOD(ToJSValueKeepsValueTypes) {
+    auto value = Modules::ToJSValue(MakeNestedDynamic());
+    Assert::IsTrue(value["int"].Type() == JSValueType::Int64);
+    Assert::AreEqual(int64_t{9007199254740993}, value["bigInt"].AsInt64());
+    Assert::IsTrue(value["double"].Type() == JSValueType::Double);
+    // A double without a fractional part is read as an integer, as DynamicReader did
+    Assert::IsTrue(value["integralDouble"].Type() == JSValueType::Int64);
+    Assert::IsTrue(value["true"].Type() == JSValueType::Boolean);
+    Assert::IsTrue(value["null"].Type() == JSValueType::Null);
+    Assert::IsTrue(value["emptyObject"].Type() == JSValueType::Object);
+    Assert::AreEqual(size_t{0}, value["emptyObject"].AsObject().size());
+    Assert::IsTrue(value["emptyArray"].Type() == JSValueType::Array);
+    Assert::AreEqual(size_t{0}, value["emptyArray"].AsArray().size());
+    Assert::AreEqual(std::string{"value"}, value["array"][6]["nested"]["deeper"].AsString());
+
+    auto nonStringKeys = Modules::ToJSValue(MakeNonStringKeyDynamic());
+    Assert::AreEqual(std::string{"seven"}, nonStringKeys["7"].AsString());
+    Assert::AreEqual(std::string{"yes"}, nonStringKeys["true"].AsString());
+    Assert::IsTrue(nonStringKeys["2.5"].Type() == JSValueType::Array);
+  }
+
+  TEST_METHOD(ToJSValueOfRvalueMatchesCopy) {
+    for (const dynamic &value : std::initializer_list<dynamic>{MakeNestedDynamic(), MakeNonStringKeyDynamic()}) {
+      dynamic moved = value;
+      Assert::IsTrue(Modules::ToJSValue(std::move(moved)).Equals(Modules::ToJSValue(value)));
+    }
+  }
+
+  TEST_METHOD(ToDynamicMatchesDynamicWriter) {
+    auto nested = MakeNestedJSValue();
+    Assert::IsTrue(StrictEquals(Modules::ToDynamic(nested), WriteWithDynamicWriter(nested)));
+
+    for (const dynamic &value : std::initializer_list<dynamic>{MakeNestedDynamic(), MakeNonStringKeyDynamic()}) {
+      auto jsValue = Modules::ToJSValue(value);
+      Assert::IsTrue(StrictEquals(Modules::ToDynamic(jsValue), WriteWithDynamicWriter(jsValue)));
+    }
+
+    for (auto &&value : {JSValue{nullptr}, JSValue{true}, JSValue{-1}, JSValue{0.5}, JSValue{""}}) {
+      Assert::IsTrue(StrictEquals(Modules::ToDynamic(value), WriteWithDynamicWriter(value)));
+    }
+  }
+
+  TEST_METHOD(ToDynamicKeepsValueTypes) {
+    auto value = Modules::ToDynamic(MakeNestedJSValue());
+    Assert::IsTrue(value["int"].isInt());
+    Assert::IsTrue(value["double"].isDouble());
+    Assert::IsTrue(value["true"].isBool());
+    Assert::IsTrue(value["null"].isNull());
+    Assert::IsTrue(value["emptyObject"].isObject());
+    Assert::AreEqual(size_t{0}, value["emptyObject"].size());
+    Assert::IsTrue(value["emptyArray"].isArray());
+    Assert::AreEqual(size_t{0}, value["emptyArray"].size());
+    Assert::AreEqual(std::string{"value"}, value["array"][6]["nested"]["deeper"].getString());
+  }
+
+  TEST_METHOD(ToDynamicOfRvalueMatchesCopy) {
+    auto value = MakeNestedJSValue();
+    auto moved = value.Copy();
+    Assert::IsTrue(StrictEquals(Modules::ToDynamic(std::move(moved)), Modules::ToDynamic(value)));
+  }
+
+  TEST_METHOD(RoundTrips) {
+    // Without the doubles that have no fractional part, which become integers
+    auto value = MakeNestedDynamic();
+    value.erase("integralDouble");
+    Assert::IsTrue(StrictEquals(value, Modules::ToDynamic(Modules::ToJSValue(value))));
+    Assert::IsTrue(StrictEquals(value, Modules::ToDynamic(Modules::ToJSValue(dynamic{value}))));
+
+    auto jsValue = MakeNestedJSValue();
+    Assert::IsTrue(jsValue.Equals(Modules::ToJSValue(Modules::ToDynamic(jsValue))));
+    Assert::IsTrue(jsValue.Equals(Modules::ToJSValue(Modules::ToDynamic(jsValue.Copy()))));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/HttpRequestScheduler.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::Networking::HttpRequestPriority;
+using Microsoft::React::Networking::HttpRequestScheduler;
+using std::vector;
+using winrt::Windows::Foundation::Uri;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (HttpRequestSchedulerUnitTest) {
+  TEST_METHOD(PriorityHeaderMapsUrgency) {
+    Assert::IsTrue(HttpRequestPriority::Default == HttpRequestScheduler::PriorityFromHeader(""));
+    Assert::IsTrue(HttpRequestPriority::Critical == HttpRequestScheduler::PriorityFromHeader("u=0"));
+    Assert::IsTrue(HttpRequestPriority::Critical == HttpRequestScheduler::PriorityFromHeader("i, u=1"));
+    Assert::IsTrue(HttpRequestPriority::Default == HttpRequestScheduler::PriorityFromHeader("i"));
+    Assert::IsTrue(HttpRequestPriority::Image == HttpRequestScheduler::PriorityFromHeader(" u=5 , i"));
+    Assert::IsTrue(HttpRequestPriority::Prefetch == HttpRequestScheduler::PriorityFromHeader("u=7"));
+    Assert::IsTrue(HttpRequestPriority::Default == HttpRequestScheduler::PriorityFromHeader("u=9"));
+  }
+
+  TEST_METHOD(QueuedRequestsStartByPriority) {
+    HttpRequestScheduler scheduler{/*maxRunningRequestsPerOrigin*/ 2};
+    Uri uri{L"https://example.com/api"};
+    vector<int> started;
+    // Releasing a slot starts requests, which add their slots, so the vector must not grow while one is released
+    vector<HttpRequestScheduler::Slot> slots;
+    slots.reserve(8);
+    auto schedule = [&](HttpRequestPriority priority, int request) {
+      return scheduler.Schedule(uri, priority, [&, request](HttpRequestScheduler::Slot slot) {
+        started.push_back(request);
+        slots.push_back(std::move(slot));
+      });
+    };
+
+    schedule(HttpRequestPriority::Default, 1);
+    schedule(HttpRequestPriority::Default, 2);
+    schedule(HttpRequestPriority::Prefetch, 3);
+    auto cancelled = schedule(HttpRequestPriority::Image, 4);
+    schedule(HttpRequestPriority::Image, 5);
+    schedule(HttpRequestPriority::Default, 6);
+
+    // Critical requests do not wait for the origin, and requests to other origins do not wait behind it
+    schedule(HttpRequestPriority::Critical, 7);
+    scheduler.Schedule(Uri{L"https://example.com:8443/"}, HttpRequestPriority::Prefetch, [&](auto slot) {
+      started.push_back(8);
+      slots.push_back(std::move(slot));
+    });
+    Assert::IsTrue(vector<int>{1, 2, 7, 8} == started);
+
+    Assert::IsTrue(scheduler.Cancel(cancelled));
+    Assert::IsFalse(scheduler.Cancel(cancelled));
+
+    // Releasing the critical request frees no slot, the origin still runs two requests
+    slots[2] = nullptr;
+    Assert::AreEqual(size_t{4}, started.size());
+
+    slots[0] = nullptr;
+    Assert::IsTrue(vector<int>{1, 2, 7, 8, 6} == started);
+
+    // Images and prefetches leave one request of the limit to the more urgent ones
+    slots[1] = nullptr;
+    Assert::AreEqual(size_t{5}, started.size());
+    slots[4] = nullptr;
+    Assert::IsTrue(vector<int>{1, 2, 7, 8, 6, 5} == started);
+    slots[5] = nullptr;
+    Assert::IsTrue(vector<int>{1, 2, 7, 8, 6, 5, 3} == started);
+  }
+};
+
+} // namespace Microsoft::React::Test
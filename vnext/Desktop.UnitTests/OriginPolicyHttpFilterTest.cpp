@@ -3,6 +3,7 @@
 
 #include <CppUnitTest.h>
 
+#include <CppRuntimeOptions.h>
 #include <Networking/OriginPolicyHttpFilter.h>
 #include <Networking/WinRTTypes.h>
 #include "WinRTNetworkingMocks.h"
@@ -338,6 +339,67 @@ TEST_CLASS (OriginPolicyHttpFilterTest) {
     }
   }
 
+  TEST_METHOD(PreflightCacheKeyIdentifiesRequestShape) {
+    auto makeRequest = [](HttpMethod const &method, wchar_t const *headerName) {
+      auto request = HttpRequestMessage(method, Uri{L"http://somehost/api"});
+      request.Properties().Insert(L"RequestArgs", winrt::make<RequestArgs>());
+      request.Headers().TryAppendWithoutValidation(headerName, L"Value");
+      return request;
+    };
+
+    auto key = OriginPolicyHttpFilter::GetPreflightCacheKey(makeRequest(HttpMethod::Post(), L"X-Custom"));
+
+    Assert::AreEqual(key, OriginPolicyHttpFilter::GetPreflightCacheKey(makeRequest(HttpMethod::Post(), L"x-custom")));
+    Assert::AreNotEqual(key, OriginPolicyHttpFilter::GetPreflightCacheKey(makeRequest(HttpMethod::Put(), L"X-Custom")));
+    Assert::AreNotEqual(key, OriginPolicyHttpFilter::GetPreflightCacheKey(makeRequest(HttpMethod::Post(), L"X-Other")));
+  }
+
+  TEST_METHOD(PreflightIsCachedForMaxAge) {
+    int preflightCount = 0;
+    int requestCount = 0;
+    auto mockFilter = winrt::make<MockHttpBaseFilter>();
+    mockFilter.as<MockHttpBaseFilter>()->Mocks.SendRequestAsync =
+        [&preflightCount, &requestCount](HttpRequestMessage const &request) -> ResponseOperation {
+      HttpResponseMessage response{};
+      response.StatusCode(HttpStatusCode::Ok);
+      response.RequestMessage(request);
+
+      if (request.Method().Method() == L"OPTIONS") {
+        ++preflightCount;
+        response.Headers().Insert(L"Access-Control-Allow-Origin", L"http://somehost");
+        response.Headers().Insert(L"Access-Control-Allow-Methods", L"POST");
+        response.Headers().Insert(
+            L"Access-Control-Allow-Headers", request.Headers().Lookup(L"Access-Control-Request-Headers"));
+        response.Headers().Insert(L"Access-Control-Max-Age", L"60");
+      } else {
+        ++requestCount;
+        response.Headers().Insert(L"Access-Control-Allow-Origin", L"*");
+      }
+
+      co_return response;
+    };
+
+    using Networking::OriginPolicy;
+    SetRuntimeOptionInt("Http.OriginPolicy", static_cast<int32_t>(OriginPolicy::CrossOriginResourceSharing));
+
+    auto filter = winrt::make<OriginPolicyHttpFilter>("http://somehost", mockFilter);
+    auto client = HttpClient{filter};
+    for (int i = 0; i < 2; ++i) {
+      auto request = HttpRequestMessage(HttpMethod::Post(), Uri{L"http://otherhost/api"});
+      request.Properties().Insert(L"RequestArgs", winrt::make<RequestArgs>());
+      request.Headers().TryAppendWithoutValidation(L"X-Custom", L"Value");
+
+      auto sendOp = client.SendRequestAsync(request);
+      sendOp.get();
+      Assert::IsTrue(HttpStatusCode::Ok == sendOp.GetResults().StatusCode());
+    }
+
+    SetRuntimeOptionInt("Http.OriginPolicy", static_cast<int32_t>(OriginPolicy::None));
+
+    Assert::AreEqual(1, preflightCount);
+    Assert::AreEqual(2, requestCount);
+  }
+
   TEST_METHOD(GetOriginRespectsDefaultPorts) {
     constexpr const wchar_t *urls[] = {
         L"http://site.ext",
@@ -12,6 +12,8 @@
 // Standard Library
 #include <cstdio>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 
 using namespace facebook::jsi;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -68,5 +70,98 @@ TEST_CLASS (ScriptStoreIntegrationTest) {
     // plus 10% to account for memory used by hashing
     Assert::IsTrue(endWorkingSet - startWorkingSet < fileSize * 1.1);
   }
+
+  TEST_METHOD(PreparedScriptCacheEvictsLeastRecentlyUsedScripts) {
+    char tempPath[MAX_PATH];
+    if (!GetTempPathA(MAX_PATH, tempPath)) {
+      Assert::Fail(L"Could not get temporary folder");
+    }
+    const std::string storeDirectory = std::string{tempPath} + "PreparedScriptCacheTest\\";
+    std::filesystem::remove_all(storeDirectory);
+
+    constexpr size_t scriptSize = 1024;
+    auto script = make_shared<StringBuffer>(std::string(scriptSize, 'a'));
+    const auto runtimeSignature = JSRuntimeSignature{"Hermes", 1};
+    {
+      // Room for two of the three scripts. The destructor waits for the background writes.
+      facebook::react::PreparedScriptCache cache{storeDirectory, scriptSize * 2 + 256};
+      for (uint64_t version = 1; version <= 3; ++version) {
+        cache.persistPreparedScript(script, ScriptSignature{"index.bundle", version}, runtimeSignature, nullptr);
+        // Keeps the write times of the entries apart
+        Sleep(20);
+      }
+    }
+
+    facebook::react::PreparedScriptCache cache{storeDirectory, scriptSize * 2 + 256};
+    Assert::IsNull(cache.tryGetPreparedScript(ScriptSignature{"index.bundle", 1}, runtimeSignature, nullptr).get());
+    Assert::IsNotNull(cache.tryGetPreparedScript(ScriptSignature{"index.bundle", 3}, runtimeSignature, nullptr).get());
+    Assert::IsNull(
+        cache.tryGetPreparedScript(ScriptSignature{"index.bundle", 3}, JSRuntimeSignature{"Hermes", 2}, nullptr).get());
+  }
+
+  TEST_METHOD(PreparedScriptCachesShareScriptsInUse) {
+    char tempPath[MAX_PATH];
+    if (!GetTempPathA(MAX_PATH, tempPath)) {
+      Assert::Fail(L"Could not get temporary folder");
+    }
+    const std::string storeDirectory = std::string{tempPath} + "PreparedScriptCacheSharingTest\\";
+    std::filesystem::remove_all(storeDirectory);
+
+    const auto scriptSignature = ScriptSignature{"index.bundle", 1};
+    const auto runtimeSignature = JSRuntimeSignature{"Hermes", 1};
+    {
+      // The destructor waits for the background write.
+      facebook::react::PreparedScriptCache cache{storeDirectory};
+      cache.persistPreparedScript(
+          make_shared<StringBuffer>(std::string(1024, 'a')), scriptSignature, runtimeSignature, nullptr);
+    }
+
+    // Each instance of a process has its own cache
+    facebook::react::PreparedScriptCache firstCache{storeDirectory};
+    facebook::react::PreparedScriptCache secondCache{storeDirectory};
+    auto firstScript = firstCache.tryGetPreparedScript(scriptSignature, runtimeSignature, nullptr);
+    auto secondScript = secondCache.tryGetPreparedScript(scriptSignature, runtimeSignature, nullptr);
+    Assert::IsNotNull(firstScript.get());
+    Assert::IsTrue(firstScript == secondScript);
+
+    // A different runtime version does not share the script
+    Assert::IsNull(
+        secondCache.tryGetPreparedScript(scriptSignature, JSRuntimeSignature{"Hermes", 2}, nullptr).get());
+  }
+
+  TEST_METHOD(PreparedScriptCacheRejectsModifiedScripts) {
+    char tempPath[MAX_PATH];
+    if (!GetTempPathA(MAX_PATH, tempPath)) {
+      Assert::Fail(L"Could not get temporary folder");
+    }
+    const std::string storeDirectory = std::string{tempPath} + "PreparedScriptCacheTrustTest\";
+    std::filesystem::remove_all(storeDirectory);
+
+    const auto scriptSignature = ScriptSignature{"index.bundle", 1};
+    const auto runtimeSignature = JSRuntimeSignature{"Hermes", 1};
+    {
+      // The destructor waits for the background write, which trusts the entry it wrote.
+      facebook::react::PreparedScriptCache cache{storeDirectory};
+      cache.persistPreparedScript(
+          make_shared<StringBuffer>(std::string(1024, 'a')), scriptSignature, runtimeSignature, nullptr);
+    }
+
+    // Modifies a byte of the script in place, before it is ever loaded and mapped
+    std::filesystem::path entryPath;
+    for (const auto &entry : std::filesystem::directory_iterator(storeDirectory)) {
+      if (entry.path().extension() == ".hbc-cache") {
+        entryPath = entry.path();
+      }
+    }
+    Assert::IsFalse(entryPath.empty());
+    {
+      std::fstream file{entryPath, std::ios::binary | std::ios::in | std::ios::out};
+      file.seekp(std::filesystem::file_size(entryPath) / 2);
+      file.put('b');
+    }
+
+    facebook::react::PreparedScriptCache cache{storeDirectory};
+    Assert::IsNull(cache.tryGetPreparedScript(scriptSignature, runtimeSignature, nullptr).get());
+  }
 };
 } // namespace Microsoft::JSI::Test
@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+
+#include <Networking/SpillingBlobPersistor.h>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+using Microsoft::React::Networking::SpillingBlobPersistor;
+using std::string;
+using std::vector;
+
+namespace Microsoft::React::Test {
+
+TEST_CLASS (SpillingBlobPersistorUnitTest) {
+  static vector<uint8_t> Resolve(SpillingBlobPersistor &persistor, string const &blobId, int64_t offset, int64_t size) {
+    auto view = persistor.ResolveMessage(string{blobId}, offset, size);
+
+    return vector<uint8_t>(view.begin(), view.end());
+  }
+
+  TEST_METHOD(LargeBlobIsSpilledToDisk) {
+    SpillingBlobPersistor persistor{/*spillThreshold*/ 4, /*memoryBudget*/ 1024};
+
+    auto blobId = persistor.StoreMessage({1, 2, 3, 4, 5, 6, 7, 8});
+
+    Assert::AreEqual(size_t{0}, persistor.MemoryUsage());
+    Assert::IsTrue(vector<uint8_t>{3, 4, 5} == Resolve(persistor, blobId, 2, 3));
+  }
+
+  TEST_METHOD(MemoryBudgetSpillsLeastRecentlyUsedBlob) {
+    SpillingBlobPersistor persistor{/*spillThreshold*/ 1024, /*memoryBudget*/ 8};
+
+    auto first = persistor.StoreMessage({1, 2, 3, 4, 5, 6});
+    auto second = persistor.StoreMessage({7, 8, 9, 10, 11, 12});
+
+    Assert::AreEqual(size_t{6}, persistor.MemoryUsage());
+    Assert::IsTrue(vector<uint8_t>{1, 2, 3, 4, 5, 6} == Resolve(persistor, first, 0, 6));
+    Assert::IsTrue(vector<uint8_t>{7, 8, 9, 10, 11, 12} == Resolve(persistor, second, 0, 6));
+  }
+
+  TEST_METHOD(CompositeBlobSharesSourceBytes) {
+    SpillingBlobPersistor persistor{/*spillThreshold*/ 1024, /*memoryBudget*/ 1024};
+
+    auto first = persistor.StoreMessage({1, 2, 3});
+    auto second = persistor.StoreMessage({4, 5, 6});
+    persistor.StoreComposite({{first, 1, 2}, {second, 0, 2}}, "composite");
+    persistor.RemoveMessage(string{first});
+
+    // Source bytes are shared, not copied, and outlive the removed source blob.
+    Assert::AreEqual(size_t{6}, persistor.MemoryUsage());
+    Assert::IsTrue(vector<uint8_t>{3} == Resolve(persistor, "composite", 1, 1));
+
+    // A range spanning both parts joins the composite blob into contiguous memory.
+    Assert::IsTrue(vector<uint8_t>{2, 3, 4, 5} == Resolve(persistor, "composite", 0, 4));
+    Assert::AreEqual(size_t{7}, persistor.MemoryUsage());
+
+    persistor.RemoveMessage(string{second});
+    Assert::AreEqual(size_t{4}, persistor.MemoryUsage());
+  }
+
+  TEST_METHOD(CopySpanningSegmentsDoesNotJoinBlob) {
+    SpillingBlobPersistor persistor{/*spillThreshold*/ 4, /*memoryBudget*/ 1024};
+
+    auto first = persistor.StoreMessage({1, 2, 3});
+    auto second = persistor.StoreMessage({4, 5, 6, 7, 8});
+    persistor.StoreComposite({{first, 1, 2}, {second, 0, 5}}, "composite");
+
+    vector<uint8_t> destination(5);
+    persistor.CopyMessage("composite", 1, destination);
+
+    Assert::IsTrue(vector<uint8_t>{3, 4, 5, 6, 7} == destination);
+    Assert::AreEqual(size_t{3}, persistor.MemoryUsage());
+    Assert::ExpectException<std::out_of_range>([&persistor, &destination]() {
+      persistor.CopyMessage("composite", 3, destination);
+    });
+  }
+
+  TEST_METHOD(RemovedBlobCannotBeResolved) {
+    SpillingBlobPersistor persistor{/*spillThreshold*/ 4, /*memoryBudget*/ 1024};
+
+    auto spilled = persistor.StoreMessage({1, 2, 3, 4, 5, 6, 7, 8});
+    auto kept = persistor.StoreMessage({1, 2});
+    persistor.RemoveMessage(string{spilled});
+    persistor.RemoveMessage(string{kept});
+
+    Assert::AreEqual(size_t{0}, persistor.MemoryUsage());
+    Assert::ExpectException<std::invalid_argument>([&persistor, &spilled]() { Resolve(persistor, spilled, 0, 1); });
+    Assert::ExpectException<std::invalid_argument>([&persistor, &kept]() { Resolve(persistor, kept, 0, 1); });
+  }
+
+  TEST_METHOD(RemovedBatchCannotBeResolved) {
+    SpillingBlobPersistor persistor{/*spillThreshold*/ 4, /*memoryBudget*/ 1024};
+
+    auto spilled = persistor.StoreMessage({1, 2, 3, 4, 5, 6, 7, 8});
+    auto kept = persistor.StoreMessage({1, 2});
+    auto remaining = persistor.StoreMessage({3});
+    persistor.RemoveMessages({spilled, kept});
+
+    Assert::AreEqual(size_t{1}, persistor.BlobCount());
+    Assert::ExpectException<std::invalid_argument>([&persistor, &spilled]() { Resolve(persistor, spilled, 0, 1); });
+    Assert::ExpectException<std::invalid_argument>([&persistor, &kept]() { Resolve(persistor, kept, 0, 1); });
+    Assert::IsTrue(vector<uint8_t>{3} == Resolve(persistor, remaining, 0, 1));
+  }
+};
+
+} // namespace Microsoft::React::Test
@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Fabric/Composition/TagTable.h>
+
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::ReactNative::Test {
+
+namespace {
+
+// Tags whose probe sequence starts at homeIndex, in increasing order
+std::vector<facebook::react::Tag> TagsWithHome(const TagTable<int> &table, size_t homeIndex, size_t count) {
+  std::vector<facebook::react::Tag> tags;
+  for (facebook::react::Tag tag = 1; tags.size() < count; tag++) {
+    if (table.homeIndex(tag) == homeIndex) {
+      tags.push_back(tag);
+    }
+  }
+  return tags;
+}
+
+} // namespace
+
+TEST_CLASS (TagTableTests) {
+  TEST_METHOD(InsertFindErase) {
+    TagTable<int> table;
+    Assert::IsNull(table.find(1));
+    Assert::IsFalse(table.erase(1));
+
+    for (facebook::react::Tag tag = 1; tag <= 10; tag++) {
+      Assert::AreEqual(tag * 10, table.insert(tag, tag * 10));
+    }
+    Assert::AreEqual(size_t{10}, table.size());
+    Assert::AreEqual(TagTable<int>::InitialCapacity, table.capacity());
+
+    for (facebook::react::Tag tag = 1; tag <= 10; tag++) {
+      Assert::IsNotNull(table.find(tag));
+      Assert::AreEqual(tag * 10, *table.find(tag));
+    }
+    Assert::IsFalse(table.contains(11));
+
+    Assert::IsTrue(table.erase(4));
+    Assert::IsFalse(table.erase(4));
+    Assert::IsFalse(table.contains(4));
+    Assert::AreEqual(size_t{9}, table.size());
+
+    *table.find(5) = 42;
+    Assert::AreEqual(42, *table.find(5));
+
+    // An erased tag can be inserted again
+    table.insert(4, 4);
+    Assert::AreEqual(4, *table.find(4));
+    Assert::AreEqual(size_t{10}, table.size());
+  }
+
+  TEST_METHOD(EraseShiftsProbeChainAcrossTableEnd) {
+    TagTable<int> table;
+    // Give the table its initial capacity, so that the home slots of the tags can be computed
+    table.insert(1, 1);
+    table.erase(1);
+
+    auto lastSlot = table.capacity() - 1;
+    auto wrappingTags = TagsWithHome(table, lastSlot, 3);
+    auto firstSlotTag = TagsWithHome(table, 0, 1)[0];
+
+    // The probe chain fills the last slot, then wraps around to the first slots of the table:
+    // wrappingTags[0] in the last slot, wrappingTags[1] in slot 0, firstSlotTag in slot 1, wrappingTags[2] in slot 2
+    table.insert(wrappingTags[0], 0);
+    table.insert(wrappingTags[1], 1);
+    table.insert(firstSlotTag, 2);
+    table.insert(wrappingTags[2], 3);
+
+    // Erasing the head of the chain moves every later entry back across the end of the table
+    Assert::IsTrue(table.erase(wrappingTags[0]));
+    Assert::IsFalse(table.contains(wrappingTags[0]));
+    Assert::AreEqual(1, *table.find(wrappingTags[1]));
+    Assert::AreEqual(2, *table.find(firstSlotTag));
+    Assert::AreEqual(3, *table.find(wrappingTags[2]));
+
+    // Erasing an entry in the middle of the chain, after the wrap around
+    Assert::IsTrue(table.erase(firstSlotTag));
+    Assert::IsFalse(table.contains(firstSlotTag));
+    Assert::AreEqual(1, *table.find(wrappingTags[1]));
+    Assert::AreEqual(3, *table.find(wrappingTags[2]));
+
+    Assert::IsTrue(table.erase(wrappingTags[1]));
+    Assert::AreEqual(3, *table.find(wrappingTags[2]));
+    Assert::IsTrue(table.erase(wrappingTags[2]));
+    Assert::AreEqual(size_t{0}, table.size());
+
+    int count = 0;
+    table.forEach([&count](facebook::react::Tag, int) { count++; });
+    Assert::AreEqual(0, count);
+  }
+
+  TEST_METHOD(GrowthKeepsLiveEntries) {
+    TagTable<int> table;
+    constexpr int TagCount = 2000;
+    // Sequential tags like the ones React assigns, with some negative ones mixed in
+    for (int i = 0; i < TagCount; i++) {
+      table.insert(i % 3 == 0 ? -i - 1 : i + 1, int{i});
+    }
+    Assert::AreEqual(static_cast<size_t>(TagCount), table.size());
+    Assert::IsTrue(table.capacity() >= static_cast<size_t>(TagCount) * 2);
+
+    for (int i = 0; i < TagCount; i++) {
+      Assert::AreEqual(i, *table.find(i % 3 == 0 ? -i - 1 : i + 1));
+    }
+
+    // Erase half of the entries, then grow the table again with them out of it
+    for (int i = 0; i < TagCount; i += 2) {
+      Assert::IsTrue(table.erase(i % 3 == 0 ? -i - 1 : i + 1));
+    }
+    for (int i = TagCount; i < TagCount * 2; i++) {
+      table.insert(i + 1, int{i});
+    }
+    Assert::AreEqual(static_cast<size_t>(TagCount / 2 + TagCount), table.size());
+
+    for (int i = 0; i < TagCount; i++) {
+      auto value = table.find(i % 3 == 0 ? -i - 1 : i + 1);
+      if (i % 2 == 0) {
+        Assert::IsNull(value);
+      } else {
+        Assert::AreEqual(i, *value);
+      }
+    }
+    for (int i = TagCount; i < TagCount * 2; i++) {
+      Assert::AreEqual(i, *table.find(i + 1));
+    }
+
+    size_t count = 0;
+    table.forEach([&count](facebook::react::Tag, int) { count++; });
+    Assert::AreEqual(table.size(), count);
+  }
+};
+
+} // namespace Microsoft::ReactNative::Test
@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <Modules/TimerQueue.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace Microsoft::ReactNative::Test {
+
+namespace {
+
+TDateTime TimeAt(int64_t ms) {
+  return TDateTime{std::chrono::milliseconds(ms)};
+}
+
+std::vector<uint32_t> PopAll(TimerQueue &queue) {
+  std::vector<uint32_t> ids;
+  while (!queue.IsEmpty()) {
+    ids.push_back(queue.Front().Id);
+    queue.Pop();
+  }
+  return ids;
+}
+
+} // namespace
+
+TEST_CLASS (TimerQueueTests) {
+  TEST_METHOD(PopsInTargetTimeOrder) {
+    TimerQueue queue;
+    queue.Push(1, TimeAt(30), TTimeSpan::zero(), false);
+    queue.Push(2, TimeAt(10), TTimeSpan::zero(), false);
+    queue.Push(3, TimeAt(20), TTimeSpan::zero(), false);
+
+    Assert::IsTrue(PopAll(queue) == std::vector<uint32_t>{2, 3, 1});
+  }
+
+  TEST_METHOD(RemoveKeepsOrder) {
+    TimerQueue queue;
+    for (uint32_t id = 1; id <= 8; id++) {
+      queue.Push(id, TimeAt(100 - id * 10), TTimeSpan::zero(), false);
+    }
+    queue.Remove(8);
+    queue.Remove(3);
+    queue.Remove(42);
+
+    Assert::AreEqual(size_t{6}, queue.Size());
+    Assert::IsTrue(PopAll(queue) == std::vector<uint32_t>{7, 6, 5, 4, 2, 1});
+  }
+
+  TEST_METHOD(PushReplacesTimerWithSameId) {
+    TimerQueue queue;
+    queue.Push(1, TimeAt(10), TTimeSpan::zero(), false);
+    queue.Push(2, TimeAt(20), TTimeSpan::zero(), false);
+    queue.Push(1, TimeAt(30), TTimeSpan::zero(), false);
+
+    Assert::AreEqual(size_t{2}, queue.Size());
+    Assert::IsTrue(PopAll(queue) == std::vector<uint32_t>{2, 1});
+  }
+
+  // Most debounce timers are cleared before they fire, which must not get slower with the number of pending timers
+  TEST_METHOD(Benchmark_CancelMostTimers) {
+    constexpr uint32_t timerCount = 100000;
+    std::mt19937 random{42};
+    std::uniform_int_distribution<int64_t> delay{1, 60000};
+
+    TimerQueue queue;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t id = 0; id < timerCount; id++) {
+      queue.Push(id, TimeAt(delay(random)), TTimeSpan::zero(), false);
+    }
+    for (uint32_t id = 0; id < timerCount; id++) {
+      if (id % 10 != 0) {
+        queue.Remove(id);
+      }
+    }
+    const auto elapsed =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    Assert::AreEqual(size_t{timerCount / 10}, queue.Size());
+    auto previous = TimeAt(0);
+    while (!queue.IsEmpty()) {
+      Assert::IsTrue(previous <= queue.Front().TargetTime);
+      previous = queue.Front().TargetTime;
+      queue.Pop();
+    }
+
+    Logger::WriteMessage(
+        ("Pushed " + std::to_string(timerCount) + " timers and removed 90% of them in " + std::to_string(elapsed) +
+         " ms\n")
+            .c_str());
+  }
+};
+
+} // namespace Microsoft::ReactNative::Test
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include <CppUnitTest.h>
+#include <chrono>
 #include <string>
 #include "Unicode.h"
 #include "UnicodeTestStrings.h"
@@ -9,6 +10,7 @@
 using Microsoft::Common::Unicode::Utf16ToUtf8;
 using Microsoft::Common::Unicode::Utf8ToUtf16;
 using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
 
 namespace Microsoft::React::Test {
 
@@ -99,6 +101,73 @@ TEST_CLASS (UnicodeConversionTest) {
     }
   }
 
+  TEST_METHOD(AsciiPrefixLengthsTest) {
+    // The ASCII prefix is converted 16 code units at a time, so check that
+    // non ASCII characters are found at every position within and after a
+    // block, and that strings of every length around the block size convert.
+    for (size_t prefixLength = 0; prefixLength < 40; ++prefixLength) {
+      const std::string asciiUtf8(prefixLength, 'a');
+      const std::wstring asciiUtf16(prefixLength, L'a');
+      Assert::IsTrue(Utf8ToUtf16(asciiUtf8) == asciiUtf16);
+      Assert::IsTrue(Utf16ToUtf8(asciiUtf16) == asciiUtf8);
+
+      // U+00E9 followed by U+1F600, which needs a surrogate pair
+      const std::string mixedUtf8 = asciiUtf8 + "\xc3\xa9\xf0\x9f\x98\x80" + asciiUtf8;
+      const std::wstring mixedUtf16 = asciiUtf16 + L"\x00e9\xd83d\xde00" + asciiUtf16;
+      Assert::IsTrue(Utf8ToUtf16(mixedUtf8) == mixedUtf16);
+      Assert::IsTrue(Utf16ToUtf8(mixedUtf16) == mixedUtf8);
+    }
+  }
+
+  TEST_METHOD(InvalidCharacterAfterAsciiPrefixTest) {
+    const std::string asciiUtf8(20, 'a');
+    const std::wstring asciiUtf16(20, L'a');
+
+    Assert::IsTrue(Utf8ToUtf16(asciiUtf8 + "\xcc\x22\x3c") == asciiUtf16 + L"\xfffd\x0022\x003c");
+    Assert::IsTrue(Utf8ToUtf16(asciiUtf8 + "\xed\xa3\xa9") == asciiUtf16 + L"\xfffd\xfffd");
+    Assert::IsTrue(Utf16ToUtf8(asciiUtf16 + L"\xd801\x0022") == asciiUtf8 + "\xef\xbf\xbd\x22");
+  }
+
+  TEST_METHOD(ConversionBenchmark) {
+    // Not a pass/fail test; reports the conversion throughput of strings
+    // typical for text layout and prop values.
+    constexpr int iterations = 10000;
+    const std::string ascii(4096, 'a');
+    std::string mixed;
+    while (mixed.size() < 4096) {
+      mixed += "Text with an accent \xc3\xa9 and an emoji \xf0\x9f\x98\x80. ";
+    }
+
+    for (const auto &[name, utf8] : {std::make_pair("ascii", ascii), std::make_pair("mixed", mixed)}) {
+      const std::wstring utf16 = Utf8ToUtf16(utf8);
+      size_t checksum = 0;
+
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; ++i) {
+        checksum += Utf8ToUtf16(utf8).size();
+      }
+      auto toUtf16 = std::chrono::steady_clock::now() - start;
+
+      start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; ++i) {
+        checksum += Utf16ToUtf8(utf16).size();
+      }
+      auto toUtf8 = std::chrono::steady_clock::now() - start;
+
+      Assert::IsTrue(checksum == iterations * (utf8.size() + utf16.size()));
+
+      const double megabytes = static_cast<double>(utf8.size()) * iterations / (1024 * 1024);
+      char message[128];
+      sprintf_s(
+          message,
+          "%s: Utf8ToUtf16 %.1f MB/s, Utf16ToUtf8 %.1f MB/s",
+          name,
+          megabytes / std::chrono::duration<double>(toUtf16).count(),
+          megabytes / std::chrono::duration<double>(toUtf8).count());
+      Logger::WriteMessage(message);
+    }
+  }
+
  private:
   constexpr static const char *SimpleTestStringNoBomUtf8 = "\x61\x62\x63"; // abc
   constexpr static const wchar_t *SimpleTestStringNoBomUtf16 = L"\x0061\x0062\x0063"; // abc
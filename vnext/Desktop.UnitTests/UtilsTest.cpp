@@ -267,6 +267,42 @@ TEST_CLASS(UtilsTest)
     }
   }
 
+  TEST_METHOD(DecodeUnpaddedBase64Succeeds)
+  {
+    std::vector<uint8_t> bytes;
+
+    Assert::IsTrue(Utilities::TryDecodeBase64("AAECAwQ", bytes));
+    Assert::IsTrue(std::vector<uint8_t>{ 0, 1, 2, 3, 4 } == bytes);
+  }
+
+  TEST_METHOD(DecodeInvalidBase64Fails)
+  {
+    constexpr const char* messages[] =
+    {
+      "Y",
+      "YQ=a",
+      "Y===",
+      "YW!j",
+      "YWJj\n"
+    };
+
+    for (auto message : messages)
+    {
+      std::vector<uint8_t> bytes;
+      Assert::IsFalse(Utilities::TryDecodeBase64(message, bytes));
+      Assert::IsTrue(bytes.empty());
+    }
+  }
+
+  TEST_METHOD(AppendBase64AppendsToExistingString)
+  {
+    string result = "data:;base64,";
+    Utilities::AppendBase64("abcd", result);
+
+    Assert::AreEqual("data:;base64,YWJjZA==", result.c_str());
+    Assert::AreEqual(size_t{8}, Utilities::Base64EncodedLength(4));
+  }
+
 #pragma endregion Base64 Tests
 
 #pragma region FormatString Tests
@@ -11,12 +11,15 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
     std::function<void()> Ping;
     std::function<void(const std::string &)> Send;
     std::function<void(const std::string &)> SendBinary;
+    std::function<void(const std::vector<uint8_t> &)> SendBinaryBytes;
     std::function<void(CloseCode, const std::string &)> Close;
     std::function<ReadyState() /*const*/> GetReadyState;
+    std::function<std::size_t() /*const*/> GetBufferedAmount;
     std::function<void(std::function<void()> &&)> SetOnConnect;
     std::function<void(std::function<void()> &&)> SetOnPing;
     std::function<void(std::function<void(std::size_t)> &&)> SetOnSend;
     std::function<void(std::function<void(std::size_t, const std::string &, bool)> &&)> SetOnMessage;
+    std::function<void(std::function<void(std::vector<uint8_t> &&)> &&)> SetOnBinaryMessage;
     std::function<void(std::function<void(CloseCode, const std::string &)> &&)> SetOnClose;
     std::function<void(std::function<void(Error &&)> &&)> SetOnError;
   };
@@ -33,10 +36,14 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
 
   void SendBinary(std::string &&) noexcept override;
 
+  void SendBinary(std::vector<uint8_t> &&) noexcept override;
+
   void Close(CloseCode, const std::string &) noexcept override;
 
   ReadyState GetReadyState() const noexcept override;
 
+  std::size_t GetBufferedAmount() const noexcept override;
+
   void SetOnConnect(std::function<void()> &&onConnect) noexcept override;
 
   void SetOnPing(std::function<void()> &&) noexcept override;
@@ -45,6 +52,8 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
 
   void SetOnMessage(std::function<void(std::size_t, const std::string &, bool)> &&) noexcept override;
 
+  void SetOnBinaryMessage(std::function<void(std::vector<uint8_t> &&)> &&) noexcept override;
+
   void SetOnClose(std::function<void(CloseCode, const std::string &)> &&) noexcept override;
 
   void SetOnError(std::function<void(Error &&)> &&) noexcept override;
@@ -55,6 +64,7 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
   void OnPing();
   void OnSend(std::size_t size);
   void OnMessage(std::size_t, const std::string &message, bool isBinary);
+  void OnBinaryMessage(std::vector<uint8_t> &&message);
   void OnClose(CloseCode code, const std::string &reason);
   void OnError(Error &&error);
 
@@ -63,6 +73,7 @@ struct MockWebSocketResource : public Networking::IWebSocketResource {
   std::function<void()> m_pingHandler;
   std::function<void(std::size_t)> m_writeHandler;
   std::function<void(std::size_t, const std::string &, bool)> m_readHandler;
+  std::function<void(std::vector<uint8_t> &&)> m_binaryReadHandler;
   std::function<void(CloseCode, const std::string &)> m_closeHandler;
   std::function<void(Error &&)> m_errorHandler;
 };
@@ -3,6 +3,7 @@
 
 #include <CppUnitTest.h>
 
+#include <CppRuntimeOptions.h>
 #include <Networking/WinRTWebSocketResource.h>
 #include "WinRTNetworkingMocks.h"
 
@@ -137,6 +138,34 @@ TEST_CLASS (WinRTWebSocketResourceUnitTest) {
     Assert::IsFalse(connected);
   }
 
+  TEST_METHOD(SendExceedingMaxBufferedAmountFails) {
+    Logger::WriteMessage(
+        "Microsoft::React::Test::WinRTWebSocketResourceUnitTest::SendExceedingMaxBufferedAmountFails");
+    string errorMessage;
+    promise<void> donePromise;
+    SetRuntimeOptionInt("WebSocket.MaxBufferedAmount", 4);
+
+    auto rc = make_shared<WinRTWebSocketResource2>(
+        winrt::make<MockMessageWebSocket>(),
+        MockDataWriter{},
+        CertExceptions{},
+        Mso::DispatchQueue::MakeSerialQueue());
+    rc->SetOnError([&errorMessage, &donePromise](Error &&error) {
+      if (error.Type == IWebSocketResource::ErrorType::Send) {
+        errorMessage = error.Message;
+        donePromise.set_value();
+      }
+    });
+
+    rc->Send("Longer than four bytes");
+
+    donePromise.get_future().wait();
+    SetRuntimeOptionInt("WebSocket.MaxBufferedAmount", 0);
+
+    Assert::AreEqual({"Send buffer is full"}, errorMessage);
+    Assert::AreEqual(size_t{0}, rc->GetBufferedAmount());
+  }
+
   TEST_METHOD(InternalSocketThrowsHResult) {
     Logger::WriteMessage("Microsoft::React::Test::WinRTWebSocketResourceUnitTest::InternalSocketThrowsHResult");
     shared_ptr<WinRTWebSocketResource2> rc;
@@ -28,6 +28,15 @@ JSBigStringResourceDll::JSBigStringResourceDll(HMODULE dll, HRSRC resource) {
   if (this->c_str()[this->size()] != '\0') {
     throw std::invalid_argument("Resource was not null-terminated");
   }
+
+  // The string points into the module, so it holds a reference to it.
+  if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, reinterpret_cast<LPCWSTR>(dll), &this->module)) {
+    throw std::invalid_argument("Could not add a reference to the resource module");
+  }
+}
+
+JSBigStringResourceDll::~JSBigStringResourceDll() {
+  FreeLibrary(module);
 }
 
 std::unique_ptr<const JSBigStringResourceDll> JSBigStringResourceDll::Make(HMODULE dll, HRSRC resource) {
@@ -9,11 +9,16 @@
 namespace facebook {
 namespace react {
 
+// Points at the data of a resource, and keeps its module loaded while the string is in use.
 class JSBigStringResourceDll final : public JSBigString {
  public:
   static std::unique_ptr<const JSBigStringResourceDll> Make(HMODULE dll, HRSRC resource);
 
   JSBigStringResourceDll(HMODULE dll, HRSRC resource);
+  ~JSBigStringResourceDll() override;
+
+  JSBigStringResourceDll(const JSBigStringResourceDll &) = delete;
+  JSBigStringResourceDll &operator=(const JSBigStringResourceDll &) = delete;
 
   virtual bool isAscii() const override {
     return false;
@@ -28,6 +33,7 @@ class JSBigStringResourceDll final : public JSBigString {
   }
 
  private:
+  HMODULE module{nullptr};
   char *resource;
   uint32_t resourceSize;
 };
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSValueFlatObject.h"
+#include "JsonJSValueReader.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+TEST_CLASS (JSValueFlatObjectTest) {
+  TEST_METHOD(TestInitializerList) {
+    JSValueFlatObject obj{{"Y", 2}, {"X", 1}, {"Z", 3}, {"X", 4}};
+    TestCheckEqual(3u, obj.size());
+
+    // The properties are sorted by name, and the first one wins for duplicate names
+    auto it = obj.begin();
+    TestCheckEqual("X", (it++)->first);
+    TestCheckEqual("Y", (it++)->first);
+    TestCheckEqual("Z", (it++)->first);
+    TestCheck(it == obj.end());
+    TestCheck(obj["X"] == 1);
+    TestCheck(obj["Z"] == 3);
+  }
+
+  TEST_METHOD(TestFindAndModify) {
+    JSValueFlatObject obj;
+    obj["b"] = "B";
+    obj["a"] = 1;
+    TestCheckEqual(2u, obj.size());
+    TestCheck(obj.begin()->first == "a");
+
+    TestCheck(!obj.try_emplace("a", 2).second);
+    TestCheck(obj["a"] == 1);
+    TestCheck(obj.try_emplace("c", true).second);
+    TestCheckEqual(1u, obj.count("c"));
+
+    TestCheckEqual(1u, obj.erase("b"));
+    TestCheckEqual(0u, obj.erase("b"));
+    TestCheck(obj.find("b") == obj.end());
+
+    const JSValueFlatObject &constObj = obj;
+    TestCheck(constObj["missing"].IsNull());
+    TestCheckEqual(2u, obj.size());
+  }
+
+  TEST_METHOD(TestReadWrite) {
+    const wchar_t *json = LR"JSON({"Name": "Robot", "Age": 5, "Parts": {"Arms": 2}, "Age": 6})JSON";
+    IJSValueReader reader = make<JsonJSValueReader>(json);
+    auto obj = JSValueFlatObject::ReadFrom(reader);
+    TestCheckEqual(3u, obj.size());
+    TestCheck(obj["Age"] == 5);
+    TestCheck(obj["Name"] == "Robot");
+    TestCheck(obj["Parts"]["Arms"] == 2);
+
+    auto writer = MakeJSValueTreeWriter();
+    WriteValue(writer, obj);
+    JSValue jsValue = TakeJSValue(writer);
+    TestCheck(jsValue == JSValueObject{{"Age", 5}, {"Name", "Robot"}, {"Parts", JSValueObject{{"Arms", 2}}}});
+  }
+
+  TEST_METHOD(TestConvertToAndFromJSValueObject) {
+    JSValueFlatObject obj(JSValueObject{{"X", 1}, {"Y", JSValueArray{1, 2}}});
+    TestCheck(obj.Copy() == obj);
+    TestCheck(obj.JSEquals(JSValueFlatObject{{"X", "1"}, {"Y", JSValueArray{"1", 2}}}));
+
+    JSValueObject mapObj = obj.MoveToObject();
+    TestCheck(obj.empty());
+    TestCheck(mapObj == JSValueObject{{"X", 1}, {"Y", JSValueArray{1, 2}}});
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
@@ -480,6 +480,68 @@ TEST_CLASS (JSValueReaderTest) {
     TestCheck(jsValue["NullValue"] == nullptr);
     TestCheck(jsValue["NullValue"] == JSValue::Null);
   }
+
+  TEST_METHOD(TestReadNumberArrays) {
+    JSValue jsValue = JSValueObject{
+        {"Array1", JSValueArray{1, 2.5, 3}},
+        {"Array2", JSValueArray{1, 2, 3}},
+        {"Array3", JSValueArray{1, "2", 3}},
+        {"Value", 42}};
+    IJSValueReader reader = MakeJSValueTreeReader(jsValue);
+    TestCheck(reader.try_as<IJSValueReader2>() != nullptr);
+
+    TestCheck(reader.ValueType() == JSValueType::Object);
+    hstring propertyName;
+    TestCheck(reader.GetNextObjectProperty(/*out*/ propertyName));
+    TestCheck(ReadValue<std::vector<double>>(reader) == std::vector<double>{1, 2.5, 3});
+    TestCheck(reader.GetNextObjectProperty(/*out*/ propertyName));
+    TestCheck(ReadValue<std::vector<int32_t>>(reader) == std::vector<int32_t>{1, 2, 3});
+    // Arrays with items of other types are read item by item with the same conversions
+    TestCheck(reader.GetNextObjectProperty(/*out*/ propertyName));
+    TestCheck(ReadValue<std::vector<int32_t>>(reader) == std::vector<int32_t>{1, 2, 3});
+    TestCheck(reader.GetNextObjectProperty(/*out*/ propertyName));
+    TestCheck(propertyName == L"Value");
+    TestCheck(ReadValue<int32_t>(reader) == 42);
+    TestCheck(!reader.GetNextObjectProperty(/*out*/ propertyName));
+  }
+
+  TEST_METHOD(TestWriteNumberArrays) {
+    auto writer = MakeJSValueTreeWriter();
+    TestCheck(writer.try_as<IJSValueWriter2>() != nullptr);
+    writer.WriteObjectBegin();
+    WriteProperty(writer, L"Doubles", std::vector<double>{1, 2.5, 3});
+    WriteProperty(writer, L"Floats", std::vector<float>{1.5f, 2});
+    WriteProperty(writer, L"Ints", std::vector<int32_t>{1, 2, 3});
+    writer.WriteObjectEnd();
+
+    auto jsValue = TakeJSValue(writer);
+    TestCheck(jsValue["Doubles"] == JSValueArray{1, 2.5, 3});
+    TestCheck(jsValue["Floats"] == JSValueArray{1.5, 2});
+    TestCheck(jsValue["Ints"] == JSValueArray{1, 2, 3});
+  }
+
+  TEST_METHOD(TestReadWriteBuffer) {
+    Windows::Storage::Streams::Buffer buffer{3};
+    buffer.data()[0] = 1;
+    buffer.data()[1] = 2;
+    buffer.data()[2] = 255;
+    buffer.Length(3);
+
+    // JSValue has no binary values, so the bytes are written as an array
+    auto writer = MakeJSValueTreeWriter();
+    WriteValue(writer, Windows::Storage::Streams::IBuffer{buffer});
+    auto jsValue = TakeJSValue(writer);
+    TestCheck(jsValue == JSValueArray{1, 2, 255});
+
+    IJSValueReader reader = MakeJSValueTreeReader(jsValue);
+    auto readBuffer = ReadValue<Windows::Storage::Streams::IBuffer>(reader);
+    TestCheck(readBuffer.Length() == 3);
+    TestCheck(readBuffer.data()[0] == 1);
+    TestCheck(readBuffer.data()[1] == 2);
+    TestCheck(readBuffer.data()[2] == 255);
+
+    TestCheck(!ReadValue<Windows::Storage::Streams::IBuffer>(MakeJSValueTreeReader(JSValue{"Hello"})));
+  }
 };
 
 } // namespace winrt::Microsoft::ReactNative
@@ -575,6 +575,26 @@ struct SimpleNativeModule {
     return "Hello";
   }
 
+  REACT_JSI_SYNC_METHOD(AddJsiSync)
+  int AddJsiSync(int x, int y) noexcept {
+    return x + y;
+  }
+
+  REACT_METHOD_ON(Serial, AddOnSerial)
+  int AddOnSerial(int x, int y) noexcept {
+    return x + y;
+  }
+
+  REACT_METHOD_ON(Concurrent, StaticNegateOnConcurrent, L"negateOnConcurrent")
+  static int StaticNegateOnConcurrent(int x) noexcept {
+    return -x;
+  }
+
+  REACT_JSI_SYNC_METHOD(StaticConcatJsiSync)
+  static std::string StaticConcatJsiSync(std::string const &x, std::string const &y) noexcept {
+    return x + y;
+  }
+
   REACT_CONSTANT(Constant1)
   const std::string Constant1{"MyConstant1"};
 
@@ -1503,6 +1523,32 @@ TEST_CLASS (NativeModuleTest) {
     TestCheck(result == "Hello");
   }
 
+  TEST_METHOD(TestMethodSyncCall_AddJsiSync) {
+    // Module builders without JSI sync methods call them as sync methods
+    int result;
+    m_builderMock.CallSync(L"AddJsiSync", /*out*/ result, 3, 5);
+    TestCheck(result == 8);
+  }
+
+  TEST_METHOD(TestMethodSyncCall_StaticConcatJsiSync) {
+    std::string result;
+    m_builderMock.CallSync(L"StaticConcatJsiSync", /*out*/ result, std::string{"Hello "}, std::string{"World"});
+    TestCheck(result == "Hello World");
+  }
+
+  TEST_METHOD(TestMethodCall_AddOnSerial) {
+    // Module builders without method dispatchers call them on the calling thread
+    m_builderMock.Call1(
+        L"AddOnSerial", std::function<void(int)>([](int result) noexcept { TestCheck(result == 8); }), 3, 5);
+    TestCheck(m_builderMock.IsResolveCallbackCalled());
+  }
+
+  TEST_METHOD(TestMethodCall_StaticNegateOnConcurrent) {
+    m_builderMock.Call1(
+        L"negateOnConcurrent", std::function<void(int)>([](int result) noexcept { TestCheck(result == -3); }), 3);
+    TestCheck(m_builderMock.IsResolveCallbackCalled());
+  }
+
   TEST_METHOD(TestConstants) {
     auto constants = m_builderMock.GetConstants();
     TestCheck(constants["Constant1"] == "MyConstant1");
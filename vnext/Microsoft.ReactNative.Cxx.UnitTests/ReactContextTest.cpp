@@ -3,10 +3,32 @@
 
 #include "pch.h"
 #include <ReactContext.h>
+#include <ReactEventBatcher.h>
 #include "ReactModuleBuilderMock.h"
 
 using namespace winrt::Microsoft::ReactNative;
 
+// Runs the posted callbacks when the test calls RunAll.
+struct ReactDispatcherStub : implements<ReactDispatcherStub, IReactDispatcher> {
+  bool HasThreadAccess() noexcept {
+    return true;
+  }
+
+  void Post(ReactDispatcherCallback const &callback) noexcept {
+    Callbacks.push_back(callback);
+  }
+
+  void RunAll() noexcept {
+    auto callbacks = std::move(Callbacks);
+    Callbacks.clear();
+    for (auto const &callback : callbacks) {
+      callback();
+    }
+  }
+
+  std::vector<ReactDispatcherCallback> Callbacks;
+};
+
 struct ReactContextStub : implements<ReactContextStub, IReactContext> {
   IReactSettingsSnapshot SettingsSnapshot() noexcept {
     VerifyElseCrashSz(false, "Not implemented");
@@ -25,7 +47,8 @@ struct ReactContextStub : implements<ReactContextStub, IReactContext> {
   }
 
   IReactDispatcher JSDispatcher() noexcept {
-    VerifyElseCrashSz(false, "Not implemented");
+    VerifyElseCrashSz(Dispatcher != nullptr, "Not implemented");
+    return Dispatcher.as<IReactDispatcher>();
   }
 
   CallInvoker CallInvoker() noexcept {
@@ -58,6 +81,27 @@ struct ReactContextStub : implements<ReactContextStub, IReactContext> {
     paramsArgWriter(writer);
     writer.WriteArrayEnd();
     Args = TakeJSValue(writer);
+    Events.emplace_back(std::wstring{eventName}, Args.Copy());
+  }
+
+  void WriteDispatchQueueMetrics(IJSValueWriter const & /*writer*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  void WriteNativeModuleProfile(IJSValueWriter const & /*writer*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  Windows::Foundation::IAsyncAction StartSamplingProfiler() noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  Windows::Foundation::IAsyncAction StopSamplingProfiler(hstring const & /*filePath*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  Windows::Foundation::IAsyncAction CaptureHeapSnapshot(hstring const & /*filePath*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
   }
 
   uint16_t DebuggerPort() noexcept {
@@ -115,6 +159,8 @@ struct ReactContextStub : implements<ReactContextStub, IReactContext> {
   std::wstring Module;
   std::wstring Method;
   JSValue Args;
+  std::vector<std::pair<std::wstring, JSValue>> Events;
+  com_ptr<ReactDispatcherStub> Dispatcher;
 };
 
 namespace ReactNativeTests {
@@ -259,6 +305,50 @@ TEST_CLASS (ReactContextTest) {
     TestCheckEqual(10u, reactContextMock->Args[0]);
     TestCheckEqual(19, reactContextMock->Args[1]);
   }
+
+  TEST_METHOD(Test_ReactEventBatcher_AllValues) {
+    auto reactContextMock = winrt::make_self<ReactContextStub>();
+    reactContextMock->Dispatcher = winrt::make_self<ReactDispatcherStub>();
+    ReactContext context{reactContextMock.as<IReactContext>()};
+    auto batcher = std::make_shared<ReactEventBatcher>(context, L"module1");
+
+    batcher->Emit(L"event1", 1);
+    batcher->Emit(L"event2", "a");
+    batcher->Emit(L"event1", 2);
+    TestCheckEqual(1u, reactContextMock->Dispatcher->Callbacks.size());
+    TestCheck(reactContextMock->Events.empty());
+
+    reactContextMock->Dispatcher->RunAll();
+    TestCheckEqual(2u, reactContextMock->Events.size());
+    TestCheckEqual(L"event1", reactContextMock->Events[0].first);
+    TestCheck(reactContextMock->Events[0].second == JSValueArray{JSValueArray{1, 2}});
+    TestCheckEqual(L"event2", reactContextMock->Events[1].first);
+    TestCheck(reactContextMock->Events[1].second == JSValueArray{JSValueArray{"a"}});
+
+    // The next event schedules a new delivery
+    batcher->Emit(L"event1", 3);
+    TestCheckEqual(1u, reactContextMock->Dispatcher->Callbacks.size());
+  }
+
+  TEST_METHOD(Test_ReactEventBatcher_LatestValueWins) {
+    auto reactContextMock = winrt::make_self<ReactContextStub>();
+    reactContextMock->Dispatcher = winrt::make_self<ReactDispatcherStub>();
+    ReactContext context{reactContextMock.as<IReactContext>()};
+    auto batcher = std::make_shared<ReactEventBatcher>(context, L"module1", ReactEventBatchMode::LatestValueWins);
+
+    batcher->Emit(L"event1", 1);
+    batcher->Emit(L"event1", 2);
+    batcher->Emit(L"event1", 3);
+    reactContextMock->Dispatcher->RunAll();
+    TestCheckEqual(1u, reactContextMock->Events.size());
+    TestCheck(reactContextMock->Events[0].second == JSValueArray{JSValueArray{3}});
+
+    // The delivery does nothing after the batcher is destroyed
+    batcher->Emit(L"event1", 4);
+    batcher.reset();
+    reactContextMock->Dispatcher->RunAll();
+    TestCheckEqual(1u, reactContextMock->Events.size());
+  }
 };
 
 } // namespace ReactNativeTests
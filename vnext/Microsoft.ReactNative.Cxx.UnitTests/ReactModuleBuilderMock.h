@@ -38,6 +38,8 @@ struct ReactModuleBuilderMock {
 
   JSValueObject GetConstants() noexcept;
 
+  SyncMethodDelegate GetSyncMethod(std::wstring const &methodName) const noexcept;
+
   bool IsResolveCallbackCalled() const noexcept;
   void IsResolveCallbackCalled(bool value) noexcept;
   bool IsRejectCallbackCalled() const noexcept;
@@ -79,7 +81,6 @@ struct ReactModuleBuilderMock {
   MethodDelegate GetMethod0(std::wstring const &methodName) const noexcept;
   MethodDelegate GetMethod1(std::wstring const &methodName) const noexcept;
   MethodDelegate GetMethod2(std::wstring const &methodName) const noexcept;
-  SyncMethodDelegate GetSyncMethod(std::wstring const &methodName) const noexcept;
 
   static IJSValueWriter ArgWriter() noexcept;
   template <class... TArgs>
@@ -151,6 +152,26 @@ struct ReactContextMock : implements<ReactContextMock, IReactContext> {
       hstring const &eventName,
       JSValueArgWriter const &paramsArgWriter) noexcept;
 
+  void WriteDispatchQueueMetrics(IJSValueWriter const & /*writer*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  void WriteNativeModuleProfile(IJSValueWriter const & /*writer*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  Windows::Foundation::IAsyncAction StartSamplingProfiler() noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  Windows::Foundation::IAsyncAction StopSamplingProfiler(hstring const & /*filePath*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
+  Windows::Foundation::IAsyncAction CaptureHeapSnapshot(hstring const & /*filePath*/) noexcept {
+    VerifyElseCrashSz(false, "Not implemented");
+  }
+
   uint16_t DebuggerPort() noexcept {
     VerifyElseCrashSz(false, "Not implemented");
   }
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ReactModuleBuilderMock.h"
+
+#include <chrono>
+#include <cstdio>
+#include "JSValueTreeReader.h"
+#include "JSValueTreeWriter.h"
+
+namespace ReactNativeTests {
+
+REACT_MODULE(SyncMethodBenchmarkModule)
+struct SyncMethodBenchmarkModule {
+  REACT_SYNC_METHOD(Add)
+  int Add(int x, int y) noexcept {
+    return x + y;
+  }
+
+  REACT_SYNC_METHOD(Concat)
+  std::string Concat(std::string const &x, std::string const &y) noexcept {
+    return x + y;
+  }
+};
+
+// Compares the sync method calls with the reader and writer allocated per call, as the TurboModule did before,
+// and with the reader and writer on the stack, as the TurboModule does now. JSValueTreeReader and JSValueTreeWriter
+// stand in for JsiReader and JsiWriter, which need a JS runtime.
+TEST_CLASS (SyncMethodBenchmarkTest) {
+  static constexpr int IterationCount = 100'000;
+
+  React::ReactModuleBuilderMock m_builderMock{};
+  React::IReactModuleBuilder m_moduleBuilder;
+  Windows::Foundation::IInspectable m_moduleObject{nullptr};
+
+  SyncMethodBenchmarkTest() {
+    m_moduleBuilder = winrt::make<React::ReactModuleBuilderImpl>(m_builderMock);
+    auto provider = React::MakeModuleProvider<SyncMethodBenchmarkModule>();
+    m_moduleObject = m_builderMock.CreateModule(provider, m_moduleBuilder);
+  }
+
+  template <class TCall>
+  static double MeasureNsPerCall(TCall &&call) noexcept {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < IterationCount; ++i) {
+      call();
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(duration).count() / IterationCount;
+  }
+
+  static void CompareSyncCalls(
+      char const *name,
+      React::SyncMethodDelegate const &method,
+      React::JSValue const &args,
+      React::JSValue const &expected) noexcept {
+    double heapNs = MeasureNsPerCall([&]() noexcept {
+      auto argReader = winrt::make<React::JSValueTreeReader>(args);
+      auto argWriter = winrt::make<React::JSValueTreeWriter>();
+      method(argReader, argWriter);
+      TestCheck(argWriter.as<React::JSValueTreeWriter>()->TakeValue() == expected);
+    });
+
+    double stackNs = MeasureNsPerCall([&]() noexcept {
+      React::JSValueTreeReader argReader{args};
+      React::JSValueTreeWriter argWriter;
+      method(argReader, argWriter);
+      TestCheck(argWriter.TakeValue() == expected);
+    });
+
+    printf("%s: %.1f ns per call with heap reader and writer, %.1f ns with stack ones\n", name, heapNs, stackNs);
+  }
+
+  TEST_METHOD(BenchmarkSyncCall_Add) {
+    CompareSyncCalls("Add", m_builderMock.GetSyncMethod(L"Add"), React::JSValueArray{3, 5}, React::JSValue{8});
+  }
+
+  TEST_METHOD(BenchmarkSyncCall_Concat) {
+    CompareSyncCalls(
+        "Concat",
+        m_builderMock.GetSyncMethod(L"Concat"),
+        React::JSValueArray{"Hello ", "World"},
+        React::JSValue{"Hello World"});
+  }
+};
+
+} // namespace ReactNativeTests
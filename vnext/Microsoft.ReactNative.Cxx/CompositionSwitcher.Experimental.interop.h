@@ -10,6 +10,7 @@
 #include <d3d11.h>
 #include <d3d11_4.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
+#include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
 #include <winrt/Windows.Graphics.DirectX.Direct3D11.h>
 
 namespace Microsoft::ReactNative::Composition::Experimental {
@@ -27,6 +28,26 @@ struct __declspec(uuid("50E66581-E917-45F4-AC22-1BC953CFA2A8")) IVisualInterop :
   virtual void SetClippingPath(ID2D1Geometry *clippingPath) noexcept = 0;
 };
 
+// Optionally implemented by visuals that can clip to a rounded rectangle without building a path geometry.  Setting the
+// clip again only updates the existing one.
+struct __declspec(uuid("B4FCBF98-1E03-4345-BEDD-575E092DE442")) IVisualRoundedRectangleClipInterop : IUnknown {
+  // The clip starts at the top left of the visual.  Each radius is horizontal and vertical, and they must fit the size.
+  virtual void SetRoundedRectangleClip(
+      winrt::Windows::Foundation::Numerics::float2 const &size,
+      winrt::Windows::Foundation::Numerics::float2 const &topLeftRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &topRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomLeftRadius) noexcept = 0;
+};
+
+// Optionally implemented by visuals that can host children.  Inserting a run of visuals at once only walks the child
+// collection to the insertion point once, instead of once per visual.
+struct __declspec(uuid("5AA5F028-694F-4A37-A830-B04FDE3A6752")) IVisualChildrenInterop : IUnknown {
+  virtual void InsertRangeAt(
+      winrt::array_view<const winrt::Microsoft::ReactNative::Composition::Experimental::IVisual> visuals,
+      uint32_t index) noexcept = 0;
+};
+
 struct __declspec(uuid("4742F122-3EE0-48AA-9EA9-44A00147B55F")) ICompositionContextInterop : IUnknown {
   virtual void D2DFactory(ID2D1Factory1 **outD2DFactory) noexcept = 0;
 };
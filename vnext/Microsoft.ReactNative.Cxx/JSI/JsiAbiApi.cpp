@@ -8,6 +8,8 @@
 #include "ReactNonAbiValue.h"
 #include "winrt/Windows.Foundation.Collections.h"
 
+extern "C" IMAGE_DOS_HEADER __ImageBase;
+
 using namespace facebook::jsi;
 
 #pragma warning(push)
@@ -143,6 +145,14 @@ std::shared_ptr<facebook::jsi::HostObject> const &JsiHostObjectWrapper::HostObje
   return m_hostObject;
 }
 
+void *__stdcall JsiHostObjectWrapper::ModuleHandle() noexcept {
+  return &__ImageBase;
+}
+
+std::shared_ptr<facebook::jsi::HostObject> const &__stdcall JsiHostObjectWrapper::InProcHostObject() noexcept {
+  return m_hostObject;
+}
+
 //===========================================================================
 // JsiHostObjectGetOrCreateWrapper implementation
 //===========================================================================
@@ -189,6 +199,29 @@ std::shared_ptr<facebook::jsi::HostObject> const &JsiHostObjectGetOrCreateWrappe
   return m_hostObject;
 }
 
+void *__stdcall JsiHostObjectGetOrCreateWrapper::ModuleHandle() noexcept {
+  return &__ImageBase;
+}
+
+std::shared_ptr<facebook::jsi::HostObject> const &__stdcall
+JsiHostObjectGetOrCreateWrapper::InProcHostObject() noexcept {
+  return m_hostObject;
+}
+
+//===========================================================================
+// TryGetInProcHostObject implementation
+//===========================================================================
+
+std::shared_ptr<facebook::jsi::HostObject> TryGetInProcHostObject(IJsiHostObject const &hostObject) noexcept {
+  if (auto inProcHostObject = hostObject.try_as<IJsiHostObjectInProc>()) {
+    if (inProcHostObject->ModuleHandle() == &__ImageBase) {
+      return inProcHostObject->InProcHostObject();
+    }
+  }
+
+  return nullptr;
+}
+
 //===========================================================================
 // JsiHostFunctionWrapper implementation
 //===========================================================================
@@ -549,9 +582,7 @@ Object JsiAbiRuntime::createObject(std::shared_ptr<HostObject> ho) try {
 std::shared_ptr<HostObject> JsiAbiRuntime::getHostObject(const Object &obj) try {
   std::shared_ptr<HostObject> result;
   if (auto jsiHostObject = m_runtime.GetHostObject(AsJsiObjectRef(obj))) {
-    if (auto wrapper = get_self<JsiHostObjectWrapper>(jsiHostObject)) {
-      result = wrapper->HostObjectSharedPtr();
-    }
+    result = TryGetInProcHostObject(jsiHostObject);
   }
   return result;
 } catch (hresult_error const &) {
@@ -577,9 +608,8 @@ Value JsiAbiRuntime::getProperty(const Object &obj, const PropNameID &name) try
 }
 
 Value JsiAbiRuntime::getProperty(const Object &obj, const String &name) try {
-  // TODO: delete propertyId
-  auto propertyId = m_runtime.CreatePropertyIdFromString(AsJsiStringRef(name));
-  return MakeValue(m_runtime.GetProperty(AsJsiObjectRef(obj), propertyId));
+  PropNameID propertyId = MakePropNameID(m_runtime.CreatePropertyIdFromString(AsJsiStringRef(name)));
+  return MakeValue(m_runtime.GetProperty(AsJsiObjectRef(obj), AsJsiPropertyIdRef(propertyId)));
 } catch (hresult_error const &) {
   RethrowJsiError();
   throw;
@@ -593,9 +623,8 @@ bool JsiAbiRuntime::hasProperty(const Object &obj, const PropNameID &name) try {
 }
 
 bool JsiAbiRuntime::hasProperty(const Object &obj, const String &name) try {
-  // TODO: delete propertyId
-  auto propertyId = m_runtime.CreatePropertyIdFromString(AsJsiStringRef(name));
-  return m_runtime.HasProperty(AsJsiObjectRef(obj), propertyId);
+  PropNameID propertyId = MakePropNameID(m_runtime.CreatePropertyIdFromString(AsJsiStringRef(name)));
+  return m_runtime.HasProperty(AsJsiObjectRef(obj), AsJsiPropertyIdRef(propertyId));
 } catch (hresult_error const &) {
   RethrowJsiError();
   throw;
@@ -609,9 +638,8 @@ void JsiAbiRuntime::setPropertyValue(const Object &obj, const PropNameID &name,
 }
 
 void JsiAbiRuntime::setPropertyValue(const Object &obj, const String &name, const Value &value) try {
-  // TODO: delete propertyId
-  auto propertyId = m_runtime.CreatePropertyIdFromString(AsJsiStringRef(name));
-  m_runtime.SetProperty(AsJsiObjectRef(obj), propertyId, AsJsiValueRef(value));
+  PropNameID propertyId = MakePropNameID(m_runtime.CreatePropertyIdFromString(AsJsiStringRef(name)));
+  m_runtime.SetProperty(AsJsiObjectRef(obj), AsJsiPropertyIdRef(propertyId), AsJsiValueRef(value));
 } catch (hresult_error const &) {
   RethrowJsiError();
   throw;
@@ -5,6 +5,7 @@
 #ifndef MICROSOFT_REACTNATIVE_JSIABIAPI
 #define MICROSOFT_REACTNATIVE_JSIABIAPI
 
+#include <unknwn.h>
 #include <map>
 #include <mutex>
 #include "Crash.h"
@@ -40,8 +41,20 @@ struct JsiPreparedJavaScriptWrapper : facebook::jsi::PreparedJavaScript {
   JsiPreparedJavaScript m_preparedScript;
 };
 
+// Gives direct access to the facebook::jsi::HostObject wrapped by an IJsiHostObject.
+// It is not an ABI-safe interface: the host object may only be used by the code in the same binary as the wrapper,
+// which TryGetInProcHostObject checks by comparing the module handles.
+struct __declspec(uuid("b3d76bda-a3a0-4352-a789-0822d4ed22de")) __declspec(novtable) IJsiHostObjectInProc : ::IUnknown {
+  virtual void *__stdcall ModuleHandle() noexcept = 0;
+  virtual std::shared_ptr<facebook::jsi::HostObject> const &__stdcall InProcHostObject() noexcept = 0;
+};
+
+// Returns the host object wrapped by the hostObject if it was created in the current binary, or nullptr otherwise.
+// It lets the calls between the JSI runtime and the host object skip the ABI layer.
+std::shared_ptr<facebook::jsi::HostObject> TryGetInProcHostObject(IJsiHostObject const &hostObject) noexcept;
+
 // An ABI-safe wrapper for facebook::jsi::HostObject.
-struct JsiHostObjectWrapper : implements<JsiHostObjectWrapper, IJsiHostObject> {
+struct JsiHostObjectWrapper : implements<JsiHostObjectWrapper, IJsiHostObject, IJsiHostObjectInProc> {
   JsiHostObjectWrapper(std::shared_ptr<facebook::jsi::HostObject> &&hostObject) noexcept;
 
   JsiValueRef GetProperty(JsiRuntime const &runtime, JsiPropertyIdRef const &name);
@@ -50,6 +63,10 @@ struct JsiHostObjectWrapper : implements<JsiHostObjectWrapper, IJsiHostObject> {
 
   std::shared_ptr<facebook::jsi::HostObject> const &HostObjectSharedPtr() noexcept;
 
+  // IJsiHostObjectInProc
+  void *__stdcall ModuleHandle() noexcept override;
+  std::shared_ptr<facebook::jsi::HostObject> const &__stdcall InProcHostObject() noexcept override;
+
  private:
   std::shared_ptr<facebook::jsi::HostObject> m_hostObject;
 };
@@ -57,7 +74,8 @@ struct JsiHostObjectWrapper : implements<JsiHostObjectWrapper, IJsiHostObject> {
 // An ABI-safe wrapper for facebook::jsi::HostObject, similar to JsiHostObjectWrapper,
 // but uses GetOrCreate for the AbiRuntime to ensure its created on first use
 // This is important for use with TurboModules, which may not go through the ReactContext.CallInvoker
-struct JsiHostObjectGetOrCreateWrapper : implements<JsiHostObjectGetOrCreateWrapper, IJsiHostObject> {
+struct JsiHostObjectGetOrCreateWrapper
+    : implements<JsiHostObjectGetOrCreateWrapper, IJsiHostObject, IJsiHostObjectInProc> {
   JsiHostObjectGetOrCreateWrapper(
       const winrt::Microsoft::ReactNative::IReactContext &context,
       std::shared_ptr<facebook::jsi::HostObject> &&hostObject) noexcept;
@@ -68,6 +86,10 @@ struct JsiHostObjectGetOrCreateWrapper : implements<JsiHostObjectGetOrCreateWrap
 
   std::shared_ptr<facebook::jsi::HostObject> const &HostObjectSharedPtr() noexcept;
 
+  // IJsiHostObjectInProc
+  void *__stdcall ModuleHandle() noexcept override;
+  std::shared_ptr<facebook::jsi::HostObject> const &__stdcall InProcHostObject() noexcept override;
+
  private:
   std::shared_ptr<facebook::jsi::HostObject> m_hostObject;
   winrt::Microsoft::ReactNative::IReactContext m_context;
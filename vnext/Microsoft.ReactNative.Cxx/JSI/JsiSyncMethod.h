@@ -0,0 +1,166 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSI_JSISYNCMETHOD_
+#define MICROSOFT_REACTNATIVE_JSI_JSISYNCMETHOD_
+
+#ifndef __APPLE__
+#include <unknwn.h>
+#endif
+#include <jsi/jsi.h>
+#include <winrt/Microsoft.ReactNative.h>
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+
+// A synchronous method that takes its arguments and returns its result as JSI values.
+using JsiSyncMethodDelegate =
+    std::function<facebook::jsi::Value(facebook::jsi::Runtime &, facebook::jsi::Value const *, size_t)>;
+
+#ifndef __APPLE__
+// Implemented by the module builder of the TurboModules that run in the process of the JS engine.
+// It is not an ABI interface: it is only used by REACT_JSI_SYNC_METHOD in modules that are built with the same JSI and
+// C++ runtime as Microsoft.ReactNative. Other module builders do not implement it.
+struct __declspec(uuid("6df28507-1a4c-43aa-b423-660a8bb3506b")) __declspec(novtable) IJsiSyncMethodBuilder
+    : ::IUnknown {
+  virtual void __stdcall AddJsiSyncMethod(std::wstring_view name, JsiSyncMethodDelegate const &method) noexcept = 0;
+};
+#endif
+
+// Converts a C++ type of a REACT_JSI_SYNC_METHOD parameter or result to and from JSI values.
+// A value of another JS type than expected reads as the default value, as a missing argument does.
+template <class T, class = void>
+struct JsiSyncMethodValue {
+  static constexpr bool IsSupported = false;
+};
+
+template <>
+struct JsiSyncMethodValue<bool> {
+  static constexpr bool IsSupported = true;
+
+  static bool FromJsi(facebook::jsi::Runtime & /*rt*/, facebook::jsi::Value const &value) {
+    return value.isBool() ? value.getBool() : false;
+  }
+
+  static facebook::jsi::Value ToJsi(facebook::jsi::Runtime & /*rt*/, bool value) {
+    return facebook::jsi::Value(value);
+  }
+};
+
+template <class T>
+struct JsiSyncMethodValue<T, std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, bool>>> {
+  static constexpr bool IsSupported = true;
+
+  static T FromJsi(facebook::jsi::Runtime & /*rt*/, facebook::jsi::Value const &value) {
+    return value.isNumber() ? static_cast<T>(value.getNumber()) : T{};
+  }
+
+  static facebook::jsi::Value ToJsi(facebook::jsi::Runtime & /*rt*/, T value) {
+    return facebook::jsi::Value(static_cast<double>(value));
+  }
+};
+
+template <>
+struct JsiSyncMethodValue<std::string> {
+  static constexpr bool IsSupported = true;
+
+  static std::string FromJsi(facebook::jsi::Runtime &rt, facebook::jsi::Value const &value) {
+    return value.isString() ? value.getString(rt).utf8(rt) : std::string{};
+  }
+
+  static facebook::jsi::Value ToJsi(facebook::jsi::Runtime &rt, std::string const &value) {
+    return facebook::jsi::String::createFromUtf8(rt, value);
+  }
+};
+
+template <>
+struct JsiSyncMethodValue<std::wstring> {
+  static constexpr bool IsSupported = true;
+
+  static std::wstring FromJsi(facebook::jsi::Runtime &rt, facebook::jsi::Value const &value) {
+    return value.isString() ? std::wstring{winrt::to_hstring(value.getString(rt).utf8(rt))} : std::wstring{};
+  }
+
+  static facebook::jsi::Value ToJsi(facebook::jsi::Runtime &rt, std::wstring const &value) {
+    return facebook::jsi::String::createFromUtf8(rt, winrt::to_string(value));
+  }
+};
+
+template <>
+struct JsiSyncMethodValue<winrt::hstring> {
+  static constexpr bool IsSupported = true;
+
+  static winrt::hstring FromJsi(facebook::jsi::Runtime &rt, facebook::jsi::Value const &value) {
+    return value.isString() ? winrt::to_hstring(value.getString(rt).utf8(rt)) : winrt::hstring{};
+  }
+
+  static facebook::jsi::Value ToJsi(facebook::jsi::Runtime &rt, winrt::hstring const &value) {
+    return facebook::jsi::String::createFromUtf8(rt, winrt::to_string(value));
+  }
+};
+
+// null and undefined are std::nullopt
+template <class T>
+struct JsiSyncMethodValue<std::optional<T>, std::enable_if_t<JsiSyncMethodValue<T>::IsSupported>> {
+  static constexpr bool IsSupported = true;
+
+  static std::optional<T> FromJsi(facebook::jsi::Runtime &rt, facebook::jsi::Value const &value) {
+    if (value.isNull() || value.isUndefined()) {
+      return std::nullopt;
+    }
+    return JsiSyncMethodValue<T>::FromJsi(rt, value);
+  }
+
+  static facebook::jsi::Value ToJsi(facebook::jsi::Runtime &rt, std::optional<T> const &value) {
+    return value ? JsiSyncMethodValue<T>::ToJsi(rt, *value) : facebook::jsi::Value::null();
+  }
+};
+
+template <class T>
+struct JsiSyncMethodValue<std::vector<T>, std::enable_if_t<JsiSyncMethodValue<T>::IsSupported>> {
+  static constexpr bool IsSupported = true;
+
+  static std::vector<T> FromJsi(facebook::jsi::Runtime &rt, facebook::jsi::Value const &value) {
+    std::vector<T> result;
+    if (value.isObject()) {
+      auto object = value.getObject(rt);
+      if (object.isArray(rt)) {
+        auto array = object.getArray(rt);
+        size_t size = array.size(rt);
+        result.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+          result.push_back(JsiSyncMethodValue<T>::FromJsi(rt, array.getValueAtIndex(rt, i)));
+        }
+      }
+    }
+    return result;
+  }
+
+  static facebook::jsi::Value ToJsi(facebook::jsi::Runtime &rt, std::vector<T> const &value) {
+    facebook::jsi::Array array(rt, value.size());
+    for (size_t i = 0; i < value.size(); ++i) {
+      array.setValueAtIndex(rt, i, JsiSyncMethodValue<T>::ToJsi(rt, value[i]));
+    }
+    return array;
+  }
+};
+
+template <class T>
+constexpr bool IsJsiSyncMethodValue = JsiSyncMethodValue<std::remove_cv_t<std::remove_reference_t<T>>>::IsSupported;
+
+template <class T>
+T ReadJsiSyncMethodArg(facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count, size_t index) {
+  return index < count ? JsiSyncMethodValue<T>::FromJsi(rt, args[index]) : T{};
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSI_JSISYNCMETHOD_
@@ -6,11 +6,74 @@
 
 #include <jsi/jsi.h>
 #include <react/bridging/LongLivedObject.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace winrt::Microsoft::ReactNative {
 
+struct LongLivedJsiRuntime;
+
+// Keeps the LongLivedJsiRuntime objects of a runtime alive until they allow their release.
+// The objects are kept in slots that are reused through a free list, so that adding and removing an object takes
+// constant time no matter how many callbacks and promises are outstanding. Each handle has the generation of its slot
+// to never remove an object that reuses the slot of an already removed one.
+// The table is the only entry that it adds to the LongLivedObjectCollection. It releases all of its objects when the
+// collection is cleared before the runtime is destroyed.
+struct LongLivedJsiObjectTable : facebook::react::LongLivedObject {
+  struct Handle {
+    uint32_t Index{0};
+    uint32_t Generation{0};
+  };
+
+  static std::shared_ptr<LongLivedJsiObjectTable> Create(
+      std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
+      facebook::jsi::Runtime &runtime) noexcept {
+    auto table = std::shared_ptr<LongLivedJsiObjectTable>(new LongLivedJsiObjectTable(runtime));
+    longLivedObjectCollection->add(table);
+    return table;
+  }
+
+  facebook::jsi::Runtime &Runtime() noexcept {
+    return runtime_;
+  }
+
+  Handle Add(std::shared_ptr<LongLivedJsiRuntime> &&object) noexcept;
+
+  // Can be called from any thread. Removing an object more than once has no effect.
+  void Remove(Handle handle) noexcept;
+
+  // The number of objects that did not allow their release yet
+  size_t Size() const noexcept {
+    std::scoped_lock lock{mutex_};
+    return size_;
+  }
+
+ private:
+  static constexpr uint32_t NoFreeSlot = UINT32_MAX;
+
+  struct Slot {
+    std::shared_ptr<LongLivedJsiRuntime> Object;
+    uint32_t Generation{0};
+    uint32_t NextFree{NoFreeSlot};
+  };
+
+  explicit LongLivedJsiObjectTable(facebook::jsi::Runtime &runtime) : LongLivedObject(runtime), runtime_(runtime) {}
+
+  LongLivedJsiObjectTable(LongLivedJsiObjectTable const &) = delete;
+
+ private:
+  facebook::jsi::Runtime &runtime_;
+  mutable std::mutex mutex_;
+  std::vector<Slot> slots_;
+  uint32_t firstFreeSlot_{NoFreeSlot};
+  size_t size_{0};
+};
+
 // Wrap up JSI Runtime into a LongLivedObject
 struct LongLivedJsiRuntime : facebook::react::LongLivedObject {
+  // Prefer the LongLivedJsiObjectTable overload, which removes the object in constant time
   static std::weak_ptr<LongLivedJsiRuntime> CreateWeak(
       std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
       facebook::jsi::Runtime &runtime) noexcept {
@@ -19,38 +82,101 @@ struct LongLivedJsiRuntime : facebook::react::LongLivedObject {
     return value;
   }
 
+  static std::weak_ptr<LongLivedJsiRuntime> CreateWeak(
+      std::shared_ptr<LongLivedJsiObjectTable> const &longLivedJsiObjects,
+      facebook::jsi::Runtime &runtime) noexcept {
+    auto value = std::shared_ptr<LongLivedJsiRuntime>(new LongLivedJsiRuntime(runtime));
+    AddToTable(longLivedJsiObjects, value);
+    return value;
+  }
+
   facebook::jsi::Runtime &Runtime() {
     return runtime_;
   }
 
  public: // LongLivedObject overrides
   void allowRelease() {
+    if (auto longLivedJsiObjects = longLivedJsiObjects_.lock()) {
+      longLivedJsiObjects->Remove(handle_);
+      return;
+    }
     if (auto longLivedObjectCollection = longLivedObjectCollection_.lock()) {
-      if (longLivedObjectCollection != nullptr) {
-        longLivedObjectCollection->remove(this);
-        return;
-      }
+      longLivedObjectCollection->remove(this);
+      return;
     }
     LongLivedObject::allowRelease();
   }
 
  protected:
+  LongLivedJsiRuntime(facebook::jsi::Runtime &runtime) : LongLivedObject(runtime), runtime_(runtime) {}
+
   LongLivedJsiRuntime(
       std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
       facebook::jsi::Runtime &runtime)
-      : LongLivedObject(runtime), runtime_(runtime), longLivedObjectCollection_(longLivedObjectCollection) {}
+      : LongLivedObject(runtime), longLivedObjectCollection_(longLivedObjectCollection), runtime_(runtime) {}
 
   LongLivedJsiRuntime(LongLivedJsiRuntime const &) = delete;
 
+  static void AddToTable(
+      std::shared_ptr<LongLivedJsiObjectTable> const &longLivedJsiObjects,
+      std::shared_ptr<LongLivedJsiRuntime> const &value) noexcept {
+    value->longLivedJsiObjects_ = longLivedJsiObjects;
+    value->handle_ = longLivedJsiObjects->Add(std::shared_ptr<LongLivedJsiRuntime>(value));
+  }
+
  private:
-  // Use a weak reference to the collection to avoid reference loops
+  // Use weak references to the table or the collection to avoid reference loops
+  std::weak_ptr<LongLivedJsiObjectTable> longLivedJsiObjects_;
+  LongLivedJsiObjectTable::Handle handle_;
   std::weak_ptr<facebook::react::LongLivedObjectCollection> longLivedObjectCollection_;
   facebook::jsi::Runtime &runtime_;
 };
 
+inline LongLivedJsiObjectTable::Handle LongLivedJsiObjectTable::Add(
+    std::shared_ptr<LongLivedJsiRuntime> &&object) noexcept {
+  std::scoped_lock lock{mutex_};
+  uint32_t index = firstFreeSlot_;
+  if (index == NoFreeSlot) {
+    index = static_cast<uint32_t>(slots_.size());
+    slots_.emplace_back();
+  } else {
+    firstFreeSlot_ = slots_[index].NextFree;
+  }
+
+  Slot &slot = slots_[index];
+  slot.Object = std::move(object);
+  slot.NextFree = NoFreeSlot;
+  ++size_;
+  return {index, slot.Generation};
+}
+
+inline void LongLivedJsiObjectTable::Remove(Handle handle) noexcept {
+  std::shared_ptr<LongLivedJsiRuntime> object;
+  {
+    std::scoped_lock lock{mutex_};
+    if (handle.Index >= slots_.size()) {
+      return;
+    }
+
+    Slot &slot = slots_[handle.Index];
+    if (slot.Generation != handle.Generation || !slot.Object) {
+      return;
+    }
+
+    object = std::move(slot.Object);
+    ++slot.Generation;
+    slot.NextFree = firstFreeSlot_;
+    firstFreeSlot_ = handle.Index;
+    --size_;
+  }
+
+  // The object is released outside of the lock, since its JSI value may take time to release
+}
+
 // Wrap up a JSI Value into a LongLivedObject.
 template <typename TValue>
 struct LongLivedJsiValue : LongLivedJsiRuntime {
+  // Prefer the LongLivedJsiObjectTable overload, which removes the value in constant time
   static std::weak_ptr<LongLivedJsiValue<TValue>> CreateWeak(
       std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
       facebook::jsi::Runtime &runtime,
@@ -61,11 +187,25 @@ struct LongLivedJsiValue : LongLivedJsiRuntime {
     return valueWrapper;
   }
 
+  static std::weak_ptr<LongLivedJsiValue<TValue>> CreateWeak(
+      std::shared_ptr<LongLivedJsiObjectTable> const &longLivedJsiObjects,
+      facebook::jsi::Runtime &runtime,
+      TValue &&value) noexcept {
+    auto valueWrapper =
+        std::shared_ptr<LongLivedJsiValue<TValue>>(new LongLivedJsiValue<TValue>(runtime, std::forward<TValue>(value)));
+    AddToTable(longLivedJsiObjects, valueWrapper);
+    return valueWrapper;
+  }
+
   TValue &Value() {
     return value_;
   }
 
  protected:
+  template <typename TValue2>
+  LongLivedJsiValue(facebook::jsi::Runtime &runtime, TValue2 &&value)
+      : LongLivedJsiRuntime(runtime), value_(std::forward<TValue2>(value)) {}
+
   template <typename TValue2>
   LongLivedJsiValue(
       std::shared_ptr<facebook::react::LongLivedObjectCollection> const &longLivedObjectCollection,
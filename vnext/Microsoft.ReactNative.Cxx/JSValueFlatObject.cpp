@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#include "pch.h"
+#include "JSValueFlatObject.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+//===========================================================================
+// JSValueFlatObject implementation
+//===========================================================================
+
+JSValueFlatObject::JSValueFlatObject(std::initializer_list<JSValueObjectKeyValue> initObject) noexcept {
+  m_properties.reserve(initObject.size());
+  for (auto const &item : initObject) {
+    m_properties.emplace_back(std::string(item.Key), std::move(*const_cast<JSValue *>(&item.Value)));
+  }
+
+  SortProperties();
+}
+
+JSValueFlatObject::JSValueFlatObject(JSValueObject &&other) noexcept {
+  // JSValueObject is already sorted by the property names
+  m_properties.reserve(other.size());
+  while (!other.empty()) {
+    auto node = other.extract(other.begin());
+    m_properties.emplace_back(std::move(node.key()), std::move(node.mapped()));
+  }
+}
+
+JSValueFlatObject JSValueFlatObject::Copy() const noexcept {
+  JSValueFlatObject object;
+  object.m_properties.reserve(m_properties.size());
+  for (auto const &property : m_properties) {
+    object.m_properties.emplace_back(property.first, property.second.Copy());
+  }
+
+  return object;
+}
+
+JSValueObject JSValueFlatObject::MoveToObject() noexcept {
+  JSValueObject object;
+  for (auto &property : m_properties) {
+    // The properties are sorted: add each one at the end of the map without a search
+    object.emplace_hint(object.end(), std::move(property.first), std::move(property.second));
+  }
+
+  m_properties.clear();
+  return object;
+}
+
+JSValueFlatObject::iterator JSValueFlatObject::find(std::string_view propertyName) noexcept {
+  auto it = std::lower_bound(
+      m_properties.begin(), m_properties.end(), propertyName, [](value_type const &property, std::string_view name) {
+        return property.first < name;
+      });
+  return (it != m_properties.end() && it->first == propertyName) ? it : m_properties.end();
+}
+
+JSValueFlatObject::size_type JSValueFlatObject::erase(std::string_view propertyName) noexcept {
+  auto it = find(propertyName);
+  if (it == m_properties.end()) {
+    return 0;
+  }
+
+  m_properties.erase(it);
+  return 1;
+}
+
+JSValueFlatObject::iterator JSValueFlatObject::erase(const_iterator position) noexcept {
+  return m_properties.erase(position);
+}
+
+JSValue &JSValueFlatObject::operator[](std::string_view propertyName) noexcept {
+  return try_emplace(propertyName, nullptr).first->second;
+}
+
+JSValue const &JSValueFlatObject::operator[](std::string_view propertyName) const noexcept {
+  auto it = find(propertyName);
+  if (it != end()) {
+    return it->second;
+  }
+
+  return JSValue::NullRef();
+}
+
+bool JSValueFlatObject::Equals(JSValueFlatObject const &other) const noexcept {
+  if (size() != other.size()) {
+    return false;
+  }
+
+  // Both objects are sorted. Make sure that pairs are matching at the same position.
+  auto otherIt = other.begin();
+  for (auto const &property : m_properties) {
+    auto it = otherIt++;
+    if (property.first != it->first || !property.second.Equals(it->second)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool JSValueFlatObject::JSEquals(JSValueFlatObject const &other) const noexcept {
+  if (size() != other.size()) {
+    return false;
+  }
+
+  // Both objects are sorted. Make sure that pairs are matching at the same position.
+  auto otherIt = other.begin();
+  for (auto const &property : m_properties) {
+    auto it = otherIt++;
+    if (property.first != it->first || !property.second.JSEquals(it->second)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*static*/ JSValueFlatObject JSValueFlatObject::ReadFrom(IJSValueReader const &reader) noexcept {
+  JSValueFlatObject object;
+  if (reader.ValueType() == JSValueType::Object) {
+    hstring propertyName;
+    while (reader.GetNextObjectProperty(/*ref*/ propertyName)) {
+      object.m_properties.emplace_back(to_string(propertyName), JSValue::ReadFrom(reader));
+    }
+
+    object.SortProperties();
+  }
+
+  return object;
+}
+
+void JSValueFlatObject::WriteTo(IJSValueWriter const &writer) const noexcept {
+  writer.WriteObjectBegin();
+  for (auto const &property : m_properties) {
+    writer.WritePropertyName(to_hstring(property.first));
+    property.second.WriteTo(writer);
+  }
+
+  writer.WriteObjectEnd();
+}
+
+void JSValueFlatObject::SortProperties() noexcept {
+  // The stable sort keeps the first of the properties with the same name first, and std::unique keeps it
+  auto isLess = [](value_type const &left, value_type const &right) { return left.first < right.first; };
+  auto isEqual = [](value_type const &left, value_type const &right) { return left.first == right.first; };
+  if (!std::is_sorted(m_properties.begin(), m_properties.end(), isLess)) {
+    std::stable_sort(m_properties.begin(), m_properties.end(), isLess);
+  }
+
+  m_properties.erase(std::unique(m_properties.begin(), m_properties.end(), isEqual), m_properties.end());
+}
+
+} // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,222 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSVALUEFLATOBJECT
+#define MICROSOFT_REACTNATIVE_JSVALUEFLATOBJECT
+
+#include "JSValue.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+
+//==============================================================================
+// JSValueFlatObject declaration.
+//==============================================================================
+
+//! JSValueFlatObject has the same properties as JSValueObject in a vector that is sorted by property name.
+//! It is faster to create, read, and write than JSValueObject for objects with a few properties, which are most of
+//! the objects that are passed to native modules: all properties are in one allocation, and the names that fit in
+//! the inline buffer of std::string are not allocated at all. Adding and erasing properties is O(n), and it
+//! invalidates iterators and references to the properties, unlike in JSValueObject.
+//! It can be used as a parameter or result type of native module methods instead of JSValueObject.
+struct JSValueFlatObject {
+  using value_type = std::pair<std::string, JSValue>;
+  using container_type = std::vector<value_type>;
+  using size_type = container_type::size_type;
+  using iterator = container_type::iterator;
+  using const_iterator = container_type::const_iterator;
+
+  //! Default constructor.
+  JSValueFlatObject() = default;
+
+  //! Move-construct JSValueFlatObject from the initializer list.
+  JSValueFlatObject(std::initializer_list<JSValueObjectKeyValue> initObject) noexcept;
+
+  //! Move-construct JSValueFlatObject from the properties of JSValueObject.
+  explicit JSValueFlatObject(JSValueObject &&other) noexcept;
+
+  //! Delete copy constructor to avoid unexpected copies. Use the Copy method instead.
+  JSValueFlatObject(JSValueFlatObject const &) = delete;
+
+  // Default move constructor.
+  JSValueFlatObject(JSValueFlatObject &&) = default;
+
+  //! Delete copy assignment to avoid unexpected copies. Use the Copy method instead.
+  JSValueFlatObject &operator=(JSValueFlatObject const &) = delete;
+
+  // Default move assignment.
+  JSValueFlatObject &operator=(JSValueFlatObject &&) = default;
+
+  //! Do a deep copy of JSValueFlatObject.
+  JSValueFlatObject Copy() const noexcept;
+
+  //! Move the properties to a new JSValueObject.
+  JSValueObject MoveToObject() noexcept;
+
+  iterator begin() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator cbegin() const noexcept;
+  iterator end() noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cend() const noexcept;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  void reserve(size_type count) noexcept;
+  void clear() noexcept;
+
+  //! Find the property by its name, or return end() if it is not found.
+  iterator find(std::string_view propertyName) noexcept;
+  const_iterator find(std::string_view propertyName) const noexcept;
+
+  //! Return 1 if the property is found, and 0 otherwise.
+  size_type count(std::string_view propertyName) const noexcept;
+
+  //! Add the property if it is not found, as std::map::try_emplace does.
+  //! Return the property and true if it is added.
+  template <class... TArgs>
+  std::pair<iterator, bool> try_emplace(std::string_view propertyName, TArgs &&...args) noexcept;
+
+  //! Erase the property if it is found. Return the number of erased properties.
+  size_type erase(std::string_view propertyName) noexcept;
+
+  //! Erase the property and return the iterator to the next one.
+  iterator erase(const_iterator position) noexcept;
+
+  //! Get a reference to object property value if the property is found,
+  //! or a reference to a new property created with JSValue::Null value otherwise.
+  JSValue &operator[](std::string_view propertyName) noexcept;
+
+  //! Get a reference to object property value if the property is found,
+  //! or a reference to JSValue::Null otherwise.
+  JSValue const &operator[](std::string_view propertyName) const noexcept;
+
+  //! Return true if this JSValueFlatObject is strictly equal to other JSValueFlatObject.
+  //! Both objects must have the same set of equal properties.
+  //! Property values must be equal.
+  bool Equals(JSValueFlatObject const &other) const noexcept;
+
+  //! Return true if this JSValueFlatObject is strictly equal to other JSValueFlatObject
+  //! after their property values are converted to the same type.
+  //! See JSValue::JSEquals for details about the conversion.
+  bool JSEquals(JSValueFlatObject const &other) const noexcept;
+
+  //! Create JSValueFlatObject from IJSValueReader.
+  //! The properties are sorted once after they are read, and the first one wins for duplicate names.
+  static JSValueFlatObject ReadFrom(IJSValueReader const &reader) noexcept;
+
+  //! Write this JSValueFlatObject to IJSValueWriter.
+  void WriteTo(IJSValueWriter const &writer) const noexcept;
+
+ private:
+  // Sort the properties and remove the duplicate names after they are added in any order
+  void SortProperties() noexcept;
+
+ private:
+  container_type m_properties;
+};
+
+//! True if left.Equals(right)
+bool operator==(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept;
+
+//! True if !left.Equals(right)
+bool operator!=(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept;
+
+void ReadValue(IJSValueReader const &reader, /*out*/ JSValueFlatObject &value) noexcept;
+void WriteValue(IJSValueWriter const &writer, JSValueFlatObject const &value) noexcept;
+
+//===========================================================================
+// JSValueFlatObject inline implementation
+//===========================================================================
+
+inline JSValueFlatObject::iterator JSValueFlatObject::begin() noexcept {
+  return m_properties.begin();
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::begin() const noexcept {
+  return m_properties.begin();
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::cbegin() const noexcept {
+  return m_properties.cbegin();
+}
+
+inline JSValueFlatObject::iterator JSValueFlatObject::end() noexcept {
+  return m_properties.end();
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::end() const noexcept {
+  return m_properties.end();
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::cend() const noexcept {
+  return m_properties.cend();
+}
+
+inline bool JSValueFlatObject::empty() const noexcept {
+  return m_properties.empty();
+}
+
+inline JSValueFlatObject::size_type JSValueFlatObject::size() const noexcept {
+  return m_properties.size();
+}
+
+inline void JSValueFlatObject::reserve(size_type count) noexcept {
+  m_properties.reserve(count);
+}
+
+inline void JSValueFlatObject::clear() noexcept {
+  m_properties.clear();
+}
+
+inline JSValueFlatObject::const_iterator JSValueFlatObject::find(std::string_view propertyName) const noexcept {
+  return const_cast<JSValueFlatObject *>(this)->find(propertyName);
+}
+
+inline JSValueFlatObject::size_type JSValueFlatObject::count(std::string_view propertyName) const noexcept {
+  return find(propertyName) != end() ? 1 : 0;
+}
+
+template <class... TArgs>
+inline std::pair<JSValueFlatObject::iterator, bool> JSValueFlatObject::try_emplace(
+    std::string_view propertyName,
+    TArgs &&...args) noexcept {
+  auto it = std::lower_bound(
+      m_properties.begin(), m_properties.end(), propertyName, [](value_type const &property, std::string_view name) {
+        return property.first < name;
+      });
+  if (it != m_properties.end() && it->first == propertyName) {
+    return {it, false};
+  }
+
+  return {m_properties.emplace(it, std::string{propertyName}, JSValue{std::forward<TArgs>(args)...}), true};
+}
+
+inline bool operator==(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept {
+  return left.Equals(right);
+}
+
+inline bool operator!=(JSValueFlatObject const &left, JSValueFlatObject const &right) noexcept {
+  return !left.Equals(right);
+}
+
+inline void ReadValue(IJSValueReader const &reader, /*out*/ JSValueFlatObject &value) noexcept {
+  value = JSValueFlatObject::ReadFrom(reader);
+}
+
+inline void WriteValue(IJSValueWriter const &writer, JSValueFlatObject const &value) noexcept {
+  value.WriteTo(writer);
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSVALUEFLATOBJECT
@@ -13,6 +13,7 @@
 #include "StructInfo.h"
 
 #include "winrt/Microsoft.ReactNative.h"
+#include "winrt/Windows.Storage.Streams.h"
 
 #include <string>
 
@@ -84,6 +85,7 @@ void ReadValue(IJSValueReader const &reader, /*out*/ std::tuple<Ts...> &value) n
 void ReadValue(IJSValueReader const &reader, /*out*/ JSValue &value) noexcept;
 void ReadValue(IJSValueReader const &reader, /*out*/ JSValueObject &value) noexcept;
 void ReadValue(IJSValueReader const &reader, /*out*/ JSValueArray &value) noexcept;
+void ReadValue(IJSValueReader const &reader, /*out*/ Windows::Storage::Streams::IBuffer &value) noexcept;
 
 template <class T, std::enable_if_t<!std::is_void_v<decltype(GetStructInfo(static_cast<T *>(nullptr)))>, int> = 1>
 void ReadValue(IJSValueReader const &reader, /*out*/ T &value) noexcept;
@@ -381,6 +383,27 @@ inline void ReadValue(
 template <class T, class TAlloc>
 inline void ReadValue(IJSValueReader const &reader, /*out*/ std::vector<T, TAlloc> &value) noexcept {
   if (reader.ValueType() == JSValueType::Array) {
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+      // Read arrays of numbers with one call when the reader supports it
+      if (auto reader2 = reader.try_as<IJSValueReader2>()) {
+        using Number = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+        com_array<Number> items;
+        bool isRead{false};
+        if constexpr (std::is_integral_v<T>) {
+          isRead = reader2.TryGetInt64Array(items);
+        } else {
+          isRead = reader2.TryGetDoubleArray(items);
+        }
+        if (isRead) {
+          value.reserve(value.size() + items.size());
+          for (Number item : items) {
+            value.push_back(static_cast<T>(item));
+          }
+          return;
+        }
+      }
+    }
+
     while (reader.GetNextArrayItem()) {
       value.push_back(ReadValue<T>(reader));
     }
@@ -409,6 +432,28 @@ inline void ReadValue(IJSValueReader const &reader, /*out*/ JSValueArray &value)
   value = JSValueArray::ReadFrom(reader);
 }
 
+// Reads a copy of the bytes of an ArrayBuffer or a typed array, or of an array of bytes.
+inline void ReadValue(IJSValueReader const &reader, /*out*/ Windows::Storage::Streams::IBuffer &value) noexcept {
+  if (auto reader2 = reader.try_as<IJSValueReader2>()) {
+    value = reader2.TryGetArrayBuffer(/*isBorrowed:*/ false);
+    if (value) {
+      return;
+    }
+  }
+
+  if (reader.ValueType() == JSValueType::Array) {
+    // The writers without binary values write the bytes as an array
+    auto bytes = ReadValue<std::vector<uint8_t>>(reader);
+    Windows::Storage::Streams::Buffer buffer{static_cast<uint32_t>(bytes.size())};
+    std::copy(bytes.begin(), bytes.end(), buffer.data());
+    buffer.Length(static_cast<uint32_t>(bytes.size()));
+    value = buffer;
+  } else {
+    SkipValue<JSValue>(reader);
+    value = nullptr;
+  }
+}
+
 template <class T, std::enable_if_t<!std::is_void_v<decltype(GetStructInfo(static_cast<T *>(nullptr)))>, int>>
 inline void ReadValue(IJSValueReader const &reader, /*out*/ T &value) noexcept {
   if (reader.ValueType() == JSValueType::Object) {
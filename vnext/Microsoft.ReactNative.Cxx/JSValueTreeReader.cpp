@@ -124,6 +124,67 @@ double JSValueTreeReader::GetDouble() noexcept {
   return d ? *d : 0;
 }
 
+bool JSValueTreeReader::TryGetDoubleArray(com_array<double> &values) noexcept {
+  auto arr = TryGetUnreadArray();
+  if (!arr) {
+    return false;
+  }
+
+  com_array<double> result(static_cast<uint32_t>(arr->size()));
+  for (uint32_t i = 0; i < result.size(); ++i) {
+    const auto &item = (*arr)[i];
+    if (item.Type() == JSValueType::Double) {
+      result[i] = *item.TryGetDouble();
+    } else if (item.Type() == JSValueType::Int64) {
+      result[i] = static_cast<double>(*item.TryGetInt64());
+    } else {
+      return false;
+    }
+  }
+
+  values = std::move(result);
+  m_isInContainer = !m_stack.empty();
+  return true;
+}
+
+bool JSValueTreeReader::TryGetInt64Array(com_array<int64_t> &values) noexcept {
+  auto arr = TryGetUnreadArray();
+  if (!arr) {
+    return false;
+  }
+
+  com_array<int64_t> result(static_cast<uint32_t>(arr->size()));
+  for (uint32_t i = 0; i < result.size(); ++i) {
+    auto value = (*arr)[i].TryGetInt64();
+    if (!value) {
+      return false;
+    }
+    result[i] = *value;
+  }
+
+  values = std::move(result);
+  m_isInContainer = !m_stack.empty();
+  return true;
+}
+
+com_array<uint8_t> JSValueTreeReader::GetUtf8String() noexcept {
+  auto s = m_current->TryGetString();
+  if (!s) {
+    return {};
+  }
+  auto data = reinterpret_cast<const uint8_t *>(s->data());
+  return com_array<uint8_t>(data, data + s->size());
+}
+
+Windows::Storage::Streams::IBuffer JSValueTreeReader::TryGetArrayBuffer(bool /*isBorrowed*/) noexcept {
+  // JSValue has no binary type
+  return nullptr;
+}
+
+const JSValueArray *JSValueTreeReader::TryGetUnreadArray() const noexcept {
+  return m_isInContainer ? nullptr : m_current->TryGetArray();
+}
+
 IJSValueReader MakeJSValueTreeReader(const JSValue &root) noexcept {
   return make<JSValueTreeReader>(root);
 }
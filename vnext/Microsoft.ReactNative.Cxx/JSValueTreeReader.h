@@ -12,7 +12,7 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader> {
+struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader, IJSValueReader2> {
   JSValueTreeReader(const JSValue &value) noexcept;
   JSValueTreeReader(JSValue &&value) noexcept;
 
@@ -25,6 +25,12 @@ struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader> {
   int64_t GetInt64() noexcept;
   double GetDouble() noexcept;
 
+ public: // IJSValueReader2
+  bool TryGetDoubleArray(com_array<double> &values) noexcept;
+  bool TryGetInt64Array(com_array<int64_t> &values) noexcept;
+  com_array<uint8_t> GetUtf8String() noexcept;
+  Windows::Storage::Streams::IBuffer TryGetArrayBuffer(bool isBorrowed) noexcept;
+
  private:
   struct StackEntry {
     StackEntry(const JSValue &value, const JSValueObject::const_iterator &property) noexcept;
@@ -37,6 +43,8 @@ struct JSValueTreeReader : implements<JSValueTreeReader, IJSValueReader> {
 
  private:
   void SetCurrentValue(const JSValue &value) noexcept;
+  // Returns the current value when it is an array that is not read yet
+  const JSValueArray *TryGetUnreadArray() const noexcept;
 
  private:
   const JSValue m_ownedValue;
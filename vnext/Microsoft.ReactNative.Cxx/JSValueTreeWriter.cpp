@@ -6,6 +6,7 @@
 
 #include "pch.h"
 #include "JSValueTreeWriter.h"
+#include <winrt/Windows.Storage.Streams.h>
 #include "Crash.h"
 
 namespace winrt::Microsoft::ReactNative {
@@ -55,7 +56,7 @@ void JSValueTreeWriter::WritePropertyName(const winrt::hstring &name) noexcept {
 void JSValueTreeWriter::WriteObjectEnd() noexcept {
   auto &top = m_containerStack.top();
   VerifyElseCrash(top.Type == ContainerType::Object);
-  JSValue value{std::move(top.Object)};
+  JSValue value{std::move(*top.Object)};
   m_containerStack.pop();
   WriteValue(std::move(value));
 }
@@ -72,6 +73,38 @@ void JSValueTreeWriter::WriteArrayEnd() noexcept {
   WriteValue(std::move(value));
 }
 
+void JSValueTreeWriter::WriteDoubleArray(array_view<double const> values) noexcept {
+  JSValueArray array;
+  array.reserve(values.size());
+  for (double value : values) {
+    array.emplace_back(value);
+  }
+  WriteValue(JSValue{std::move(array)});
+}
+
+void JSValueTreeWriter::WriteInt64Array(array_view<int64_t const> values) noexcept {
+  JSValueArray array;
+  array.reserve(values.size());
+  for (int64_t value : values) {
+    array.emplace_back(value);
+  }
+  WriteValue(JSValue{std::move(array)});
+}
+
+void JSValueTreeWriter::WriteUtf8String(array_view<uint8_t const> value) noexcept {
+  WriteValue(JSValue{std::string{reinterpret_cast<const char *>(value.data()), value.size()}});
+}
+
+void JSValueTreeWriter::WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept {
+  // JSValue has no binary type
+  JSValueArray array;
+  array.reserve(buffer.Length());
+  for (uint8_t value : array_view<uint8_t const>{buffer.data(), buffer.Length()}) {
+    array.emplace_back(value);
+  }
+  WriteValue(JSValue{std::move(array)});
+}
+
 void JSValueTreeWriter::WriteValue(JSValue &&value) noexcept {
   auto &top = m_containerStack.top();
   switch (top.Type) {
@@ -79,7 +112,7 @@ void JSValueTreeWriter::WriteValue(JSValue &&value) noexcept {
       m_resultValue = std::move(value);
       break;
     case ContainerType::Object:
-      top.Object.emplace(std::move(top.PropertyName), std::move(value));
+      top.Object->emplace(std::move(top.PropertyName), std::move(value));
       break;
     case ContainerType::Array:
       top.Array.push_back(std::move(value));
@@ -8,13 +8,15 @@
 #ifndef MICROSOFT_REACTNATIVE_JSVALUETREEWRITER
 #define MICROSOFT_REACTNATIVE_JSVALUETREEWRITER
 
+#include <optional>
 #include <stack>
+#include <vector>
 #include "JSValue.h"
 
 namespace winrt::Microsoft::ReactNative {
 
 // Writes to a tree of JSValue objects.
-struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter> {
+struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter, IJSValueWriter2> {
   JSValueTreeWriter() noexcept;
   JSValue TakeValue() noexcept;
 
@@ -30,14 +32,25 @@ struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter> {
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJSValueWriter2
+  void WriteDoubleArray(array_view<double const> values) noexcept;
+  void WriteInt64Array(array_view<int64_t const> values) noexcept;
+  void WriteUtf8String(array_view<uint8_t const> value) noexcept;
+  void WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept;
+
  private:
   enum struct ContainerType { None, Object, Array };
 
   struct ContainerInfo {
-    ContainerInfo(ContainerType type) noexcept : Type{std::move(type)} {}
+    ContainerInfo(ContainerType type) noexcept : Type{std::move(type)} {
+      if (Type == ContainerType::Object) {
+        Object.emplace();
+      }
+    }
 
     ContainerType Type{ContainerType::None};
-    JSValueObject Object;
+    // Only created for objects, because an empty std::map allocates its head node
+    std::optional<JSValueObject> Object;
     JSValueArray Array;
     std::string PropertyName;
   };
@@ -46,7 +59,9 @@ struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter> {
   void WriteValue(JSValue &&value) noexcept;
 
  private:
-  std::stack<ContainerInfo> m_containerStack;
+  // A std::deque allocates a block for each ContainerInfo, because they are large. A vector does not allocate again
+  // for nested containers once it has grown to the depth of the tree.
+  std::stack<ContainerInfo, std::vector<ContainerInfo>> m_containerStack;
   JSValue m_resultValue;
 };
 
@@ -9,6 +9,7 @@
 #define MICROSOFT_REACTNATIVE_JSVALUEWRITER
 
 #include <winrt/Microsoft.ReactNative.h>
+#include <winrt/Windows.Storage.Streams.h>
 #include "JSValue.h"
 #include "StructInfo.h"
 
@@ -52,6 +53,7 @@ void WriteValue(IJSValueWriter const &writer, std::tuple<Ts...> const &value) no
 void WriteValue(IJSValueWriter const &writer, JSValue const &value) noexcept;
 void WriteValue(IJSValueWriter const &writer, JSValueObject const &value) noexcept;
 void WriteValue(IJSValueWriter const &writer, JSValueArray const &value) noexcept;
+void WriteValue(IJSValueWriter const &writer, Windows::Storage::Streams::IBuffer const &value) noexcept;
 
 template <class T, std::enable_if_t<!std::is_void_v<decltype(GetStructInfo(static_cast<T *>(nullptr)))>, int> = 1>
 void WriteValue(IJSValueWriter const &writer, T const &value) noexcept;
@@ -177,6 +179,27 @@ inline void WriteValue(
 
 template <class T, class TAlloc>
 inline void WriteValue(IJSValueWriter const &writer, std::vector<T, TAlloc> const &value) noexcept {
+  if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+    // Write arrays of numbers with one call when the writer supports it
+    if (auto writer2 = writer.try_as<IJSValueWriter2>()) {
+      using Number = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+      std::vector<Number> converted;
+      array_view<Number const> items;
+      if constexpr (std::is_same_v<T, Number>) {
+        items = {value.data(), static_cast<uint32_t>(value.size())};
+      } else {
+        converted.assign(value.begin(), value.end());
+        items = {converted.data(), static_cast<uint32_t>(converted.size())};
+      }
+      if constexpr (std::is_integral_v<T>) {
+        writer2.WriteInt64Array(items);
+      } else {
+        writer2.WriteDoubleArray(items);
+      }
+      return;
+    }
+  }
+
   writer.WriteArrayBegin();
   for (const auto &item : value) {
     WriteValue(writer, item);
@@ -206,6 +229,21 @@ inline void WriteValue(IJSValueWriter const &writer, JSValueArray const &value)
   value.WriteTo(writer);
 }
 
+// Writes an ArrayBuffer that refers to the buffer, or an array of its bytes when the writer has no binary values.
+inline void WriteValue(IJSValueWriter const &writer, Windows::Storage::Streams::IBuffer const &value) noexcept {
+  if (!value) {
+    writer.WriteNull();
+  } else if (auto writer2 = writer.try_as<IJSValueWriter2>()) {
+    writer2.WriteArrayBuffer(value);
+  } else {
+    writer.WriteArrayBegin();
+    for (uint8_t item : array_view<uint8_t const>{value.data(), value.Length()}) {
+      writer.WriteInt64(item);
+    }
+    writer.WriteArrayEnd();
+  }
+}
+
 inline void WriteCustomDirectEventTypeConstant(
     IJSValueWriter const &writer,
     std::wstring_view propertyName,
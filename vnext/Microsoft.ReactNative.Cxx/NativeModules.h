@@ -8,6 +8,7 @@
 #include <winrt/Microsoft.ReactNative.h>
 #include <winrt/Windows.Foundation.h>
 #include "JSI/JsiApiContext.h"
+#include "JSI/JsiSyncMethod.h"
 #include "JSValueReader.h"
 #include "JSValueWriter.h"
 #include "ModuleRegistration.h"
@@ -82,6 +83,35 @@
 // It can be an instance or static method.
 #define REACT_METHOD(/* method, [opt] methodName */...) INTERNAL_REACT_MEMBER(__VA_ARGS__)(AsyncMethod, __VA_ARGS__)
 
+// REACT_METHOD_ON(dispatcher, method, [opt] methodName)
+// Arguments:
+// - dispatcher (required) - the MethodDispatcher that runs the method: JS, UI, Serial or Concurrent.
+// - method (required) - the method name the macro is attached to.
+// - methodName (optional) - the method name visible to JavaScript. Default is the method name.
+//
+// REACT_METHOD_ON annotates an asynchronous method like REACT_METHOD, which runs on the dispatcher instead of the JS
+// thread when the module is a TurboModule, so that slow native work does not block JS:
+// - UI runs it on the UI thread.
+// - Serial runs it on a serial dispatcher of the module instance, one call at a time in the order of the JS calls.
+// - Concurrent runs it on the shared thread pool, concurrently with other calls.
+// Its arguments are copied before it is posted, and its callbacks and promises pass the result back to JS.
+// The copy does not keep ArrayBuffer arguments, which only methods on the JS thread can read with TryGetArrayBuffer.
+// The Serial calls that did not run yet are dropped when the module is destroyed with its instance.
+// Other module builders call it on the JS thread.
+// It can be an instance or static method.
+#define REACT_METHOD_ON(/* dispatcher, method, [opt] methodName */ dispatcher, ...) \
+  INTERNAL_REACT_MEMBER(__VA_ARGS__)(dispatcher##DispatcherMethod, __VA_ARGS__)
+
+// REACT_MODULE_DISPATCHER(dispatcher)
+// Arguments:
+// - dispatcher (required) - the MethodDispatcher that runs the methods: JS, UI, Serial or Concurrent.
+//
+// REACT_MODULE_DISPATCHER is put in the module struct to run all of its REACT_METHOD methods on the dispatcher, as
+// REACT_METHOD_ON does for one method. REACT_METHOD_ON methods keep their own dispatcher.
+#define REACT_MODULE_DISPATCHER(dispatcher)                                                  \
+  static constexpr winrt::Microsoft::ReactNative::MethodDispatcher ReactMethodDispatcher = \
+      winrt::Microsoft::ReactNative::MethodDispatcher::dispatcher;
+
 // REACT_SYNC_METHOD(method, [opt] methodName)
 // Arguments:
 // - method (required) - the method name the macro is attached to.
@@ -93,6 +123,21 @@
 // It can be an instance or static method.
 #define REACT_SYNC_METHOD(/* method, [opt] methodName */...) INTERNAL_REACT_MEMBER(__VA_ARGS__)(SyncMethod, __VA_ARGS__)
 
+// REACT_JSI_SYNC_METHOD(method, [opt] methodName)
+// Arguments:
+// - method (required) - the method name the macro is attached to.
+// - methodName (optional) - the method name visible to JavaScript. Default is the method name.
+//
+// REACT_JSI_SYNC_METHOD annotates a synchronous method like REACT_SYNC_METHOD, which is called with no ABI calls to
+// read its arguments and write its result when the module is a TurboModule in the process of the JS engine.
+// Its arguments and result are converted directly between their C++ types and JSI values by JsiSyncMethodValue,
+// which supports bool, numbers, strings, and std::optional and std::vector of them.
+// Other module builders call it as a REACT_SYNC_METHOD.
+// The module must be built with the same JSI and C++ runtime as Microsoft.ReactNative.
+// It can be an instance or static method.
+#define REACT_JSI_SYNC_METHOD(/* method, [opt] methodName */...) \
+  INTERNAL_REACT_MEMBER(__VA_ARGS__)(JsiSyncMethod, __VA_ARGS__)
+
 // REACT_CONSTANT_PROVIDER(method)
 // Arguments:
 // - method (required) - the method name the macro is attached to.
@@ -790,6 +835,52 @@ struct ModuleSyncMethodInfo<TResult (*)(TArgs...) noexcept> : ModuleSyncMethodIn
   }
 };
 
+template <class TFunc>
+struct ModuleJsiSyncMethodInfo;
+
+// Instance synchronous method with JSI arguments
+template <class TModule, class TResult, class... TArgs>
+struct ModuleJsiSyncMethodInfo<TResult (TModule::*)(TArgs...) noexcept> {
+  using ModuleType = TModule;
+  using MethodType = TResult (TModule::*)(TArgs...) noexcept;
+
+  template <size_t... I>
+  static JsiSyncMethodDelegate GetFunc(ModuleType *module, MethodType method, std::index_sequence<I...>) noexcept {
+    return [module, method](facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
+      return JsiSyncMethodValue<RemoveConstRef<TResult>>::ToJsi(
+          rt, (module->*method)(ReadJsiSyncMethodArg<RemoveConstRef<TArgs>>(rt, args, count, I)...));
+    };
+  }
+
+  static JsiSyncMethodDelegate GetMethodDelegate(void *module, MethodType method) noexcept {
+    static_assert(
+        (IsJsiSyncMethodValue<TResult> && ... && IsJsiSyncMethodValue<TArgs>),
+        "REACT_JSI_SYNC_METHOD parameters and result must be types that JsiSyncMethodValue converts.");
+    return GetFunc(static_cast<ModuleType *>(module), method, std::make_index_sequence<sizeof...(TArgs)>{});
+  }
+};
+
+// Static synchronous method with JSI arguments
+template <class TResult, class... TArgs>
+struct ModuleJsiSyncMethodInfo<TResult (*)(TArgs...) noexcept> {
+  using MethodType = TResult (*)(TArgs...) noexcept;
+
+  template <size_t... I>
+  static JsiSyncMethodDelegate GetFunc(MethodType method, std::index_sequence<I...>) noexcept {
+    return [method](facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
+      return JsiSyncMethodValue<RemoveConstRef<TResult>>::ToJsi(
+          rt, (*method)(ReadJsiSyncMethodArg<RemoveConstRef<TArgs>>(rt, args, count, I)...));
+    };
+  }
+
+  static JsiSyncMethodDelegate GetMethodDelegate(void * /*module*/, MethodType method) noexcept {
+    static_assert(
+        (IsJsiSyncMethodValue<TResult> && ... && IsJsiSyncMethodValue<TArgs>),
+        "REACT_JSI_SYNC_METHOD parameters and result must be types that JsiSyncMethodValue converts.");
+    return GetFunc(method, std::make_index_sequence<sizeof...(TArgs)>{});
+  }
+};
+
 template <class TFunc>
 struct ModuleEventEmitterInfo;
 
@@ -1033,10 +1124,43 @@ using ReactConstantFieldAttribute = ReactMemberAttribute<ReactMemberKind::Consta
 using ReactEventFieldAttribute = ReactMemberAttribute<ReactMemberKind::EventField>;
 using ReactFunctionFieldAttribute = ReactMemberAttribute<ReactMemberKind::FunctionField>;
 
+// REACT_JSI_SYNC_METHOD is a SyncMethod member, so that it matches the sync methods of module specs.
+struct ReactJsiSyncMethodAttribute : ReactSyncMethodAttribute {
+  using ReactSyncMethodAttribute::ReactSyncMethodAttribute;
+};
+
+// REACT_METHOD_ON is an AsyncMethod member, so that it matches the async methods of module specs.
+template <MethodDispatcher DispatcherValue>
+struct ReactDispatchedMethodAttribute : ReactAsyncMethodAttribute {
+  using ReactAsyncMethodAttribute::ReactAsyncMethodAttribute;
+
+  static constexpr MethodDispatcher Dispatcher = DispatcherValue;
+};
+
+using ReactJSDispatcherMethodAttribute = ReactDispatchedMethodAttribute<MethodDispatcher::JS>;
+using ReactUIDispatcherMethodAttribute = ReactDispatchedMethodAttribute<MethodDispatcher::UI>;
+using ReactSerialDispatcherMethodAttribute = ReactDispatchedMethodAttribute<MethodDispatcher::Serial>;
+using ReactConcurrentDispatcherMethodAttribute = ReactDispatchedMethodAttribute<MethodDispatcher::Concurrent>;
+
+template <class T>
+struct IsReactDispatchedMethodAttribute : std::false_type {};
+template <MethodDispatcher Dispatcher>
+struct IsReactDispatchedMethodAttribute<ReactDispatchedMethodAttribute<Dispatcher>> : std::true_type {};
+
 template <class T>
 struct IsReactMemberAttribute : std::false_type {};
 template <ReactMemberKind MemberKind>
 struct IsReactMemberAttribute<ReactMemberAttribute<MemberKind>> : std::true_type {};
+template <>
+struct IsReactMemberAttribute<ReactJsiSyncMethodAttribute> : std::true_type {};
+template <MethodDispatcher Dispatcher>
+struct IsReactMemberAttribute<ReactDispatchedMethodAttribute<Dispatcher>> : std::true_type {};
+
+// The module sets the dispatcher of its methods with REACT_MODULE_DISPATCHER
+template <class TModule, class = void>
+struct HasReactMethodDispatcher : std::false_type {};
+template <class TModule>
+struct HasReactMethodDispatcher<TModule, std::void_t<decltype(TModule::ReactMethodDispatcher)>> : std::true_type {};
 
 template <class TModule>
 struct ReactModuleBuilder {
@@ -1074,8 +1198,12 @@ struct ReactModuleBuilder {
       RegisterInitMethod(member);
     } else if constexpr (std::is_same_v<TAttribute, ReactAsyncMethodAttribute>) {
       RegisterMethod(member, attributeInfo.JSMemberName);
+    } else if constexpr (IsReactDispatchedMethodAttribute<TAttribute>::value) {
+      RegisterMethod(member, attributeInfo.JSMemberName, TAttribute::Dispatcher);
     } else if constexpr (std::is_same_v<TAttribute, ReactSyncMethodAttribute>) {
       RegisterSyncMethod(member, attributeInfo.JSMemberName);
+    } else if constexpr (std::is_same_v<TAttribute, ReactJsiSyncMethodAttribute>) {
+      RegisterJsiSyncMethod(member, attributeInfo.JSMemberName);
     } else if constexpr (std::is_same_v<TAttribute, ReactConstantMethodAttribute>) {
       RegisterConstantMethod(member);
     } else if constexpr (std::is_same_v<TAttribute, ReactConstantStrongTypedMethodAttribute>) {
@@ -1103,9 +1231,24 @@ struct ReactModuleBuilder {
 
   template <class TMethod>
   void RegisterMethod(TMethod method, std::wstring_view name) noexcept {
+    if constexpr (HasReactMethodDispatcher<TModule>::value) {
+      RegisterMethod(method, name, TModule::ReactMethodDispatcher);
+    } else {
+      MethodReturnType returnType;
+      auto methodDelegate = ModuleMethodInfo<TMethod>::GetMethodDelegate(m_module, method, /*out*/ returnType);
+      m_moduleBuilder.AddMethod(name, returnType, methodDelegate);
+    }
+  }
+
+  template <class TMethod>
+  void RegisterMethod(TMethod method, std::wstring_view name, MethodDispatcher dispatcher) noexcept {
     MethodReturnType returnType;
     auto methodDelegate = ModuleMethodInfo<TMethod>::GetMethodDelegate(m_module, method, /*out*/ returnType);
-    m_moduleBuilder.AddMethod(name, returnType, methodDelegate);
+    if (auto moduleBuilder2 = m_moduleBuilder.try_as<IReactModuleBuilder2>()) {
+      moduleBuilder2.AddMethodOnDispatcher(name, returnType, dispatcher, methodDelegate);
+    } else {
+      m_moduleBuilder.AddMethod(name, returnType, methodDelegate);
+    }
   }
 
   template <class TMethod>
@@ -1114,6 +1257,18 @@ struct ReactModuleBuilder {
     m_moduleBuilder.AddSyncMethod(name, syncMethodDelegate);
   }
 
+  template <class TMethod>
+  void RegisterJsiSyncMethod(TMethod method, std::wstring_view name) noexcept {
+#ifndef __APPLE__
+    if (auto jsiSyncMethodBuilder = m_moduleBuilder.try_as<IJsiSyncMethodBuilder>()) {
+      jsiSyncMethodBuilder->AddJsiSyncMethod(
+          name, ModuleJsiSyncMethodInfo<TMethod>::GetMethodDelegate(m_module, method));
+      return;
+    }
+#endif
+    RegisterSyncMethod(method, name);
+  }
+
   template <class TMethod>
   void RegisterConstantMethod(TMethod method) noexcept {
     auto constantProvider = ModuleConstantInfo<TMethod>::GetConstantProvider(m_module, method);
@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_REACTEVENTBATCHER
+#define MICROSOFT_REACTNATIVE_REACTEVENTBATCHER
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "JSValue.h"
+#include "ReactContext.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+enum class ReactEventBatchMode {
+  // The JS listener gets the values of all events in the batch, in the order they were emitted.
+  AllValues,
+  // The JS listener gets only the value of the last event in the batch.
+  LatestValueWins,
+};
+
+// Coalesces the JS events that a native module emits at a high rate, such as sensor readings or download progress.
+// Emitting an event schedules a delivery on the JS dispatcher, and the events with the same name that are emitted
+// before the delivery runs are emitted to JS with one EmitJSEvent call. Their values are passed as one array
+// argument to the JS listener, which has only the last value for ReactEventBatchMode::LatestValueWins.
+// Different event names are delivered in the order of their first event in the batch.
+// Use it with std::make_shared, because the scheduled delivery holds a weak reference to it.
+// All methods are thread safe.
+struct ReactEventBatcher : std::enable_shared_from_this<ReactEventBatcher> {
+  ReactEventBatcher(
+      ReactContext const &context,
+      std::wstring_view eventEmitterName,
+      ReactEventBatchMode mode = ReactEventBatchMode::AllValues) noexcept
+      : m_context{context}, m_eventEmitterName{eventEmitterName}, m_mode{mode} {}
+
+  // Adds the event to the batch of its name, and schedules the delivery of the batches if it is not scheduled yet.
+  template <class T>
+  void Emit(std::wstring_view eventName, T const &value) noexcept {
+    EmitValue(eventName, JSValue::From(value));
+  }
+
+  void EmitValue(std::wstring_view eventName, JSValue &&value) noexcept {
+    bool isDeliveryScheduled{false};
+    {
+      std::scoped_lock lock{m_mutex};
+      auto it = std::find_if(
+          m_batches.begin(), m_batches.end(), [eventName](Batch const &batch) { return batch.EventName == eventName; });
+      if (it == m_batches.end()) {
+        it = m_batches.insert(m_batches.end(), Batch{std::wstring{eventName}, {}});
+      }
+
+      if (m_mode == ReactEventBatchMode::LatestValueWins) {
+        it->Values.clear();
+      }
+      it->Values.push_back(std::move(value));
+
+      isDeliveryScheduled = m_isDeliveryScheduled;
+      m_isDeliveryScheduled = true;
+    }
+
+    if (!isDeliveryScheduled) {
+      m_context.JSDispatcher().Post([weakThis = weak_from_this()]() noexcept {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->Flush();
+        }
+      });
+    }
+  }
+
+  // Emits the batched events now. It is called by the scheduled delivery.
+  void Flush() noexcept {
+    std::vector<Batch> batches;
+    {
+      std::scoped_lock lock{m_mutex};
+      batches = std::move(m_batches);
+      m_batches.clear();
+      m_isDeliveryScheduled = false;
+    }
+
+    for (auto const &batch : batches) {
+      m_context.EmitJSEvent(m_eventEmitterName, batch.EventName, [&batch](IJSValueWriter const &writer) noexcept {
+        WriteValue(writer, batch.Values);
+      });
+    }
+  }
+
+ private:
+  struct Batch {
+    std::wstring EventName;
+    JSValueArray Values;
+  };
+
+ private:
+  const ReactContext m_context;
+  const std::wstring m_eventEmitterName;
+  const ReactEventBatchMode m_mode;
+  std::mutex m_mutex;
+  std::vector<Batch> m_batches;
+  bool m_isDeliveryScheduled{false};
+};
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_REACTEVENTBATCHER
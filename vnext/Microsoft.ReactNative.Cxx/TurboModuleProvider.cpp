@@ -19,6 +19,14 @@ struct AbiCallInvoker final : facebook::react::CallInvoker {
         });
   }
 
+  void invokeAsync(facebook::react::SchedulerPriority priority, facebook::react::CallFunc &&func) noexcept override {
+    m_context.CallInvoker().InvokeAsyncWithPriority(
+        static_cast<CallInvokerPriority>(priority),
+        [context = m_context, func = std::move(func)](const winrt::Windows::Foundation::IInspectable &runtimeHandle) {
+          func(GetOrCreateContextRuntime(context, runtimeHandle));
+        });
+  }
+
   void invokeSync(facebook::react::CallFunc &&func) override {
     m_context.CallInvoker().InvokeSync(
         [context = m_context, func = std::move(func)](const winrt::Windows::Foundation::IInspectable &runtimeHandle) {
@@ -0,0 +1,244 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <NativeModules.h>
+#include <winrt/Microsoft.UI.Composition.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "TestEventService.h"
+#include "TestReactNativeHostHolder.h"
+
+using namespace winrt;
+using namespace Microsoft::ReactNative;
+
+namespace ReactNativeIntegrationTests {
+
+// Use anonymous namespace to avoid any linking conflicts
+namespace {
+
+// Measurements of one benchmark step, which is a single commit in MountBenchmarkTests.js
+struct MountBenchmarkSample {
+  uint32_t transactionCount{0};
+  uint32_t createCount{0};
+  uint32_t deleteCount{0};
+  uint32_t insertCount{0};
+  uint32_t removeCount{0};
+  uint32_t updateCount{0};
+  double mountDurationMs{0};
+  // Visuals in the tree of the ReactNativeIsland once the step is mounted
+  size_t visualCount{0};
+  // Change of the bytes allocated from the process heap over the step
+  int64_t heapDeltaBytes{0};
+
+  uint32_t mutationCount() const noexcept {
+    return createCount + deleteCount + insertCount + removeCount + updateCount;
+  }
+};
+
+// All members are only accessed on the UI thread, until MountBenchmark::Completed is logged
+struct MountBenchmarkResults {
+  ReactNativeIsland Island{nullptr};
+  std::map<std::string, std::vector<MountBenchmarkSample>> Samples;
+  std::string CurrentStep;
+  MountBenchmarkSample CurrentSample;
+  size_t HeapAllocatedAtStepStart{0};
+};
+
+MountBenchmarkResults s_results;
+
+ReactNotificationId<IReactPropertyBag> mountingTransactionNotification{
+    L"ReactNative.Fabric",
+    L"MountingTransaction"};
+ReactPropertyId<bool> mountingTransactionTelemetryEnabled{
+    L"ReactNative.Fabric",
+    L"MountingTransactionTelemetryEnabled"};
+
+size_t HeapAllocatedBytes() noexcept {
+  HEAP_SUMMARY summary{};
+  summary.cb = sizeof(summary);
+  return ::HeapSummary(::GetProcessHeap(), 0, &summary) ? summary.cbAllocated : 0;
+}
+
+size_t CountVisuals(winrt::Microsoft::UI::Composition::Visual const &visual) noexcept {
+  if (!visual) {
+    return 0;
+  }
+  size_t count = 1;
+  if (auto container = visual.try_as<winrt::Microsoft::UI::Composition::ContainerVisual>()) {
+    for (auto const &child : container.Children()) {
+      count += CountVisuals(child);
+    }
+  }
+  return count;
+}
+
+REACT_MODULE(MountBenchmarkModule)
+struct MountBenchmarkModule {
+  REACT_INIT(Initialize)
+  void Initialize(ReactContext const &reactContext) noexcept {
+    m_reactContext = reactContext;
+
+    // Sent on the UI thread after each mounting transaction
+    m_subscription = reactContext.Notifications().Subscribe(
+        mountingTransactionNotification,
+        [](IInspectable const & /*sender*/, ReactNotificationArgs<IReactPropertyBag> const &args) noexcept {
+          if (s_results.CurrentStep.empty()) {
+            return;
+          }
+
+          constexpr wchar_t ns[] = L"ReactNative.Fabric.MountingTransaction";
+          ReactPropertyBag data{args.Data()};
+          auto &sample = s_results.CurrentSample;
+          sample.transactionCount++;
+          sample.createCount += data.Get(ReactPropertyId<uint32_t>{ns, L"CreateCount"}).value_or(0);
+          sample.deleteCount += data.Get(ReactPropertyId<uint32_t>{ns, L"DeleteCount"}).value_or(0);
+          sample.insertCount += data.Get(ReactPropertyId<uint32_t>{ns, L"InsertCount"}).value_or(0);
+          sample.removeCount += data.Get(ReactPropertyId<uint32_t>{ns, L"RemoveCount"}).value_or(0);
+          sample.updateCount += data.Get(ReactPropertyId<uint32_t>{ns, L"UpdateCount"}).value_or(0);
+          sample.mountDurationMs += data.Get(ReactPropertyId<double>{ns, L"MountDurationMs"}).value_or(0);
+        });
+  }
+
+  // The markers are posted to the UI thread, where they are ordered with the mounting of the commits around them
+  REACT_METHOD(StepStarted, L"stepStarted")
+  void StepStarted(std::string name) noexcept {
+    m_reactContext.UIDispatcher().Post([name = std::move(name)]() {
+      s_results.CurrentStep = name;
+      s_results.CurrentSample = {};
+      s_results.HeapAllocatedAtStepStart = HeapAllocatedBytes();
+    });
+  }
+
+  REACT_METHOD(StepCompleted, L"stepCompleted")
+  void StepCompleted(std::string name) noexcept {
+    m_reactContext.UIDispatcher().Post([name = std::move(name)]() {
+      TestCheckEqual(s_results.CurrentStep, name);
+      auto &sample = s_results.CurrentSample;
+      sample.heapDeltaBytes =
+          static_cast<int64_t>(HeapAllocatedBytes()) - static_cast<int64_t>(s_results.HeapAllocatedAtStepStart);
+      sample.visualCount = s_results.Island ? CountVisuals(s_results.Island.RootVisual()) : 0;
+      s_results.Samples[name].push_back(sample);
+      s_results.CurrentStep.clear();
+    });
+  }
+
+  REACT_METHOD(Completed, L"completed")
+  void Completed() noexcept {
+    m_reactContext.UIDispatcher().Post([]() { TestEventService::LogEvent("MountBenchmark::Completed", nullptr); });
+  }
+
+ private:
+  ReactContext m_reactContext;
+  ReactNotificationSubscription m_subscription{nullptr};
+};
+
+struct MountBenchmarkPackageProvider : winrt::implements<MountBenchmarkPackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    TryAddAttributedModule(packageBuilder, L"MountBenchmarkModule", true);
+  }
+};
+
+// The median is reported, since the first iterations include warming up of the recycle pools and caches
+template <class T>
+T Median(std::vector<T> values) noexcept {
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+void ReportResults() noexcept {
+  printf(
+      "%-22s %8s %7s %7s %7s %7s %7s %10s %12s %8s %12s\n",
+      "step",
+      "mutations",
+      "create",
+      "delete",
+      "insert",
+      "remove",
+      "update",
+      "mount(ms)",
+      "us/mutation",
+      "visuals",
+      "heap(bytes)");
+  for (auto const &[name, samples] : s_results.Samples) {
+    std::vector<double> mountDurations;
+    std::vector<int64_t> heapDeltas;
+    for (auto const &sample : samples) {
+      mountDurations.push_back(sample.mountDurationMs);
+      heapDeltas.push_back(sample.heapDeltaBytes);
+    }
+
+    // Mutation and visual counts are the same for every iteration
+    auto const &sample = samples.back();
+    auto mountDurationMs = Median(mountDurations);
+    auto mutationCount = sample.mutationCount();
+    printf(
+        "%-22s %8u %7u %7u %7u %7u %7u %10.3f %12.3f %8zu %12lld\n",
+        name.c_str(),
+        mutationCount,
+        sample.createCount,
+        sample.deleteCount,
+        sample.insertCount,
+        sample.removeCount,
+        sample.updateCount,
+        mountDurationMs,
+        mutationCount ? mountDurationMs * 1000 / mutationCount : 0.0,
+        sample.visualCount,
+        Median(heapDeltas));
+  }
+}
+
+} // namespace
+
+TEST_CLASS (MountBenchmarkTests) {
+  // Mounts deep trees and wide lists on a ReactNativeIsland that is not connected to a window, then reorders,
+  // updates and unmounts them, and reports the cost of each step
+  TEST_METHOD(MountPipeline) {
+    TestEventService::Initialize();
+    s_results = {};
+
+    auto options = TestReactNativeHostHolder::Options{};
+    options.UseCompositor = true;
+    auto reactNativeHost = TestReactNativeHostHolder(
+        L"MountBenchmarkTests",
+        [](ReactNativeHost const &host) noexcept {
+          host.PackageProviders().Append(winrt::make<MountBenchmarkPackageProvider>());
+          ReactPropertyBag(host.InstanceSettings().Properties()).Set(mountingTransactionTelemetryEnabled, true);
+        },
+        std::move(options));
+
+    reactNativeHost.DispatcherQueue().TryEnqueue([&reactNativeHost]() noexcept {
+      ReactViewOptions viewOptions;
+      viewOptions.ComponentName(L"MountBenchmark");
+      s_results.Island = ReactNativeIsland(reactNativeHost.Compositor());
+      s_results.Island.ReactViewHost(ReactCoreInjection::MakeViewHost(reactNativeHost.Host(), viewOptions));
+
+      LayoutConstraints constraints;
+      constraints.LayoutDirection = LayoutDirection::Undefined;
+      constraints.MaximumSize = constraints.MinimumSize = {1024, 1024};
+      s_results.Island.Arrange(constraints, {0, 0});
+    });
+
+    TestEventService::ObserveEvents({TestEvent{"MountBenchmark::Completed", nullptr}});
+
+    reactNativeHost.DispatcherQueue().TryEnqueue([]() noexcept {
+      s_results.Island.ReactViewHost(nullptr);
+      s_results.Island = nullptr;
+      TestEventService::LogEvent("MountBenchmark::IslandReleased", nullptr);
+    });
+    TestEventService::ObserveEvents({TestEvent{"MountBenchmark::IslandReleased", nullptr}});
+
+    ReportResults();
+
+    TestCheckEqual(6u, s_results.Samples.size());
+    TestCheck(s_results.Samples["wideList.mount"].back().createCount >= 1000);
+    TestCheck(s_results.Samples["deepTree.mount"].back().insertCount >= 100);
+    TestCheck(s_results.Samples["wideList.propUpdate"].back().updateCount >= 1000);
+  }
+};
+
+} // namespace ReactNativeIntegrationTests
@@ -0,0 +1,67 @@
+import React from 'react';
+import { AppRegistry, TurboModuleRegistry, View } from 'react-native';
+
+const benchmark = TurboModuleRegistry.getEnforcing('MountBenchmarkModule');
+
+const iterations = 5;
+const treeDepth = 100;
+const listWidth = 1000;
+
+const forwardOrder = Array.from({ length: listWidth }, (_, i) => i);
+const reverseOrder = [...forwardOrder].reverse();
+
+function DeepTree({ depth }) {
+  return depth === 0 ? null : (
+    <View collapsable={false} style={{ padding: 1 }}>
+      <DeepTree depth={depth - 1} />
+    </View>
+  );
+}
+
+function WideList({ order, color }) {
+  return (
+    <View collapsable={false} style={{ flexDirection: 'row', flexWrap: 'wrap' }}>
+      {order.map(key => (
+        <View key={key} collapsable={false} style={{ width: 4, height: 4, backgroundColor: color }} />
+      ))}
+    </View>
+  );
+}
+
+// Each step is a single commit, so the C++ side can attribute the mounting transactions between stepStarted and
+// stepCompleted to it
+const steps = [
+  { name: 'deepTree.mount', render: () => <DeepTree depth={treeDepth} /> },
+  { name: 'deepTree.unmount', render: () => null },
+  { name: 'wideList.mount', render: () => <WideList order={forwardOrder} color="red" /> },
+  { name: 'wideList.reorder', render: () => <WideList order={reverseOrder} color="red" /> },
+  { name: 'wideList.propUpdate', render: () => <WideList order={reverseOrder} color="blue" /> },
+  { name: 'wideList.unmount', render: () => null },
+];
+
+function MountBenchmark() {
+  const [step, setStep] = React.useState(-1);
+
+  React.useEffect(() => {
+    if (step >= 0) {
+      benchmark.stepCompleted(steps[step % steps.length].name);
+    }
+
+    const next = step + 1;
+    if (next === steps.length * iterations) {
+      benchmark.completed();
+      return;
+    }
+
+    // Let the previous commit be mounted before starting the next one
+    const timer = setTimeout(() => {
+      benchmark.stepStarted(steps[next % steps.length].name);
+      setStep(next);
+    }, 0);
+    return () => clearTimeout(timer);
+  }, [step]);
+
+  return step >= 0 ? steps[step % steps.length].render() : null;
+}
+
+AppRegistry.registerComponent('MountBenchmark', () => MountBenchmark);
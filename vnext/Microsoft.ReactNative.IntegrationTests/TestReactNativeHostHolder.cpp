@@ -71,14 +71,18 @@ TestReactNativeHostHolder::TestReactNativeHostHolder(
     m_host.PackageProviders().Append(winrt::make<TestReactPackageProvider>());
 
     // To properly enable fabric you need to set a compositor.
-    // Since the UTs are ui-less we can force fabric by setting a CompositionContext with a null compositor
+    // Since the UTs are ui-less we can force fabric by setting a CompositionContext with a null compositor, unless the
+    // test needs to render
+    if (options.UseCompositor) {
+      m_compositor = winrt::Microsoft::UI::Composition::Compositor();
+    }
     winrt::Microsoft::ReactNative::ReactPropertyBag(m_host.InstanceSettings().Properties())
         .Set(
             winrt::Microsoft::ReactNative::ReactPropertyId<
                 winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext>{
                 L"ReactNative.Composition", L"CompositionContext"},
             winrt::Microsoft::ReactNative::Composition::Experimental::MicrosoftCompositionContextHelper::CreateContext(
-                nullptr));
+                m_compositor));
 
     hostInitializer(m_host);
 
@@ -90,6 +94,8 @@ TestReactNativeHostHolder::TestReactNativeHostHolder(
 
 TestReactNativeHostHolder::~TestReactNativeHostHolder() noexcept {
   m_host.UnloadInstance().get();
+  // The Compositor has to be released on the thread it was created on
+  m_queueController.DispatcherQueue().TryEnqueue([this]() noexcept { m_compositor = nullptr; });
   m_queueController.ShutdownQueueAsync().get();
 }
 
@@ -97,4 +103,12 @@ winrt::Microsoft::ReactNative::ReactNativeHost const &TestReactNativeHostHolder:
   return m_host;
 }
 
+winrt::Microsoft::UI::Dispatching::DispatcherQueue TestReactNativeHostHolder::DispatcherQueue() const noexcept {
+  return m_queueController.DispatcherQueue();
+}
+
+winrt::Microsoft::UI::Composition::Compositor const &TestReactNativeHostHolder::Compositor() const noexcept {
+  return m_compositor;
+}
+
 } // namespace ReactNativeIntegrationTests
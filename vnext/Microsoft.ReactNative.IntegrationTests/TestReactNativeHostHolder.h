@@ -7,6 +7,7 @@
 #include <winrt/Microsoft.ReactNative.h>
 #include <string_view>
 
+#include <winrt/Microsoft.UI.Composition.h>
 #include <winrt/Microsoft.UI.Dispatching.h>
 
 namespace ReactNativeIntegrationTests {
@@ -14,6 +15,9 @@ namespace ReactNativeIntegrationTests {
 struct TestReactNativeHostHolder {
   struct Options {
     bool LoadInstance = true;
+    // Create a real Compositor on the host thread, so that ReactNativeIslands can render.  Otherwise Fabric runs
+    // without a compositor.
+    bool UseCompositor = false;
   };
 
   TestReactNativeHostHolder(
@@ -23,10 +27,14 @@ struct TestReactNativeHostHolder {
   ~TestReactNativeHostHolder() noexcept;
 
   winrt::Microsoft::ReactNative::ReactNativeHost const &Host() const noexcept;
+  winrt::Microsoft::UI::Dispatching::DispatcherQueue DispatcherQueue() const noexcept;
+  // Only set when Options::UseCompositor is true, and only usable on the DispatcherQueue
+  winrt::Microsoft::UI::Composition::Compositor const &Compositor() const noexcept;
 
  private:
   winrt::Microsoft::ReactNative::ReactNativeHost m_host{nullptr};
   winrt::Microsoft::UI::Dispatching::DispatcherQueueController m_queueController{nullptr};
+  winrt::Microsoft::UI::Composition::Compositor m_compositor{nullptr};
 };
 
 } // namespace ReactNativeIntegrationTests
@@ -0,0 +1,280 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <NativeModules.h>
+#include <winrt/Windows.Graphics.Imaging.h>
+#include <winrt/Windows.Security.Cryptography.h>
+#include <winrt/Windows.Storage.Streams.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+#include "TestEventService.h"
+#include "TestReactNativeHostHolder.h"
+
+using namespace winrt;
+using namespace Microsoft::ReactNative;
+
+namespace Imaging = winrt::Windows::Graphics::Imaging;
+namespace Streams = winrt::Windows::Storage::Streams;
+
+namespace ReactNativeIntegrationTests {
+
+// Use anonymous namespace to avoid any linking conflicts
+namespace {
+
+// Measurements of one benchmark step in TextImageBenchmarkTests.js
+struct TextImageBenchmarkSample {
+  // Time from the start of the step until JS sees it committed, which includes the measuring of its text
+  double commitMs{0};
+  // Time from the start of the step until it is committed and all of its images have loaded or failed
+  double settleMs{0};
+  uint32_t transactionCount{0};
+  // Time spent mounting the step, which includes drawing its text
+  double mountDurationMs{0};
+  uint32_t loadedImageCount{0};
+  uint32_t failedImageCount{0};
+  // Change of the bytes allocated from the process heap over the step
+  int64_t heapDeltaBytes{0};
+};
+
+// All members are only accessed on the UI thread, until TextImageBenchmark::Completed is logged
+struct TextImageBenchmarkResults {
+  ReactNativeIsland Island{nullptr};
+  std::map<std::string, std::vector<TextImageBenchmarkSample>> Samples;
+  std::string CurrentStep;
+  TextImageBenchmarkSample CurrentSample;
+};
+
+TextImageBenchmarkResults s_results;
+std::atomic<size_t> s_heapAllocatedAtStepStart{0};
+
+// The data URIs of the images, which are encoded before the instance starts
+std::map<std::string, std::string> s_imageSources;
+
+ReactNotificationId<IReactPropertyBag> mountingTransactionNotification{
+    L"ReactNative.Fabric",
+    L"MountingTransaction"};
+ReactPropertyId<bool> mountingTransactionTelemetryEnabled{
+    L"ReactNative.Fabric",
+    L"MountingTransactionTelemetryEnabled"};
+
+size_t HeapAllocatedBytes() noexcept {
+  HEAP_SUMMARY summary{};
+  summary.cb = sizeof(summary);
+  return ::HeapSummary(::GetProcessHeap(), 0, &summary) ? summary.cbAllocated : 0;
+}
+
+// Encodes a square gradient, which has enough detail for the decoders to do real work
+std::string EncodeImageDataUri(winrt::guid const &encoderId, std::string_view mimeType, uint32_t size) {
+  std::vector<uint8_t> pixels(size * size * 4);
+  for (uint32_t y = 0; y < size; ++y) {
+    for (uint32_t x = 0; x < size; ++x) {
+      uint8_t *pixel = &pixels[(y * size + x) * 4];
+      pixel[0] = static_cast<uint8_t>(x * 255 / size);
+      pixel[1] = static_cast<uint8_t>(y * 255 / size);
+      pixel[2] = static_cast<uint8_t>((x ^ y) & 0xFF);
+      pixel[3] = 0xFF;
+    }
+  }
+
+  Streams::InMemoryRandomAccessStream stream;
+  auto encoder = Imaging::BitmapEncoder::CreateAsync(encoderId, stream).get();
+  encoder.SetPixelData(
+      Imaging::BitmapPixelFormat::Bgra8, Imaging::BitmapAlphaMode::Ignore, size, size, 96, 96, pixels);
+  encoder.FlushAsync().get();
+
+  stream.Seek(0);
+  Streams::Buffer buffer{static_cast<uint32_t>(stream.Size())};
+  auto data = stream.ReadAsync(buffer, buffer.Capacity(), Streams::InputStreamOptions::None).get();
+  return "data:" + std::string{mimeType} + ";base64," +
+      winrt::to_string(winrt::Windows::Security::Cryptography::CryptographicBuffer::EncodeToBase64String(data));
+}
+
+void EncodeImageSources() {
+  if (!s_imageSources.empty()) {
+    return;
+  }
+
+  for (uint32_t size : {64u, 512u, 2048u}) {
+    s_imageSources["png" + std::to_string(size)] =
+        EncodeImageDataUri(Imaging::BitmapEncoder::PngEncoderId(), "image/png", size);
+    s_imageSources["jpeg" + std::to_string(size)] =
+        EncodeImageDataUri(Imaging::BitmapEncoder::JpegEncoderId(), "image/jpeg", size);
+  }
+}
+
+REACT_MODULE(TextImageBenchmarkModule)
+struct TextImageBenchmarkModule {
+  REACT_INIT(Initialize)
+  void Initialize(ReactContext const &reactContext) noexcept {
+    m_reactContext = reactContext;
+
+    // Sent on the UI thread after each mounting transaction
+    m_subscription = reactContext.Notifications().Subscribe(
+        mountingTransactionNotification,
+        [](IInspectable const & /*sender*/, ReactNotificationArgs<IReactPropertyBag> const &args) noexcept {
+          if (s_results.CurrentStep.empty()) {
+            return;
+          }
+
+          constexpr wchar_t ns[] = L"ReactNative.Fabric.MountingTransaction";
+          ReactPropertyBag data{args.Data()};
+          auto &sample = s_results.CurrentSample;
+          sample.transactionCount++;
+          sample.mountDurationMs += data.Get(ReactPropertyId<double>{ns, L"MountDurationMs"}).value_or(0);
+        });
+  }
+
+  REACT_CONSTANT_PROVIDER(GetConstants)
+  void GetConstants(ReactConstantProvider &provider) noexcept {
+    provider.Add(L"imageSources", s_imageSources);
+  }
+
+  // The heap is sampled right away, since the text of the step is measured on the JS thread before it is mounted
+  REACT_METHOD(StepStarted, L"stepStarted")
+  void StepStarted(std::string name) noexcept {
+    s_heapAllocatedAtStepStart = HeapAllocatedBytes();
+    m_reactContext.UIDispatcher().Post([name = std::move(name)]() {
+      s_results.CurrentStep = name;
+      s_results.CurrentSample = {};
+    });
+  }
+
+  // The marker is posted to the UI thread, where it is ordered after the mounting of the step
+  REACT_METHOD(StepCompleted, L"stepCompleted")
+  void StepCompleted(
+      std::string name,
+      double commitMs,
+      double settleMs,
+      uint32_t loadedImageCount,
+      uint32_t failedImageCount) noexcept {
+    m_reactContext.UIDispatcher().Post(
+        [name = std::move(name), commitMs, settleMs, loadedImageCount, failedImageCount]() {
+          TestCheckEqual(s_results.CurrentStep, name);
+          auto &sample = s_results.CurrentSample;
+          sample.commitMs = commitMs;
+          sample.settleMs = settleMs;
+          sample.loadedImageCount = loadedImageCount;
+          sample.failedImageCount = failedImageCount;
+          sample.heapDeltaBytes =
+              static_cast<int64_t>(HeapAllocatedBytes()) - static_cast<int64_t>(s_heapAllocatedAtStepStart.load());
+          s_results.Samples[name].push_back(sample);
+          s_results.CurrentStep.clear();
+        });
+  }
+
+  REACT_METHOD(Completed, L"completed")
+  void Completed() noexcept {
+    m_reactContext.UIDispatcher().Post([]() { TestEventService::LogEvent("TextImageBenchmark::Completed", nullptr); });
+  }
+
+ private:
+  ReactContext m_reactContext;
+  ReactNotificationSubscription m_subscription{nullptr};
+};
+
+struct TextImageBenchmarkPackageProvider
+    : winrt::implements<TextImageBenchmarkPackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    TryAddAttributedModule(packageBuilder, L"TextImageBenchmarkModule", true);
+  }
+};
+
+template <class T>
+T Median(std::vector<T> values) noexcept {
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+// The first iteration of a step is reported apart, since it runs with cold font, layout and image caches
+void ReportResults() noexcept {
+  printf(
+      "%-22s %11s %10s %11s %10s %10s %8s %12s\n",
+      "step",
+      "cold(ms)",
+      "commit(ms)",
+      "settle(ms)",
+      "mount(ms)",
+      "images",
+      "failed",
+      "heap(bytes)");
+  for (auto const &[name, samples] : s_results.Samples) {
+    std::vector<double> commitDurations;
+    std::vector<double> settleDurations;
+    std::vector<double> mountDurations;
+    std::vector<int64_t> heapDeltas;
+    for (auto const &sample : samples) {
+      commitDurations.push_back(sample.commitMs);
+      settleDurations.push_back(sample.settleMs);
+      mountDurations.push_back(sample.mountDurationMs);
+      heapDeltas.push_back(sample.heapDeltaBytes);
+    }
+
+    printf(
+        "%-22s %11.3f %10.3f %11.3f %10.3f %10u %8u %12lld\n",
+        name.c_str(),
+        samples.front().settleMs,
+        Median(commitDurations),
+        Median(settleDurations),
+        Median(mountDurations),
+        samples.back().loadedImageCount,
+        samples.back().failedImageCount,
+        Median(heapDeltas));
+  }
+}
+
+} // namespace
+
+TEST_CLASS (TextImageBenchmarkTests) {
+  // Lays out and draws text in many scripts, and decodes PNG and JPEG data URIs of several sizes, on a
+  // ReactNativeIsland that is not connected to a window, and reports the time and heap growth of each step
+  TEST_METHOD(TextAndImageRendering) {
+    TestEventService::Initialize();
+    s_results = {};
+    EncodeImageSources();
+
+    auto options = TestReactNativeHostHolder::Options{};
+    options.UseCompositor = true;
+    auto reactNativeHost = TestReactNativeHostHolder(
+        L"TextImageBenchmarkTests",
+        [](ReactNativeHost const &host) noexcept {
+          host.PackageProviders().Append(winrt::make<TextImageBenchmarkPackageProvider>());
+          ReactPropertyBag(host.InstanceSettings().Properties()).Set(mountingTransactionTelemetryEnabled, true);
+        },
+        std::move(options));
+
+    reactNativeHost.DispatcherQueue().TryEnqueue([&reactNativeHost]() noexcept {
+      ReactViewOptions viewOptions;
+      viewOptions.ComponentName(L"TextImageBenchmark");
+      s_results.Island = ReactNativeIsland(reactNativeHost.Compositor());
+      s_results.Island.ReactViewHost(ReactCoreInjection::MakeViewHost(reactNativeHost.Host(), viewOptions));
+
+      LayoutConstraints constraints;
+      constraints.LayoutDirection = LayoutDirection::Undefined;
+      constraints.MaximumSize = constraints.MinimumSize = {1024, 1024};
+      s_results.Island.Arrange(constraints, {0, 0});
+    });
+
+    TestEventService::ObserveEvents({TestEvent{"TextImageBenchmark::Completed", nullptr}});
+
+    reactNativeHost.DispatcherQueue().TryEnqueue([]() noexcept {
+      s_results.Island.ReactViewHost(nullptr);
+      s_results.Island = nullptr;
+      TestEventService::LogEvent("TextImageBenchmark::IslandReleased", nullptr);
+    });
+    TestEventService::ObserveEvents({TestEvent{"TextImageBenchmark::IslandReleased", nullptr}});
+
+    ReportResults();
+
+    TestCheckEqual(12u, s_results.Samples.size());
+    TestCheck(s_results.Samples["text.plain.mount"].back().transactionCount >= 1);
+    TestCheckEqual(8u, s_results.Samples["image.png.2048"].back().loadedImageCount);
+    TestCheckEqual(8u, s_results.Samples["image.jpeg.2048"].back().loadedImageCount);
+  }
+};
+
+} // namespace ReactNativeIntegrationTests
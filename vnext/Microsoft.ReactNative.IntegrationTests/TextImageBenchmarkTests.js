@@ -0,0 +1,177 @@
+import React from 'react';
+import { AppRegistry, Image, Text, TurboModuleRegistry, View } from 'react-native';
+
+const benchmark = TurboModuleRegistry.getEnforcing('TextImageBenchmarkModule');
+const { imageSources } = benchmark.getConstants();
+
+const iterations = 5;
+const paragraphCount = 300;
+const imageCount = 8;
+
+// Samples of scripts that take different shaping paths in DirectWrite
+const languageSamples = [
+  'The quick brown fox jumps over the lazy dog, and keeps running until the end of the line wraps.',
+  'Der schnelle braune Fuchs springt über den faulen Hund, während die Zeile umbricht.',
+  'Съешь же ещё этих мягких французских булок да выпей чаю, пока строка не перенесётся.',
+  'نص عربي طويل يلتف على عدة أسطر ليختبر تشكيل الحروف واتجاه الكتابة من اليمين إلى اليسار.',
+  'טקסט עברי ארוך שנשבר לכמה שורות כדי לבדוק כיווניות מימין לשמאל.',
+  'いろはにほへと ちりぬるを わかよたれそ つねならむ、長い日本語の文章が折り返されます。',
+  '敏捷的棕色狐狸跳过了懒狗，这一行中文文本会在容器的宽度处换行。',
+  'हिन्दी का यह लंबा वाक्य कई पंक्तियों में टूटता है ताकि संयुक्ताक्षरों का आकार जाँचा जा सके।',
+  'ภาษาไทยไม่มีการเว้นวรรคระหว่างคำ จึงต้องใช้พจนานุกรมในการตัดบรรทัด',
+  'Emoji 👩‍👩‍👧‍👦 🏳️‍🌈 🇯🇵 mixed with text and symbols ✓ ∑ ∞ that fall back to other fonts.',
+];
+
+const paragraphs = Array.from({ length: paragraphCount }, (_, i) => languageSamples[i % languageSamples.length]);
+
+function PlainText({ width }) {
+  return (
+    <View style={{ width }}>
+      {paragraphs.map((paragraph, i) => (
+        <Text key={i}>{paragraph}</Text>
+      ))}
+    </View>
+  );
+}
+
+function AttributedText() {
+  return (
+    <View style={{ width: 300 }}>
+      {paragraphs.slice(0, 100).map((paragraph, i) => (
+        <Text key={i} style={{ fontSize: 14 }}>
+          <Text style={{ fontWeight: 'bold' }}>{i}. </Text>
+          <Text style={{ color: 'blue' }}>{paragraph.slice(0, 20)}</Text>
+          <Text style={{ fontStyle: 'italic', fontSize: 18 }}>{paragraph.slice(20, 40)}</Text>
+          <Text style={{ textDecorationLine: 'underline' }}>{paragraph.slice(40, 60)}</Text>
+          <Text style={{ fontFamily: 'Consolas', backgroundColor: 'yellow' }}>{paragraph.slice(60)}</Text>
+          <Text style={{ letterSpacing: 2 }}> {languageSamples[(i + 3) % languageSamples.length]}</Text>
+        </Text>
+      ))}
+    </View>
+  );
+}
+
+function FittedText() {
+  return (
+    <View style={{ flexDirection: 'row', flexWrap: 'wrap' }}>
+      {paragraphs.slice(0, 100).map((paragraph, i) => (
+        <View key={i} style={{ width: 120, height: 40 }}>
+          <Text adjustsFontSizeToFit numberOfLines={2} style={{ fontSize: 24 }}>
+            {paragraph}
+          </Text>
+        </View>
+      ))}
+    </View>
+  );
+}
+
+function Images({ source, onSettled }) {
+  return (
+    <View style={{ flexDirection: 'row', flexWrap: 'wrap' }}>
+      {Array.from({ length: imageCount }, (_, i) => (
+        <Image
+          key={i}
+          source={{ uri: source }}
+          style={{ width: 128, height: 128 }}
+          onLoad={() => onSettled(true)}
+          onError={() => onSettled(false)}
+        />
+      ))}
+    </View>
+  );
+}
+
+function imageStep(format, size) {
+  return {
+    name: `image.${format}.${size}`,
+    imageCount,
+    render: onSettled => <Images source={imageSources[`${format}${size}`]} onSettled={onSettled} />,
+  };
+}
+
+// Each step is a single commit. A step is settled once it is committed and all of its images have loaded or failed.
+const steps = [
+  { name: 'text.plain.mount', render: () => <PlainText width={300} /> },
+  { name: 'text.plain.relayout', render: () => <PlainText width={200} /> },
+  { name: 'text.attributed.mount', render: () => <AttributedText /> },
+  { name: 'text.fitted.mount', render: () => <FittedText /> },
+  { name: 'text.unmount', render: () => null },
+  imageStep('png', 64),
+  imageStep('png', 512),
+  imageStep('png', 2048),
+  imageStep('jpeg', 64),
+  imageStep('jpeg', 512),
+  imageStep('jpeg', 2048),
+  { name: 'image.unmount', render: () => null },
+];
+
+function TextImageBenchmark() {
+  const [step, setStep] = React.useState(-1);
+  const progress = React.useRef(null);
+
+  const startStep = React.useCallback(next => {
+    progress.current = {
+      startTime: performance.now(),
+      commitMs: 0,
+      committed: false,
+      done: false,
+      loaded: 0,
+      failed: 0,
+    };
+    benchmark.stepStarted(steps[next % steps.length].name);
+    setStep(next);
+  }, []);
+
+  const completeStepIfSettled = React.useCallback(() => {
+    const current = progress.current;
+    const currentStep = steps[step % steps.length];
+    if (current.done || !current.committed || current.loaded + current.failed < (currentStep.imageCount ?? 0)) {
+      return;
+    }
+
+    current.done = true;
+    benchmark.stepCompleted(
+      currentStep.name,
+      current.commitMs,
+      performance.now() - current.startTime,
+      current.loaded,
+      current.failed,
+    );
+
+    const next = step + 1;
+    if (next === steps.length * iterations) {
+      benchmark.completed();
+      return;
+    }
+
+    // Let the previous commit be mounted before starting the next one
+    setTimeout(() => startStep(next), 0);
+  }, [step, startStep]);
+
+  const onImageSettled = React.useCallback(
+    loaded => {
+      if (loaded) {
+        progress.current.loaded++;
+      } else {
+        progress.current.failed++;
+      }
+      completeStepIfSettled();
+    },
+    [completeStepIfSettled],
+  );
+
+  React.useEffect(() => {
+    if (step < 0) {
+      startStep(0);
+      return;
+    }
+
+    progress.current.commitMs = performance.now() - progress.current.startTime;
+    progress.current.committed = true;
+    completeStepIfSettled();
+  }, [step, startStep, completeStepIfSettled]);
+
+  return step >= 0 ? steps[step % steps.length].render(onImageSettled) : null;
+}
+
+AppRegistry.registerComponent('TextImageBenchmark', () => TextImageBenchmark);
@@ -87,6 +87,23 @@ namespace Microsoft.ReactNative.Managed.CodeGen.UnitTests.CodeGen
       );
     }
 
+    [TestMethod]
+    public void ArrayAndStringFieldTypes()
+    {
+      TestCodeGen<INamedTypeSymbol>(@"
+        public struct MyStruct
+        {
+          public double[] Samples;
+          public long[] Ids;
+          public int[] Values;
+          public string Name;
+          public double[] SamplesProp { get; set; }
+        }
+        ",
+        (codeGen, symbol) => { return codeGen.CreateObjectSerializers(new[] {symbol}); }
+      );
+    }
+
     [TestMethod]
     public void NoStatics()
     {
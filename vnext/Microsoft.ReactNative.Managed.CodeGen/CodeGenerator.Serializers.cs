@@ -19,7 +19,9 @@ namespace Microsoft.ReactNative.Managed.CodeGen
   /// </summary>
   public partial class CodeGenerator
   {
-    internal IEnumerable<MemberDeclarationSyntax> CreateSerializers(IEnumerable<INamedTypeSymbol> typesToSerialize)
+    internal IEnumerable<MemberDeclarationSyntax> CreateSerializers(
+      IEnumerable<INamedTypeSymbol> typesToSerialize,
+      IDictionary<ITypeSymbol, IMethodSymbol>? jsReaderFunctions = null)
     {
       var classMembers = new List<MemberDeclarationSyntax>();
       var registrationCalls = new List<StatementSyntax>();
@@ -34,7 +36,7 @@ namespace Microsoft.ReactNative.Managed.CodeGen
             break;
           case TypeKind.Class:
           case TypeKind.Struct:
-            classMembers.Add(CreateObjectSerializers(group));
+            classMembers.Add(CreateObjectSerializers(group, jsReaderFunctions));
             registrationCalls.Add(InvocationStatement(ReactNativeNames.CreateObjectSerializers));
             break;
           default:
@@ -122,7 +124,9 @@ namespace Microsoft.ReactNative.Managed.CodeGen
             registrationCalls));
     }
 
-    internal MemberDeclarationSyntax CreateObjectSerializers(IEnumerable<INamedTypeSymbol> symbols)
+    internal MemberDeclarationSyntax CreateObjectSerializers(
+      IEnumerable<INamedTypeSymbol> symbols,
+      IDictionary<ITypeSymbol, IMethodSymbol>? jsReaderFunctions = null)
     {
       var registrationCalls = new List<StatementSyntax>();
 
@@ -141,6 +145,8 @@ namespace Microsoft.ReactNative.Managed.CodeGen
 
         // Generates either:
         //    case "Field1": value.Field1 = reader.ReadValue<Field1Type>(); break;
+        // or for the fields of the types with a non-generic JSValueReader.ReadValue overload:
+        //    case "Field1": JSValueReader.ReadValue(reader, out value.Field1); break;
         // and/or
         //     writer.WriteObjectProperty("Field2", value.Field2);
         // for each member
@@ -153,7 +159,8 @@ namespace Microsoft.ReactNative.Managed.CodeGen
 
           string name;
           string jsonPropertyName;
-          ISymbol type;
+          ITypeSymbol type;
+          bool isField;
           bool emitRead;
           bool emitWrite;
           if (!member.IsStatic && !member.IsExtern)
@@ -163,6 +170,7 @@ namespace Microsoft.ReactNative.Managed.CodeGen
               name = field.Name;
               jsonPropertyName = TryGetJSNameFromAttribute(field, out var jsName) ? jsName : name;
               type = field.Type;
+              isField = true;
               emitRead = !field.IsConst && !field.IsReadOnly;
               emitWrite = true;
             }
@@ -172,6 +180,7 @@ namespace Microsoft.ReactNative.Managed.CodeGen
               name = property.Name;
               jsonPropertyName = TryGetJSNameFromAttribute(property, out var jsName) ? jsName : name;
               type = property.Type;
+              isField = false;
               emitRead = !property.IsReadOnly;
               emitWrite = !property.IsWriteOnly;
             }
@@ -182,7 +191,8 @@ namespace Microsoft.ReactNative.Managed.CodeGen
 
             if (emitRead)
             {
-              readOperations.Add(ReadSwitch(name, jsonPropertyName, type));
+              bool readDirectly = isField && HasDirectReader(type, jsReaderFunctions);
+              readOperations.Add(ReadSwitch(name, jsonPropertyName, type, readDirectly));
             }
 
             if (emitWrite)
@@ -361,8 +371,76 @@ namespace Microsoft.ReactNative.Managed.CodeGen
       return jsName != null;
     }
 
-    private SwitchSectionSyntax ReadSwitch(string fieldName, string jsonPropertyName, ISymbol fieldType)
+    /// <summary>
+    /// Returns true if JSValueReader has a non-generic ReadValue overload for the type, and the assembly does not
+    /// register its own reader for it. The generated code can then read a field in place with that overload, instead
+    /// of a delegate call through JSValueReaderOf and a copy of the result.
+    /// The double[] and long[] overloads read the whole array with one IJSValueReader2 call when the reader supports it.
+    /// </summary>
+    private static bool HasDirectReader(ITypeSymbol type, IDictionary<ITypeSymbol, IMethodSymbol>? jsReaderFunctions)
     {
+      if (jsReaderFunctions != null && jsReaderFunctions.ContainsKey(type))
+      {
+        return false;
+      }
+
+      if (type is IArrayTypeSymbol arrayType)
+      {
+        return arrayType.IsSZArray
+          && (arrayType.ElementType.SpecialType == SpecialType.System_Double
+           || arrayType.ElementType.SpecialType == SpecialType.System_Int64);
+      }
+
+      switch (type.SpecialType)
+      {
+        case SpecialType.System_Boolean:
+        case SpecialType.System_SByte:
+        case SpecialType.System_Int16:
+        case SpecialType.System_Int32:
+        case SpecialType.System_Int64:
+        case SpecialType.System_Byte:
+        case SpecialType.System_UInt16:
+        case SpecialType.System_UInt32:
+        case SpecialType.System_UInt64:
+        case SpecialType.System_Single:
+        case SpecialType.System_Double:
+        case SpecialType.System_String:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+    private SwitchSectionSyntax ReadSwitch(string fieldName, string jsonPropertyName, ISymbol fieldType, bool readDirectly)
+    {
+      if (readDirectly)
+      {
+        // Generates:
+        //   JSValueReader.ReadValue(reader, out value.Field);
+        return SwitchSection(
+          new SyntaxList<SwitchLabelSyntax>(
+            CaseSwitchLabel(LiteralExpression(jsonPropertyName))
+          ),
+          new SyntaxList<StatementSyntax>(
+            new StatementSyntax[]
+            {
+              InvocationStatement(
+                MemberAccessExpression(ReactTypes.JSValueReader, ReactNativeNames.ReadValueMethodName),
+                new[]
+                {
+                  Argument(IdentifierName(ReactNativeNames.ReaderLocalName)),
+                  Argument(
+                    MemberAccessExpression(
+                      SyntaxKind.SimpleMemberAccessExpression,
+                      IdentifierName(ReactNativeNames.ValueLocalName),
+                      IdentifierName(fieldName)))
+                    .WithRefOrOutKeyword(Token(SyntaxKind.OutKeyword)),
+                }),
+              BreakStatement()
+            })
+        );
+      }
+
       return SwitchSection(
         new SyntaxList<SwitchLabelSyntax>(
           CaseSwitchLabel(LiteralExpression(jsonPropertyName))
@@ -44,7 +44,7 @@ namespace Microsoft.ReactNative.Managed.CodeGen
       if (assembly.SerializableTypes.Any())
       {
         registrationInvocations.Add(InvocationStatement(ReactNativeNames.CreateSerializers));
-        providerMembers.AddRange(CreateSerializers(assembly.SerializableTypes.Keys));
+        providerMembers.AddRange(CreateSerializers(assembly.SerializableTypes.Keys, assembly.JSReaderFunctions));
       }
 
       if (assembly.JSReaderFunctions.Any())
@@ -474,5 +474,46 @@ namespace Microsoft.ReactNative.Managed.UnitTests
       Assert.AreEqual(3.14, jValue["FloatValue"]);
       Assert.AreEqual(JTokenType.Null, jValue["NullValue"].Type);
     }
+
+    [TestMethod]
+    public void TestReadWriteNumberArrays()
+    {
+      // The reader and writer do not implement IJSValueReader2 and IJSValueWriter2, so the items are read one by one
+      JObject jobj = JObject.Parse(@"{
+                Doubles: [1, 2.5, ""3""],
+                Longs: [4, 5.5],
+                NotArray: 42
+            }");
+      IJSValueReader reader = new JTokenJSValueReader(jobj);
+      double[] doubles = null;
+      long[] longs = null;
+      double[] notArray = null;
+      while (reader.GetNextObjectProperty(out string propertyName))
+      {
+        switch (propertyName)
+        {
+          case "Doubles": reader.ReadValue(out doubles); break;
+          case "Longs": reader.ReadValue(out longs); break;
+          case "NotArray": reader.ReadValue(out notArray); break;
+        }
+      }
+
+      CollectionAssert.AreEqual(new double[] { 1, 2.5, 3 }, doubles);
+      CollectionAssert.AreEqual(new long[] { 4, 5 }, longs);
+      Assert.AreEqual(0, notArray.Length);
+
+      var writer = new JTokenJSValueWriter();
+      writer.WriteObjectBegin();
+      writer.WriteObjectProperty("Doubles", doubles);
+      writer.WriteObjectProperty("Longs", longs);
+      writer.WriteObjectProperty("Null", (double[])null);
+      writer.WriteObjectEnd();
+      JToken jValue = writer.TakeValue();
+
+      Assert.AreEqual(2.5, jValue["Doubles"][1]);
+      Assert.AreEqual(3, (jValue["Doubles"] as JArray).Count);
+      Assert.AreEqual(5, jValue["Longs"][1]);
+      Assert.AreEqual(JTokenType.Null, jValue["Null"].Type);
+    }
   }
 }
@@ -375,6 +375,31 @@ namespace Microsoft.ReactNative.Managed.UnitTests
       m_builder.EmitJSEvent(eventEmitterName, eventName, paramsArgWriter);
     }
 
+    public void WriteDispatchQueueMetrics(IJSValueWriter writer)
+    {
+      throw new NotImplementedException();
+    }
+
+    public void WriteNativeModuleProfile(IJSValueWriter writer)
+    {
+      throw new NotImplementedException();
+    }
+
+    public Windows.Foundation.IAsyncAction StartSamplingProfiler()
+    {
+      throw new NotImplementedException();
+    }
+
+    public Windows.Foundation.IAsyncAction StopSamplingProfiler(string filePath)
+    {
+      throw new NotImplementedException();
+    }
+
+    public Windows.Foundation.IAsyncAction CaptureHeapSnapshot(string filePath)
+    {
+      throw new NotImplementedException();
+    }
+
     public LoadingState LoadingState { get { throw new NotImplementedException(); } }
   }
 }
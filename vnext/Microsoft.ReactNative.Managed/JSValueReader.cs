@@ -203,6 +203,25 @@ namespace Microsoft.ReactNative.Managed
       value = new ReadOnlyCollection<JSValue>(JSValue.ReadArrayFrom(reader));
     }
 
+    public static void ReadValue(this IJSValueReader reader, out double[] value)
+    {
+      // Readers that support it return the whole array with one call
+      if (!(reader is IJSValueReader2 reader2) || !reader2.TryGetDoubleArray(out value))
+      {
+        ReadValue(reader, out List<double> list);
+        value = list.ToArray();
+      }
+    }
+
+    public static void ReadValue(this IJSValueReader reader, out long[] value)
+    {
+      if (!(reader is IJSValueReader2 reader2) || !reader2.TryGetInt64Array(out value))
+      {
+        ReadValue(reader, out List<long> list);
+        value = list.ToArray();
+      }
+    }
+
     public static void ReadValue<T>(this IJSValueReader reader, out T? value) where T : struct
     {
       if (reader.ValueType != JSValueType.Null)
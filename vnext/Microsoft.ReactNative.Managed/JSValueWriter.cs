@@ -74,6 +74,31 @@ namespace Microsoft.ReactNative.Managed
       writer.WriteDouble(value);
     }
 
+    public static void WriteValue(this IJSValueWriter writer, double[] value)
+    {
+      // Writers that support it take the whole array with one call
+      if (value != null && writer is IJSValueWriter2 writer2)
+      {
+        writer2.WriteDoubleArray(value);
+      }
+      else
+      {
+        writer.WriteValue<double>(value);
+      }
+    }
+
+    public static void WriteValue(this IJSValueWriter writer, long[] value)
+    {
+      if (value != null && writer is IJSValueWriter2 writer2)
+      {
+        writer2.WriteInt64Array(value);
+      }
+      else
+      {
+        writer.WriteValue<long>(value);
+      }
+    }
+
     public static void WriteValue(this IJSValueWriter writer, JSValue value)
     {
       value.WriteTo(writer);
@@ -220,7 +245,21 @@ namespace Microsoft.ReactNative.Managed
 
     public static void WriteValue<T>(this IJSValueWriter writer, List<T> value)
     {
-      writer.WriteValue(value as IEnumerable<T>);
+      // Index the list to avoid the boxed enumerator of IEnumerable<T>
+      if (value != null)
+      {
+        writer.WriteArrayBegin();
+        for (int i = 0; i < value.Count; ++i)
+        {
+          writer.WriteValue(value[i]);
+        }
+
+        writer.WriteArrayEnd();
+      }
+      else
+      {
+        writer.WriteNull();
+      }
     }
 
     public static void WriteValue<T>(this IJSValueWriter writer, IList<T> value)
@@ -268,7 +307,21 @@ namespace Microsoft.ReactNative.Managed
 
     public static void WriteValue<T>(this IJSValueWriter writer, T[] value)
     {
-      writer.WriteValue(value as IEnumerable<T>);
+      // Index the array to avoid the boxed enumerator of IEnumerable<T>
+      if (value != null)
+      {
+        writer.WriteArrayBegin();
+        for (int i = 0; i < value.Length; ++i)
+        {
+          writer.WriteValue(value[i]);
+        }
+
+        writer.WriteArrayEnd();
+      }
+      else
+      {
+        writer.WriteNull();
+      }
     }
 
     public static void WriteValue<T1>(this IJSValueWriter writer, Tuple<T1> value)
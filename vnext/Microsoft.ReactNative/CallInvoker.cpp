@@ -23,6 +23,12 @@ void CallInvoker::InvokeAsync(CallFunc func) noexcept {
       [reactContext = m_context, func](facebook::jsi::Runtime & /*runtime*/) { func(reactContext->JsiRuntime()); });
 }
 
+void CallInvoker::InvokeAsyncWithPriority(CallInvokerPriority priority, CallFunc func) noexcept {
+  m_callInvoker->invokeAsync(
+      static_cast<facebook::react::SchedulerPriority>(priority),
+      [reactContext = m_context, func](facebook::jsi::Runtime & /*runtime*/) { func(reactContext->JsiRuntime()); });
+}
+
 void CallInvoker::InvokeSync(CallFunc func) noexcept {
   m_callInvoker->invokeSync(
       [reactContext = m_context, func](facebook::jsi::Runtime & /*runtime*/) { func(reactContext->JsiRuntime()); });
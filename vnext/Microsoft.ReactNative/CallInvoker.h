@@ -18,6 +18,7 @@ struct CallInvoker : CallInvokerT<CallInvoker> {
       std::shared_ptr<facebook::react::CallInvoker> callInvoker) noexcept;
 
   void InvokeAsync(CallFunc func) noexcept;
+  void InvokeAsyncWithPriority(CallInvokerPriority priority, CallFunc func) noexcept;
   void InvokeSync(CallFunc func) noexcept;
 
   static winrt::Microsoft::ReactNative::CallInvoker FromProperties(
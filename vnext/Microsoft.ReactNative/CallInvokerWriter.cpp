@@ -5,6 +5,8 @@
 #include "CallInvokerWriter.h"
 #include <JSI/JSIDynamic.h>
 #include <crash/verifyElseCrash.h>
+#include <dispatchQueue/dispatchQueueMetrics.h>
+#include <optional>
 
 namespace winrt::Microsoft::ReactNative {
 
@@ -14,9 +16,11 @@ namespace winrt::Microsoft::ReactNative {
 
 CallInvokerWriter::CallInvokerWriter(
     const std::shared_ptr<facebook::react::CallInvoker> &jsInvoker,
-    std::weak_ptr<LongLivedJsiRuntime> jsiRuntimeHolder) noexcept
+    std::weak_ptr<LongLivedJsiRuntime> jsiRuntimeHolder,
+    std::shared_ptr<const std::string> origin) noexcept
     : m_callInvoker(jsInvoker),
       m_jsiRuntimeHolder(std::move(jsiRuntimeHolder)),
+      m_origin(std::move(origin)),
       m_threadId(std::this_thread::get_id()) {}
 
 CallInvokerWriter::~CallInvokerWriter() {
@@ -34,6 +38,10 @@ void CallInvokerWriter::WithResultArgs(
       const facebook::jsi::Value *args{nullptr};
       size_t argCount{0};
       m_jsiWriter->AccessResultAsArgs(args, argCount);
+      if (m_onResultMarshaled) {
+        const auto now = std::chrono::steady_clock::now();
+        m_onResultMarshaled(now - m_firstWriteTime.value_or(now));
+      }
       handler(jsiRuntimeHolder->Runtime(), args, argCount);
       m_jsiWriter = nullptr;
     }
@@ -41,16 +49,29 @@ void CallInvokerWriter::WithResultArgs(
     VerifyElseCrash(!m_jsiWriter);
     folly::dynamic dynValue = m_dynamicWriter->TakeValue();
     VerifyElseCrash(dynValue.isArray());
-    m_callInvoker->invokeAsync(
-        [handler, dynValue = std::move(dynValue), weakJsiRuntimeHolder = m_jsiRuntimeHolder, self = get_strong()](
-            facebook::jsi::Runtime &runtime) {
-          std::vector<facebook::jsi::Value> args;
-          args.reserve(dynValue.size());
-          for (auto const &item : dynValue) {
-            args.emplace_back(facebook::jsi::valueFromDynamic(runtime, item));
-          }
-          handler(runtime, args.data(), args.size());
-        });
+    std::optional<Mso::DispatchQueueMetrics::OriginScope> originScope;
+    if (m_origin) {
+      originScope.emplace(*m_origin);
+    }
+    const auto writeTime = m_firstWriteTime ? std::chrono::steady_clock::now() - *m_firstWriteTime
+                                            : std::chrono::steady_clock::duration::zero();
+    m_callInvoker->invokeAsync([handler,
+                                dynValue = std::move(dynValue),
+                                weakJsiRuntimeHolder = m_jsiRuntimeHolder,
+                                self = get_strong(),
+                                onResultMarshaled = m_onResultMarshaled,
+                                writeTime](facebook::jsi::Runtime &runtime) {
+      const auto conversionStartTime = std::chrono::steady_clock::now();
+      std::vector<facebook::jsi::Value> args;
+      args.reserve(dynValue.size());
+      for (auto const &item : dynValue) {
+        args.emplace_back(facebook::jsi::valueFromDynamic(runtime, item));
+      }
+      if (onResultMarshaled) {
+        onResultMarshaled(writeTime + (std::chrono::steady_clock::now() - conversionStartTime));
+      }
+      handler(runtime, args.data(), args.size());
+    });
   }
 }
 
@@ -94,8 +115,27 @@ void CallInvokerWriter::WriteArrayEnd() noexcept {
   GetWriter().WriteArrayEnd();
 }
 
+void CallInvokerWriter::WriteDoubleArray(array_view<double const> values) noexcept {
+  GetWriter().as<IJSValueWriter2>().WriteDoubleArray(values);
+}
+
+void CallInvokerWriter::WriteInt64Array(array_view<int64_t const> values) noexcept {
+  GetWriter().as<IJSValueWriter2>().WriteInt64Array(values);
+}
+
+void CallInvokerWriter::WriteUtf8String(array_view<uint8_t const> value) noexcept {
+  GetWriter().as<IJSValueWriter2>().WriteUtf8String(value);
+}
+
+void CallInvokerWriter::WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept {
+  GetWriter().as<IJSValueWriter2>().WriteArrayBuffer(buffer);
+}
+
 IJSValueWriter CallInvokerWriter::GetWriter() noexcept {
   if (!m_writer) {
+    if (m_onResultMarshaled) {
+      m_firstWriteTime = std::chrono::steady_clock::now();
+    }
     if (m_threadId == std::this_thread::get_id() && m_fastPath) {
       if (auto jsiRuntimeHolder = m_jsiRuntimeHolder.lock()) {
         m_jsiWriter = winrt::make_self<JsiWriter>(jsiRuntimeHolder->Runtime());
@@ -116,6 +156,15 @@ void CallInvokerWriter::ExitCurrentCallInvokeScope() noexcept {
   m_fastPath = false;
 }
 
+void CallInvokerWriter::OnResultMarshaled(
+    Mso::Functor<void(std::chrono::steady_clock::duration)> &&callback) noexcept {
+  m_onResultMarshaled = std::move(callback);
+}
+
+std::optional<std::chrono::steady_clock::time_point> CallInvokerWriter::FirstWriteTime() const noexcept {
+  return m_firstWriteTime;
+}
+
 //===========================================================================
 // JSNoopWriter implementation
 //===========================================================================
@@ -130,5 +179,9 @@ void JSNoopWriter::WritePropertyName(const winrt::hstring & /*name*/) noexcept {
 void JSNoopWriter::WriteObjectEnd() noexcept {}
 void JSNoopWriter::WriteArrayBegin() noexcept {}
 void JSNoopWriter::WriteArrayEnd() noexcept {}
+void JSNoopWriter::WriteDoubleArray(array_view<double const> /*values*/) noexcept {}
+void JSNoopWriter::WriteInt64Array(array_view<int64_t const> /*values*/) noexcept {}
+void JSNoopWriter::WriteUtf8String(array_view<uint8_t const> /*value*/) noexcept {}
+void JSNoopWriter::WriteArrayBuffer(const Windows::Storage::Streams::IBuffer & /*buffer*/) noexcept {}
 
 } // namespace winrt::Microsoft::ReactNative
@@ -9,16 +9,20 @@
 #include "JsiWriter.h"
 #include "winrt/Microsoft.ReactNative.h"
 
+#include <chrono>
+#include <optional>
+
 namespace winrt::Microsoft::ReactNative {
 
 // IJSValueWriter to ensure that JsiWriter is always used from a RuntimeExecutor.
 // In case if writing is done outside of RuntimeExecutor, it uses DynamicWriter to create
 // folly::dynamic which then is written to JsiWriter in RuntimeExecutor.
-struct CallInvokerWriter : winrt::implements<CallInvokerWriter, IJSValueWriter> {
+struct CallInvokerWriter : winrt::implements<CallInvokerWriter, IJSValueWriter, IJSValueWriter2> {
   ~CallInvokerWriter();
   CallInvokerWriter(
       const std::shared_ptr<facebook::react::CallInvoker> &jsInvoker,
-      std::weak_ptr<LongLivedJsiRuntime> jsiRuntimeHolder) noexcept;
+      std::weak_ptr<LongLivedJsiRuntime> jsiRuntimeHolder,
+      std::shared_ptr<const std::string> origin = nullptr) noexcept;
   void WithResultArgs(Mso::Functor<void(facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t argCount)>
                           handler) noexcept;
 
@@ -34,16 +38,30 @@ struct CallInvokerWriter : winrt::implements<CallInvokerWriter, IJSValueWriter>
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJSValueWriter2
+  void WriteDoubleArray(array_view<double const> values) noexcept;
+  void WriteInt64Array(array_view<int64_t const> values) noexcept;
+  void WriteUtf8String(array_view<uint8_t const> value) noexcept;
+  void WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept;
+
   // This should be called before the code flow exits the scope of the CallInvoker,
   // thus requiring the CallInokerWriter to call m_callInvoker->invokeAsync to call back into JS.
   void ExitCurrentCallInvokeScope() noexcept;
 
+  // Reports the time from the first write of the result until its JSI values are passed to the handler of
+  // WithResultArgs, which includes converting them on the JS thread when they were written on another thread
+  void OnResultMarshaled(Mso::Functor<void(std::chrono::steady_clock::duration)> &&callback) noexcept;
+  // When the result was first written, only known once OnResultMarshaled is set
+  std::optional<std::chrono::steady_clock::time_point> FirstWriteTime() const noexcept;
+
  private:
   IJSValueWriter GetWriter() noexcept;
 
  private:
   const std::shared_ptr<facebook::react::CallInvoker> m_callInvoker;
   std::weak_ptr<LongLivedJsiRuntime> m_jsiRuntimeHolder;
+  // The module method that the JS task calling back is attributed to in the dispatch queue metrics
+  const std::shared_ptr<const std::string> m_origin;
   winrt::com_ptr<DynamicWriter> m_dynamicWriter;
   winrt::com_ptr<JsiWriter> m_jsiWriter;
   IJSValueWriter m_writer;
@@ -53,11 +71,14 @@ struct CallInvokerWriter : winrt::implements<CallInvokerWriter, IJSValueWriter>
   // RuntimeExecutor callback, then we need to save the callback args in a dynamic and post it back to the CallInvoker
   bool m_fastPath{true};
   const std::thread::id m_threadId;
+
+  Mso::Functor<void(std::chrono::steady_clock::duration)> m_onResultMarshaled;
+  std::optional<std::chrono::steady_clock::time_point> m_firstWriteTime;
 };
 
 // Special IJSValueWriter that does nothing.
 // We use it instead of JsiWriter when JSI runtime is not available anymore.
-struct JSNoopWriter : winrt::implements<JSNoopWriter, IJSValueWriter> {
+struct JSNoopWriter : winrt::implements<JSNoopWriter, IJSValueWriter, IJSValueWriter2> {
  public: // IJSValueWriter
   void WriteNull() noexcept;
   void WriteBoolean(bool value) noexcept;
@@ -69,6 +90,12 @@ struct JSNoopWriter : winrt::implements<JSNoopWriter, IJSValueWriter> {
   void WriteObjectEnd() noexcept;
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
+
+ public: // IJSValueWriter2
+  void WriteDoubleArray(array_view<double const> values) noexcept;
+  void WriteInt64Array(array_view<int64_t const> values) noexcept;
+  void WriteUtf8String(array_view<uint8_t const> value) noexcept;
+  void WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept;
 };
 
 } // namespace winrt::Microsoft::ReactNative
@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CompositorEventBeat.h"
+
+namespace Microsoft::ReactNative {
+
+CompositorEventBeat::CompositorEventBeat(
+    std::shared_ptr<facebook::react::EventBeat::OwnerBox> const ownerBox,
+    const winrt::Microsoft::ReactNative::ReactContext &context,
+    std::shared_ptr<facebook::react::RuntimeScheduler> runtimeScheduler,
+    winrt::Microsoft::UI::Composition::Compositor compositor,
+    std::function<bool()> isMountPending)
+    : EventBeat(ownerBox, *runtimeScheduler),
+      m_context(context),
+      m_compositor(std::move(compositor)),
+      m_isMountPending(std::move(isMountPending)) {}
+
+void CompositorEventBeat::request() const {
+  bool alreadyRequested = isEventBeatRequested_.exchange(true);
+  if (!alreadyRequested) {
+    auto uiDispatcher = m_context.UIDispatcher();
+    if (uiDispatcher.HasThreadAccess()) {
+      requestFrame();
+    } else {
+      uiDispatcher.Post([this, ownerBox = ownerBox_]() {
+        auto owner = ownerBox->owner.lock();
+        if (!owner) {
+          return;
+        }
+        requestFrame();
+      });
+    }
+  }
+}
+
+void CompositorEventBeat::requestFrame() const {
+  if (m_frameRequested) {
+    return;
+  }
+
+  m_frameRequested = true;
+  m_compositor.RequestCommitAsync().Completed(
+      [this, ownerBox = ownerBox_, uiDispatcher = m_context.UIDispatcher()](auto const &, auto const &) {
+        if (uiDispatcher.HasThreadAccess()) {
+          if (ownerBox->owner.lock()) {
+            onFrame();
+          }
+          return;
+        }
+
+        uiDispatcher.Post([this, ownerBox]() {
+          if (ownerBox->owner.lock()) {
+            onFrame();
+          }
+        });
+      });
+}
+
+void CompositorEventBeat::onFrame() const {
+  m_frameRequested = false;
+  if (m_isMountPending && m_isMountPending()) {
+    requestFrame();
+    return;
+  }
+  induce();
+}
+
+} // namespace Microsoft::ReactNative
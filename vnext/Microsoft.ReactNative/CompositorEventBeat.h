@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <NativeModules.h>
+#include <react/renderer/core/EventBeat.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <winrt/Microsoft.UI.Composition.h>
+#include <functional>
+
+namespace Microsoft::ReactNative {
+
+// Like AsynchronousEventBeat, but events are flushed as the compositor commits a frame, rather than as soon as the UI
+// thread gets to them.  The events that arrive during a frame are then dispatched together, once per refresh of the
+// display whatever its rate is.
+class CompositorEventBeat final : public facebook::react::EventBeat {
+ public:
+  // isMountPending is called on the UI thread.  While it returns true, the flush waits for the next frame, as the
+  // commits it would cause could not be mounted before the pending one anyway.
+  CompositorEventBeat(
+      std::shared_ptr<facebook::react::EventBeat::OwnerBox> const ownerBox,
+      const winrt::Microsoft::ReactNative::ReactContext &context,
+      std::shared_ptr<facebook::react::RuntimeScheduler> runtimeScheduler,
+      winrt::Microsoft::UI::Composition::Compositor compositor,
+      std::function<bool()> isMountPending);
+
+  void request() const override;
+
+ private:
+  void requestFrame() const;
+  void onFrame() const;
+
+  winrt::Microsoft::ReactNative::ReactContext m_context;
+  winrt::Microsoft::UI::Composition::Compositor m_compositor;
+  std::function<bool()> m_isMountPending;
+  mutable bool m_frameRequested{false}; // Only used on the UI thread
+};
+
+} // namespace Microsoft::ReactNative
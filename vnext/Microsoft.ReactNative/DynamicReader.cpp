@@ -30,6 +30,12 @@ namespace winrt::Microsoft::ReactNative {
 
 DynamicReader::DynamicReader(const folly::dynamic &root) noexcept : m_current{&root} {}
 
+void DynamicReader::Reset(const folly::dynamic &root) noexcept {
+  m_current = &root;
+  m_isIterating = false;
+  m_stack.clear();
+}
+
 JSValueType DynamicReader::ValueType() noexcept {
   switch (m_current->type()) {
     case folly::dynamic::Type::NULLT:
@@ -149,4 +155,68 @@ double DynamicReader::GetDouble() noexcept {
   return (m_current->type() == folly::dynamic::Type::DOUBLE) ? m_current->getDouble() : 0;
 }
 
+bool DynamicReader::TryGetDoubleArray(com_array<double> &values) noexcept {
+  if (!IsUnreadArray()) {
+    return false;
+  }
+
+  com_array<double> result(static_cast<uint32_t>(m_current->size()));
+  for (uint32_t i = 0; i < result.size(); ++i) {
+    const auto &item = (*m_current)[i];
+    if (item.type() == folly::dynamic::Type::DOUBLE) {
+      result[i] = item.getDouble();
+    } else if (item.type() == folly::dynamic::Type::INT64) {
+      result[i] = static_cast<double>(item.getInt());
+    } else {
+      return false;
+    }
+  }
+
+  values = std::move(result);
+  m_isIterating = !m_stack.empty();
+  return true;
+}
+
+bool DynamicReader::TryGetInt64Array(com_array<int64_t> &values) noexcept {
+  if (!IsUnreadArray()) {
+    return false;
+  }
+
+  com_array<int64_t> result(static_cast<uint32_t>(m_current->size()));
+  for (uint32_t i = 0; i < result.size(); ++i) {
+    const auto &item = (*m_current)[i];
+    if (item.type() == folly::dynamic::Type::INT64) {
+      result[i] = item.getInt();
+    } else if (item.type() == folly::dynamic::Type::DOUBLE &&
+               static_cast<int64_t>(item.getDouble()) == item.getDouble()) {
+      // The same test for integers as in ValueType
+      result[i] = static_cast<int64_t>(item.getDouble());
+    } else {
+      return false;
+    }
+  }
+
+  values = std::move(result);
+  m_isIterating = !m_stack.empty();
+  return true;
+}
+
+com_array<uint8_t> DynamicReader::GetUtf8String() noexcept {
+  if (m_current->type() != folly::dynamic::Type::STRING) {
+    return {};
+  }
+  const auto &value = m_current->getString();
+  auto data = reinterpret_cast<const uint8_t *>(value.data());
+  return com_array<uint8_t>(data, data + value.size());
+}
+
+Windows::Storage::Streams::IBuffer DynamicReader::TryGetArrayBuffer(bool /*isBorrowed*/) noexcept {
+  // folly::dynamic has no binary type
+  return nullptr;
+}
+
+bool DynamicReader::IsUnreadArray() const noexcept {
+  return !m_isIterating && m_current->type() == folly::dynamic::Type::ARRAY;
+}
+
 } // namespace winrt::Microsoft::ReactNative
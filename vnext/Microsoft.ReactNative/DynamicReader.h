@@ -8,9 +8,12 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct DynamicReader : implements<DynamicReader, IJSValueReader> {
+struct DynamicReader : implements<DynamicReader, IJSValueReader, IJSValueReader2> {
   DynamicReader(const folly::dynamic &root) noexcept;
 
+  // Starts reading another value, so that one reader can be used for many values
+  void Reset(const folly::dynamic &root) noexcept;
+
  public: // IJSValueReader
   JSValueType ValueType() noexcept;
   bool GetNextObjectProperty(hstring &propertyName) noexcept;
@@ -20,6 +23,12 @@ struct DynamicReader : implements<DynamicReader, IJSValueReader> {
   int64_t GetInt64() noexcept;
   double GetDouble() noexcept;
 
+ public: // IJSValueReader2
+  bool TryGetDoubleArray(com_array<double> &values) noexcept;
+  bool TryGetInt64Array(com_array<int64_t> &values) noexcept;
+  com_array<uint8_t> GetUtf8String() noexcept;
+  Windows::Storage::Streams::IBuffer TryGetArrayBuffer(bool isBorrowed) noexcept;
+
  private:
   struct StackEntry {
     static StackEntry ObjectProperty(
@@ -34,6 +43,8 @@ struct DynamicReader : implements<DynamicReader, IJSValueReader> {
 
  private:
   void SetCurrentValue(const folly::dynamic *value) noexcept;
+  // Returns true when the current value is an array that is not read yet
+  bool IsUnreadArray() const noexcept;
 
  private:
   const folly::dynamic *m_current{nullptr};
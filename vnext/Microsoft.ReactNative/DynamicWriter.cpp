@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "DynamicWriter.h"
+#include <winrt/Windows.Storage.Streams.h>
 #include <crash/verifyElseCrash.h>
 
 namespace winrt::Microsoft::ReactNative {
@@ -124,6 +125,38 @@ void DynamicWriter::WriteArrayEnd() noexcept {
   VerifyElseCrash(false);
 }
 
+void DynamicWriter::WriteDoubleArray(array_view<double const> values) noexcept {
+  folly::dynamic array = folly::dynamic::array();
+  array.reserve(values.size());
+  for (double value : values) {
+    array.push_back(value);
+  }
+  WriteValue(std::move(array));
+}
+
+void DynamicWriter::WriteInt64Array(array_view<int64_t const> values) noexcept {
+  folly::dynamic array = folly::dynamic::array();
+  array.reserve(values.size());
+  for (int64_t value : values) {
+    array.push_back(value);
+  }
+  WriteValue(std::move(array));
+}
+
+void DynamicWriter::WriteUtf8String(array_view<uint8_t const> value) noexcept {
+  WriteValue(folly::dynamic{std::string{reinterpret_cast<const char *>(value.data()), value.size()}});
+}
+
+void DynamicWriter::WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept {
+  // folly::dynamic has no binary type
+  folly::dynamic array = folly::dynamic::array();
+  array.reserve(buffer.Length());
+  for (uint8_t value : array_view<uint8_t const>{buffer.data(), buffer.Length()}) {
+    array.push_back(value);
+  }
+  WriteValue(std::move(array));
+}
+
 void DynamicWriter::WriteValue(folly::dynamic &&value) noexcept {
   if (m_state == State::PropertyValue) {
     m_dynamic[std::move(m_propertyName)] = std::move(value);
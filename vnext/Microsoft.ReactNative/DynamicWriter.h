@@ -7,7 +7,7 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct DynamicWriter : winrt::implements<DynamicWriter, IJSValueWriter> {
+struct DynamicWriter : winrt::implements<DynamicWriter, IJSValueWriter, IJSValueWriter2> {
   folly::dynamic TakeValue() noexcept;
 
  public: // IJSValueWriter
@@ -22,6 +22,12 @@ struct DynamicWriter : winrt::implements<DynamicWriter, IJSValueWriter> {
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJSValueWriter2
+  void WriteDoubleArray(array_view<double const> values) noexcept;
+  void WriteInt64Array(array_view<int64_t const> values) noexcept;
+  void WriteUtf8String(array_view<uint8_t const> value) noexcept;
+  void WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept;
+
  public:
   static folly::dynamic ToDynamic(JSValueArgWriter const &argWriter) noexcept;
 
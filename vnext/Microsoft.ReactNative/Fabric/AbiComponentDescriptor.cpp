@@ -106,14 +106,18 @@ facebook::react::Props::Shared AbiComponentDescriptor::cloneProps(
                     : nullptr);
   shadowNodeProps->SetUserProps(userProps);
 
+  UserPropsDelivery delivery(
+      userProps,
+      props ? static_cast<winrt::Microsoft::ReactNative::implementation::AbiProps const &>(*props).UserPropValues()
+            : nullptr);
   const auto &dynamic = static_cast<folly::dynamic>(rawProps);
   for (const auto &pair : dynamic.items()) {
     const auto &propName = pair.first.getString();
     auto hash = RAW_PROPS_KEY_HASH(propName);
     shadowNodeProps.get()->setProp(context, hash, propName.c_str(), facebook::react::RawValue(pair.second));
-    userProps.SetProp(
-        hash, winrt::to_hstring(propName), winrt::make<winrt::Microsoft::ReactNative::DynamicReader>(pair.second));
+    delivery.SetProp(hash, propName, pair.second);
   }
+  shadowNodeProps->SetUserPropValues(delivery.DeliveredValues());
 
   return shadowNodeProps;
 };
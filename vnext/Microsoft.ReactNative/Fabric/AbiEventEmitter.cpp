@@ -6,16 +6,26 @@
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
+static facebook::react::ValueFactory AbiPayloadFactory(const winrt::Microsoft::ReactNative::JSValueArgWriter &args) {
+  return [args](facebook::jsi::Runtime &runtime) {
+    auto writer = winrt::make<JsiWriter>(runtime);
+    args(writer);
+    return winrt::get_self<JsiWriter>(writer)->MoveResult();
+  };
+}
+
 EventEmitter::EventEmitter(facebook::react::EventEmitter::Shared const &eventEmitter) : m_eventEmitter(eventEmitter) {}
 
 void EventEmitter::DispatchEvent(
     winrt::hstring eventName,
     const winrt::Microsoft::ReactNative::JSValueArgWriter &args) {
-  m_eventEmitter->dispatchEvent(winrt::to_string(eventName), [args](facebook::jsi::Runtime &runtime) {
-    auto writer = winrt::make<JsiWriter>(runtime);
-    args(writer);
-    return winrt::get_self<JsiWriter>(writer)->MoveResult();
-  });
+  m_eventEmitter->dispatchEvent(winrt::to_string(eventName), AbiPayloadFactory(args));
+}
+
+void EventEmitter::DispatchUniqueEvent(
+    winrt::hstring eventName,
+    const winrt::Microsoft::ReactNative::JSValueArgWriter &args) {
+  m_eventEmitter->dispatchUniqueEvent(winrt::to_string(eventName), AbiPayloadFactory(args));
 }
 
 } // namespace winrt::Microsoft::ReactNative::implementation
@@ -15,6 +15,7 @@ struct EventEmitter : EventEmitterT<EventEmitter> {
   EventEmitter(facebook::react::EventEmitter::Shared const &eventEmitter);
 
   void DispatchEvent(winrt::hstring eventName, const winrt::Microsoft::ReactNative::JSValueArgWriter &args);
+  void DispatchUniqueEvent(winrt::hstring eventName, const winrt::Microsoft::ReactNative::JSValueArgWriter &args);
 
  private:
   facebook::react::EventEmitter::Shared const m_eventEmitter;
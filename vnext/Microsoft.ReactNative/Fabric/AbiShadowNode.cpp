@@ -27,6 +27,14 @@ winrt::Microsoft::ReactNative::IComponentProps AbiProps::UserProps() const noexc
   return m_componentProps;
 }
 
+void AbiProps::SetUserPropValues(std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> values) noexcept {
+  m_userPropValues = std::move(values);
+}
+
+const std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> &AbiProps::UserPropValues() const noexcept {
+  return m_userPropValues;
+}
+
 ShadowNode::ShadowNode(std::shared_ptr<const facebook::react::ShadowNode> shadowNode) noexcept
     : m_shadowNode(shadowNode) {}
 
@@ -29,8 +29,12 @@ class AbiProps final : public facebook::react::Props {
   void SetUserProps(winrt::Microsoft::ReactNative::IComponentProps componentProps) noexcept;
   winrt::Microsoft::ReactNative::IComponentProps UserProps() const noexcept;
 
+  void SetUserPropValues(std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> values) noexcept;
+  const std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> &UserPropValues() const noexcept;
+
  private:
   winrt::Microsoft::ReactNative::IComponentProps m_componentProps{nullptr};
+  std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> m_userPropValues;
 };
 
 struct ShadowNode : ShadowNodeT<ShadowNode> {
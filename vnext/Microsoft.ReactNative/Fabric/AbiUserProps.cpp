@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "AbiUserProps.h"
+
+#include <mutex>
+#include "DynamicReader.h"
+
+namespace Microsoft::ReactNative {
+
+// Prop names converted to hstrings once per process, keyed by their hash.  The name is compared as well, so a hash
+// collision only costs a conversion.
+static winrt::hstring InternedPropName(facebook::react::RawPropsPropNameHash hash, const std::string &propName) {
+  static std::mutex s_mutex;
+  static std::unordered_map<facebook::react::RawPropsPropNameHash, std::pair<std::string, winrt::hstring>> s_names;
+
+  std::scoped_lock lock{s_mutex};
+  auto [it, inserted] = s_names.try_emplace(hash);
+  if (inserted) {
+    it->second = {propName, winrt::to_hstring(propName)};
+  } else if (it->second.first != propName) {
+    return winrt::to_hstring(propName);
+  }
+  return it->second.second;
+}
+
+UserPropsDelivery::UserPropsDelivery(
+    winrt::Microsoft::ReactNative::IComponentProps userProps,
+    std::shared_ptr<const UserPropValues> deliveredValues) noexcept
+    : m_userProps(std::move(userProps)), m_deliveredValues(std::move(deliveredValues)) {}
+
+UserPropsDelivery::~UserPropsDelivery() = default;
+
+void UserPropsDelivery::SetProp(
+    facebook::react::RawPropsPropNameHash hash,
+    const std::string &propName,
+    const folly::dynamic &value) {
+  if (m_deliveredValues) {
+    if (auto it = m_deliveredValues->find(hash); it != m_deliveredValues->end() && *it->second == value) {
+      return;
+    }
+  }
+
+  if (!m_reader) {
+    m_reader = winrt::make_self<winrt::Microsoft::ReactNative::DynamicReader>(value);
+  } else {
+    m_reader->Reset(value);
+  }
+  m_userProps.SetProp(hash, InternedPropName(hash, propName), *m_reader);
+
+  if (!m_updatedValues) {
+    m_updatedValues =
+        m_deliveredValues ? std::make_shared<UserPropValues>(*m_deliveredValues) : std::make_shared<UserPropValues>();
+  }
+  (*m_updatedValues)[hash] = std::make_shared<const folly::dynamic>(value);
+}
+
+std::shared_ptr<const UserPropValues> UserPropsDelivery::DeliveredValues() const noexcept {
+  return m_updatedValues ? m_updatedValues : m_deliveredValues;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <folly/dynamic.h>
+#include <react/renderer/core/RawProps.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "winrt/Microsoft.ReactNative.h"
+
+namespace winrt::Microsoft::ReactNative {
+struct DynamicReader;
+} // namespace winrt::Microsoft::ReactNative
+
+namespace Microsoft::ReactNative {
+
+// Raw values of the custom props delivered to an IComponentProps.  Props cloned from each other share the same values
+// until one of them changes.
+using UserPropValues = std::unordered_map<facebook::react::RawPropsPropNameHash, std::shared_ptr<const folly::dynamic>>;
+
+// Delivers raw props to the IComponentProps of a custom component through IComponentProps::SetProp.
+// IComponentProps are cloned from the props of the previous shadow node, so props whose value did not change since they
+// were delivered to those props are skipped.  All props are read through a single reader.
+class UserPropsDelivery {
+ public:
+  UserPropsDelivery(
+      winrt::Microsoft::ReactNative::IComponentProps userProps,
+      std::shared_ptr<const UserPropValues> deliveredValues) noexcept;
+  ~UserPropsDelivery();
+
+  void SetProp(facebook::react::RawPropsPropNameHash hash, const std::string &propName, const folly::dynamic &value);
+
+  // Values delivered to the props so far, including those delivered to the props they were cloned from
+  std::shared_ptr<const UserPropValues> DeliveredValues() const noexcept;
+
+ private:
+  winrt::Microsoft::ReactNative::IComponentProps m_userProps;
+  std::shared_ptr<const UserPropValues> m_deliveredValues;
+  // Copy of m_deliveredValues, made when the first changed value is delivered
+  std::shared_ptr<UserPropValues> m_updatedValues;
+  winrt::com_ptr<winrt::Microsoft::ReactNative::DynamicReader> m_reader;
+};
+
+} // namespace Microsoft::ReactNative
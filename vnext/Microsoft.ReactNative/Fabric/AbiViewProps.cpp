@@ -43,6 +43,14 @@ winrt::Microsoft::ReactNative::ViewProps AbiViewProps::ViewProps() const noexcep
   return m_innerProps;
 }
 
+void AbiViewProps::SetUserPropValues(std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> values) noexcept {
+  m_userPropValues = std::move(values);
+}
+
+const std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> &AbiViewProps::UserPropValues() const noexcept {
+  return m_userPropValues;
+}
+
 } // namespace Microsoft::ReactNative
 
 namespace winrt::Microsoft::ReactNative::implementation {
@@ -11,6 +11,7 @@
 #include <react/renderer/components/view/ViewProps.h>
 #include <react/renderer/imagemanager/primitives.h>
 #include "winrt/Microsoft.ReactNative.Composition.Experimental.h"
+#include "AbiUserProps.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace Microsoft::ReactNative {
@@ -30,9 +31,13 @@ class AbiViewProps final : public facebook::react::ViewProps {
   winrt::Microsoft::ReactNative::IComponentProps UserProps() const noexcept;
   winrt::Microsoft::ReactNative::ViewProps ViewProps() const noexcept;
 
+  void SetUserPropValues(std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> values) noexcept;
+  const std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> &UserPropValues() const noexcept;
+
  private:
   winrt::Microsoft::ReactNative::IComponentProps m_userProps{nullptr};
   winrt::Microsoft::ReactNative::ViewProps m_innerProps{nullptr};
+  std::shared_ptr<const ::Microsoft::ReactNative::UserPropValues> m_userPropValues;
 };
 
 } // namespace Microsoft::ReactNative
@@ -9,6 +9,7 @@
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/conversions.h>
 
+#include <algorithm>
 #include <utility>
 
 namespace winrt::Microsoft::ReactNative::implementation {
@@ -33,9 +34,55 @@ namespace Microsoft::ReactNative {
 
 extern const char AbiViewComponentName[] = "AbiView";
 
+AbiViewShadowNode::AbiViewShadowNode(
+    const facebook::react::ShadowNode &sourceShadowNode,
+    const facebook::react::ShadowNodeFragment &fragment)
+    : ConcreteViewShadowNode(sourceShadowNode, fragment),
+      m_measureCache(static_cast<const AbiViewShadowNode &>(sourceShadowNode).m_measureCache) {}
+
 facebook::react::Size AbiViewShadowNode::measureContent(
     const facebook::react::LayoutContext &layoutContext,
     const facebook::react::LayoutConstraints &layoutConstraints) const {
+  auto builder =
+      winrt::get_self<winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder>(m_builder);
+  if (!builder->MeasureContentHandler() || !builder->IsMeasureContentPure()) {
+    return measureContentUncached(layoutContext, layoutConstraints);
+  }
+
+  if (!m_measureCache) {
+    m_measureCache = std::make_shared<MeasureCache>();
+  }
+
+  const auto &props = getProps();
+  const auto &state = getState();
+  auto matches = [&](const MeasureCache::Entry &entry) {
+    return entry.Constraints == layoutConstraints && entry.PointScaleFactor == layoutContext.pointScaleFactor &&
+        entry.FontSizeMultiplier == layoutContext.fontSizeMultiplier && entry.WeakProps.lock() == props &&
+        entry.WeakState.lock() == state;
+  };
+
+  {
+    std::scoped_lock lock{m_measureCache->Mutex};
+    for (size_t i = 0; i < m_measureCache->Count; i++) {
+      if (matches(m_measureCache->Entries[i])) {
+        return m_measureCache->Entries[i].Size;
+      }
+    }
+  }
+
+  auto size = measureContentUncached(layoutContext, layoutConstraints);
+
+  std::scoped_lock lock{m_measureCache->Mutex};
+  m_measureCache->Entries[m_measureCache->Next] = {
+      props, state, layoutConstraints, layoutContext.pointScaleFactor, layoutContext.fontSizeMultiplier, size};
+  m_measureCache->Next = (m_measureCache->Next + 1) % MeasureCache::Capacity;
+  m_measureCache->Count = std::min(m_measureCache->Count + 1, MeasureCache::Capacity);
+  return size;
+}
+
+facebook::react::Size AbiViewShadowNode::measureContentUncached(
+    const facebook::react::LayoutContext &layoutContext,
+    const facebook::react::LayoutConstraints &layoutConstraints) const {
   if (auto measureContent =
           winrt::get_self<winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder>(m_builder)
               ->MeasureContentHandler()) {
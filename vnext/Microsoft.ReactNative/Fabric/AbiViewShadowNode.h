@@ -13,7 +13,10 @@
 #include "AbiViewProps.h"
 
 #include <react/renderer/components/view/ConcreteViewShadowNode.h>
+#include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
+#include <array>
+#include <mutex>
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
@@ -68,6 +71,11 @@ class AbiViewShadowNode final : public facebook::react::ConcreteViewShadowNode<
  public:
   using ConcreteViewShadowNode::ConcreteViewShadowNode;
 
+  // Clones share the measure cache of their source
+  AbiViewShadowNode(
+      const facebook::react::ShadowNode &sourceShadowNode,
+      const facebook::react::ShadowNodeFragment &fragment);
+
   facebook::react::Size measureContent(
       const facebook::react::LayoutContext &layoutContext,
       const facebook::react::LayoutConstraints &layoutConstraints) const override;
@@ -80,6 +88,31 @@ class AbiViewShadowNode final : public facebook::react::ConcreteViewShadowNode<
   winrt::Microsoft::ReactNative::ShadowNode Proxy() const noexcept;
 
  private:
+  // Sizes returned by a pure MeasureContentHandler, see IReactViewComponentBuilder::IsMeasureContentPure.
+  // Props and state are held weakly, so an entry cannot match new props or state allocated at the same address.
+  struct MeasureCache {
+    static constexpr size_t Capacity = 8;
+
+    struct Entry {
+      std::weak_ptr<const facebook::react::Props> WeakProps;
+      std::weak_ptr<const facebook::react::State> WeakState;
+      facebook::react::LayoutConstraints Constraints;
+      float PointScaleFactor{0};
+      float FontSizeMultiplier{0};
+      facebook::react::Size Size;
+    };
+
+    std::mutex Mutex;
+    std::array<Entry, Capacity> Entries;
+    size_t Count{0};
+    size_t Next{0};
+  };
+
+  facebook::react::Size measureContentUncached(
+      const facebook::react::LayoutContext &layoutContext,
+      const facebook::react::LayoutConstraints &layoutConstraints) const;
+
+  mutable std::shared_ptr<MeasureCache> m_measureCache;
   winrt::Microsoft::ReactNative::ShadowNode m_proxy{nullptr};
   winrt::Microsoft::ReactNative::IReactViewComponentBuilder m_builder{nullptr};
 };
@@ -0,0 +1,315 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "AnimatedImage.h"
+
+#include <shcore.h>
+#include <algorithm>
+#include <optional>
+
+extern "C" HRESULT WINAPI WICCreateImagingFactory_Proxy(UINT SDKVersion, IWICImagingFactory **ppIWICImagingFactory);
+
+namespace Microsoft::ReactNative {
+
+// Frames decoded ahead of the one shown.  Animations with fewer frames keep all of them, and are only decoded once.
+constexpr size_t MaxBufferedFrames = 8;
+
+// GIF frame delays are in hundredths of a second
+constexpr UINT DelayUnitMs = 10;
+// Like browsers, frames without a delay, or with a delay too short to be shown, are shown for 100ms
+constexpr UINT MinDelayMs = 20;
+constexpr UINT DefaultDelayMs = 100;
+
+// GIF disposal methods, which say what happens to the area of a frame before the next frame is drawn
+constexpr UINT DisposeToBackground = 2;
+constexpr UINT DisposeToPrevious = 3;
+
+static std::optional<UINT> ReadMetadataUInt(IWICMetadataQueryReader *reader, LPCWSTR name) noexcept {
+  PROPVARIANT value;
+  PropVariantInit(&value);
+  std::optional<UINT> result;
+  if (SUCCEEDED(reader->GetMetadataByName(name, &value))) {
+    if (value.vt == VT_UI1) {
+      result = value.bVal;
+    } else if (value.vt == VT_UI2) {
+      result = value.uiVal;
+    } else if (value.vt == VT_UI4) {
+      result = value.ulVal;
+    }
+  }
+  PropVariantClear(&value);
+  return result;
+}
+
+static winrt::com_ptr<IWICMetadataQueryReader> FrameMetadata(IWICBitmapFrameDecode *frame) noexcept {
+  winrt::com_ptr<IWICMetadataQueryReader> reader;
+  if (FAILED(frame->GetMetadataQueryReader(reader.put()))) {
+    return nullptr;
+  }
+  return reader;
+}
+
+std::shared_ptr<AnimatedImage> AnimatedImage::TryCreate(std::shared_ptr<const std::vector<uint8_t>> body) {
+  winrt::com_ptr<IWICImagingFactory> imagingFactory;
+  winrt::check_hresult(WICCreateImagingFactory_Proxy(WINCODEC_SDK_VERSION, imagingFactory.put()));
+
+  winrt::com_ptr<IWICStream> wicStream;
+  winrt::check_hresult(imagingFactory->CreateStream(wicStream.put()));
+  winrt::check_hresult(
+      wicStream->InitializeFromMemory(const_cast<uint8_t *>(body->data()), static_cast<DWORD>(body->size())));
+
+  return TryCreate(imagingFactory, wicStream.as<IStream>(), std::move(body));
+}
+
+std::shared_ptr<AnimatedImage> AnimatedImage::TryCreate(
+    const winrt::Windows::Storage::Streams::IRandomAccessStream &stream) {
+  winrt::com_ptr<IWICImagingFactory> imagingFactory;
+  winrt::check_hresult(WICCreateImagingFactory_Proxy(WINCODEC_SDK_VERSION, imagingFactory.put()));
+
+  winrt::com_ptr<IStream> istream;
+  winrt::check_hresult(
+      CreateStreamOverRandomAccessStream(stream.as<IUnknown>().get(), __uuidof(IStream), istream.put_void()));
+
+  // The decoder holds on to the stream it reads from
+  return TryCreate(imagingFactory, istream, nullptr);
+}
+
+std::shared_ptr<AnimatedImage> AnimatedImage::TryCreate(
+    const winrt::com_ptr<IWICImagingFactory> &imagingFactory,
+    const winrt::com_ptr<IStream> &istream,
+    std::shared_ptr<const void> data) {
+  winrt::com_ptr<IWICBitmapDecoder> decoder;
+  if (FAILED(imagingFactory->CreateDecoderFromStream(
+          istream.get(), nullptr, WICDecodeMetadataCacheOnDemand, decoder.put()))) {
+    return nullptr;
+  }
+
+  // Other formats with several frames, like icons and TIFFs, hold alternative images rather than an animation
+  GUID containerFormat;
+  if (FAILED(decoder->GetContainerFormat(&containerFormat)) ||
+      (containerFormat != GUID_ContainerFormatGif && containerFormat != GUID_ContainerFormatWebp)) {
+    return nullptr;
+  }
+
+  UINT frameCount = 0;
+  if (FAILED(decoder->GetFrameCount(&frameCount)) || frameCount < 2) {
+    return nullptr;
+  }
+
+  std::shared_ptr<AnimatedImage> image{new AnimatedImage(imagingFactory, std::move(decoder), std::move(data))};
+  image->m_frameCount = frameCount;
+  image->readFrameDelays();
+  image->m_firstFrame = image->decodeFrame(0);
+  image->m_frames.emplace(0, image->m_firstFrame);
+  image->m_shownFrame = image->m_firstFrame;
+  return image;
+}
+
+AnimatedImage::AnimatedImage(
+    winrt::com_ptr<IWICImagingFactory> imagingFactory,
+    winrt::com_ptr<IWICBitmapDecoder> decoder,
+    std::shared_ptr<const void> data)
+    : m_imagingFactory(std::move(imagingFactory)), m_decoder(std::move(decoder)), m_data(std::move(data)) {}
+
+UINT AnimatedImage::width() const noexcept {
+  return m_width;
+}
+
+UINT AnimatedImage::height() const noexcept {
+  return m_height;
+}
+
+const winrt::com_ptr<IWICBitmap> &AnimatedImage::firstFrame() const noexcept {
+  return m_firstFrame;
+}
+
+size_t AnimatedImage::bufferByteSize() const noexcept {
+  return static_cast<size_t>(m_width) * m_height * 4 * std::min<size_t>(MaxBufferedFrames, m_frameCount);
+}
+
+void AnimatedImage::readFrameDelays() {
+  // The frames of a GIF are drawn onto its logical screen, which can be larger than any of the frames
+  if (auto reader = winrt::com_ptr<IWICMetadataQueryReader>{};
+      SUCCEEDED(m_decoder->GetMetadataQueryReader(reader.put()))) {
+    m_width = ReadMetadataUInt(reader.get(), L"/logscrdesc/Width").value_or(0);
+    m_height = ReadMetadataUInt(reader.get(), L"/logscrdesc/Height").value_or(0);
+  }
+
+  std::chrono::milliseconds loopTime{0};
+  for (UINT index = 0; index < m_frameCount; index++) {
+    winrt::com_ptr<IWICBitmapFrameDecode> frame;
+    winrt::check_hresult(m_decoder->GetFrame(index, frame.put()));
+    if (index == 0 && (!m_width || !m_height)) {
+      winrt::check_hresult(frame->GetSize(&m_width, &m_height));
+    }
+
+    UINT delayMs = DefaultDelayMs;
+    if (auto reader = FrameMetadata(frame.get())) {
+      if (auto delay = ReadMetadataUInt(reader.get(), L"/grctlext/Delay")) {
+        delayMs = *delay * DelayUnitMs >= MinDelayMs ? *delay * DelayUnitMs : DefaultDelayMs;
+      }
+    }
+    loopTime += std::chrono::milliseconds(delayMs);
+    m_frameEnds.push_back(loopTime);
+  }
+}
+
+winrt::com_ptr<IWICBitmap> AnimatedImage::decodeFrame(UINT index) {
+  const UINT stride = m_width * 4;
+  auto clear = [this, stride](const WICRect &rect) {
+    for (INT y = rect.Y; y < rect.Y + rect.Height; y++) {
+      std::fill_n(m_canvas.begin() + y * stride + rect.X * 4, rect.Width * 4, uint8_t{0});
+    }
+  };
+
+  // Frames are composed onto what the previous frames left on the canvas, which starts out transparent
+  if (index == 0) {
+    m_canvas.assign(static_cast<size_t>(stride) * m_height, 0);
+  } else if (m_disposal.method == DisposeToBackground) {
+    clear(m_disposal.rect);
+  } else if (m_disposal.method == DisposeToPrevious && !m_savedCanvas.empty()) {
+    m_canvas.swap(m_savedCanvas);
+  }
+
+  winrt::com_ptr<IWICBitmapFrameDecode> frame;
+  winrt::check_hresult(m_decoder->GetFrame(index, frame.put()));
+  UINT frameWidth = 0, frameHeight = 0;
+  winrt::check_hresult(frame->GetSize(&frameWidth, &frameHeight));
+
+  UINT left = 0, top = 0;
+  m_disposal = {};
+  if (auto reader = FrameMetadata(frame.get())) {
+    left = ReadMetadataUInt(reader.get(), L"/imgdesc/Left").value_or(0);
+    top = ReadMetadataUInt(reader.get(), L"/imgdesc/Top").value_or(0);
+    m_disposal.method = ReadMetadataUInt(reader.get(), L"/grctlext/Disposal").value_or(0);
+  }
+  left = std::min(left, m_width);
+  top = std::min(top, m_height);
+  m_disposal.rect = {
+      static_cast<INT>(left),
+      static_cast<INT>(top),
+      static_cast<INT>(std::min(frameWidth, m_width - left)),
+      static_cast<INT>(std::min(frameHeight, m_height - top))};
+  if (m_disposal.method == DisposeToPrevious) {
+    m_savedCanvas = m_canvas;
+  }
+
+  winrt::com_ptr<IWICFormatConverter> converter;
+  winrt::check_hresult(m_imagingFactory->CreateFormatConverter(converter.put()));
+  winrt::check_hresult(converter->Initialize(
+      frame.get(), GUID_WICPixelFormat32bppPBGRA, WICBitmapDitherTypeNone, nullptr, 0.0f, WICBitmapPaletteTypeCustom));
+  const UINT frameStride = frameWidth * 4;
+  m_framePixels.resize(static_cast<size_t>(frameStride) * frameHeight);
+  winrt::check_hresult(converter->CopyPixels(
+      nullptr, frameStride, static_cast<UINT>(m_framePixels.size()), m_framePixels.data()));
+
+  // Draws the premultiplied frame over the canvas
+  const auto &rect = m_disposal.rect;
+  for (INT y = 0; y < rect.Height; y++) {
+    const uint8_t *source = m_framePixels.data() + y * frameStride;
+    uint8_t *target = m_canvas.data() + (rect.Y + y) * stride + rect.X * 4;
+    for (INT x = 0; x < rect.Width; x++, source += 4, target += 4) {
+      const uint8_t alpha = source[3];
+      if (alpha == 255) {
+        std::copy_n(source, 4, target);
+      } else if (alpha) {
+        for (int channel = 0; channel < 4; channel++) {
+          target[channel] = static_cast<uint8_t>(source[channel] + target[channel] * (255 - alpha) / 255);
+        }
+      }
+    }
+  }
+  m_nextFrame = (index + 1) % m_frameCount;
+
+  winrt::com_ptr<IWICBitmap> bitmap;
+  winrt::check_hresult(m_imagingFactory->CreateBitmapFromMemory(
+      m_width,
+      m_height,
+      GUID_WICPixelFormat32bppPBGRA,
+      stride,
+      static_cast<UINT>(m_canvas.size()),
+      m_canvas.data(),
+      bitmap.put()));
+  return bitmap;
+}
+
+bool AnimatedImage::inWindowLocked(UINT index) const noexcept {
+  return (index + m_frameCount - m_shownIndex) % m_frameCount < MaxBufferedFrames;
+}
+
+winrt::com_ptr<IWICBitmap> AnimatedImage::frameAt(
+    std::chrono::steady_clock::time_point time,
+    std::chrono::milliseconds &untilNextFrame) noexcept {
+  bool startDecoding = false;
+  winrt::com_ptr<IWICBitmap> frame;
+  {
+    std::scoped_lock lock{m_mutex};
+    if (!m_started) {
+      m_started = true;
+      m_startTime = time;
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(time - m_startTime) % m_frameEnds.back();
+    m_shownIndex = static_cast<UINT>(
+        std::upper_bound(m_frameEnds.begin(), m_frameEnds.end(), elapsed) - m_frameEnds.begin());
+    untilNextFrame = m_frameEnds[m_shownIndex] - elapsed;
+
+    // Frames the animation has moved past are released, to make room for the frames after the one shown
+    for (auto it = m_frames.begin(); it != m_frames.end();) {
+      it = inWindowLocked(it->first) ? std::next(it) : m_frames.erase(it);
+    }
+    if (auto it = m_frames.find(m_shownIndex); it != m_frames.end()) {
+      m_shownFrame = it->second;
+    }
+    frame = m_shownFrame;
+
+    if (!m_decoding && !m_decodeFailed && m_frames.size() < std::min<size_t>(MaxBufferedFrames, m_frameCount)) {
+      m_decoding = true;
+      startDecoding = true;
+    }
+  }
+
+  if (startDecoding) {
+    DecodeFramesAsync(shared_from_this());
+  }
+  return frame;
+}
+
+winrt::fire_and_forget AnimatedImage::DecodeFramesAsync(std::shared_ptr<AnimatedImage> self) {
+  co_await winrt::resume_background();
+
+  // Frames have to be decoded in order, since each is composed onto the previous ones.  Frames the animation has
+  // already moved past, when decoding falls behind, are decoded but not kept.
+  while (true) {
+    UINT index;
+    {
+      std::scoped_lock lock{self->m_mutex};
+      if (self->m_frames.size() >= std::min<size_t>(MaxBufferedFrames, self->m_frameCount)) {
+        self->m_decoding = false;
+        break;
+      }
+      index = self->m_nextFrame;
+    }
+
+    winrt::com_ptr<IWICBitmap> frame;
+    try {
+      frame = self->decodeFrame(index);
+    } catch (winrt::hresult_error const &) {
+    }
+
+    std::scoped_lock lock{self->m_mutex};
+    if (!frame) {
+      // The animation keeps showing the frames it has
+      self->m_decodeFailed = true;
+      self->m_decoding = false;
+      break;
+    }
+    if (self->inWindowLocked(index)) {
+      self->m_frames.insert_or_assign(index, std::move(frame));
+    }
+  }
+}
+
+} // namespace Microsoft::ReactNative
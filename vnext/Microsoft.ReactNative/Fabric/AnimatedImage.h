@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <wincodec.h>
+#include <winrt/Windows.Storage.Streams.h>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// The frames of an animated GIF or WebP image.  Frames are decoded, and composed onto the canvas of the image, in order
+// on a background thread, which keeps a bounded number of frames decoded ahead of the frame that is shown.
+// The animation plays on a clock shared by every view showing it, so views showing the same image, which share the
+// ImageResponseImage from the DecodedImageCache, also share its decoded frames.
+class AnimatedImage final : public std::enable_shared_from_this<AnimatedImage> {
+ public:
+  // Return nullptr when the image is not animated.  The decoder reads the body in place, so it is held on to.
+  static std::shared_ptr<AnimatedImage> TryCreate(std::shared_ptr<const std::vector<uint8_t>> body);
+  static std::shared_ptr<AnimatedImage> TryCreate(const winrt::Windows::Storage::Streams::IRandomAccessStream &stream);
+
+  // Size of the canvas the frames are composed onto
+  UINT width() const noexcept;
+  UINT height() const noexcept;
+
+  const winrt::com_ptr<IWICBitmap> &firstFrame() const noexcept;
+
+  // Memory held by the decoded frames, at most
+  size_t bufferByteSize() const noexcept;
+
+  // Returns the frame shown at the time, or the latest frame shown when its frame is not decoded yet, and sets
+  // untilNextFrame to the time until the next frame is due
+  winrt::com_ptr<IWICBitmap> frameAt(
+      std::chrono::steady_clock::time_point time,
+      std::chrono::milliseconds &untilNextFrame) noexcept;
+
+ private:
+  struct Disposal {
+    UINT method{0};
+    WICRect rect{};
+  };
+
+  AnimatedImage(
+      winrt::com_ptr<IWICImagingFactory> imagingFactory,
+      winrt::com_ptr<IWICBitmapDecoder> decoder,
+      std::shared_ptr<const void> data);
+
+  static std::shared_ptr<AnimatedImage> TryCreate(
+      const winrt::com_ptr<IWICImagingFactory> &imagingFactory,
+      const winrt::com_ptr<IStream> &istream,
+      std::shared_ptr<const void> data);
+
+  void readFrameDelays();
+  bool inWindowLocked(UINT index) const noexcept;
+  winrt::com_ptr<IWICBitmap> decodeFrame(UINT index);
+  static winrt::fire_and_forget DecodeFramesAsync(std::shared_ptr<AnimatedImage> self);
+
+  const winrt::com_ptr<IWICImagingFactory> m_imagingFactory;
+  const winrt::com_ptr<IWICBitmapDecoder> m_decoder;
+  // Keeps the data the decoder reads from alive
+  const std::shared_ptr<const void> m_data;
+  UINT m_frameCount{0};
+  UINT m_width{0};
+  UINT m_height{0};
+  // The time into the loop at which each frame ends
+  std::vector<std::chrono::milliseconds> m_frameEnds;
+  winrt::com_ptr<IWICBitmap> m_firstFrame;
+
+  // Composition state, only used by the frame decoding
+  std::vector<uint8_t> m_canvas;
+  std::vector<uint8_t> m_savedCanvas;
+  std::vector<uint8_t> m_framePixels;
+  Disposal m_disposal;
+  UINT m_nextFrame{0};
+
+  std::mutex m_mutex;
+  std::map<UINT, winrt::com_ptr<IWICBitmap>> m_frames;
+  winrt::com_ptr<IWICBitmap> m_shownFrame;
+  UINT m_shownIndex{0};
+  std::chrono::steady_clock::time_point m_startTime;
+  bool m_started{false};
+  bool m_decoding{false};
+  bool m_decodeFailed{false};
+};
+
+} // namespace Microsoft::ReactNative
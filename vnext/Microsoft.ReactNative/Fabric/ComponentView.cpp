@@ -54,6 +54,8 @@ void ComponentView::MountChildComponentView(
     uint32_t index) noexcept {
   m_children.InsertAt(index, childComponentView);
   winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->parent(*this);
+  winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->m_indexInParent =
+      index;
   if (m_builder && m_builder->MountChildComponentViewHandler()) {
     m_builder->MountChildComponentViewHandler()(
         *this, winrt::make<MountChildComponentViewArgs>(childComponentView, index));
@@ -116,6 +118,70 @@ void ComponentView::Unmounted(winrt::event_token const &token) noexcept {
   m_unmountedEvent.remove(token);
 }
 
+void ComponentView::MountChildComponentViews(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  for (auto const &childComponentView : childComponentViews) {
+    MountChildComponentView(childComponentView, index++);
+  }
+}
+
+void ComponentView::UnmountChildComponentViews(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  // Unmount from the back, so that the indices of the remaining children in the run do not change
+  for (auto i = childComponentViews.size(); i > 0; i--) {
+    UnmountChildComponentView(childComponentViews[i - 1], index + i - 1);
+  }
+}
+
+void ComponentView::insertChildren(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  auto size = m_children.Size();
+  assert(index <= size);
+  if (index == size) {
+    for (auto const &childComponentView : childComponentViews) {
+      m_children.Append(childComponentView);
+    }
+  } else {
+    // Rebuild the vector once, rather than shifting all the following children for every InsertAt
+    std::vector<winrt::Microsoft::ReactNative::ComponentView> children(size + childComponentViews.size(), nullptr);
+    m_children.GetMany(0, winrt::array_view(children.data(), index));
+    std::copy(childComponentViews.begin(), childComponentViews.end(), children.begin() + index);
+    m_children.GetMany(index, winrt::array_view(children.data() + index + childComponentViews.size(), size - index));
+    m_children.ReplaceAll(children);
+  }
+
+  for (auto const &childComponentView : childComponentViews) {
+    auto child = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView);
+    child->parent(*this);
+    child->m_indexInParent = index++;
+  }
+}
+
+void ComponentView::removeChildren(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  auto size = m_children.Size();
+  auto count = childComponentViews.size();
+  assert(index + count <= size);
+  if (index + count == size) {
+    for (uint32_t i = 0; i < count; i++) {
+      m_children.RemoveAtEnd();
+    }
+  } else {
+    std::vector<winrt::Microsoft::ReactNative::ComponentView> children(size - count, nullptr);
+    m_children.GetMany(0, winrt::array_view(children.data(), index));
+    m_children.GetMany(index + count, winrt::array_view(children.data() + index, size - index - count));
+    m_children.ReplaceAll(children);
+  }
+
+  for (auto const &childComponentView : childComponentViews) {
+    winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->parent(nullptr);
+  }
+}
+
 MountChildComponentViewArgs::MountChildComponentViewArgs(
     const winrt::Microsoft::ReactNative::ComponentView &child,
     uint32_t index)
@@ -205,6 +271,9 @@ void ComponentView::updateLayoutMetrics(
     m_builder->UpdateLayoutMetricsHandler()(*this, newMetrics, oldMetrics);
   }
 
+  if (m_layoutMetrics.frame != layoutMetrics.frame) {
+    invalidateHitTestBounds();
+  }
   m_layoutMetrics = layoutMetrics;
 
   m_layoutMetricsChangedEvent(*this, winrt::make<LayoutMetricsChangedArgs>(newMetrics, oldMetrics));
@@ -235,7 +304,23 @@ void ComponentView::FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentView
   }
 }
 
-void ComponentView::prepareForRecycle() noexcept {}
+void ComponentView::prepareForRecycle() noexcept {
+  // The theme belongs to the island the view was mounted in, which may be gone by the time the view is reused. The view
+  // gets the theme of its new parent when it is mounted again, which calls onThemeChanged.
+  m_theme = nullptr;
+}
+
+bool ComponentView::isRecyclable() const noexcept {
+  // Views that have been handed out to external code (ABI components, UIA clients, event subscribers) may be
+  // referenced by their old identity, so they cannot safely be reused for another tag.
+  return !m_builder && !m_uiaProvider && !m_userData && !m_destroyingEvent && !m_mountedEvent && !m_unmountedEvent &&
+      !m_parent && m_children.Size() == 0;
+}
+
+void ComponentView::prepareForReuse(facebook::react::Tag tag) noexcept {
+  assert(!m_mounted);
+  m_tag = tag;
+}
 
 facebook::react::Props::Shared ComponentView::props() noexcept {
   assert(false);
@@ -277,7 +362,14 @@ void ComponentView::parent(const winrt::Microsoft::ReactNative::ComponentView &p
     auto oldRootView = rootComponentView();
     m_rootView = nullptr;
     auto oldParent = m_parent;
+    if (oldParent) {
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(oldParent)
+          ->invalidateHitTestBounds();
+    }
     m_parent = parent;
+    if (parent) {
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(parent)->invalidateHitTestBounds();
+    }
     if (!parent) {
       if (oldRootView && oldRootView->GetFocusedComponent() == *this) {
         oldRootView->TrySetFocusedComponent(
@@ -319,6 +411,8 @@ winrt::Microsoft::ReactNative::Composition::implementation::Theme *ComponentView
 
 void ComponentView::onThemeChanged() noexcept {}
 
+void ComponentView::rasterizeAtCurrentScale() noexcept {}
+
 // Run fn on all children of this node until fn returns true
 // returns true if the fn ever returned true
 bool ComponentView::runOnChildren(
@@ -342,6 +436,54 @@ bool ComponentView::runOnChildren(
   return false;
 }
 
+winrt::Microsoft::ReactNative::ComponentView ComponentView::edgeChild(bool first) const noexcept {
+  auto size = m_children.Size();
+  if (size == 0) {
+    return nullptr;
+  }
+  return m_children.GetAt(first ? 0 : size - 1);
+}
+
+winrt::Microsoft::ReactNative::ComponentView ComponentView::sibling(bool next) const noexcept {
+  if (!m_parent) {
+    return nullptr;
+  }
+
+  auto &siblings = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(m_parent)->m_children;
+  auto index = indexInParent();
+  if (next) {
+    return index + 1 < siblings.Size() ? siblings.GetAt(index + 1) : nullptr;
+  }
+  return index > 0 ? siblings.GetAt(index - 1) : nullptr;
+}
+
+// Tab navigation steps from sibling to sibling, so the cached index is checked first to avoid searching the
+// parent's children on every step.  A single mount or unmount of an earlier sibling shifts it by one.
+uint32_t ComponentView::indexInParent() const noexcept {
+  assert(m_parent);
+  auto &siblings = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(m_parent)->m_children;
+  auto size = siblings.Size();
+  auto isAt = [&siblings, size, this](uint32_t index) noexcept {
+    return index < size &&
+        winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(siblings.GetAt(index)) == this;
+  };
+
+  for (auto index : {m_indexInParent, m_indexInParent + 1, m_indexInParent - 1}) {
+    if (isAt(index)) {
+      return m_indexInParent = index;
+    }
+  }
+
+  for (uint32_t index = 0; index < size; index++) {
+    if (isAt(index)) {
+      return m_indexInParent = index;
+    }
+  }
+
+  assert(false);
+  return 0;
+}
+
 RECT ComponentView::getClientRect() const noexcept {
   assert(false);
   return {};
@@ -642,6 +784,33 @@ facebook::react::Tag ComponentView::hitTest(
   return -1;
 }
 
+facebook::react::Rect ComponentView::hitTestBounds() const noexcept {
+  if (!m_hitTestBounds) {
+    // Children are hit tested relative to the origin of the view, and can be hit outside of its frame
+    auto bounds = m_layoutMetrics.frame;
+    for (const auto &child : m_children) {
+      auto childBounds =
+          winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(child)->hitTestBounds();
+      childBounds.origin.x += m_layoutMetrics.frame.origin.x;
+      childBounds.origin.y += m_layoutMetrics.frame.origin.y;
+      bounds.unionInPlace(childBounds);
+    }
+    m_hitTestBounds = bounds;
+  }
+  return *m_hitTestBounds;
+}
+
+void ComponentView::invalidateHitTestBounds() noexcept {
+  // Not stopping at views without cached bounds, since views that override hitTestBounds do not cache any
+  for (auto view = this;;) {
+    view->m_hitTestBounds.reset();
+    if (!view->m_parent) {
+      break;
+    }
+    view = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(view->m_parent);
+  }
+}
+
 struct CreateAutomationPeerArgs
     : public winrt::Microsoft::ReactNative::implementation::CreateAutomationPeerArgsT<CreateAutomationPeerArgs> {
   CreateAutomationPeerArgs(winrt::Windows::Foundation::IInspectable defaultAutomationPeer)
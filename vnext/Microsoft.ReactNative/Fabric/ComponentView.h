@@ -98,6 +98,10 @@ struct ComponentView
       facebook::react::LayoutMetrics const &layoutMetrics,
       facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept;
   virtual void prepareForRecycle() noexcept;
+  // Returns true if this view can be handed out again for a different tag once it has been recycled.
+  virtual bool isRecyclable() const noexcept;
+  // Called when a recycled view is dequeued again to represent a new tag
+  void prepareForReuse(facebook::react::Tag tag) noexcept;
   virtual facebook::react::Props::Shared props() noexcept;
   virtual winrt::Microsoft::ReactNative::Composition::implementation::RootComponentView *rootComponentView()
       const noexcept;
@@ -108,9 +112,15 @@ struct ComponentView
   virtual void theme(winrt::Microsoft::ReactNative::Composition::implementation::Theme *theme) noexcept;
   virtual winrt::Microsoft::ReactNative::Composition::implementation::Theme *theme() const noexcept;
   virtual void onThemeChanged() noexcept;
+  // Redraws the content that the view kept at its previous scale factor, see DpiRasterizationQueue
+  virtual void rasterizeAtCurrentScale() noexcept;
   // Run fn on all children of this node until fn returns true
   // returns true if the fn ever returned true
   bool runOnChildren(bool forward, Mso::Functor<bool(ComponentView &)> &fn) noexcept;
+  // The first or last child of this node, or nullptr if it has no children
+  winrt::Microsoft::ReactNative::ComponentView edgeChild(bool first) const noexcept;
+  // The sibling after or before this node in its parent, or nullptr at either end
+  winrt::Microsoft::ReactNative::ComponentView sibling(bool next) const noexcept;
   virtual RECT getClientRect() const noexcept;
   winrt::Windows::Foundation::Point ScreenToLocal(winrt::Windows::Foundation::Point pt) noexcept;
   winrt::Windows::Foundation::Point LocalToScreen(winrt::Windows::Foundation::Point pt) noexcept;
@@ -207,6 +217,10 @@ struct ComponentView
   // If ignorePointerEvents = true, all Components are treated as valid targets
   virtual facebook::react::Tag
   hitTest(facebook::react::Point pt, facebook::react::Point &localPt, bool ignorePointerEvents = false) const noexcept;
+  // Bounds, in the coordinates of the parent, of every point at which hitTest can find this view or one of its
+  // children.  Parents skip hit testing children whose bounds do not contain the point, which makes the view tree a
+  // bounding volume hierarchy.  Cached until the layout of the subtree changes.
+  virtual facebook::react::Rect hitTestBounds() const noexcept;
   virtual winrt::Windows::Foundation::IInspectable EnsureUiaProvider() noexcept;
   virtual winrt::Windows::Foundation::IInspectable CreateAutomationProvider() noexcept;
   virtual std::optional<std::string> getAccessiblityValue() noexcept;
@@ -234,6 +248,15 @@ struct ComponentView
   virtual void UnmountChildComponentView(
       const winrt::Microsoft::ReactNative::ComponentView &childComponentView,
       uint32_t index) noexcept;
+  // Mounts a run of children at consecutive indices starting at index.  Equivalent to calling MountChildComponentView
+  // for each child in order, but allows implementations to update their children and visuals once for the whole run.
+  virtual void MountChildComponentViews(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept;
+  // Unmounts the run of children currently at consecutive indices starting at index.
+  virtual void UnmountChildComponentViews(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept;
   virtual void HandleCommand(const winrt::Microsoft::ReactNative::HandleCommandArgs &args) noexcept;
   virtual void FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentViewUpdateMask updateMask) noexcept;
   virtual void OnPointerEntered(
@@ -255,15 +278,31 @@ struct ComponentView
       const winrt::Microsoft::ReactNative::Composition::Input::CharacterReceivedRoutedEventArgs &args) noexcept;
 
  protected:
+  // Splice a run of children into or out of m_children, and update their parent.  No builder callbacks are made and
+  // the mounted state of the children is not changed.
+  void insertChildren(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept;
+  void removeChildren(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept;
+  // Drops the cached hitTestBounds of the view and its ancestors
+  void invalidateHitTestBounds() noexcept;
+  uint32_t indexInParent() const noexcept;
+
   winrt::com_ptr<winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder> m_builder;
   bool m_mounted : 1 {false};
-  const facebook::react::Tag m_tag;
+  facebook::react::Tag m_tag;
   winrt::Windows::Foundation::IInspectable m_userData;
   mutable winrt::Microsoft::ReactNative::Composition::implementation::RootComponentView *m_rootView{nullptr};
   mutable winrt::Microsoft::ReactNative::Composition::implementation::Theme *m_theme{nullptr};
   const winrt::Microsoft::ReactNative::ReactContext m_reactContext;
   winrt::Microsoft::ReactNative::ComponentView m_parent{nullptr};
+  // Index of this view in m_parent's children when it was last mounted or looked up.  Mounting or unmounting
+  // siblings can make it stale, so indexInParent verifies it before use.
+  mutable uint32_t m_indexInParent{0};
   facebook::react::LayoutMetrics m_layoutMetrics;
+  mutable std::optional<facebook::react::Rect> m_hitTestBounds;
   winrt::Windows::Foundation::Collections::IVector<winrt::Microsoft::ReactNative::ComponentView> m_children{
       winrt::single_threaded_vector<winrt::Microsoft::ReactNative::ComponentView>()};
   winrt::Windows::Foundation::IInspectable m_uiaProvider{nullptr};
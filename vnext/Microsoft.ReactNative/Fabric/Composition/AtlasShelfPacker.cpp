@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "AtlasShelfPacker.h"
+
+#include <algorithm>
+
+namespace Microsoft::ReactNative::Composition {
+
+AtlasShelfPacker::AtlasShelfPacker(int32_t width, int32_t height) noexcept : m_width(width), m_height(height) {}
+
+std::optional<RECT> AtlasShelfPacker::allocate(int32_t width, int32_t height) noexcept {
+  if (width <= 0 || height <= 0 || width > m_width || height > m_height) {
+    return std::nullopt;
+  }
+
+  auto shelfHeight = ((height + ShelfHeightGranularity - 1) / ShelfHeightGranularity) * ShelfHeightGranularity;
+
+  // Prefer shelves of exactly the right height, so that tall shelves are not filled with short rectangles
+  for (auto &shelf : m_shelves) {
+    if (shelf.height == shelfHeight) {
+      if (auto rect = allocateInShelf(shelf, width, height)) {
+        return rect;
+      }
+    }
+  }
+
+  if (m_nextShelfY + shelfHeight <= m_height) {
+    m_shelves.push_back(Shelf{m_nextShelfY, shelfHeight});
+    m_nextShelfY += shelfHeight;
+    return allocateInShelf(m_shelves.back(), width, height);
+  }
+
+  // The page is full of shelves, so reuse the smallest empty shelf that is tall enough
+  Shelf *emptyShelf = nullptr;
+  for (auto &shelf : m_shelves) {
+    if (shelf.allocationCount == 0 && shelf.height >= height && (!emptyShelf || shelf.height < emptyShelf->height)) {
+      emptyShelf = &shelf;
+    }
+  }
+  if (emptyShelf) {
+    return allocateInShelf(*emptyShelf, width, height);
+  }
+
+  // Finally, try any shelf that is tall enough
+  for (auto &shelf : m_shelves) {
+    if (shelf.height > shelfHeight) {
+      if (auto rect = allocateInShelf(shelf, width, height)) {
+        return rect;
+      }
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::optional<RECT> AtlasShelfPacker::allocateInShelf(Shelf &shelf, int32_t width, int32_t height) noexcept {
+  if (height > shelf.height) {
+    return std::nullopt;
+  }
+
+  int32_t x = -1;
+  auto it = std::find_if(
+      shelf.freeSpans.begin(), shelf.freeSpans.end(), [width](const Span &span) { return span.width >= width; });
+  if (it != shelf.freeSpans.end()) {
+    x = it->x;
+    it->x += width;
+    it->width -= width;
+    if (it->width == 0) {
+      shelf.freeSpans.erase(it);
+    }
+  } else if (shelf.nextX + width <= m_width) {
+    x = shelf.nextX;
+    shelf.nextX += width;
+  } else {
+    return std::nullopt;
+  }
+
+  shelf.allocationCount++;
+  m_allocationCount++;
+  return RECT{x, shelf.y, x + width, shelf.y + height};
+}
+
+void AtlasShelfPacker::free(const RECT &rect) noexcept {
+  auto shelfIt =
+      std::find_if(m_shelves.begin(), m_shelves.end(), [&rect](const Shelf &shelf) { return shelf.y == rect.top; });
+  assert(shelfIt != m_shelves.end());
+  if (shelfIt == m_shelves.end()) {
+    return;
+  }
+
+  auto &shelf = *shelfIt;
+  assert(shelf.allocationCount > 0);
+  shelf.allocationCount--;
+  m_allocationCount--;
+
+  if (shelf.allocationCount == 0) {
+    shelf.nextX = 0;
+    shelf.freeSpans.clear();
+    // Return empty shelves at the bottom of the page to the unused space, so that they can be reused at any height
+    while (!m_shelves.empty() && m_shelves.back().allocationCount == 0) {
+      m_nextShelfY = m_shelves.back().y;
+      m_shelves.pop_back();
+    }
+    return;
+  }
+
+  Span freed{static_cast<int32_t>(rect.left), static_cast<int32_t>(rect.right - rect.left)};
+  auto insertAt = std::lower_bound(
+      shelf.freeSpans.begin(), shelf.freeSpans.end(), freed.x, [](const Span &span, int32_t x) { return span.x < x; });
+  insertAt = shelf.freeSpans.insert(insertAt, freed);
+
+  // Coalesce with the following and preceding spans
+  if (auto next = insertAt + 1; next != shelf.freeSpans.end() && insertAt->x + insertAt->width == next->x) {
+    insertAt->width += next->width;
+    shelf.freeSpans.erase(next);
+  }
+  if (insertAt != shelf.freeSpans.begin()) {
+    auto previous = insertAt - 1;
+    if (previous->x + previous->width == insertAt->x) {
+      previous->width += insertAt->width;
+      insertAt = shelf.freeSpans.erase(insertAt) - 1;
+    }
+  }
+
+  // A span that ends at the shelf's cursor is returned to the unused end of the shelf
+  if (insertAt->x + insertAt->width == shelf.nextX) {
+    shelf.nextX = insertAt->x;
+    shelf.freeSpans.erase(insertAt);
+  }
+}
+
+} // namespace Microsoft::ReactNative::Composition
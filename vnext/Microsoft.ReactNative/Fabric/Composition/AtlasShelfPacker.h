@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+namespace Microsoft::ReactNative::Composition {
+
+// Sub-allocates rectangles from a fixed size atlas page.  The page is split into shelves, horizontal strips whose
+// height is a multiple of ShelfHeightGranularity, which are filled left to right.  Rectangles of similar height share
+// a shelf, which keeps the waste low for text, where most rectangles are a line or two high.
+// Freed space is reused by later allocations that fit in the same shelf, and a shelf whose rectangles have all been
+// freed can be reused for any height up to its own.
+class AtlasShelfPacker final {
+ public:
+  static constexpr int32_t ShelfHeightGranularity = 8;
+
+  AtlasShelfPacker(int32_t width, int32_t height) noexcept;
+
+  // Returns std::nullopt when there is no space left for the rectangle
+  std::optional<RECT> allocate(int32_t width, int32_t height) noexcept;
+
+  // The rect must have been returned by allocate, and not already be freed
+  void free(const RECT &rect) noexcept;
+
+  bool empty() const noexcept {
+    return m_allocationCount == 0;
+  }
+
+ private:
+  struct Span {
+    int32_t x;
+    int32_t width;
+  };
+
+  struct Shelf {
+    int32_t y;
+    int32_t height;
+    int32_t nextX{0};
+    uint32_t allocationCount{0};
+    // Freed ranges left of nextX, sorted by x and never adjacent to each other
+    std::vector<Span> freeSpans;
+  };
+
+  std::optional<RECT> allocateInShelf(Shelf &shelf, int32_t width, int32_t height) noexcept;
+
+  int32_t m_width;
+  int32_t m_height;
+  int32_t m_nextShelfY{0};
+  uint32_t m_allocationCount{0};
+  std::vector<Shelf> m_shelves;
+};
+
+} // namespace Microsoft::ReactNative::Composition
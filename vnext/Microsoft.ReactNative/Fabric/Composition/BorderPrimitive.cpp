@@ -310,6 +310,22 @@ winrt::com_ptr<ID2D1PathGeometry> BorderPrimitive::GenerateRoundedRectPathGeomet
       compContext, params, rectPathGeometry);
 }
 
+facebook::react::RectangleCorners<facebook::react::CornerRadii> BorderPrimitive::fitRoundedRectRadii(
+    const facebook::react::RectangleCorners<facebook::react::CornerRadii> &baseRadius,
+    const facebook::react::Size &size) noexcept {
+  RoundedPathParameters params = GenerateRoundedPathParameters(baseRadius, {0, 0, 0, 0}, size);
+  facebook::react::RectangleCorners<facebook::react::CornerRadii> radii;
+  radii.topLeft.horizontal = params.topLeftRadiusX;
+  radii.topLeft.vertical = params.topLeftRadiusY;
+  radii.topRight.horizontal = params.topRightRadiusX;
+  radii.topRight.vertical = params.topRightRadiusY;
+  radii.bottomRight.horizontal = params.bottomRightRadiusX;
+  radii.bottomRight.vertical = params.bottomRightRadiusY;
+  radii.bottomLeft.horizontal = params.bottomLeftRadiusX;
+  radii.bottomLeft.vertical = params.bottomLeftRadiusY;
+  return radii;
+}
+
 void DrawShape(
     ID2D1RenderTarget *pRT,
     const D2D1_RECT_F &rect,
@@ -332,6 +348,28 @@ void DrawShape(
   pRT->DrawGeometry(&geometry, brush, strokeWidth, strokeStyle);
 }
 
+// Border textures are drawn in pixels, with widths and radii that already have the scale factor applied, so the key
+// does not need the DPI.  The raw bytes of the values are appended, which keeps keys short and exact.
+template <typename... TValues>
+void AppendToBorderTextureKey(std::string &key, const TValues &...values) noexcept {
+  (key.append(reinterpret_cast<const char *>(&values), sizeof(values)), ...);
+}
+
+enum class BorderTextureShape : uint8_t { Rectangle, RoundedRectangle };
+
+// Identifies the pixels of all the border layer textures of a view, the layers add their texture rect and color
+std::string BorderTextureKey(
+    BorderTextureShape shape,
+    facebook::react::BorderStyle borderStyle,
+    const facebook::react::BorderWidths &borderWidths,
+    const facebook::react::BorderRadii &borderRadii,
+    float textureWidth,
+    float textureHeight) noexcept {
+  std::string key;
+  AppendToBorderTextureKey(key, shape, borderStyle, borderWidths, borderRadii, textureWidth, textureHeight);
+  return key;
+}
+
 template <typename TShape>
 void SetBorderLayerPropertiesCommon(
     winrt::Microsoft::ReactNative::Composition::implementation::Theme *theme,
@@ -347,7 +385,8 @@ void SetBorderLayerPropertiesCommon(
     winrt::Windows::Foundation::Numerics::float2 relativeSizeAdjustment,
     FLOAT strokeWidth,
     const facebook::react::SharedColor &borderColor,
-    facebook::react::BorderStyle borderStyle) {
+    facebook::react::BorderStyle borderStyle,
+    const std::string &textureKey) {
   layer.Offset({anchorOffset.x, anchorOffset.y, 0}, {anchorPoint.x, anchorPoint.y, 0});
   layer.RelativeSizeWithOffset(size, relativeSizeAdjustment);
   layer.as<::Microsoft::ReactNative::Composition::Experimental::IVisualInterop>()->SetClippingPath(nullptr);
@@ -355,11 +394,33 @@ void SetBorderLayerPropertiesCommon(
   if ((textureRect.right - textureRect.left) <= 0 || (textureRect.bottom - textureRect.top) <= 0)
     return;
 
-  auto surface = compContext.CreateDrawingSurfaceBrush(
-      {(textureRect.right - textureRect.left), (textureRect.bottom - textureRect.top)},
-      winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
-      winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+  // Views with identical borders share the texture of each layer
+  std::string layerTextureKey = textureKey;
+  AppendToBorderTextureKey(layerTextureKey, textureRect, strokeWidth);
+  if (isColorMeaningful(borderColor, theme)) {
+    AppendToBorderTextureKey(layerTextureKey, theme->D2DColor(*borderColor));
+  }
+  if (auto cachedTexture = theme->CachedBorderTexture(layerTextureKey)) {
+    cachedTexture.as(borderTexture);
+    layer.Brush(cachedTexture);
+    return;
+  }
+
+  winrt::Windows::Foundation::Size surfaceSize{
+      (textureRect.right - textureRect.left), (textureRect.bottom - textureRect.top)};
+  // Atlas brushes cannot be stretched, so only layers that are the size of their texture (the corners) use the atlas
+  bool layerMatchesSurface = relativeSizeAdjustment.x == 0.0f && relativeSizeAdjustment.y == 0.0f &&
+      size.x == surfaceSize.Width && size.y == surfaceSize.Height;
+  ::Microsoft::ReactNative::Composition::DrawingSurfaceOwnerScope ownerScope(
+      ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Border);
+  auto surface = layerMatchesSurface
+      ? ::Microsoft::ReactNative::Composition::CreateAtlasOrDrawingSurfaceBrush(compContext, surfaceSize)
+      : compContext.CreateDrawingSurfaceBrush(
+            surfaceSize,
+            winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+            winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
   surface.as(borderTexture);
+  theme->CacheBorderTexture(layerTextureKey, surface);
 
   layer.Brush(surface);
 
@@ -433,7 +494,8 @@ void SetBorderLayerProperties(
     winrt::Windows::Foundation::Numerics::float2 relativeSizeAdjustment,
     FLOAT strokeWidth,
     const facebook::react::SharedColor &borderColor,
-    facebook::react::BorderStyle borderStyle) {
+    facebook::react::BorderStyle borderStyle,
+    const std::string &textureKey) {
   if constexpr (!std::is_base_of_v<ID2D1GeometryGroup, TShape>) {
     SetBorderLayerPropertiesCommon(
         theme,
@@ -448,7 +510,8 @@ void SetBorderLayerProperties(
         relativeSizeAdjustment,
         strokeWidth,
         borderColor,
-        borderStyle);
+        borderStyle,
+        textureKey);
   } else {
     // if (VisualVersion::IsUseWinCompClippingRegionEnabled())
     {
@@ -501,7 +564,8 @@ void DrawAllBorderLayers(
     float textureWidth,
     float textureHeight,
     const facebook::react::BorderColors &borderColors,
-    facebook::react::BorderStyle borderStyle) {
+    facebook::react::BorderStyle borderStyle,
+    const std::string &textureKey) {
   // Now that we've drawn our nice border in one layer, split it into its component layers
   winrt::com_ptr<::Microsoft::ReactNative::Composition::Experimental::ICompositionDrawingSurfaceInterop>
       spTextures[BorderPrimitive::SpecialBorderLayerCount];
@@ -524,7 +588,8 @@ void DrawAllBorderLayers(
       {0.0f, 0.0f}, // relativeSize
       std::max(borderWidths.left, borderWidths.top),
       borderColors.left ? borderColors.left : borderColors.top,
-      borderStyle);
+      borderStyle,
+      textureKey);
 
   // Top Edge Border
   SetBorderLayerProperties(
@@ -544,7 +609,8 @@ void DrawAllBorderLayers(
       {1.0f, 0.0f}, // relativeSize
       borderWidths.top,
       borderColors.top,
-      borderStyle);
+      borderStyle,
+      textureKey);
 
   // Top Right Corner Border
   SetBorderLayerProperties(
@@ -563,7 +629,8 @@ void DrawAllBorderLayers(
       {0.0f, 0.0f},
       std::max(borderWidths.right, borderWidths.top),
       borderColors.right ? borderColors.right : borderColors.top,
-      borderStyle);
+      borderStyle,
+      textureKey);
 
   // Right Edge Border
   SetBorderLayerProperties(
@@ -584,7 +651,8 @@ void DrawAllBorderLayers(
       {0.0f, 1.0f},
       borderWidths.right,
       borderColors.right,
-      borderStyle);
+      borderStyle,
+      textureKey);
 
   // Bottom Right Corner Border
   SetBorderLayerProperties(
@@ -604,7 +672,8 @@ void DrawAllBorderLayers(
       {0, 0},
       std::max(borderWidths.right, borderWidths.bottom),
       borderColors.right ? borderColors.right : borderColors.bottom,
-      borderStyle);
+      borderStyle,
+      textureKey);
 
   // Bottom Edge Border
   SetBorderLayerProperties(
@@ -624,7 +693,8 @@ void DrawAllBorderLayers(
       {1.0f, 0.0f},
       borderWidths.bottom,
       borderColors.bottom,
-      borderStyle);
+      borderStyle,
+      textureKey);
 
   // Bottom Left Corner Border
   SetBorderLayerProperties(
@@ -643,7 +713,8 @@ void DrawAllBorderLayers(
       {0, 0},
       std::max(borderWidths.left, borderWidths.bottom),
       borderColors.left ? borderColors.left : borderColors.bottom,
-      borderStyle);
+      borderStyle,
+      textureKey);
 
   // Left Edge Border
   SetBorderLayerProperties(
@@ -663,7 +734,8 @@ void DrawAllBorderLayers(
       {0, 1},
       borderWidths.left,
       borderColors.left,
-      borderStyle);
+      borderStyle,
+      textureKey);
 }
 
 winrt::com_ptr<ID2D1GeometryGroup> GetGeometryForRoundedBorder(
@@ -890,7 +962,14 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
             extentWidth,
             extentHeight,
             borderMetrics.borderColors,
-            borderStyle);
+            borderStyle,
+            BorderTextureKey(
+                BorderTextureShape::RoundedRectangle,
+                borderStyle,
+                borderMetrics.borderWidths,
+                borderMetrics.borderRadii,
+                extentWidth,
+                extentHeight));
       } else {
         assert(false);
       }
@@ -914,17 +993,29 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
           extentWidth,
           extentHeight,
           borderMetrics.borderColors,
-          borderStyle);
+          borderStyle,
+          {} /* Solid rounded borders clip a color brush, so they have no textures */);
     }
   } else {
     auto compContext = m_outer->CompositionContext();
+
+    // A solid rectangular border does not change along its edges, so it is drawn at the smallest extent that still
+    // has a pixel of each edge, which the edge layers stretch (nine-grid).  The textures are then the same for every
+    // size of view, and are shared by all views with the same border widths and colors.
+    float textureWidth = extentWidth;
+    float textureHeight = extentHeight;
+    if (borderStyle == facebook::react::BorderStyle::Solid) {
+      textureWidth = std::min(extentWidth, borderMetrics.borderWidths.left + borderMetrics.borderWidths.right + 1.0f);
+      textureHeight = std::min(extentHeight, borderMetrics.borderWidths.top + borderMetrics.borderWidths.bottom + 1.0f);
+    }
+
     // Because in DirectX geometry starts at the center of the stroke, we need to deflate rectangle by half the stroke
     // width / height to render correctly.
     D2D1_RECT_F rectShape{
         borderMetrics.borderWidths.left / 2.0f,
         borderMetrics.borderWidths.top / 2.0f,
-        extentWidth - (borderMetrics.borderWidths.right / 2.0f),
-        extentHeight - (borderMetrics.borderWidths.bottom / 2.0f)};
+        textureWidth - (borderMetrics.borderWidths.right / 2.0f),
+        textureHeight - (borderMetrics.borderWidths.bottom / 2.0f)};
     DrawAllBorderLayers(
         theme,
         compContext,
@@ -932,10 +1023,17 @@ bool BorderPrimitive::TryUpdateSpecialBorderLayers(
         rectShape,
         borderMetrics.borderWidths,
         borderMetrics.borderRadii,
-        extentWidth,
-        extentHeight,
+        textureWidth,
+        textureHeight,
         borderMetrics.borderColors,
-        borderStyle);
+        borderStyle,
+        BorderTextureKey(
+            BorderTextureShape::Rectangle,
+            borderStyle,
+            borderMetrics.borderWidths,
+            borderMetrics.borderRadii,
+            textureWidth,
+            textureHeight));
   }
   return true;
 }
@@ -60,6 +60,12 @@ struct BorderPrimitive {
       const facebook::react::RectangleEdges<float> &inset,
       const facebook::react::RectangleEdges<float> &rectPathGeometry) noexcept;
 
+  // The radii of a rounded rectangle of the given size, scaled down like GenerateRoundedRectPathGeometry does when
+  // they do not fit
+  static facebook::react::RectangleCorners<facebook::react::CornerRadii> fitRoundedRectRadii(
+      const facebook::react::RectangleCorners<facebook::react::CornerRadii> &baseRadius,
+      const facebook::react::Size &size) noexcept;
+
  private:
   std::array<winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual, SpecialBorderLayerCount>
   FindSpecialBorderLayers() const noexcept;
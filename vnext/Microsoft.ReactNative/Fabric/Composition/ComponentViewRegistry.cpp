@@ -33,16 +33,116 @@
 
 namespace Microsoft::ReactNative {
 
+// Matches RCTComponentViewRecyclingPoolMaxSize on iOS
+constexpr size_t DefaultRecyclePoolMaxSize = 1024;
+constexpr size_t DefaultParagraphRecyclePoolMaxSize = 256;
+constexpr size_t DefaultTextInputRecyclePoolMaxSize = 64;
+constexpr size_t DefaultPreallocationBudget = 64;
+constexpr size_t DefaultParagraphPreallocationBudget = 32;
+
 void ComponentViewRegistry::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
+
+  // Only the core components that fully reset themselves in prepareForRecycle are pooled by default.  Other components
+  // (including custom ABI components) are destroyed when deleted, unless a pool size is explicitly set for them.
+  setRecyclePoolMaxSize(facebook::react::ViewShadowNode::Handle(), DefaultRecyclePoolMaxSize);
+  setRecyclePoolMaxSize(facebook::react::ParagraphShadowNode::Handle(), DefaultParagraphRecyclePoolMaxSize);
+  setRecyclePoolMaxSize(facebook::react::WindowsTextInputShadowNode::Handle(), DefaultTextInputRecyclePoolMaxSize);
+  setPreallocationBudget(facebook::react::ViewShadowNode::Handle(), DefaultPreallocationBudget);
+  setPreallocationBudget(facebook::react::ParagraphShadowNode::Handle(), DefaultParagraphPreallocationBudget);
+}
+
+void ComponentViewRegistry::setRecyclePoolMaxSize(
+    facebook::react::ComponentHandle componentHandle,
+    size_t maxSize) noexcept {
+  auto &pool = m_recyclePools[componentHandle];
+  pool.maxSize = maxSize;
+  while (pool.views.size() > maxSize) {
+    winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(pool.views.back().view)
+        ->onDestroying();
+    pool.views.pop_back();
+  }
+}
+
+void ComponentViewRegistry::setPreallocationBudget(
+    facebook::react::ComponentHandle componentHandle,
+    size_t budget) noexcept {
+  m_recyclePools[componentHandle].preallocationBudget = budget;
+}
+
+bool ComponentViewRegistry::preallocateComponentView(
+    facebook::react::ComponentHandle componentHandle,
+    const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept {
+  auto itPool = m_recyclePools.find(componentHandle);
+  if (itPool == m_recyclePools.end()) {
+    return false;
+  }
+
+  auto &pool = itPool->second;
+  if (pool.views.size() >= std::min(pool.preallocationBudget, pool.maxSize)) {
+    return false;
+  }
+
+  // The real tag is assigned by prepareForReuse when the view is dequeued
+  pool.views.push_back(ComponentViewDescriptor{createComponentView(componentHandle, -1, compContext)});
+  return true;
+}
+
+std::unordered_map<facebook::react::ComponentHandle, size_t> ComponentViewRegistry::preallocationCapacities()
+    const noexcept {
+  std::unordered_map<facebook::react::ComponentHandle, size_t> capacities;
+  for (auto const &[componentHandle, pool] : m_recyclePools) {
+    auto budget = std::min(pool.preallocationBudget, pool.maxSize);
+    capacities[componentHandle] = pool.views.size() < budget ? budget - pool.views.size() : 0;
+  }
+  return capacities;
+}
+
+std::map<std::string, ComponentViewRegistry::ComponentViewCount> ComponentViewRegistry::componentViewCounts()
+    const noexcept {
+  std::map<std::string, ComponentViewCount> counts;
+  m_registry.forEach([&counts](facebook::react::Tag /*tag*/, const ComponentViewDescriptor &descriptor) {
+    ++counts[winrt::to_string(winrt::get_class_name(descriptor.view))].mounted;
+  });
+  for (auto &[componentHandle, pool] : m_recyclePools) {
+    for (auto &descriptor : pool.views) {
+      ++counts[winrt::to_string(winrt::get_class_name(descriptor.view))].recycled;
+    }
+  }
+  return counts;
+}
+
+void ComponentViewRegistry::clearRecyclePools() noexcept {
+  for (auto &[componentHandle, pool] : m_recyclePools) {
+    for (auto &descriptor : pool.views) {
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(descriptor.view)->onDestroying();
+    }
+    pool.views.clear();
+  }
 }
 
 ComponentViewDescriptor const &ComponentViewRegistry::dequeueComponentViewWithComponentHandle(
     facebook::react::ComponentHandle componentHandle,
     facebook::react::Tag tag,
     const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept {
-  // TODO implement recycled components like core does
+  assert(!m_registry.contains(tag));
+
+  auto itPool = m_recyclePools.find(componentHandle);
+  if (itPool != m_recyclePools.end() && !itPool->second.views.empty()) {
+    auto componentViewDescriptor = std::move(itPool->second.views.back());
+    itPool->second.views.pop_back();
+    winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(componentViewDescriptor.view)
+        ->prepareForReuse(tag);
+    return m_registry.insert(tag, std::move(componentViewDescriptor));
+  }
+
+  return m_registry.insert(tag, ComponentViewDescriptor{createComponentView(componentHandle, tag, compContext)});
+}
 
+winrt::Microsoft::ReactNative::ComponentView ComponentViewRegistry::createComponentView(
+    facebook::react::ComponentHandle componentHandle,
+    facebook::react::Tag tag,
+    const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept {
   winrt::Microsoft::ReactNative::ComponentView view{nullptr};
 
   if (componentHandle == facebook::react::ViewShadowNode::Handle()) {
@@ -89,38 +189,44 @@ ComponentViewDescriptor const &ComponentViewRegistry::dequeueComponentViewWithCo
                ->CreateView(m_context.Handle(), tag, compContext);
   }
 
-  auto it = m_registry.insert({tag, ComponentViewDescriptor{view}});
-  return it.first->second;
+  return view;
 }
 
 ComponentViewDescriptor const &ComponentViewRegistry::componentViewDescriptorWithTag(
     facebook::react::Tag tag) const noexcept {
-  auto iterator = m_registry.find(tag);
-  assert(iterator != m_registry.end());
-  return iterator->second;
+  auto descriptor = m_registry.find(tag);
+  assert(descriptor);
+  return *descriptor;
 }
 
 winrt::Microsoft::ReactNative::ComponentView ComponentViewRegistry::findComponentViewWithTag(
     facebook::react::Tag tag) const noexcept {
-  auto iterator = m_registry.find(tag);
-  if (iterator == m_registry.end()) {
+  auto descriptor = m_registry.find(tag);
+  if (!descriptor) {
     return nullptr;
   }
-  return iterator->second.view;
+  return descriptor->view;
 }
 
 void ComponentViewRegistry::enqueueComponentViewWithComponentHandle(
     facebook::react::ComponentHandle componentHandle,
     facebook::react::Tag tag,
     ComponentViewDescriptor componentViewDescriptor) noexcept {
-  assert(m_registry.find(tag) != m_registry.end());
+  assert(m_registry.contains(tag));
 
-  winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(componentViewDescriptor.view)
-      ->prepareForRecycle();
+  auto componentView =
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(componentViewDescriptor.view);
+  componentView->prepareForRecycle();
 
   m_registry.erase(tag);
 
-  winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(componentViewDescriptor.view)
-      ->onDestroying();
+  auto itPool = m_recyclePools.find(componentHandle);
+  if (itPool != m_recyclePools.end() && itPool->second.views.size() < itPool->second.maxSize &&
+      componentView->isRecyclable()) {
+    itPool->second.views.push_back(std::move(componentViewDescriptor));
+    return;
+  }
+
+  componentView->onDestroying();
 }
 } // namespace Microsoft::ReactNative
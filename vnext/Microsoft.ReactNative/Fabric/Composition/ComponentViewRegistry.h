@@ -6,12 +6,16 @@
 
 #include <Fabric/IComponentViewRegistry.h>
 
+#include <Fabric/Composition/ComponentViewTable.h>
 #include <Fabric/Composition/CompositionHelpers.h>
 #include <winrt/Microsoft.ReactNative.h>
+#include <map>
+#include <unordered_map>
 
 namespace Microsoft::ReactNative {
 
-/* This could be expanded to have a pool of ComponentViewDescriptor's, like iOS does */
+// Like iOS, views that are deleted are kept in a per ComponentHandle pool so that later Create mutations can reuse
+// them (along with their composition visuals) instead of creating new ones.
 class ComponentViewRegistry final : public IComponentViewRegistry {
  public:
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept override;
@@ -29,8 +33,46 @@ class ComponentViewRegistry final : public IComponentViewRegistry {
       facebook::react::Tag tag,
       ComponentViewDescriptor componentViewDescriptor) noexcept override;
 
+  // Sets the maximum number of views of a given component type kept around for reuse.  0 disables recycling.
+  void setRecyclePoolMaxSize(facebook::react::ComponentHandle componentHandle, size_t maxSize) noexcept;
+
+  // Sets the maximum number of views of a given component type that preallocateComponentView will create ahead of time.
+  void setPreallocationBudget(facebook::react::ComponentHandle componentHandle, size_t budget) noexcept;
+
+  // Creates a view ahead of time and puts it into the recycle pool, so that a later dequeue for that component type
+  // does not need to allocate.  Returns false if the component type is not pooled or its budget is already used up.
+  bool preallocateComponentView(
+      facebook::react::ComponentHandle componentHandle,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept;
+
+  // The number of views of each pooled component type that preallocateComponentView would still create
+  std::unordered_map<facebook::react::ComponentHandle, size_t> preallocationCapacities() const noexcept;
+
+  struct ComponentViewCount {
+    size_t mounted{0};
+    size_t recycled{0};
+  };
+
+  // Counts the views by the runtime class name of their implementation, for the memory report
+  std::map<std::string, ComponentViewCount> componentViewCounts() const noexcept;
+
+  // Destroys the views kept for reuse, on memory pressure.  The pools fill up again as views are deleted.
+  void clearRecyclePools() noexcept;
+
  private:
-  std::unordered_map<facebook::react::Tag, ComponentViewDescriptor> m_registry;
+  winrt::Microsoft::ReactNative::ComponentView createComponentView(
+      facebook::react::ComponentHandle componentHandle,
+      facebook::react::Tag tag,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext) noexcept;
+
+  struct RecyclePool {
+    size_t maxSize{0};
+    size_t preallocationBudget{0};
+    std::vector<ComponentViewDescriptor> views;
+  };
+
+  ComponentViewTable m_registry;
+  std::unordered_map<facebook::react::ComponentHandle, RecyclePool> m_recyclePools;
   winrt::Microsoft::ReactNative::ReactContext m_context;
 };
 
@@ -0,0 +1,14 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Fabric/Composition/TagTable.h>
+#include <Fabric/IComponentViewRegistry.h>
+
+namespace Microsoft::ReactNative {
+
+// The mounted views of ComponentViewRegistry by tag
+using ComponentViewTable = TagTable<ComponentViewDescriptor>;
+
+} // namespace Microsoft::ReactNative
@@ -10,16 +10,24 @@
 #endif
 
 #include <Windows.Graphics.Interop.h>
+#include <d3d11_4.h>
+#include <wincodec.h>
+#include <windows.graphics.imaging.interop.h>
 #include <windows.ui.composition.interop.h>
 #include <winrt/Microsoft.ReactNative.Composition.Input.h>
 #include <winrt/Windows.Graphics.DirectX.Direct3D11.h>
+#include <winrt/Windows.System.h>
 #include <winrt/Windows.UI.Composition.h>
 #include <winrt/Windows.UI.Composition.interactions.h>
+#include "AtlasShelfPacker.h"
 #include "CompositionHelpers.h"
 
 #include <winrt/Microsoft.UI.Composition.h>
 #include <winrt/Microsoft.UI.Composition.interactions.h>
 #include <winrt/Microsoft.UI.Composition.interop.h>
+#include <winrt/Microsoft.UI.Dispatching.h>
+
+extern "C" HRESULT WINAPI WICCreateImagingFactory_Proxy(UINT SDKVersion, IWICImagingFactory **ppIWICImagingFactory);
 
 namespace Microsoft::ReactNative::Composition::Experimental {
 
@@ -50,6 +58,7 @@ struct CompositionTypeTraits<WindowsTypeTag> {
   using CompositionStretch = winrt::Windows::UI::Composition::CompositionStretch;
   using CompositionStrokeCap = winrt::Windows::UI::Composition::CompositionStrokeCap;
   using CompositionSurfaceBrush = winrt::Windows::UI::Composition::CompositionSurfaceBrush;
+  using CompositionVirtualDrawingSurface = winrt::Windows::UI::Composition::CompositionVirtualDrawingSurface;
   using Compositor = winrt::Windows::UI::Composition::Compositor;
   using ContainerVisual = winrt::Windows::UI::Composition::ContainerVisual;
   using CubicBezierEasingFunction = winrt::Windows::UI::Composition::CubicBezierEasingFunction;
@@ -75,6 +84,7 @@ struct CompositionTypeTraits<WindowsTypeTag> {
       winrt::Windows::UI::Composition::Interactions::InteractionTrackerInertiaRestingValue;
   using InteractionTrackerInertiaModifier =
       winrt::Windows::UI::Composition::Interactions::InteractionTrackerInertiaModifier;
+  using RectangleClip = winrt::Windows::UI::Composition::RectangleClip;
   using ScalarKeyFrameAnimation = winrt::Windows::UI::Composition::ScalarKeyFrameAnimation;
   using ShapeVisual = winrt::Windows::UI::Composition::ShapeVisual;
   using SpriteVisual = winrt::Windows::UI::Composition::SpriteVisual;
@@ -86,11 +96,14 @@ struct CompositionTypeTraits<WindowsTypeTag> {
   using CompositionGraphicsDevice = winrt::Windows::UI::Composition::CompositionGraphicsDevice;
 
   using ICompositionDrawingSurfaceInterop = ABI::Windows::UI::Composition::ICompositionDrawingSurfaceInterop;
+  using ICompositionDrawingSurfaceInterop2 = ABI::Windows::UI::Composition::ICompositionDrawingSurfaceInterop2;
   using ICompositorInterop = ABI::Windows::UI::Composition::ICompositorInterop;
+  using ICompositionGraphicsDeviceInterop = ABI::Windows::UI::Composition::ICompositionGraphicsDeviceInterop;
 
   using IInnerCompositionCompositor = IWindowsCompositionCompositor;
   using IInnerCompositionDropShadow = IWindowsCompositionDropShadow;
   using IInnerCompositionVisual = IWindowsCompositionVisual;
+  using IInnerCompositionScrollVisual = IWindowsCompositionScrollVisual;
   using IInnerCompositionBrush = IWindowsCompositionBrush;
   using IInnerCompositionDrawingSurface = IWindowsCompositionDrawingSurfaceInner;
   using CompositionContextHelper =
@@ -122,6 +135,7 @@ struct CompositionTypeTraits<MicrosoftTypeTag> {
   using CompositionStretch = winrt::Microsoft::UI::Composition::CompositionStretch;
   using CompositionStrokeCap = winrt::Microsoft::UI::Composition::CompositionStrokeCap;
   using CompositionSurfaceBrush = winrt::Microsoft::UI::Composition::CompositionSurfaceBrush;
+  using CompositionVirtualDrawingSurface = winrt::Microsoft::UI::Composition::CompositionVirtualDrawingSurface;
   using Compositor = winrt::Microsoft::UI::Composition::Compositor;
   using ContainerVisual = winrt::Microsoft::UI::Composition::ContainerVisual;
   using CubicBezierEasingFunction = winrt::Microsoft::UI::Composition::CubicBezierEasingFunction;
@@ -147,6 +161,7 @@ struct CompositionTypeTraits<MicrosoftTypeTag> {
       winrt::Microsoft::UI::Composition::Interactions::InteractionTrackerInertiaRestingValue;
   using InteractionTrackerInertiaModifier =
       winrt::Microsoft::UI::Composition::Interactions::InteractionTrackerInertiaModifier;
+  using RectangleClip = winrt::Microsoft::UI::Composition::RectangleClip;
   using ScalarKeyFrameAnimation = winrt::Microsoft::UI::Composition::ScalarKeyFrameAnimation;
   using ShapeVisual = winrt::Microsoft::UI::Composition::ShapeVisual;
   using SpriteVisual = winrt::Microsoft::UI::Composition::SpriteVisual;
@@ -158,11 +173,14 @@ struct CompositionTypeTraits<MicrosoftTypeTag> {
   using CompositionGraphicsDevice = winrt::Microsoft::UI::Composition::CompositionGraphicsDevice;
 
   using ICompositionDrawingSurfaceInterop = winrt::Microsoft::UI::Composition::ICompositionDrawingSurfaceInterop;
+  using ICompositionDrawingSurfaceInterop2 = winrt::Microsoft::UI::Composition::ICompositionDrawingSurfaceInterop2;
   using ICompositorInterop = winrt::Microsoft::UI::Composition::ICompositorInterop;
+  using ICompositionGraphicsDeviceInterop = winrt::Microsoft::UI::Composition::ICompositionGraphicsDeviceInterop;
 
   using IInnerCompositionCompositor = IMicrosoftCompositionCompositor;
   using IInnerCompositionDropShadow = IMicrosoftCompositionDropShadow;
   using IInnerCompositionVisual = IMicrosoftCompositionVisual;
+  using IInnerCompositionScrollVisual = IMicrosoftCompositionScrollVisual;
   using IInnerCompositionBrush = IMicrosoftCompositionBrush;
   using IInnerCompositionDrawingSurface = IMicrosoftCompositionDrawingSurfaceInner;
   using CompositionContextHelper =
@@ -203,18 +221,22 @@ struct CompDropShadow : public winrt::implements<
   }
 
   void Offset(winrt::Windows::Foundation::Numerics::float3 const &offset) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_shadow.Offset(offset);
   }
 
   void Opacity(float opacity) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_shadow.Opacity(opacity);
   }
 
   void BlurRadius(float radius) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_shadow.BlurRadius(radius);
   }
 
   void Color(winrt::Windows::UI::Color color) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_shadow.Color(color);
   }
 
@@ -241,6 +263,31 @@ struct CompBrush : public winrt::implements<
 using WindowsCompBrush = CompBrush<WindowsTypeRedirects>;
 using MicrosoftCompBrush = CompBrush<MicrosoftTypeRedirects>;
 
+// Transforms a device context returned by a BeginDraw of updateRect, which drawing starts at updateOffset, so that
+// the caller draws in the DIPs of the whole surface, and clips drawing to the update rect
+void PushSurfaceUpdateTransform(
+    ID2D1DeviceContext &deviceContext,
+    const RECT &updateRect,
+    POINT updateOffset,
+    float xDpi,
+    float yDpi) noexcept {
+  auto dipsPerPixelX = 96.0f / xDpi;
+  auto dipsPerPixelY = 96.0f / yDpi;
+  deviceContext.SetTransform(D2D1::Matrix3x2F::Translation(
+      (updateOffset.x - updateRect.left) * dipsPerPixelX, (updateOffset.y - updateRect.top) * dipsPerPixelY));
+  deviceContext.PushAxisAlignedClip(
+      {updateRect.left * dipsPerPixelX,
+       updateRect.top * dipsPerPixelY,
+       updateRect.right * dipsPerPixelX,
+       updateRect.bottom * dipsPerPixelY},
+      D2D1_ANTIALIAS_MODE_ALIASED);
+}
+
+void PopSurfaceUpdateTransform(ID2D1DeviceContext &deviceContext) noexcept {
+  deviceContext.PopAxisAlignedClip();
+  deviceContext.SetTransform(D2D1::Matrix3x2F::Identity());
+}
+
 template <typename TTypeRedirects>
 struct CompDrawingSurfaceBrush : public winrt::implements<
                                      CompDrawingSurfaceBrush<TTypeRedirects>,
@@ -248,12 +295,46 @@ struct CompDrawingSurfaceBrush : public winrt::implements<
                                      winrt::Microsoft::ReactNative::Composition::Experimental::IBrush,
                                      typename TTypeRedirects::IInnerCompositionBrush,
                                      ICompositionDrawingSurfaceInterop,
+                                     ::Microsoft::ReactNative::Composition::ICompositionDrawingSurfaceUpdate,
+                                     ::Microsoft::ReactNative::Composition::ICompositionVirtualDrawingSurface,
                                      typename TTypeRedirects::IInnerCompositionDrawingSurface> {
   CompDrawingSurfaceBrush(
       const typename TTypeRedirects::Compositor &compositor,
       typename TTypeRedirects::CompositionDrawingSurface const &drawingSurface)
       : m_brush(compositor.CreateSurfaceBrush(drawingSurface)) {
     drawingSurface.as(m_drawingSurfaceInterop);
+    auto size = drawingSurface.SizeInt32();
+    m_byteSize = static_cast<int64_t>(size.Width) * size.Height * 4;
+    TrackLiveDrawingSurface(m_owner, 1, m_byteSize);
+  }
+
+  CompDrawingSurfaceBrush(
+      const typename TTypeRedirects::Compositor &compositor,
+      typename TTypeRedirects::CompositionVirtualDrawingSurface const &virtualDrawingSurface)
+      : CompDrawingSurfaceBrush(
+            compositor, virtualDrawingSurface.as<typename TTypeRedirects::CompositionDrawingSurface>()) {
+    m_virtualDrawingSurface = virtualDrawingSurface;
+    // Virtual surfaces only use memory where they have been drawn to
+    TrackLiveDrawingSurface(m_owner, 0, -std::exchange(m_byteSize, 0));
+  }
+
+  ~CompDrawingSurfaceBrush() noexcept {
+    TrackLiveDrawingSurface(m_owner, -1, -m_byteSize);
+  }
+
+  // Does nothing unless the brush was created with a virtual surface
+  void Trim(const RECT *rects, uint32_t rectCount) noexcept override {
+    if (!m_virtualDrawingSurface) {
+      return;
+    }
+
+    std::vector<winrt::Windows::Graphics::RectInt32> keptRects;
+    keptRects.reserve(rectCount);
+    for (uint32_t i = 0; i < rectCount; i++) {
+      keptRects.push_back(
+          {rects[i].left, rects[i].top, rects[i].right - rects[i].left, rects[i].bottom - rects[i].top});
+    }
+    m_virtualDrawingSurface.Trim(keptRects);
   }
 
   HRESULT BeginDraw(ID2D1DeviceContext **deviceContextOut, float xDpi, float yDpi, POINT *offset) noexcept {
@@ -271,7 +352,27 @@ struct CompDrawingSurfaceBrush : public winrt::implements<
     return hr;
   }
 
+  HRESULT BeginDrawUpdate(
+      const RECT &updateRect,
+      ID2D1DeviceContext **deviceContextOut,
+      float xDpi,
+      float yDpi) noexcept override {
+    POINT updateOffset;
+    auto hr = m_drawingSurfaceInterop->BeginDraw(
+        &updateRect, __uuidof(ID2D1DeviceContext), (void **)deviceContextOut, &updateOffset);
+    if (SUCCEEDED(hr)) {
+      m_updateDeviceContext.copy_from(*deviceContextOut);
+      m_updateDeviceContext->SetDpi(xDpi, yDpi);
+      PushSurfaceUpdateTransform(*m_updateDeviceContext, updateRect, updateOffset, xDpi, yDpi);
+    }
+    return hr;
+  }
+
   HRESULT EndDraw() noexcept {
+    if (m_updateDeviceContext) {
+      PopSurfaceUpdateTransform(*m_updateDeviceContext);
+      m_updateDeviceContext = nullptr;
+    }
     return m_drawingSurfaceInterop->EndDraw();
   }
 
@@ -316,10 +417,154 @@ struct CompDrawingSurfaceBrush : public winrt::implements<
  private:
   typename TTypeRedirects::CompositionSurfaceBrush m_brush;
   winrt::com_ptr<typename TTypeRedirects::ICompositionDrawingSurfaceInterop> m_drawingSurfaceInterop;
+  // Set between BeginDrawUpdate and EndDraw
+  winrt::com_ptr<ID2D1DeviceContext> m_updateDeviceContext;
+  typename TTypeRedirects::CompositionVirtualDrawingSurface m_virtualDrawingSurface{nullptr};
+  DrawingSurfaceOwner m_owner{DrawingSurfaceOwnerScope::Current()};
+  int64_t m_byteSize{0};
 };
 using WindowsCompDrawingSurfaceBrush = CompDrawingSurfaceBrush<WindowsTypeRedirects>;
 using MicrosoftCompDrawingSurfaceBrush = CompDrawingSurfaceBrush<MicrosoftTypeRedirects>;
 
+// Atlas pages are virtual surfaces, so only the parts of the page that have been drawn to use memory
+constexpr int32_t DrawingSurfaceAtlasPageSize = 2048;
+// Larger surfaces get a surface of their own
+constexpr int32_t DrawingSurfaceAtlasMaxWidth = 1024;
+constexpr int32_t DrawingSurfaceAtlasMaxHeight = 256;
+// Transparent border around each allocation, so that filtering never samples a neighbouring allocation
+constexpr int32_t DrawingSurfaceAtlasGutter = 1;
+
+template <typename TTypeRedirects>
+struct DrawingSurfaceAtlasPage {
+  DrawingSurfaceAtlasPage(typename TTypeRedirects::CompositionVirtualDrawingSurface const &surface) noexcept
+      : surface(surface), packer(DrawingSurfaceAtlasPageSize, DrawingSurfaceAtlasPageSize) {
+    surface.as(interop);
+  }
+
+  void free(const RECT &rect) noexcept {
+    packer.free(rect);
+    if (packer.empty()) {
+      // Trimming to no rects releases all of the memory behind the page
+      surface.Trim({});
+    }
+  }
+
+  typename TTypeRedirects::CompositionVirtualDrawingSurface surface;
+  winrt::com_ptr<typename TTypeRedirects::ICompositionDrawingSurfaceInterop> interop;
+  ::Microsoft::ReactNative::Composition::AtlasShelfPacker packer;
+};
+
+// A drawing surface sub-allocated from a DrawingSurfaceAtlasPage.  The brush is offset so that the allocation is at
+// the top left of the visual, and drawing is translated and clipped to the allocation.
+template <typename TTypeRedirects>
+struct CompAtlasDrawingSurfaceBrush
+    : public winrt::implements<
+          CompAtlasDrawingSurfaceBrush<TTypeRedirects>,
+          winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush,
+          winrt::Microsoft::ReactNative::Composition::Experimental::IBrush,
+          typename TTypeRedirects::IInnerCompositionBrush,
+          ICompositionDrawingSurfaceInterop,
+          ::Microsoft::ReactNative::Composition::ICompositionDrawingSurfaceUpdate,
+          typename TTypeRedirects::IInnerCompositionDrawingSurface> {
+  CompAtlasDrawingSurfaceBrush(
+      const typename TTypeRedirects::Compositor &compositor,
+      std::shared_ptr<DrawingSurfaceAtlasPage<TTypeRedirects>> page,
+      const RECT &allocation) noexcept
+      : m_brush(compositor.CreateSurfaceBrush(page->surface)), m_page(std::move(page)), m_allocation(allocation) {
+    m_brush.Stretch(TTypeRedirects::CompositionStretch::None);
+    m_brush.HorizontalAlignmentRatio(0.0f);
+    m_brush.VerticalAlignmentRatio(0.0f);
+    m_brush.Offset(
+        {-static_cast<float>(allocation.left + DrawingSurfaceAtlasGutter),
+         -static_cast<float>(allocation.top + DrawingSurfaceAtlasGutter)});
+  }
+
+  ~CompAtlasDrawingSurfaceBrush() noexcept {
+    m_page->free(m_allocation);
+  }
+
+  HRESULT BeginDraw(ID2D1DeviceContext **deviceContextOut, float xDpi, float yDpi, POINT *offset) noexcept {
+    POINT pageOffset;
+    auto hr = m_page->interop->BeginDraw(
+        &m_allocation, __uuidof(ID2D1DeviceContext), (void **)deviceContextOut, &pageOffset);
+    if (FAILED(hr)) {
+      return hr;
+    }
+
+    m_deviceContext.copy_from(*deviceContextOut);
+    // Clears the gutter as well as the allocation
+    m_deviceContext->Clear();
+    m_deviceContext->SetDpi(xDpi, yDpi);
+
+    // Callers add the offset to coordinates that are in DIPs once the DPI is set, so report no offset and
+    // translate to the allocation instead
+    PushSurfaceUpdateTransform(
+        *m_deviceContext,
+        {0,
+         0,
+         m_allocation.right - m_allocation.left - 2 * DrawingSurfaceAtlasGutter,
+         m_allocation.bottom - m_allocation.top - 2 * DrawingSurfaceAtlasGutter},
+        {pageOffset.x + DrawingSurfaceAtlasGutter, pageOffset.y + DrawingSurfaceAtlasGutter},
+        xDpi,
+        yDpi);
+    *offset = {0, 0};
+    return hr;
+  }
+
+  HRESULT BeginDrawUpdate(
+      const RECT &updateRect,
+      ID2D1DeviceContext **deviceContextOut,
+      float xDpi,
+      float yDpi) noexcept override {
+    auto left = m_allocation.left + DrawingSurfaceAtlasGutter;
+    auto top = m_allocation.top + DrawingSurfaceAtlasGutter;
+    RECT pageRect{
+        left + updateRect.left,
+        top + updateRect.top,
+        std::min(left + updateRect.right, m_allocation.right - DrawingSurfaceAtlasGutter),
+        std::min(top + updateRect.bottom, m_allocation.bottom - DrawingSurfaceAtlasGutter)};
+    POINT pageOffset;
+    auto hr =
+        m_page->interop->BeginDraw(&pageRect, __uuidof(ID2D1DeviceContext), (void **)deviceContextOut, &pageOffset);
+    if (SUCCEEDED(hr)) {
+      m_deviceContext.copy_from(*deviceContextOut);
+      m_deviceContext->SetDpi(xDpi, yDpi);
+      PushSurfaceUpdateTransform(*m_deviceContext, updateRect, pageOffset, xDpi, yDpi);
+    }
+    return hr;
+  }
+
+  HRESULT EndDraw() noexcept {
+    if (m_deviceContext) {
+      PopSurfaceUpdateTransform(*m_deviceContext);
+      m_deviceContext = nullptr;
+    }
+    return m_page->interop->EndDraw();
+  }
+
+  // This is the whole atlas page
+  typename TTypeRedirects::ICompositionSurface Inner() const noexcept {
+    return m_page->surface;
+  }
+
+  typename TTypeRedirects::CompositionBrush InnerBrush() const noexcept {
+    return m_brush;
+  }
+
+  // The brush has to stay aligned to the allocation, so these are ignored
+  void HorizontalAlignmentRatio(float) noexcept {}
+  void VerticalAlignmentRatio(float) noexcept {}
+  void Stretch(winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch) noexcept {}
+
+ private:
+  typename TTypeRedirects::CompositionSurfaceBrush m_brush;
+  std::shared_ptr<DrawingSurfaceAtlasPage<TTypeRedirects>> m_page;
+  RECT m_allocation;
+  winrt::com_ptr<ID2D1DeviceContext> m_deviceContext;
+};
+using WindowsCompAtlasDrawingSurfaceBrush = CompAtlasDrawingSurfaceBrush<WindowsTypeRedirects>;
+using MicrosoftCompAtlasDrawingSurfaceBrush = CompAtlasDrawingSurfaceBrush<MicrosoftTypeRedirects>;
+
 template <typename TTypeRedirects>
 void SetAnimationClass(
     winrt::Microsoft::ReactNative::Composition::Experimental::AnimationClass value,
@@ -407,7 +652,13 @@ void SetAnimationClass(
 
 template <typename TTypeRedirects, typename TVisual = typename TTypeRedirects::Visual>
 struct CompVisualImpl {
-  CompVisualImpl(typename TVisual const &visual) : m_visual(visual) {}
+  CompVisualImpl(typename TVisual const &visual) : m_visual(visual) {
+    TrackLiveVisuals(1);
+  }
+
+  ~CompVisualImpl() noexcept {
+    TrackLiveVisuals(-1);
+  }
 
   typename TTypeRedirects::Visual InnerVisual() const noexcept {
     return m_visual;
@@ -434,6 +685,33 @@ struct CompVisualImpl {
     containerChildren.Remove(compVisual);
   }
 
+  void InsertRangeAt(
+      winrt::array_view<const winrt::Microsoft::ReactNative::Composition::Experimental::IVisual> visuals,
+      uint32_t index) noexcept {
+    if (visuals.empty()) {
+      return;
+    }
+
+    auto containerChildren = InnerVisual().as<typename TTypeRedirects::ContainerVisual>().Children();
+    auto it = visuals.begin();
+    typename TTypeRedirects::Visual insertAfter{nullptr};
+    if (index == 0) {
+      insertAfter = TTypeRedirects::CompositionContextHelper::InnerVisual(*it++);
+      containerChildren.InsertAtBottom(insertAfter);
+    } else {
+      auto childIterator = containerChildren.First();
+      for (uint32_t i = 1; i < index; i++)
+        childIterator.MoveNext();
+      insertAfter = childIterator.Current();
+    }
+
+    for (; it != visuals.end(); ++it) {
+      auto compVisual = TTypeRedirects::CompositionContextHelper::InnerVisual(*it);
+      containerChildren.InsertAbove(compVisual, insertAfter);
+      insertAfter = compVisual;
+    }
+  }
+
   winrt::Microsoft::ReactNative::Composition::Experimental::IVisual GetAt(uint32_t index) noexcept {
     auto containerChildren = m_visual.as<typename TTypeRedirects::ContainerVisual>().Children();
     auto it = containerChildren.First();
@@ -443,6 +721,7 @@ struct CompVisualImpl {
   }
 
   void SetClippingPath(ID2D1Geometry *clippingPath) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     if (!clippingPath) {
       m_visual.Clip(nullptr);
       return;
@@ -454,37 +733,65 @@ struct CompVisualImpl {
     m_visual.Clip(clip);
   }
 
+  void SetRoundedRectangleClip(
+      winrt::Windows::Foundation::Numerics::float2 const &size,
+      winrt::Windows::Foundation::Numerics::float2 const &topLeftRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &topRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomLeftRadius) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
+    auto clip = m_visual.Clip().template try_as<typename TTypeRedirects::RectangleClip>();
+    if (!clip) {
+      clip = m_visual.Compositor().CreateRectangleClip();
+      m_visual.Clip(clip);
+    }
+    clip.Right(size.x);
+    clip.Bottom(size.y);
+    clip.TopLeftRadius(topLeftRadius);
+    clip.TopRightRadius(topRightRadius);
+    clip.BottomRightRadius(bottomRightRadius);
+    clip.BottomLeftRadius(bottomLeftRadius);
+  }
+
   void Opacity(float opacity) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Opacity(opacity);
   }
 
   void Scale(winrt::Windows::Foundation::Numerics::float3 const &scale) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Scale(scale);
   }
 
   void TransformMatrix(winrt::Windows::Foundation::Numerics::float4x4 const &transform) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.TransformMatrix(transform);
   }
 
   void RotationAngle(float rotation) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.RotationAngle(rotation);
   }
 
   void IsVisible(bool isVisible) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.IsVisible(isVisible);
   }
 
   void Size(winrt::Windows::Foundation::Numerics::float2 const &size) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Size(size);
   }
 
   void Offset(winrt::Windows::Foundation::Numerics::float3 const &offset) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Offset(offset);
   }
 
   void Offset(
       winrt::Windows::Foundation::Numerics::float3 offset,
       winrt::Windows::Foundation::Numerics::float3 relativeAdjustment) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Offset(offset);
     m_visual.RelativeOffsetAdjustment(relativeAdjustment);
   }
@@ -492,6 +799,7 @@ struct CompVisualImpl {
   void RelativeSizeWithOffset(
       winrt::Windows::Foundation::Numerics::float2 size,
       winrt::Windows::Foundation::Numerics::float2 relativeSizeAdjustment) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Size(size);
     m_visual.RelativeSizeAdjustment(relativeSizeAdjustment);
   }
@@ -502,6 +810,7 @@ struct CompVisualImpl {
   }
 
   void BackfaceVisibility(winrt::Microsoft::ReactNative::Composition::Experimental::BackfaceVisibility value) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.BackfaceVisibility(static_cast<typename TTypeRedirects::CompositionBackfaceVisibility>(value));
   }
 
@@ -526,7 +835,9 @@ struct CompVisual : public winrt::implements<
                         CompVisual<TTypeRedirects>,
                         winrt::Microsoft::ReactNative::Composition::Experimental::IVisual,
                         typename TTypeRedirects::IInnerCompositionVisual,
-                        IVisualInterop>,
+                        IVisualInterop,
+                        IVisualRoundedRectangleClipInterop,
+                        IVisualChildrenInterop>,
                     CompVisualImpl<TTypeRedirects> {
   using Super = CompVisualImpl<TTypeRedirects>;
   CompVisual(typename TTypeRedirects::Visual const &visual) : CompVisualImpl<TTypeRedirects>(visual) {}
@@ -540,6 +851,23 @@ struct CompVisual : public winrt::implements<
   void SetClippingPath(ID2D1Geometry *clippingPath) noexcept override {
     Super::SetClippingPath(clippingPath);
   }
+
+  // IVisualRoundedRectangleClipInterop
+  void SetRoundedRectangleClip(
+      winrt::Windows::Foundation::Numerics::float2 const &size,
+      winrt::Windows::Foundation::Numerics::float2 const &topLeftRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &topRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomLeftRadius) noexcept override {
+    Super::SetRoundedRectangleClip(size, topLeftRadius, topRightRadius, bottomRightRadius, bottomLeftRadius);
+  }
+
+  // IVisualChildrenInterop
+  void InsertRangeAt(
+      winrt::array_view<const winrt::Microsoft::ReactNative::Composition::Experimental::IVisual> visuals,
+      uint32_t index) noexcept override {
+    Super::InsertRangeAt(visuals, index);
+  }
 };
 using WindowsCompVisual = CompVisual<WindowsTypeRedirects>;
 using MicrosoftCompVisual = CompVisual<MicrosoftTypeRedirects>;
@@ -550,7 +878,9 @@ struct CompSpriteVisual : winrt::implements<
                               winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual,
                               winrt::Microsoft::ReactNative::Composition::Experimental::IVisual,
                               typename TTypeRedirects::IInnerCompositionVisual,
-                              IVisualInterop>,
+                              IVisualInterop,
+                              IVisualRoundedRectangleClipInterop,
+                              IVisualChildrenInterop>,
                           CompVisualImpl<TTypeRedirects, typename TTypeRedirects::SpriteVisual> {
   using Super = CompVisualImpl<TTypeRedirects, typename TTypeRedirects::SpriteVisual>;
   CompSpriteVisual(typename TTypeRedirects::SpriteVisual const &visual) : Super(visual) {}
@@ -565,11 +895,30 @@ struct CompSpriteVisual : winrt::implements<
     Super::SetClippingPath(clippingPath);
   }
 
+  // IVisualRoundedRectangleClipInterop
+  void SetRoundedRectangleClip(
+      winrt::Windows::Foundation::Numerics::float2 const &size,
+      winrt::Windows::Foundation::Numerics::float2 const &topLeftRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &topRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomRightRadius,
+      winrt::Windows::Foundation::Numerics::float2 const &bottomLeftRadius) noexcept override {
+    Super::SetRoundedRectangleClip(size, topLeftRadius, topRightRadius, bottomRightRadius, bottomLeftRadius);
+  }
+
+  // IVisualChildrenInterop
+  void InsertRangeAt(
+      winrt::array_view<const winrt::Microsoft::ReactNative::Composition::Experimental::IVisual> visuals,
+      uint32_t index) noexcept override {
+    Super::InsertRangeAt(visuals, index);
+  }
+
   void Brush(const winrt::Microsoft::ReactNative::Composition::Experimental::IBrush &brush) noexcept {
+    TrackCompositionWork(CompositionWork::BrushUpdate);
     Super::m_visual.Brush(TTypeRedirects::CompositionContextHelper::InnerBrush(brush));
   }
 
   void Shadow(const winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow &shadow) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     Super::m_visual.Shadow(TTypeRedirects::CompositionContextHelper::InnerDropShadow(shadow));
   }
 };
@@ -605,6 +954,7 @@ struct CompRoundedRectangleVisual
   }
 
   void Size(winrt::Windows::Foundation::Numerics::float2 const &size) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_size = size;
     Super::m_visual.Size(size);
     updateGeometry();
@@ -619,6 +969,7 @@ struct CompRoundedRectangleVisual
   void RelativeSizeWithOffset(
       winrt::Windows::Foundation::Numerics::float2 size,
       winrt::Windows::Foundation::Numerics::float2 relativeSizeAdjustment) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     assert(false); // Does not correctly handle relativeSizeAdjustment - since geometry does not support
                    // RelativeSizeAdjustment
     m_size = size;
@@ -629,19 +980,23 @@ struct CompRoundedRectangleVisual
   }
 
   void Brush(const winrt::Microsoft::ReactNative::Composition::Experimental::IBrush &brush) noexcept {
+    TrackCompositionWork(CompositionWork::BrushUpdate);
     m_spriteShape.FillBrush(TTypeRedirects::CompositionContextHelper::InnerBrush(brush));
   }
 
   void CornerRadius(winrt::Windows::Foundation::Numerics::float2 value) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_cornerRadius = value;
     updateGeometry();
   }
 
   void StrokeBrush(const winrt::Microsoft::ReactNative::Composition::Experimental::IBrush &brush) noexcept {
+    TrackCompositionWork(CompositionWork::BrushUpdate);
     m_spriteShape.StrokeBrush(TTypeRedirects::CompositionContextHelper::InnerBrush(brush));
   }
 
   void StrokeThickness(float value) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_strokeThickness = value;
     m_spriteShape.StrokeThickness(value);
     updateGeometry();
@@ -677,6 +1032,7 @@ struct CompScrollerVisual : winrt::implements<
                                 winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual,
                                 winrt::Microsoft::ReactNative::Composition::Experimental::IVisual,
                                 typename TTypeRedirects::IInnerCompositionVisual,
+                                typename TTypeRedirects::IInnerCompositionScrollVisual,
                                 IVisualInterop> {
   struct ScrollInteractionTrackerOwner
       : public winrt::implements<ScrollInteractionTrackerOwner, typename TTypeRedirects::IInteractionTrackerOwner> {
@@ -788,6 +1144,11 @@ struct CompScrollerVisual : winrt::implements<
     return m_visual;
   }
 
+  // IInnerCompositionScrollVisual
+  typename TTypeRedirects::InteractionTracker InnerInteractionTracker() const noexcept override {
+    return m_interactionTracker;
+  }
+
   void OnPointerPressed(
       const winrt::Microsoft::ReactNative::Composition::Input::PointerRoutedEventArgs &args) noexcept {
     if constexpr (std::is_same_v<TTypeRedirects, MicrosoftTypeRedirects>) {
@@ -860,6 +1221,7 @@ struct CompScrollerVisual : winrt::implements<
   }
 
   void Brush(const winrt::Microsoft::ReactNative::Composition::Experimental::IBrush &brush) noexcept {
+    TrackCompositionWork(CompositionWork::BrushUpdate);
     m_visual.Brush(TTypeRedirects::CompositionContextHelper::InnerBrush(brush));
   }
 
@@ -921,26 +1283,32 @@ struct CompScrollerVisual : winrt::implements<
   }
 
   void Opacity(float opacity) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Opacity(opacity);
   }
 
   void Scale(winrt::Windows::Foundation::Numerics::float3 const &scale) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Scale(scale);
   }
 
   void TransformMatrix(winrt::Windows::Foundation::Numerics::float4x4 const &transform) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.TransformMatrix(transform);
   }
 
   void RotationAngle(float rotation) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.RotationAngle(rotation);
   }
 
   void IsVisible(bool isVisible) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.IsVisible(isVisible);
   }
 
   void Size(winrt::Windows::Foundation::Numerics::float2 const &size) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     bool sizeChanged = (m_visualSize.x != size.x || m_visualSize.y != size.y);
     m_visualSize = size;
     m_visual.Size(size);
@@ -951,12 +1319,14 @@ struct CompScrollerVisual : winrt::implements<
   }
 
   void Offset(winrt::Windows::Foundation::Numerics::float3 const &offset) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Offset(offset);
   }
 
   void Offset(
       winrt::Windows::Foundation::Numerics::float3 offset,
       winrt::Windows::Foundation::Numerics::float3 relativeAdjustment) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Offset(offset);
     m_visual.RelativeOffsetAdjustment(relativeAdjustment);
   }
@@ -964,6 +1334,7 @@ struct CompScrollerVisual : winrt::implements<
   void RelativeSizeWithOffset(
       winrt::Windows::Foundation::Numerics::float2 size,
       winrt::Windows::Foundation::Numerics::float2 relativeSizeAdjustment) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Size(size);
     m_visual.RelativeSizeAdjustment(relativeSizeAdjustment);
   }
@@ -974,6 +1345,7 @@ struct CompScrollerVisual : winrt::implements<
   }
 
   void BackfaceVisibility(winrt::Microsoft::ReactNative::Composition::Experimental::BackfaceVisibility value) {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.BackfaceVisibility(static_cast<typename TTypeRedirects::CompositionBackfaceVisibility>(value));
   }
 
@@ -986,6 +1358,7 @@ struct CompScrollerVisual : winrt::implements<
   }
 
   void SetClippingPath(ID2D1Geometry *clippingPath) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     if (!clippingPath) {
       m_visual.Clip(nullptr);
       return;
@@ -998,6 +1371,7 @@ struct CompScrollerVisual : winrt::implements<
   }
 
   void Shadow(const winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow &shadow) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Shadow(TTypeRedirects::CompositionContextHelper::InnerDropShadow(shadow));
   }
 
@@ -1740,6 +2114,7 @@ struct CompActivityVisual : winrt::implements<
   }
 
   void Brush(winrt::Microsoft::ReactNative::Composition::Experimental::IBrush brush) noexcept {
+    TrackCompositionWork(CompositionWork::BrushUpdate);
     auto innerBrush = TTypeRedirects::CompositionContextHelper::InnerBrush(brush);
     if (brush) {
       _themeProperties.InsertVector4(
@@ -1750,6 +2125,7 @@ struct CompActivityVisual : winrt::implements<
   }
 
   void Size(float radius) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     auto scale = radius / 40.0f;
     _root.Scale({scale, scale, 1.0f});
   }
@@ -1788,36 +2164,44 @@ struct CompActivityVisual : winrt::implements<
   }
 
   void Opacity(float opacity) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Opacity(opacity);
   }
 
   void Scale(winrt::Windows::Foundation::Numerics::float3 const &scale) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Scale(scale);
   }
 
   void TransformMatrix(winrt::Windows::Foundation::Numerics::float4x4 const &transform) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.TransformMatrix(transform);
   }
 
   void RotationAngle(float rotation) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.RotationAngle(rotation);
   }
 
   void IsVisible(bool isVisible) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.IsVisible(isVisible);
   }
 
   void Size(winrt::Windows::Foundation::Numerics::float2 const &size) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Size(size);
   }
 
   void Offset(winrt::Windows::Foundation::Numerics::float3 const &offset) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Offset(offset);
   }
 
   void Offset(
       winrt::Windows::Foundation::Numerics::float3 offset,
       winrt::Windows::Foundation::Numerics::float3 relativeAdjustment) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Offset(offset);
     m_visual.RelativeOffsetAdjustment(relativeAdjustment);
   }
@@ -1825,6 +2209,7 @@ struct CompActivityVisual : winrt::implements<
   void RelativeSizeWithOffset(
       winrt::Windows::Foundation::Numerics::float2 size,
       winrt::Windows::Foundation::Numerics::float2 relativeSizeAdjustment) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.Size(size);
     m_visual.RelativeSizeAdjustment(relativeSizeAdjustment);
   }
@@ -1835,6 +2220,7 @@ struct CompActivityVisual : winrt::implements<
   }
 
   void BackfaceVisibility(winrt::Microsoft::ReactNative::Composition::Experimental::BackfaceVisibility value) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     m_visual.BackfaceVisibility(static_cast<typename TTypeRedirects::CompositionBackfaceVisibility>(value));
   }
 
@@ -1847,6 +2233,7 @@ struct CompActivityVisual : winrt::implements<
   }
 
   void SetClippingPath(ID2D1Geometry *clippingPath) noexcept {
+    TrackCompositionWork(CompositionWork::PropertySet);
     if (!clippingPath) {
       m_visual.Clip(nullptr);
       return;
@@ -1923,6 +2310,7 @@ struct CompCaretVisual : winrt::implements<
   }
 
   void Brush(winrt::Microsoft::ReactNative::Composition::Experimental::IBrush brush) noexcept {
+    TrackCompositionWork(CompositionWork::BrushUpdate);
     m_compVisual.Brush(TTypeRedirects::CompositionContextHelper::InnerBrush(brush));
   }
 
@@ -2048,9 +2436,22 @@ struct CompContext : winrt::implements<
                          CompContext<TTypeRedirects>,
                          winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext,
                          typename TTypeRedirects::IInnerCompositionCompositor,
-                         ICompositionContextInterop> {
+                         ICompositionContextInterop,
+                         ::Microsoft::ReactNative::Composition::ICompositionDrawingSurfaceAtlas,
+                         ::Microsoft::ReactNative::Composition::ICompositionVirtualDrawingSurfaceFactory,
+                         ::Microsoft::ReactNative::Composition::ICompositionRenderingDeviceReplaced,
+                         ::Microsoft::ReactNative::Composition::ICompositionVisualCapture> {
   CompContext(typename TTypeRedirects::Compositor const &compositor) : m_compositor(compositor) {}
 
+  ~CompContext() {
+    if (m_deviceRemovedWait) {
+      ::SetThreadpoolWait(m_deviceRemovedWait, nullptr, nullptr);
+      ::WaitForThreadpoolWaitCallbacks(m_deviceRemovedWait, true /*fCancelPendingCallbacks*/);
+      ::CloseThreadpoolWait(m_deviceRemovedWait);
+    }
+    StopWatchingDevice();
+  }
+
   winrt::com_ptr<ID2D1Factory1> D2DFactory() noexcept {
     if (!m_d2dFactory) {
       // Initialize Direct2D resources.
@@ -2104,6 +2505,7 @@ struct CompContext : winrt::implements<
           nullptr /*&m_featureLevel*/, // returns feature level of device created
           nullptr /*&context*/ // returns the device immediate context
       );
+      WatchDevice();
     }
     return m_d3dDevice;
   }
@@ -2139,6 +2541,52 @@ struct CompContext : winrt::implements<
       winrt::Windows::Graphics::DirectX::DirectXPixelFormat pixelFormat,
       winrt::Windows::Graphics::DirectX::DirectXAlphaMode alphaMode) noexcept;
 
+  winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush CreateAtlasDrawingSurfaceBrush(
+      winrt::Windows::Foundation::Size surfaceSize) noexcept override {
+    auto width = static_cast<int32_t>(std::ceil(surfaceSize.Width)) + 2 * DrawingSurfaceAtlasGutter;
+    auto height = static_cast<int32_t>(std::ceil(surfaceSize.Height)) + 2 * DrawingSurfaceAtlasGutter;
+    if (surfaceSize.Width <= 0 || surfaceSize.Height <= 0 ||
+        width > DrawingSurfaceAtlasMaxWidth + 2 * DrawingSurfaceAtlasGutter ||
+        height > DrawingSurfaceAtlasMaxHeight + 2 * DrawingSurfaceAtlasGutter) {
+      return nullptr;
+    }
+    TrackCompositionWork(CompositionWork::ObjectCreation);
+
+    // Pages that are no longer used by any brush are released, except for the most recent one
+    if (m_atlasPages.size() > 1) {
+      m_atlasPages.erase(
+          std::remove_if(
+              m_atlasPages.begin(),
+              m_atlasPages.end() - 1,
+              [](const auto &page) noexcept { return page->packer.empty(); }),
+          m_atlasPages.end() - 1);
+    }
+
+    for (auto it = m_atlasPages.rbegin(); it != m_atlasPages.rend(); ++it) {
+      if (auto allocation = (*it)->packer.allocate(width, height)) {
+        return winrt::make<CompAtlasDrawingSurfaceBrush<TTypeRedirects>>(m_compositor, *it, *allocation);
+      }
+    }
+
+    auto page = std::make_shared<DrawingSurfaceAtlasPage<TTypeRedirects>>(CreateAtlasPageSurface());
+    auto allocation = page->packer.allocate(width, height);
+    m_atlasPages.push_back(page);
+    return winrt::make<CompAtlasDrawingSurfaceBrush<TTypeRedirects>>(m_compositor, std::move(page), *allocation);
+  }
+
+  typename TTypeRedirects::CompositionVirtualDrawingSurface CreateAtlasPageSurface() noexcept;
+
+  winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush CreateVirtualDrawingSurfaceBrush(
+      winrt::Windows::Foundation::Size surfaceSize) noexcept override {
+    TrackCompositionWork(CompositionWork::ObjectCreation);
+    return winrt::make<CompDrawingSurfaceBrush<TTypeRedirects>>(
+        m_compositor,
+        CompositionGraphicsDevice().CreateVirtualDrawingSurface(
+            {static_cast<int32_t>(std::ceil(surfaceSize.Width)), static_cast<int32_t>(std::ceil(surfaceSize.Height))},
+            winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+            winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied));
+  }
+
   winrt::Microsoft::ReactNative::Composition::Experimental::ICaretVisual CreateCaretVisual() noexcept;
 
   winrt::Microsoft::ReactNative::Composition::Experimental::IFocusVisual CreateFocusVisual() noexcept;
@@ -2149,37 +2597,210 @@ struct CompContext : winrt::implements<
     return m_compositor;
   }
 
+  winrt::event_token RenderingDeviceReplaced(winrt::delegate<> const &handler) noexcept override {
+    return m_renderingDeviceReplaced.add(handler);
+  }
+
+  void RenderingDeviceReplaced(winrt::event_token const &token) noexcept override {
+    m_renderingDeviceReplaced.remove(token);
+  }
+
+  winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Graphics::Imaging::SoftwareBitmap> CaptureVisualAsync(
+      winrt::Microsoft::ReactNative::Composition::Experimental::IVisual visual,
+      winrt::Windows::Graphics::SizeInt32 size) noexcept override {
+    auto strongThis = this->get_strong();
+    auto innerVisual = TTypeRedirects::CompositionContextHelper::InnerVisual(visual);
+    typename TTypeRedirects::ICompositionSurface surface{nullptr};
+    if constexpr (std::is_same_v<TTypeRedirects, MicrosoftTypeRedirects>) {
+      surface = co_await CompositionGraphicsDevice().CaptureAsync(
+          innerVisual,
+          size,
+          winrt::Microsoft::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+          winrt::Microsoft::Graphics::DirectX::DirectXAlphaMode::Premultiplied,
+          1.0f /*sdrBoost*/);
+    } else {
+      surface = co_await CompositionGraphicsDevice().CaptureAsync(
+          innerVisual,
+          size,
+          winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+          winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied,
+          1.0f /*sdrBoost*/);
+    }
+
+    if (!surface) {
+      co_return nullptr;
+    }
+    auto surfaceInterop = surface.template try_as<typename TTypeRedirects::ICompositionDrawingSurfaceInterop2>();
+    if (!surfaceInterop) {
+      co_return nullptr;
+    }
+    co_return CopySurfaceToBitmap(surfaceInterop.get(), size);
+  }
+
  private:
+  // Copies the surface to a bitmap through a staging texture, which the CPU can read
+  winrt::Windows::Graphics::Imaging::SoftwareBitmap CopySurfaceToBitmap(
+      typename TTypeRedirects::ICompositionDrawingSurfaceInterop2 *surfaceInterop,
+      winrt::Windows::Graphics::SizeInt32 size) {
+    D3D11_TEXTURE2D_DESC textureDesc{};
+    textureDesc.Width = static_cast<UINT>(size.Width);
+    textureDesc.Height = static_cast<UINT>(size.Height);
+    textureDesc.MipLevels = 1;
+    textureDesc.ArraySize = 1;
+    textureDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+    textureDesc.SampleDesc.Count = 1;
+    textureDesc.Usage = D3D11_USAGE_STAGING;
+    textureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+    winrt::com_ptr<ID3D11Texture2D> stagingTexture;
+    winrt::check_hresult(D3DDevice()->CreateTexture2D(&textureDesc, nullptr, stagingTexture.put()));
+    winrt::check_hresult(surfaceInterop->CopySurface(stagingTexture.get(), 0, 0, nullptr));
+
+    if (!m_d3dDeviceContext) {
+      D3DDevice()->GetImmediateContext(m_d3dDeviceContext.put());
+    }
+    D3D11_MAPPED_SUBRESOURCE mapped{};
+    winrt::check_hresult(m_d3dDeviceContext->Map(stagingTexture.get(), 0, D3D11_MAP_READ, 0, &mapped));
+
+    // The bitmap gets its own copy of the rows, so the texture is unmapped right away
+    winrt::com_ptr<IWICImagingFactory> imagingFactory;
+    winrt::com_ptr<IWICBitmap> wicBitmap;
+    auto hr = WICCreateImagingFactory_Proxy(WINCODEC_SDK_VERSION, imagingFactory.put());
+    if (SUCCEEDED(hr)) {
+      hr = imagingFactory->CreateBitmapFromMemory(
+          textureDesc.Width,
+          textureDesc.Height,
+          GUID_WICPixelFormat32bppPBGRA,
+          mapped.RowPitch,
+          mapped.RowPitch * textureDesc.Height,
+          static_cast<BYTE *>(mapped.pData),
+          wicBitmap.put());
+    }
+    m_d3dDeviceContext->Unmap(stagingTexture.get(), 0);
+    winrt::check_hresult(hr);
+
+    auto bitmapFactory = winrt::create_instance<ISoftwareBitmapNativeFactory>(CLSID_SoftwareBitmapNativeFactory);
+    winrt::Windows::Graphics::Imaging::SoftwareBitmap bitmap{nullptr};
+    winrt::check_hresult(bitmapFactory->CreateFromWICBitmap(
+        wicBitmap.get(),
+        true /*forceReadOnly*/,
+        winrt::guid_of<winrt::Windows::Graphics::Imaging::SoftwareBitmap>(),
+        winrt::put_abi(bitmap)));
+    return bitmap;
+  }
+
+  // Signals m_deviceRemovedEvent once the D3D device is removed
+  void WatchDevice() noexcept {
+    auto d3dDevice = m_d3dDevice.try_as<ID3D11Device4>();
+    if (!d3dDevice) {
+      return;
+    }
+
+    if (!m_deviceRemovedWait) {
+      m_dispatcherQueue = m_compositor.DispatcherQueue();
+      m_deviceRemovedEvent.attach(::CreateEvent(nullptr, false, false, nullptr));
+      if (!m_dispatcherQueue || !m_deviceRemovedEvent) {
+        return;
+      }
+      m_weakThis = this->get_weak();
+      m_deviceRemovedWait = ::CreateThreadpoolWait(&CompContext::OnDeviceRemoved, this, nullptr);
+      if (!m_deviceRemovedWait) {
+        return;
+      }
+    }
+
+    if (SUCCEEDED(d3dDevice->RegisterDeviceRemovedEvent(m_deviceRemovedEvent.get(), &m_deviceRemovedCookie))) {
+      m_watchedDevice = std::move(d3dDevice);
+      ::SetThreadpoolWait(m_deviceRemovedWait, m_deviceRemovedEvent.get(), nullptr);
+    }
+  }
+
+  void StopWatchingDevice() noexcept {
+    if (m_watchedDevice) {
+      m_watchedDevice->UnregisterDeviceRemoved(m_deviceRemovedCookie);
+      m_watchedDevice = nullptr;
+      m_deviceRemovedCookie = 0;
+    }
+  }
+
+  static void CALLBACK OnDeviceRemoved(
+      PTP_CALLBACK_INSTANCE /*instance*/,
+      PVOID context,
+      PTP_WAIT /*wait*/,
+      TP_WAIT_RESULT /*waitResult*/) noexcept {
+    auto self = static_cast<CompContext *>(context);
+    self->m_dispatcherQueue.TryEnqueue([weakThis = self->m_weakThis]() noexcept {
+      if (auto strongThis = weakThis.get()) {
+        strongThis->ReplaceRenderingDevice();
+      }
+    });
+  }
+
+  // Called on the compositor's thread.  The graphics device keeps its surfaces across the change of rendering device,
+  // only their content is lost.
+  void ReplaceRenderingDevice() noexcept {
+    if (!m_d3dDevice || SUCCEEDED(m_d3dDevice->GetDeviceRemovedReason())) {
+      return;
+    }
+
+    StopWatchingDevice();
+    m_d3dDeviceContext = nullptr;
+    m_d2dDevice = nullptr;
+    m_d3dDevice = nullptr;
+    if (!D3DDevice()) {
+      return;
+    }
+
+    if (m_compositionGraphicsDevice) {
+      winrt::check_hresult(
+          m_compositionGraphicsDevice.template as<typename TTypeRedirects::ICompositionGraphicsDeviceInterop>()
+              ->SetRenderingDevice(D2DDevice().get()));
+    }
+    m_renderingDeviceReplaced();
+  }
+
   typename TTypeRedirects::Compositor m_compositor{nullptr};
   winrt::com_ptr<ID2D1Factory1> m_d2dFactory;
   winrt::com_ptr<ID3D11Device> m_d3dDevice;
   winrt::com_ptr<ID2D1Device> m_d2dDevice;
   typename TTypeRedirects::CompositionGraphicsDevice m_compositionGraphicsDevice{nullptr};
   winrt::com_ptr<ID3D11DeviceContext> m_d3dDeviceContext;
+  std::vector<std::shared_ptr<DrawingSurfaceAtlasPage<TTypeRedirects>>> m_atlasPages;
+  decltype(std::declval<typename TTypeRedirects::Compositor>().DispatcherQueue()) m_dispatcherQueue{nullptr};
+  winrt::weak_ref<CompContext<TTypeRedirects>> m_weakThis;
+  winrt::com_ptr<ID3D11Device4> m_watchedDevice;
+  winrt::handle m_deviceRemovedEvent;
+  DWORD m_deviceRemovedCookie{0};
+  PTP_WAIT m_deviceRemovedWait{nullptr};
+  winrt::event<winrt::delegate<>> m_renderingDeviceReplaced;
 };
 
 winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual
 CompContext<WindowsTypeRedirects>::CreateSpriteVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompSpriteVisual>(m_compositor.CreateSpriteVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual
 CompContext<WindowsTypeRedirects>::CreateScrollerVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompScrollerVisual>(m_compositor.CreateSpriteVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IRoundedRectangleVisual
 CompContext<WindowsTypeRedirects>::CreateRoundedRectangleVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompRoundedRectangleVisual>(m_compositor.CreateShapeVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IActivityVisual
 CompContext<WindowsTypeRedirects>::CreateActivityVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompActivityVisual>(m_compositor.CreateSpriteVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow
 CompContext<WindowsTypeRedirects>::CreateDropShadow() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompDropShadow>(m_compositor.CreateDropShadow());
 }
 
@@ -2193,17 +2814,28 @@ CompContext<WindowsTypeRedirects>::CreateDrawingSurfaceBrush(
     winrt::Windows::Foundation::Size surfaceSize,
     winrt::Windows::Graphics::DirectX::DirectXPixelFormat pixelFormat,
     winrt::Windows::Graphics::DirectX::DirectXAlphaMode alphaMode) noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompDrawingSurfaceBrush>(
       m_compositor, CompositionGraphicsDevice().CreateDrawingSurface(surfaceSize, pixelFormat, alphaMode));
 }
 
+winrt::Windows::UI::Composition::CompositionVirtualDrawingSurface
+CompContext<WindowsTypeRedirects>::CreateAtlasPageSurface() noexcept {
+  return CompositionGraphicsDevice().CreateVirtualDrawingSurface(
+      {DrawingSurfaceAtlasPageSize, DrawingSurfaceAtlasPageSize},
+      winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+      winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+}
+
 winrt::Microsoft::ReactNative::Composition::Experimental::ICaretVisual
 CompContext<WindowsTypeRedirects>::CreateCaretVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompCaretVisual>(m_compositor);
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IFocusVisual
 CompContext<WindowsTypeRedirects>::CreateFocusVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::WindowsCompFocusVisual>(m_compositor);
 }
 
@@ -2230,26 +2862,31 @@ using WindowsCompContext = CompContext<WindowsTypeRedirects>;
 
 winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual
 CompContext<MicrosoftTypeRedirects>::CreateSpriteVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompSpriteVisual>(m_compositor.CreateSpriteVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual
 CompContext<MicrosoftTypeRedirects>::CreateScrollerVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompScrollerVisual>(m_compositor.CreateSpriteVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IRoundedRectangleVisual
 CompContext<MicrosoftTypeRedirects>::CreateRoundedRectangleVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompRoundedRectangleVisual>(m_compositor.CreateShapeVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IActivityVisual
 CompContext<MicrosoftTypeRedirects>::CreateActivityVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompActivityVisual>(m_compositor.CreateSpriteVisual());
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow
 CompContext<MicrosoftTypeRedirects>::CreateDropShadow() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompDropShadow>(m_compositor.CreateDropShadow());
 }
 
@@ -2263,6 +2900,7 @@ CompContext<MicrosoftTypeRedirects>::CreateDrawingSurfaceBrush(
     winrt::Windows::Foundation::Size surfaceSize,
     winrt::Windows::Graphics::DirectX::DirectXPixelFormat pixelFormat,
     winrt::Windows::Graphics::DirectX::DirectXAlphaMode alphaMode) noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompDrawingSurfaceBrush>(
       m_compositor,
       CompositionGraphicsDevice().CreateDrawingSurface(
@@ -2271,13 +2909,23 @@ CompContext<MicrosoftTypeRedirects>::CreateDrawingSurfaceBrush(
           static_cast<winrt::Microsoft::Graphics::DirectX::DirectXAlphaMode>(alphaMode)));
 }
 
+winrt::Microsoft::UI::Composition::CompositionVirtualDrawingSurface
+CompContext<MicrosoftTypeRedirects>::CreateAtlasPageSurface() noexcept {
+  return CompositionGraphicsDevice().CreateVirtualDrawingSurface(
+      {DrawingSurfaceAtlasPageSize, DrawingSurfaceAtlasPageSize},
+      winrt::Microsoft::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+      winrt::Microsoft::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+}
+
 winrt::Microsoft::ReactNative::Composition::Experimental::ICaretVisual
 CompContext<MicrosoftTypeRedirects>::CreateCaretVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompCaretVisual>(m_compositor);
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IFocusVisual
 CompContext<MicrosoftTypeRedirects>::CreateFocusVisual() noexcept {
+  TrackCompositionWork(CompositionWork::ObjectCreation);
   return winrt::make<Composition::Experimental::MicrosoftCompFocusVisual>(m_compositor);
 }
 
@@ -30,6 +30,13 @@ bool IsHiddenByParent(const winrt::Microsoft::ReactNative::ComponentView &view)
   return false;
 }
 
+const std::wstring &CachedUtf16(std::optional<std::wstring> &cached, const std::string &value) {
+  if (!cached) {
+    cached = ::Microsoft::Common::Unicode::Utf8ToUtf16(value);
+  }
+  return *cached;
+}
+
 CompositionDynamicAutomationProvider::CompositionDynamicAutomationProvider(
     const winrt::Microsoft::ReactNative::Composition::ComponentView &componentView) noexcept
     : m_view{componentView} {
@@ -156,6 +163,10 @@ winrt::IUnknown CompositionDynamicAutomationProvider::TryGetChildSiteLinkAutomat
   return nullptr;
 }
 
+void CompositionDynamicAutomationProvider::InvalidatePropertyCache() noexcept {
+  m_propertyCache = {};
+}
+
 HRESULT __stdcall CompositionDynamicAutomationProvider::get_FragmentRoot(IRawElementProviderFragmentRoot **pRetVal) {
   if (pRetVal == nullptr)
     return E_POINTER;
@@ -356,16 +367,16 @@ HRESULT __stdcall CompositionDynamicAutomationProvider::GetPropertyValue(PROPERT
     }
     case UIA_AutomationIdPropertyId: {
       pRetVal->vt = VT_BSTR;
-      auto wideTestId = ::Microsoft::Common::Unicode::Utf8ToUtf16(props->testId);
-      pRetVal->bstrVal = SysAllocString(wideTestId.c_str());
+      pRetVal->bstrVal = SysAllocString(CachedUtf16(m_propertyCache.AutomationId, props->testId).c_str());
       hr = pRetVal->bstrVal != nullptr ? S_OK : E_OUTOFMEMORY;
       break;
     }
     case UIA_NamePropertyId: {
       pRetVal->vt = VT_BSTR;
-      auto wideName = ::Microsoft::Common::Unicode::Utf8ToUtf16(
-          props->accessibilityLabel.empty() ? compositionView->DefaultAccessibleName() : props->accessibilityLabel);
-      pRetVal->bstrVal = SysAllocString(wideName.c_str());
+      // The default name can change without the props changing, so only a label is cached
+      pRetVal->bstrVal = props->accessibilityLabel.empty()
+          ? SysAllocString(::Microsoft::Common::Unicode::Utf8ToUtf16(compositionView->DefaultAccessibleName()).c_str())
+          : SysAllocString(CachedUtf16(m_propertyCache.Name, props->accessibilityLabel).c_str());
       hr = pRetVal->bstrVal != nullptr ? S_OK : E_OUTOFMEMORY;
       break;
     }
@@ -443,10 +454,9 @@ HRESULT __stdcall CompositionDynamicAutomationProvider::GetPropertyValue(PROPERT
     }
     case UIA_HelpTextPropertyId: {
       pRetVal->vt = VT_BSTR;
-      auto helpText = props->accessibilityHint.empty()
-          ? ::Microsoft::Common::Unicode::Utf8ToUtf16(compositionView->DefaultHelpText())
-          : ::Microsoft::Common::Unicode::Utf8ToUtf16(props->accessibilityHint);
-      pRetVal->bstrVal = SysAllocString(helpText.c_str());
+      pRetVal->bstrVal = props->accessibilityHint.empty()
+          ? SysAllocString(::Microsoft::Common::Unicode::Utf8ToUtf16(compositionView->DefaultHelpText()).c_str())
+          : SysAllocString(CachedUtf16(m_propertyCache.HelpText, props->accessibilityHint).c_str());
       hr = pRetVal->bstrVal != nullptr ? S_OK : E_OUTOFMEMORY;
       break;
     }
@@ -479,20 +489,20 @@ HRESULT __stdcall CompositionDynamicAutomationProvider::GetPropertyValue(PROPERT
     }
     case UIA_AccessKeyPropertyId: {
       pRetVal->vt = VT_BSTR;
-      auto accessKey = ::Microsoft::Common::Unicode::Utf8ToUtf16(props->accessibilityAccessKey.value_or(""));
-      pRetVal->bstrVal = SysAllocString(accessKey.c_str());
+      pRetVal->bstrVal = SysAllocString(
+          CachedUtf16(m_propertyCache.AccessKey, props->accessibilityAccessKey.value_or("")).c_str());
       break;
     }
     case UIA_ItemTypePropertyId: {
       pRetVal->vt = VT_BSTR;
-      auto itemtype = ::Microsoft::Common::Unicode::Utf8ToUtf16(props->accessibilityItemType.value_or(""));
-      pRetVal->bstrVal = SysAllocString(itemtype.c_str());
+      pRetVal->bstrVal =
+          SysAllocString(CachedUtf16(m_propertyCache.ItemType, props->accessibilityItemType.value_or("")).c_str());
       break;
     }
     case UIA_FullDescriptionPropertyId: {
       pRetVal->vt = VT_BSTR;
-      auto desc = ::Microsoft::Common::Unicode::Utf8ToUtf16(props->accessibilityDescription.value_or(""));
-      pRetVal->bstrVal = SysAllocString(desc.c_str());
+      pRetVal->bstrVal = SysAllocString(
+          CachedUtf16(m_propertyCache.FullDescription, props->accessibilityDescription.value_or("")).c_str());
       break;
     }
     case UIA_HeadingLevelPropertyId: {
@@ -107,13 +107,27 @@ class CompositionDynamicAutomationProvider : public winrt::implements<
   // This will be a provider object from the hosted framework (for example, WinUI).
   winrt::IUnknown TryGetChildSiteLinkAutomationProvider();
 
+  // Drops the UIA strings converted from the view's props, which must be called whenever the props change
+  void InvalidatePropertyCache() noexcept;
+
  private:
+  // UTF-16 copies of string props, converted the first time a client queries them
+  struct PropertyCache {
+    std::optional<std::wstring> AutomationId;
+    std::optional<std::wstring> Name;
+    std::optional<std::wstring> HelpText;
+    std::optional<std::wstring> AccessKey;
+    std::optional<std::wstring> ItemType;
+    std::optional<std::wstring> FullDescription;
+  };
+
   ::Microsoft::ReactNative::ReactTaggedView m_view;
   winrt::com_ptr<ITextProvider2> m_textProvider;
   winrt::com_ptr<IAnnotationProvider> m_annotationProvider;
   std::vector<winrt::com_ptr<IRawElementProviderSimple>> m_selectionItems;
   // Non-null when this UIA node is the peer of a ContentIslandComponentView.
   winrt::Microsoft::UI::Content::ChildSiteLink m_childSiteLink{nullptr};
+  PropertyCache m_propertyCache;
 };
 
 } // namespace winrt::Microsoft::ReactNative::implementation
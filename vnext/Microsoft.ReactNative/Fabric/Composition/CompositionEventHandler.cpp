@@ -28,6 +28,8 @@ struct IInputCursor;
 namespace Microsoft::ReactNative {
 
 const PointerId MOUSE_POINTER_ID = 1;
+// Pointer moves are sent to JS at most once per frame, at 60 frames per second
+constexpr std::chrono::duration<double> c_pointerMoveInterval{1.0 / 60.0};
 
 bool IsMousePointerEvent(const facebook::react::PointerEvent &pointerEvent) {
   return pointerEvent.pointerId == MOUSE_POINTER_ID;
@@ -339,6 +341,10 @@ CompositionEventHandler::~CompositionEventHandler() {
     }
   }
 
+  if (m_pointerMoveTimer) {
+    m_pointerMoveTimer.Stop();
+  }
+
   if (m_hcursorOwned) {
     ::DestroyCursor(m_hcursor);
     m_hcursor = nullptr;
@@ -362,6 +368,11 @@ CompositionEventHandler::RootComponentView() const noexcept {
 void CompositionEventHandler::onPointerWheelChanged(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  // Keep JS seeing the moves before the input that followed them
+  flushPointerMoves();
+  // The JS tasks that handle the input are attributed to it in the dispatch queue metrics
+  Mso::DispatchQueueMetrics::OriginScope originScope{"Event wheel"};
+
   if (std::shared_ptr<FabricUIManager> fabricuiManager =
           ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties())) {
     auto position = pointerPoint.Position();
@@ -533,6 +544,7 @@ int64_t CompositionEventHandler::SendMessage(HWND hwnd, uint32_t msg, uint64_t w
 
 void CompositionEventHandler::onKeyDown(
     const winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs &args) noexcept {
+  Mso::DispatchQueueMetrics::OriginScope originScope{"Event keyDown"};
   if (auto focusedComponent = RootComponentView().GetFocusedComponent()) {
     winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(focusedComponent)->OnKeyDown(args);
 
@@ -566,6 +578,7 @@ void CompositionEventHandler::onKeyDown(
 
 void CompositionEventHandler::onKeyUp(
     const winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs &args) noexcept {
+  Mso::DispatchQueueMetrics::OriginScope originScope{"Event keyUp"};
   if (auto focusedComponent = RootComponentView().GetFocusedComponent()) {
     winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(focusedComponent)->OnKeyUp(args);
 
@@ -598,6 +611,24 @@ std::vector<winrt::Microsoft::ReactNative::ComponentView> GetTouchableViewsInPat
   return results;
 }
 
+// Whether views are what GetTouchableViewsInPathToRoot returns for componentView, without building the path
+bool IsTouchableViewsInPathToRoot(
+    const winrt::Microsoft::ReactNative::ComponentView &componentView,
+    const std::vector<winrt::Microsoft::ReactNative::ComponentView> &views) {
+  size_t index = 0;
+  auto view = componentView;
+  while (view) {
+    if (winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(view)->eventEmitter()) {
+      if (index == views.size() || views[index] != view) {
+        return false;
+      }
+      index++;
+    }
+    view = view.Parent();
+  }
+  return index == views.size();
+}
+
 /**
  * Private method which is used for tracking the location of pointer events to manage the entering/leaving events.
  * The primary idea is that a pointer's presence & movement is dictated by a variety of underlying events such as
@@ -629,8 +660,28 @@ void CompositionEventHandler::HandleIncomingPointerEvent(
   auto prevTargetView = currentlyHoveredViews.empty() ? nullptr : currentlyHoveredViews[0];
   auto previousTargetTag = prevTargetView ? prevTargetView.Tag() : -1;
 
+  // Fast path for the pointer moving within the view it is already over, which enters and leaves nothing
+  if (IsTouchableViewsInPathToRoot(targetView, currentlyHoveredViews)) {
+    handler(currentlyHoveredViews);
+    if (IsMousePointerEvent(event)) {
+      UpdateCursor();
+    }
+    return;
+  }
+
   auto eventPathViews = GetTouchableViewsInPathToRoot(targetView);
 
+  // Both paths end at the root, the views they have in common are the ancestors from their lowest common ancestor up.
+  // Only the views below it in the new path are entered, and only the views below it in the old path are left.
+  size_t commonAncestorCount = 0;
+  while (commonAncestorCount < eventPathViews.size() && commonAncestorCount < currentlyHoveredViews.size() &&
+         eventPathViews[eventPathViews.size() - 1 - commonAncestorCount] ==
+             currentlyHoveredViews[currentlyHoveredViews.size() - 1 - commonAncestorCount]) {
+    commonAncestorCount++;
+  }
+  const size_t enteredViewCount = eventPathViews.size() - commonAncestorCount;
+  const size_t leftViewCount = currentlyHoveredViews.size() - commonAncestorCount;
+
   // Entering
 
   // We only want to emit events to JS if there is a view that is currently listening to said event
@@ -649,8 +700,7 @@ void CompositionEventHandler::HandleIncomingPointerEvent(
         (hasParentEnterListener ||
          IsViewListeningToEvent(componentView, facebook::react::WindowsViewEvents::Offset::MouseEnter));
 
-    if (std::find(currentlyHoveredViews.begin(), currentlyHoveredViews.end(), componentView) ==
-        currentlyHoveredViews.end()) {
+    if (static_cast<size_t>(eventPathViews.rend() - itComponentView) <= enteredViewCount) {
       auto args =
           winrt::make<winrt::Microsoft::ReactNative::Composition::Input::implementation::PointerRoutedEventArgs>(
               m_context, componentView.Tag(), pointerPoint, keyModifiers);
@@ -695,7 +745,7 @@ void CompositionEventHandler::HandleIncomingPointerEvent(
         (hasParentLeaveListener ||
          IsViewListeningToEvent(componentView, facebook::react::WindowsViewEvents::Offset::MouseLeave));
 
-    if (std::find(eventPathViews.begin(), eventPathViews.end(), componentView) == eventPathViews.end()) {
+    if (static_cast<size_t>(currentlyHoveredViews.rend() - itComponentView) <= leftViewCount) {
       if (shouldEmitJSEvent) {
         viewsToEmitJSLeaveEventsTo.push_back(componentView);
       }
@@ -728,12 +778,9 @@ void CompositionEventHandler::HandleIncomingPointerEvent(
   }
 
   std::vector<ReactTaggedView> hoveredViews;
-  std::shared_ptr<FabricUIManager> fabricuiManager =
-      ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties());
-  auto &viewRegistry = fabricuiManager->GetViewRegistry();
+  hoveredViews.reserve(eventPathViews.size());
   for (auto &view : eventPathViews) {
-    auto componentViewDescriptor = viewRegistry.componentViewDescriptorWithTag(view.Tag());
-    hoveredViews.emplace_back(ReactTaggedView(componentViewDescriptor.view));
+    hoveredViews.emplace_back(view);
   }
   m_currentlyHoveredViewsPerPointer[pointerId] = std::move(hoveredViews);
 
@@ -972,6 +1019,7 @@ void CompositionEventHandler::getTargetPointerArgs(
 void CompositionEventHandler::onPointerCaptureLost(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
   if (SurfaceId() == -1)
     return;
 
@@ -995,8 +1043,6 @@ void CompositionEventHandler::onPointerMoved(
 
   int pointerId = pointerPoint.PointerId();
 
-  auto position = pointerPoint.Position();
-
   if (std::shared_ptr<FabricUIManager> fabricuiManager =
           ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties())) {
     facebook::react::Tag tag = -1;
@@ -1013,36 +1059,106 @@ void CompositionEventHandler::onPointerMoved(
     winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(targetComponentView)
         ->OnPointerMoved(args);
 
-    auto targetView = FindClosestFabricManagedTouchableView(
-        fabricuiManager->GetViewRegistry().componentViewDescriptorWithTag(tag).view);
-
-    facebook::react::PointerEvent pointerEvent = CreatePointerEventFromIncompleteHoverData(ptScaled, ptLocal);
+    // Native components get every move, JS gets the latest move of each pointer once per frame, with the moves
+    // since the previous one as its coalesced events
+    auto &pendingMove = m_pendingPointerMoves[pointerId];
+    pendingMove.pointerPoint = pointerPoint;
+    pendingMove.keyModifiers = keyModifiers;
+    pendingMove.tag = tag;
+    pendingMove.ptScaled = ptScaled;
+    pendingMove.ptLocal = ptLocal;
+    pendingMove.coalescedEvents.push_back(CreatePointerEventFromIncompleteHoverData(ptScaled, ptLocal));
+
+    schedulePointerMoves();
+  }
+}
 
-    // check if this pointer corresponds to active touch that has a responder
-    auto activeTouch = m_activeTouches.find(pointerId);
-    bool isActiveTouch = activeTouch != m_activeTouches.end() && activeTouch->second.eventEmitter != nullptr;
+void CompositionEventHandler::schedulePointerMoves() noexcept {
+  if (m_pointerMovesScheduled) {
+    return;
+  }
 
-    auto handler = [&, targetView, pointerEvent, isActiveTouch](
-                       std::vector<winrt::Microsoft::ReactNative::ComponentView> &eventPathViews) {
-      const auto eventEmitter = targetView
-          ? winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(targetView)
-                ->eventEmitterAtPoint(pointerEvent.offsetPoint)
-          : RootComponentView().eventEmitterAtPoint(pointerEvent.offsetPoint);
+  const auto now = std::chrono::steady_clock::now();
+  const auto elapsed = now - m_lastPointerMovesTime;
+  if (elapsed >= c_pointerMoveInterval) {
+    flushPointerMoves();
+    return;
+  }
 
-      if (eventEmitter != nullptr) {
-        eventEmitter->onPointerMove(pointerEvent);
-      } else {
-        ClearAllHoveredForPointer(pointerEvent);
+  if (!m_pointerMoveTimer) {
+    m_pointerMoveTimer = winrt::Microsoft::ReactNative::Timer::Create(m_context.Properties().Handle());
+    m_pointerMoveTimer.Tick([wkThis = weak_from_this()](
+                                const winrt::Windows::Foundation::IInspectable &,
+                                const winrt::Windows::Foundation::IInspectable &) {
+      if (auto strongThis = wkThis.lock()) {
+        strongThis->flushPointerMoves();
       }
-    };
+    });
+  }
+  m_pointerMovesScheduled = true;
+  m_pointerMoveTimer.Interval(
+      std::chrono::duration_cast<winrt::Windows::Foundation::TimeSpan>(c_pointerMoveInterval - elapsed));
+  m_pointerMoveTimer.Start();
+}
 
-    HandleIncomingPointerEvent(pointerEvent, targetView, pointerPoint, keyModifiers, handler);
+void CompositionEventHandler::flushPointerMoves() noexcept {
+  if (m_pointerMovesScheduled) {
+    m_pointerMovesScheduled = false;
+    m_pointerMoveTimer.Stop();
+  }
+
+  if (m_pendingPointerMoves.empty()) {
+    return;
+  }
+  m_lastPointerMovesTime = std::chrono::steady_clock::now();
 
-    if (isActiveTouch) {
-      // For active touches with responders, also dispatch through touch event system
-      UpdateActiveTouch(activeTouch->second, ptScaled, ptLocal);
-      DispatchTouchEvent(TouchEventType::Move, pointerId, pointerPoint, keyModifiers);
+  // Dispatching can lead to pointer input being handled, which must not add to the moves being dispatched
+  auto pendingMoves = std::move(m_pendingPointerMoves);
+  m_pendingPointerMoves.clear();
+  if (SurfaceId() == -1)
+    return;
+
+  for (auto &[pointerId, pendingMove] : pendingMoves) {
+    dispatchPointerMove(pointerId, pendingMove);
+  }
+}
+
+void CompositionEventHandler::dispatchPointerMove(PointerId pointerId, PendingPointerMove &pendingMove) noexcept {
+  Mso::DispatchQueueMetrics::OriginScope originScope{"Event pointerMove"};
+  std::shared_ptr<FabricUIManager> fabricuiManager =
+      ::Microsoft::ReactNative::FabricUIManager::FromProperties(m_context.Properties());
+  if (!fabricuiManager)
+    return;
+
+  // The view under the pointer could have been unmounted since it moved
+  auto targetComponentView = fabricuiManager->GetViewRegistry().findComponentViewWithTag(pendingMove.tag);
+  auto targetView = FindClosestFabricManagedTouchableView(targetComponentView);
+
+  facebook::react::PointerEvent pointerEvent = pendingMove.coalescedEvents.back();
+
+  // check if this pointer corresponds to active touch that has a responder
+  auto activeTouch = m_activeTouches.find(pointerId);
+  bool isActiveTouch = activeTouch != m_activeTouches.end() && activeTouch->second.eventEmitter != nullptr;
+
+  auto handler = [&, targetView](std::vector<winrt::Microsoft::ReactNative::ComponentView> &eventPathViews) {
+    const auto eventEmitter = targetView
+        ? winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(targetView)
+              ->eventEmitterAtPoint(pointerEvent.offsetPoint)
+        : RootComponentView().eventEmitterAtPoint(pointerEvent.offsetPoint);
+
+    if (eventEmitter != nullptr) {
+      eventEmitter->onCoalescedPointerMove(pointerEvent, std::move(pendingMove.coalescedEvents));
+    } else {
+      ClearAllHoveredForPointer(pointerEvent);
     }
+  };
+
+  HandleIncomingPointerEvent(pointerEvent, targetView, pendingMove.pointerPoint, pendingMove.keyModifiers, handler);
+
+  if (isActiveTouch) {
+    // For active touches with responders, also dispatch through touch event system
+    UpdateActiveTouch(activeTouch->second, pendingMove.ptScaled, pendingMove.ptLocal);
+    DispatchTouchEvent(TouchEventType::Move, pointerId, pendingMove.pointerPoint, pendingMove.keyModifiers);
   }
 }
 
@@ -1066,6 +1182,7 @@ void CompositionEventHandler::ClearAllHoveredForPointer(const facebook::react::P
 void CompositionEventHandler::onPointerExited(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
   if (SurfaceId() == -1)
     return;
 
@@ -1096,6 +1213,8 @@ void CompositionEventHandler::onPointerExited(
 void CompositionEventHandler::onPointerPressed(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
+  Mso::DispatchQueueMetrics::OriginScope originScope{"Event pointerDown"};
   namespace Composition = winrt::Microsoft::ReactNative::Composition;
 
   // Clears any active text selection when left pointer is pressed
@@ -1168,6 +1287,8 @@ void CompositionEventHandler::onPointerPressed(
 void CompositionEventHandler::onPointerReleased(
     const winrt::Microsoft::ReactNative::Composition::Input::PointerPoint &pointerPoint,
     winrt::Windows::System::VirtualKeyModifiers keyModifiers) noexcept {
+  flushPointerMoves();
+  Mso::DispatchQueueMetrics::OriginScope originScope{"Event pointerUp"};
   int pointerId = pointerPoint.PointerId();
 
   auto activeTouch = std::find_if(m_activeTouches.begin(), m_activeTouches.end(), [pointerId](const auto &pair) {
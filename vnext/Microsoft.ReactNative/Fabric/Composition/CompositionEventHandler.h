@@ -12,6 +12,7 @@
 #include <react/renderer/components/view/TouchEventEmitter.h>
 #include <winrt/Microsoft.ReactNative.h>
 #include <winrt/Windows.Devices.Input.h>
+#include <chrono>
 #include <optional>
 #include <set>
 
@@ -100,6 +101,20 @@ class CompositionEventHandler : public std::enable_shared_from_this<CompositionE
       std::function<void(std::vector<winrt::Microsoft::ReactNative::ComponentView> &)> handler);
   void ClearAllHoveredForPointer(const facebook::react::PointerEvent &pointerEvent) noexcept;
 
+  // The latest move of a pointer that is yet to be sent to JS
+  struct PendingPointerMove {
+    winrt::Microsoft::ReactNative::Composition::Input::PointerPoint pointerPoint{nullptr};
+    winrt::Windows::System::VirtualKeyModifiers keyModifiers{winrt::Windows::System::VirtualKeyModifiers::None};
+    facebook::react::Tag tag{-1};
+    facebook::react::Point ptScaled;
+    facebook::react::Point ptLocal;
+    // Every move since the previous one sent to JS, ending with the latest move
+    std::vector<facebook::react::PointerEvent> coalescedEvents;
+  };
+  void schedulePointerMoves() noexcept;
+  void flushPointerMoves() noexcept;
+  void dispatchPointerMove(PointerId pointerId, PendingPointerMove &pendingMove) noexcept;
+
   struct ActiveTouch {
     facebook::react::Touch touch;
     facebook::react::SharedTouchEventEmitter eventEmitter;
@@ -156,6 +171,10 @@ class CompositionEventHandler : public std::enable_shared_from_this<CompositionE
   PointerId m_touchId = 0;
 
   std::map<PointerId, std::vector<ReactTaggedView>> m_currentlyHoveredViewsPerPointer;
+  std::map<PointerId, PendingPointerMove> m_pendingPointerMoves;
+  winrt::Microsoft::ReactNative::ITimer m_pointerMoveTimer{nullptr};
+  std::chrono::steady_clock::time_point m_lastPointerMovesTime;
+  bool m_pointerMovesScheduled{false};
   winrt::weak_ref<winrt::Microsoft::ReactNative::ReactNativeIsland> m_wkRootView;
   winrt::Microsoft::ReactNative::ReactContext m_context;
 
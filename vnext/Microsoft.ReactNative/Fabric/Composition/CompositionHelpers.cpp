@@ -15,9 +15,103 @@
 #include <windows.ui.composition.interop.h>
 #include <winrt/Windows.Graphics.DirectX.Direct3D11.h>
 #include <winrt/Windows.UI.Composition.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
 
 namespace Microsoft::ReactNative {
 
+namespace Composition {
+
+winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush CreateAtlasOrDrawingSurfaceBrush(
+    winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext const &compContext,
+    winrt::Windows::Foundation::Size surfaceSize) noexcept {
+  winrt::com_ptr<ICompositionDrawingSurfaceAtlas> atlas;
+  compContext.try_as(atlas);
+  if (atlas) {
+    if (auto surface = atlas->CreateAtlasDrawingSurfaceBrush(surfaceSize)) {
+      return surface;
+    }
+  }
+
+  return compContext.CreateDrawingSurfaceBrush(
+      surfaceSize,
+      winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+      winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+}
+
+static thread_local DrawingSurfaceOwner t_drawingSurfaceOwner{DrawingSurfaceOwner::Other};
+
+DrawingSurfaceOwnerScope::DrawingSurfaceOwnerScope(DrawingSurfaceOwner owner) noexcept
+    : m_previousOwner(std::exchange(t_drawingSurfaceOwner, owner)) {}
+
+DrawingSurfaceOwnerScope::~DrawingSurfaceOwnerScope() noexcept {
+  t_drawingSurfaceOwner = m_previousOwner;
+}
+
+DrawingSurfaceOwner DrawingSurfaceOwnerScope::Current() noexcept {
+  return t_drawingSurfaceOwner;
+}
+
+struct LiveDrawingSurfaces {
+  std::atomic<int32_t> count{0};
+  std::atomic<int64_t> byteCount{0};
+};
+
+static std::atomic<int32_t> s_liveVisuals{0};
+static std::array<LiveDrawingSurfaces, static_cast<size_t>(DrawingSurfaceOwner::Count)> s_liveDrawingSurfaces;
+
+void TrackLiveVisuals(int32_t delta) noexcept {
+  s_liveVisuals.fetch_add(delta, std::memory_order_relaxed);
+}
+
+void TrackLiveDrawingSurface(DrawingSurfaceOwner owner, int32_t countDelta, int64_t byteDelta) noexcept {
+  auto &surfaces = s_liveDrawingSurfaces[static_cast<size_t>(owner)];
+  surfaces.count.fetch_add(countDelta, std::memory_order_relaxed);
+  surfaces.byteCount.fetch_add(byteDelta, std::memory_order_relaxed);
+}
+
+uint32_t LiveVisualCount() noexcept {
+  return static_cast<uint32_t>(std::max(0, s_liveVisuals.load(std::memory_order_relaxed)));
+}
+
+uint64_t LiveDrawingSurfaceBytes() noexcept {
+  uint64_t byteCount = 0;
+  for (size_t owner = 0; owner < s_liveDrawingSurfaces.size(); ++owner) {
+    byteCount += LiveDrawingSurfaceUsage(static_cast<DrawingSurfaceOwner>(owner)).ByteCount;
+  }
+  return byteCount;
+}
+
+DrawingSurfaceUsage LiveDrawingSurfaceUsage(DrawingSurfaceOwner owner) noexcept {
+  auto &surfaces = s_liveDrawingSurfaces[static_cast<size_t>(owner)];
+  return {
+      static_cast<uint32_t>(std::max(0, surfaces.count.load(std::memory_order_relaxed))),
+      static_cast<uint64_t>(std::max<int64_t>(0, surfaces.byteCount.load(std::memory_order_relaxed)))};
+}
+
+static thread_local CompositionWorkCounts t_compositionWork;
+
+void TrackCompositionWork(CompositionWork work) noexcept {
+  switch (work) {
+    case CompositionWork::ObjectCreation:
+      ++t_compositionWork.ObjectCreations;
+      break;
+    case CompositionWork::PropertySet:
+      ++t_compositionWork.PropertySets;
+      break;
+    case CompositionWork::BrushUpdate:
+      ++t_compositionWork.BrushUpdates;
+      break;
+  }
+}
+
+CompositionWorkCounts CurrentThreadCompositionWork() noexcept {
+  return t_compositionWork;
+}
+
+} // namespace Composition
+
 bool CheckForDeviceRemoved(HRESULT hr) {
   if (SUCCEEDED(hr)) {
     // Everything is fine -- go ahead and draw
@@ -6,6 +6,9 @@
 
 #include <CompositionSwitcher.Experimental.interop.h>
 #include <guid/msoGuid.h>
+#include <winrt/Microsoft.UI.Composition.Interactions.h>
+#include <winrt/Windows.Graphics.Imaging.h>
+#include <winrt/Windows.UI.Composition.Interactions.h>
 #include <winrt/Windows.UI.Composition.h>
 
 namespace Microsoft::ReactNative {
@@ -42,6 +45,13 @@ struct IWindowsCompositionDrawingSurfaceInner : public IUnknown {
   virtual winrt::Windows::UI::Composition::ICompositionSurface Inner() const noexcept = 0;
 };
 
+// Windows composition specific interface to extract the interaction tracker that scrolls a scroll visual
+MSO_STRUCT_GUID(IWindowsCompositionScrollVisual, "E3A06F5B-7C2D-4B18-9A4E-5D61C0B8F297")
+struct IWindowsCompositionScrollVisual : public IUnknown {
+  virtual winrt::Windows::UI::Composition::Interactions::InteractionTracker InnerInteractionTracker()
+      const noexcept = 0;
+};
+
 // Windows composition specific interface to extract the inner compositor object
 MSO_STRUCT_GUID(IMicrosoftCompositionCompositor, "B7B3E027-6A87-4946-B397-247AAB8634C6")
 struct IMicrosoftCompositionCompositor : public IUnknown {
@@ -72,6 +82,139 @@ struct IMicrosoftCompositionDrawingSurfaceInner : public IUnknown {
   virtual winrt::Microsoft::UI::Composition::ICompositionSurface Inner() const noexcept = 0;
 };
 
+// Microsoft composition specific interface to extract the interaction tracker that scrolls a scroll visual, so that
+// composition animations can follow the scroll position on the compositor
+MSO_STRUCT_GUID(IMicrosoftCompositionScrollVisual, "9B4D2E81-3F6A-4C57-B0D9-A81E6F3C2B44")
+struct IMicrosoftCompositionScrollVisual : public IUnknown {
+  virtual winrt::Microsoft::UI::Composition::Interactions::InteractionTracker InnerInteractionTracker()
+      const noexcept = 0;
+};
+
+// Implemented by composition contexts that can sub-allocate small drawing surfaces from shared atlas pages, so that
+// thousands of small views do not each need their own surface
+MSO_STRUCT_GUID(ICompositionDrawingSurfaceAtlas, "0C5C4FA4-5B7B-4D8A-9B0E-3F6A3F1E2D71")
+struct ICompositionDrawingSurfaceAtlas : public IUnknown {
+  // Returns a B8G8R8A8UIntNormalized premultiplied surface, or nullptr if the size is too large to be worth sharing
+  // a page.  The surface is always drawn unstretched at the top left of the visual, and the brush ignores Stretch and
+  // the alignment ratios, so it must only be used on visuals that are the size of the surface.
+  virtual winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush CreateAtlasDrawingSurfaceBrush(
+      winrt::Windows::Foundation::Size surfaceSize) noexcept = 0;
+};
+
+// Implemented by drawing surface brushes that can redraw part of their surface, keeping the rest of its content
+MSO_STRUCT_GUID(ICompositionDrawingSurfaceUpdate, "6E0B3D52-93C4-4F0B-A4D7-58C1E2B9F6A3")
+struct ICompositionDrawingSurfaceUpdate : public IUnknown {
+  // The update rect is in pixels of the surface.  Unlike ICompositionDrawingSurfaceInterop::BeginDraw there is no
+  // offset to apply: the device context is transformed so that drawing uses the DIPs of the surface, and clipped to
+  // the update rect, which the caller has to clear.  Drawing is ended with ICompositionDrawingSurfaceInterop::EndDraw.
+  virtual HRESULT BeginDrawUpdate(
+      const RECT &updateRect,
+      ID2D1DeviceContext **deviceContextOut,
+      float xDpi,
+      float yDpi) noexcept = 0;
+};
+
+// Implemented by composition contexts that can create virtual drawing surfaces, which only use memory for the parts
+// that have been drawn, so they can be much larger than a regular surface
+MSO_STRUCT_GUID(ICompositionVirtualDrawingSurfaceFactory, "A3F1C6D8-2E4B-4C79-8D15-B07E9A6C4F20")
+struct ICompositionVirtualDrawingSurfaceFactory : public IUnknown {
+  // Returns a B8G8R8A8UIntNormalized premultiplied surface, which implements ICompositionDrawingSurfaceUpdate and
+  // ICompositionVirtualDrawingSurface.  Drawing the whole surface at once would defeat its purpose.
+  virtual winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush
+  CreateVirtualDrawingSurfaceBrush(winrt::Windows::Foundation::Size surfaceSize) noexcept = 0;
+};
+
+MSO_STRUCT_GUID(ICompositionVirtualDrawingSurface, "5D9E2B47-C1A8-4E36-9F0B-72D4E8A1B3C5")
+struct ICompositionVirtualDrawingSurface : public IUnknown {
+  // Discards the content of the surface outside the rects, which are in pixels of the surface
+  virtual void Trim(const RECT *rects, uint32_t rectCount) noexcept = 0;
+};
+
+// Implemented by composition contexts that recover from the loss of their D3D device, when the GPU is reset or its
+// driver is updated.  The content of every drawing surface is lost with the device.
+MSO_STRUCT_GUID(ICompositionRenderingDeviceReplaced, "E1C7A93B-4D2F-4B85-A6E0-3F98D15C2B74")
+struct ICompositionRenderingDeviceReplaced : public IUnknown {
+  // Raised on the compositor's thread once the context renders with a new device, after which the drawing surfaces
+  // have to be redrawn
+  virtual winrt::event_token RenderingDeviceReplaced(winrt::delegate<> const &handler) noexcept = 0;
+  virtual void RenderingDeviceReplaced(winrt::event_token const &token) noexcept = 0;
+};
+
+// Implemented by composition contexts that can render a visual tree offscreen, so the visuals do not need to be
+// connected to a window or a content island
+MSO_STRUCT_GUID(ICompositionVisualCapture, "C2E84B17-6A3D-4F95-B8E1-0D7C5A29F4B6")
+struct ICompositionVisualCapture : public IUnknown {
+  // Renders the visual and its children to a Bgra8 premultiplied bitmap of the size, in pixels, which wraps an
+  // IWICBitmap.  The bitmap is null if the compositor cannot capture visuals.  Must be called on the compositor's
+  // thread.
+  virtual winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Graphics::Imaging::SoftwareBitmap>
+  CaptureVisualAsync(
+      winrt::Microsoft::ReactNative::Composition::Experimental::IVisual visual,
+      winrt::Windows::Graphics::SizeInt32 size) noexcept = 0;
+};
+
+// Creates a B8G8R8A8UIntNormalized premultiplied surface from the context's atlas when possible, see
+// ICompositionDrawingSurfaceAtlas, and a separate surface otherwise
+winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush CreateAtlasOrDrawingSurfaceBrush(
+    winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext const &compContext,
+    winrt::Windows::Foundation::Size surfaceSize) noexcept;
+
+// What a drawing surface is drawn with, so that the memory report can tell which content uses the surface memory
+enum class DrawingSurfaceOwner {
+  Other,
+  Text,
+  Border,
+  Image,
+  Count,
+};
+
+// Attributes the drawing surfaces created on the current thread while the scope is alive to the owner
+class DrawingSurfaceOwnerScope final {
+ public:
+  explicit DrawingSurfaceOwnerScope(DrawingSurfaceOwner owner) noexcept;
+  ~DrawingSurfaceOwnerScope() noexcept;
+
+  DrawingSurfaceOwnerScope(const DrawingSurfaceOwnerScope &) = delete;
+  DrawingSurfaceOwnerScope &operator=(const DrawingSurfaceOwnerScope &) = delete;
+
+  static DrawingSurfaceOwner Current() noexcept;
+
+ private:
+  DrawingSurfaceOwner m_previousOwner;
+};
+
+struct DrawingSurfaceUsage {
+  uint32_t Count{0};
+  uint64_t ByteCount{0};
+};
+
+// Counts of the visuals and of the drawing surfaces that are alive across all composition contexts, shown by the
+// PerformanceOverlay and the memory report.  The bytes of virtual surfaces, such as the pages of the drawing surface
+// atlas, are not counted, since they only use memory where they have been drawn to.
+void TrackLiveVisuals(int32_t delta) noexcept;
+void TrackLiveDrawingSurface(DrawingSurfaceOwner owner, int32_t countDelta, int64_t byteDelta) noexcept;
+uint32_t LiveVisualCount() noexcept;
+uint64_t LiveDrawingSurfaceBytes() noexcept;
+DrawingSurfaceUsage LiveDrawingSurfaceUsage(DrawingSurfaceOwner owner) noexcept;
+
+enum class CompositionWork {
+  ObjectCreation,
+  PropertySet,
+  BrushUpdate,
+};
+
+struct CompositionWorkCounts {
+  uint32_t ObjectCreations{0};
+  uint32_t PropertySets{0};
+  uint32_t BrushUpdates{0};
+};
+
+// Counts of the composition objects created, of the properties set on visuals and shadows, and of the brushes set on
+// visuals by the current thread.  They only ever grow: the FabricUIManager reads them before and after each mount, to
+// tell how much composition work a transaction caused.
+void TrackCompositionWork(CompositionWork work) noexcept;
+CompositionWorkCounts CurrentThreadCompositionWork() noexcept;
+
 } // namespace Composition
 
 bool CheckForDeviceRemoved(HRESULT hr);
@@ -49,4 +49,13 @@ winrt::Microsoft::ReactNative::ComponentView CompositionUIService::ComponentFrom
   return nullptr;
 }
 
+void CompositionUIService::SetPerformanceOverlayVisible(
+    const winrt::Microsoft::ReactNative::IReactContext &context,
+    bool visible) noexcept {
+  if (std::shared_ptr<::Microsoft::ReactNative::FabricUIManager> fabricuiManager =
+          ::Microsoft::ReactNative::FabricUIManager::FromProperties(ReactPropertyBag(context.Properties()))) {
+    fabricuiManager->setPerformanceOverlayVisible(visible);
+  }
+}
+
 } // namespace winrt::Microsoft::ReactNative::Composition::implementation
@@ -20,6 +20,10 @@ struct CompositionUIService : CompositionUIServiceT<CompositionUIService> {
   static winrt::Microsoft::ReactNative::ComponentView ComponentFromReactTag(
       const winrt::Microsoft::ReactNative::IReactContext &context,
       int64_t reactTag) noexcept;
+
+  static void SetPerformanceOverlayVisible(
+      const winrt::Microsoft::ReactNative::IReactContext &context,
+      bool visible) noexcept;
 };
 
 } // namespace winrt::Microsoft::ReactNative::Composition::implementation
@@ -34,7 +34,7 @@ namespace winrt::Microsoft::ReactNative::Composition::implementation {
 constexpr float FOCUS_VISUAL_WIDTH = 2.0f;
 constexpr float FOCUS_VISUAL_RADIUS = 3.0f;
 
-// m_outerVisual
+// m_outerVisual (plain Views without one use m_visual as their outer visual, see ViewComponentView::ensureVisual)
 //   |
 //   |
 //   ----- m_visual <-- Background / clip - Can be a custom visual depending on Component type
@@ -49,15 +49,56 @@ constexpr float FOCUS_VISUAL_RADIUS = 3.0f;
 //                     |
 //                     ------ Border Visuals x N (BorderPrimitive)
 
+ViewPropsDirtyFlags DiffViewProps(
+    const facebook::react::ViewProps &oldViewProps,
+    const facebook::react::ViewProps &newViewProps) noexcept {
+  auto flags = ViewPropsDirtyFlags::None;
+
+  if (oldViewProps.borderColors != newViewProps.borderColors || oldViewProps.borderRadii != newViewProps.borderRadii ||
+      !(oldViewProps.yogaStyle.border(facebook::yoga::Edge::All) ==
+        newViewProps.yogaStyle.border(facebook::yoga::Edge::All)) ||
+      oldViewProps.borderStyles != newViewProps.borderStyles) {
+    flags |= ViewPropsDirtyFlags::Border;
+  }
+
+  if (oldViewProps.borderRadii != newViewProps.borderRadii) {
+    flags |= ViewPropsDirtyFlags::Clipping;
+  }
+
+  if (oldViewProps.backgroundColor != newViewProps.backgroundColor) {
+    flags |= ViewPropsDirtyFlags::Background;
+  }
+
+  if (oldViewProps.shadowOffset != newViewProps.shadowOffset || oldViewProps.shadowColor != newViewProps.shadowColor ||
+      oldViewProps.shadowOpacity != newViewProps.shadowOpacity ||
+      oldViewProps.shadowRadius != newViewProps.shadowRadius || oldViewProps.boxShadow != newViewProps.boxShadow) {
+    flags |= ViewPropsDirtyFlags::Shadow;
+  }
+
+  if (oldViewProps.transform != newViewProps.transform ||
+      oldViewProps.backfaceVisibility != newViewProps.backfaceVisibility) {
+    flags |= ViewPropsDirtyFlags::Transform;
+  }
+
+  if (oldViewProps.opacity != newViewProps.opacity) {
+    flags |= ViewPropsDirtyFlags::Opacity;
+  }
+
+  return flags;
+}
+
 ComponentView::ComponentView(
     const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext,
     facebook::react::Tag tag,
     winrt::Microsoft::ReactNative::ReactContext const &reactContext,
     ComponentViewFeatures flags,
-    winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder)
+    winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder,
+    bool collapseOuterVisual)
     : base_type(tag, reactContext, builder), m_compContext(compContext), m_flags(flags) {
-  m_outerVisual = compContext.CreateSpriteVisual(); // TODO could be a raw ContainerVisual if we had a
-                                                    // CreateContainerVisual in ICompositionContext
+  if (!collapseOuterVisual) {
+    m_outerVisual = compContext.CreateSpriteVisual(); // TODO could be a raw ContainerVisual if we had a
+                                                      // CreateContainerVisual in ICompositionContext
+  }
 }
 
 ComponentView::~ComponentView() {
@@ -105,6 +146,9 @@ void ComponentView::onThemeChanged() noexcept {
     applyShadowProps(*viewProps());
   }
 
+  // Whether a border is required depends on the theme's colors
+  m_dirtyProps |= ViewPropsDirtyFlags::Border;
+
   base_type::onThemeChanged();
 
   if (m_themeChangedEvent) {
@@ -149,8 +193,11 @@ void ComponentView::updateProps(
       oldProps ? (*std::static_pointer_cast<const facebook::react::ViewProps>(oldProps)) : (*viewProps());
   const auto &newViewProps = *std::static_pointer_cast<const facebook::react::ViewProps>(props);
 
+  auto dirtyProps = DiffViewProps(oldViewProps, newViewProps);
+  m_dirtyProps |= dirtyProps;
+
   if ((m_flags & ComponentViewFeatures::Background) == ComponentViewFeatures::Background) {
-    if (oldViewProps.backgroundColor != newViewProps.backgroundColor) {
+    if (HasAnyDirtyFlag(dirtyProps, ViewPropsDirtyFlags::Background)) {
       if (newViewProps.backgroundColor) {
         Visual().as<Experimental::ISpriteVisual>().Brush(theme()->Brush(*newViewProps.backgroundColor));
       } else {
@@ -159,8 +206,8 @@ void ComponentView::updateProps(
     }
   }
 
-  if (m_borderPrimitive) {
-    m_borderPrimitive->updateProps(oldViewProps, newViewProps);
+  if (m_borderPrimitive && HasAnyDirtyFlag(dirtyProps, ViewPropsDirtyFlags::Border)) {
+    m_borderPrimitive->markNeedsUpdate();
   }
 
   if (m_componentHostingFocusVisual) {
@@ -169,17 +216,18 @@ void ComponentView::updateProps(
     }
 
     // We have to check m_componentHostingFocusVisual again, as it can be set to null by above hostFocusVisual call
-    if (m_componentHostingFocusVisual) {
+    if (m_componentHostingFocusVisual && HasAnyDirtyFlag(dirtyProps, ViewPropsDirtyFlags::Border)) {
       if (m_componentHostingFocusVisual->m_focusPrimitive->m_focusInnerPrimitive) {
-        m_componentHostingFocusVisual->m_focusPrimitive->m_focusInnerPrimitive->updateProps(oldViewProps, newViewProps);
+        m_componentHostingFocusVisual->m_focusPrimitive->m_focusInnerPrimitive->markNeedsUpdate();
       }
       if (m_componentHostingFocusVisual->m_focusPrimitive->m_focusOuterPrimitive) {
-        m_componentHostingFocusVisual->m_focusPrimitive->m_focusOuterPrimitive->updateProps(oldViewProps, newViewProps);
+        m_componentHostingFocusVisual->m_focusPrimitive->m_focusOuterPrimitive->markNeedsUpdate();
       }
     }
   }
-  if ((m_flags & ComponentViewFeatures::ShadowProps) == ComponentViewFeatures::ShadowProps) {
-    updateShadowProps(oldViewProps, newViewProps);
+  if ((m_flags & ComponentViewFeatures::ShadowProps) == ComponentViewFeatures::ShadowProps &&
+      HasAnyDirtyFlag(dirtyProps, ViewPropsDirtyFlags::Shadow)) {
+    applyShadowProps(newViewProps);
   }
   if (oldViewProps.tooltip != newViewProps.tooltip) {
     if (!m_tooltipTracked && newViewProps.tooltip && !newViewProps.tooltip->empty()) {
@@ -194,11 +242,27 @@ void ComponentView::updateProps(
   base_type::updateProps(props, oldProps);
 }
 
+// Visual state is left matching the current props and layout metrics so that when the view is reused, the next
+// updateProps/updateLayoutMetrics diff against those values and only touch what changed.
+void ComponentView::prepareForRecycle() noexcept {
+  if (m_componentHostingFocusVisual) {
+    m_componentHostingFocusVisual->hostFocusVisual(false, get_strong());
+  }
+  m_eventEmitter = nullptr;
+  base_type::prepareForRecycle();
+}
+
 void ComponentView::updateLayoutMetrics(
     facebook::react::LayoutMetrics const &layoutMetrics,
     facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept {
+  if (m_layoutTransitionRunning) {
+    stopLayoutTransition();
+  }
+
   if ((m_flags & ComponentViewFeatures::NativeBorder) == ComponentViewFeatures::NativeBorder) {
-    updateClippingPath(layoutMetrics, *viewProps());
+    if (layoutMetrics != oldLayoutMetrics || HasAnyDirtyFlag(m_dirtyProps, ViewPropsDirtyFlags::Clipping)) {
+      updateClippingPath(layoutMetrics, *viewProps());
+    }
     OuterVisual().Size(
         {layoutMetrics.frame.size.width * layoutMetrics.pointScaleFactor,
          layoutMetrics.frame.size.height * layoutMetrics.pointScaleFactor});
@@ -212,6 +276,7 @@ void ComponentView::updateLayoutMetrics(
   base_type::updateLayoutMetrics(layoutMetrics, oldLayoutMetrics);
 
   if (layoutMetrics != oldLayoutMetrics) {
+    m_dirtyProps |= ViewPropsDirtyFlags::Border;
     if (m_borderPrimitive) {
       m_borderPrimitive->markNeedsUpdate();
     }
@@ -225,9 +290,8 @@ void ComponentView::updateLayoutMetrics(
 }
 
 void ComponentView::updateFocusLayoutMetrics() noexcept {
-  facebook::react::RectangleEdges<bool> nudgeEdges;
-  auto scaleFactor = m_focusPrimitive->m_focusVisualComponent->m_layoutMetrics.pointScaleFactor;
   if (m_focusPrimitive) {
+    auto scaleFactor = m_focusPrimitive->m_focusVisualComponent->m_layoutMetrics.pointScaleFactor;
     auto nudgeEdges = m_focusPrimitive->m_focusVisualComponent->focusNudges();
     if (m_focusPrimitive->m_focusOuterPrimitive) {
       auto outerFocusMetrics = m_focusPrimitive->m_focusVisualComponent->focusLayoutMetrics(false /*inner*/);
@@ -279,6 +343,13 @@ void ComponentView::FinalizeTransform(
   transformMatrix.m43 = resolveTransformMatrix.matrix[14];
   transformMatrix.m44 = resolveTransformMatrix.matrix[15];
 
+  // Most views never have a transform, so the property set and the expression animation of the facade are only created
+  // once a view gets one, either here or from an animated transform
+  if (!m_hasTransformMatrixFacade && transformMatrix == winrt::Windows::Foundation::Numerics::float4x4::identity()) {
+    m_FinalizeTransform = false;
+    return;
+  }
+
   auto centerPointPropSet = EnsureCenterPointPropertySet();
   if (centerPointPropSet) {
     centerPointPropSet.InsertMatrix4x4(L"transform", transformMatrix);
@@ -289,7 +360,10 @@ void ComponentView::FinalizeTransform(
 }
 
 void ComponentView::FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentViewUpdateMask updateMask) noexcept {
-  if ((m_flags & ComponentViewFeatures::NativeBorder) == ComponentViewFeatures::NativeBorder) {
+  // Props changes that do not affect the border (such as animated opacity or background color) skip resolving the
+  // border metrics entirely
+  if ((m_flags & ComponentViewFeatures::NativeBorder) == ComponentViewFeatures::NativeBorder &&
+      HasAnyDirtyFlag(m_dirtyProps, ViewPropsDirtyFlags::Border)) {
     auto borderMetrics = BorderPrimitive::resolveAndAlignBorderMetrics(m_layoutMetrics, *viewProps());
     if (!m_borderPrimitive && BorderPrimitive::requiresBorder(borderMetrics, theme())) {
       m_borderPrimitive = std::make_shared<BorderPrimitive>(*this, Visual());
@@ -313,10 +387,22 @@ void ComponentView::FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentView
     }
   }
 
+  if ((m_flags & ComponentViewFeatures::NativeBorder) == ComponentViewFeatures::NativeBorder &&
+      HasAnyDirtyFlag(m_dirtyProps, ViewPropsDirtyFlags::Clipping)) {
+    updateClippingPath(m_layoutMetrics, *viewProps());
+  }
+
   if (m_FinalizeTransform) {
     FinalizeTransform(m_layoutMetrics, *viewProps());
   }
 
+  // Raise the property changed events of every props update in this transaction at once
+  if (m_accessibilityOldProps) {
+    updateAccessibilityProps(*m_accessibilityOldProps, *viewProps());
+    m_accessibilityOldProps = nullptr;
+  }
+
+  m_dirtyProps = ViewPropsDirtyFlags::None;
   base_type::FinalizeUpdates(updateMask);
 }
 
@@ -330,7 +416,7 @@ void ComponentView::onLostFocus(
 
       m_componentHostingFocusVisual->hostFocusVisual(false, get_strong());
     }
-    if (UiaClientsAreListening()) {
+    if (UiaClientsAreListeningThisFrame()) {
       winrt::Microsoft::ReactNative::implementation::UpdateUiaProperty(
           EnsureUiaProvider(), UIA_HasKeyboardFocusPropertyId, true, false);
     }
@@ -355,7 +441,11 @@ winrt::com_ptr<ComponentView> ComponentView::focusVisualRoot(const facebook::rea
     // ParentForTransform
   }
 
-  if (facebook::react::Rect::intersect(focusRect, m_layoutMetrics.frame) == focusRect) {
+  // Without an outer visual, focus visuals hosted here would be clipped to the rounded corners of m_visual and faded
+  // with its opacity
+  const bool affectsHostedVisuals = !m_outerVisual && (m_hasClippingPath || viewProps()->opacity < 1.0f);
+
+  if (!affectsHostedVisuals && facebook::react::Rect::intersect(focusRect, m_layoutMetrics.frame) == focusRect) {
     return get_strong();
   }
 
@@ -380,7 +470,7 @@ void ComponentView::onGotFocus(
       focusRect.size.height += (FOCUS_VISUAL_WIDTH * 2);
       focusVisualRoot(focusRect)->hostFocusVisual(true, get_strong());
     }
-    if (UiaClientsAreListening()) {
+    if (UiaClientsAreListeningThisFrame()) {
       auto spProviderSimple = EnsureUiaProvider().try_as<IRawElementProviderSimple>();
       if (spProviderSimple != nullptr) {
         winrt::Microsoft::ReactNative::implementation::UpdateUiaProperty(
@@ -626,27 +716,36 @@ void ComponentView::hostFocusVisual(bool show, winrt::com_ptr<ComponentView> vie
     if (show && !view->m_componentHostingFocusVisual) {
       view->m_componentHostingFocusVisual = get_strong();
 
+      // Reuse the root's focus visuals if another view showed them before
       if (!m_focusPrimitive) {
-        m_focusPrimitive = std::make_unique<FocusPrimitive>();
+        if (auto root = rootComponentView()) {
+          m_focusPrimitive = root->TakeFocusPrimitive();
+        }
+        if (m_focusPrimitive) {
+          m_focusPrimitive->m_focusInnerPrimitive->setOuter(this);
+          m_focusPrimitive->m_focusOuterPrimitive->setOuter(this);
+        } else {
+          m_focusPrimitive = std::make_unique<FocusPrimitive>();
+        }
       }
       m_focusPrimitive->m_focusVisualComponent = view;
 
       if (!m_focusPrimitive->m_focusVisual) {
         m_focusPrimitive->m_focusVisual = m_compContext.CreateSpriteVisual();
-        auto hostingVisual =
+      }
+      auto hostingVisual =
+          winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(
+              visualToHostFocus())
+              .as<winrt::Microsoft::UI::Composition::ContainerVisual>();
+      if (hostingVisual) {
+        hostingVisual.Children().InsertAtTop(
             winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(
-                visualToHostFocus())
-                .as<winrt::Microsoft::UI::Composition::ContainerVisual>();
-        if (hostingVisual) {
-          hostingVisual.Children().InsertAtTop(
-              winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(
-                  m_focusPrimitive->m_focusVisual));
-        } else {
-          assert(
-              view.get() ==
-              this); // When not using lifted comp, focus visuals should always host within their own component
-          OuterVisual().InsertAt(m_focusPrimitive->m_focusVisual, 1);
-        }
+                m_focusPrimitive->m_focusVisual));
+      } else {
+        assert(
+            view.get() ==
+            this); // When not using lifted comp, focus visuals should always host within their own component
+        OuterVisual().InsertAt(m_focusPrimitive->m_focusVisual, 1);
       }
 
       m_focusPrimitive->m_focusVisual.IsVisible(true);
@@ -678,6 +777,22 @@ void ComponentView::hostFocusVisual(bool show, winrt::com_ptr<ComponentView> vie
       m_focusPrimitive->m_focusVisualComponent = nullptr;
       m_focusPrimitive->m_focusVisual.IsVisible(false);
       view->m_componentHostingFocusVisual = nullptr;
+
+      // Detach the focus visuals and hand them back to the root, so views that are not focused hold no focus visuals
+      if (auto focusVisual =
+              winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(
+                  m_focusPrimitive->m_focusVisual)) {
+        focusVisual.ParentForTransform(nullptr);
+        if (auto parent = focusVisual.Parent()) {
+          parent.Children().Remove(focusVisual);
+        }
+      } else {
+        OuterVisual().Remove(m_focusPrimitive->m_focusVisual);
+      }
+      if (auto root = rootComponentView()) {
+        root->ReturnFocusPrimitive(std::move(m_focusPrimitive));
+      }
+      m_focusPrimitive = nullptr;
     }
   }
 }
@@ -694,18 +809,21 @@ void ComponentView::updateShadowProps(
 }
 
 void ComponentView::applyShadowProps(const facebook::react::ViewProps &viewProps) noexcept {
-  auto shadow = m_compContext.CreateDropShadow();
+  // Views with the same shadow share a single DropShadow
+  winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow shadow{nullptr};
   if (!viewProps.boxShadow.empty()) {
-    shadow.Offset({viewProps.boxShadow[0].offsetX, viewProps.boxShadow[0].offsetY, 0});
-    shadow.Opacity(1);
-    shadow.BlurRadius(viewProps.boxShadow[0].blurRadius);
-    shadow.Color(theme()->Color(*viewProps.boxShadow[0].color));
+    shadow = theme()->DropShadow(
+        {viewProps.boxShadow[0].offsetX, viewProps.boxShadow[0].offsetY, 0},
+        1,
+        viewProps.boxShadow[0].blurRadius,
+        theme()->Color(*viewProps.boxShadow[0].color));
   } else {
-    shadow.Offset({viewProps.shadowOffset.width, viewProps.shadowOffset.height, 0});
-    shadow.Opacity(viewProps.shadowOpacity);
-    shadow.BlurRadius(viewProps.shadowRadius);
-    if (viewProps.shadowColor)
-      shadow.Color(theme()->Color(*viewProps.shadowColor));
+    shadow = theme()->DropShadow(
+        {viewProps.shadowOffset.width, viewProps.shadowOffset.height, 0},
+        viewProps.shadowOpacity,
+        viewProps.shadowRadius,
+        viewProps.shadowColor ? theme()->Color(*viewProps.shadowColor)
+                              : winrt::Windows::UI::Color{255, 0, 0, 0} /* DropShadow's default color, black */);
   }
 
   Visual().as<winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual>().Shadow(shadow);
@@ -742,7 +860,7 @@ void ComponentView::updateTransformProps(
 void ComponentView::updateAccessibilityProps(
     const facebook::react::ViewProps &oldViewProps,
     const facebook::react::ViewProps &newViewProps) noexcept {
-  if (!UiaClientsAreListening())
+  if (!UiaClientsAreListeningThisFrame() || !m_uiaProvider)
     return;
 
   winrt::Microsoft::ReactNative::implementation::UpdateUiaProperty(
@@ -896,20 +1014,42 @@ void ComponentView::updateClippingPath(
       borderMetrics.borderRadii.bottomLeft.horizontal == 0 && borderMetrics.borderRadii.bottomRight.horizontal == 0 &&
       borderMetrics.borderRadii.topLeft.vertical == 0 && borderMetrics.borderRadii.topRight.vertical == 0 &&
       borderMetrics.borderRadii.bottomLeft.vertical == 0 && borderMetrics.borderRadii.bottomRight.vertical == 0) {
-    Visual().as<::Microsoft::ReactNative::Composition::Experimental::IVisualInterop>()->SetClippingPath(nullptr);
-  } else {
-    winrt::com_ptr<ID2D1PathGeometry> pathGeometry = BorderPrimitive::GenerateRoundedRectPathGeometry(
-        m_compContext,
-        borderMetrics.borderRadii,
-        {0, 0, 0, 0},
-        {0,
-         0,
-         layoutMetrics.frame.size.width * layoutMetrics.pointScaleFactor,
-         layoutMetrics.frame.size.height * layoutMetrics.pointScaleFactor});
+    if (m_hasClippingPath) {
+      Visual().as<::Microsoft::ReactNative::Composition::Experimental::IVisualInterop>()->SetClippingPath(nullptr);
+      m_hasClippingPath = false;
+    }
+    return;
+  }
 
-    Visual().as<::Microsoft::ReactNative::Composition::Experimental::IVisualInterop>()->SetClippingPath(
-        pathGeometry.get());
+  // Layout passes that move the view, such as scrolling a list, leave its clip as it is.  The radii are in pixels, so
+  // a change of DPI changes them too.
+  facebook::react::Size size{
+      layoutMetrics.frame.size.width * layoutMetrics.pointScaleFactor,
+      layoutMetrics.frame.size.height * layoutMetrics.pointScaleFactor};
+  if (m_hasClippingPath && size == m_clippingSize && borderMetrics.borderRadii == m_clippingRadii) {
+    return;
+  }
+  m_clippingSize = size;
+  m_clippingRadii = borderMetrics.borderRadii;
+  m_hasClippingPath = true;
+
+  auto visual = Visual();
+  if (auto roundedRectangleClip =
+          visual.try_as<::Microsoft::ReactNative::Composition::Experimental::IVisualRoundedRectangleClipInterop>()) {
+    auto radii = BorderPrimitive::fitRoundedRectRadii(borderMetrics.borderRadii, size);
+    roundedRectangleClip->SetRoundedRectangleClip(
+        {size.width, size.height},
+        {radii.topLeft.horizontal, radii.topLeft.vertical},
+        {radii.topRight.horizontal, radii.topRight.vertical},
+        {radii.bottomRight.horizontal, radii.bottomRight.vertical},
+        {radii.bottomLeft.horizontal, radii.bottomLeft.vertical});
+    return;
   }
+
+  winrt::com_ptr<ID2D1PathGeometry> pathGeometry = BorderPrimitive::GenerateRoundedRectPathGeometry(
+      m_compContext, borderMetrics.borderRadii, {0, 0, 0, 0}, {0, 0, size.width, size.height});
+  visual.as<::Microsoft::ReactNative::Composition::Experimental::IVisualInterop>()->SetClippingPath(
+      pathGeometry.get());
 }
 
 std::pair<facebook::react::Cursor, HCURSOR> ComponentView::cursor() const noexcept {
@@ -922,7 +1062,12 @@ void ComponentView::indexOffsetForBorder(uint32_t &index) const noexcept {
   }
 }
 
-void ComponentView::OnRenderingDeviceLost() noexcept {}
+void ComponentView::OnRenderingDeviceLost() noexcept {
+  if (m_borderPrimitive) {
+    m_borderPrimitive->onThemeChanged(
+        m_layoutMetrics, BorderPrimitive::resolveAndAlignBorderMetrics(m_layoutMetrics, *viewProps()));
+  }
+}
 
 std::vector<facebook::react::ComponentDescriptorProvider>
 ComponentView::supplementalComponentDescriptorProviders() noexcept {
@@ -989,6 +1134,157 @@ void ComponentView::EnsureTransformMatrixFacade() noexcept {
   }
 }
 
+static bool IsLayoutTransitionAnimated(
+    const facebook::react::LayoutAnimation::LayoutAnimationProperties &animation) noexcept {
+  return animation.animationType != facebook::react::LayoutAnimation::AnimationType::None &&
+      animation.duration >= 1.0f;
+}
+
+static winrt::Microsoft::UI::Composition::CompositionEasingFunction LayoutTransitionEasing(
+    const winrt::Microsoft::UI::Composition::Compositor &compositor,
+    const facebook::react::LayoutAnimation::LayoutAnimationProperties &animation) noexcept {
+  switch (animation.animationType) {
+    case facebook::react::LayoutAnimation::AnimationType::Linear:
+      return compositor.CreateLinearEasingFunction();
+    case facebook::react::LayoutAnimation::AnimationType::EaseIn:
+      return compositor.CreateCubicBezierEasingFunction({0.42f, 0.0f}, {1.0f, 1.0f});
+    case facebook::react::LayoutAnimation::AnimationType::EaseOut:
+      return compositor.CreateCubicBezierEasingFunction({0.0f, 0.0f}, {0.58f, 1.0f});
+    case facebook::react::LayoutAnimation::AnimationType::Spring: {
+      // Keyframes cannot follow a spring, so overshoot the end value once instead, further the less it is damped
+      auto overshoot = 0.93f * (1.0f - std::clamp(animation.springAnimationProperties.springDamping, 0.0f, 1.0f));
+      return compositor.CreateCubicBezierEasingFunction({0.34f, 1.0f + overshoot}, {0.64f, 1.0f});
+    }
+    default:
+      return compositor.CreateCubicBezierEasingFunction({0.42f, 0.0f}, {0.58f, 1.0f});
+  }
+}
+
+static void ConfigureLayoutTransition(
+    const winrt::Microsoft::UI::Composition::KeyFrameAnimation &keyFrameAnimation,
+    const facebook::react::LayoutAnimation::LayoutAnimationProperties &animation) noexcept {
+  keyFrameAnimation.Duration(std::chrono::milliseconds(static_cast<int64_t>(animation.duration)));
+  if (animation.delay >= 1.0f) {
+    keyFrameAnimation.DelayTime(std::chrono::milliseconds(static_cast<int64_t>(animation.delay)));
+    keyFrameAnimation.DelayBehavior(
+        winrt::Microsoft::UI::Composition::AnimationDelayBehavior::SetInitialValueBeforeDelay);
+  }
+}
+
+void ComponentView::startCreateTransition(
+    const facebook::react::LayoutAnimation::LayoutAnimationProperties &animation) noexcept {
+  auto compositor =
+      winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerCompositor(
+          m_compContext);
+  auto outerVisual =
+      winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(OuterVisual());
+  if (!compositor || !outerVisual || !IsLayoutTransitionAnimated(animation)) {
+    return;
+  }
+
+  auto easing = LayoutTransitionEasing(compositor, animation);
+  switch (animation.animatedProp) {
+    case facebook::react::LayoutAnimation::AnimatableProperty::Opacity: {
+      // The opacity prop is applied to Visual(), which is also the outer visual of a collapsed view
+      auto fadeIn = compositor.CreateScalarKeyFrameAnimation();
+      fadeIn.InsertKeyFrame(0.0f, 0.0f);
+      fadeIn.InsertKeyFrame(1.0f, m_outerVisual ? 1.0f : viewProps()->opacity, easing);
+      ConfigureLayoutTransition(fadeIn, animation);
+      outerVisual.StartAnimation(L"Opacity", fadeIn);
+      break;
+    }
+    case facebook::react::LayoutAnimation::AnimatableProperty::ScaleX:
+    case facebook::react::LayoutAnimation::AnimatableProperty::ScaleY:
+    case facebook::react::LayoutAnimation::AnimatableProperty::ScaleXY: {
+      winrt::Windows::Foundation::Numerics::float3 initialScale{
+          animation.animatedProp == facebook::react::LayoutAnimation::AnimatableProperty::ScaleY ? 1.0f : 0.0f,
+          animation.animatedProp == facebook::react::LayoutAnimation::AnimatableProperty::ScaleX ? 1.0f : 0.0f,
+          1.0f};
+      auto grow = compositor.CreateVector3KeyFrameAnimation();
+      grow.InsertKeyFrame(0.0f, initialScale);
+      grow.InsertKeyFrame(1.0f, {1.0f, 1.0f, 1.0f}, easing);
+      ConfigureLayoutTransition(grow, animation);
+      outerVisual.StartAnimation(L"Scale", grow);
+
+      // Scale from the center by moving the offset along with the scale.  A CenterPoint would also apply to the
+      // TransformMatrix, which EnsureTransformMatrixFacade expects to be relative to the top left.
+      auto offset = outerVisual.Offset();
+      auto size = outerVisual.Size();
+      auto move = compositor.CreateVector3KeyFrameAnimation();
+      move.InsertKeyFrame(
+          0.0f,
+          {offset.x + size.x * (1.0f - initialScale.x) / 2.0f,
+           offset.y + size.y * (1.0f - initialScale.y) / 2.0f,
+           offset.z});
+      move.InsertKeyFrame(1.0f, offset, easing);
+      ConfigureLayoutTransition(move, animation);
+      outerVisual.StartAnimation(L"Offset", move);
+      m_layoutTransitionRunning = true;
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void ComponentView::startUpdateTransition(
+    const facebook::react::LayoutAnimation::LayoutAnimationProperties &animation,
+    facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept {
+  auto compositor =
+      winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerCompositor(
+          m_compContext);
+  auto outerVisual =
+      winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(OuterVisual());
+  if (!compositor || !outerVisual || !IsLayoutTransitionAnimated(animation)) {
+    return;
+  }
+
+  auto easing = LayoutTransitionEasing(compositor, animation);
+  auto oldScaleFactor = oldLayoutMetrics.pointScaleFactor;
+  if (!(oldLayoutMetrics.frame.origin == m_layoutMetrics.frame.origin)) {
+    auto move = compositor.CreateVector3KeyFrameAnimation();
+    move.InsertKeyFrame(
+        0.0f,
+        {oldLayoutMetrics.frame.origin.x * oldScaleFactor, oldLayoutMetrics.frame.origin.y * oldScaleFactor, 0.0f});
+    move.InsertKeyFrame(1.0f, outerVisual.Offset(), easing);
+    ConfigureLayoutTransition(move, animation);
+    outerVisual.StartAnimation(L"Offset", move);
+    m_layoutTransitionRunning = true;
+  }
+
+  if (!(oldLayoutMetrics.frame.size == m_layoutMetrics.frame.size)) {
+    auto resize = compositor.CreateVector2KeyFrameAnimation();
+    resize.InsertKeyFrame(
+        0.0f,
+        {oldLayoutMetrics.frame.size.width * oldScaleFactor, oldLayoutMetrics.frame.size.height * oldScaleFactor});
+    resize.InsertKeyFrame(1.0f, outerVisual.Size(), easing);
+    ConfigureLayoutTransition(resize, animation);
+    outerVisual.StartAnimation(L"Size", resize);
+    auto visual =
+        winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(Visual());
+    if (visual && visual != outerVisual) {
+      visual.StartAnimation(L"Size", resize);
+    }
+    m_layoutTransitionRunning = true;
+  }
+}
+
+// Once complete, transitions leave the visuals at their end values, so they are stopped before a later layout change
+// sets the offset and size of the visuals directly
+void ComponentView::stopLayoutTransition() noexcept {
+  m_layoutTransitionRunning = false;
+  if (auto outerVisual =
+          winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(
+              OuterVisual())) {
+    outerVisual.StopAnimation(L"Offset");
+    outerVisual.StopAnimation(L"Size");
+  }
+  if (auto visual =
+          winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(Visual())) {
+    visual.StopAnimation(L"Size");
+  }
+}
+
 facebook::react::SharedViewEventEmitter ComponentView::eventEmitter() noexcept {
   return m_eventEmitter;
 }
@@ -1004,8 +1300,13 @@ bool ComponentView::anyHitTestHelper(
   if (auto index = m_children.Size()) {
     do {
       index--;
-      targetTag = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(m_children.GetAt(index))
-                      ->hitTest(ptContent, localPt);
+      auto child =
+          winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(m_children.GetAt(index));
+      // Skips children that cannot be hit at the point, without walking their subtree
+      if (!child->hitTestBounds().containsPoint(ptContent)) {
+        continue;
+      }
+      targetTag = child->hitTest(ptContent, localPt);
       if (targetTag != -1) {
         return true;
       }
@@ -1038,8 +1339,9 @@ ViewComponentView::ViewComponentView(
     facebook::react::Tag tag,
     winrt::Microsoft::ReactNative::ReactContext const &reactContext,
     ComponentViewFeatures flags,
-    winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder)
-    : base_type(compContext, tag, reactContext, flags, builder),
+    winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder,
+    bool collapseOuterVisual)
+    : base_type(compContext, tag, reactContext, flags, builder, collapseOuterVisual),
       m_props(defaultProps ? defaultProps : ViewComponentView::defaultProps()) {}
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IVisual ViewComponentView::createVisual() noexcept {
@@ -1067,7 +1369,19 @@ void ViewComponentView::ensureVisual() noexcept {
     } else {
       m_visual = createVisual();
     }
-    OuterVisual().InsertAt(m_visual, 0);
+
+    // A collapsed view lets m_visual stand in for the outer visual, since the background, borders, shadow, clip and
+    // transform can all be applied to the one visual. Focus visuals are then hosted by an ancestor whenever m_visual
+    // would clip them (see focusVisualRoot), which needs ParentForTransform - so only lifted composition
+    // collapses, and only for the default visual.
+    if (!m_outerVisual &&
+        (m_createInternalVisualHandler || (m_builder && m_builder->CreateVisualHandler()) ||
+         !winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerVisual(m_visual))) {
+      m_outerVisual = m_compContext.CreateSpriteVisual();
+    }
+    if (m_outerVisual) {
+      m_outerVisual.InsertAt(m_visual, 0);
+    }
   }
 }
 
@@ -1076,7 +1390,13 @@ winrt::Microsoft::ReactNative::ComponentView ViewComponentView::Create(
     facebook::react::Tag tag,
     winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   return winrt::make<ViewComponentView>(
-      ViewComponentView::defaultProps(), compContext, tag, reactContext, ComponentViewFeatures::Default);
+      ViewComponentView::defaultProps(),
+      compContext,
+      tag,
+      reactContext,
+      ComponentViewFeatures::Default,
+      nullptr /*builder*/,
+      true /*collapseOuterVisual*/);
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IVisual
@@ -1122,24 +1442,114 @@ void ViewComponentView::UnmountChildComponentView(
   }
 }
 
+void ViewComponentView::MountChildComponentViews(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  // Custom components expect a callback per child, and non-visual children need the visual index adjusted per child
+  if (m_builder || m_hasNonVisualChildren) {
+    base_type::MountChildComponentViews(childComponentViews, index);
+    return;
+  }
+
+  std::vector<winrt::Microsoft::ReactNative::Composition::Experimental::IVisual> visuals;
+  visuals.reserve(childComponentViews.size());
+  for (auto const &childComponentView : childComponentViews) {
+    auto compositionChild = childComponentView.try_as<ComponentView>();
+    if (!compositionChild) {
+      base_type::MountChildComponentViews(childComponentViews, index);
+      return;
+    }
+    visuals.push_back(compositionChild->OuterVisual());
+  }
+
+  insertChildren(childComponentViews, index);
+
+  auto visualIndex = index;
+  indexOffsetForBorder(visualIndex);
+  ensureVisual();
+  auto visualToMountChildrenInto = VisualToMountChildrenInto();
+  auto childrenInterop =
+      visualToMountChildrenInto.try_as<::Microsoft::ReactNative::Composition::Experimental::IVisualChildrenInterop>();
+  if (childrenInterop) {
+    childrenInterop->InsertRangeAt(visuals, visualIndex);
+  } else {
+    for (auto const &visual : visuals) {
+      visualToMountChildrenInto.InsertAt(visual, visualIndex++);
+    }
+  }
+
+  if (m_mounted) {
+    for (auto const &childComponentView : childComponentViews) {
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->onMounted();
+    }
+  }
+}
+
+void ViewComponentView::UnmountChildComponentViews(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  if (m_builder || m_hasNonVisualChildren) {
+    base_type::UnmountChildComponentViews(childComponentViews, index);
+    return;
+  }
+
+  std::vector<winrt::Microsoft::ReactNative::Composition::Experimental::IVisual> visuals;
+  visuals.reserve(childComponentViews.size());
+  for (auto const &childComponentView : childComponentViews) {
+    auto compositionChild = childComponentView.try_as<ComponentView>();
+    if (!compositionChild) {
+      base_type::UnmountChildComponentViews(childComponentViews, index);
+      return;
+    }
+    visuals.push_back(compositionChild->OuterVisual());
+  }
+
+  removeChildren(childComponentViews, index);
+
+  auto visualToMountChildrenInto = VisualToMountChildrenInto();
+  for (auto const &visual : visuals) {
+    visualToMountChildrenInto.Remove(visual);
+  }
+
+  for (auto const &childComponentView : childComponentViews) {
+    winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(childComponentView)->onUnmounted();
+  }
+}
+
 void ViewComponentView::updateProps(
     facebook::react::Props::Shared const &props,
     facebook::react::Props::Shared const &oldProps) noexcept {
-  const auto &oldViewProps = *std::static_pointer_cast<const facebook::react::ViewProps>(oldProps ? oldProps : m_props);
+  auto oldViewPropsPtr = std::static_pointer_cast<const facebook::react::ViewProps>(oldProps ? oldProps : m_props);
+  const auto &oldViewProps = *oldViewPropsPtr;
   const auto &newViewProps = *std::static_pointer_cast<const facebook::react::ViewProps>(props);
 
   ensureVisual();
-  if (oldViewProps.opacity != newViewProps.opacity) {
+
+  // update BaseComponentView props, which also computes the dirty flags for this props change
+  base_type::updateProps(props, oldProps);
+
+  auto dirtyProps = this->dirtyProps();
+  if (HasAnyDirtyFlag(dirtyProps, ViewPropsDirtyFlags::Opacity)) {
     Visual().Opacity(newViewProps.opacity);
   }
   if (oldViewProps.testId != newViewProps.testId) {
     Visual().Comment(winrt::to_hstring(newViewProps.testId));
   }
 
-  // update BaseComponentView props
-  updateAccessibilityProps(oldViewProps, newViewProps);
-  updateTransformProps(oldViewProps, newViewProps, Visual());
-  base_type::updateProps(props, oldProps);
+  if (m_innerAutomationProvider) {
+    m_innerAutomationProvider->InvalidatePropertyCache();
+  }
+
+  // Accessibility props are not tracked by a dirty flag.  Unless UIA clients are listening, and one has navigated to
+  // this view, there is nobody to notify.  Otherwise the changes are raised once, from FinalizeUpdates.
+  // Providers are created as clients navigate to views, and a client cannot have read the properties of a view
+  // without a provider.
+  if (!m_accessibilityOldProps && m_uiaProvider && UiaClientsAreListeningThisFrame()) {
+    m_accessibilityOldProps = std::move(oldViewPropsPtr);
+  }
+  if (HasAnyDirtyFlag(dirtyProps, ViewPropsDirtyFlags::Transform)) {
+    updateTransformProps(oldViewProps, newViewProps, Visual());
+  }
 
   m_props = std::static_pointer_cast<facebook::react::ViewProps const>(props);
 }
@@ -1308,17 +1718,37 @@ void ViewComponentView::updateLayoutMetrics(
     facebook::react::LayoutMetrics const &layoutMetrics,
     facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept {
   // Set Position & Size Properties
+  ensureVisual();
   if ((layoutMetrics.displayType != m_layoutMetrics.displayType)) {
-    OuterVisual().IsVisible(layoutMetrics.displayType != facebook::react::DisplayType::None);
+    OuterVisual().IsVisible(!m_culled && layoutMetrics.displayType != facebook::react::DisplayType::None);
   }
-  ensureVisual();
   base_type::updateLayoutMetrics(layoutMetrics, oldLayoutMetrics);
   Visual().Size(
       {layoutMetrics.frame.size.width * layoutMetrics.pointScaleFactor,
        layoutMetrics.frame.size.height * layoutMetrics.pointScaleFactor});
 }
 
-void ViewComponentView::prepareForRecycle() noexcept {}
+void ViewComponentView::prepareForRecycle() noexcept {
+  base_type::prepareForRecycle();
+}
+
+void ViewComponentView::onUnmounted() noexcept {
+  // The view could be mounted again outside of the ScrollView that culled it
+  Culled(false);
+  base_type::onUnmounted();
+}
+
+void ViewComponentView::Culled(bool culled) noexcept {
+  if (m_culled == culled) {
+    return;
+  }
+  m_culled = culled;
+  OuterVisual().IsVisible(!culled && m_layoutMetrics.displayType != facebook::react::DisplayType::None);
+}
+
+bool ViewComponentView::Culled() const noexcept {
+  return m_culled;
+}
 
 const facebook::react::SharedViewProps &ViewComponentView::viewProps() const noexcept {
   return m_props;
@@ -1416,11 +1846,8 @@ namespace winrt::Microsoft::ReactNative::implementation {
 winrt::Microsoft::ReactNative::ComponentView lastDeepChild(
     const winrt::Microsoft::ReactNative::ComponentView &view) noexcept {
   auto current = view;
-  while (current) {
-    auto children = current.Children();
-    if (children.Size() == 0)
-      break;
-    current = children.GetAt(children.Size() - 1);
+  while (auto lastChild = winrt::get_self<ComponentView>(current)->edgeChild(false)) {
+    current = lastChild;
   }
   return current;
 }
@@ -1428,54 +1855,48 @@ winrt::Microsoft::ReactNative::ComponentView lastDeepChild(
 // Walks the tree calling the function fn on each node.
 // If fn returns true, then walkTree stops iterating over the tree, and returns true.
 // If the tree walk completes without fn returning true, then walkTree returns false.
+// Each step is constant time, since views cache their index in their parent, and the walk is iterative, so a long
+// run of non-focusable views (e.g. a large grid) neither searches the parent's children nor deepens the stack.
 bool walkTree(
     const winrt::Microsoft::ReactNative::ComponentView &view,
     bool forward,
     Mso::Functor<bool(const winrt::Microsoft::ReactNative::ComponentView &)> &fn) noexcept {
+  auto current = view;
   if (forward) {
-    if (fn(view)) {
+    // Pre-order: the view itself, its descendants, then the nodes that follow it.
+    if (fn(current)) {
       return true;
     }
 
-    auto children = view.Children();
-    for (auto it = children.begin(); it != children.end(); ++it) {
-      return walkTree(*it, forward, fn);
-    }
-
-    auto current = view;
-    auto parent = current.Parent();
-    while (parent) {
-      auto parentsChildren = parent.Children();
-      auto itNextView = std::find(parentsChildren.begin(), parentsChildren.end(), current);
-      assert(itNextView != parentsChildren.end());
-      ++itNextView;
-      if (itNextView != parentsChildren.end()) {
-        return walkTree(*itNextView, true, fn);
+    for (;;) {
+      auto next = winrt::get_self<ComponentView>(current)->edgeChild(true);
+      while (!next && current) {
+        next = winrt::get_self<ComponentView>(current)->sibling(true);
+        if (!next) {
+          current = current.Parent();
+        }
       }
-      current = parent;
-      parent = current.Parent();
-    }
-
-  } else {
-    auto current = view;
-    auto parent = current.Parent();
-    while (parent) {
-      auto parentsChildren = parent.Children();
-      uint32_t index;
-      bool success = parent.Children().IndexOf(current, index);
-      assert(success);
-      if (index > 0) {
-        auto lastChild = lastDeepChild(parent.Children().GetAt(index - 1));
-        if (fn(lastChild))
-          return true;
-        return walkTree(lastChild, false, fn);
+      if (!next) {
+        return false;
       }
 
-      if (fn(parent)) {
+      current = next;
+      if (fn(current)) {
         return true;
       }
+    }
+  }
+
+  // Reverse pre-order: the deepest last descendant of the previous sibling, or else the parent.
+  while (auto parent = current.Parent()) {
+    if (auto previous = winrt::get_self<ComponentView>(current)->sibling(false)) {
+      current = lastDeepChild(previous);
+    } else {
       current = parent;
-      parent = current.Parent();
+    }
+
+    if (fn(current)) {
+      return true;
     }
   }
   return false;
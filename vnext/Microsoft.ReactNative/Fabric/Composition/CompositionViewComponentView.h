@@ -6,6 +6,7 @@
 
 #include <CppWinRTIncludes.h>
 #include <Fabric/ComponentView.h>
+#include <LayoutAnimation.h>
 #include <Microsoft.ReactNative.Cxx/ReactContext.h>
 #include <react/renderer/components/view/ViewEventEmitter.h>
 #include <react/renderer/components/view/ViewProps.h>
@@ -24,6 +25,35 @@ class CompositionDynamicAutomationProvider;
 }
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
+
+// The composition objects of a ComponentView that need to be updated as the result of a props change.  Computed once
+// per props diff in ComponentView::updateProps, and accumulated until FinalizeUpdates.
+enum class ViewPropsDirtyFlags : uint8_t {
+  None = 0,
+  Border = 1 << 0,
+  Background = 1 << 1,
+  Shadow = 1 << 2,
+  Transform = 1 << 3,
+  Opacity = 1 << 4,
+  Clipping = 1 << 5,
+};
+
+constexpr ViewPropsDirtyFlags operator|(ViewPropsDirtyFlags lhs, ViewPropsDirtyFlags rhs) noexcept {
+  return static_cast<ViewPropsDirtyFlags>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+}
+
+constexpr ViewPropsDirtyFlags &operator|=(ViewPropsDirtyFlags &lhs, ViewPropsDirtyFlags rhs) noexcept {
+  return lhs = lhs | rhs;
+}
+
+constexpr bool HasAnyDirtyFlag(ViewPropsDirtyFlags flags, ViewPropsDirtyFlags mask) noexcept {
+  return (static_cast<uint8_t>(flags) & static_cast<uint8_t>(mask)) != 0;
+}
+
+ViewPropsDirtyFlags DiffViewProps(
+    const facebook::react::ViewProps &oldViewProps,
+    const facebook::react::ViewProps &newViewProps) noexcept;
+
 struct FocusPrimitive {
   std::shared_ptr<BorderPrimitive> m_focusInnerPrimitive;
   std::shared_ptr<BorderPrimitive> m_focusOuterPrimitive;
@@ -40,7 +70,8 @@ struct ComponentView : public ComponentViewT<
       facebook::react::Tag tag,
       winrt::Microsoft::ReactNative::ReactContext const &reactContext,
       ComponentViewFeatures flags,
-      winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder);
+      winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder,
+      bool collapseOuterVisual = false);
   virtual ~ComponentView();
 
   virtual winrt::Microsoft::ReactNative::Composition::Experimental::IVisual Visual() const noexcept {
@@ -82,6 +113,7 @@ struct ComponentView : public ComponentViewT<
   void updateLayoutMetrics(
       facebook::react::LayoutMetrics const &layoutMetrics,
       facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept override;
+  void prepareForRecycle() noexcept override;
 
   void indexOffsetForBorder(uint32_t &index) const noexcept;
   void updateShadowProps(
@@ -96,13 +128,21 @@ struct ComponentView : public ComponentViewT<
       const facebook::react::ViewProps &oldView,
       const facebook::react::ViewProps &newViewProps) noexcept;
 
+  // Redraws the content of drawing surfaces, which is lost along with the rendering device
   virtual void OnRenderingDeviceLost() noexcept;
 
   void StartBringIntoView(winrt::Microsoft::ReactNative::implementation::BringIntoViewOptions &&args) noexcept override;
 
+  // Created on first use, for views that have a transform or an animated transform, translation or center point
   comp::CompositionPropertySet EnsureCenterPointPropertySet() noexcept;
   void EnsureTransformMatrixFacade() noexcept;
 
+  // Run the transitions of a LayoutAnimation on the compositor, once the props and layout of the view are applied
+  void startCreateTransition(const facebook::react::LayoutAnimation::LayoutAnimationProperties &animation) noexcept;
+  void startUpdateTransition(
+      const facebook::react::LayoutAnimation::LayoutAnimationProperties &animation,
+      facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept;
+
   winrt::Windows::Foundation::IInspectable CreateAutomationProvider() noexcept override;
   const winrt::com_ptr<winrt::Microsoft::ReactNative::implementation::CompositionDynamicAutomationProvider>
       &InnerAutomationProvider() const noexcept;
@@ -138,6 +178,11 @@ struct ComponentView : public ComponentViewT<
   // Most access should be through EnsureUIAProvider, instead of direct access to this.
   winrt::com_ptr<winrt::Microsoft::ReactNative::implementation::CompositionDynamicAutomationProvider>
       m_innerAutomationProvider;
+  // Dirty flags accumulated by updateProps since the last FinalizeUpdates
+  ViewPropsDirtyFlags dirtyProps() const noexcept {
+    return m_dirtyProps;
+  }
+
   winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext m_compContext;
   comp::CompositionPropertySet m_centerPropSet{nullptr};
   facebook::react::SharedViewEventEmitter m_eventEmitter;
@@ -148,6 +193,7 @@ struct ComponentView : public ComponentViewT<
       facebook::react::LayoutMetrics const &layoutMetrics,
       const facebook::react::ViewProps &viewProps) noexcept;
   void UpdateCenterPropertySet() noexcept;
+  void stopLayoutTransition() noexcept;
   void FinalizeTransform(
       facebook::react::LayoutMetrics const &layoutMetrics,
       const facebook::react::ViewProps &viewProps) noexcept;
@@ -163,7 +209,15 @@ struct ComponentView : public ComponentViewT<
   bool m_hasTransformMatrixFacade : 1 {false};
   bool m_FinalizeTransform : 1 {false};
   bool m_tooltipTracked : 1 {false};
+  bool m_hasClippingPath : 1 {false};
+  bool m_layoutTransitionRunning : 1 {false};
+  // The size and radii, in pixels, that the clip of Visual() was last set for
+  facebook::react::Size m_clippingSize;
+  facebook::react::RectangleCorners<facebook::react::CornerRadii> m_clippingRadii;
   ComponentViewFeatures m_flags;
+  ViewPropsDirtyFlags m_dirtyProps{ViewPropsDirtyFlags::None};
+  // Props before the first update since FinalizeUpdates, while UIA clients need to be notified of property changes
+  facebook::react::SharedViewProps m_accessibilityOldProps;
   void hostFocusVisual(bool show, winrt::com_ptr<ComponentView> view) noexcept;
   winrt::com_ptr<ComponentView>
       m_componentHostingFocusVisual; // The component that we are showing our focus visuals within
@@ -189,17 +243,29 @@ struct ViewComponentView : public ViewComponentViewT<
   void UnmountChildComponentView(
       const winrt::Microsoft::ReactNative::ComponentView &childComponentView,
       uint32_t index) noexcept override;
+  void MountChildComponentViews(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept override;
+  void UnmountChildComponentViews(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept override;
   void updateProps(facebook::react::Props::Shared const &props, facebook::react::Props::Shared const &oldProps) noexcept
       override;
   void updateLayoutMetrics(
       facebook::react::LayoutMetrics const &layoutMetrics,
       facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept override;
   void prepareForRecycle() noexcept override;
+  void onUnmounted() noexcept override;
   bool focusable() const noexcept override;
   void OnKeyDown(const winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs &args) noexcept override;
   void OnKeyUp(const winrt::Microsoft::ReactNative::Composition::Input::KeyRoutedEventArgs &args) noexcept override;
   std::string DefaultControlType() const noexcept override;
 
+  // Hides the view while an enclosing ScrollView has it far outside of its viewport.  Views are no longer culled once
+  // they are unmounted.
+  void Culled(bool culled) noexcept;
+  bool Culled() const noexcept;
+
   const facebook::react::SharedViewProps &viewProps() const noexcept override;
   winrt::Microsoft::ReactNative::ViewProps ViewProps() noexcept;
 
@@ -220,7 +286,8 @@ struct ViewComponentView : public ViewComponentViewT<
       facebook::react::Tag tag,
       winrt::Microsoft::ReactNative::ReactContext const &reactContext,
       ComponentViewFeatures flags,
-      winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder = nullptr);
+      winrt::Microsoft::ReactNative::Composition::ReactCompositionViewComponentBuilder *builder = nullptr,
+      bool collapseOuterVisual = false);
 
   virtual winrt::Microsoft::ReactNative::Composition::Experimental::IVisual createVisual() noexcept;
 
@@ -236,6 +303,7 @@ struct ViewComponentView : public ViewComponentViewT<
 
  private:
   bool m_hasNonVisualChildren{false};
+  bool m_culled{false};
   facebook::react::SharedViewProps m_props;
   winrt::Microsoft::ReactNative::Composition::Experimental::IVisual m_visual{nullptr};
   winrt::Microsoft::ReactNative::Composition::Experimental::CreateInternalVisualDelegate m_createInternalVisualHandler{
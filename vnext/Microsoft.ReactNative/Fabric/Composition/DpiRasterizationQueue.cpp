@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "DpiRasterizationQueue.h"
+
+#include <Fabric/ComponentView.h>
+#include <algorithm>
+#include <limits>
+#include "RootComponentView.h"
+#include "ScrollViewComponentView.h"
+
+namespace Microsoft::ReactNative {
+
+// 0 for a view that is within the client rects of its root and of every ScrollView that contains it, otherwise how far
+// it is from them, in pixels
+static int64_t DistanceToViewport(const winrt::Microsoft::ReactNative::ComponentView &view) noexcept {
+  auto componentView = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(view);
+  auto root = componentView->rootComponentView();
+  if (!root || !componentView->isMounted()) {
+    return std::numeric_limits<int64_t>::max();
+  }
+
+  RECT viewportRect = root->getClientRect();
+  for (auto parent = view.Parent(); parent; parent = parent.Parent()) {
+    if (auto scrollView =
+            parent.try_as<winrt::Microsoft::ReactNative::Composition::implementation::ScrollViewComponentView>()) {
+      const auto scrollViewportRect = scrollView->getClientRect();
+      IntersectRect(&viewportRect, &viewportRect, &scrollViewportRect);
+    }
+  }
+
+  const auto clientRect = componentView->getClientRect();
+  const int64_t dx = std::max<int64_t>({viewportRect.left - clientRect.right, clientRect.left - viewportRect.right, 0});
+  const int64_t dy = std::max<int64_t>({viewportRect.top - clientRect.bottom, clientRect.top - viewportRect.bottom, 0});
+  return dx + dy;
+}
+
+DpiRasterizationQueue::DpiRasterizationQueue(winrt::Microsoft::ReactNative::ReactContext const &context) noexcept
+    : m_context(context) {}
+
+void DpiRasterizationQueue::enqueue(winrt::Microsoft::ReactNative::ComponentView const &view) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  m_views.push_back(winrt::make_weak(view));
+  scheduleRasterization();
+}
+
+void DpiRasterizationQueue::scheduleRasterization() noexcept {
+  if (m_isRasterizationScheduled) {
+    return;
+  }
+  m_isRasterizationScheduled = true;
+
+  // Posted, so that the mount transaction that changed the scale is committed with the stretched content first
+  m_context.UIDispatcher().Post([wkThis = weak_from_this()]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->rasterize();
+    }
+  });
+}
+
+void DpiRasterizationQueue::rasterize() noexcept {
+  m_isRasterizationScheduled = false;
+
+  // The order is worked out again for each task, since the views might have scrolled or moved in between
+  std::vector<std::pair<int64_t, winrt::Microsoft::ReactNative::ComponentView>> views;
+  views.reserve(m_views.size());
+  for (const auto &wkView : m_views) {
+    if (auto view = wkView.get()) {
+      views.emplace_back(DistanceToViewport(view), std::move(view));
+    }
+  }
+  m_views.clear();
+  std::stable_sort(
+      views.begin(), views.end(), [](const auto &left, const auto &right) { return left.first < right.first; });
+
+  // At least one view is redrawn per task, even if it takes longer than the budget
+  const auto deadline = std::chrono::steady_clock::now() + FrameBudget;
+  auto it = views.begin();
+  while (it != views.end()) {
+    winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(it->second)
+        ->rasterizeAtCurrentScale();
+    ++it;
+    if (std::chrono::steady_clock::now() >= deadline) {
+      break;
+    }
+  }
+
+  for (; it != views.end(); ++it) {
+    m_views.push_back(winrt::make_weak(it->second));
+  }
+  if (!m_views.empty()) {
+    scheduleRasterization();
+  }
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <ReactContext.h>
+#include <winrt/Microsoft.ReactNative.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Spreads the redrawing of the views of a root over several UI thread tasks after its scale factor changes, like when
+// its window moves to a monitor of another DPI, instead of redrawing all of them in the mount transaction that applies
+// the new scale.  Until a view is redrawn it shows its content at the previous scale, stretched to its new size.  Each
+// task redraws views until it has run for the frame budget, starting with the ones within the viewport, then the ones
+// closest to it, so the visible content is sharp first and input is handled in between.  All methods must be called on
+// the UI thread.
+class DpiRasterizationQueue final : public std::enable_shared_from_this<DpiRasterizationQueue> {
+ public:
+  static constexpr std::chrono::milliseconds FrameBudget{8};
+
+  DpiRasterizationQueue(winrt::Microsoft::ReactNative::ReactContext const &context) noexcept;
+
+  // The view is redrawn with ComponentView::rasterizeAtCurrentScale, unless it is gone by then
+  void enqueue(winrt::Microsoft::ReactNative::ComponentView const &view) noexcept;
+
+ private:
+  void scheduleRasterization() noexcept;
+  void rasterize() noexcept;
+
+  winrt::Microsoft::ReactNative::ReactContext m_context;
+  std::vector<winrt::weak_ref<winrt::Microsoft::ReactNative::ComponentView>> m_views;
+  bool m_isRasterizationScheduled{false};
+};
+
+} // namespace Microsoft::ReactNative
@@ -14,15 +14,20 @@
 
 #include <AutoDraw.h>
 #include <Fabric/AbiViewProps.h>
+#include <Fabric/AnimatedImage.h>
+#include <Fabric/DecodedImageCache.h>
 #include <Fabric/FabricUIManagerModule.h>
 #include <Utils/ImageUtils.h>
+#include <d2d1_3.h>
 #include <shcore.h>
 #include <winrt/Windows.Graphics.Effects.h>
 #include <winrt/Windows.UI.Composition.h>
 #include <winrt/Windows.Web.Http.Headers.h>
 #include <winrt/Windows.Web.Http.h>
 #include "CompositionHelpers.h"
+#include "ImageSurfaceCache.h"
 #include "RootComponentView.h"
+#include "ScrollViewComponentView.h"
 
 extern "C" HRESULT WINAPI WICCreateImagingFactory_Proxy(UINT SDKVersion, IWICImagingFactory **ppIWICImagingFactory);
 
@@ -110,7 +115,19 @@ void ImageComponentView::didReceiveProgress(float progress, int loaded, int tota
   if (imageEventEmitter) {
     imageEventEmitter->onProgress(progress, loaded, total);
   }
+
+  // Progressive images are shown at the quality received so far, until the full image arrives
+  if (m_imageLoading) {
+    if (auto preview = ::Microsoft::ReactNative::DecodedImageCache::Instance().requestPreview(
+            ::Microsoft::ReactNative::DecodedImageCache::Key{m_state->getData().getImageSource()});
+        preview && preview != m_imageResponseImage) {
+      m_imageResponseImage = preview;
+      m_drawingSurface = nullptr;
+      m_animationFrame = nullptr;
+    }
+  }
   ensureDrawingSurface();
+  updateAnimation();
 }
 
 void ImageComponentView::didReceiveImage(const std::shared_ptr<ImageResponseImage> &imageResponseImage) noexcept {
@@ -129,8 +146,21 @@ void ImageComponentView::didReceiveImage(const std::shared_ptr<ImageResponseImag
   assert(uiDispatcher.HasThreadAccess());
 #endif
 
+  if (m_imageLoading) {
+    m_imageLoading = false;
+    m_viewportScrollRevokers.clear();
+    ::Microsoft::ReactNative::ImageLoadScheduler::Instance().clearPriority(
+        &m_state->getData().getImageRequest().getObserverCoordinator());
+  }
+
+  if (m_imageResponseImage != imageResponseImage) {
+    // The surface was drawn from a preview, or the previous image
+    m_drawingSurface = nullptr;
+    m_animationFrame = nullptr;
+  }
   m_imageResponseImage = imageResponseImage;
   ensureDrawingSurface();
+  updateAnimation();
 }
 
 void ImageComponentView::didReceiveFailureFromObserver(const facebook::react::ImageLoadError &error) noexcept {
@@ -189,9 +219,14 @@ void ImageComponentView::setStateAndResubscribeImageResponseObserver(
   if (m_state) {
     auto &observerCoordinator = m_state->getData().getImageRequest().getObserverCoordinator();
     observerCoordinator.removeObserver(*m_imageResponseObserver);
+    ::Microsoft::ReactNative::ImageLoadScheduler::Instance().clearPriority(&observerCoordinator);
   }
 
   m_state = state;
+  // Images that were already loaded are received again from the observer coordinator, which ends the loading
+  m_imageLoading = m_state != nullptr;
+  updateViewportSubscription();
+  updateLoadPriority();
 
   if (m_state) {
     auto &observerCoordinator = m_state->getData().getImageRequest().getObserverCoordinator();
@@ -201,6 +236,79 @@ void ImageComponentView::setStateAndResubscribeImageResponseObserver(
 
 void ImageComponentView::prepareForRecycle() noexcept {
   setStateAndResubscribeImageResponseObserver(nullptr);
+  Super::prepareForRecycle();
+}
+
+void ImageComponentView::onMounted() noexcept {
+  Super::onMounted();
+  updateViewportSubscription();
+  updateLoadPriority();
+  updateAnimation();
+}
+
+void ImageComponentView::onUnmounted() noexcept {
+  m_viewportScrollRevokers.clear();
+  updateLoadPriority();
+  updateAnimation();
+  Super::onUnmounted();
+}
+
+::Microsoft::ReactNative::ImageLoadPriority ImageComponentView::LoadPriority() noexcept {
+  auto root = rootComponentView();
+  if (!isMounted() || !root) {
+    return ::Microsoft::ReactNative::ImageLoadPriority::Offscreen;
+  }
+
+  RECT viewportRect = root->getClientRect();
+  for (auto view = Parent(); view; view = view.Parent()) {
+    if (auto scrollView = view.try_as<ScrollViewComponentView>()) {
+      const auto scrollViewportRect = scrollView->getClientRect();
+      IntersectRect(&viewportRect, &viewportRect, &scrollViewportRect);
+    }
+  }
+  if (IsRectEmpty(&viewportRect)) {
+    return ::Microsoft::ReactNative::ImageLoadPriority::Offscreen;
+  }
+
+  const auto clientRect = getClientRect();
+  RECT intersection;
+  if (IntersectRect(&intersection, &clientRect, &viewportRect)) {
+    return ::Microsoft::ReactNative::ImageLoadPriority::Visible;
+  }
+
+  // Images less than a viewport away are the next ones scrolled into view
+  InflateRect(&viewportRect, viewportRect.right - viewportRect.left, viewportRect.bottom - viewportRect.top);
+  return IntersectRect(&intersection, &clientRect, &viewportRect)
+      ? ::Microsoft::ReactNative::ImageLoadPriority::NearViewport
+      : ::Microsoft::ReactNative::ImageLoadPriority::Offscreen;
+}
+
+void ImageComponentView::updateLoadPriority() noexcept {
+  if (!m_state || !m_imageLoading) {
+    return;
+  }
+  ::Microsoft::ReactNative::ImageLoadScheduler::Instance().setPriority(
+      &m_state->getData().getImageRequest().getObserverCoordinator(), LoadPriority());
+}
+
+void ImageComponentView::updateViewportSubscription() noexcept {
+  m_viewportScrollRevokers.clear();
+  if (!m_imageLoading || !isMounted()) {
+    return;
+  }
+
+  for (auto view = Parent(); view; view = view.Parent()) {
+    if (auto scrollView = view.try_as<ScrollViewComponentView>()) {
+      m_viewportScrollRevokers.push_back(scrollView->ScrollPositionChanged(
+          [wkThis = get_weak()](
+              winrt::IInspectable const & /*sender*/,
+              winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const & /*args*/) {
+            if (auto strongThis = wkThis.get()) {
+              strongThis->updateLoadPriority();
+            }
+          }));
+    }
+  }
 }
 
 winrt::Microsoft::ReactNative::ImageProps ImageComponentView::ImageProps() noexcept {
@@ -219,7 +327,53 @@ winrt::Microsoft::ReactNative::ViewProps ImageComponentView::ViewPropsInner() no
   return winrt::make<winrt::Microsoft::ReactNative::implementation::ImageProps>(viewProps());
 }
 
+void ImageComponentView::updateAnimation() noexcept {
+  if (!isMounted() || !m_imageResponseImage || !m_imageResponseImage->m_animatedImage) {
+    if (m_animationTimer) {
+      m_animationTimer.Stop();
+      m_animationTimer = nullptr;
+    }
+    return;
+  }
+
+  if (!m_animationTimer) {
+    m_animationTimer = winrt::Microsoft::ReactNative::Timer::Create(m_reactContext.Properties().Handle());
+    m_animationTimer.Tick([wkThis = get_weak()](
+                              const winrt::Windows::Foundation::IInspectable &,
+                              const winrt::Windows::Foundation::IInspectable &) {
+      if (auto strongThis = wkThis.get()) {
+        strongThis->onAnimationTick();
+      }
+    });
+    onAnimationTick();
+  }
+}
+
+void ImageComponentView::onAnimationTick() noexcept {
+  if (!m_animationTimer || !m_imageResponseImage || !m_imageResponseImage->m_animatedImage) {
+    return;
+  }
+
+  std::chrono::milliseconds untilNextFrame;
+  auto frame = m_imageResponseImage->m_animatedImage->frameAt(std::chrono::steady_clock::now(), untilNextFrame);
+  if (frame != m_animationFrame) {
+    m_animationFrame = std::move(frame);
+    if (m_drawingSurface) {
+      DrawImage();
+    }
+  }
+
+  // Each frame is shown for its own delay
+  m_animationTimer.Stop();
+  m_animationTimer.Interval(std::max(untilNextFrame, std::chrono::milliseconds(1)));
+  m_animationTimer.Start();
+}
+
 void ImageComponentView::OnRenderingDeviceLost() noexcept {
+  Super::OnRenderingDeviceLost();
+
+  // The first view to find out redraws the image to a new surface, which the other views showing it then share
+  ImageSurfaceCache::Instance().remove(m_drawingSurface);
   m_drawingSurface = nullptr;
   ensureDrawingSurface();
 }
@@ -255,6 +409,13 @@ void ImageComponentView::ensureDrawingSurface() noexcept {
     const auto &imgProps = imageProps();
     const auto frame{m_layoutMetrics.getContentFrame().size};
 
+    if (imgProps.resizeMode == facebook::react::ImageResizeMode::None) {
+      // The image might have been decoded smaller than it is, but is drawn at its natural size
+      drawingSurfaceSize = {
+          static_cast<float>(m_imageResponseImage->m_naturalWidth),
+          static_cast<float>(m_imageResponseImage->m_naturalHeight)};
+    }
+
     if (imgProps.resizeMode == facebook::react::ImageResizeMode::Repeat) {
       drawingSurfaceSize = {
           frame.width * m_layoutMetrics.pointScaleFactor, frame.height * m_layoutMetrics.pointScaleFactor};
@@ -267,45 +428,64 @@ void ImageComponentView::ensureDrawingSurface() noexcept {
       drawingSurfaceSize = {drawingSurfaceSize.Width + bmpGrowth, drawingSurfaceSize.Height + bmpGrowth};
     }
 
-    m_drawingSurface = m_compContext.CreateDrawingSurfaceBrush(
-        drawingSurfaceSize,
-        winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
-        winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
-
-    DrawImage();
-
+    auto stretch{winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::None};
     switch (imgProps.resizeMode) {
       case facebook::react::ImageResizeMode::Stretch:
-        m_drawingSurface.Stretch(winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::Fill);
+        stretch = winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::Fill;
         break;
       case facebook::react::ImageResizeMode::Cover:
-        m_drawingSurface.Stretch(
-            winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::UniformToFill);
+        stretch = winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::UniformToFill;
         break;
       case facebook::react::ImageResizeMode::Contain:
-        m_drawingSurface.Stretch(winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::Uniform);
+        stretch = winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::Uniform;
         break;
+      // Repeat and Center use the same Stretch logic
       case facebook::react::ImageResizeMode::Repeat:
-        // TODO - set AlignmentRatio back to 0.5f when switching between resizeModes once we no longer recreate the
-        // drawing surface on prop changes.
-        m_drawingSurface.HorizontalAlignmentRatio(0.0f);
-        m_drawingSurface.VerticalAlignmentRatio(0.0f);
-        // Repeat and Center use the same Stretch logic, so we can fallthrough here.
-        [[fallthrough]];
       case facebook::react::ImageResizeMode::Center: {
-        m_drawingSurface.Stretch(
-            (height < frame.height && width < frame.width)
-                ? winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::None
-                : winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::Uniform);
+        stretch = (height < frame.height && width < frame.width)
+            ? winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::None
+            : winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::Uniform;
         break;
       }
       case facebook::react::ImageResizeMode::None:
-        m_drawingSurface.Stretch(winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::None);
+        stretch = winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::None;
         break;
       default:
         assert(false);
     }
 
+    // Images drawn only from their bitmap look the same in every view, so views showing the same image share the
+    // surface.  Animated images are drawn frame by frame by each view, and colors depend on the theme of the view.
+    const bool shareSurface{!m_imageResponseImage->m_animatedImage && !themeEffectsImage()};
+    const ImageSurfaceCache::Params surfaceParams{
+        m_compContext, drawingSurfaceSize, imgProps.resizeMode, stretch, imgProps.blurRadius};
+    if (shareSurface) {
+      m_drawingSurface = ImageSurfaceCache::Instance().find(m_imageResponseImage, surfaceParams);
+    }
+
+    if (!m_drawingSurface) {
+      ::Microsoft::ReactNative::Composition::DrawingSurfaceOwnerScope ownerScope(
+          ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Image);
+      m_drawingSurface = m_compContext.CreateDrawingSurfaceBrush(
+          drawingSurfaceSize,
+          winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+          winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+
+      DrawImage();
+
+      if (imgProps.resizeMode == facebook::react::ImageResizeMode::Repeat) {
+        // TODO - set AlignmentRatio back to 0.5f when switching between resizeModes once we no longer recreate the
+        // drawing surface on prop changes.
+        m_drawingSurface.HorizontalAlignmentRatio(0.0f);
+        m_drawingSurface.VerticalAlignmentRatio(0.0f);
+      }
+      m_drawingSurface.Stretch(stretch);
+
+      if (shareSurface) {
+        ImageSurfaceCache::Instance().insert(m_imageResponseImage, surfaceParams, m_drawingSurface);
+      }
+    }
+
     Visual().as<Experimental::ISpriteVisual>().Brush(m_drawingSurface);
   } else if (m_imageResponseImage->m_brushFactory) {
     Visual().as<Experimental::ISpriteVisual>().Brush(
@@ -323,7 +503,8 @@ void ImageComponentView::DrawImage() noexcept {
     return;
   }
 
-  if (!m_imageResponseImage->m_wicbmp) {
+  const auto &wicbmp = m_animationFrame ? m_animationFrame : m_imageResponseImage->m_wicbmp;
+  if (!wicbmp) {
     return;
   }
 
@@ -331,10 +512,6 @@ void ImageComponentView::DrawImage() noexcept {
 
   ::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface autoDraw(m_drawingSurface, 1.0f, &offset);
   if (auto d2dDeviceContext = autoDraw.GetRenderTarget()) {
-    winrt::com_ptr<ID2D1Bitmap1> bitmap;
-    winrt::check_hresult(
-        d2dDeviceContext->CreateBitmapFromWicBitmap(m_imageResponseImage->m_wicbmp.get(), nullptr, bitmap.put()));
-
     d2dDeviceContext->Clear(D2D1::ColorF(D2D1::ColorF::Black, 0.0f));
     if (viewProps()->backgroundColor) {
       d2dDeviceContext->Clear(theme()->D2DColor(*viewProps()->backgroundColor));
@@ -346,11 +523,30 @@ void ImageComponentView::DrawImage() noexcept {
         imgProps.blurRadius > 0 || isColorMeaningful(imgProps.tintColor) ||
         imgProps.resizeMode == facebook::react::ImageResizeMode::Repeat};
 
+    // Images decoded smaller than their natural size are scaled back up for the modes that do not scale the image
+    UINT bitmapWidth, bitmapHeight;
+    winrt::check_hresult(wicbmp->GetSize(&bitmapWidth, &bitmapHeight));
+    UINT width{bitmapWidth}, height{bitmapHeight};
+    const bool drawAtNaturalSize{
+        imgProps.resizeMode == facebook::react::ImageResizeMode::Repeat ||
+        imgProps.resizeMode == facebook::react::ImageResizeMode::None};
+    if (drawAtNaturalSize && m_imageResponseImage->m_naturalWidth && m_imageResponseImage->m_naturalHeight) {
+      width = m_imageResponseImage->m_naturalWidth;
+      height = m_imageResponseImage->m_naturalHeight;
+    }
+
     if (useEffects) {
       winrt::com_ptr<ID2D1Effect> bitmapEffects;
       winrt::check_hresult(d2dDeviceContext->CreateEffect(CLSID_D2D1BitmapSource, bitmapEffects.put()));
-      winrt::check_hresult(
-          bitmapEffects->SetValue(D2D1_BITMAPSOURCE_PROP_WIC_BITMAP_SOURCE, m_imageResponseImage->m_wicbmp.get()));
+      winrt::check_hresult(bitmapEffects->SetValue(D2D1_BITMAPSOURCE_PROP_WIC_BITMAP_SOURCE, wicbmp.get()));
+
+      if (bitmapWidth != width || bitmapHeight != height) {
+        winrt::check_hresult(bitmapEffects->SetValue(
+            D2D1_BITMAPSOURCE_PROP_SCALE,
+            D2D1::Vector2F(static_cast<float>(width) / bitmapWidth, static_cast<float>(height) / bitmapHeight)));
+        winrt::check_hresult(bitmapEffects->SetValue(
+            D2D1_BITMAPSOURCE_PROP_INTERPOLATION_MODE, D2D1_BITMAPSOURCE_INTERPOLATION_MODE_CUBIC));
+      }
 
       if (imgProps.blurRadius > 0) {
         winrt::com_ptr<ID2D1Effect> gaussianBlurEffect;
@@ -397,16 +593,39 @@ void ImageComponentView::DrawImage() noexcept {
             bitmapEffects.get(), {static_cast<float>(offset.x), static_cast<float>(offset.y)}, imageBounds);
       }
     } else {
-      UINT width, height;
-      winrt::check_hresult(m_imageResponseImage->m_wicbmp->GetSize(&width, &height));
-
       D2D1_RECT_F rect = D2D1::RectF(
           static_cast<float>(offset.x),
           static_cast<float>(offset.y),
           static_cast<float>(offset.x + width),
           static_cast<float>(offset.y + height));
-
-      d2dDeviceContext->DrawBitmap(bitmap.get(), rect);
+      const auto interpolationMode = (bitmapWidth != width || bitmapHeight != height)
+          ? D2D1_INTERPOLATION_MODE_HIGH_QUALITY_CUBIC
+          : D2D1_INTERPOLATION_MODE_LINEAR;
+
+      // Bitmaps larger than the textures of the device, like huge photos and maps drawn at their natural size, cannot
+      // be uploaded whole.  They are drawn from an image source that loads and caches only the tiles that are drawn.
+      const auto maxBitmapSize = d2dDeviceContext->GetMaximumBitmapSize();
+      winrt::com_ptr<ID2D1DeviceContext2> deviceContext2;
+      if ((bitmapWidth > maxBitmapSize || bitmapHeight > maxBitmapSize) &&
+          SUCCEEDED(d2dDeviceContext->QueryInterface(IID_ID2D1DeviceContext2, deviceContext2.put_void()))) {
+        winrt::com_ptr<ID2D1ImageSourceFromWic> imageSource;
+        winrt::check_hresult(deviceContext2->CreateImageSourceFromWic(
+            wicbmp.get(), D2D1_IMAGE_SOURCE_LOADING_OPTIONS_CACHE_ON_DEMAND, imageSource.put()));
+
+        D2D1_MATRIX_3X2_F transform;
+        d2dDeviceContext->GetTransform(&transform);
+        const auto scale =
+            D2D1::Matrix3x2F::Scale(static_cast<float>(width) / bitmapWidth, static_cast<float>(height) / bitmapHeight);
+        d2dDeviceContext->SetTransform(
+            scale * D2D1::Matrix3x2F::Translation(static_cast<float>(offset.x), static_cast<float>(offset.y)) *
+            transform);
+        d2dDeviceContext->DrawImage(imageSource.get(), interpolationMode);
+        d2dDeviceContext->SetTransform(transform);
+      } else {
+        winrt::com_ptr<ID2D1Bitmap1> bitmap;
+        winrt::check_hresult(d2dDeviceContext->CreateBitmapFromWicBitmap(wicbmp.get(), nullptr, bitmap.put()));
+        d2dDeviceContext->DrawBitmap(bitmap.get(), &rect, 1.0f, interpolationMode);
+      }
     }
   }
 }
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <Fabric/ComponentView.h>
+#include <Fabric/ImageLoadScheduler.h>
 
 #include <Microsoft.ReactNative.Cxx/ReactContext.h>
 #include <react/renderer/components/image/ImageShadowNode.h>
@@ -47,6 +48,8 @@ struct ImageComponentView : ImageComponentViewT<ImageComponentView, ViewComponen
   void updateState(facebook::react::State::Shared const &state, facebook::react::State::Shared const &oldState) noexcept
       override;
   void prepareForRecycle() noexcept override;
+  void onMounted() noexcept override;
+  void onUnmounted() noexcept override;
   void OnRenderingDeviceLost() noexcept override;
   void onThemeChanged() noexcept override;
 
@@ -92,11 +95,25 @@ struct ImageComponentView : ImageComponentViewT<ImageComponentView, ViewComponen
   void setStateAndResubscribeImageResponseObserver(
       facebook::react::ImageShadowNode::ConcreteState::Shared const &state) noexcept;
   bool themeEffectsImage() const noexcept;
+  // How soon the image is likely to be seen, from where the view is relative to the enclosing scroll viewports
+  ::Microsoft::ReactNative::ImageLoadPriority LoadPriority() noexcept;
+  void updateLoadPriority() noexcept;
+  void updateViewportSubscription() noexcept;
+  // Plays animated images while the view is mounted
+  void updateAnimation() noexcept;
+  void onAnimationTick() noexcept;
 
   winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush m_drawingSurface;
   std::shared_ptr<ImageResponseImage> m_imageResponseImage;
   std::shared_ptr<WindowsImageResponseObserver> m_imageResponseObserver;
   facebook::react::ImageShadowNode::ConcreteState::Shared m_state;
+  // Whether the image of m_state has not been received yet, the priority of its load follows scrolling until it is
+  bool m_imageLoading{false};
+  std::vector<winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual::ScrollPositionChanged_revoker>
+      m_viewportScrollRevokers;
+  winrt::Microsoft::ReactNative::ITimer m_animationTimer{nullptr};
+  // The frame of the animated image drawn to the surface, nullptr until the animation moves past its first frame
+  winrt::com_ptr<IWICBitmap> m_animationFrame;
 };
 
 } // namespace winrt::Microsoft::ReactNative::Composition::implementation
@@ -6,11 +6,21 @@
 
 #include <wincodec.h>
 #include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
+#include <memory>
+
+namespace Microsoft::ReactNative {
+class AnimatedImage;
+} // namespace Microsoft::ReactNative
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
 struct ImageResponseImage {
   winrt::com_ptr<IWICBitmap> m_wicbmp;
+  // Size of the image before it was decoded to m_wicbmp, which can be smaller when the image is shown scaled down
+  UINT m_naturalWidth{0};
+  UINT m_naturalHeight{0};
+  // The frames of animated images, m_wicbmp is their first frame
+  std::shared_ptr<::Microsoft::ReactNative::AnimatedImage> m_animatedImage;
   winrt::Microsoft::ReactNative::Composition::Experimental::UriBrushFactory m_brushFactory{nullptr};
 };
 
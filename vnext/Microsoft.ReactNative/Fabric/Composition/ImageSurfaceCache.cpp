@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "ImageSurfaceCache.h"
+
+#include <algorithm>
+
+namespace winrt::Microsoft::ReactNative::Composition::implementation {
+
+bool ImageSurfaceCache::Params::operator==(const Params &other) const noexcept {
+  return compositionContext == other.compositionContext && surfaceSize == other.surfaceSize &&
+      resizeMode == other.resizeMode && stretch == other.stretch && blurRadius == other.blurRadius;
+}
+
+ImageSurfaceCache &ImageSurfaceCache::Instance() noexcept {
+  // Intentionally leaked, like the DecodedImageCache whose images it holds the surfaces of
+  static ImageSurfaceCache *s_instance = new ImageSurfaceCache();
+  return *s_instance;
+}
+
+winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush ImageSurfaceCache::find(
+    const std::shared_ptr<ImageResponseImage> &image,
+    const Params &params) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto it = m_entries.find(image.get());
+  if (it == m_entries.end()) {
+    return nullptr;
+  }
+
+  for (const auto &entry : it->second) {
+    // The address could be reused by a later image, once the image of the entry is released
+    if (entry.params == params && entry.image.lock() == image) {
+      return entry.brush.get();
+    }
+  }
+  return nullptr;
+}
+
+void ImageSurfaceCache::insert(
+    const std::shared_ptr<ImageResponseImage> &image,
+    const Params &params,
+    const winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush &brush) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto &entries = m_entries[image.get()];
+  entries.erase(
+      std::remove_if(
+          entries.begin(),
+          entries.end(),
+          [&](const Entry &entry) {
+            return entry.image.expired() || !entry.brush.get() ||
+                (entry.params == params && entry.image.lock() == image);
+          }),
+      entries.end());
+  entries.push_back({image, params, winrt::make_weak(brush)});
+
+  if (m_entries.size() > m_purgeAt) {
+    purgeLocked();
+    m_purgeAt = std::max<size_t>(64, m_entries.size() * 2);
+  }
+}
+
+void ImageSurfaceCache::remove(
+    const winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush &brush) noexcept {
+  if (!brush) {
+    return;
+  }
+
+  std::scoped_lock lock{m_mutex};
+  for (auto &[image, entries] : m_entries) {
+    entries.erase(
+        std::remove_if(
+            entries.begin(), entries.end(), [&brush](const Entry &entry) { return entry.brush.get() == brush; }),
+        entries.end());
+  }
+}
+
+size_t ImageSurfaceCache::size() noexcept {
+  std::scoped_lock lock{m_mutex};
+  purgeLocked();
+  size_t size = 0;
+  for (auto &[image, entries] : m_entries) {
+    size += entries.size();
+  }
+  return size;
+}
+
+void ImageSurfaceCache::purgeLocked() noexcept {
+  for (auto it = m_entries.begin(); it != m_entries.end();) {
+    auto &entries = it->second;
+    entries.erase(
+        std::remove_if(
+            entries.begin(),
+            entries.end(),
+            [](const Entry &entry) { return entry.image.expired() || !entry.brush.get(); }),
+        entries.end());
+    it = entries.empty() ? m_entries.erase(it) : std::next(it);
+  }
+}
+
+} // namespace winrt::Microsoft::ReactNative::Composition::implementation
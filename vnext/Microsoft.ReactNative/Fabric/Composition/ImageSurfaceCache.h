@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/imagemanager/primitives.h>
+
+#include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "ImageResponseImage.h"
+
+namespace winrt::Microsoft::ReactNative::Composition::implementation {
+
+// Drawing surfaces of images that several ImageComponentViews draw the same way, like an avatar shown in every row of a
+// list.  Views showing the same decoded image, from the DecodedImageCache, at the same surface size and with the same
+// resizeMode and blur bind the same surface brush, so that the image is only held on the GPU once.
+// Surfaces are only held on to by the views using them.
+class ImageSurfaceCache final {
+ public:
+  // Everything besides the image that the surface and its brush depend on
+  struct Params {
+    winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext compositionContext{nullptr};
+    winrt::Windows::Foundation::Size surfaceSize{};
+    facebook::react::ImageResizeMode resizeMode{facebook::react::ImageResizeMode::Cover};
+    winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch stretch{};
+    facebook::react::Float blurRadius{0};
+
+    bool operator==(const Params &other) const noexcept;
+  };
+
+  static ImageSurfaceCache &Instance() noexcept;
+
+  // Returns nullptr when no view has drawn the image with the params
+  winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush find(
+      const std::shared_ptr<ImageResponseImage> &image,
+      const Params &params) noexcept;
+
+  void insert(
+      const std::shared_ptr<ImageResponseImage> &image,
+      const Params &params,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush &brush) noexcept;
+
+  // Stops sharing the brush, whose surface lost its content with the rendering device
+  void remove(const winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush &brush) noexcept;
+
+  // The number of brushes that are shared
+  size_t size() noexcept;
+
+ private:
+  struct Entry {
+    std::weak_ptr<ImageResponseImage> image;
+    Params params;
+    winrt::weak_ref<winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush> brush;
+  };
+
+  ImageSurfaceCache() noexcept = default;
+
+  void purgeLocked() noexcept;
+
+  std::mutex m_mutex;
+  std::unordered_map<const ImageResponseImage *, std::vector<Entry>> m_entries;
+  size_t m_purgeAt{64};
+};
+
+} // namespace winrt::Microsoft::ReactNative::Composition::implementation
@@ -7,11 +7,15 @@
 
 #include "../../../codegen/react/components/rnwcore/ModalHostView.g.h"
 #include <ComponentView.Experimental.interop.h>
+#include <ReactPropertyBag.h>
 #include <winrt/Microsoft.UI.Content.h>
 #include <winrt/Microsoft.UI.Input.h>
 #include <winrt/Microsoft.UI.Windowing.h>
 #include <winrt/Microsoft.UI.interop.h>
 
+#include <memory>
+#include <utility>
+
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
 struct ModalHostState
@@ -32,6 +36,101 @@ struct ModalHostState
   winrt::Microsoft::ReactNative::LayoutConstraints m_layoutConstraints;
 };
 
+// The popup window of a modal, with its presenter already configured.  Creating the window and applying the presenter
+// is most of the cost of opening a modal, so one spare window is created ahead of time for the next modal.
+struct ModalWindow {
+  winrt::Microsoft::UI::Content::DesktopPopupSiteBridge popUp{nullptr};
+  winrt::Microsoft::UI::Windowing::AppWindow appWindow{nullptr};
+};
+
+// Keeps one spare modal window per React instance, created on the UI thread after a modal is shown, for the next modal
+// opened from the same parent island.  The content island of a modal cannot be pooled, since it is bound to the root
+// view of its portal.
+class ModalWindowPool : public std::enable_shared_from_this<ModalWindowPool> {
+ public:
+  ~ModalWindowPool() {
+    if (m_spare.popUp) {
+      if (m_spare.appWindow) {
+        m_spare.appWindow.Destroy();
+      }
+      m_spare.popUp.Close();
+    }
+  }
+
+  static std::shared_ptr<ModalWindowPool> FromContext(
+      const winrt::Microsoft::ReactNative::ReactContext &context) noexcept {
+    static const winrt::Microsoft::ReactNative::ReactPropertyId<
+        winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<ModalWindowPool>>>
+        s_poolPropertyId{L"ReactNative.Composition", L"ModalWindowPool"};
+
+    return *context.Properties().GetOrCreate(
+        s_poolPropertyId, []() -> std::shared_ptr<ModalWindowPool> { return std::make_shared<ModalWindowPool>(); });
+  }
+
+  // Returns the spare window if it was created for the parent island, or a new window otherwise
+  ModalWindow Take(const winrt::Microsoft::UI::Content::ContentIsland &parentIsland) noexcept {
+    if (m_spare.popUp && m_spareParentIsland.get() == parentIsland) {
+      m_spareParentIsland = nullptr;
+      return std::exchange(m_spare, {});
+    }
+
+    return Create(parentIsland);
+  }
+
+  // Creates the spare window once the UI thread is done with the work already queued, like showing the current modal
+  void QueuePrecreate(
+      const winrt::Microsoft::ReactNative::ReactContext &context,
+      const winrt::Microsoft::UI::Content::ContentIsland &parentIsland) noexcept {
+    if (m_spare.popUp || m_precreateQueued) {
+      return;
+    }
+    m_precreateQueued = true;
+
+    context.UIDispatcher().Post([wkThis = weak_from_this(), wkParentIsland = winrt::make_weak(parentIsland)]() {
+      if (auto strongThis = wkThis.lock()) {
+        strongThis->m_precreateQueued = false;
+        auto parentIsland = wkParentIsland.get();
+        if (!strongThis->m_spare.popUp && parentIsland && !parentIsland.IsClosed()) {
+          strongThis->m_spare = Create(parentIsland);
+          strongThis->m_spareParentIsland = wkParentIsland;
+        }
+      }
+    });
+  }
+
+ private:
+  static ModalWindow Create(const winrt::Microsoft::UI::Content::ContentIsland &parentIsland) noexcept {
+    ModalWindow window;
+    window.popUp = winrt::Microsoft::UI::Content::DesktopPopupSiteBridge::Create(parentIsland);
+
+    // Get AppWindow and configure presenter
+    window.appWindow = winrt::Microsoft::UI::Windowing::AppWindow::GetFromWindowId(window.popUp.WindowId());
+    if (window.appWindow) {
+      auto overlappedPresenter = winrt::Microsoft::UI::Windowing::OverlappedPresenter::Create();
+
+      // Configure presenter for modal behavior
+      overlappedPresenter.IsModal(true);
+      overlappedPresenter.SetBorderAndTitleBar(true, true);
+
+      // modal should only have close button
+      overlappedPresenter.IsMinimizable(false);
+      overlappedPresenter.IsMaximizable(false);
+
+      // Apply the presenter to the window
+      window.appWindow.SetPresenter(overlappedPresenter);
+
+      // Hide the title bar icon
+      window.appWindow.TitleBar().IconShowOptions(
+          winrt::Microsoft::UI::Windowing::IconShowOptions::HideIconAndSystemMenu);
+    }
+    return window;
+  }
+
+  ModalWindow m_spare;
+  winrt::weak_ref<winrt::Microsoft::UI::Content::ContentIsland> m_spareParentIsland{nullptr};
+  bool m_precreateQueued{false};
+};
+
 struct ModalHostView : public winrt::implements<ModalHostView, winrt::Windows::Foundation::IInspectable>,
                        ::Microsoft::ReactNativeSpecs::BaseModalHostView<ModalHostView> {
   ~ModalHostView() {
@@ -282,33 +381,18 @@ struct ModalHostView : public winrt::implements<ModalHostView, winrt::Windows::F
     m_reactNativeIsland = winrt::Microsoft::ReactNative::ReactNativeIsland::CreatePortal(portal);
     auto contentIsland = m_reactNativeIsland.Island();
 
-    m_popUp = winrt::Microsoft::UI::Content::DesktopPopupSiteBridge::Create(
-        portal.Parent()
-            .as<winrt::Microsoft::ReactNative::Composition::ComponentView>()
-            .Root()
-            .ReactNativeIsland()
-            .Island());
+    auto parentIsland = portal.Parent()
+                            .as<winrt::Microsoft::ReactNative::Composition::ComponentView>()
+                            .Root()
+                            .ReactNativeIsland()
+                            .Island();
+    auto windowPool = ModalWindowPool::FromContext(m_reactContext);
+    auto window = windowPool->Take(parentIsland);
+    m_popUp = window.popUp;
     m_popUp.Connect(contentIsland);
 
-    // Get AppWindow and configure presenter
-    m_appWindow = winrt::Microsoft::UI::Windowing::AppWindow::GetFromWindowId(m_popUp.WindowId());
+    m_appWindow = window.appWindow;
     if (m_appWindow) {
-      auto overlappedPresenter = winrt::Microsoft::UI::Windowing::OverlappedPresenter::Create();
-
-      // Configure presenter for modal behavior
-      overlappedPresenter.IsModal(true);
-      overlappedPresenter.SetBorderAndTitleBar(true, true);
-
-      // modal should only have close button
-      overlappedPresenter.IsMinimizable(false);
-      overlappedPresenter.IsMaximizable(false);
-
-      // Apply the presenter to the window
-      m_appWindow.SetPresenter(overlappedPresenter);
-
-      // Hide the title bar icon
-      m_appWindow.TitleBar().IconShowOptions(winrt::Microsoft::UI::Windowing::IconShowOptions::HideIconAndSystemMenu);
-
       // Set initial title using the stored local props
       if (m_localProps && m_localProps->title.has_value()) {
         winrt::hstring titleValue = winrt::to_hstring(m_localProps->title.value());
@@ -368,6 +452,9 @@ struct ModalHostView : public winrt::implements<ModalHostView, winrt::Windows::F
     if (portal.ContentRoot().Children().Size()) {
       AdjustWindowSize(portal.ContentRoot().Children().GetAt(0).LayoutMetrics());
     }
+
+    // Prepare the window of the next modal
+    windowPool->QueuePrecreate(m_reactContext, parentIsland);
   }
 
   void UpdateConstraints() noexcept {
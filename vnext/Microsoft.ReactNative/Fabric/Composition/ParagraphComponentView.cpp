@@ -19,6 +19,7 @@
 #include <winrt/Windows.ApplicationModel.DataTransfer.h>
 #include "CompositionHelpers.h"
 #include "RootComponentView.h"
+#include "ScrollViewComponentView.h"
 #include "TextDrawing.h"
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
@@ -120,6 +121,13 @@ void ParagraphComponentView::updateState(
   const auto &newState = *std::static_pointer_cast<facebook::react::ParagraphShadowNode::ConcreteState const>(state);
 
   m_attributedStringBox = facebook::react::AttributedStringBox(newState.getData().attributedString);
+  m_transformedText = facebook::react::WindowsTextLayoutManager::GetTransformedText(m_attributedStringBox);
+  m_wordBoundaries.reset();
+  m_fragmentEventEmitters.clear();
+  for (const auto &fragment : m_attributedStringBox.getValue().getFragments()) {
+    m_fragmentEventEmitters.push_back(
+        std::static_pointer_cast<const facebook::react::ViewEventEmitter>(fragment.parentShadowView.eventEmitter));
+  }
   m_paragraphAttributes = facebook::react::ParagraphAttributes(newState.getData().paragraphAttributes);
 
   m_textLayout = nullptr;
@@ -130,9 +138,48 @@ void ParagraphComponentView::updateLayoutMetrics(
     facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept {
   Super::updateLayoutMetrics(layoutMetrics, oldLayoutMetrics);
 
-  if (layoutMetrics.pointScaleFactor != oldLayoutMetrics.pointScaleFactor) {
-    m_textLayout = nullptr;
+  if (layoutMetrics.pointScaleFactor == oldLayoutMetrics.pointScaleFactor) {
+    return;
+  }
+
+  // The text layout is in DIPs, so when only the scale factor changed, the surface drawn at the previous one is
+  // stretched to the new size until the root gets to redraw it, so that a window moving to a monitor of another DPI
+  // does not redraw all of its text at once
+  auto root = rootComponentView();
+  if (root && isMounted() && m_textLayout && m_drawingSurface && !m_rasterizationDeferred &&
+      oldLayoutMetrics.pointScaleFactor > 0 && layoutMetrics.frame.size == oldLayoutMetrics.frame.size) {
+    m_rasterizationDeferred = true;
+    const float scaleRatio = layoutMetrics.pointScaleFactor / oldLayoutMetrics.pointScaleFactor;
+    Visual().Size(
+        {oldLayoutMetrics.frame.size.width * oldLayoutMetrics.pointScaleFactor,
+         oldLayoutMetrics.frame.size.height * oldLayoutMetrics.pointScaleFactor});
+    Visual().Scale({scaleRatio, scaleRatio, 1.0f});
+    root->dpiRasterizationQueue().enqueue(*get_strong());
+    return;
   }
+
+  if (m_rasterizationDeferred) {
+    // Still showing the content of a scale factor before the previous one
+    endDeferredRasterization();
+  }
+  m_textLayout = nullptr;
+}
+
+void ParagraphComponentView::endDeferredRasterization() noexcept {
+  m_rasterizationDeferred = false;
+  Visual().Scale({1.0f, 1.0f, 1.0f});
+  Visual().Size(
+      {m_layoutMetrics.frame.size.width * m_layoutMetrics.pointScaleFactor,
+       m_layoutMetrics.frame.size.height * m_layoutMetrics.pointScaleFactor});
+  m_textLayout = nullptr;
+}
+
+void ParagraphComponentView::rasterizeAtCurrentScale() noexcept {
+  if (!m_rasterizationDeferred) {
+    return;
+  }
+  endDeferredRasterization();
+  updateVisualBrush();
 }
 
 void ParagraphComponentView::FinalizeUpdates(
@@ -142,24 +189,32 @@ void ParagraphComponentView::FinalizeUpdates(
   Super::FinalizeUpdates(updateMask);
 }
 
+std::optional<size_t> ParagraphComponentView::fragmentAtPoint(facebook::react::Point pt) noexcept {
+  if (m_fragmentEventEmitters.empty() || !m_textLayout) {
+    return std::nullopt;
+  }
+
+  // A pointer move hit tests the same point for its event emitter and for its cursor
+  if (m_lastFragmentHit && m_lastFragmentHit->first == pt) {
+    return m_lastFragmentHit->second;
+  }
+
+  std::optional<size_t> fragmentIndex;
+  BOOL isTrailingHit = false;
+  BOOL isInside = false;
+  DWRITE_HIT_TEST_METRICS metrics;
+  winrt::check_hresult(m_textLayout->HitTestPoint(pt.x, pt.y, &isTrailingHit, &isInside, &metrics));
+  if (isInside) {
+    fragmentIndex = m_transformedText->fragmentAtPosition(metrics.textPosition);
+  }
+  m_lastFragmentHit.emplace(pt, fragmentIndex);
+  return fragmentIndex;
+}
+
 facebook::react::SharedViewEventEmitter ParagraphComponentView::eventEmitterAtPoint(
     facebook::react::Point pt) noexcept {
-  if (m_attributedStringBox.getValue().getFragments().size() && m_textLayout) {
-    BOOL isTrailingHit = false;
-    BOOL isInside = false;
-    DWRITE_HIT_TEST_METRICS metrics;
-    winrt::check_hresult(m_textLayout->HitTestPoint(pt.x, pt.y, &isTrailingHit, &isInside, &metrics));
-    if (isInside) {
-      uint32_t textPosition = metrics.textPosition;
-
-      for (auto fragment : m_attributedStringBox.getValue().getFragments()) {
-        if (textPosition < fragment.string.length()) {
-          return std::static_pointer_cast<const facebook::react::ViewEventEmitter>(
-              fragment.parentShadowView.eventEmitter);
-        }
-        textPosition -= static_cast<uint32_t>(fragment.string.length());
-      }
-    }
+  if (auto fragmentIndex = fragmentAtPoint(pt)) {
+    return m_fragmentEventEmitters[*fragmentIndex];
   }
 
   return m_eventEmitter;
@@ -199,26 +254,7 @@ bool ParagraphComponentView::IsTextSelectableAtPoint(facebook::react::Point pt)
   }
 
   // Finds which text fragment was hit
-  if (m_attributedStringBox.getValue().getFragments().size() && m_textLayout) {
-    BOOL isTrailingHit = false;
-    BOOL isInside = false;
-    DWRITE_HIT_TEST_METRICS metrics;
-    winrt::check_hresult(m_textLayout->HitTestPoint(pt.x, pt.y, &isTrailingHit, &isInside, &metrics));
-
-    if (isInside) {
-      uint32_t textPosition = metrics.textPosition;
-
-      // Finds which fragment contains this text position
-      for (auto fragment : m_attributedStringBox.getValue().getFragments()) {
-        if (textPosition < fragment.string.length()) {
-          return true;
-        }
-        textPosition -= static_cast<uint32_t>(fragment.string.length());
-      }
-    }
-  }
-
-  return false;
+  return fragmentAtPoint(pt).has_value();
 }
 
 std::optional<int32_t> ParagraphComponentView::GetTextPositionAtPoint(facebook::react::Point pt) noexcept {
@@ -247,7 +283,7 @@ std::optional<int32_t> ParagraphComponentView::GetClampedTextPosition(facebook::
     return std::nullopt;
   }
 
-  const std::wstring utf16Text{facebook::react::WindowsTextLayoutManager::GetTransformedText(m_attributedStringBox)};
+  const std::wstring &utf16Text = m_transformedText->text;
   if (utf16Text.empty()) {
     return std::nullopt;
   }
@@ -294,57 +330,92 @@ std::optional<int32_t> ParagraphComponentView::GetClampedTextPosition(facebook::
 }
 
 void ParagraphComponentView::OnRenderingDeviceLost() noexcept {
-  DrawText();
+  Super::OnRenderingDeviceLost();
+  if (m_rasterizationDeferred) {
+    // The stretched content is gone with the device
+    rasterizeAtCurrentScale();
+  } else {
+    DrawText();
+  }
+}
+
+void ParagraphComponentView::CreateTextLayout(
+    facebook::react::AttributedStringBox const &attributedStringBox,
+    facebook::react::ParagraphAttributes const &paragraphAttributes,
+    facebook::react::LayoutMetrics const &layoutMetrics,
+    facebook::react::ParagraphProps const &props,
+    winrt::com_ptr<::IDWriteTextLayout> &textLayout) noexcept {
+  facebook::react::LayoutConstraints constraints;
+  constraints.maximumSize.width =
+      layoutMetrics.frame.size.width - layoutMetrics.contentInsets.left - layoutMetrics.contentInsets.right;
+  constraints.maximumSize.height =
+      layoutMetrics.frame.size.height - layoutMetrics.contentInsets.top - layoutMetrics.contentInsets.bottom;
+
+  facebook::react::WindowsTextLayoutManager::GetTextLayout(
+      attributedStringBox, paragraphAttributes, constraints, textLayout);
+
+  // Apply text alignment after creating the text layout
+  if (textLayout) {
+    DWRITE_TEXT_ALIGNMENT alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
+    if (props.textAttributes.alignment) {
+      switch (*props.textAttributes.alignment) {
+        case facebook::react::TextAlignment::Center:
+          alignment = DWRITE_TEXT_ALIGNMENT_CENTER;
+          break;
+        case facebook::react::TextAlignment::Justified:
+          alignment = DWRITE_TEXT_ALIGNMENT_JUSTIFIED;
+          break;
+        case facebook::react::TextAlignment::Left:
+          alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
+          break;
+        case facebook::react::TextAlignment::Right:
+          alignment = DWRITE_TEXT_ALIGNMENT_TRAILING;
+          break;
+        case facebook::react::TextAlignment::Natural:
+          alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
+          break;
+        default:
+          alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
+          break;
+      }
+    }
+    winrt::check_hresult(textLayout->SetTextAlignment(alignment));
+  }
+}
+
+void ParagraphComponentView::SetPreparedTextLayout(winrt::com_ptr<::IDWriteTextLayout> &&textLayout) noexcept {
+  m_preparedTextLayout = std::move(textLayout);
 }
 
 void ParagraphComponentView::updateVisualBrush() noexcept {
   bool requireNewBrush{false};
 
+  if (m_rasterizationDeferred) {
+    if (m_textLayout && m_drawingSurface && !m_requireRedraw) {
+      // Nothing changed but the scale factor, the stretched content stays until the root redraws it
+      m_preparedTextLayout = nullptr;
+      return;
+    }
+    endDeferredRasterization();
+  }
+
   // TODO
   // updateTextAlignment(paragraphProps.textAttributes.alignment);
   if (!m_textLayout) {
-    facebook::react::LayoutConstraints constraints;
-    constraints.maximumSize.width =
-        m_layoutMetrics.frame.size.width - m_layoutMetrics.contentInsets.left - m_layoutMetrics.contentInsets.right;
-    constraints.maximumSize.height =
-        m_layoutMetrics.frame.size.height - m_layoutMetrics.contentInsets.top - m_layoutMetrics.contentInsets.bottom;
-
-    facebook::react::WindowsTextLayoutManager::GetTextLayout(
-        m_attributedStringBox, m_paragraphAttributes, constraints, m_textLayout);
-
-    // Apply text alignment after creating the text layout
-    if (m_textLayout) {
-      const auto &props = paragraphProps();
-      DWRITE_TEXT_ALIGNMENT alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
-      if (props.textAttributes.alignment) {
-        switch (*props.textAttributes.alignment) {
-          case facebook::react::TextAlignment::Center:
-            alignment = DWRITE_TEXT_ALIGNMENT_CENTER;
-            break;
-          case facebook::react::TextAlignment::Justified:
-            alignment = DWRITE_TEXT_ALIGNMENT_JUSTIFIED;
-            break;
-          case facebook::react::TextAlignment::Left:
-            alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
-            break;
-          case facebook::react::TextAlignment::Right:
-            alignment = DWRITE_TEXT_ALIGNMENT_TRAILING;
-            break;
-          case facebook::react::TextAlignment::Natural:
-            alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
-            break;
-          default:
-            alignment = DWRITE_TEXT_ALIGNMENT_LEADING;
-            break;
-        }
-      }
-      winrt::check_hresult(m_textLayout->SetTextAlignment(alignment));
+    if (m_preparedTextLayout) {
+      m_textLayout = std::move(m_preparedTextLayout);
+    } else {
+      CreateTextLayout(m_attributedStringBox, m_paragraphAttributes, m_layoutMetrics, paragraphProps(), m_textLayout);
     }
+    m_lastFragmentHit.reset();
 
     requireNewBrush = true;
   }
+  // A prepared layout is only valid for the update it was prepared for
+  m_preparedTextLayout = nullptr;
 
   if (requireNewBrush || !m_drawingSurface) {
+    m_isVirtualSurface = false;
     if (!m_textLayout) { // Empty Text element
       m_drawingSurface = nullptr;
     } else {
@@ -360,11 +431,29 @@ void ParagraphComponentView::updateVisualBrush() noexcept {
       winrt::Windows::Foundation::Size surfaceSize = {
           m_layoutMetrics.frame.size.width * m_layoutMetrics.pointScaleFactor,
           m_layoutMetrics.frame.size.height * m_layoutMetrics.pointScaleFactor};
-      m_drawingSurface = m_compContext.CreateDrawingSurfaceBrush(
-          surfaceSize,
-          winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
-          winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+      m_drawingSurface = nullptr;
+      ::Microsoft::ReactNative::Composition::DrawingSurfaceOwnerScope ownerScope(
+          ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Text);
+      if (surfaceSize.Width > VirtualSurfaceMinExtent || surfaceSize.Height > VirtualSurfaceMinExtent) {
+        winrt::com_ptr<::Microsoft::ReactNative::Composition::ICompositionVirtualDrawingSurfaceFactory> factory;
+        if (m_compContext.try_as(factory)) {
+          m_drawingSurface = factory->CreateVirtualDrawingSurfaceBrush(surfaceSize);
+          m_isVirtualSurface = true;
+          m_virtualTileColumns = static_cast<uint32_t>(std::ceil(surfaceSize.Width / VirtualSurfaceTileSize));
+          m_drawnTiles.assign(
+              m_virtualTileColumns * static_cast<size_t>(std::ceil(surfaceSize.Height / VirtualSurfaceTileSize)),
+              false);
+          m_keptTilesRect = {};
+        }
+      }
+
+      if (!m_drawingSurface) {
+        // The visual is the size of the surface, so small paragraphs can share an atlas surface
+        m_drawingSurface =
+            ::Microsoft::ReactNative::Composition::CreateAtlasOrDrawingSurfaceBrush(m_compContext, surfaceSize);
+      }
     }
+    updateViewportSubscription();
 
     DrawText();
 
@@ -407,6 +496,9 @@ void ParagraphComponentView::updateVisualBrush() noexcept {
 
   if (m_requireRedraw) {
     DrawText();
+  } else {
+    // The paragraph may have moved relative to the viewport
+    DrawVisibleTiles();
   }
 }
 
@@ -478,7 +570,6 @@ void ParagraphComponentView::DrawSelectionHighlight(
     return;
   }
 
-  winrt::com_ptr<ID2D1SolidColorBrush> selectionBrush;
   D2D1_COLOR_F selectionColor;
   const auto &props = paragraphProps();
   if (props.selectionColor) {
@@ -486,11 +577,7 @@ void ParagraphComponentView::DrawSelectionHighlight(
   } else {
     selectionColor = theme()->D2DPlatformColor("Highlight@40");
   }
-  hr = renderTarget.CreateSolidColorBrush(selectionColor, selectionBrush.put());
-
-  if (FAILED(hr)) {
-    return;
-  }
+  auto selectionBrush = GetSolidColorBrush(renderTarget, selectionColor);
 
   // Draw rectangles for each hit test metric
   for (UINT32 i = 0; i < actualCount; i++) {
@@ -501,7 +588,8 @@ void ParagraphComponentView::DrawSelectionHighlight(
 }
 
 void ParagraphComponentView::DrawText() noexcept {
-  if (!m_drawingSurface || theme()->IsEmpty())
+  // A deferred rasterization draws the whole text again once it ends
+  if (!m_drawingSurface || theme()->IsEmpty() || m_rasterizationDeferred)
     return;
 
   if (m_layoutMetrics.frame.size.width == 0 || m_layoutMetrics.frame.size.height == 0) {
@@ -509,40 +597,302 @@ void ParagraphComponentView::DrawText() noexcept {
     return;
   }
 
+  if (m_isVirtualSurface) {
+    std::fill(m_drawnTiles.begin(), m_drawnTiles.end(), false);
+    m_keptTilesRect = {};
+    m_drawnSelection = NormalizedSelection();
+    DrawVisibleTiles();
+
+    const auto &props = paragraphProps();
+    if (!isnan(props.opacity)) {
+      Visual().Opacity(props.opacity);
+    }
+    m_requireRedraw = false;
+    return;
+  }
+
   POINT offset;
   {
     ::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface autoDraw(
         m_drawingSurface, m_layoutMetrics.pointScaleFactor, &offset);
     if (auto d2dDeviceContext = autoDraw.GetRenderTarget()) {
-      d2dDeviceContext->Clear(
-          viewProps()->backgroundColor ? theme()->D2DColor(*viewProps()->backgroundColor)
-                                       : D2D1::ColorF(D2D1::ColorF::Black, 0.0f));
+      DrawTextContent(*d2dDeviceContext, static_cast<float>(offset.x), static_cast<float>(offset.y));
+
       const auto &props = paragraphProps();
+      if (!isnan(props.opacity)) {
+        Visual().Opacity(props.opacity);
+      }
+    }
+    m_requireRedraw = false;
+  }
+}
 
-      // Calculate text offset
-      const float textOffsetX = static_cast<float>(offset.x) + m_layoutMetrics.contentInsets.left;
-      const float textOffsetY = static_cast<float>(offset.y) + m_layoutMetrics.contentInsets.top;
+void ParagraphComponentView::DrawSelectionChange() noexcept {
+  if (m_requireRedraw || m_rasterizationDeferred || !m_drawingSurface || !m_textLayout || theme()->IsEmpty() ||
+      m_layoutMetrics.frame.size.width == 0 || m_layoutMetrics.frame.size.height == 0) {
+    DrawText();
+    return;
+  }
 
-      // Draw selection highlight behind text
-      DrawSelectionHighlight(*d2dDeviceContext, textOffsetX, textOffsetY, m_layoutMetrics.pointScaleFactor);
+  auto surfaceUpdate =
+      m_drawingSurface.try_as<::Microsoft::ReactNative::Composition::ICompositionDrawingSurfaceUpdate>();
+  if (!surfaceUpdate) {
+    DrawText();
+    return;
+  }
 
-      RenderText(
-          *d2dDeviceContext,
-          *m_textLayout,
-          m_attributedStringBox.getValue(),
-          props.textAttributes,
-          {textOffsetX, textOffsetY},
-          m_layoutMetrics.pointScaleFactor,
-          *theme());
+  const auto selection = NormalizedSelection();
+  if (selection == m_drawnSelection) {
+    return;
+  }
 
-      if (!isnan(props.opacity)) {
-        Visual().Opacity(props.opacity);
+  // The characters whose highlight changed, when both selections are non empty they share an anchor while dragging,
+  // so this is rarely more than a line or two
+  std::pair<int32_t, int32_t> changedRanges[2];
+  if (selection.first == selection.second) {
+    changedRanges[0] = m_drawnSelection;
+  } else if (m_drawnSelection.first == m_drawnSelection.second) {
+    changedRanges[0] = selection;
+  } else {
+    changedRanges[0] = {
+        std::min(selection.first, m_drawnSelection.first), std::max(selection.first, m_drawnSelection.first)};
+    changedRanges[1] = {
+        std::min(selection.second, m_drawnSelection.second), std::max(selection.second, m_drawnSelection.second)};
+  }
+
+  float top = std::numeric_limits<float>::max();
+  float bottom = std::numeric_limits<float>::lowest();
+  for (const auto &range : changedRanges) {
+    if (range.second <= range.first) {
+      continue;
+    }
+
+    UINT32 actualCount = 0;
+    m_textLayout->HitTestTextRange(
+        static_cast<UINT32>(range.first),
+        static_cast<UINT32>(range.second - range.first),
+        0,
+        0,
+        nullptr,
+        0,
+        &actualCount);
+    if (actualCount == 0) {
+      continue;
+    }
+
+    std::vector<DWRITE_HIT_TEST_METRICS> hitTestMetrics(actualCount);
+    if (FAILED(m_textLayout->HitTestTextRange(
+            static_cast<UINT32>(range.first),
+            static_cast<UINT32>(range.second - range.first),
+            0,
+            0,
+            hitTestMetrics.data(),
+            actualCount,
+            &actualCount))) {
+      DrawText();
+      return;
+    }
+
+    for (UINT32 i = 0; i < actualCount; i++) {
+      top = std::min(top, hitTestMetrics[i].top);
+      bottom = std::max(bottom, hitTestMetrics[i].top + hitTestMetrics[i].height);
+    }
+  }
+
+  m_drawnSelection = selection;
+  if (bottom <= top) {
+    return;
+  }
+
+  // Repaint the full width of the changed lines, with a pixel of margin for antialiasing.  The text is drawn
+  // contentInsets pixels from the origin of the surface, see RenderText.
+  const auto scale = m_layoutMetrics.pointScaleFactor;
+  const auto surfaceHeight = static_cast<LONG>(std::ceil(m_layoutMetrics.frame.size.height * scale));
+  RECT updateRect{
+      0,
+      std::max(0L, static_cast<LONG>(std::floor(m_layoutMetrics.contentInsets.top + top * scale)) - 1),
+      static_cast<LONG>(std::ceil(m_layoutMetrics.frame.size.width * scale)),
+      std::min(surfaceHeight, static_cast<LONG>(std::ceil(m_layoutMetrics.contentInsets.top + bottom * scale)) + 1)};
+  if (m_isVirtualSurface) {
+    // Tiles away from the viewport are not drawn, they are drawn with the current selection once they are visible
+    IntersectRect(&updateRect, &updateRect, &m_keptTilesRect);
+  }
+  if (updateRect.bottom <= updateRect.top || updateRect.right <= updateRect.left) {
+    return;
+  }
+
+  winrt::com_ptr<ID2D1DeviceContext> d2dDeviceContext;
+  const auto dpi = scale * 96.0f;
+  if (FAILED(surfaceUpdate->BeginDrawUpdate(updateRect, d2dDeviceContext.put(), dpi, dpi))) {
+    DrawText();
+    return;
+  }
+  DrawTextContent(*d2dDeviceContext, 0, 0);
+  m_drawingSurface.as<::Microsoft::ReactNative::Composition::Experimental::ICompositionDrawingSurfaceInterop>()
+      ->EndDraw();
+}
+
+RECT ParagraphComponentView::VisibleSurfaceRect() noexcept {
+  const auto clientRect = getClientRect();
+  RECT visibleRect = clientRect;
+  for (auto view = Parent(); view; view = view.Parent()) {
+    if (auto scrollView = view.try_as<ScrollViewComponentView>()) {
+      const auto viewportRect = scrollView->getClientRect();
+      IntersectRect(&visibleRect, &visibleRect, &viewportRect);
+    }
+  }
+  if (auto root = rootComponentView()) {
+    const auto rootRect = root->getClientRect();
+    IntersectRect(&visibleRect, &visibleRect, &rootRect);
+  }
+
+  OffsetRect(&visibleRect, -clientRect.left, -clientRect.top);
+  return visibleRect;
+}
+
+void ParagraphComponentView::DrawVisibleTiles() noexcept {
+  if (!m_isVirtualSurface || !m_textLayout || theme()->IsEmpty() || m_rasterizationDeferred) {
+    return;
+  }
+
+  const auto scale = m_layoutMetrics.pointScaleFactor;
+  const auto surfaceWidth = static_cast<LONG>(std::ceil(m_layoutMetrics.frame.size.width * scale));
+  const auto surfaceHeight = static_cast<LONG>(std::ceil(m_layoutMetrics.frame.size.height * scale));
+  const auto rowCount = static_cast<LONG>(m_drawnTiles.size() / std::max(m_virtualTileColumns, 1u));
+  const auto columnCount = static_cast<LONG>(m_virtualTileColumns);
+
+  // Tiles next to the viewport are drawn as well, so that scrolling does not uncover tiles before they are drawn
+  RECT keptTiles{};
+  const auto visibleRect = VisibleSurfaceRect();
+  if (visibleRect.right > visibleRect.left && visibleRect.bottom > visibleRect.top) {
+    keptTiles = {
+        std::max(0L, visibleRect.left / VirtualSurfaceTileSize - 1),
+        std::max(0L, visibleRect.top / VirtualSurfaceTileSize - 1),
+        std::min(columnCount, (visibleRect.right - 1) / VirtualSurfaceTileSize + 2),
+        std::min(rowCount, (visibleRect.bottom - 1) / VirtualSurfaceTileSize + 2)};
+  }
+  const RECT keptTilesRect{
+      keptTiles.left * VirtualSurfaceTileSize,
+      keptTiles.top * VirtualSurfaceTileSize,
+      std::min(surfaceWidth, keptTiles.right * VirtualSurfaceTileSize),
+      std::min(surfaceHeight, keptTiles.bottom * VirtualSurfaceTileSize)};
+  if (EqualRect(&keptTilesRect, &m_keptTilesRect)) {
+    return;
+  }
+  m_keptTilesRect = keptTilesRect;
+
+  RECT dirtyRect{};
+  for (LONG row = 0; row < rowCount; row++) {
+    for (LONG column = 0; column < columnCount; column++) {
+      std::vector<bool>::reference drawnTile = m_drawnTiles[row * columnCount + column];
+      if (row < keptTiles.top || row >= keptTiles.bottom || column < keptTiles.left || column >= keptTiles.right) {
+        drawnTile = false;
+      } else if (!drawnTile) {
+        const RECT tileRect{
+            column * VirtualSurfaceTileSize,
+            row * VirtualSurfaceTileSize,
+            std::min(surfaceWidth, (column + 1) * VirtualSurfaceTileSize),
+            std::min(surfaceHeight, (row + 1) * VirtualSurfaceTileSize)};
+        UnionRect(&dirtyRect, &dirtyRect, &tileRect);
+        drawnTile = true;
       }
     }
-    m_requireRedraw = false;
+  }
+
+  // Discard the tiles that moved away from the viewport before drawing the new ones, to limit the peak memory use
+  winrt::com_ptr<::Microsoft::ReactNative::Composition::ICompositionVirtualDrawingSurface> virtualSurface;
+  m_drawingSurface.as(virtualSurface);
+  virtualSurface->Trim(&m_keptTilesRect, IsRectEmpty(&m_keptTilesRect) ? 0 : 1);
+
+  if (IsRectEmpty(&dirtyRect)) {
+    return;
+  }
+
+  winrt::com_ptr<::Microsoft::ReactNative::Composition::ICompositionDrawingSurfaceUpdate> surfaceUpdate;
+  m_drawingSurface.as(surfaceUpdate);
+  winrt::com_ptr<ID2D1DeviceContext> d2dDeviceContext;
+  const auto dpi = scale * 96.0f;
+  if (SUCCEEDED(surfaceUpdate->BeginDrawUpdate(dirtyRect, d2dDeviceContext.put(), dpi, dpi))) {
+    DrawTextContent(*d2dDeviceContext, 0, 0);
+    m_drawingSurface.as<::Microsoft::ReactNative::Composition::Experimental::ICompositionDrawingSurfaceInterop>()
+        ->EndDraw();
+  }
+}
+
+void ParagraphComponentView::updateViewportSubscription() noexcept {
+  m_viewportScrollRevokers.clear();
+  if (!m_isVirtualSurface || !isMounted()) {
+    return;
+  }
+
+  for (auto view = Parent(); view; view = view.Parent()) {
+    if (auto scrollView = view.try_as<ScrollViewComponentView>()) {
+      m_viewportScrollRevokers.push_back(scrollView->ScrollPositionChanged(
+          [wkThis = get_weak()](
+              winrt::IInspectable const & /*sender*/,
+              winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const & /*args*/) {
+            if (auto strongThis = wkThis.get()) {
+              strongThis->DrawVisibleTiles();
+            }
+          }));
+    }
   }
 }
 
+void ParagraphComponentView::onMounted() noexcept {
+  Super::onMounted();
+  updateViewportSubscription();
+  DrawVisibleTiles();
+}
+
+void ParagraphComponentView::onUnmounted() noexcept {
+  m_viewportScrollRevokers.clear();
+  Super::onUnmounted();
+}
+
+void ParagraphComponentView::DrawTextContent(ID2D1DeviceContext &deviceContext, float offsetX, float offsetY) noexcept {
+  deviceContext.Clear(
+      viewProps()->backgroundColor ? theme()->D2DColor(*viewProps()->backgroundColor)
+                                   : D2D1::ColorF(D2D1::ColorF::Black, 0.0f));
+
+  // Calculate text offset
+  const float textOffsetX = offsetX + m_layoutMetrics.contentInsets.left;
+  const float textOffsetY = offsetY + m_layoutMetrics.contentInsets.top;
+
+  // Draw selection highlight behind text
+  DrawSelectionHighlight(deviceContext, textOffsetX, textOffsetY, m_layoutMetrics.pointScaleFactor);
+  m_drawnSelection = NormalizedSelection();
+
+  RenderText(
+      deviceContext,
+      *m_textLayout,
+      m_attributedStringBox.getValue(),
+      paragraphProps().textAttributes,
+      {textOffsetX, textOffsetY},
+      m_layoutMetrics.pointScaleFactor,
+      *theme());
+}
+
+std::pair<int32_t, int32_t> ParagraphComponentView::NormalizedSelection() const noexcept {
+  if (!m_selectionStart || !m_selectionEnd || *m_selectionStart == *m_selectionEnd) {
+    return {0, 0};
+  }
+  return {std::min(*m_selectionStart, *m_selectionEnd), std::max(*m_selectionStart, *m_selectionEnd)};
+}
+
+void ParagraphComponentView::prepareForRecycle() noexcept {
+  // The text will be redrawn once the new state is applied, so there is no need to redraw to clear the selection here
+  m_selectionStart = std::nullopt;
+  m_selectionEnd = std::nullopt;
+  m_isSelecting = false;
+  m_lastClickPosition = std::nullopt;
+  m_requireRedraw = true;
+  if (m_rasterizationDeferred) {
+    endDeferredRasterization();
+  }
+  Super::prepareForRecycle();
+}
+
 void ParagraphComponentView::ClearSelection() noexcept {
   const bool hadSelection = (m_selectionStart || m_selectionEnd || m_isSelecting);
   m_selectionStart = std::nullopt;
@@ -550,7 +900,7 @@ void ParagraphComponentView::ClearSelection() noexcept {
   m_isSelecting = false;
   if (hadSelection) {
     // Clears selection highlight
-    DrawText();
+    DrawSelectionChange();
   }
 }
 
@@ -642,7 +992,7 @@ void ParagraphComponentView::OnPointerMoved(
 
   if (charPosition && charPosition != m_selectionEnd) {
     m_selectionEnd = charPosition;
-    DrawText();
+    DrawSelectionChange();
     args.Handled(true);
   }
 }
@@ -715,7 +1065,7 @@ std::string ParagraphComponentView::GetSelectedText() const noexcept {
     return "";
   }
 
-  const std::wstring utf16Text{facebook::react::WindowsTextLayoutManager::GetTransformedText(m_attributedStringBox)};
+  const std::wstring &utf16Text = m_transformedText->text;
 
   if (selStart >= static_cast<int32_t>(utf16Text.length())) {
     return "";
@@ -742,7 +1092,7 @@ void ParagraphComponentView::CopySelectionToClipboard() noexcept {
 }
 
 void ParagraphComponentView::SelectWordAtPosition(int32_t charPosition) noexcept {
-  const std::wstring utf16Text{facebook::react::WindowsTextLayoutManager::GetTransformedText(m_attributedStringBox)};
+  const std::wstring &utf16Text = m_transformedText->text;
   const int32_t textLength = static_cast<int32_t>(utf16Text.length());
 
   if (utf16Text.empty() || charPosition < 0 || charPosition >= textLength) {
@@ -752,8 +1102,11 @@ void ParagraphComponentView::SelectWordAtPosition(int32_t charPosition) noexcept
   int32_t wordStart = charPosition;
   int32_t wordEnd = charPosition;
 
-  ::Microsoft::ReactNative::IcuUtils::WordBreakIterator wordBreaker(utf16Text.c_str(), textLength);
-  const bool icuSuccess = wordBreaker.IsValid() && wordBreaker.GetWordBoundaries(charPosition, wordStart, wordEnd);
+  if (!m_wordBoundaries) {
+    m_wordBoundaries.emplace(utf16Text.c_str(), textLength);
+  }
+  const bool icuSuccess =
+      m_wordBoundaries->IsValid() && m_wordBoundaries->GetWordBoundaries(charPosition, wordStart, wordEnd);
 
   if (!icuSuccess) {
     wordStart = charPosition;
@@ -781,7 +1134,7 @@ void ParagraphComponentView::SelectWordAtPosition(int32_t charPosition) noexcept
 
   if (wordEnd > wordStart) {
     SetSelection(wordStart, wordEnd);
-    DrawText();
+    DrawSelectionChange();
   }
 }
 
@@ -797,7 +1150,7 @@ void ParagraphComponentView::ShowContextMenu() noexcept {
   }
 
   const bool hasSelection = (m_selectionStart && m_selectionEnd && *m_selectionStart != *m_selectionEnd);
-  const std::wstring utf16Text{facebook::react::WindowsTextLayoutManager::GetTransformedText(m_attributedStringBox)};
+  const std::wstring &utf16Text = m_transformedText->text;
   const bool hasText = !utf16Text.empty();
 
   // Add menu items (1 = Copy, 2 = Select All)
@@ -818,7 +1171,7 @@ void ParagraphComponentView::ShowContextMenu() noexcept {
     CopySelectionToClipboard();
   } else if (cmd == 2) {
     SetSelection(0, static_cast<int32_t>(utf16Text.length()));
-    DrawText();
+    DrawSelectionChange();
   }
 
   DestroyMenu(menu);
@@ -841,7 +1194,7 @@ void ParagraphComponentView::OnKeyDown(
 
   // Handle Ctrl+A for select all
   if (isCtrlDown && args.Key() == winrt::Windows::System::VirtualKey::A) {
-    const std::wstring utf16Text{facebook::react::WindowsTextLayoutManager::GetTransformedText(m_attributedStringBox)};
+    const std::wstring &utf16Text = m_transformedText->text;
     if (!utf16Text.empty()) {
       if (auto root = rootComponentView()) {
         root->ClearCurrentTextSelection();
@@ -853,7 +1206,7 @@ void ParagraphComponentView::OnKeyDown(
         root->SetViewWithTextSelection(*get_strong());
       }
 
-      DrawText();
+      DrawSelectionChange();
       args.Handled(true);
       return;
     }
@@ -6,10 +6,12 @@
 
 #include "Composition.ParagraphComponentView.g.h"
 #include <Fabric/ComponentView.h>
+#include <Utils/IcuUtils.h>
 #include <d2d1_1.h>
 #include <dwrite.h>
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/components/text/ParagraphProps.h>
+#include <react/renderer/textlayoutmanager/WindowsTextLayoutManager.h>
 #include <windows.ui.composition.interop.h>
 #include <winrt/Windows.UI.Composition.h>
 #include <chrono>
@@ -40,8 +42,12 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
   void updateState(facebook::react::State::Shared const &state, facebook::react::State::Shared const &oldState) noexcept
       override;
   void FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentViewUpdateMask updateMask) noexcept override;
+  void prepareForRecycle() noexcept override;
+  void onMounted() noexcept override;
+  void onUnmounted() noexcept override;
   void OnRenderingDeviceLost() noexcept override;
   void onThemeChanged() noexcept override;
+  void rasterizeAtCurrentScale() noexcept override;
   facebook::react::SharedViewEventEmitter eventEmitterAtPoint(facebook::react::Point pt) noexcept override;
 
   virtual std::string DefaultControlType() const noexcept override;
@@ -49,6 +55,19 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
   static facebook::react::SharedViewProps defaultProps() noexcept;
   const facebook::react::ParagraphProps &paragraphProps() const noexcept;
 
+  // Builds the text layout used to draw a paragraph.  Does not touch any view state, so it can be called off the UI
+  // thread to prepare a layout ahead of the mount.
+  static void CreateTextLayout(
+      facebook::react::AttributedStringBox const &attributedStringBox,
+      facebook::react::ParagraphAttributes const &paragraphAttributes,
+      facebook::react::LayoutMetrics const &layoutMetrics,
+      facebook::react::ParagraphProps const &props,
+      winrt::com_ptr<::IDWriteTextLayout> &textLayout) noexcept;
+
+  // Provides a layout built by CreateTextLayout for the current updates.  It is used by the next FinalizeUpdates if
+  // the updates invalidated the current layout, and dropped otherwise.
+  void SetPreparedTextLayout(winrt::com_ptr<::IDWriteTextLayout> &&textLayout) noexcept;
+
   facebook::react::Tag hitTest(
       facebook::react::Point pt,
       facebook::react::Point &localPt,
@@ -83,7 +102,17 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
 
  private:
   void updateVisualBrush() noexcept;
+  // Resizes the visual to the surface at the current scale, which is drawn from a new text layout
+  void endDeferredRasterization() noexcept;
   void DrawText() noexcept;
+  // Repaints the lines whose selection highlight changed since the text was last drawn
+  void DrawSelectionChange() noexcept;
+  void DrawTextContent(ID2D1DeviceContext &deviceContext, float offsetX, float offsetY) noexcept;
+  std::pair<int32_t, int32_t> NormalizedSelection() const noexcept;
+  // The part of the surface inside all enclosing scroll viewports, in pixels of the surface
+  RECT VisibleSurfaceRect() noexcept;
+  void DrawVisibleTiles() noexcept;
+  void updateViewportSubscription() noexcept;
   void DrawSelectionHighlight(
       ID2D1RenderTarget &renderTarget,
       float offsetX,
@@ -91,6 +120,8 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
       float pointScaleFactor) noexcept;
   void updateTextAlignment(const std::optional<facebook::react::TextAlignment> &fbAlignment) noexcept;
   bool IsTextSelectableAtPoint(facebook::react::Point pt) noexcept;
+  // Returns the index of the fragment under the point, or std::nullopt if the point is not over the text
+  std::optional<size_t> fragmentAtPoint(facebook::react::Point pt) noexcept;
   std::optional<int32_t> GetTextPositionAtPoint(facebook::react::Point pt) noexcept;
   std::optional<int32_t> GetClampedTextPosition(facebook::react::Point pt) noexcept;
   std::string GetSelectedText() const noexcept;
@@ -108,15 +139,42 @@ struct ParagraphComponentView : ParagraphComponentViewT<ParagraphComponentView,
   void SetSelection(int32_t start, int32_t end) noexcept;
 
   winrt::com_ptr<::IDWriteTextLayout> m_textLayout;
+  winrt::com_ptr<::IDWriteTextLayout> m_preparedTextLayout;
   facebook::react::AttributedStringBox m_attributedStringBox;
+  // The UTF-16 text of m_attributedStringBox, which selection and hit testing index into
+  std::shared_ptr<const facebook::react::WindowsTextLayoutManager::TransformedText> m_transformedText{
+      facebook::react::WindowsTextLayoutManager::GetTransformedText(m_attributedStringBox)};
+  // The word boundaries of m_transformedText, found on the first word selection
+  std::optional<::Microsoft::ReactNative::IcuUtils::WordBoundaries> m_wordBoundaries;
+  // The event emitter of each fragment of m_attributedStringBox
+  std::vector<facebook::react::SharedViewEventEmitter> m_fragmentEventEmitters;
+  // The last point hit tested against m_textLayout, and the fragment under it
+  std::optional<std::pair<facebook::react::Point, std::optional<size_t>>> m_lastFragmentHit;
   facebook::react::ParagraphAttributes m_paragraphAttributes;
 
   bool m_requireRedraw{true};
   winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush m_drawingSurface;
+  // The surface still holds the text at the previous scale factor, stretched to the new size until the
+  // DpiRasterizationQueue of the root redraws it
+  bool m_rasterizationDeferred{false};
+
+  // Paragraphs larger than this, in pixels, use a virtual surface of which only the tiles near the viewport are drawn
+  static constexpr float VirtualSurfaceMinExtent = 2048.0f;
+  static constexpr LONG VirtualSurfaceTileSize = 512;
+  bool m_isVirtualSurface{false};
+  // Whether each tile of the virtual surface is drawn, row by row
+  std::vector<bool> m_drawnTiles;
+  uint32_t m_virtualTileColumns{0};
+  // The tiles that are drawn, all others have been trimmed from the surface
+  RECT m_keptTilesRect{};
+  std::vector<winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual::ScrollPositionChanged_revoker>
+      m_viewportScrollRevokers;
 
   std::optional<int32_t> m_selectionStart;
   std::optional<int32_t> m_selectionEnd;
   bool m_isSelecting{false};
+  // The normalized selection in the drawing surface, an empty range when nothing is selected
+  std::pair<int32_t, int32_t> m_drawnSelection{0, 0};
 
   // Double-click detection
   std::chrono::steady_clock::time_point m_lastClickTime{};
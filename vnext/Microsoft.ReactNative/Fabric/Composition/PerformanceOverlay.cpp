@@ -0,0 +1,226 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "PerformanceOverlay.h"
+
+#include <AutoDraw.h>
+#include <Fabric/Composition/CompositionHelpers.h>
+#include <Fabric/DWriteHelpers.h>
+#include <Fabric/DecodedImageCache.h>
+#include <winrt/Microsoft.ReactNative.h>
+#include <cstdio>
+#include "RootComponentView.h"
+
+namespace Microsoft::ReactNative {
+
+constexpr winrt::Windows::Foundation::TimeSpan PerformanceOverlayFrameInterval = std::chrono::microseconds(16667);
+constexpr std::chrono::milliseconds PerformanceOverlayRefreshInterval{500};
+constexpr float PerformanceOverlayFontSize = 11.0f;
+constexpr float PerformanceOverlayMargin = 6.0f;
+constexpr float PerformanceOverlayMaxWidth = 320.0f;
+// Below this frame rate, the overlay turns red
+constexpr double PerformanceOverlayJankFps = 45.0;
+
+PerformanceOverlay::PerformanceOverlay(
+    const winrt::Microsoft::ReactNative::ReactContext &reactContext,
+    const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext,
+    const IComponentViewRegistry &registry) noexcept
+    : m_context(reactContext), m_compContext(compContext), m_registry(registry) {}
+
+void PerformanceOverlay::Show(facebook::react::SurfaceId surfaceId) noexcept {
+  if (m_timer) {
+    return;
+  }
+
+  m_surfaceId = surfaceId;
+
+  m_timer = winrt::Microsoft::ReactNative::Timer::Create(m_context.Properties().Handle());
+  m_timer.Interval(PerformanceOverlayFrameInterval);
+  m_tickToken = m_timer.Tick([wkThis = weak_from_this()](auto const &, auto const &) {
+    if (auto pThis = wkThis.lock()) {
+      pThis->OnTick();
+    }
+  });
+  m_sampleStart = std::chrono::steady_clock::now();
+  m_uiFrameCount = 0;
+  m_jsFrameCounter->frameCount = 0;
+  m_jsFrameCounter->maxLagUs = 0;
+  m_timer.Start();
+
+  Attach();
+}
+
+void PerformanceOverlay::Hide() noexcept {
+  if (!m_timer) {
+    return;
+  }
+
+  m_timer.Stop();
+  m_timer.Tick(m_tickToken);
+  m_timer = nullptr;
+  Detach();
+}
+
+void PerformanceOverlay::mountingTransactionDidMount(
+    facebook::react::MountingTransaction const & /*transaction*/,
+    facebook::react::SurfaceTelemetry const & /*surfaceTelemetry*/,
+    MountingTransactionMetrics const &metrics) noexcept {
+  m_lastMountDurationMs = std::chrono::duration<double, std::milli>(metrics.mountDuration).count();
+  m_maxMountDurationMs = std::max(m_maxMountDurationMs, m_lastMountDurationMs);
+  if (m_surfaceId == -1) {
+    m_surfaceId = metrics.surfaceId;
+  }
+}
+
+void PerformanceOverlay::OnTick() noexcept {
+  ++m_uiFrameCount;
+  PostJSFrame();
+
+  auto now = std::chrono::steady_clock::now();
+  auto elapsed = now - m_sampleStart;
+  if (elapsed < PerformanceOverlayRefreshInterval) {
+    return;
+  }
+
+  auto elapsedSeconds = std::chrono::duration<double>(elapsed).count();
+  m_uiFps = m_uiFrameCount / elapsedSeconds;
+  m_jsFps = m_jsFrameCounter->frameCount.exchange(0) / elapsedSeconds;
+  m_jsLagMs = m_jsFrameCounter->maxLagUs.exchange(0) / 1000.0;
+  m_uiFrameCount = 0;
+  m_sampleStart = now;
+
+  Attach();
+  Redraw();
+}
+
+void PerformanceOverlay::PostJSFrame() noexcept {
+  // Only one task is in flight at a time, so that a busy JS thread shows as a lower frame rate, rather than as a
+  // backlog of tasks
+  if (m_jsFrameCounter->isPending.exchange(true)) {
+    return;
+  }
+
+  m_context.JSDispatcher().Post(
+      [counter = m_jsFrameCounter, postTime = std::chrono::steady_clock::now()]() noexcept {
+        auto lagUs =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - postTime).count();
+        auto maxLagUs = counter->maxLagUs.load();
+        while (lagUs > maxLagUs && !counter->maxLagUs.compare_exchange_weak(maxLagUs, lagUs)) {
+        }
+        ++counter->frameCount;
+        counter->isPending = false;
+      });
+}
+
+void PerformanceOverlay::Attach() noexcept {
+  if (m_attachedRootVisual || m_surfaceId == -1) {
+    return;
+  }
+
+  auto view = m_registry.findComponentViewWithTag(m_surfaceId);
+  if (!view) {
+    m_surfaceId = -1;
+    return;
+  }
+  auto root = view.try_as<winrt::Microsoft::ReactNative::Composition::implementation::RootComponentView>();
+  if (!root) {
+    return;
+  }
+
+  if (!m_visual) {
+    m_visual = m_compContext.CreateSpriteVisual();
+    m_visual.Comment(L"PerformanceOverlay");
+  }
+  m_scaleFactor = root->layoutMetrics().pointScaleFactor;
+  m_visual.Offset({PerformanceOverlayMargin * m_scaleFactor, PerformanceOverlayMargin * m_scaleFactor, 0.0f});
+  m_attachedRootVisual = root->OuterVisual();
+  m_attachedRootVisual.InsertAt(m_visual, root->overlayIndex());
+  Redraw();
+}
+
+void PerformanceOverlay::Detach() noexcept {
+  if (m_attachedRootVisual) {
+    m_attachedRootVisual.Remove(m_visual);
+    m_attachedRootVisual = nullptr;
+  }
+}
+
+void PerformanceOverlay::Redraw() noexcept {
+  if (!m_attachedRootVisual) {
+    return;
+  }
+
+  wchar_t text[512];
+  swprintf_s(
+      text,
+      L"UI: %.0f fps\nJS: %.0f fps, lag %.0f ms\nMount: %.1f ms (max %.1f ms)\nVisuals: %u\nSurfaces: %.1f MB\n"
+      L"Images: %.1f MB",
+      m_uiFps,
+      m_jsFps,
+      m_jsLagMs,
+      m_lastMountDurationMs,
+      m_maxMountDurationMs,
+      Composition::LiveVisualCount(),
+      Composition::LiveDrawingSurfaceBytes() / (1024.0 * 1024.0),
+      DecodedImageCache::Instance().byteSize() / (1024.0 * 1024.0));
+
+  winrt::com_ptr<IDWriteTextFormat> textFormat;
+  winrt::check_hresult(DWriteFactory()->CreateTextFormat(
+      L"Segoe UI",
+      nullptr,
+      DWRITE_FONT_WEIGHT_SEMI_BOLD,
+      DWRITE_FONT_STYLE_NORMAL,
+      DWRITE_FONT_STRETCH_NORMAL,
+      PerformanceOverlayFontSize,
+      L"",
+      textFormat.put()));
+
+  winrt::com_ptr<IDWriteTextLayout> textLayout;
+  winrt::check_hresult(DWriteFactory()->CreateTextLayout(
+      text,
+      static_cast<UINT32>(wcslen(text)),
+      textFormat.get(),
+      PerformanceOverlayMaxWidth,
+      PerformanceOverlayMaxWidth,
+      textLayout.put()));
+
+  DWRITE_TEXT_METRICS metrics{};
+  winrt::check_hresult(textLayout->GetMetrics(&metrics));
+
+  winrt::Windows::Foundation::Size surfaceSize{
+      std::ceilf((metrics.width + PerformanceOverlayMargin * 2) * m_scaleFactor),
+      std::ceilf((metrics.height + PerformanceOverlayMargin * 2) * m_scaleFactor)};
+  auto drawingSurface = m_compContext.CreateDrawingSurfaceBrush(
+      surfaceSize,
+      winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+      winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+
+  POINT offset;
+  {
+    ::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface autoDraw(drawingSurface, m_scaleFactor, &offset);
+    if (auto d2dDeviceContext = autoDraw.GetRenderTarget()) {
+      d2dDeviceContext->Clear(D2D1::ColorF(D2D1::ColorF::Black, 0.7f));
+
+      bool isJanky = m_uiFps < PerformanceOverlayJankFps || m_jsFps < PerformanceOverlayJankFps;
+      winrt::com_ptr<ID2D1SolidColorBrush> brush;
+      winrt::check_hresult(d2dDeviceContext->CreateSolidColorBrush(
+          isJanky ? D2D1::ColorF(1.0f, 0.4f, 0.4f) : D2D1::ColorF(D2D1::ColorF::White), brush.put()));
+
+      d2dDeviceContext->DrawTextLayout(
+          D2D1::Point2F(
+              offset.x / m_scaleFactor + PerformanceOverlayMargin, offset.y / m_scaleFactor + PerformanceOverlayMargin),
+          textLayout.get(),
+          brush.get());
+    }
+  }
+
+  drawingSurface.HorizontalAlignmentRatio(0.0f);
+  drawingSurface.VerticalAlignmentRatio(0.0f);
+  drawingSurface.Stretch(winrt::Microsoft::ReactNative::Composition::Experimental::CompositionStretch::None);
+  m_visual.Brush(drawingSurface);
+  m_visual.Size({surfaceSize.Width, surfaceSize.Height});
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Fabric/Composition/ComponentViewRegistry.h>
+#include <Fabric/MountingTransactionObserver.h>
+#include <Microsoft.ReactNative.Cxx/ReactContext.h>
+#include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
+#include <atomic>
+#include <chrono>
+
+namespace Microsoft::ReactNative {
+
+// Shows how the app is doing in the top left corner of a surface, so that jank can be seen on the devices it happens
+// on: the frame rates of the UI and JS threads, the lag of the JS thread, the duration of the last mount, and the
+// visuals, drawing surfaces and decoded images that are alive.  Refreshed twice a second.
+//
+// The frame rates count the ticks of a 60Hz timer on the UI thread, and the tasks it posts to the JS thread, so they
+// drop when either thread is too busy to keep up.  The JS lag is the longest time one of those tasks waited to run.
+class PerformanceOverlay final : public IMountingTransactionObserver,
+                                 public std::enable_shared_from_this<PerformanceOverlay> {
+ public:
+  PerformanceOverlay(
+      const winrt::Microsoft::ReactNative::ReactContext &reactContext,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compContext,
+      const IComponentViewRegistry &registry) noexcept;
+
+  // Called on the UI thread.  The overlay is shown on the surface, or on the first surface to mount a transaction when
+  // the surface is -1.
+  void Show(facebook::react::SurfaceId surfaceId) noexcept;
+  void Hide() noexcept;
+
+  void mountingTransactionDidMount(
+      facebook::react::MountingTransaction const &transaction,
+      facebook::react::SurfaceTelemetry const &surfaceTelemetry,
+      MountingTransactionMetrics const &metrics) noexcept override;
+
+ private:
+  // Shared with the tasks posted to the JS thread, which can run after the overlay is gone
+  struct JSFrameCounter {
+    std::atomic<bool> isPending{false};
+    std::atomic<uint32_t> frameCount{0};
+    std::atomic<int64_t> maxLagUs{0};
+  };
+
+  void OnTick() noexcept;
+  void PostJSFrame() noexcept;
+  void Attach() noexcept;
+  void Detach() noexcept;
+  void Redraw() noexcept;
+
+  winrt::Microsoft::ReactNative::ReactContext m_context;
+  winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext m_compContext;
+  const IComponentViewRegistry &m_registry;
+  winrt::Microsoft::ReactNative::ITimer m_timer{nullptr};
+  winrt::event_token m_tickToken;
+  std::shared_ptr<JSFrameCounter> m_jsFrameCounter{std::make_shared<JSFrameCounter>()};
+
+  winrt::Microsoft::ReactNative::Composition::Experimental::ISpriteVisual m_visual{nullptr};
+  winrt::Microsoft::ReactNative::Composition::Experimental::IVisual m_attachedRootVisual{nullptr};
+  facebook::react::SurfaceId m_surfaceId{-1};
+  float m_scaleFactor{1.0f};
+
+  std::chrono::steady_clock::time_point m_sampleStart;
+  uint32_t m_uiFrameCount{0};
+  double m_uiFps{0};
+  double m_jsFps{0};
+  double m_jsLagMs{0};
+  double m_lastMountDurationMs{0};
+  double m_maxMountDurationMs{0};
+};
+
+} // namespace Microsoft::ReactNative
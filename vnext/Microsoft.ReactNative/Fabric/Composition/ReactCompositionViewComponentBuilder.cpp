@@ -243,6 +243,14 @@ void ReactCompositionViewComponentBuilder::XamlSupport(bool isRequired) noexcept
   m_xamlSupport = isRequired;
 }
 
+bool ReactCompositionViewComponentBuilder::IsMeasureContentPure() const noexcept {
+  return m_isMeasureContentPure;
+}
+
+void ReactCompositionViewComponentBuilder::IsMeasureContentPure(bool value) noexcept {
+  m_isMeasureContentPure = value;
+}
+
 const UnmountChildComponentViewDelegate &ReactCompositionViewComponentBuilder::UnmountChildComponentViewHandler()
     const noexcept {
   return m_unmountChildComponentViewHandler;
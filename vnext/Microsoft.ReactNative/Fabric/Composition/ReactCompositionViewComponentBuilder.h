@@ -42,6 +42,8 @@ struct ReactCompositionViewComponentBuilder
   void SetCreateAutomationPeerHandler(CreateAutomationPeerDelegate impl) noexcept;
   bool XamlSupport() const noexcept;
   void XamlSupport(bool isRequired) noexcept;
+  bool IsMeasureContentPure() const noexcept;
+  void IsMeasureContentPure(bool value) noexcept;
 
  public: // Composition::IReactCompositionViewComponentBuilder
   void SetViewComponentViewInitializer(const ViewComponentViewInitializer &initializer) noexcept;
@@ -114,6 +116,7 @@ struct ReactCompositionViewComponentBuilder
       m_visualToMountChildrenIntoHandler;
   UpdateLayoutMetricsDelegate m_updateLayoutMetricsHandler;
   bool m_xamlSupport{false};
+  bool m_isMeasureContentPure{false};
 };
 
 } // namespace winrt::Microsoft::ReactNative::Composition
@@ -8,6 +8,7 @@
 #include <react/renderer/textlayoutmanager/WindowsTextLayoutManager.h>
 
 #include <AutoDraw.h>
+#include <CppRuntimeOptions.h>
 #include <DynamicWriter.h>
 #include <Fabric/FabricUIManagerModule.h>
 #include <IReactInstance.h>
@@ -133,6 +134,7 @@ ReactNativeIsland::ReactNativeIsland(const winrt::Microsoft::UI::Composition::Co
     : m_compositor(compositor),
       m_layoutConstraints({{0, 0}, {0, 0}, winrt::Microsoft::ReactNative::LayoutDirection::Undefined}) {
   InitTextScaleMultiplier();
+  m_throttleSurfaceLayout = ::Microsoft::React::GetRuntimeOptionBool("ReactNativeIsland.ThrottleResizeLayout");
 }
 
 ReactNativeIsland::ReactNativeIsland(
@@ -179,6 +181,10 @@ ReactNativeIsland::~ReactNativeIsland() noexcept {
 #endif
   }
 
+  if (m_surfaceLayoutTimer) {
+    m_surfaceLayoutTimer.Stop();
+  }
+
   if (m_uiDispatcher) {
     assert(m_uiDispatcher.HasThreadAccess());
     UninitRootView();
@@ -231,6 +237,7 @@ void ReactNativeIsland::InternalRootVisual(
     assert(!m_rootVisual);
     m_rootVisual = value;
     UpdateRootVisualSize();
+    ShowPlaceholder();
   }
 }
 
@@ -560,6 +567,8 @@ void ReactNativeIsland::UninitRootView() noexcept {
       uiManager->stopSurface(static_cast<facebook::react::SurfaceId>(RootTag()));
   }
 
+  m_mountedRevoker = nullptr;
+  m_mountCount = 0;
   m_rootTag = -1;
   m_context = nullptr;
   m_reactViewOptions = nullptr;
@@ -607,7 +616,85 @@ void ReactNativeIsland::ShowInstanceLoaded() noexcept {
         initProps);
 
     m_isJSViewAttached = true;
+    EnsureMountedSubscription();
+    if (m_isFrozen) {
+      uiManager->freezeSurface(static_cast<facebook::react::SurfaceId>(m_rootTag));
+    }
+  }
+}
+
+void ReactNativeIsland::EnsureMountedSubscription() noexcept {
+  if (m_mountedRevoker.IsSubscribed()) {
+    return;
+  }
+
+  m_mountedRevoker = m_context.Notifications().Subscribe(
+      winrt::auto_revoke,
+      ::Microsoft::ReactNative::FabricUIManager::NotifyMountedId(),
+      [wkThis = get_weak()](
+          winrt::Windows::Foundation::IInspectable const &,
+          winrt::Microsoft::ReactNative::ReactNotificationArgs<facebook::react::SurfaceId> const &args) noexcept {
+        if (auto pThis = wkThis.get()) {
+          if (args.Data() == pThis->m_rootTag) {
+            pThis->m_mountCount++;
+            if (pThis->m_placeholder) {
+              pThis->FadeOutPlaceholder();
+            }
+          }
+        }
+      });
+}
+
+winrt::Microsoft::UI::Composition::Visual ReactNativeIsland::Placeholder() const noexcept {
+  return m_placeholder;
+}
+
+void ReactNativeIsland::Placeholder(winrt::Microsoft::UI::Composition::Visual const &value) noexcept {
+  if (m_placeholder == value) {
+    return;
+  }
+
+  if (m_placeholder) {
+    if (auto parent = m_placeholder.Parent()) {
+      parent.Children().Remove(m_placeholder);
+    }
   }
+  // The surface already shows its own content
+  m_placeholder = m_mountCount ? nullptr : value;
+  ShowPlaceholder();
+}
+
+void ReactNativeIsland::ShowPlaceholder() noexcept {
+  if (!m_placeholder || m_placeholder.Parent()) {
+    return;
+  }
+
+  // Custom compositors have no Microsoft.UI visual to host the placeholder
+  if (auto rootVisual = RootVisual().try_as<winrt::Microsoft::UI::Composition::ContainerVisual>()) {
+    m_placeholder.RelativeSizeAdjustment({1.0f, 1.0f});
+    rootVisual.Children().InsertAtTop(m_placeholder);
+  }
+}
+
+void ReactNativeIsland::FadeOutPlaceholder() noexcept {
+  auto placeholder = std::exchange(m_placeholder, nullptr);
+  if (!placeholder.Parent()) {
+    return;
+  }
+
+  auto compositor = placeholder.Compositor();
+  auto animation = compositor.CreateScalarKeyFrameAnimation();
+  animation.InsertKeyFrame(1.0f, 0.0f);
+  animation.Duration(std::chrono::milliseconds(200));
+
+  auto batch = compositor.CreateScopedBatch(winrt::Microsoft::UI::Composition::CompositionBatchTypes::Animation);
+  placeholder.StartAnimation(L"Opacity", animation);
+  batch.End();
+  batch.Completed([placeholder](auto const &, auto const &) {
+    if (auto parent = placeholder.Parent()) {
+      parent.Children().Remove(placeholder);
+    }
+  });
 }
 
 facebook::react::AttributedStringBox CreateLoadingAttributedString() noexcept {
@@ -876,15 +963,10 @@ void ReactNativeIsland::Arrange(
   ApplyConstraints(layoutConstraints, fbLayoutConstraints);
 
   if (m_isInitialized && m_rootTag != -1 && !m_isFragment && m_hasRenderedVisual) {
-    if (auto fabricuiManager = ::Microsoft::ReactNative::FabricUIManager::FromProperties(
-            winrt::Microsoft::ReactNative::ReactPropertyBag(m_context.Properties()))) {
-      facebook::react::LayoutContext context;
-      context.fontSizeMultiplier = m_textScaleMultiplier;
-      context.pointScaleFactor = static_cast<facebook::react::Float>(m_scaleFactor);
-      context.viewportOffset = {viewportOffset.X, viewportOffset.Y};
-
-      fabricuiManager->constraintSurfaceLayout(
-          static_cast<facebook::react::SurfaceId>(m_rootTag), fbLayoutConstraints, context);
+    if (m_throttleSurfaceLayout) {
+      ScheduleSurfaceLayout();
+    } else {
+      ConstraintSurfaceLayout();
     }
   } else if (m_loadingVisual) {
     // TODO: Resize to align loading
@@ -893,6 +975,124 @@ void ReactNativeIsland::Arrange(
   }
 }
 
+// Each surface layout is a full Yoga pass and a mount, so while a window is resized they are spaced by a frame, at 60
+// frames per second, and only the latest constraints are laid out
+constexpr std::chrono::duration<double> c_surfaceLayoutInterval{1.0 / 60.0};
+
+void ReactNativeIsland::ScheduleSurfaceLayout() noexcept {
+  if (m_surfaceLayoutScheduled) {
+    return;
+  }
+
+  const auto elapsed = std::chrono::steady_clock::now() - m_lastSurfaceLayoutTime;
+  if (elapsed >= c_surfaceLayoutInterval) {
+    ConstraintSurfaceLayout();
+    return;
+  }
+
+  if (!m_surfaceLayoutTimer) {
+    m_surfaceLayoutTimer = winrt::Microsoft::ReactNative::Timer::Create(m_context.Properties().Handle());
+    m_surfaceLayoutTimer.Tick([wkThis = get_weak()](
+                                  const winrt::Windows::Foundation::IInspectable &,
+                                  const winrt::Windows::Foundation::IInspectable &) {
+      if (auto strongThis = wkThis.get()) {
+        strongThis->ConstraintSurfaceLayout();
+      }
+    });
+  }
+  m_surfaceLayoutScheduled = true;
+  m_surfaceLayoutTimer.Interval(
+      std::chrono::duration_cast<winrt::Windows::Foundation::TimeSpan>(c_surfaceLayoutInterval - elapsed));
+  m_surfaceLayoutTimer.Start();
+}
+
+void ReactNativeIsland::ConstraintSurfaceLayout() noexcept {
+  if (m_surfaceLayoutScheduled) {
+    m_surfaceLayoutScheduled = false;
+    m_surfaceLayoutTimer.Stop();
+  }
+  m_lastSurfaceLayoutTime = std::chrono::steady_clock::now();
+
+  if (!m_isInitialized || m_rootTag == -1 || m_isFragment || !m_hasRenderedVisual) {
+    return;
+  }
+
+  if (auto fabricuiManager = ::Microsoft::ReactNative::FabricUIManager::FromProperties(
+          winrt::Microsoft::ReactNative::ReactPropertyBag(m_context.Properties()))) {
+    facebook::react::LayoutConstraints fbLayoutConstraints;
+    ApplyConstraints(m_layoutConstraints, fbLayoutConstraints);
+
+    facebook::react::LayoutContext context;
+    context.fontSizeMultiplier = m_textScaleMultiplier;
+    context.pointScaleFactor = static_cast<facebook::react::Float>(m_scaleFactor);
+    context.viewportOffset = {m_viewportOffset.X, m_viewportOffset.Y};
+
+    // When throttled, the layouts of the islands resized together are run in parallel
+    if (m_throttleSurfaceLayout) {
+      fabricuiManager->scheduleSurfaceLayout(
+          static_cast<facebook::react::SurfaceId>(m_rootTag), fbLayoutConstraints, context);
+    } else {
+      fabricuiManager->constraintSurfaceLayout(
+          static_cast<facebook::react::SurfaceId>(m_rootTag), fbLayoutConstraints, context);
+    }
+  }
+}
+
+// Resumes the coroutine on the dispatcher
+static auto ResumeOnDispatcher(IReactDispatcher const &dispatcher) noexcept {
+  struct awaitable {
+    IReactDispatcher dispatcher;
+
+    bool await_ready() const noexcept {
+      return dispatcher.HasThreadAccess();
+    }
+
+    void await_suspend(winrt::impl::coroutine_handle<> handle) const {
+      dispatcher.Post([handle]() noexcept { handle(); });
+    }
+
+    void await_resume() const noexcept {}
+  };
+  return awaitable{dispatcher};
+}
+
+winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Graphics::Imaging::SoftwareBitmap>
+ReactNativeIsland::RenderToBitmapAsync(winrt::Windows::Foundation::TimeSpan settleTime) {
+  auto strongThis = get_strong();
+  if (!m_isInitialized || !m_rootVisual) {
+    co_return nullptr;
+  }
+  assert(m_uiDispatcher.HasThreadAccess());
+
+  EnsureMountedSubscription();
+
+  // Waits for a whole settle time without any transaction mounted, like from images loading or animations starting
+  uint64_t mountCount;
+  do {
+    mountCount = m_mountCount;
+    co_await winrt::resume_after(settleTime);
+    co_await ResumeOnDispatcher(m_uiDispatcher);
+  } while (mountCount != m_mountCount);
+
+  winrt::Windows::Graphics::SizeInt32 size{
+      static_cast<int32_t>(std::ceil(m_size.Width * m_scaleFactor)),
+      static_cast<int32_t>(std::ceil(m_size.Height * m_scaleFactor))};
+  // The surface may have been stopped while waiting
+  if (!m_isInitialized || !m_hasRenderedVisual || size.Width <= 0 || size.Height <= 0) {
+    co_return nullptr;
+  }
+
+  auto compContext =
+      winrt::Microsoft::ReactNative::Composition::implementation::CompositionUIService::GetCompositionContext(
+          m_context.Properties().Handle());
+  auto visualCapture =
+      compContext ? compContext.try_as<::Microsoft::ReactNative::Composition::ICompositionVisualCapture>() : nullptr;
+  if (!visualCapture) {
+    co_return nullptr;
+  }
+  co_return co_await visualCapture->CaptureVisualAsync(m_rootVisual, size);
+}
+
 winrt::Microsoft::UI::Content::ContentIsland ReactNativeIsland::Island() {
   if (!m_compositor) {
     return nullptr;
@@ -1046,6 +1246,32 @@ void ReactNativeIsland::SetProperties(winrt::Microsoft::ReactNative::JSValueArgW
   m_props = initProps;
 }
 
+bool ReactNativeIsland::IsFrozen() const noexcept {
+  return m_isFrozen;
+}
+
+void ReactNativeIsland::IsFrozen(bool value) noexcept {
+  if (m_isFrozen == value) {
+    return;
+  }
+  m_isFrozen = value;
+
+  if (m_rootVisual) {
+    m_rootVisual.IsVisible(!value);
+  }
+
+  if (m_isJSViewAttached && !m_isFragment && m_rootTag != -1) {
+    if (auto fabricuiManager = ::Microsoft::ReactNative::FabricUIManager::FromProperties(
+            winrt::Microsoft::ReactNative::ReactPropertyBag(m_context.Properties()))) {
+      if (value) {
+        fabricuiManager->freezeSurface(static_cast<facebook::react::SurfaceId>(m_rootTag));
+      } else {
+        fabricuiManager->unfreezeSurface(static_cast<facebook::react::SurfaceId>(m_rootTag));
+      }
+    }
+  }
+}
+
 winrt::com_ptr<winrt::Microsoft::ReactNative::Composition::implementation::RootComponentView>
 ReactNativeIsland::GetComponentView() noexcept {
   if (auto portal = m_portal.get()) {
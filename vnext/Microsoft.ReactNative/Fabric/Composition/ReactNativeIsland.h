@@ -12,7 +12,9 @@
 #include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
 #include <winrt/Microsoft.ReactNative.h>
 #include <winrt/Microsoft.UI.Content.h>
+#include <winrt/Windows.Graphics.Imaging.h>
 #include <winrt/Windows.UI.ViewManagement.h>
+#include <chrono>
 #include "CompositionEventHandler.h"
 #include "DebuggerUIIsland.h"
 #include "PortalComponentView.h"
@@ -61,6 +63,9 @@ struct ReactNativeIsland
       const winrt::Microsoft::ReactNative::Composition::PortalComponentView &portal) noexcept;
   winrt::Microsoft::UI::Content::ContentIsland Island();
 
+  winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Graphics::Imaging::SoftwareBitmap> RenderToBitmapAsync(
+      winrt::Windows::Foundation::TimeSpan settleTime);
+
   // property ReactViewHost
   ReactNative::IReactViewHost ReactViewHost() noexcept;
   void ReactViewHost(ReactNative::IReactViewHost const &value);
@@ -84,6 +89,12 @@ struct ReactNativeIsland
 
   void SetProperties(winrt::Microsoft::ReactNative::JSValueArgWriter props) noexcept;
 
+  bool IsFrozen() const noexcept;
+  void IsFrozen(bool value) noexcept;
+
+  winrt::Microsoft::UI::Composition::Visual Placeholder() const noexcept;
+  void Placeholder(winrt::Microsoft::UI::Composition::Visual const &value) noexcept;
+
   float FontSizeMultiplier() const noexcept;
 
   winrt::event_token SizeChanged(
@@ -158,6 +169,7 @@ struct ReactNativeIsland
   bool m_isFragment{false};
   bool m_isInitialized{false};
   bool m_isJSViewAttached{false};
+  bool m_isFrozen{false};
   bool m_hasRenderedVisual{false};
   bool m_showingLoadingUI{false};
   bool m_mounted{true};
@@ -191,6 +203,17 @@ struct ReactNativeIsland
   winrt::Microsoft::ReactNative::Composition::Theme::ThemeChanged_revoker m_themeChangedRevoker;
   winrt::Microsoft::ReactNative::LayoutConstraints m_layoutConstraints;
   winrt::Windows::Foundation::Point m_viewportOffset{0, 0};
+  // With the ReactNativeIsland.ThrottleResizeLayout runtime option, the surface is laid out at most once per frame
+  // while Arrange is called with new constraints, like during a window resize.
+  bool m_throttleSurfaceLayout{false};
+  bool m_surfaceLayoutScheduled{false};
+  std::chrono::steady_clock::time_point m_lastSurfaceLayoutTime;
+  winrt::Microsoft::ReactNative::ITimer m_surfaceLayoutTimer{nullptr};
+  // Shown over the surface until its first transaction is mounted
+  winrt::Microsoft::UI::Composition::Visual m_placeholder{nullptr};
+  // Counts the transactions mounted on the surface since it was started
+  uint64_t m_mountCount{0};
+  winrt::Microsoft::ReactNative::ReactNotificationSubscriptionRevoker m_mountedRevoker;
   winrt::event<winrt::Windows::Foundation::EventHandler<winrt::Microsoft::ReactNative::RootViewSizeChangedEventArgs>>
       m_sizeChangedEvent;
 
@@ -198,6 +221,9 @@ struct ReactNativeIsland
   void ClearLoadingUI() noexcept;
   void EnsureLoadingUI() noexcept;
   void ShowInstanceLoaded() noexcept;
+  void EnsureMountedSubscription() noexcept;
+  void ShowPlaceholder() noexcept;
+  void FadeOutPlaceholder() noexcept;
   void ShowInstanceError() noexcept;
   void ShowInstanceLoading() noexcept;
   void ShowDebuggerUI(std::string message, const std::function<void()> &onResume) noexcept;
@@ -212,6 +238,8 @@ struct ReactNativeIsland
   facebook::react::Size MeasureLoading(
       const winrt::Microsoft::ReactNative::LayoutConstraints &layoutConstraints) const noexcept;
   void InitTextScaleMultiplier() noexcept;
+  void ScheduleSurfaceLayout() noexcept;
+  void ConstraintSurfaceLayout() noexcept;
 };
 
 } // namespace winrt::Microsoft::ReactNative::implementation
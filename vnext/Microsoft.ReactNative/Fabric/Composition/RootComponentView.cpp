@@ -63,6 +63,21 @@ RootComponentView *RootComponentView::rootComponentView() const noexcept {
   return const_cast<RootComponentView *>(this);
 }
 
+std::unique_ptr<FocusPrimitive> RootComponentView::TakeFocusPrimitive() noexcept {
+  return std::move(m_spareFocusPrimitive);
+}
+
+void RootComponentView::ReturnFocusPrimitive(std::unique_ptr<FocusPrimitive> &&focusPrimitive) noexcept {
+  m_spareFocusPrimitive = std::move(focusPrimitive);
+}
+
+::Microsoft::ReactNative::DpiRasterizationQueue &RootComponentView::dpiRasterizationQueue() noexcept {
+  if (!m_dpiRasterizationQueue) {
+    m_dpiRasterizationQueue = std::make_shared<::Microsoft::ReactNative::DpiRasterizationQueue>(m_reactContext);
+  }
+  return *m_dpiRasterizationQueue;
+}
+
 void RootComponentView::updateLayoutMetrics(
     facebook::react::LayoutMetrics const &layoutMetrics,
     facebook::react::LayoutMetrics const &oldLayoutMetrics) noexcept {
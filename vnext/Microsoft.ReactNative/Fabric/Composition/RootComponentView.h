@@ -9,6 +9,7 @@
 #include <Microsoft.ReactNative.Cxx/ReactContext.h>
 
 #include "CompositionViewComponentView.h"
+#include "DpiRasterizationQueue.h"
 #include "FocusManager.h"
 #include "Theme.h"
 
@@ -90,6 +91,14 @@ struct RootComponentView : RootComponentViewT<RootComponentView, ViewComponentVi
   void ClearCurrentTextSelection() noexcept;
   void SetViewWithTextSelection(const winrt::Microsoft::ReactNative::ComponentView &view) noexcept;
 
+  // Only the focused view shows focus visuals, so all the views of this root share one set of them. The view hosting
+  // the focus visuals takes them from here and gives them back when it stops showing them.
+  std::unique_ptr<FocusPrimitive> TakeFocusPrimitive() noexcept;
+  void ReturnFocusPrimitive(std::unique_ptr<FocusPrimitive> &&focusPrimitive) noexcept;
+
+  // Where the views of this root queue the content they redraw after its scale factor changes
+  ::Microsoft::ReactNative::DpiRasterizationQueue &dpiRasterizationQueue() noexcept;
+
  private:
   // should this be a ReactTaggedView? - It shouldn't actually matter since if the view is going away it should always
   // be clearing its focus But being a reactTaggedView might make it easier to identify cases where that isn't
@@ -98,6 +107,8 @@ struct RootComponentView : RootComponentViewT<RootComponentView, ViewComponentVi
   winrt::weak_ref<winrt::Microsoft::ReactNative::ReactNativeIsland> m_wkRootView{nullptr};
   winrt::weak_ref<winrt::Microsoft::ReactNative::Composition::PortalComponentView> m_wkPortal{nullptr};
   bool m_visualAddedToIsland{false};
+  std::unique_ptr<FocusPrimitive> m_spareFocusPrimitive;
+  std::shared_ptr<::Microsoft::ReactNative::DpiRasterizationQueue> m_dpiRasterizationQueue;
 
   ::Microsoft::ReactNative::ReactTaggedView m_viewWithTextSelection{
       winrt::Microsoft::ReactNative::ComponentView{nullptr}};
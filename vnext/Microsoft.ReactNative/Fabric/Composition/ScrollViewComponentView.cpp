@@ -17,6 +17,7 @@
 #include <winrt/Windows.UI.ViewManagement.Core.h>
 
 #include <AutoDraw.h>
+#include <CppRuntimeOptions.h>
 #include <Fabric/DWriteHelpers.h>
 #include <unicode.h>
 #include "JSValueReader.h"
@@ -25,6 +26,8 @@
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
 constexpr float c_scrollerLineDelta = 16.0f;
+// Seconds per frame, at 60 frames per second
+constexpr double c_scrollUpdateInterval = 1.0 / 60.0;
 
 enum class ScrollbarHitRegion : int {
   Unknown = -1,
@@ -621,6 +624,7 @@ ScrollViewComponentView::ScrollViewComponentView(
           tag,
           reactContext,
           ComponentViewFeatures::Default & ~ComponentViewFeatures::Background) {
+  m_cullOffscreenChildren = ::Microsoft::React::GetRuntimeOptionBool("ScrollView.CullOffscreenChildren");
   // m_element.Content(m_contentPanel);
 
   /*
@@ -720,6 +724,7 @@ void ScrollViewComponentView::MountChildComponentView(
   m_scrollVisual.InsertAt(
       childComponentView.as<winrt::Microsoft::ReactNative::Composition::implementation::ComponentView>()->OuterVisual(),
       index);
+  updateCulling(true);
 }
 
 void ScrollViewComponentView::UnmountChildComponentView(
@@ -730,11 +735,24 @@ void ScrollViewComponentView::UnmountChildComponentView(
   m_scrollVisual.Remove(childComponentView.as<ComponentView>()->OuterVisual());
 }
 
+void ScrollViewComponentView::MountChildComponentViews(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  // Mount each child through MountChildComponentView, so that it ends up in the scroll visual
+  ComponentView::MountChildComponentViews(childComponentViews, index);
+}
+
+void ScrollViewComponentView::UnmountChildComponentViews(
+    winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+    uint32_t index) noexcept {
+  ComponentView::UnmountChildComponentViews(childComponentViews, index);
+}
+
 void ScrollViewComponentView::updateBackgroundColor(const facebook::react::SharedColor &color) noexcept {
   if (color) {
     m_scrollVisual.Brush(theme()->Brush(*color));
   } else {
-    m_scrollVisual.Brush(m_compContext.CreateColorBrush({0, 0, 0, 0}));
+    m_scrollVisual.Brush(theme()->TransparentBrush());
   }
 }
 
@@ -870,7 +888,70 @@ void ScrollViewComponentView::updateLayoutMetrics(
         {layoutMetrics.frame.size.width * layoutMetrics.pointScaleFactor,
          layoutMetrics.frame.size.height * layoutMetrics.pointScaleFactor});
     updateContentVisualSize();
+    if (m_scrollPropSet && layoutMetrics.pointScaleFactor != oldLayoutMetrics.pointScaleFactor) {
+      m_scrollPropSet.InsertScalar(L"pointScaleFactor", layoutMetrics.pointScaleFactor);
+    }
+  }
+}
+
+void ScrollViewComponentView::scheduleScrollUpdate() noexcept {
+  if (m_scrollUpdatePending) {
+    // The pending update sends the latest position
+    return;
+  }
+
+  // Interaction tracker updates can arrive faster than frames are rendered, they are coalesced into at most one state
+  // update and onScroll event per frame, or per scrollEventThrottle when that is longer
+  const auto now = std::chrono::steady_clock::now();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(now - m_lastScrollEventTime).count();
+  const auto interval = std::max(c_scrollUpdateInterval, m_scrollEventThrottle);
+  if (m_allowNextScrollNoMatterWhat || elapsed >= interval) {
+    sendScrollUpdate();
+    return;
+  }
+  if (!std::isfinite(interval)) {
+    return;
+  }
+
+  if (!m_scrollUpdateTimer) {
+    m_scrollUpdateTimer = winrt::Microsoft::ReactNative::Timer::Create(m_reactContext.Properties().Handle());
+    m_scrollUpdateTimer.Tick([wkThis = get_weak()](
+                                 const winrt::Windows::Foundation::IInspectable &,
+                                 const winrt::Windows::Foundation::IInspectable &) {
+      if (auto strongThis = wkThis.get()) {
+        strongThis->flushScrollUpdate();
+      }
+    });
+  }
+  m_scrollUpdatePending = true;
+  m_scrollUpdateTimer.Interval(std::chrono::duration_cast<winrt::Windows::Foundation::TimeSpan>(
+      std::chrono::duration<double>(interval - elapsed)));
+  m_scrollUpdateTimer.Start();
+}
+
+void ScrollViewComponentView::flushScrollUpdate() noexcept {
+  if (!m_scrollUpdatePending) {
+    return;
+  }
+  m_scrollUpdateTimer.Stop();
+  sendScrollUpdate();
+}
+
+void ScrollViewComponentView::sendScrollUpdate() noexcept {
+  m_scrollUpdatePending = false;
+  if (!m_pendingScrollArgs) {
+    return;
+  }
+
+  updateStateWithContentOffset();
+  auto eventEmitter = GetEventEmitter();
+  if (eventEmitter) {
+    auto scrollMetrics = getScrollMetrics(eventEmitter, m_pendingScrollArgs);
+    std::static_pointer_cast<facebook::react::ScrollViewEventEmitter const>(eventEmitter)->onScroll(scrollMetrics);
+    m_lastScrollEventTime = std::chrono::steady_clock::now();
+    m_allowNextScrollNoMatterWhat = false;
   }
+  m_pendingScrollArgs = nullptr;
 }
 
 void ScrollViewComponentView::updateContentVisualSize() noexcept {
@@ -880,9 +961,58 @@ void ScrollViewComponentView::updateContentVisualSize() noexcept {
   m_verticalScrollbarComponent->ContentSize(contentSize);
   m_horizontalScrollbarComponent->ContentSize(contentSize);
   m_scrollVisual.ContentSize(contentSize);
+  updateCulling(true);
 }
 
-void ScrollViewComponentView::prepareForRecycle() noexcept {}
+void ScrollViewComponentView::updateCulling(bool force) noexcept {
+  if (!m_cullOffscreenChildren || !m_scrollVisual) {
+    return;
+  }
+
+  const auto scale = m_layoutMetrics.pointScaleFactor;
+  const auto viewportSize = m_layoutMetrics.frame.size;
+  const auto position = m_scrollVisual.ScrollPosition();
+  if (!force && m_lastCullingPosition &&
+      std::abs(position.x - m_lastCullingPosition->x) < viewportSize.width * scale / 4 &&
+      std::abs(position.y - m_lastCullingPosition->y) < viewportSize.height * scale / 4) {
+    return;
+  }
+  m_lastCullingPosition = position;
+
+  // Zoomed content is not where its layout says it is
+  const auto &scrollViewProps = *std::static_pointer_cast<const facebook::react::ScrollViewProps>(viewProps());
+  const bool cull{scrollViewProps.zoomScale == 1.0f && scrollViewProps.maximumZoomScale <= 1.0f};
+
+  // The viewport in the coordinates of the content, with a viewport of overscan on each side, so that children are
+  // shown again before they scroll into view
+  const facebook::react::Rect cullingRect{
+      {position.x / scale - viewportSize.width, position.y / scale - viewportSize.height},
+      {viewportSize.width * 3, viewportSize.height * 3}};
+
+  // The content container is the only child of a ScrollView, its children are the rows of the content
+  for (const auto &content : m_children) {
+    auto contentView = content.try_as<ComponentView>();
+    if (!contentView) {
+      continue;
+    }
+    const auto contentOrigin = contentView->layoutMetrics().frame.origin;
+    for (const auto &child : contentView->Children()) {
+      if (auto childView = child.try_as<ViewComponentView>()) {
+        auto frame = childView->layoutMetrics().frame;
+        frame.origin.x += contentOrigin.x;
+        frame.origin.y += contentOrigin.y;
+        childView->Culled(
+            cull &&
+            (frame.getMaxX() < cullingRect.getMinX() || frame.getMinX() > cullingRect.getMaxX() ||
+             frame.getMaxY() < cullingRect.getMinY() || frame.getMinY() > cullingRect.getMaxY()));
+      }
+    }
+  }
+}
+
+void ScrollViewComponentView::prepareForRecycle() noexcept {
+  Super::prepareForRecycle();
+}
 
 /*
 ScrollViewComponentView::ScrollInteractionTrackerOwner::ScrollInteractionTrackerOwner(
@@ -1300,8 +1430,7 @@ winrt::Microsoft::ReactNative::Composition::Experimental::IVisual ScrollViewComp
       [this](
           winrt::IInspectable const & /*sender*/,
           winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const &args) {
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(now - m_lastScrollEventTime).count();
+        updateCulling(false);
 
         // Dismiss keyboard if mode is "on-drag"
         auto keyboardDismissMode =
@@ -1313,18 +1442,8 @@ winrt::Microsoft::ReactNative::Composition::Experimental::IVisual ScrollViewComp
           }
         }
 
-        if (m_allowNextScrollNoMatterWhat ||
-            (m_scrollEventThrottle < std::max(std::chrono::duration<double>(0.017).count(), elapsed))) {
-          updateStateWithContentOffset();
-          auto eventEmitter = GetEventEmitter();
-          if (eventEmitter) {
-            auto scrollMetrics = getScrollMetrics(eventEmitter, args);
-            std::static_pointer_cast<facebook::react::ScrollViewEventEmitter const>(eventEmitter)
-                ->onScroll(scrollMetrics);
-            m_lastScrollEventTime = now;
-            m_allowNextScrollNoMatterWhat = false;
-          }
-        }
+        m_pendingScrollArgs = args;
+        scheduleScrollUpdate();
       });
 
   m_scrollBeginDragRevoker = m_scrollVisual.ScrollBeginDrag(
@@ -1347,6 +1466,7 @@ winrt::Microsoft::ReactNative::Composition::Experimental::IVisual ScrollViewComp
       [this](
           winrt::IInspectable const & /*sender*/,
           winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const &args) {
+        flushScrollUpdate();
         updateStateWithContentOffset();
         auto eventEmitter = GetEventEmitter();
         if (eventEmitter) {
@@ -1374,6 +1494,7 @@ winrt::Microsoft::ReactNative::Composition::Experimental::IVisual ScrollViewComp
       [this](
           winrt::IInspectable const & /*sender*/,
           winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const &args) {
+        flushScrollUpdate();
         auto eventEmitter = GetEventEmitter();
         if (eventEmitter) {
           auto scrollMetrics = getScrollMetrics(eventEmitter, args);
@@ -1415,6 +1536,40 @@ facebook::react::Tag ScrollViewComponentView::hitTest(
   return -1;
 }
 
+facebook::react::Rect ScrollViewComponentView::hitTestBounds() const noexcept {
+  return m_layoutMetrics.frame;
+}
+
+winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual::ScrollPositionChanged_revoker
+ScrollViewComponentView::ScrollPositionChanged(
+    winrt::Windows::Foundation::EventHandler<
+        winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs> const &handler) noexcept {
+  return m_scrollVisual.ScrollPositionChanged(winrt::auto_revoke, handler);
+}
+
+comp::CompositionPropertySet ScrollViewComponentView::EnsureScrollPropertySet() noexcept {
+  if (m_scrollPropSet == nullptr) {
+    ensureVisual();
+    winrt::com_ptr<::Microsoft::ReactNative::Composition::IMicrosoftCompositionScrollVisual> scrollVisual;
+    m_scrollVisual.try_as(scrollVisual);
+    auto compositor =
+        winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerCompositor(
+            m_compContext);
+    if (scrollVisual && compositor) {
+      m_scrollPropSet = compositor.CreatePropertySet();
+      m_scrollPropSet.InsertScalar(L"pointScaleFactor", m_layoutMetrics.pointScaleFactor);
+      m_scrollPropSet.InsertVector3(L"contentOffset", {0, 0, 0});
+      // The position of the interaction tracker that scrolls the content is in pixels
+      auto contentOffsetAnimation =
+          compositor.CreateExpressionAnimation(L"tracker.Position / this.Target.pointScaleFactor");
+      contentOffsetAnimation.SetReferenceParameter(L"tracker", scrollVisual->InnerInteractionTracker());
+      m_scrollPropSet.StartAnimation(L"contentOffset", contentOffsetAnimation);
+    }
+  }
+
+  return m_scrollPropSet;
+}
+
 facebook::react::Point ScrollViewComponentView::getClientOffset() const noexcept {
   facebook::react::Point parentOffset{0};
   if (m_parent) {
@@ -15,6 +15,7 @@
 #pragma warning(pop)
 #include "Composition.ScrollViewComponentView.g.h"
 #include <winrt/Windows.UI.Composition.interactions.h>
+#include <optional>
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
@@ -64,6 +65,12 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
   void UnmountChildComponentView(
       const winrt::Microsoft::ReactNative::ComponentView &childComponentView,
       uint32_t index) noexcept override;
+  void MountChildComponentViews(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept override;
+  void UnmountChildComponentViews(
+      winrt::array_view<const winrt::Microsoft::ReactNative::ComponentView> childComponentViews,
+      uint32_t index) noexcept override;
   void updateProps(facebook::react::Props::Shared const &props, facebook::react::Props::Shared const &oldProps) noexcept
       override;
   void updateState(facebook::react::State::Shared const &state, facebook::react::State::Shared const &oldState) noexcept
@@ -77,6 +84,8 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
   void HandleCommand(const winrt::Microsoft::ReactNative::HandleCommandArgs &args) noexcept override;
   facebook::react::Tag hitTest(facebook::react::Point pt, facebook::react::Point &localPt, bool ignorePointerEvents)
       const noexcept override;
+  // Hit testing is clipped to the viewport, the content can be scrolled anywhere within it
+  facebook::react::Rect hitTestBounds() const noexcept override;
   facebook::react::Point getClientOffset() const noexcept override;
 
   void onThemeChanged() noexcept override;
@@ -113,6 +122,15 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
   winrt::Microsoft::ReactNative::Composition::Experimental::IVisual visualToHostFocus() noexcept override;
   winrt::com_ptr<ComponentView> focusVisualRoot(const facebook::react::Rect &focusRect) noexcept override;
 
+  // Lets descendants that only draw the part of themselves near the viewport follow scrolling
+  winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual::ScrollPositionChanged_revoker
+  ScrollPositionChanged(winrt::Windows::Foundation::EventHandler<
+                        winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs> const
+                            &handler) noexcept;
+  // Lets animations follow the scroll position on the compositor.  "contentOffset" holds the content offset in DIPs,
+  // like the contentOffset of onScroll.
+  comp::CompositionPropertySet EnsureScrollPropertySet() noexcept;
+
   int getScrollPositionX() noexcept;
   int getScrollPositionY() noexcept;
   double getVerticalSize() noexcept;
@@ -121,6 +139,10 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
  private:
   void updateDecelerationRate(float value) noexcept;
   void updateContentVisualSize() noexcept;
+  // Culls the children of the content that are further than a viewport outside of the viewport, when the
+  // "ScrollView.CullOffscreenChildren" runtime option is set.  Only runs once the content has scrolled a fraction of
+  // the viewport since the last pass, unless forced because the content changed.
+  void updateCulling(bool force) noexcept;
   bool scrollToEnd(bool animate) noexcept;
   bool scrollToStart(bool animate) noexcept;
   bool scrollDown(float delta, bool animate) noexcept;
@@ -129,6 +151,10 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
   bool scrollRight(float delta, bool animate) noexcept;
   void updateBackgroundColor(const facebook::react::SharedColor &color) noexcept;
   void updateStateWithContentOffset() noexcept;
+  // Sends the state update and onScroll event of the latest scroll position, now or once the throttle allows
+  void scheduleScrollUpdate() noexcept;
+  void flushScrollUpdate() noexcept;
+  void sendScrollUpdate() noexcept;
   facebook::react::ScrollViewEventEmitter::Metrics getScrollMetrics(
       facebook::react::SharedViewEventEmitter const &eventEmitter,
       winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const &args) noexcept;
@@ -137,6 +163,7 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
 
   facebook::react::Size m_contentSize;
   winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual m_scrollVisual{nullptr};
+  comp::CompositionPropertySet m_scrollPropSet{nullptr};
   std::shared_ptr<ScrollBarComponent> m_horizontalScrollbarComponent{nullptr};
   std::shared_ptr<ScrollBarComponent> m_verticalScrollbarComponent{nullptr};
   winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual::ScrollPositionChanged_revoker
@@ -159,6 +186,11 @@ struct ScrollInteractionTrackerOwner : public winrt::implements<
   double m_scrollEventThrottle{0.0};
   bool m_allowNextScrollNoMatterWhat{false};
   std::chrono::steady_clock::time_point m_lastScrollEventTime{};
+  winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs m_pendingScrollArgs{nullptr};
+  winrt::Microsoft::ReactNative::ITimer m_scrollUpdateTimer{nullptr};
+  bool m_scrollUpdatePending{false};
+  bool m_cullOffscreenChildren{false};
+  std::optional<winrt::Windows::Foundation::Numerics::float3> m_lastCullingPosition;
   std::shared_ptr<facebook::react::ScrollViewShadowNode::ConcreteState const> m_state;
 };
 
@@ -81,7 +81,7 @@ void SwitchComponentView::updateProps(
   }
 
   if (oldViewProps.value != newViewProps.value) {
-    if (UiaClientsAreListening()) {
+    if (UiaClientsAreListeningThisFrame()) {
       winrt::Microsoft::ReactNative::implementation::UpdateUiaProperty(
           EnsureUiaProvider(),
           UIA_ToggleToggleStatePropertyId,
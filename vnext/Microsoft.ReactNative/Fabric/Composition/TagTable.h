@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Flat open addressing (linear probing) table of values keyed by Tag.  React tags are small, mostly sequential
+// integers, so Fibonacci hashing spreads them evenly and most lookups touch a single cache line, unlike
+// std::unordered_map which allocates a node per entry.
+// Pointers and references into the table are invalidated by any insert or erase.
+template <typename TValue>
+class TagTable final {
+ public:
+  TValue *find(facebook::react::Tag tag) noexcept {
+    return const_cast<TValue *>(std::as_const(*this).find(tag));
+  }
+
+  const TValue *find(facebook::react::Tag tag) const noexcept {
+    if (m_slots.empty()) {
+      return nullptr;
+    }
+    for (auto index = homeIndex(tag);; index = (index + 1) & m_mask) {
+      auto &slot = m_slots[index];
+      if (slot.tag == tag) {
+        return &slot.value;
+      }
+      if (slot.tag == EmptyTag) {
+        return nullptr;
+      }
+    }
+  }
+
+  bool contains(facebook::react::Tag tag) const noexcept {
+    return find(tag) != nullptr;
+  }
+
+  size_t size() const noexcept {
+    return m_size;
+  }
+
+  // The number of slots, which is 0 until the first insert and then a power of 2
+  size_t capacity() const noexcept {
+    return m_slots.size();
+  }
+
+  // The slot that the probe sequence of the tag starts at.  Only meaningful once the table has a capacity.
+  size_t homeIndex(facebook::react::Tag tag) const noexcept {
+    return static_cast<size_t>((static_cast<uint32_t>(tag) * 0x9E3779B9u) >> m_shift);
+  }
+
+  template <typename TFunc>
+  void forEach(TFunc &&func) const noexcept {
+    for (auto &slot : m_slots) {
+      if (slot.tag != EmptyTag) {
+        func(slot.tag, slot.value);
+      }
+    }
+  }
+
+  // The tag must not already be in the table
+  TValue &insert(facebook::react::Tag tag, TValue &&value) noexcept {
+    assert(tag != EmptyTag);
+    assert(!contains(tag));
+
+    // Keep the load factor at or below 1/2 so that probe sequences stay short
+    if ((m_size + 1) * 2 > m_slots.size()) {
+      rehash(m_slots.empty() ? InitialCapacity : m_slots.size() * 2);
+    }
+
+    auto index = homeIndex(tag);
+    while (m_slots[index].tag != EmptyTag) {
+      index = (index + 1) & m_mask;
+    }
+
+    auto &slot = m_slots[index];
+    slot.tag = tag;
+    slot.value = std::move(value);
+    m_size++;
+    return slot.value;
+  }
+
+  // Returns false if the tag was not in the table
+  bool erase(facebook::react::Tag tag) noexcept {
+    if (m_slots.empty()) {
+      return false;
+    }
+
+    auto index = homeIndex(tag);
+    while (m_slots[index].tag != tag) {
+      if (m_slots[index].tag == EmptyTag) {
+        return false;
+      }
+      index = (index + 1) & m_mask;
+    }
+
+    // Backward shift deletion, so that no tombstones are needed: move later entries of the probe sequence into the
+    // hole, unless their home slot lies cyclically within (hole, current]
+    auto hole = index;
+    for (auto current = (hole + 1) & m_mask; m_slots[current].tag != EmptyTag; current = (current + 1) & m_mask) {
+      auto home = homeIndex(m_slots[current].tag);
+      bool reachable = (hole <= current) ? (hole < home && home <= current) : (hole < home || home <= current);
+      if (!reachable) {
+        m_slots[hole] = std::move(m_slots[current]);
+        hole = current;
+      }
+    }
+
+    m_slots[hole].tag = EmptyTag;
+    m_slots[hole].value = {};
+    m_size--;
+    return true;
+  }
+
+  static constexpr size_t InitialCapacity = 256;
+
+ private:
+  static constexpr facebook::react::Tag EmptyTag = std::numeric_limits<facebook::react::Tag>::min();
+
+  struct Slot {
+    facebook::react::Tag tag{EmptyTag};
+    TValue value{};
+  };
+
+  void rehash(size_t capacity) noexcept {
+    assert((capacity & (capacity - 1)) == 0);
+
+    auto oldSlots = std::move(m_slots);
+    m_slots = std::vector<Slot>(capacity);
+    m_mask = capacity - 1;
+    m_shift = 32;
+    for (auto remaining = capacity; remaining > 1; remaining >>= 1) {
+      m_shift--;
+    }
+
+    for (auto &slot : oldSlots) {
+      if (slot.tag != EmptyTag) {
+        auto index = homeIndex(slot.tag);
+        while (m_slots[index].tag != EmptyTag) {
+          index = (index + 1) & m_mask;
+        }
+        m_slots[index] = std::move(slot);
+      }
+    }
+  }
+
+  std::vector<Slot> m_slots;
+  size_t m_size{0};
+  size_t m_mask{0};
+  uint32_t m_shift{32};
+};
+
+} // namespace Microsoft::ReactNative
@@ -8,13 +8,83 @@
 
 #include <AutoDraw.h>
 #include <Utils/ValueUtils.h>
+#include <react/renderer/textlayoutmanager/WindowsTextLayoutManager.h>
 #include <unicode.h>
+#include <unordered_map>
 #include <windows.ui.composition.interop.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
 #include "CompositionHelpers.h"
 
 namespace winrt::Microsoft::ReactNative::Composition {
 
+namespace {
+
+constexpr size_t MaxSolidColorBrushCacheSize = 256;
+
+struct SolidColorBrushKey {
+  D2D1_COLOR_F color;
+  float opacity;
+
+  bool operator==(const SolidColorBrushKey &other) const noexcept {
+    return color.r == other.color.r && color.g == other.color.g && color.b == other.color.b &&
+        color.a == other.color.a && opacity == other.opacity;
+  }
+};
+
+struct SolidColorBrushKeyHash {
+  size_t operator()(const SolidColorBrushKey &key) const noexcept {
+    size_t seed = std::hash<float>{}(key.color.r);
+    auto combine = [&seed](size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+    combine(std::hash<float>{}(key.color.g));
+    combine(std::hash<float>{}(key.color.b));
+    combine(std::hash<float>{}(key.color.a));
+    combine(std::hash<float>{}(key.opacity));
+    return seed;
+  }
+};
+
+struct SolidColorBrushCache {
+  // Brushes can only be used with render targets of the device that created them
+  winrt::com_ptr<ID2D1Device> device;
+  std::unordered_map<SolidColorBrushKey, winrt::com_ptr<ID2D1SolidColorBrush>, SolidColorBrushKeyHash> brushes;
+};
+
+} // namespace
+
+winrt::com_ptr<ID2D1SolidColorBrush>
+GetSolidColorBrush(ID2D1RenderTarget &renderTarget, const D2D1_COLOR_F &color, float opacity) noexcept {
+  winrt::com_ptr<ID2D1SolidColorBrush> brush;
+  winrt::com_ptr<ID2D1DeviceContext> deviceContext;
+  winrt::com_ptr<ID2D1Device> device;
+  if (SUCCEEDED(renderTarget.QueryInterface(deviceContext.put()))) {
+    deviceContext->GetDevice(device.put());
+  }
+
+  if (!device) {
+    winrt::check_hresult(renderTarget.CreateSolidColorBrush(color, D2D1::BrushProperties(opacity), brush.put()));
+    return brush;
+  }
+
+  thread_local SolidColorBrushCache cache;
+  if (cache.device != device) {
+    // The device was lost and recreated, none of the cached brushes can be used anymore
+    cache.device = device;
+    cache.brushes.clear();
+  }
+
+  SolidColorBrushKey key{color, opacity};
+  if (auto it = cache.brushes.find(key); it != cache.brushes.end()) {
+    return it->second;
+  }
+
+  winrt::check_hresult(renderTarget.CreateSolidColorBrush(color, D2D1::BrushProperties(opacity), brush.put()));
+  if (cache.brushes.size() >= MaxSolidColorBrushCacheSize) {
+    cache.brushes.clear();
+  }
+  cache.brushes.emplace(key, brush);
+  return brush;
+}
+
 void RenderText(
     ID2D1RenderTarget &deviceContext,
     ::IDWriteTextLayout &textLayout,
@@ -31,16 +101,11 @@ void RenderText(
   deviceContext.GetDpi(&oldDpiX, &oldDpiY);
   deviceContext.SetDpi(dpi, dpi);
 
-  // Create a solid color brush for the text. A more sophisticated application might want
-  // to cache and reuse a brush across all text elements instead, taking care to recreate
-  // it in the event of device removed.
-  winrt::com_ptr<ID2D1SolidColorBrush> brush;
-  if (textAttributes.foregroundColor) {
-    auto color = theme.D2DColor(*textAttributes.foregroundColor);
-    winrt::check_hresult(deviceContext.CreateSolidColorBrush(color, brush.put()));
-  } else {
-    winrt::check_hresult(deviceContext.CreateSolidColorBrush(D2D1::ColorF(D2D1::ColorF::Black, 1.0f), brush.put()));
-  }
+  // The brushes are shared with all other text drawn with the same colors on this device
+  auto brush = GetSolidColorBrush(
+      deviceContext,
+      textAttributes.foregroundColor ? theme.D2DColor(*textAttributes.foregroundColor)
+                                     : D2D1::ColorF(D2D1::ColorF::Black, 1.0f));
 
   if (textAttributes.textDecorationLineType) {
     DWRITE_TEXT_RANGE range = {0, std::numeric_limits<uint32_t>::max()};
@@ -62,23 +127,21 @@ void RenderText(
     }
   }
 
-  // Create color effects for individual text fragments.
-  unsigned int position = 0;
-  unsigned int length = 0;
-  for (auto fragment : attributedString.getFragments()) {
-    length = static_cast<UINT32>(fragment.string.length());
-    DWRITE_TEXT_RANGE range = {position, length};
+  // Create color effects for individual text fragments, at the same UTF-16 ranges that the layout was created with
+  const auto transformedText = facebook::react::WindowsTextLayoutManager::GetTransformedText(attributedString);
+  const auto &fragments = attributedString.getFragments();
+  for (size_t fragmentIndex = 0; fragmentIndex < fragments.size(); fragmentIndex++) {
+    const auto &fragment = fragments[fragmentIndex];
+    const auto position = transformedText->fragmentOffsets[fragmentIndex];
+    DWRITE_TEXT_RANGE range = {position, transformedText->fragmentOffsets[fragmentIndex + 1] - position};
     if (fragment.textAttributes.foregroundColor &&
             (fragment.textAttributes.foregroundColor != textAttributes.foregroundColor) ||
         !isnan(fragment.textAttributes.opacity)) {
-      winrt::com_ptr<ID2D1SolidColorBrush> fragmentBrush;
-      if (fragment.textAttributes.foregroundColor) {
-        auto color = theme.D2DColor(*fragment.textAttributes.foregroundColor);
-        winrt::check_hresult(deviceContext.CreateSolidColorBrush(color, fragmentBrush.put()));
-      } else {
-        winrt::check_hresult(
-            deviceContext.CreateSolidColorBrush(D2D1::ColorF(D2D1::ColorF::Black, 1.0f), fragmentBrush.put()));
-      }
+      auto fragmentBrush = GetSolidColorBrush(
+          deviceContext,
+          fragment.textAttributes.foregroundColor ? theme.D2DColor(*fragment.textAttributes.foregroundColor)
+                                                  : D2D1::ColorF(D2D1::ColorF::Black, 1.0f),
+          isnan(fragment.textAttributes.opacity) ? 1.0f : fragment.textAttributes.opacity);
 
       if (fragment.textAttributes.textDecorationLineType) {
         if (*(fragment.textAttributes.textDecorationLineType) == facebook::react::TextDecorationLineType::Underline ||
@@ -101,9 +164,6 @@ void RenderText(
         }
       }
 
-      if (!isnan(fragment.textAttributes.opacity)) {
-        fragmentBrush->SetOpacity(fragment.textAttributes.opacity);
-      }
       textLayout.SetDrawingEffect(fragmentBrush.get(), range);
 
       // DWrite doesn't handle background highlight colors, so we manually draw the background color for ranges
@@ -142,9 +202,8 @@ void RenderText(
           auto oldAliasMode = deviceContext.GetAntialiasMode();
           deviceContext.SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
 
-          winrt::com_ptr<ID2D1SolidColorBrush> textHighlightBrush;
-          winrt::check_hresult(deviceContext.CreateSolidColorBrush(
-              theme.D2DColor(*fragment.textAttributes.backgroundColor), textHighlightBrush.put()));
+          auto textHighlightBrush =
+              GetSolidColorBrush(deviceContext, theme.D2DColor(*fragment.textAttributes.backgroundColor));
 
           for (size_t i = 0; i < actualHitTestCount; ++i) {
             const DWRITE_HIT_TEST_METRICS &htm = hitTestMetrics[i];
@@ -161,8 +220,6 @@ void RenderText(
         }
       }
     }
-
-    position += length;
   }
 
   // Draw the line of text at the specified offset, which corresponds to the top-left
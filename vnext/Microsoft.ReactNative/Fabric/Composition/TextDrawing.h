@@ -13,6 +13,11 @@
 
 namespace winrt::Microsoft::ReactNative::Composition {
 
+// Returns a brush of the color and opacity from a per thread cache of the render target's device, so that repainting
+// text does not create new brushes.  The brush is shared, so it must not be modified.
+winrt::com_ptr<ID2D1SolidColorBrush>
+GetSolidColorBrush(ID2D1RenderTarget &renderTarget, const D2D1_COLOR_F &color, float opacity = 1.0f) noexcept;
+
 void RenderText(
     ID2D1RenderTarget &deviceContext,
     ::IDWriteTextLayout &textLayout,
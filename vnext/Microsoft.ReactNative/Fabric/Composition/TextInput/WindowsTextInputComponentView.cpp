@@ -21,6 +21,7 @@
 #include "../Composition.Input.h"
 #include "../CompositionHelpers.h"
 #include "../RootComponentView.h"
+#include "../ScrollViewComponentView.h"
 #include "JSValueReader.h"
 #include "WindowsTextInputShadowNode.h"
 #include "guid/msoGuid.h"
@@ -68,8 +69,8 @@ WindowsTextInputComponentView::DrawBlock::DrawBlock(WindowsTextInputComponentVie
 
 WindowsTextInputComponentView::DrawBlock::~DrawBlock() {
   m_view.m_cDrawBlock--;
-  if (!m_view.m_cDrawBlock && m_view.m_needsRedraw) {
-    m_view.DrawText();
+  if (!m_view.m_cDrawBlock && (m_view.m_needsRedraw || !IsRectEmpty(&m_view.m_invalidRect))) {
+    m_view.ScheduleDraw();
   }
 }
 
@@ -146,7 +147,7 @@ struct CompTextHost : public winrt::implements<CompTextHost, ITextHost> {
   void TxInvalidateRect(LPCRECT prc, BOOL fMode) override {
     if (m_outer->m_drawing)
       return;
-    m_outer->DrawText();
+    m_outer->InvalidateText(prc);
   }
 
   //@cmember Send a WM_PAINT to the window
@@ -157,7 +158,7 @@ struct CompTextHost : public winrt::implements<CompTextHost, ITextHost> {
     {
       // If inner viewer size changed, a redraw will have be queued.
       // If not, we need to redraw at least once here.
-      m_outer->DrawText();
+      m_outer->OnViewChanged();
     }
   }
 
@@ -446,8 +447,9 @@ struct CompTextHost : public winrt::implements<CompTextHost, ITextHost> {
 
     switch (iNotify) {
       case EN_UPDATE:
+        // The changed area is reported through TxInvalidateRect
         if (!m_outer->m_drawing) {
-          m_outer->DrawText();
+          m_outer->ScheduleDraw();
         }
         break;
       case EN_CHANGE:
@@ -488,7 +490,7 @@ AutoCorrectOffCallback(LANGID langid, const WCHAR *pszBefore, WCHAR *pszAfter, L
   return ATP_CHANGE;
 }
 
-facebook::react::AttributedString WindowsTextInputComponentView::getAttributedString() const {
+facebook::react::AttributedString WindowsTextInputComponentView::getAttributedString(const std::string &text) const {
   // Use BaseTextShadowNode to get attributed string from children
 
   auto childTextAttributes = facebook::react::TextAttributes::defaultTextAttributes();
@@ -501,7 +503,6 @@ facebook::react::AttributedString WindowsTextInputComponentView::getAttributedSt
 
   // BaseTextShadowNode only gets children. We must detect and prepend text
   // value attributes manually.
-  auto text = GetTextFromRichEdit();
   if (!text.empty()) {
     auto textAttributes = facebook::react::TextAttributes::defaultTextAttributes();
     textAttributes.fontSizeMultiplier = m_fontSizeMultiplier;
@@ -1326,20 +1327,20 @@ std::pair<float, float> WindowsTextInputComponentView::GetContentSize() const no
 
 // When we are notified by RichEdit that the text changed, we need to notify JS
 void WindowsTextInputComponentView::OnTextUpdated() noexcept {
-  auto data = m_state->getData();
-  // auto newAttributedString = getAttributedString();
-  // if (data.attributedString == newAttributedString)
-  //    return;
-  data.attributedStringBox = facebook::react::AttributedStringBox(getAttributedString());
-  data.mostRecentEventCount = m_nativeEventCount;
+  // The text is being reset for recycling, which neither the state nor accessibility clients of the old tag should see
+  if (m_comingFromJS && m_comingFromState) {
+    return;
+  }
 
-  m_state->updateState(std::move(data));
+  auto text = GetTextFromRichEdit();
+  m_content->update(getAttributedString(text), m_nativeEventCount);
+  ScheduleStateUpdate();
 
   if (m_eventEmitter && !m_comingFromJS) {
     // call onChange event
     auto emitter = std::static_pointer_cast<const facebook::react::WindowsTextInputEventEmitter>(m_eventEmitter);
     facebook::react::WindowsTextInputEventEmitter::OnChange onChangeArgs;
-    onChangeArgs.text = GetTextFromRichEdit();
+    onChangeArgs.text = text;
     onChangeArgs.eventCount = ++m_nativeEventCount;
     emitter->onChange(onChangeArgs);
     if (windowsTextInputProps().multiline) {
@@ -1351,13 +1352,51 @@ void WindowsTextInputComponentView::OnTextUpdated() noexcept {
     }
   }
 
-  if (UiaClientsAreListening()) {
-    auto text = GetTextFromRichEdit();
+  if (UiaClientsAreListeningThisFrame()) {
     winrt::Microsoft::ReactNative::implementation::UpdateUiaProperty(
         EnsureUiaProvider(), UIA_ValueValuePropertyId, text, text);
   }
 }
 
+void WindowsTextInputComponentView::ScheduleStateUpdate() noexcept {
+  // All edits until the UI thread is idle again, such as those of one paste or IME composition, update the state once
+  if (m_stateUpdateScheduled) {
+    return;
+  }
+
+  m_stateUpdateScheduled = true;
+  m_reactContext.UIDispatcher().Post([wkThis = get_weak()]() {
+    // Cleared when the view is recycled, so that its next tag does not get the state of the previous one
+    if (auto strongThis = wkThis.get(); strongThis && strongThis->m_stateUpdateScheduled) {
+      strongThis->m_stateUpdateScheduled = false;
+      strongThis->UpdateStateIfNeeded();
+    }
+  });
+}
+
+void WindowsTextInputComponentView::UpdateStateIfNeeded() noexcept {
+  if (!m_state) {
+    return;
+  }
+
+  // Once the state refers to m_content, the shadow node measures the text from it.  So while the size of a multiline
+  // input's content is stable, edits do not need a state update, which would commit and lay out the tree again.
+  // Single line inputs are cheap to measure, and may grow horizontally past the layout width used by GetContentSize.
+  auto contentSize = GetContentSize();
+  if (m_multiline && m_state->getData().content == m_content && contentSize == m_stateContentSize) {
+    return;
+  }
+  m_stateContentSize = contentSize;
+
+  auto data = m_state->getData();
+  data.content = m_content;
+  data.contentVersion = m_content->getVersion();
+  data.attributedStringBox = facebook::react::AttributedStringBox(m_content->getAttributedString());
+  data.mostRecentEventCount = m_content->getMostRecentEventCount();
+
+  m_state->updateState(std::move(data));
+}
+
 void WindowsTextInputComponentView::EmitOnScrollEvent() noexcept {
   if (!windowsTextInputProps().scrollEnabled || !m_eventEmitter || m_comingFromJS || !m_textServices) {
     return;
@@ -1439,6 +1478,7 @@ void WindowsTextInputComponentView::onMounted() noexcept {
     m_propBits |= TXTBIT_CHARFORMATCHANGE;
   }
   InternalFinalize();
+  updateViewportSubscription();
 
   // Handle autoFocus property - focus the component when mounted if autoFocus is true
   if (windowsTextInputProps().autoFocus) {
@@ -1448,6 +1488,42 @@ void WindowsTextInputComponentView::onMounted() noexcept {
   }
 }
 
+void WindowsTextInputComponentView::onUnmounted() noexcept {
+  m_viewportScrollRevokers.clear();
+  Super::onUnmounted();
+}
+
+// A recycled input keeps its RichEdit text services, which are costly to create, and the formats that its props set
+// on them, since the props of its next tag are diffed against its current ones.  Only the content is reset.
+void WindowsTextInputComponentView::prepareForRecycle() noexcept {
+  // Drops the event emitter first, so that clearing the text does not emit onChange
+  Super::prepareForRecycle();
+
+  {
+    DrawBlock db(*this);
+    LRESULT res;
+    if (m_hasFocus) {
+      m_hasFocus = false;
+      m_textServices->TxSendMessage(WM_KILLFOCUS, 0, 0, &res);
+    }
+    // Clearing the text notifies OnTextUpdated, which would schedule a state update and create a UIA provider
+    m_comingFromJS = true;
+    m_comingFromState = true;
+    m_textServices->TxSetText(L"");
+    m_textServices->TxSendMessage(EM_EMPTYUNDOBUFFER, 0, 0, &res);
+    m_comingFromJS = false;
+    m_comingFromState = false;
+  }
+
+  m_state = nullptr;
+  m_stateUpdateScheduled = false;
+  m_content = std::make_shared<facebook::react::WindowsTextInputContent>();
+  m_stateContentSize = {};
+  m_mostRecentEventCount = 0;
+  m_nativeEventCount = 0;
+  m_lastClickTime = {};
+}
+
 std::optional<std::string> WindowsTextInputComponentView::getAccessiblityValue() noexcept {
   return GetTextFromRichEdit();
 }
@@ -1617,6 +1693,7 @@ void WindowsTextInputComponentView::UpdateParaFormat() noexcept {
 }
 
 void WindowsTextInputComponentView::OnRenderingDeviceLost() noexcept {
+  Super::OnRenderingDeviceLost();
   DrawText();
 }
 
@@ -1624,10 +1701,26 @@ void WindowsTextInputComponentView::ensureDrawingSurface() noexcept {
   assert(m_reactContext.UIDispatcher().HasThreadAccess());
 
   if (!m_drawingSurface) {
-    m_drawingSurface = m_compContext.CreateDrawingSurfaceBrush(
-        {static_cast<float>(m_imgWidth), static_cast<float>(m_imgHeight)},
-        winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
-        winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+    winrt::Windows::Foundation::Size surfaceSize = {static_cast<float>(m_imgWidth), static_cast<float>(m_imgHeight)};
+    m_isVirtualSurface = false;
+    ::Microsoft::ReactNative::Composition::DrawingSurfaceOwnerScope ownerScope(
+        ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Text);
+    if (surfaceSize.Width > VirtualSurfaceMinExtent || surfaceSize.Height > VirtualSurfaceMinExtent) {
+      winrt::com_ptr<::Microsoft::ReactNative::Composition::ICompositionVirtualDrawingSurfaceFactory> factory;
+      if (m_compContext.try_as(factory)) {
+        m_drawingSurface = factory->CreateVirtualDrawingSurfaceBrush(surfaceSize);
+        m_isVirtualSurface = true;
+        m_keptRect = {};
+      }
+    }
+
+    if (!m_drawingSurface) {
+      m_drawingSurface = m_compContext.CreateDrawingSurfaceBrush(
+          surfaceSize,
+          winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+          winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
+    }
+    updateViewportSubscription();
 
     auto rc = getClientRect();
     winrt::check_hresult(m_textServices->OnTxInPlaceActivate(&rc));
@@ -1677,8 +1770,78 @@ winrt::com_ptr<::IDWriteTextLayout> WindowsTextInputComponentView::CreatePlaceho
   return textLayout;
 }
 
+RECT WindowsTextInputComponentView::SurfaceRect() const noexcept {
+  return {0, 0, static_cast<LONG>(m_imgWidth), static_cast<LONG>(m_imgHeight)};
+}
+
+POINT WindowsTextInputComponentView::GetScrollPosition() const noexcept {
+  LONG hMin, hMax, hPos, hPage;
+  LONG vMin, vMax, vPos, vPage;
+  BOOL hEnabled, vEnabled;
+  if (!m_textServices || FAILED(m_textServices->TxGetHScroll(&hMin, &hMax, &hPos, &hPage, &hEnabled)) ||
+      FAILED(m_textServices->TxGetVScroll(&vMin, &vMax, &vPos, &vPage, &vEnabled))) {
+    return {};
+  }
+
+  return {hPos, vPos};
+}
+
+bool WindowsTextInputComponentView::IsTextEmpty() const noexcept {
+  LRESULT length = 0;
+  if (!m_textServices || FAILED(m_textServices->TxSendMessage(WM_GETTEXTLENGTH, 0, 0, &length))) {
+    return true;
+  }
+
+  return length == 0;
+}
+
+void WindowsTextInputComponentView::InvalidateText(const RECT *invalidRect) noexcept {
+  if (!invalidRect) {
+    m_needsRedraw = true;
+  } else {
+    // RichEdit reports rects relative to the rect it was last drawn into.  Lines are repainted across the full width
+    // of the surface, which costs little more than the exact rect and covers glyphs overhanging it.
+    RECT rect = *invalidRect;
+    OffsetRect(&rect, -m_drawOrigin.x, -m_drawOrigin.y);
+    rect.left = 0;
+    rect.right = static_cast<LONG>(m_imgWidth);
+    UnionRect(&m_invalidRect, &m_invalidRect, &rect);
+  }
+
+  ScheduleDraw();
+}
+
+void WindowsTextInputComponentView::OnViewChanged() noexcept {
+  // Scrolling the text moves all of it, without invalidating any rect
+  const auto scrollPosition = GetScrollPosition();
+  if (scrollPosition.x != m_drawnScrollPosition.x || scrollPosition.y != m_drawnScrollPosition.y) {
+    m_needsRedraw = true;
+  }
+
+  ScheduleDraw();
+}
+
+void WindowsTextInputComponentView::ScheduleDraw() noexcept {
+  // All invalidations until the UI thread is idle again, such as those of one keystroke, are drawn at once
+  if (m_drawScheduled) {
+    return;
+  }
+
+  m_drawScheduled = true;
+  m_reactContext.UIDispatcher().Post([wkThis = get_weak()]() {
+    if (auto strongThis = wkThis.get()) {
+      strongThis->m_drawScheduled = false;
+      strongThis->DrawPendingText();
+    }
+  });
+}
+
 void WindowsTextInputComponentView::DrawText() noexcept {
   m_needsRedraw = true;
+  DrawPendingText();
+}
+
+void WindowsTextInputComponentView::DrawPendingText() noexcept {
   if (m_cDrawBlock || theme()->IsEmpty() || !m_textServices) {
     return;
   }
@@ -1689,93 +1852,206 @@ void WindowsTextInputComponentView::DrawText() noexcept {
   if (!m_drawingSurface || isZeroSized)
     return;
 
-  POINT offset;
-
   assert(m_reactContext.UIDispatcher().HasThreadAccess());
 
+  UpdateKeptRect();
+
+  // The placeholder is not part of RichEdit's invalidations, so the whole surface is drawn while it shows or hides.
+  // Inputs showing the placeholder are empty, so this is cheap.
+  const bool showPlaceholder = !windowsTextInputProps().placeholder.empty() && IsTextEmpty();
+  if (showPlaceholder || m_drawnPlaceholder) {
+    m_needsRedraw = true;
+  }
+
+  const auto surfaceRect = SurfaceRect();
+  RECT updateRect = m_needsRedraw ? surfaceRect : m_invalidRect;
+  // Tiles of a virtual surface away from the viewport are not drawn, they are drawn once they are near the viewport
+  IntersectRect(&updateRect, &updateRect, m_isVirtualSurface ? &m_keptRect : &surfaceRect);
+  m_needsRedraw = false;
+  m_invalidRect = {};
+  if (IsRectEmpty(&updateRect)) {
+    return;
+  }
+
   m_drawing = true;
-  {
+  if (auto surfaceUpdate =
+          m_drawingSurface.try_as<::Microsoft::ReactNative::Composition::ICompositionDrawingSurfaceUpdate>()) {
+    winrt::com_ptr<ID2D1DeviceContext> d2dDeviceContext;
+    const auto dpi = m_layoutMetrics.pointScaleFactor * 96.0f;
+    if (SUCCEEDED(surfaceUpdate->BeginDrawUpdate(updateRect, d2dDeviceContext.put(), dpi, dpi))) {
+      DrawTextContent(*d2dDeviceContext, {0, 0}, updateRect, showPlaceholder);
+      m_drawingSurface.as<::Microsoft::ReactNative::Composition::Experimental::ICompositionDrawingSurfaceInterop>()
+          ->EndDraw();
+    }
+  } else {
+    POINT offset;
     ::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface autoDraw(
         m_drawingSurface, m_layoutMetrics.pointScaleFactor, &offset);
     if (auto d2dDeviceContext = autoDraw.GetRenderTarget()) {
-      d2dDeviceContext->Clear(D2D1::ColorF(D2D1::ColorF::Black, 0.0f));
-      assert(d2dDeviceContext->GetUnitMode() == D2D1_UNIT_MODE_DIPS);
-
-      RECTL rc{
-          static_cast<LONG>(offset.x),
-          static_cast<LONG>(offset.y),
-          static_cast<LONG>(offset.x) + static_cast<LONG>(m_imgWidth),
-          static_cast<LONG>(offset.y) + static_cast<LONG>(m_imgHeight)};
+      RECT fullRect = surfaceRect;
+      OffsetRect(&fullRect, offset.x, offset.y);
+      DrawTextContent(*d2dDeviceContext, offset, fullRect, showPlaceholder);
+    }
+  }
+  m_drawing = false;
+  m_drawnPlaceholder = showPlaceholder;
+  m_drawnScrollPosition = GetScrollPosition();
+}
 
-      RECT rcClient{
-          static_cast<LONG>(offset.x),
-          static_cast<LONG>(offset.y),
-          static_cast<LONG>(offset.x) + static_cast<LONG>(m_imgWidth),
-          static_cast<LONG>(offset.y) + static_cast<LONG>(m_imgHeight)};
+void WindowsTextInputComponentView::DrawTextContent(
+    ID2D1DeviceContext &d2dDeviceContext,
+    POINT offset,
+    const RECT &updateRect,
+    bool showPlaceholder) noexcept {
+  // Drawing into part of the surface, the device context is clipped to the update rect
+  d2dDeviceContext.Clear(D2D1::ColorF(D2D1::ColorF::Black, 0.0f));
+  assert(d2dDeviceContext.GetUnitMode() == D2D1_UNIT_MODE_DIPS);
+
+  RECTL rc{
+      static_cast<LONG>(offset.x),
+      static_cast<LONG>(offset.y),
+      static_cast<LONG>(offset.x) + static_cast<LONG>(m_imgWidth),
+      static_cast<LONG>(offset.y) + static_cast<LONG>(m_imgHeight)};
+
+  RECT rcClient{
+      static_cast<LONG>(offset.x),
+      static_cast<LONG>(offset.y),
+      static_cast<LONG>(offset.x) + static_cast<LONG>(m_imgWidth),
+      static_cast<LONG>(offset.y) + static_cast<LONG>(m_imgHeight)};
 
-      {
-        m_cDrawBlock++; // Dont use AutoDrawBlock as we are already in draw, and dont need to draw again.
-        winrt::check_hresult(m_textServices->OnTxInPlaceActivate(&rcClient));
-        m_cDrawBlock--;
-      }
+  {
+    m_cDrawBlock++; // Dont use AutoDrawBlock as we are already in draw, and dont need to draw again.
+    winrt::check_hresult(m_textServices->OnTxInPlaceActivate(&rcClient));
+    m_cDrawBlock--;
+  }
+  m_drawOrigin = offset;
 
-      const auto &props = windowsTextInputProps();
+  const auto &props = windowsTextInputProps();
+  if (facebook::react::isColorMeaningful(props.backgroundColor)) {
+    auto backgroundColor = theme()->D2DColor(*props.backgroundColor);
+    winrt::com_ptr<ID2D1SolidColorBrush> backgroundBrush;
+    winrt::check_hresult(d2dDeviceContext.CreateSolidColorBrush(backgroundColor, backgroundBrush.put()));
+    const D2D1_RECT_F fillRect = {
+        static_cast<float>(rcClient.left) / m_layoutMetrics.pointScaleFactor,
+        static_cast<float>(rcClient.top) / m_layoutMetrics.pointScaleFactor,
+        static_cast<float>(rcClient.right) / m_layoutMetrics.pointScaleFactor,
+        static_cast<float>(rcClient.bottom) / m_layoutMetrics.pointScaleFactor};
+    d2dDeviceContext.FillRectangle(fillRect, backgroundBrush.get());
+  }
+
+  // RichEdit only renders the lines intersecting the update rect
+  RECT rcUpdate = updateRect;
+  auto hrDraw = m_textServices->TxDrawD2D(&d2dDeviceContext, &rc, &rcUpdate, TXTVIEW_ACTIVE);
+  winrt::check_hresult(hrDraw);
+
+  // draw placeholder text if needed
+  if (showPlaceholder) {
+    // set brush color
+    winrt::com_ptr<ID2D1SolidColorBrush> brush;
+    if (props.placeholderTextColor) {
+      auto color = theme()->D2DColor(*props.placeholderTextColor);
+      winrt::check_hresult(d2dDeviceContext.CreateSolidColorBrush(color, brush.put()));
+    } else {
+      // Use theme-aware placeholder color based on focus state and background
+      // Color selection follows Windows 11 design system semantic colors:
+      // - High contrast: System GrayText for accessibility
+      // - Light backgrounds: Darker grays for better contrast
+      // - Dark backgrounds: Lighter grays for readability
+      winrt::Windows::UI::Color backgroundColor = {};
       if (facebook::react::isColorMeaningful(props.backgroundColor)) {
-        auto backgroundColor = theme()->D2DColor(*props.backgroundColor);
-        winrt::com_ptr<ID2D1SolidColorBrush> backgroundBrush;
-        winrt::check_hresult(d2dDeviceContext->CreateSolidColorBrush(backgroundColor, backgroundBrush.put()));
-        const D2D1_RECT_F fillRect = {
-            static_cast<float>(rcClient.left) / m_layoutMetrics.pointScaleFactor,
-            static_cast<float>(rcClient.top) / m_layoutMetrics.pointScaleFactor,
-            static_cast<float>(rcClient.right) / m_layoutMetrics.pointScaleFactor,
-            static_cast<float>(rcClient.bottom) / m_layoutMetrics.pointScaleFactor};
-        d2dDeviceContext->FillRectangle(fillRect, backgroundBrush.get());
+        auto bgColor = (*props.backgroundColor).AsWindowsColor();
+        backgroundColor = bgColor;
       }
 
-      // TODO keep track of proper invalid rect
-      auto hrDraw = m_textServices->TxDrawD2D(d2dDeviceContext, &rc, nullptr, TXTVIEW_ACTIVE);
-      winrt::check_hresult(hrDraw);
-
-      // draw placeholder text if needed
-      if (!props.placeholder.empty() && GetTextFromRichEdit().empty()) {
-        // set brush color
-        winrt::com_ptr<ID2D1SolidColorBrush> brush;
-        if (props.placeholderTextColor) {
-          auto color = theme()->D2DColor(*props.placeholderTextColor);
-          winrt::check_hresult(d2dDeviceContext->CreateSolidColorBrush(color, brush.put()));
-        } else {
-          // Use theme-aware placeholder color based on focus state and background
-          // Color selection follows Windows 11 design system semantic colors:
-          // - High contrast: System GrayText for accessibility
-          // - Light backgrounds: Darker grays for better contrast
-          // - Dark backgrounds: Lighter grays for readability
-          winrt::Windows::UI::Color backgroundColor = {};
-          if (facebook::react::isColorMeaningful(props.backgroundColor)) {
-            auto bgColor = (*props.backgroundColor).AsWindowsColor();
-            backgroundColor = bgColor;
-          }
-
-          auto placeholderColor = facebook::react::GetTextInputPlaceholderColor(m_hasFocus, backgroundColor);
-          auto d2dColor = theme()->D2DColor(*placeholderColor);
-          winrt::check_hresult(d2dDeviceContext->CreateSolidColorBrush(d2dColor, brush.put()));
-        }
+      auto placeholderColor = facebook::react::GetTextInputPlaceholderColor(m_hasFocus, backgroundColor);
+      auto d2dColor = theme()->D2DColor(*placeholderColor);
+      winrt::check_hresult(d2dDeviceContext.CreateSolidColorBrush(d2dColor, brush.put()));
+    }
 
-        // Create placeholder text layout
-        winrt::com_ptr<::IDWriteTextLayout> textLayout = CreatePlaceholderLayout();
-
-        // draw text
-        d2dDeviceContext->DrawTextLayout(
-            D2D1::Point2F(
-                static_cast<FLOAT>((offset.x + m_layoutMetrics.contentInsets.left) / m_layoutMetrics.pointScaleFactor),
-                static_cast<FLOAT>((offset.y + m_layoutMetrics.contentInsets.top) / m_layoutMetrics.pointScaleFactor)),
-            textLayout.get(),
-            brush.get(),
-            D2D1_DRAW_TEXT_OPTIONS_ENABLE_COLOR_FONT);
-      }
+    // Create placeholder text layout
+    winrt::com_ptr<::IDWriteTextLayout> textLayout = CreatePlaceholderLayout();
+
+    // draw text
+    d2dDeviceContext.DrawTextLayout(
+        D2D1::Point2F(
+            static_cast<FLOAT>((offset.x + m_layoutMetrics.contentInsets.left) / m_layoutMetrics.pointScaleFactor),
+            static_cast<FLOAT>((offset.y + m_layoutMetrics.contentInsets.top) / m_layoutMetrics.pointScaleFactor)),
+        textLayout.get(),
+        brush.get(),
+        D2D1_DRAW_TEXT_OPTIONS_ENABLE_COLOR_FONT);
+  }
+}
+
+RECT WindowsTextInputComponentView::VisibleSurfaceRect() noexcept {
+  const auto clientRect = getClientRect();
+  RECT visibleRect = clientRect;
+  for (auto view = Parent(); view; view = view.Parent()) {
+    if (auto scrollView = view.try_as<ScrollViewComponentView>()) {
+      const auto viewportRect = scrollView->getClientRect();
+      IntersectRect(&visibleRect, &visibleRect, &viewportRect);
+    }
+  }
+  if (auto root = rootComponentView()) {
+    const auto rootRect = root->getClientRect();
+    IntersectRect(&visibleRect, &visibleRect, &rootRect);
+  }
+
+  OffsetRect(&visibleRect, -clientRect.left, -clientRect.top);
+  return visibleRect;
+}
+
+void WindowsTextInputComponentView::UpdateKeptRect() noexcept {
+  if (!m_isVirtualSurface) {
+    return;
+  }
+
+  // Tiles next to the viewport are kept as well, so that scrolling does not uncover tiles before they are drawn
+  RECT keptRect{};
+  const auto visibleRect = VisibleSurfaceRect();
+  if (!IsRectEmpty(&visibleRect)) {
+    keptRect = {
+        std::max(0L, (visibleRect.left / VirtualSurfaceTileSize - 1) * VirtualSurfaceTileSize),
+        std::max(0L, (visibleRect.top / VirtualSurfaceTileSize - 1) * VirtualSurfaceTileSize),
+        ((visibleRect.right - 1) / VirtualSurfaceTileSize + 2) * VirtualSurfaceTileSize,
+        ((visibleRect.bottom - 1) / VirtualSurfaceTileSize + 2) * VirtualSurfaceTileSize};
+    const auto surfaceRect = SurfaceRect();
+    IntersectRect(&keptRect, &keptRect, &surfaceRect);
+  }
+  if (EqualRect(&keptRect, &m_keptRect)) {
+    return;
+  }
+
+  // Draw the newly kept area.  When it is not a rect, all of the kept area is drawn again.
+  RECT exposedRect;
+  if (SubtractRect(&exposedRect, &keptRect, &m_keptRect)) {
+    UnionRect(&m_invalidRect, &m_invalidRect, &exposedRect);
+  }
+  m_keptRect = keptRect;
+
+  // Discard the area that moved away from the viewport before drawing the new one, to limit the peak memory use
+  winrt::com_ptr<::Microsoft::ReactNative::Composition::ICompositionVirtualDrawingSurface> virtualSurface;
+  m_drawingSurface.as(virtualSurface);
+  virtualSurface->Trim(&m_keptRect, IsRectEmpty(&m_keptRect) ? 0 : 1);
+}
+
+void WindowsTextInputComponentView::updateViewportSubscription() noexcept {
+  m_viewportScrollRevokers.clear();
+  if (!m_isVirtualSurface || !isMounted()) {
+    return;
+  }
+
+  for (auto view = Parent(); view; view = view.Parent()) {
+    if (auto scrollView = view.try_as<ScrollViewComponentView>()) {
+      m_viewportScrollRevokers.push_back(scrollView->ScrollPositionChanged(
+          [wkThis = get_weak()](
+              winrt::IInspectable const & /*sender*/,
+              winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const & /*args*/) {
+            if (auto strongThis = wkThis.get()) {
+              strongThis->DrawPendingText();
+            }
+          }));
     }
   }
-  m_drawing = false;
-  m_needsRedraw = false;
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IVisual
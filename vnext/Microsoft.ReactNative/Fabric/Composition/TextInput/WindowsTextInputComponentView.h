@@ -68,6 +68,8 @@ struct WindowsTextInputComponentView
   void OnCharacterReceived(const winrt::Microsoft::ReactNative::Composition::Input::CharacterReceivedRoutedEventArgs
                                &args) noexcept override;
   void onMounted() noexcept override;
+  void onUnmounted() noexcept override;
+  void prepareForRecycle() noexcept override;
 
   std::optional<std::string> getAccessiblityValue() noexcept override;
   void setAcccessiblityValue(std::string &&value) noexcept override;
@@ -90,15 +92,32 @@ struct WindowsTextInputComponentView
     WindowsTextInputComponentView &m_view;
   };
 
-  facebook::react::AttributedString getAttributedString() const;
+  facebook::react::AttributedString getAttributedString(const std::string &text) const;
   void ensureDrawingSurface() noexcept;
   void DrawText() noexcept;
+  void DrawPendingText() noexcept;
+  void DrawTextContent(
+      ID2D1DeviceContext &d2dDeviceContext,
+      POINT offset,
+      const RECT &updateRect,
+      bool showPlaceholder) noexcept;
+  void InvalidateText(const RECT *invalidRect) noexcept;
+  void OnViewChanged() noexcept;
+  void ScheduleDraw() noexcept;
+  RECT SurfaceRect() const noexcept;
+  RECT VisibleSurfaceRect() noexcept;
+  void UpdateKeptRect() noexcept;
+  void updateViewportSubscription() noexcept;
+  POINT GetScrollPosition() const noexcept;
+  bool IsTextEmpty() const noexcept;
   void ShowCaret(bool show) noexcept;
   winrt::com_ptr<::IDWriteTextLayout> CreatePlaceholderLayout();
   void UpdateCharFormat() noexcept;
   void UpdateParaFormat() noexcept;
   void UpdateText(const std::string &str) noexcept;
   void OnTextUpdated() noexcept;
+  void ScheduleStateUpdate() noexcept;
+  void UpdateStateIfNeeded() noexcept;
   void EmitOnScrollEvent() noexcept;
   void OnSelectionChanged(LONG start, LONG end) noexcept;
   std::pair<float, float> GetContentSize() const noexcept;
@@ -132,14 +151,37 @@ struct WindowsTextInputComponentView
   winrt::com_ptr<ITextServices2> m_textServices;
   unsigned int m_imgWidth{0}, m_imgHeight{0};
   std::shared_ptr<facebook::react::WindowsTextInputShadowNode::ConcreteState const> m_state;
+  // Text as edited natively, which the shadow node reads when measuring
+  std::shared_ptr<facebook::react::WindowsTextInputContent> m_content{
+      std::make_shared<facebook::react::WindowsTextInputContent>()};
+  // Content size when the state was last updated
+  std::pair<float, float> m_stateContentSize{};
+  bool m_stateUpdateScheduled{false};
   float m_fontSizeMultiplier{1.0};
   int64_t m_mostRecentEventCount{0};
   int m_nativeEventCount{0};
   bool m_comingFromJS{false};
   bool m_comingFromState{false};
   int m_cDrawBlock{0};
+  // Whether all of the surface needs to be redrawn, otherwise only m_invalidRect is
   bool m_needsRedraw{false};
   bool m_drawing{false};
+  bool m_drawScheduled{false};
+  // Area invalidated by RichEdit since the last draw, in pixels of the surface
+  RECT m_invalidRect{};
+  // Origin of the rect RichEdit was last drawn into
+  POINT m_drawOrigin{};
+  POINT m_drawnScrollPosition{};
+  bool m_drawnPlaceholder{false};
+
+  // Inputs larger than this, in pixels, use a virtual surface of which only the area near the viewport is drawn
+  static constexpr float VirtualSurfaceMinExtent = 2048.0f;
+  static constexpr LONG VirtualSurfaceTileSize = 512;
+  bool m_isVirtualSurface{false};
+  // The area of the virtual surface that is drawn, the rest has been trimmed from the surface
+  RECT m_keptRect{};
+  std::vector<winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual::ScrollPositionChanged_revoker>
+      m_viewportScrollRevokers;
   bool m_hasFocus{false};
   bool m_clearTextOnSubmit{false};
   bool m_multiline{false};
@@ -110,7 +110,7 @@ void WindowsTextInputEventEmitter::onPressOut(GestureResponderEvent event) const
 }
 
 void WindowsTextInputEventEmitter::onScroll(facebook::react::Point offset) const {
-  dispatchEvent("textInputScroll", [offset = std::move(offset)](jsi::Runtime &runtime) {
+  dispatchUniqueEvent("textInputScroll", [offset = std::move(offset)](jsi::Runtime &runtime) {
     auto payload = jsi::Object(runtime);
     {
       auto contentOffsetObj = jsi::Object(runtime);
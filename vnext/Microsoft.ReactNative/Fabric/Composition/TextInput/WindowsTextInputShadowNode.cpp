@@ -103,7 +103,7 @@ void WindowsTextInputShadowNode::updateStateIfNeeded(const LayoutContext &layout
 
   // If props event counter is less than what we already have in state, skip it
   const auto &props = BaseShadowNode::getConcreteProps();
-  if (props.mostRecentEventCount < stateData.mostRecentEventCount) {
+  if (props.mostRecentEventCount < stateData.getMostRecentEventCount()) {
     return;
   }
 
@@ -127,8 +127,12 @@ void WindowsTextInputShadowNode::updateStateIfNeeded(const LayoutContext &layout
   // so no changes are applied There's no way to prevent a state update from
   // flowing to Java, so we just ensure it's a noop in those cases.
 
-  setStateData(
-      WindowsTextInputState{AttributedStringBox(newAttributedString), reactTreeAttributedString, {}, newEventCount});
+  auto newStateData =
+      WindowsTextInputState{AttributedStringBox(newAttributedString), reactTreeAttributedString, {}, newEventCount};
+  // Keep reading the natively edited content, from its next edit on
+  newStateData.content = stateData.content;
+  newStateData.contentVersion = stateData.content ? stateData.content->getVersion() : 0;
+  setStateData(std::move(newStateData));
 }
 
 AttributedString WindowsTextInputShadowNode::getAttributedString(const LayoutContext &layoutContext) const {
@@ -180,7 +184,9 @@ AttributedString WindowsTextInputShadowNode::getMostRecentAttributedString(const
   bool treeAttributedStringChanged =
       !state.reactTreeAttributedString.compareTextAttributesWithoutFrame(reactTreeAttributedString);
 
-  return (!treeAttributedStringChanged ? state.attributedStringBox.getValue() : reactTreeAttributedString);
+  // The view does not update the state on edits that keep the size of the input, so the text is read from the
+  // natively edited content
+  return (!treeAttributedStringChanged ? state.getMostRecentAttributedString() : reactTreeAttributedString);
 }
 
 AttributedString WindowsTextInputShadowNode::getPlaceholderAttributedString(const LayoutContext &layoutContext) const {
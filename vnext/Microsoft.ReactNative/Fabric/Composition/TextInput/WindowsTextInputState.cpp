@@ -16,4 +16,42 @@ folly::dynamic WindowsTextInputState::getDynamic() const {
   return folly::dynamic::object(); // windows
 }
 
+// [windows
+void WindowsTextInputContent::update(AttributedString attributedString, int64_t mostRecentEventCount) {
+  std::scoped_lock lock{mutex_};
+  attributedString_ = std::move(attributedString);
+  mostRecentEventCount_ = mostRecentEventCount;
+  version_++;
+}
+
+AttributedString WindowsTextInputContent::getAttributedString() const {
+  std::scoped_lock lock{mutex_};
+  return attributedString_;
+}
+
+int64_t WindowsTextInputContent::getMostRecentEventCount() const {
+  std::scoped_lock lock{mutex_};
+  return mostRecentEventCount_;
+}
+
+int64_t WindowsTextInputContent::getVersion() const {
+  std::scoped_lock lock{mutex_};
+  return version_;
+}
+
+AttributedString WindowsTextInputState::getMostRecentAttributedString() const {
+  if (content && content->getVersion() > contentVersion) {
+    return content->getAttributedString();
+  }
+  return attributedStringBox.getValue();
+}
+
+int64_t WindowsTextInputState::getMostRecentEventCount() const {
+  if (content && content->getVersion() > contentVersion) {
+    return std::max(mostRecentEventCount, content->getMostRecentEventCount());
+  }
+  return mostRecentEventCount;
+}
+// windows]
+
 } // namespace facebook::react
@@ -15,8 +15,42 @@
 #include <react/renderer/mapbuffer/MapBuffer.h>
 #include <react/renderer/mapbuffer/MapBufferBuilder.h> // [windows]
 
+// [windows
+#include <memory>
+#include <mutex>
+// windows]
+
 namespace facebook::react {
 
+// [windows
+/*
+ * Content of a <TextInput> as edited natively, shared by the component view
+ * and the states of its shadow node.
+ * The view updates it on every edit, and the shadow node reads it when
+ * measuring, so edits that do not change the size of the input do not need a
+ * state update, and the commit and layout pass that comes with it.
+ */
+class WindowsTextInputContent final {
+ public:
+  void update(AttributedString attributedString, int64_t mostRecentEventCount);
+
+  AttributedString getAttributedString() const;
+
+  int64_t getMostRecentEventCount() const;
+
+  /*
+   * Incremented by every update.
+   */
+  int64_t getVersion() const;
+
+ private:
+  mutable std::mutex mutex_;
+  AttributedString attributedString_;
+  int64_t mostRecentEventCount_{0};
+  int64_t version_{0};
+};
+// windows]
+
 /*
  * State for <TextInput> component.
  */
@@ -39,11 +73,23 @@ class WindowsTextInputState final {
         reactTreeAttributedString(previousState.reactTreeAttributedString),
         paragraphAttributes(previousState.paragraphAttributes),
         mostRecentEventCount(data.getDefault("mostRecentEventCount", previousState.mostRecentEventCount).getInt()),
-        cachedAttributedStringId(data.getDefault("opaqueCacheId", previousState.cachedAttributedStringId).getInt()) {}
+        cachedAttributedStringId(data.getDefault("opaqueCacheId", previousState.cachedAttributedStringId).getInt()),
+        content(previousState.content), // [windows]
+        contentVersion(previousState.contentVersion) {} // [windows]
 
   folly::dynamic getDynamic() const;
   MapBuffer getMapBuffer() const;
 
+  // [windows
+  /*
+   * Returns the content edited natively after this state was created if
+   * there is any, and `attributedStringBox` otherwise.
+   */
+  AttributedString getMostRecentAttributedString() const;
+
+  int64_t getMostRecentEventCount() const;
+  // windows]
+
   /*
    * All content of <TextInput> component.
    */
@@ -71,6 +117,18 @@ class WindowsTextInputState final {
    * AttributedString for measurement purposes only.
    */
   int64_t cachedAttributedStringId{0};
+
+  // [windows
+  /*
+   * Content as edited natively, set by the component view.
+   */
+  std::shared_ptr<WindowsTextInputContent> content{};
+
+  /*
+   * Version of `content` that `attributedStringBox` is up to date with.
+   */
+  int64_t contentVersion{0};
+  // windows]
 };
 
 } // namespace facebook::react
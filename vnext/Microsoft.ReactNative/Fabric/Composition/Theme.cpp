@@ -13,10 +13,72 @@
 #include "ReactPropertyBag.h"
 #include "winrt/Microsoft.ReactNative.Composition.h"
 
+#include <deque>
+#include <mutex>
+#include <string_view>
+
 #include "Composition.Theme.g.cpp"
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
+// Platform color names used by any theme, interned so that themes can key their caches by a small integer instead of
+// hashing and comparing strings.  Names are never removed, apps only use a bounded set of platform colors.
+class PlatformColorTable {
+ public:
+  static PlatformColorTable &Instance() noexcept {
+    static PlatformColorTable s_instance;
+    return s_instance;
+  }
+
+  uint32_t Intern(std::string_view name) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (auto it = m_ids.find(name); it != m_ids.end()) {
+      return it->second;
+    }
+    return AddLocked(std::string{name});
+  }
+
+  uint32_t Intern(const winrt::hstring &name) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (auto it = m_wideIds.find(std::wstring_view{name}); it != m_wideIds.end()) {
+      return it->second;
+    }
+
+    auto narrowName = winrt::to_string(name);
+    auto it = m_ids.find(narrowName);
+    auto id = it != m_ids.end() ? it->second : AddLocked(std::move(narrowName));
+    m_wideIds.emplace(std::wstring{name}, id);
+    return id;
+  }
+
+  // Names are stored in a deque, so the returned reference stays valid as more names are added
+  const std::string &Name(uint32_t id) noexcept {
+    std::scoped_lock lock{m_mutex};
+    return m_names[id];
+  }
+
+ private:
+  template <typename TChar>
+  struct TransparentHash {
+    using is_transparent = void;
+    size_t operator()(std::basic_string_view<TChar> value) const noexcept {
+      return std::hash<std::basic_string_view<TChar>>{}(value);
+    }
+  };
+
+  uint32_t AddLocked(std::string &&name) noexcept {
+    auto id = static_cast<uint32_t>(m_names.size());
+    m_names.push_back(name);
+    m_ids.emplace(std::move(name), id);
+    return id;
+  }
+
+  std::mutex m_mutex;
+  std::deque<std::string> m_names;
+  std::unordered_map<std::string, uint32_t, TransparentHash<char>, std::equal_to<>> m_ids;
+  std::unordered_map<std::wstring, uint32_t, TransparentHash<wchar_t>, std::equal_to<>> m_wideIds;
+};
+
 struct CustomResourceResult : CustomResourceResultT<CustomResourceResult> {
   winrt::Windows::Foundation::IInspectable Resource() const noexcept {
     return m_resource;
@@ -43,13 +105,14 @@ Theme::Theme(
   m_compositionContext =
       winrt::Microsoft::ReactNative::Composition::implementation::CompositionUIService::GetCompositionContext(
           reactContext.Properties().Handle());
+  m_sharedResources = GetSharedResources(reactContext, m_compositionContext);
 
   if (customResourceLoader) {
     m_resourceChangedRevoker = customResourceLoader.ResourcesChanged(
         winrt::auto_revoke,
         [this](
             winrt::Windows::Foundation::IInspectable const & /* sender */,
-            winrt::Windows::Foundation::IInspectable const & /* args */) { ClearCacheAndRaiseChangedEvent(); });
+            winrt::Windows::Foundation::IInspectable const & /* args */) { UpdateCacheAndRaiseChangedEvent(); });
   }
 
   // UISettings will notify us on a background thread regardless of where we construct it or register for events.
@@ -59,7 +122,7 @@ Theme::Theme(
         if (auto pThis = wkThis.get()) {
           reactContext.UIDispatcher().Post([wkThis]() noexcept {
             if (auto pThis = wkThis.get()) {
-              pThis->ClearCacheAndRaiseChangedEvent();
+              pThis->UpdateCacheAndRaiseChangedEvent();
             }
           });
         }
@@ -70,28 +133,43 @@ Theme::Theme(
       m_uisettings.GetColorValue(winrt::Windows::UI::ViewManagement::UIColorType::Foreground));
 }
 
-void Theme::ClearCacheAndRaiseChangedEvent() noexcept {
-  m_colorCache.clear();
-  m_platformColorBrushCache.clear();
-  m_colorBrushCache.clear();
+// Brushes of plain colors, border textures and drop shadows are keyed by resolved colors, so they stay valid across
+// theme changes.  Only the platform colors themselves, and the brushes of those that changed, need to be updated.
+void Theme::UpdateCacheAndRaiseChangedEvent() noexcept {
   m_darkTheme = ::Microsoft::ReactNative::IsColorLight(
       m_uisettings.GetColorValue(winrt::Windows::UI::ViewManagement::UIColorType::Foreground));
   m_highContrast = ::Microsoft::ReactNative::IsInHighContrastWin32();
+
+  auto previousColors = std::move(m_colorCache);
+  m_colorCache.clear();
+  for (const auto &[platformColor, previous] : previousColors) {
+    winrt::Windows::UI::Color color{};
+    auto resolved = TryGetPlatformColor(platformColor, color);
+    if (resolved != previous.first || (resolved && color != previous.second)) {
+      m_platformColorBrushCache.erase(platformColor);
+    }
+  }
+
   m_themeChangedEvent(*this, nullptr);
 }
 
 Theme::Theme() noexcept : m_emptyTheme(true) {}
 
 bool Theme::TryGetPlatformColor(winrt::hstring platformColor, winrt::Windows::UI::Color &color) noexcept {
-  return TryGetPlatformColor(winrt::to_string(platformColor), color);
+  if (m_emptyTheme)
+    return false;
+
+  return TryGetPlatformColor(PlatformColorTable::Instance().Intern(platformColor), color);
 }
 
 bool Theme::TryGetPlatformColor(const std::string &platformColor, winrt::Windows::UI::Color &color) noexcept {
-  // Future: This could take into account the system theme
-
   if (m_emptyTheme)
     return false;
 
+  return TryGetPlatformColor(PlatformColorTable::Instance().Intern(platformColor), color);
+}
+
+bool Theme::TryGetPlatformColor(PlatformColorId platformColor, winrt::Windows::UI::Color &color) noexcept {
   if (auto cachedEntry = m_colorCache.find(platformColor); cachedEntry != m_colorCache.end()) {
     if (!cachedEntry->second.first) {
       return false;
@@ -101,16 +179,23 @@ bool Theme::TryGetPlatformColor(const std::string &platformColor, winrt::Windows
     return true;
   }
 
+  auto resolved = ResolvePlatformColor(PlatformColorTable::Instance().Name(platformColor), color);
+  m_colorCache[platformColor] = std::make_pair(resolved, resolved ? color : winrt::Windows::UI::Color{});
+  return resolved;
+}
+
+bool Theme::ResolvePlatformColor(const std::string &platformColor, winrt::Windows::UI::Color &color) noexcept {
+  // Future: This could take into account the system theme
+
   if (m_customResourceLoader) {
     auto result = winrt::make<CustomResourceResult>();
     m_customResourceLoader.GetResource(
         winrt::to_hstring(platformColor), winrt::Microsoft::ReactNative::Composition::ResourceType::Color, result);
     if (!result.AlternateResourceId().empty()) {
-      return TryGetPlatformColor(winrt::to_string(result.AlternateResourceId()), color);
+      return TryGetPlatformColor(result.AlternateResourceId(), color);
     }
     if (auto resource = result.Resource()) {
       color = winrt::unbox_value<winrt::Windows::UI::Color>(resource);
-      m_colorCache[platformColor] = std::make_pair(true, color);
       return true;
     }
   }
@@ -136,19 +221,16 @@ bool Theme::TryGetPlatformColor(const std::string &platformColor, winrt::Windows
 
   if (platformColor == "AccentDark1@90" && TryGetPlatformColor("AccentDark1", color)) {
     color.A = static_cast<uint8_t>(static_cast<float>(color.A) * 0.9f);
-    m_colorCache[platformColor] = std::make_pair(true, color);
     return true;
   }
 
   if (platformColor == "AccentDark1@80" && TryGetPlatformColor("AccentDark1", color)) {
     color.A = static_cast<uint8_t>(static_cast<float>(color.A) * 0.8f);
-    m_colorCache[platformColor] = std::make_pair(true, color);
     return true;
   }
 
   if (platformColor == "Highlight@40" && TryGetPlatformColor("Highlight", color)) {
     color.A = static_cast<uint8_t>(static_cast<float>(color.A) * 0.4f);
-    m_colorCache[platformColor] = std::make_pair(true, color);
     return true;
   }
 
@@ -156,8 +238,6 @@ bool Theme::TryGetPlatformColor(const std::string &platformColor, winrt::Windows
   if (uiColor != s_uiColorTypes.end()) {
     auto uiSettings{winrt::Windows::UI::ViewManagement::UISettings()};
     color = uiSettings.GetColorValue(uiColor->second);
-    auto pair = std::make_pair(true, color);
-    m_colorCache[platformColor] = pair;
     return true;
   }
 
@@ -200,7 +280,6 @@ bool Theme::TryGetPlatformColor(const std::string &platformColor, winrt::Windows
   if (uiElement != s_uiElementTypes.end()) {
     auto uiSettings{winrt::Windows::UI::ViewManagement::UISettings()};
     color = uiSettings.UIElementColor(uiElement->second);
-    m_colorCache[platformColor] = std::make_pair(true, color);
     return true;
   }
 
@@ -403,7 +482,6 @@ bool Theme::TryGetPlatformColor(const std::string &platformColor, winrt::Windows
       } else {
         color = m_uisettings.UIElementColor(result->second.first);
       }
-      m_colorCache[platformColor] = std::make_pair(true, color);
       return true;
     }
   } else {
@@ -411,12 +489,10 @@ bool Theme::TryGetPlatformColor(const std::string &platformColor, winrt::Windows
     auto result = builtInColors.find(platformColor);
     if (result != builtInColors.end()) {
       color = result->second;
-      m_colorCache[platformColor] = std::make_pair(true, color);
       return true;
     }
   }
 
-  m_colorCache[platformColor] = std::make_pair(false, winrt::Windows::UI::Color{});
   return false;
 }
 
@@ -444,12 +520,15 @@ winrt::Windows::UI::Color Theme::PlatformColor(const std::string &platformColor)
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IBrush Theme::InternalPlatformBrush(
     winrt::hstring platformColor) noexcept {
-  return PlatformBrush(winrt::to_string(platformColor));
+  if (m_emptyTheme)
+    return nullptr;
+
+  return PlatformBrush(PlatformColorTable::Instance().Intern(platformColor));
 }
 
 winrt::Microsoft::UI::Composition::CompositionBrush Theme::PlatformBrush(winrt::hstring platformColor) noexcept {
   return winrt::Microsoft::ReactNative::Composition::Experimental::MicrosoftCompositionContextHelper::InnerBrush(
-      PlatformBrush(winrt::to_string(platformColor)));
+      InternalPlatformBrush(platformColor));
 }
 
 winrt::Microsoft::ReactNative::Composition::Experimental::IBrush Theme::PlatformBrush(
@@ -457,6 +536,11 @@ winrt::Microsoft::ReactNative::Composition::Experimental::IBrush Theme::Platform
   if (m_emptyTheme)
     return nullptr;
 
+  return PlatformBrush(PlatformColorTable::Instance().Intern(platformColor));
+}
+
+winrt::Microsoft::ReactNative::Composition::Experimental::IBrush Theme::PlatformBrush(
+    PlatformColorId platformColor) noexcept {
   if (auto cachedEntry = m_platformColorBrushCache.find(platformColor); cachedEntry != m_platformColorBrushCache.end())
     return cachedEntry->second;
 
@@ -482,13 +566,112 @@ winrt::Microsoft::ReactNative::Composition::Experimental::IBrush Theme::Brush(
     }
   }
 
+  auto &colorBrushCache = m_sharedResources->colorBrushCache;
   auto h = RGB(color.m_color.R, color.m_color.G, color.m_color.B) | (color.m_color.A << 24);
-  if (auto cachedEntry = m_colorBrushCache.find(h); cachedEntry != m_colorBrushCache.end()) {
+  if (auto cachedEntry = colorBrushCache.find(h); cachedEntry != colorBrushCache.end()) {
     return cachedEntry->second;
   }
 
   auto brush = m_compositionContext.CreateColorBrush(color.m_color);
-  m_colorBrushCache[h] = brush;
+  colorBrushCache[h] = brush;
+  return brush;
+}
+
+winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush Theme::CachedBorderTexture(
+    const std::string &key) noexcept {
+  if (m_emptyTheme)
+    return nullptr;
+
+  auto &borderTextureCache = m_sharedResources->borderTextureCache;
+  if (auto cachedEntry = borderTextureCache.find(key); cachedEntry != borderTextureCache.end()) {
+    return cachedEntry->second.get();
+  }
+  return nullptr;
+}
+
+// Drops the entries of objects that are no longer used, once the cache has doubled in size since the last prune
+template <typename TCache>
+void PruneWeakCache(TCache &cache, size_t &pruneSize, size_t minPruneSize) noexcept {
+  if (cache.size() < pruneSize) {
+    return;
+  }
+
+  for (auto it = cache.begin(); it != cache.end();) {
+    if (!it->second.get()) {
+      it = cache.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  pruneSize = std::max(minPruneSize, cache.size() * 2);
+}
+
+void Theme::CacheBorderTexture(
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush &texture) noexcept {
+  if (m_emptyTheme)
+    return;
+
+  auto &shared = *m_sharedResources;
+  shared.borderTextureCache[key] = winrt::make_weak(texture);
+  PruneWeakCache(shared.borderTextureCache, shared.borderTextureCachePruneSize, WeakCacheMinPruneSize);
+}
+
+void Theme::TrimCaches() noexcept {
+  m_platformColorBrushCache.clear();
+  if (m_emptyTheme)
+    return;
+
+  auto &shared = *m_sharedResources;
+  shared.colorBrushCache.clear();
+  shared.borderTextureCachePruneSize = 0;
+  PruneWeakCache(shared.borderTextureCache, shared.borderTextureCachePruneSize, WeakCacheMinPruneSize);
+  shared.dropShadowCachePruneSize = 0;
+  PruneWeakCache(shared.dropShadowCache, shared.dropShadowCachePruneSize, WeakCacheMinPruneSize);
+}
+
+winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow Theme::DropShadow(
+    winrt::Windows::Foundation::Numerics::float3 offset,
+    float opacity,
+    float blurRadius,
+    winrt::Windows::UI::Color color) noexcept {
+  if (m_emptyTheme)
+    return nullptr;
+
+  std::string key;
+  key.append(reinterpret_cast<const char *>(&offset), sizeof(offset));
+  key.append(reinterpret_cast<const char *>(&opacity), sizeof(opacity));
+  key.append(reinterpret_cast<const char *>(&blurRadius), sizeof(blurRadius));
+  key.append(reinterpret_cast<const char *>(&color), sizeof(color));
+
+  auto &shared = *m_sharedResources;
+  if (auto cachedEntry = shared.dropShadowCache.find(key); cachedEntry != shared.dropShadowCache.end()) {
+    if (auto shadow = cachedEntry->second.get()) {
+      return shadow;
+    }
+  }
+
+  auto shadow = m_compositionContext.CreateDropShadow();
+  shadow.Offset(offset);
+  shadow.Opacity(opacity);
+  shadow.BlurRadius(blurRadius);
+  shadow.Color(color);
+  shared.dropShadowCache[key] = winrt::make_weak(shadow);
+  PruneWeakCache(shared.dropShadowCache, shared.dropShadowCachePruneSize, WeakCacheMinPruneSize);
+  return shadow;
+}
+
+winrt::Microsoft::ReactNative::Composition::Experimental::IBrush Theme::TransparentBrush() noexcept {
+  if (m_emptyTheme)
+    return nullptr;
+
+  auto &colorBrushCache = m_sharedResources->colorBrushCache;
+  if (auto cachedEntry = colorBrushCache.find(0); cachedEntry != colorBrushCache.end()) {
+    return cachedEntry->second;
+  }
+
+  auto brush = m_compositionContext.CreateColorBrush({0, 0, 0, 0});
+  colorBrushCache[0] = brush;
   return brush;
 }
 
@@ -530,6 +713,30 @@ static const winrt::Microsoft::ReactNative::ReactPropertyId<
   return prop;
 }
 
+/*static*/ std::shared_ptr<Theme::SharedResources> Theme::GetSharedResources(
+    const winrt::Microsoft::ReactNative::ReactContext &reactContext,
+    const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compositionContext) noexcept {
+  static const winrt::Microsoft::ReactNative::ReactPropertyId<
+      winrt::Microsoft::ReactNative::ReactNonAbiValue<std::shared_ptr<SharedResources>>>
+      s_sharedResourcesPropertyId{L"ReactNative.Composition", L"ThemeSharedResources"};
+
+  auto properties = reactContext.Properties();
+  auto sharedResources = *properties.GetOrCreate(
+      s_sharedResourcesPropertyId, [&compositionContext]() -> std::shared_ptr<SharedResources> {
+        auto resources = std::make_shared<SharedResources>();
+        resources->compositionContext = compositionContext;
+        return resources;
+      });
+
+  // Resources of another composition context cannot be used, which only happens if the context is replaced
+  if (sharedResources->compositionContext != compositionContext) {
+    sharedResources = std::make_shared<SharedResources>();
+    sharedResources->compositionContext = compositionContext;
+    properties.Set(s_sharedResourcesPropertyId, sharedResources);
+  }
+  return sharedResources;
+}
+
 winrt::Microsoft::ReactNative::Composition::Theme Theme::EmptyTheme() noexcept {
   static winrt::Microsoft::ReactNative::Composition::Theme s_emptyTheme{nullptr};
   if (!s_emptyTheme) {
@@ -562,7 +769,7 @@ winrt::Microsoft::ReactNative::Composition::Theme Theme::EmptyTheme() noexcept {
 void Theme::UpdateCustomResources(
     const winrt::Microsoft::ReactNative::Composition::ICustomResourceLoader &resources) noexcept {
   m_customResourceLoader = resources;
-  ClearCacheAndRaiseChangedEvent();
+  UpdateCacheAndRaiseChangedEvent();
 }
 
 IReactPropertyNamespace ThemeNamespace() noexcept {
@@ -10,6 +10,8 @@
 #include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
 #include <winrt/Windows.UI.ViewManagement.h>
+#include <cstdint>
+#include <memory>
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
@@ -37,11 +39,33 @@ struct Theme : ThemeT<Theme, Experimental::IInternalTheme> {
   winrt::Microsoft::ReactNative::Composition::Experimental::IBrush PlatformBrush(
       const std::string &platformColor) noexcept;
   winrt::Microsoft::ReactNative::Composition::Experimental::IBrush Brush(const facebook::react::Color &color) noexcept;
+  // Fully transparent brush, for visuals that need a brush for hit testing
+  winrt::Microsoft::ReactNative::Composition::Experimental::IBrush TransparentBrush() noexcept;
+  // Drop shadows are shared by all views with the same shadow, so the returned shadow must not be modified.
+  // Like the border textures, shadows are only weakly referenced by the cache.
+  winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow DropShadow(
+      winrt::Windows::Foundation::Numerics::float3 offset,
+      float opacity,
+      float blurRadius,
+      winrt::Windows::UI::Color color) noexcept;
   winrt::Windows::UI::Color Color(const facebook::react::Color &color) noexcept;
 
   D2D1::ColorF D2DColor(const facebook::react::Color &color) noexcept;
   D2D1::ColorF D2DPlatformColor(const std::string &platformColor) noexcept;
 
+  // Border layer textures are shared by all views whose borders rasterize to the same pixels, see BorderPrimitive.
+  // The cache only holds weak references, so textures are released once no view uses them.
+  winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush CachedBorderTexture(
+      const std::string &key) noexcept;
+  void CacheBorderTexture(
+      const std::string &key,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush &texture) noexcept;
+
+  // Drops the cached brushes, which are created again on demand, and the released textures and shadows.  Called on
+  // memory pressure, see Mso::React::CacheBudgetManager.  The resources shared with the other themes of the composition
+  // context are trimmed for all of them.
+  void TrimCaches() noexcept;
+
   static winrt::Microsoft::ReactNative::Composition::Theme FromContext(
       const winrt::Microsoft::ReactNative::ReactContext &context) noexcept;
   static winrt::Microsoft::ReactNative::Composition::Theme EmptyTheme() noexcept;
@@ -53,21 +77,55 @@ struct Theme : ThemeT<Theme, Experimental::IInternalTheme> {
       const winrt::Microsoft::ReactNative::Composition::ICustomResourceLoader &resources) noexcept;
 
  private:
+  static constexpr size_t WeakCacheMinPruneSize = 64;
+
+  // Handle of a platform color name, interned once per process, see PlatformColorTable
+  using PlatformColorId = uint32_t;
+
+  // Brushes of plain colors, border textures and drop shadows only depend on the composition context, not on the theme
+  // resources.  They are shared by all the themes created for the same composition context, like the default theme and
+  // those of islands and modals with their own resources, so that secondary windows do not create them again.
+  // Themes are only used on the UI thread, which the composition context belongs to.
+  struct SharedResources {
+    winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext compositionContext{nullptr};
+    std::unordered_map<DWORD, winrt::Microsoft::ReactNative::Composition::Experimental::IBrush> colorBrushCache;
+    std::unordered_map<
+        std::string,
+        winrt::weak_ref<winrt::Microsoft::ReactNative::Composition::Experimental::IDrawingSurfaceBrush>>
+        borderTextureCache;
+    size_t borderTextureCachePruneSize{WeakCacheMinPruneSize};
+    std::unordered_map<
+        std::string,
+        winrt::weak_ref<winrt::Microsoft::ReactNative::Composition::Experimental::IDropShadow>>
+        dropShadowCache;
+    size_t dropShadowCachePruneSize{WeakCacheMinPruneSize};
+  };
+
+  static std::shared_ptr<SharedResources> GetSharedResources(
+      const winrt::Microsoft::ReactNative::ReactContext &reactContext,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compositionContext) noexcept;
+
   void UpdateCustomResources(
       const winrt::Microsoft::ReactNative::Composition::ICustomResourceLoader &resources) noexcept;
   bool TryGetPlatformColor(const std::string &platformColor, winrt::Windows::UI::Color &color) noexcept;
-  void ClearCacheAndRaiseChangedEvent() noexcept;
+  bool TryGetPlatformColor(PlatformColorId platformColor, winrt::Windows::UI::Color &color) noexcept;
+  bool ResolvePlatformColor(const std::string &platformColor, winrt::Windows::UI::Color &color) noexcept;
+  winrt::Microsoft::ReactNative::Composition::Experimental::IBrush PlatformBrush(
+      PlatformColorId platformColor) noexcept;
+  // Re-resolves the platform colors in use, and drops the brushes of the colors that changed
+  void UpdateCacheAndRaiseChangedEvent() noexcept;
 
   winrt::event<winrt::Windows::Foundation::EventHandler<winrt::Windows::Foundation::IInspectable>> m_themeChangedEvent;
   bool m_emptyTheme{false};
   bool m_darkTheme{false};
   bool m_highContrast{false};
-  std::unordered_map<std::string, std::pair<bool, winrt::Windows::UI::Color>> m_colorCache;
+  std::unordered_map<PlatformColorId, std::pair<bool, winrt::Windows::UI::Color>> m_colorCache;
   winrt::Windows::UI::ViewManagement::UISettings m_uisettings;
   winrt::Windows::UI::ViewManagement::UISettings::ColorValuesChanged_revoker m_colorValuesChangedRevoker;
-  std::unordered_map<std::string, winrt::Microsoft::ReactNative::Composition::Experimental::IBrush>
+  std::unordered_map<PlatformColorId, winrt::Microsoft::ReactNative::Composition::Experimental::IBrush>
       m_platformColorBrushCache;
-  std::unordered_map<DWORD, winrt::Microsoft::ReactNative::Composition::Experimental::IBrush> m_colorBrushCache;
+  // Null for the empty theme
+  std::shared_ptr<SharedResources> m_sharedResources;
   winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext m_compositionContext;
   winrt::Microsoft::ReactNative::Composition::ICustomResourceLoader m_customResourceLoader;
   winrt::Microsoft::ReactNative::Composition::ICustomResourceLoader::ResourcesChanged_revoker m_resourceChangedRevoker;
@@ -15,7 +15,7 @@ Theme::Theme(
     const winrt::Microsoft::ReactNative::ReactContext &,
     const winrt::Microsoft::ReactNative::Composition::ICustomResourceLoader &) noexcept {}
 
-void Theme::ClearCacheAndRaiseChangedEvent() noexcept {}
+void Theme::UpdateCacheAndRaiseChangedEvent() noexcept {}
 
 Theme::Theme() noexcept {}
 
@@ -65,6 +65,8 @@ winrt::event_token Theme::ThemeChanged(
 }
 void Theme::ThemeChanged(winrt::event_token const &) noexcept {}
 
+void Theme::TrimCaches() noexcept {}
+
 winrt::Microsoft::ReactNative::Composition::Theme Theme::EmptyTheme() noexcept {
   return nullptr;
 }
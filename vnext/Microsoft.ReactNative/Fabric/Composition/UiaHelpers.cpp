@@ -146,6 +146,19 @@ HRESULT UiaSetFocusHelper(::Microsoft::ReactNative::ReactTaggedView &view) noexc
       : E_FAIL;
 }
 
+bool UiaClientsAreListeningThisFrame() noexcept {
+  constexpr ULONGLONG FrameDurationMs = 16;
+  static thread_local ULONGLONG s_checkedAt{0};
+  static thread_local bool s_clientsAreListening{false};
+
+  auto now = GetTickCount64();
+  if (s_checkedAt == 0 || now - s_checkedAt >= FrameDurationMs) {
+    s_clientsAreListening = UiaClientsAreListening();
+    s_checkedAt = now;
+  }
+  return s_clientsAreListening;
+}
+
 bool WasUiaPropertyAdvised(winrt::com_ptr<IRawElementProviderSimple> &providerSimple, PROPERTYID propId) noexcept {
   auto spFragment = providerSimple.try_as<IRawElementProviderFragment>();
   if (spFragment == nullptr)
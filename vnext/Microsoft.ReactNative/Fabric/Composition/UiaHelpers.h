@@ -23,6 +23,9 @@ HRESULT UiaGetBoundingRectangleHelper(::Microsoft::ReactNative::ReactTaggedView
 
 HRESULT UiaSetFocusHelper(::Microsoft::ReactNative::ReactTaggedView &view) noexcept;
 
+// UiaClientsAreListening, checked at most once per frame, since mount transactions ask for every view they update
+bool UiaClientsAreListeningThisFrame() noexcept;
+
 void UpdateUiaProperty(
     winrt::Windows::Foundation::IInspectable provider,
     PROPERTYID propId,
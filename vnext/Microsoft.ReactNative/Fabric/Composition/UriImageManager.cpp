@@ -11,15 +11,19 @@
 #include <Composition.StreamImageResponse.g.cpp>
 #include <Composition.UriBrushFactoryImageResponse.g.cpp>
 #include <AutoDraw.h>
+#include <Fabric/Composition/CompositionHelpers.h>
 #include <IBlobPersistor.h>
 #include <Networking/NetworkPropertyIds.h>
 #include <ReactPropertyBag.h>
 #include <d2d1_3.h>
+#include <utilities.h>
 #include <shcore.h>
 #include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
 #include <winrt/Windows.Security.Cryptography.h>
 #include <winrt/Windows.Storage.Streams.h>
+#include <list>
+#include <mutex>
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
@@ -52,6 +56,134 @@ winrt::Microsoft::ReactNative::Composition::ImageSource MakeImageSource(
   return winrt::make<ImageSource>(source);
 }
 
+// SVGs used as icons are shown in many places at once.  Each SVG is only decoded and parsed once, and the brushes it
+// is rasterized into are shared by all the images of the same size.
+class SvgDataCache {
+ public:
+  // Returns nullptr when the SVG has not been decoded yet
+  winrt::Windows::Storage::Streams::IRandomAccessStream data(const std::string &source) noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto entry = findLocked(source);
+    return entry ? entry->data : nullptr;
+  }
+
+  void setData(const std::string &source, const winrt::Windows::Storage::Streams::IRandomAccessStream &data) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (!findLocked(source)) {
+      m_entries.push_front({source, data});
+      if (m_entries.size() > MaxCachedSvgs) {
+        m_entries.pop_back();
+      }
+    }
+  }
+
+  winrt::Microsoft::ReactNative::Composition::Experimental::IBrush findBrush(
+      const std::string &source,
+      const winrt::Windows::Foundation::Size &size,
+      float scale,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext
+          &compositionContext) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (auto entry = findLocked(source)) {
+      for (const auto &raster : entry->rasters) {
+        if (raster.size == size && raster.scale == scale && raster.compositionContext == compositionContext) {
+          return raster.brush;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  void insertBrush(
+      const std::string &source,
+      const winrt::Windows::Foundation::Size &size,
+      float scale,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compositionContext,
+      const winrt::Microsoft::ReactNative::Composition::Experimental::IBrush &brush) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (auto entry = findLocked(source)) {
+      entry->rasters.insert(entry->rasters.begin(), {size, scale, compositionContext, brush});
+      if (entry->rasters.size() > MaxRastersPerSvg) {
+        entry->rasters.pop_back();
+      }
+    }
+  }
+
+  // Parses the SVG for the device of the device context the first time it is drawn with it.  Returns nullptr when the
+  // SVG cannot be parsed.
+  winrt::com_ptr<ID2D1SvgDocument> document(const std::string &source, ID2D1DeviceContext5 &deviceContext) noexcept {
+    winrt::com_ptr<ID2D1Device> device;
+    deviceContext.GetDevice(device.put());
+
+    std::scoped_lock lock{m_mutex};
+    auto entry = findLocked(source);
+    if (!entry) {
+      return nullptr;
+    }
+    for (const auto &parsed : entry->documents) {
+      if (parsed.device == device) {
+        return parsed.document;
+      }
+    }
+
+    winrt::com_ptr<ID2D1SvgDocument> svgDocument;
+    try {
+      auto stream = entry->data.CloneStream();
+      stream.Seek(0);
+
+      winrt::com_ptr<IStream> nativeStream;
+      winrt::check_hresult(
+          CreateStreamOverRandomAccessStream(stream.as<::IUnknown>().get(), IID_PPV_ARGS(nativeStream.put())));
+      if (FAILED(deviceContext.CreateSvgDocument(nativeStream.get(), {1.0f, 1.0f}, svgDocument.put()))) {
+        return nullptr;
+      }
+    } catch (winrt::hresult_error const &) {
+      return nullptr;
+    }
+    entry->documents.push_back({device, svgDocument});
+    return svgDocument;
+  }
+
+ private:
+  static constexpr size_t MaxCachedSvgs = 128;
+  static constexpr size_t MaxRastersPerSvg = 8;
+
+  struct Raster {
+    winrt::Windows::Foundation::Size size;
+    float scale;
+    winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext compositionContext;
+    winrt::Microsoft::ReactNative::Composition::Experimental::IBrush brush;
+  };
+
+  struct Document {
+    winrt::com_ptr<ID2D1Device> device;
+    winrt::com_ptr<ID2D1SvgDocument> document;
+  };
+
+  struct Entry {
+    std::string source;
+    // The decoded SVG
+    winrt::Windows::Storage::Streams::IRandomAccessStream data;
+    std::vector<Document> documents;
+    // Most recently rasterized first
+    std::vector<Raster> rasters;
+  };
+
+  // Moves the entry to the front of the list, which holds the most recently used SVGs first
+  Entry *findLocked(const std::string &source) noexcept {
+    auto it = std::find_if(
+        m_entries.begin(), m_entries.end(), [&source](const Entry &entry) { return entry.source == source; });
+    if (it == m_entries.end()) {
+      return nullptr;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it);
+    return &m_entries.front();
+  }
+
+  std::mutex m_mutex;
+  std::list<Entry> m_entries;
+};
+
 /**
  * This ImageHandler will handle uri types with svgxaml base64 encoded data
  *
@@ -75,6 +207,7 @@ struct SvgDataImageHandler
     auto path = winrt::to_string(imageSource.Uri().Path());
     auto size = imageSource.Size();
     auto scale = imageSource.Scale();
+    auto cache = m_cache;
 
     size_t start = path.find(',');
     if (start == std::string::npos || start + 1 > path.length())
@@ -83,54 +216,66 @@ struct SvgDataImageHandler
     try {
       co_await winrt::resume_background();
 
-      std::string_view base64String(path.c_str() + start + 1, path.length() - start - 1);
-      auto buffer = winrt::Windows::Security::Cryptography::CryptographicBuffer::DecodeFromBase64String(
-          winrt::to_hstring(base64String));
+      std::string base64String(path.c_str() + start + 1, path.length() - start - 1);
+      if (!cache->data(base64String)) {
+        std::vector<uint8_t> bytes;
+        if (!::Microsoft::React::Utilities::TryDecodeBase64(base64String, bytes)) {
+          co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
+              L"Invalid base64 encoding in inline image data");
+        }
 
-      winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
-      co_await memoryStream.WriteAsync(buffer);
-      memoryStream.Seek(0);
+        winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
+        co_await memoryStream.WriteAsync(
+            winrt::Windows::Security::Cryptography::CryptographicBuffer::CreateFromByteArray(bytes));
+        memoryStream.Seek(0);
+        cache->setData(base64String, memoryStream);
+      }
 
       co_return winrt::Microsoft::ReactNative::Composition::Experimental::UriBrushFactoryImageResponse(
-          [memoryStream, size, scale](
+          [cache, source = std::move(base64String), size, scale](
               const winrt::Microsoft::ReactNative::IReactContext &reactContext,
               const winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext &compositionContext)
               -> winrt::Microsoft::ReactNative::Composition::Experimental::IBrush {
+            if (auto brush = cache->findBrush(source, size, scale, compositionContext)) {
+              return brush;
+            }
+
+            ::Microsoft::ReactNative::Composition::DrawingSurfaceOwnerScope ownerScope(
+                ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Image);
             auto drawingBrush = compositionContext.CreateDrawingSurfaceBrush(
                 size,
                 winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized,
                 winrt::Windows::Graphics::DirectX::DirectXAlphaMode::Premultiplied);
-            POINT pt;
-            ::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface autoDraw(drawingBrush, 1.0, &pt);
-            auto renderTarget = autoDraw.GetRenderTarget();
-
-            winrt::com_ptr<ID2D1DeviceContext5> deviceContext5;
-            winrt::check_hresult(renderTarget->QueryInterface(IID_ID2D1DeviceContext5, deviceContext5.put_void()));
+            {
+              POINT pt;
+              ::Microsoft::ReactNative::Composition::AutoDrawDrawingSurface autoDraw(drawingBrush, 1.0, &pt);
+              auto renderTarget = autoDraw.GetRenderTarget();
 
-            winrt::com_ptr<IStream> nativeStream;
+              winrt::com_ptr<ID2D1DeviceContext5> deviceContext5;
+              winrt::check_hresult(renderTarget->QueryInterface(IID_ID2D1DeviceContext5, deviceContext5.put_void()));
 
-            winrt::check_hresult(CreateStreamOverRandomAccessStream(
-                memoryStream.as<::IUnknown>().get(), IID_PPV_ARGS(nativeStream.put())));
+              auto svgDocument = cache->document(source, *deviceContext5);
+              if (!svgDocument) {
+                return nullptr;
+              }
+              // The parsed document is shared by the images of every size
+              winrt::check_hresult(svgDocument->SetViewportSize({size.Width, size.Height}));
 
-            winrt::com_ptr<ID2D1SvgDocument> svgDocument;
-            if (FAILED(deviceContext5->CreateSvgDocument(
-                    nativeStream.get(), {size.Width, size.Height}, svgDocument.put()))) {
-              return nullptr;
-            }
+              D2D1::Matrix3x2F originalTransform;
+              D2D1::Matrix3x2F translationTransform =
+                  D2D1::Matrix3x2F::Translation(static_cast<float>(pt.x), static_cast<float>(pt.y));
 
-            D2D1::Matrix3x2F originalTransform;
-            D2D1::Matrix3x2F translationTransform =
-                D2D1::Matrix3x2F::Translation(static_cast<float>(pt.x), static_cast<float>(pt.y));
+              renderTarget->GetTransform(&originalTransform);
+              translationTransform = originalTransform * translationTransform;
 
-            renderTarget->GetTransform(&originalTransform);
-            translationTransform = originalTransform * translationTransform;
+              renderTarget->SetTransform(translationTransform);
 
-            renderTarget->SetTransform(translationTransform);
+              deviceContext5->DrawSvgDocument(svgDocument.get());
 
-            deviceContext5->DrawSvgDocument(svgDocument.get());
-
-            renderTarget->SetTransform(originalTransform);
+              renderTarget->SetTransform(originalTransform);
+            }
 
+            cache->insertBrush(source, size, scale, compositionContext, drawingBrush);
             return drawingBrush;
           });
 
@@ -140,6 +285,9 @@ struct SvgDataImageHandler
 
     winrt::throw_hresult(E_UNEXPECTED);
   }
+
+ private:
+  std::shared_ptr<SvgDataCache> m_cache{std::make_shared<SvgDataCache>()};
 };
 
 /**
@@ -172,16 +320,19 @@ struct DataImageHandler
       co_await winrt::resume_background();
 
       std::string_view base64String(path.c_str() + start + 1, path.length() - start - 1);
-      auto buffer = winrt::Windows::Security::Cryptography::CryptographicBuffer::DecodeFromBase64String(
-          winrt::to_hstring(base64String));
+      std::vector<uint8_t> bytes;
+      if (!::Microsoft::React::Utilities::TryDecodeBase64(base64String, bytes)) {
+        co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
+            L"Invalid base64 encoding in inline image data");
+      }
 
       winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
-      co_await memoryStream.WriteAsync(buffer);
+      co_await memoryStream.WriteAsync(
+          winrt::Windows::Security::Cryptography::CryptographicBuffer::CreateFromByteArray(bytes));
       memoryStream.Seek(0);
 
       co_return winrt::Microsoft::ReactNative::Composition::StreamImageResponse(memoryStream);
     } catch (winrt::hresult_error const &) {
-      // Base64 decode failed
       co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
           L"Invalid base64 encoding in inline image data");
     }
@@ -279,11 +430,11 @@ IUriImageProvider UriImageManager::TryGetUriImageProvider(
   return nullptr;
 }
 
-ImageResponseOrImageErrorInfo ImageResponse::ResolveImage() {
+ImageResponseOrImageErrorInfo ImageResponse::ResolveImage(const facebook::react::Size & /*decodeSize*/) {
   winrt::throw_hresult(E_NOTIMPL);
 }
 
-ImageResponseOrImageErrorInfo ImageFailedResponse::ResolveImage() {
+ImageResponseOrImageErrorInfo ImageFailedResponse::ResolveImage(const facebook::react::Size & /*decodeSize*/) {
   ImageResponseOrImageErrorInfo imageOrError;
   imageOrError.errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
   imageOrError.errorInfo->responseCode = static_cast<int>(m_statusCode);
@@ -46,7 +46,9 @@ struct ImageResponseOrImageErrorInfo {
 
 struct ImageResponse : ImageResponseT<ImageResponse /*, IResolveImage*/> {
   ImageResponse() noexcept = default;
-  virtual ImageResponseOrImageErrorInfo ResolveImage();
+  // decodeSize is the size in physical pixels the image is shown at, images larger than that are decoded at a smaller
+  // size.  An empty size decodes images at their natural size.
+  virtual ImageResponseOrImageErrorInfo ResolveImage(const facebook::react::Size &decodeSize);
 };
 
 struct ImageFailedResponse : ImageFailedResponseT<ImageFailedResponse, ImageResponse /*, IResolveImage*/> {
@@ -57,7 +59,7 @@ struct ImageFailedResponse : ImageFailedResponseT<ImageFailedResponse, ImageResp
       const winrt::Windows::Web::Http::Headers::HttpResponseHeaderCollection &responseHeaders) noexcept
       : base_type(), m_errorMessage(errorMessage), m_statusCode(statusCode), m_responseHeaders(responseHeaders) {}
 
-  virtual ImageResponseOrImageErrorInfo ResolveImage();
+  virtual ImageResponseOrImageErrorInfo ResolveImage(const facebook::react::Size &decodeSize);
 
  private:
   const winrt::hstring m_errorMessage;
@@ -68,17 +70,29 @@ struct ImageFailedResponse : ImageFailedResponseT<ImageFailedResponse, ImageResp
 struct StreamImageResponse : StreamImageResponseT<StreamImageResponse, ImageResponse /*, IResolveImage*/> {
   StreamImageResponse(const winrt::Windows::Storage::Streams::IRandomAccessStream &stream) noexcept
       : base_type(), m_stream(stream) {}
-  virtual ImageResponseOrImageErrorInfo ResolveImage();
+  // Decodes the image from the memory of the body, without copying it into a stream
+  StreamImageResponse(std::shared_ptr<const std::vector<uint8_t>> body) noexcept
+      : base_type(), m_stream(nullptr), m_body(std::move(body)) {}
+  // Decodes a smaller rendition of an image, like its thumbnail, which is reported with the natural size of the image
+  StreamImageResponse(
+      const winrt::Windows::Storage::Streams::IRandomAccessStream &stream,
+      UINT naturalWidth,
+      UINT naturalHeight) noexcept
+      : base_type(), m_stream(stream), m_naturalWidth(naturalWidth), m_naturalHeight(naturalHeight) {}
+  virtual ImageResponseOrImageErrorInfo ResolveImage(const facebook::react::Size &decodeSize);
 
  private:
   const winrt::Windows::Storage::Streams::IRandomAccessStream m_stream;
+  const std::shared_ptr<const std::vector<uint8_t>> m_body;
+  const UINT m_naturalWidth{0};
+  const UINT m_naturalHeight{0};
 };
 
 struct UriBrushFactoryImageResponse
     : UriBrushFactoryImageResponseT<UriBrushFactoryImageResponse, ImageResponse /*, IResolveImage*/> {
   UriBrushFactoryImageResponse(const winrt::Microsoft::ReactNative::Composition::UriBrushFactory &factory) noexcept
       : base_type(), m_factory(factory) {}
-  virtual ImageResponseOrImageErrorInfo ResolveImage();
+  virtual ImageResponseOrImageErrorInfo ResolveImage(const facebook::react::Size &decodeSize);
 
  private:
   const winrt::Microsoft::ReactNative::Composition::UriBrushFactory m_factory;
@@ -95,7 +109,8 @@ struct UriBrushFactoryImageResponse
   UriBrushFactoryImageResponse(
       const winrt::Microsoft::ReactNative::Composition::Experimental::UriBrushFactory &factory) noexcept
       : base_type(), m_factory(factory) {}
-  virtual winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo ResolveImage();
+  virtual winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo ResolveImage(
+      const facebook::react::Size &decodeSize);
 
  private:
   const winrt::Microsoft::ReactNative::Composition::Experimental::UriBrushFactory m_factory;
@@ -0,0 +1,154 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "VisibilityTracker.h"
+
+#include <Fabric/ComponentView.h>
+#include <Fabric/FabricUIManagerModule.h>
+#include <algorithm>
+#include <unordered_set>
+#include "RootComponentView.h"
+#include "ScrollViewComponentView.h"
+
+namespace Microsoft::ReactNative {
+
+VisibilityTracker::VisibilityTracker(
+    winrt::Microsoft::ReactNative::ReactContext const &context,
+    OnChanged &&onChanged) noexcept
+    : m_context(context), m_onChanged(std::move(onChanged)) {}
+
+void VisibilityTracker::observe(facebook::react::Tag tag, std::vector<float> &&thresholds) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  if (thresholds.empty()) {
+    thresholds.push_back(0.0f);
+  }
+  for (auto &threshold : thresholds) {
+    threshold = std::clamp(threshold, 0.0f, 1.0f);
+  }
+  std::sort(thresholds.begin(), thresholds.end());
+  m_observations[tag] = {std::move(thresholds), std::nullopt};
+
+  if (!m_isObservingMount) {
+    if (auto uiManager = FabricUIManager::FromProperties(m_context.Properties())) {
+      uiManager->addMountingTransactionObserver(shared_from_this());
+      m_isObservingMount = true;
+    }
+  }
+  scheduleUpdate();
+}
+
+void VisibilityTracker::unobserve(facebook::react::Tag tag) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  if (!m_observations.erase(tag) || !m_observations.empty()) {
+    return;
+  }
+
+  m_scrollRevokers.clear();
+  if (m_isObservingMount) {
+    if (auto uiManager = FabricUIManager::FromProperties(m_context.Properties())) {
+      uiManager->removeMountingTransactionObserver(shared_from_this());
+    }
+    m_isObservingMount = false;
+  }
+}
+
+void VisibilityTracker::mountingTransactionDidMount(
+    facebook::react::MountingTransaction const & /*transaction*/,
+    facebook::react::SurfaceTelemetry const & /*surfaceTelemetry*/,
+    MountingTransactionMetrics const & /*metrics*/) noexcept {
+  // Views move with the layout of any of their ancestors, so any transaction can change their visibility
+  scheduleUpdate();
+}
+
+void VisibilityTracker::scheduleUpdate() noexcept {
+  if (m_isUpdateScheduled || m_observations.empty()) {
+    return;
+  }
+  m_isUpdateScheduled = true;
+
+  m_context.UIDispatcher().Post([wkThis = weak_from_this()]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->update();
+    }
+  });
+}
+
+void VisibilityTracker::update() noexcept {
+  m_isUpdateScheduled = false;
+  auto uiManager = FabricUIManager::FromProperties(m_context.Properties());
+  if (!uiManager) {
+    return;
+  }
+
+  std::vector<Entry> changedEntries;
+  std::unordered_set<facebook::react::Tag> scrollViewTags;
+  for (auto &[tag, observation] : m_observations) {
+    Entry entry{tag, 0.0f, false, 0};
+
+    auto view = uiManager->GetViewRegistry().findComponentViewWithTag(tag);
+    auto componentView = view ? winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(view)
+                              : nullptr;
+    auto root = componentView ? componentView->rootComponentView() : nullptr;
+    if (root && componentView->isMounted()) {
+      RECT viewportRect = root->getClientRect();
+      for (auto parent = view.Parent(); parent; parent = parent.Parent()) {
+        if (auto scrollView =
+                parent.try_as<winrt::Microsoft::ReactNative::Composition::implementation::ScrollViewComponentView>()) {
+          const auto scrollViewportRect = scrollView->getClientRect();
+          IntersectRect(&viewportRect, &viewportRect, &scrollViewportRect);
+
+          auto scrollViewTag = scrollView->Tag();
+          scrollViewTags.insert(scrollViewTag);
+          if (m_scrollRevokers.find(scrollViewTag) == m_scrollRevokers.end()) {
+            m_scrollRevokers.emplace(
+                scrollViewTag,
+                scrollView->ScrollPositionChanged(
+                    [wkThis = weak_from_this()](
+                        winrt::IInspectable const & /*sender*/,
+                        winrt::Microsoft::ReactNative::Composition::Experimental::IScrollPositionChangedArgs const
+                            & /*args*/) {
+                      if (auto pThis = wkThis.lock()) {
+                        pThis->scheduleUpdate();
+                      }
+                    }));
+          }
+        }
+      }
+
+      const auto clientRect = componentView->getClientRect();
+      RECT intersection;
+      entry.isIntersecting = !IsRectEmpty(&viewportRect) && IntersectRect(&intersection, &clientRect, &viewportRect);
+      if (entry.isIntersecting) {
+        const auto area = static_cast<float>(clientRect.right - clientRect.left) * (clientRect.bottom - clientRect.top);
+        const auto visibleArea =
+            static_cast<float>(intersection.right - intersection.left) * (intersection.bottom - intersection.top);
+        entry.intersectionRatio = area > 0 ? std::min(visibleArea / area, 1.0f) : 1.0f;
+      }
+    }
+
+    // A threshold of 0 is only reached by a view that is intersecting
+    for (auto threshold : observation.thresholds) {
+      if (entry.intersectionRatio < threshold || (threshold == 0.0f && !entry.isIntersecting)) {
+        break;
+      }
+      entry.thresholdIndex++;
+    }
+
+    if (observation.thresholdIndex != entry.thresholdIndex) {
+      observation.thresholdIndex = entry.thresholdIndex;
+      changedEntries.push_back(entry);
+    }
+  }
+
+  // Stops following the ScrollViews that no longer contain an observed view
+  for (auto it = m_scrollRevokers.begin(); it != m_scrollRevokers.end();) {
+    it = scrollViewTags.count(it->first) ? std::next(it) : m_scrollRevokers.erase(it);
+  }
+
+  if (!changedEntries.empty()) {
+    m_onChanged(std::move(changedEntries));
+  }
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Fabric/MountingTransactionObserver.h>
+#include <ReactContext.h>
+#include <react/renderer/core/ReactPrimitives.h>
+#include <winrt/Microsoft.ReactNative.Composition.Experimental.h>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Native equivalent of an IntersectionObserver for the views of the Fabric surfaces, so that virtualized lists, lazy
+// loads and impression tracking do not have to compute visibility in JS on every scroll event.  A view is visible in
+// the part of its client rect that is within the client rects of its root and of every ScrollView that contains it.
+// The visibility of the observed views is updated at most once per UI thread task after the mounted transactions and
+// the scroll position changes of those ScrollViews, and only the views that crossed one of their thresholds are
+// reported, together.  All methods must be called on the UI thread.
+class VisibilityTracker final : public IMountingTransactionObserver,
+                                public std::enable_shared_from_this<VisibilityTracker> {
+ public:
+  struct Entry {
+    facebook::react::Tag tag;
+    // The visible part of the view's area, from 0 to 1
+    float intersectionRatio;
+    bool isIntersecting;
+    // The number of thresholds that the view has reached
+    size_t thresholdIndex;
+  };
+  using OnChanged = std::function<void(std::vector<Entry> &&entries)>;
+
+  VisibilityTracker(winrt::Microsoft::ReactNative::ReactContext const &context, OnChanged &&onChanged) noexcept;
+
+  // The thresholds are ratios of the view's area, like those of an IntersectionObserver, {0} if empty.  The view is
+  // reported once after the next update, and then each time it crosses a threshold.
+  void observe(facebook::react::Tag tag, std::vector<float> &&thresholds) noexcept;
+  void unobserve(facebook::react::Tag tag) noexcept;
+
+  // IMountingTransactionObserver
+  void mountingTransactionDidMount(
+      facebook::react::MountingTransaction const &transaction,
+      facebook::react::SurfaceTelemetry const &surfaceTelemetry,
+      MountingTransactionMetrics const &metrics) noexcept override;
+
+ private:
+  struct Observation {
+    std::vector<float> thresholds;
+    // Empty until the view is first reported
+    std::optional<size_t> thresholdIndex;
+  };
+
+  void scheduleUpdate() noexcept;
+  void update() noexcept;
+
+  winrt::Microsoft::ReactNative::ReactContext m_context;
+  OnChanged m_onChanged;
+  std::unordered_map<facebook::react::Tag, Observation> m_observations;
+  // The ScrollViews that contain observed views, by tag
+  std::unordered_map<
+      facebook::react::Tag,
+      winrt::Microsoft::ReactNative::Composition::Experimental::IScrollVisual::ScrollPositionChanged_revoker>
+      m_scrollRevokers;
+  bool m_isObservingMount{false};
+  bool m_isUpdateScheduled{false};
+};
+
+} // namespace Microsoft::ReactNative
@@ -8,11 +8,13 @@
 namespace Microsoft::ReactNative {
 
 winrt::com_ptr<::IDWriteFactory> DWriteFactory() noexcept {
-  static winrt::com_ptr<::IDWriteFactory> s_dwriteFactory;
-  if (!s_dwriteFactory) {
+  // Text layouts are built on background threads as well, so the factory is created by a thread safe initializer
+  static winrt::com_ptr<::IDWriteFactory> s_dwriteFactory = []() {
+    winrt::com_ptr<::IDWriteFactory> dwriteFactory;
     winrt::check_hresult(::DWriteCreateFactory(
-        DWRITE_FACTORY_TYPE_SHARED, __uuidof(s_dwriteFactory), reinterpret_cast<::IUnknown **>(s_dwriteFactory.put())));
-  }
+        DWRITE_FACTORY_TYPE_SHARED, __uuidof(dwriteFactory), reinterpret_cast<::IUnknown **>(dwriteFactory.put())));
+    return dwriteFactory;
+  }();
   return s_dwriteFactory;
 }
 
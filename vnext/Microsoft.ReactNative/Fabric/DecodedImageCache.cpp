@@ -0,0 +1,266 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "DecodedImageCache.h"
+
+#include <CppRuntimeOptions.h>
+#include <Fabric/AnimatedImage.h>
+#include <Fabric/ImageLoadScheduler.h>
+#include <winrt/Windows.System.h>
+#include <algorithm>
+
+namespace Microsoft::ReactNative {
+
+constexpr size_t DefaultBudgetBytes = 64 * 1024 * 1024;
+
+DecodedImageCache::Key::Key(const facebook::react::ImageSource &imageSource) noexcept
+    : uri(imageSource.uri),
+      method(imageSource.method),
+      body(imageSource.body),
+      headers(imageSource.headers),
+      width(imageSource.size.width),
+      height(imageSource.size.height),
+      scale(imageSource.scale) {}
+
+bool DecodedImageCache::Key::operator==(const Key &other) const noexcept {
+  return std::tie(uri, method, body, headers, width, height, scale) ==
+      std::tie(other.uri, other.method, other.body, other.headers, other.width, other.height, other.scale);
+}
+
+size_t DecodedImageCache::KeyHash::operator()(const Key &key) const noexcept {
+  size_t seed = 0;
+  auto combine = [&seed](size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+  combine(std::hash<std::string>{}(key.uri));
+  combine(std::hash<std::string>{}(key.method));
+  combine(std::hash<std::string>{}(key.body));
+  for (const auto &[name, value] : key.headers) {
+    combine(std::hash<std::string>{}(name));
+    combine(std::hash<std::string>{}(value));
+  }
+  combine(std::hash<facebook::react::Float>{}(key.width));
+  combine(std::hash<facebook::react::Float>{}(key.height));
+  combine(std::hash<facebook::react::Float>{}(key.scale));
+  return seed;
+}
+
+DecodedImageCache &DecodedImageCache::Instance() noexcept {
+  // Intentionally leaked, so that cached bitmaps are not released during process shutdown
+  static DecodedImageCache *s_instance = new DecodedImageCache();
+  return *s_instance;
+}
+
+DecodedImageCache::DecodedImageCache() noexcept {
+  try {
+    winrt::Windows::System::MemoryManager::AppMemoryUsageIncreased(
+        [](const winrt::Windows::Foundation::IInspectable &, const winrt::Windows::Foundation::IInspectable &) {
+          DecodedImageCache::Instance().onMemoryUsageIncreased();
+        });
+  } catch (winrt::hresult_error const &) {
+    // Memory usage notifications are not available to every process, the cache then only applies its budget
+  }
+}
+
+size_t DecodedImageCache::Budget() noexcept {
+  auto budgetMB = Microsoft::React::GetRuntimeOptionInt("Image.MemoryCacheSizeMB");
+  if (budgetMB < 0) {
+    return 0;
+  }
+  return budgetMB == 0 ? DefaultBudgetBytes : static_cast<size_t>(budgetMB) * 1024 * 1024;
+}
+
+std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> DecodedImageCache::find(
+    const Key &key) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto it = m_index.find(key);
+  if (it == m_index.end()) {
+    return nullptr;
+  }
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  return it->second->image;
+}
+
+void DecodedImageCache::insert(
+    const Key &key,
+    const std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>
+        &image) noexcept {
+  // Only decoded bitmaps are cached, brushes from UriBrushFactories depend on the compositor they are created for
+  if (!image || !image->m_wicbmp) {
+    return;
+  }
+
+  UINT width = 0;
+  UINT height = 0;
+  if (FAILED(image->m_wicbmp->GetSize(&width, &height))) {
+    return;
+  }
+  // The bitmaps are decoded to GUID_WICPixelFormat32bppPBGRA
+  size_t byteSize = static_cast<size_t>(width) * height * 4;
+  if (image->m_animatedImage) {
+    byteSize += image->m_animatedImage->bufferByteSize();
+  }
+
+  auto budget = Budget();
+  if (byteSize > budget / 2) {
+    return;
+  }
+
+  std::scoped_lock lock{m_mutex};
+  if (auto it = m_index.find(key); it != m_index.end()) {
+    m_byteSize -= it->second->byteSize;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+  }
+
+  m_entries.push_front({key, image, byteSize});
+  m_index.emplace(key, m_entries.begin());
+  m_byteSize += byteSize;
+  trimToLocked(budget);
+}
+
+bool DecodedImageCache::addRequest(const Key &key, Observer observer) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto [it, inserted] = m_pendingRequests.try_emplace(key);
+  it->second.observers.push_back(std::move(observer));
+  return inserted;
+}
+
+void DecodedImageCache::setRequestLoad(const Key &key, uint64_t scheduledLoad) noexcept {
+  std::scoped_lock lock{m_mutex};
+  if (auto it = m_pendingRequests.find(key); it != m_pendingRequests.end()) {
+    it->second.scheduledLoad = scheduledLoad;
+  }
+}
+
+void DecodedImageCache::setRequestOperation(
+    const Key &key,
+    const winrt::Windows::Foundation::IAsyncInfo &operation) noexcept {
+  std::scoped_lock lock{m_mutex};
+  if (auto it = m_pendingRequests.find(key); it != m_pendingRequests.end()) {
+    it->second.operation = operation;
+  }
+}
+
+void DecodedImageCache::cancelRequest(
+    const Key &key,
+    const facebook::react::ImageResponseObserverCoordinator *observer) noexcept {
+  winrt::Windows::Foundation::IAsyncInfo operation{nullptr};
+  uint64_t scheduledLoad{0};
+  {
+    std::scoped_lock lock{m_mutex};
+    auto it = m_pendingRequests.find(key);
+    if (it == m_pendingRequests.end()) {
+      return;
+    }
+
+    // Observers of released ImageRequests are gone as well
+    auto &observers = it->second.observers;
+    observers.erase(
+        std::remove_if(
+            observers.begin(),
+            observers.end(),
+            [observer](const Observer &other) {
+              auto otherObserver = other.lock();
+              return !otherObserver || otherObserver.get() == observer;
+            }),
+        observers.end());
+    if (!observers.empty()) {
+      return;
+    }
+
+    operation = std::move(it->second.operation);
+    scheduledLoad = it->second.scheduledLoad;
+    m_pendingRequests.erase(it);
+  }
+
+  // Cancelled outside of the lock, since the completion of the operation can run synchronously
+  if (operation) {
+    operation.Cancel();
+  } else if (scheduledLoad) {
+    ImageLoadScheduler::Instance().cancel(scheduledLoad);
+  }
+}
+
+std::vector<DecodedImageCache::Observer> DecodedImageCache::completeRequest(
+    const Key &key,
+    const winrt::Windows::Foundation::IAsyncInfo &operation) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto it = m_pendingRequests.find(key);
+  // A cancelled operation might have been replaced by a new load of the same key
+  if (it == m_pendingRequests.end() || it->second.operation != operation) {
+    return {};
+  }
+  auto observers = std::move(it->second.observers);
+  m_pendingRequests.erase(it);
+  return observers;
+}
+
+std::vector<DecodedImageCache::Observer> DecodedImageCache::pendingObservers(const Key &key) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto it = m_pendingRequests.find(key);
+  return it == m_pendingRequests.end() ? std::vector<Observer>{} : it->second.observers;
+}
+
+void DecodedImageCache::setRequestPreview(
+    const Key &key,
+    std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> preview) noexcept {
+  std::scoped_lock lock{m_mutex};
+  if (auto it = m_pendingRequests.find(key); it != m_pendingRequests.end()) {
+    it->second.preview = std::move(preview);
+  }
+}
+
+std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>
+DecodedImageCache::requestPreview(const Key &key) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto it = m_pendingRequests.find(key);
+  return it == m_pendingRequests.end() ? nullptr : it->second.preview;
+}
+
+void DecodedImageCache::clear() noexcept {
+  std::scoped_lock lock{m_mutex};
+  trimToLocked(0);
+}
+
+size_t DecodedImageCache::byteSize() noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_byteSize;
+}
+
+void DecodedImageCache::trim(size_t byteSize) noexcept {
+  std::scoped_lock lock{m_mutex};
+  trimToLocked(byteSize);
+}
+
+size_t DecodedImageCache::size() noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_entries.size();
+}
+
+void DecodedImageCache::trimToLocked(size_t budget) noexcept {
+  while (m_byteSize > budget && !m_entries.empty()) {
+    auto &entry = m_entries.back();
+    m_byteSize -= entry.byteSize;
+    m_index.erase(entry.key);
+    m_entries.pop_back();
+  }
+}
+
+void DecodedImageCache::onMemoryUsageIncreased() noexcept {
+  winrt::Windows::System::AppMemoryUsageLevel level;
+  try {
+    level = winrt::Windows::System::MemoryManager::AppMemoryUsageLevel();
+  } catch (winrt::hresult_error const &) {
+    return;
+  }
+
+  if (level == winrt::Windows::System::AppMemoryUsageLevel::OverLimit) {
+    clear();
+  } else if (level == winrt::Windows::System::AppMemoryUsageLevel::High) {
+    std::scoped_lock lock{m_mutex};
+    trimToLocked(m_byteSize / 2);
+  }
+}
+
+} // namespace Microsoft::ReactNative
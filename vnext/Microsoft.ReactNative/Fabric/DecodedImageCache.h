@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/imagemanager/ImageResponseObserverCoordinator.h>
+#include <react/renderer/imagemanager/primitives.h>
+
+#include <Fabric/Composition/ImageResponseImage.h>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace Microsoft::ReactNative {
+
+// Process wide LRU cache of decoded image bitmaps, shared by the WindowsImageManagers of all instances, so that an
+// image shown in many places, like an icon in every row of a list, is only fetched and decoded once.
+// The cache holds on to at most a byte budget of bitmaps, which can be set in megabytes with the
+// "Image.MemoryCacheSizeMB" runtime option (a negative value disables the cache), and is trimmed when the app's memory
+// usage becomes high.
+// It also tracks the image requests that are in flight, so that requests for an image which is already being loaded
+// wait for that load instead of starting their own.  The load is cancelled once every request waiting on it is.
+class DecodedImageCache final {
+ public:
+  struct Key {
+    std::string uri;
+    std::string method;
+    std::string body;
+    std::vector<std::pair<std::string, std::string>> headers;
+    facebook::react::Float width;
+    facebook::react::Float height;
+    facebook::react::Float scale;
+
+    explicit Key(const facebook::react::ImageSource &imageSource) noexcept;
+    bool operator==(const Key &other) const noexcept;
+  };
+
+  using Observer = std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator>;
+
+  static DecodedImageCache &Instance() noexcept;
+
+  // Returns nullptr when the image is not in the cache
+  std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> find(
+      const Key &key) noexcept;
+
+  void insert(
+      const Key &key,
+      const std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>
+          &image) noexcept;
+
+  // Returns true when there was no request in flight for the key, in which case the caller has to schedule loading the
+  // image, pass the scheduled load to setRequestLoad and, once it starts, its operation to setRequestOperation, and
+  // call completeRequest when it finishes
+  bool addRequest(const Key &key, Observer observer) noexcept;
+
+  void setRequestLoad(const Key &key, uint64_t scheduledLoad) noexcept;
+  void setRequestOperation(const Key &key, const winrt::Windows::Foundation::IAsyncInfo &operation) noexcept;
+
+  // Stops the observer from waiting on the load of the key, and cancels the load when no other observer waits on it
+  void cancelRequest(const Key &key, const facebook::react::ImageResponseObserverCoordinator *observer) noexcept;
+
+  // Returns the observers of all requests that waited on the operation, which has finished loading the key.  Returns
+  // no observers, when the operation was cancelled
+  std::vector<Observer> completeRequest(
+      const Key &key,
+      const winrt::Windows::Foundation::IAsyncInfo &operation) noexcept;
+
+  // Returns the observers of all requests waiting on the load of the key
+  std::vector<Observer> pendingObservers(const Key &key) noexcept;
+
+  // Partially loaded images, shown while the load of the key is in flight.  Returns nullptr when there is none
+  void setRequestPreview(
+      const Key &key,
+      std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> preview) noexcept;
+  std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> requestPreview(
+      const Key &key) noexcept;
+
+  void clear() noexcept;
+  // Releases the least recently used bitmaps until the cache holds at most the bytes
+  void trim(size_t byteSize) noexcept;
+
+  // The bytes of the bitmaps held on to by the cache
+  size_t byteSize() noexcept;
+  size_t size() noexcept;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key &key) const noexcept;
+  };
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> image;
+    size_t byteSize;
+  };
+
+  struct PendingRequest {
+    std::vector<Observer> observers;
+    // The load in the ImageLoadScheduler, until it starts and has an operation
+    uint64_t scheduledLoad{0};
+    winrt::Windows::Foundation::IAsyncInfo operation{nullptr};
+    std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> preview;
+  };
+
+  DecodedImageCache() noexcept;
+
+  static size_t Budget() noexcept;
+  void trimToLocked(size_t budget) noexcept;
+  void onMemoryUsageIncreased() noexcept;
+
+  std::mutex m_mutex;
+  // Most recently used entries first
+  std::list<Entry> m_entries;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;
+  std::unordered_map<Key, PendingRequest, KeyHash> m_pendingRequests;
+  size_t m_byteSize{0};
+};
+
+} // namespace Microsoft::ReactNative
@@ -5,23 +5,35 @@
 #include "HandleCommandArgs.g.cpp"
 #include "HandleCommandArgs.g.h"
 #include <AsynchronousEventBeat.h>
+#include <CacheBudgetManager.h>
+#include <CompositorEventBeat.h>
 #include <DynamicReader.h>
 #include <DynamicWriter.h>
 #include <Fabric/ComponentView.h>
+#include <Fabric/Composition/CompositionHelpers.h>
 #include <Fabric/Composition/CompositionUIService.h>
 #include <Fabric/Composition/CompositionViewComponentView.h>
+#include <Fabric/Composition/ParagraphComponentView.h>
+#include <Fabric/Composition/PerformanceOverlay.h>
 #include <Fabric/Composition/ReactNativeIsland.h>
 #include <Fabric/Composition/RootComponentView.h>
+#include <Fabric/Composition/Theme.h>
+#include <Fabric/DecodedImageCache.h>
 #include <Fabric/FabricUIManagerModule.h>
 #include <Fabric/WindowsComponentDescriptorRegistry.h>
 #include <IReactContext.h>
 #include <IReactRootView.h>
+#include <ReactCoreInjection.h>
 #include <JSI/jsi.h>
 #include <ReactCommon/RuntimeExecutor.h>
 #include <SchedulerSettings.h>
+#include <StartupTimeline.h>
+#include <dispatchQueue/dispatchQueue.h>
+#include <dispatchQueue/dispatchQueueMetrics.h>
 #include <react/components/rnwcore/ComponentDescriptors.h>
 #include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
 #include <react/renderer/components/text/ParagraphComponentDescriptor.h>
+#include <react/renderer/components/text/ParagraphState.h>
 #include <react/renderer/core/DynamicPropsUtilities.h>
 #include <react/renderer/core/EventBeat.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
@@ -29,8 +41,14 @@
 #include <react/renderer/scheduler/SchedulerToolbox.h>
 #include <react/renderer/textlayoutmanager/WindowsTextLayoutManager.h>
 #include <react/utils/ContextContainer.h>
+#include <tracing/tracing.h>
+#include <winrt/Microsoft.UI.Composition.h>
 #include <winrt/Windows.Graphics.Display.h>
 #include <winrt/Windows.UI.Composition.Desktop.h>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <unordered_set>
 #include "DynamicReader.h"
 #include "Unicode.h"
 
@@ -56,6 +74,17 @@ FabicUIManagerProperty() noexcept {
 FabricUIManager::FabricUIManager() {}
 
 FabricUIManager::~FabricUIManager() {
+  if (m_cacheBudgetManager) {
+    for (auto token : m_cacheRegistrationTokens) {
+      m_cacheBudgetManager->Unregister(token);
+    }
+  }
+
+  if (auto deviceReplaced =
+          m_compContext.try_as<::Microsoft::ReactNative::Composition::ICompositionRenderingDeviceReplaced>()) {
+    deviceReplaced->RenderingDeviceReplaced(m_renderingDeviceReplacedToken);
+  }
+
   // Make sure that we destroy UI components on UI thread.
   if (!m_context.UIDispatcher().HasThreadAccess()) {
     m_context.UIDispatcher().Post([registry = std::move(m_registry)]() {});
@@ -95,6 +124,19 @@ void FabricUIManager::installFabricUIManager() noexcept {
       [runtimeScheduler, context = m_context](std::shared_ptr<facebook::react::EventBeat::OwnerBox> const &ownerBox) {
         return std::make_unique<AsynchronousEventBeat>(ownerBox, context, runtimeScheduler);
       };
+  if (m_context.Properties().Get(CompositorEventBeatProperty()).value_or(false)) {
+    if (auto compositor =
+            winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerCompositor(
+                m_compContext)) {
+      asynchronousBeatFactory = [runtimeScheduler, context = m_context, compositor, wkThis = weak_from_this()](
+                                    std::shared_ptr<facebook::react::EventBeat::OwnerBox> const &ownerBox) {
+        return std::make_unique<CompositorEventBeat>(ownerBox, context, runtimeScheduler, compositor, [wkThis]() {
+          auto pThis = wkThis.lock();
+          return pThis && pThis->isMountPending();
+        });
+      };
+    }
+  }
 
   toolbox.contextContainer = contextContainer;
   toolbox.componentRegistryFactory =
@@ -117,8 +159,8 @@ void FabricUIManager::installFabricUIManager() noexcept {
   toolbox.runtimeExecutor = runtimeExecutor;
   toolbox.eventBeatFactory = asynchronousBeatFactory;
 
-  m_scheduler = std::make_shared<facebook::react::Scheduler>(
-      toolbox, (/*animationDriver_ ? animationDriver_.get() :*/ nullptr), this);
+  m_layoutAnimationDelegate = std::make_unique<LayoutAnimationDelegate>(runtimeExecutor);
+  m_scheduler = std::make_shared<facebook::react::Scheduler>(toolbox, m_layoutAnimationDelegate.get(), this);
 }
 
 const IComponentViewRegistry &FabricUIManager::GetViewRegistry() const noexcept {
@@ -131,6 +173,9 @@ void FabricUIManager::startSurface(
     const facebook::react::LayoutConstraints &layoutConstraints,
     const std::string &moduleName,
     const folly::dynamic &initialProps) noexcept {
+  if (m_startupTimeline) {
+    m_startupTimeline->StartPhase(Mso::React::StartupPhase::FirstCommit);
+  }
   m_surfaceRegistry.insert({surfaceId, {rootView}});
 
   m_context.UIDispatcher().Post([self = shared_from_this(), surfaceId, rootView]() {
@@ -169,11 +214,25 @@ void FabricUIManager::stopSurface(facebook::react::SurfaceId surfaceId) noexcept
   if (surfaceId == -1) {
     return;
   }
+  {
+    std::scoped_lock lock{m_frozenSurfacesMutex};
+    m_frozenSurfaces.erase(surfaceId);
+  }
+
   visit(surfaceId, [&](const facebook::react::SurfaceHandler &surfaceHandler) {
-    surfaceHandler.stop();
+    // Released frozen surfaces are already stopped
+    if (surfaceHandler.getStatus() == facebook::react::SurfaceHandler::Status::Running) {
+      surfaceHandler.stop();
+    }
     m_scheduler->unregisterSurface(surfaceHandler);
   });
 
+  // The rest of a time sliced mount, and the transactions waiting for it, insert into the root view and remove from it,
+  // so they are mounted before the root view goes away
+  if (m_timeSlicedMounts.count(surfaceId)) {
+    continueTimeSlicedMount(surfaceId, true /*untilComplete*/);
+  }
+
   {
     std::unique_lock lock(m_handlerMutex);
 
@@ -185,8 +244,103 @@ void FabricUIManager::stopSurface(facebook::react::SurfaceId surfaceId) noexcept
 
   auto &rootDescriptor = m_registry.componentViewDescriptorWithTag(surfaceId);
   rootDescriptor.view.as<winrt::Microsoft::ReactNative::Composition::implementation::RootComponentView>()->stop();
+  invalidateParentComponentViewCache(surfaceId);
   m_registry.enqueueComponentViewWithComponentHandle(
       facebook::react::RootShadowNode::Handle(), surfaceId, rootDescriptor);
+
+  // Transactions that were prepared but not mounted yet target views that no longer exist
+  m_preparedTransactions.erase(
+      std::remove_if(
+          m_preparedTransactions.begin(),
+          m_preparedTransactions.end(),
+          [surfaceId](auto const &prepared) { return prepared->transaction.getSurfaceId() == surfaceId; }),
+      m_preparedTransactions.end());
+  m_preparedSurfaceTelemetry.erase(surfaceId);
+}
+
+// Matches the number of screens that navigation stacks usually keep behind the current one
+constexpr size_t MaxFrozenSurfaces = 4;
+
+void FabricUIManager::freezeSurface(facebook::react::SurfaceId surfaceId) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  {
+    std::scoped_lock lock{m_frozenSurfacesMutex};
+    if (!m_frozenSurfaces.try_emplace(surfaceId, FrozenSurface{nullptr, m_nextFreezeOrder++}).second) {
+      return;
+    }
+  }
+  releaseFrozenSurfaces(MaxFrozenSurfaces);
+}
+
+void FabricUIManager::unfreezeSurface(facebook::react::SurfaceId surfaceId) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  FrozenSurface frozenSurface;
+  {
+    std::scoped_lock lock{m_frozenSurfacesMutex};
+    auto it = m_frozenSurfaces.find(surfaceId);
+    if (it == m_frozenSurfaces.end()) {
+      return;
+    }
+    frozenSurface = std::move(it->second);
+    m_frozenSurfaces.erase(it);
+  }
+
+  if (frozenSurface.released) {
+    visit(surfaceId, [](const facebook::react::SurfaceHandler &surfaceHandler) {
+      if (surfaceHandler.getStatus() == facebook::react::SurfaceHandler::Status::Registered) {
+        surfaceHandler.start();
+      }
+    });
+  } else if (frozenSurface.pendingCoordinator) {
+    // The coordinator diffs the mounted tree with the latest one, so the deferred transactions are mounted as one
+    if (m_backgroundMountPreparationEnabled) {
+      prepareTransaction(frozenSurface.pendingCoordinator);
+    } else {
+      initiateTransaction(std::move(frozenSurface.pendingCoordinator));
+    }
+  }
+}
+
+bool FabricUIManager::deferFrozenSurfaceTransaction(
+    std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator) noexcept {
+  std::scoped_lock lock{m_frozenSurfacesMutex};
+  auto it = m_frozenSurfaces.find(mountingCoordinator->getSurfaceId());
+  if (it == m_frozenSurfaces.end() || it->second.released) {
+    return false;
+  }
+  it->second.pendingCoordinator = mountingCoordinator;
+  return true;
+}
+
+void FabricUIManager::releaseFrozenSurfaces(size_t keepCount) noexcept {
+  std::vector<std::pair<uint64_t, facebook::react::SurfaceId>> keptSurfaces;
+  {
+    std::scoped_lock lock{m_frozenSurfacesMutex};
+    for (auto &[surfaceId, frozenSurface] : m_frozenSurfaces) {
+      if (!frozenSurface.released) {
+        keptSurfaces.emplace_back(frozenSurface.freezeOrder, surfaceId);
+      }
+    }
+    if (keptSurfaces.size() <= keepCount) {
+      return;
+    }
+    std::sort(keptSurfaces.begin(), keptSurfaces.end());
+    keptSurfaces.resize(keptSurfaces.size() - keepCount);
+    for (auto &[freezeOrder, surfaceId] : keptSurfaces) {
+      auto &frozenSurface = m_frozenSurfaces[surfaceId];
+      frozenSurface.released = true;
+      frozenSurface.pendingCoordinator = nullptr;
+    }
+  }
+
+  // Stopping the surface commits an empty tree, whose transaction deletes the views
+  for (auto &[freezeOrder, surfaceId] : keptSurfaces) {
+    visit(surfaceId, [](const facebook::react::SurfaceHandler &surfaceHandler) {
+      if (surfaceHandler.getStatus() == facebook::react::SurfaceHandler::Status::Running) {
+        surfaceHandler.stop();
+      }
+    });
+  }
 }
 
 facebook::react::Size FabricUIManager::measureSurface(
@@ -211,6 +365,106 @@ void FabricUIManager::constraintSurfaceLayout(
   });
 }
 
+void FabricUIManager::scheduleSurfaceLayout(
+    facebook::react::SurfaceId surfaceId,
+    const facebook::react::LayoutConstraints &layoutConstraints,
+    const facebook::react::LayoutContext &layoutContext) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+
+  auto wasEmpty = m_scheduledSurfaceLayouts.empty();
+  m_scheduledSurfaceLayouts[surfaceId] = {layoutConstraints, layoutContext};
+  if (!wasEmpty) {
+    return;
+  }
+
+  m_context.UIDispatcher().Post([wkThis = weak_from_this()]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->performScheduledSurfaceLayouts();
+    }
+  });
+}
+
+// The transactions committed by the layouts of performScheduledSurfaceLayouts, which are mounted together once every
+// surface is laid out
+struct SurfaceLayoutTransactions {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<const facebook::react::MountingCoordinator>> mountingCoordinators;
+};
+
+// Set while the current thread lays out surfaces for performScheduledSurfaceLayouts
+static thread_local SurfaceLayoutTransactions *t_surfaceLayoutTransactions = nullptr;
+
+static bool CollectSurfaceLayoutTransaction(
+    std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator) noexcept {
+  if (!t_surfaceLayoutTransactions) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(t_surfaceLayoutTransactions->mutex);
+  auto &mountingCoordinators = t_surfaceLayoutTransactions->mountingCoordinators;
+  if (std::find(mountingCoordinators.begin(), mountingCoordinators.end(), mountingCoordinator) ==
+      mountingCoordinators.end()) {
+    mountingCoordinators.push_back(mountingCoordinator);
+  }
+  return true;
+}
+
+void FabricUIManager::performScheduledSurfaceLayouts() noexcept {
+  struct SurfaceLayout {
+    facebook::react::SurfaceId surfaceId;
+    ScheduledSurfaceLayout layout;
+  };
+
+  // Like BuildPendingTextLayouts, the calling thread takes part.  It does not wait for the layouts started elsewhere,
+  // as a layout or its commit may need the UI thread; the last thread to finish posts the mount of all the transactions
+  struct SharedState {
+    std::weak_ptr<FabricUIManager> weakUIManager;
+    winrt::Microsoft::ReactNative::ReactDispatcher uiDispatcher{nullptr};
+    std::vector<SurfaceLayout> layouts;
+    std::atomic<size_t> nextIndex{0};
+    std::atomic<size_t> completedCount{0};
+    SurfaceLayoutTransactions transactions;
+
+    void run(std::shared_ptr<SharedState> const &self) noexcept {
+      size_t laidOutCount = 0;
+      if (auto uiManager = weakUIManager.lock()) {
+        t_surfaceLayoutTransactions = &transactions;
+        for (size_t index; (index = nextIndex++) < layouts.size();) {
+          auto const &surfaceLayout = layouts[index];
+          uiManager->constraintSurfaceLayout(
+              surfaceLayout.surfaceId, surfaceLayout.layout.layoutConstraints, surfaceLayout.layout.layoutContext);
+          laidOutCount++;
+        }
+        t_surfaceLayoutTransactions = nullptr;
+      }
+
+      if (laidOutCount && (completedCount += laidOutCount) == layouts.size()) {
+        uiDispatcher.Post([self]() {
+          if (auto uiManager = self->weakUIManager.lock()) {
+            for (auto const &mountingCoordinator : self->transactions.mountingCoordinators) {
+              uiManager->initiateTransaction(mountingCoordinator);
+            }
+          }
+        });
+      }
+    }
+  };
+
+  auto state = std::make_shared<SharedState>();
+  state->weakUIManager = weak_from_this();
+  state->uiDispatcher = m_context.UIDispatcher();
+  for (auto &[surfaceId, layout] : m_scheduledSurfaceLayouts) {
+    state->layouts.push_back({surfaceId, std::move(layout)});
+  }
+  m_scheduledSurfaceLayouts.clear();
+
+  auto threadCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), state->layouts.size());
+  for (size_t i = 1; i < threadCount; i++) {
+    Mso::DispatchQueue::ConcurrentQueue().Post([state]() noexcept { state->run(state); });
+  }
+  state->run(state);
+}
+
 void FabricUIManager::visit(
     facebook::react::SurfaceId surfaceId,
     const std::function<void(const facebook::react::SurfaceHandler &surfaceHandler)> &callback) const noexcept {
@@ -232,144 +486,820 @@ FabricUIManager::NotifyMountedId() noexcept {
 
 void FabricUIManager::didMountComponentsWithRootTag(facebook::react::SurfaceId surfaceId) noexcept {
   m_context.UIDispatcher().Post([context = m_context, self = shared_from_this(), surfaceId]() {
+    if (self->m_startupTimeline) {
+      self->m_startupTimeline->StopPhase(Mso::React::StartupPhase::FirstMount);
+    }
     self->m_scheduler->reportMount(surfaceId);
     context.Notifications().SendNotification(NotifyMountedId(), surfaceId);
   });
 }
 
+winrt::Microsoft::ReactNative::ReactNotificationId<winrt::Microsoft::ReactNative::IReactPropertyBag>
+FabricUIManager::NotifyMountingTransactionId() noexcept {
+  return {L"ReactNative.Fabric", L"MountingTransaction"};
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<bool>
+FabricUIManager::MountingTransactionTelemetryEnabledProperty() noexcept {
+  return {L"ReactNative.Fabric", L"MountingTransactionTelemetryEnabled"};
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> FabricUIManager::TimeSlicedMountingProperty() noexcept {
+  return {L"ReactNative.Fabric", L"TimeSlicedMounting"};
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> FabricUIManager::BackgroundMountPreparationProperty() noexcept {
+  return {L"ReactNative.Fabric", L"BackgroundMountPreparation"};
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> FabricUIManager::CompositorEventBeatProperty() noexcept {
+  return {L"ReactNative.Fabric", L"CompositorEventBeat"};
+}
+
+// Transactions with fewer mutations than this are always mounted in a single pass
+constexpr size_t TimeSlicedMountingMutationThreshold = 1000;
+// Half of a 60Hz frame, leaving time for the compositor and input
+constexpr std::chrono::milliseconds TimeSlicedMountingSliceDuration{8};
+constexpr size_t TimeSlicedMountingInputCheckInterval = 32;
+
+void FabricUIManager::addMountingTransactionObserver(
+    std::shared_ptr<IMountingTransactionObserver> const &observer) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  m_mountingTransactionObservers.push_back(observer);
+}
+
+void FabricUIManager::removeMountingTransactionObserver(
+    std::shared_ptr<IMountingTransactionObserver> const &observer) noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  m_mountingTransactionObservers.erase(
+      std::remove(m_mountingTransactionObservers.begin(), m_mountingTransactionObservers.end(), observer),
+      m_mountingTransactionObservers.end());
+}
+
+void FabricUIManager::setPerformanceOverlayVisible(bool visible) noexcept {
+  m_context.UIDispatcher().Post([wkThis = weak_from_this(), visible]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->updatePerformanceOverlay(visible);
+    }
+  });
+}
+
+void FabricUIManager::togglePerformanceOverlay() noexcept {
+  m_context.UIDispatcher().Post([wkThis = weak_from_this()]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->updatePerformanceOverlay(!pThis->m_performanceOverlay);
+    }
+  });
+}
+
+std::map<std::string, ComponentViewRegistry::ComponentViewCount> FabricUIManager::componentViewCounts()
+    const noexcept {
+  return m_registry.componentViewCounts();
+}
+
+void FabricUIManager::registerCaches() noexcept {
+  m_cacheBudgetManager = Mso::React::CacheBudgetManager::FromProperties(m_context.Properties());
+
+  // The trim callbacks are called on the UI thread, and the manager is released with the instance properties, after
+  // this FabricUIManager has unregistered them
+  m_cacheRegistrationTokens.push_back(m_cacheBudgetManager->Register(
+      {"themeBrushes",
+       Mso::React::CacheTrimPriority::First,
+       nullptr,
+       [wkThis = weak_from_this()](auto /*level*/) noexcept {
+         if (auto pThis = wkThis.lock()) {
+           winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::Theme>(
+               winrt::Microsoft::ReactNative::Composition::implementation::Theme::GetDefaultTheme(
+                   pThis->m_context.Handle()))
+               ->TrimCaches();
+         }
+       }}));
+  m_cacheRegistrationTokens.push_back(m_cacheBudgetManager->Register(
+      {"textLayoutCache", Mso::React::CacheTrimPriority::First, nullptr, [](auto /*level*/) noexcept {
+         facebook::react::WindowsTextLayoutManager::ClearMeasuredTextLayouts();
+       }}));
+  m_cacheRegistrationTokens.push_back(m_cacheBudgetManager->Register(
+      {"recycledComponentViews",
+       Mso::React::CacheTrimPriority::Normal,
+       nullptr,
+       [wkThis = weak_from_this()](auto /*level*/) noexcept {
+         if (auto pThis = wkThis.lock()) {
+           pThis->m_registry.clearRecyclePools();
+         }
+       }}));
+  m_cacheRegistrationTokens.push_back(m_cacheBudgetManager->Register(
+      {"frozenSurfaces",
+       Mso::React::CacheTrimPriority::Last,
+       nullptr,
+       [wkThis = weak_from_this()](Mso::React::CacheTrimLevel level) noexcept {
+         if (auto pThis = wkThis.lock()) {
+           size_t keepCount = 0;
+           if (level == Mso::React::CacheTrimLevel::Moderate) {
+             std::scoped_lock lock{pThis->m_frozenSurfacesMutex};
+             keepCount = pThis->m_frozenSurfaces.size() / 2;
+           }
+           pThis->releaseFrozenSurfaces(keepCount);
+         }
+       }}));
+  m_cacheRegistrationTokens.push_back(m_cacheBudgetManager->Register(
+      {"decodedImageCache",
+       Mso::React::CacheTrimPriority::Last,
+       []() noexcept { return DecodedImageCache::Instance().byteSize(); },
+       [](Mso::React::CacheTrimLevel level) noexcept {
+         auto &cache = DecodedImageCache::Instance();
+         if (level == Mso::React::CacheTrimLevel::Complete) {
+           cache.clear();
+         } else {
+           cache.trim(cache.byteSize() / 2);
+         }
+       }}));
+}
+
+void FabricUIManager::updatePerformanceOverlay(bool visible) noexcept {
+  if (visible == !!m_performanceOverlay) {
+    return;
+  }
+
+  if (visible) {
+    m_performanceOverlay = std::make_shared<PerformanceOverlay>(m_context, m_compContext, m_registry);
+    addMountingTransactionObserver(m_performanceOverlay);
+    m_performanceOverlay->Show(m_surfaceRegistry.empty() ? -1 : m_surfaceRegistry.begin()->first);
+  } else {
+    m_performanceOverlay->Hide();
+    removeMountingTransactionObserver(m_performanceOverlay);
+    m_performanceOverlay = nullptr;
+  }
+}
+
+void FabricUIManager::publishMountingTransactionMetrics(MountingTransactionMetrics const &metrics) noexcept {
+  auto mountDurationMs = std::chrono::duration<double, std::milli>(metrics.mountDuration).count();
+  auto commitToMountLatencyMs = std::chrono::duration<double, std::milli>(metrics.commitToMountLatency).count();
+
+  facebook::react::tracing::logMountingTransaction(
+      metrics.surfaceId,
+      metrics.transactionNumber,
+      metrics.createCount,
+      metrics.deleteCount,
+      metrics.insertCount,
+      metrics.removeCount,
+      metrics.updateCount,
+      metrics.compositionObjectCreations,
+      metrics.compositionPropertySets,
+      metrics.compositionBrushUpdates,
+      mountDurationMs,
+      commitToMountLatencyMs);
+
+  if (!m_mountingTransactionTelemetryEnabled) {
+    return;
+  }
+
+  constexpr wchar_t ns[] = L"ReactNative.Fabric.MountingTransaction";
+  winrt::Microsoft::ReactNative::ReactPropertyBag data{
+      winrt::Microsoft::ReactNative::ReactPropertyBagHelper::CreatePropertyBag()};
+  data.Set(winrt::Microsoft::ReactNative::ReactPropertyId<int32_t>{ns, L"SurfaceId"}, metrics.surfaceId);
+  data.Set(
+      winrt::Microsoft::ReactNative::ReactPropertyId<int64_t>{ns, L"TransactionNumber"}, metrics.transactionNumber);
+  data.Set(winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"CreateCount"}, metrics.createCount);
+  data.Set(winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"DeleteCount"}, metrics.deleteCount);
+  data.Set(winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"InsertCount"}, metrics.insertCount);
+  data.Set(winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"RemoveCount"}, metrics.removeCount);
+  data.Set(winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"UpdateCount"}, metrics.updateCount);
+  data.Set(
+      winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"CompositionObjectCreations"},
+      metrics.compositionObjectCreations);
+  data.Set(
+      winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"CompositionPropertySets"},
+      metrics.compositionPropertySets);
+  data.Set(
+      winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t>{ns, L"CompositionBrushUpdates"},
+      metrics.compositionBrushUpdates);
+  data.Set(winrt::Microsoft::ReactNative::ReactPropertyId<double>{ns, L"MountDurationMs"}, mountDurationMs);
+  data.Set(
+      winrt::Microsoft::ReactNative::ReactPropertyId<double>{ns, L"CommitToMountLatencyMs"}, commitToMountLatencyMs);
+  m_context.Notifications().SendNotification(NotifyMountingTransactionId(), data.Handle());
+}
+
 void FabricUIManager::RCTPerformMountInstructions(
     facebook::react::ShadowViewMutationList const &mutations,
     // facebook::react::RCTComponentViewRegistry* registry,
-    // facebook::react::RCTMountingTransactionObserverCoordinator& observerCoordinator,
+    MountingTransactionMetrics &metrics,
     facebook::react::SurfaceId surfaceId) {
-  for (auto const &mutation : mutations) {
-    switch (mutation.type) {
-      case facebook::react::ShadowViewMutation::Create: {
-        auto &newChildShadowView = mutation.newChildShadowView;
-        auto &newChildViewDescriptor = m_registry.dequeueComponentViewWithComponentHandle(
-            newChildShadowView.componentHandle, newChildShadowView.tag, m_compContext);
-        // observerCoordinator.registerViewComponentDescriptor(newChildViewDescriptor, surfaceId);
-        break;
+  std::optional<LayoutAnimationDelegate::PendingLayoutAnimation> layoutAnimation;
+  if (m_layoutAnimationDelegate) {
+    layoutAnimation = m_layoutAnimationDelegate->takePendingLayoutAnimation();
+  }
+
+  if (layoutAnimation) {
+    m_mountingLayoutAnimation = &*layoutAnimation;
+    if (auto compositor =
+            winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerCompositor(
+                m_compContext)) {
+      m_layoutAnimationBatch =
+          compositor.CreateScopedBatch(winrt::Microsoft::UI::Composition::CompositionBatchTypes::Animation);
+      m_layoutAnimationBatch.Suspend();
+    }
+  }
+
+  for (size_t i = 0; i < mutations.size();) {
+    auto runLength = mountInstructionRunLength(mutations, i);
+    if (runLength > 1) {
+      performBatchedMountInstructions(mutations, i, runLength, metrics);
+    } else {
+      performMountInstruction(mutations[i], metrics);
+    }
+    i += runLength;
+  }
+
+  if (!layoutAnimation) {
+    return;
+  }
+
+  m_mountingLayoutAnimation = nullptr;
+  m_layoutAnimationCreatedTags.clear();
+  if (auto layoutAnimationBatch = std::exchange(m_layoutAnimationBatch, nullptr)) {
+    if (layoutAnimation->onComplete) {
+      layoutAnimationBatch.Completed(
+          [onComplete = std::move(layoutAnimation->onComplete)](auto const & /*sender*/, auto const & /*args*/) {
+            onComplete();
+          });
+    }
+    layoutAnimationBatch.Resume();
+    layoutAnimationBatch.End();
+  } else if (layoutAnimation->onComplete) {
+    // Without lifted composition no transitions are run
+    layoutAnimation->onComplete();
+  }
+}
+
+// Returns the number of mutations starting at start that can be applied as a single batch: consecutive Inserts into
+// the same parent at ascending indices, or consecutive Removes from the same parent at descending indices (the order
+// the differ emits them in).
+size_t FabricUIManager::mountInstructionRunLength(
+    facebook::react::ShadowViewMutationList const &mutations,
+    size_t start) noexcept {
+  auto const &first = mutations[start];
+  if (first.type != facebook::react::ShadowViewMutation::Insert &&
+      first.type != facebook::react::ShadowViewMutation::Remove) {
+    return 1;
+  }
+
+  auto end = start + 1;
+  for (; end < mutations.size(); end++) {
+    auto const &mutation = mutations[end];
+    auto const &previous = mutations[end - 1];
+    if (mutation.type != first.type || mutation.parentTag != first.parentTag) {
+      break;
+    }
+    if (first.type == facebook::react::ShadowViewMutation::Insert ? mutation.index != previous.index + 1
+                                                                   : mutation.index + 1 != previous.index) {
+      break;
+    }
+  }
+  return end - start;
+}
+
+void FabricUIManager::performBatchedMountInstructions(
+    facebook::react::ShadowViewMutationList const &mutations,
+    size_t start,
+    size_t count,
+    MountingTransactionMetrics &metrics) {
+  auto const &first = mutations[start];
+  std::vector<winrt::Microsoft::ReactNative::ComponentView> childComponentViews;
+  childComponentViews.reserve(count);
+
+  if (first.type == facebook::react::ShadowViewMutation::Insert) {
+    for (auto i = start; i < start + count; i++) {
+      metrics.insertCount++;
+      childComponentViews.push_back(updateComponentViewForInsert(mutations[i]));
+    }
+    parentComponentViewWithTag(first.parentTag)->MountChildComponentViews(childComponentViews, first.index);
+  } else {
+    // Removes are at descending indices, but the children are passed in index order
+    for (auto i = start + count; i > start; i--) {
+      metrics.removeCount++;
+      auto const &oldChildShadowView = mutations[i - 1].oldChildShadowView;
+      childComponentViews.push_back(m_registry.componentViewDescriptorWithTag(oldChildShadowView.tag).view);
+    }
+    parentComponentViewWithTag(first.parentTag)
+        ->UnmountChildComponentViews(childComponentViews, mutations[start + count - 1].index);
+  }
+}
+
+winrt::Microsoft::ReactNative::ComponentView FabricUIManager::updateComponentViewForInsert(
+    facebook::react::ShadowViewMutation const &mutation) noexcept {
+  auto &oldChildShadowView = mutation.oldChildShadowView;
+  auto &newChildShadowView = mutation.newChildShadowView;
+  auto &newChildViewDescriptor = m_registry.componentViewDescriptorWithTag(newChildShadowView.tag);
+  auto newChildComponentView =
+      winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(newChildViewDescriptor.view);
+
+  newChildComponentView->updateProps(newChildShadowView.props, oldChildShadowView.props);
+  newChildComponentView->updateEventEmitter(newChildShadowView.eventEmitter);
+  newChildComponentView->updateState(newChildShadowView.state, oldChildShadowView.state);
+  newChildComponentView->updateLayoutMetrics(newChildShadowView.layoutMetrics, oldChildShadowView.layoutMetrics);
+  adoptPreparedTextLayout(newChildShadowView, *newChildComponentView);
+  newChildComponentView->FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentViewUpdateMask::All);
+  if (m_mountingLayoutAnimation) {
+    startLayoutTransition(mutation, newChildViewDescriptor.view);
+  }
+  return newChildViewDescriptor.view;
+}
+
+// Starts the create transition of a view created in this transaction as it is inserted, or the update transition of a
+// view whose layout changed.  Views moved to a new parent, or removed, are not animated.
+void FabricUIManager::startLayoutTransition(
+    facebook::react::ShadowViewMutation const &mutation,
+    winrt::Microsoft::ReactNative::ComponentView const &componentView) noexcept {
+  auto compositionView =
+      componentView.try_as<winrt::Microsoft::ReactNative::Composition::implementation::ComponentView>();
+  if (!compositionView) {
+    return;
+  }
+
+  auto const &animations = m_mountingLayoutAnimation->animations;
+  if (m_layoutAnimationBatch) {
+    m_layoutAnimationBatch.Resume();
+  }
+  if (mutation.type == facebook::react::ShadowViewMutation::Insert) {
+    if (m_layoutAnimationCreatedTags.count(mutation.newChildShadowView.tag)) {
+      compositionView->startCreateTransition(animations.createAnimationProps);
+    }
+  } else if (mutation.type == facebook::react::ShadowViewMutation::Update) {
+    compositionView->startUpdateTransition(
+        animations.updateAnimationProps, mutation.oldChildShadowView.layoutMetrics);
+  }
+  if (m_layoutAnimationBatch) {
+    m_layoutAnimationBatch.Suspend();
+  }
+}
+
+void FabricUIManager::adoptPreparedTextLayout(
+    facebook::react::ShadowView const &shadowView,
+    winrt::Microsoft::ReactNative::implementation::ComponentView &componentView) noexcept {
+  if (!m_mountingTextLayouts || m_mountingTextLayouts->empty()) {
+    return;
+  }
+
+  auto it = m_mountingTextLayouts->find(shadowView.tag);
+  if (it == m_mountingTextLayouts->end()) {
+    return;
+  }
+
+  // Only Paragraph views have entries, see prepareTransaction
+  static_cast<winrt::Microsoft::ReactNative::Composition::implementation::ParagraphComponentView &>(componentView)
+      .SetPreparedTextLayout(std::move(it->second));
+  m_mountingTextLayouts->erase(it);
+}
+
+winrt::Microsoft::ReactNative::implementation::ComponentView *FabricUIManager::parentComponentViewWithTag(
+    facebook::react::Tag tag) noexcept {
+  if (tag != m_cachedParentTag || !m_cachedParentComponentView) {
+    m_cachedParentTag = tag;
+    m_cachedParentComponentView = winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(
+        m_registry.componentViewDescriptorWithTag(tag).view);
+  }
+  return m_cachedParentComponentView;
+}
+
+void FabricUIManager::invalidateParentComponentViewCache(facebook::react::Tag tag) noexcept {
+  if (tag == m_cachedParentTag) {
+    m_cachedParentTag = -1;
+    m_cachedParentComponentView = nullptr;
+  }
+}
+
+void FabricUIManager::performMountInstruction(
+    facebook::react::ShadowViewMutation const &mutation,
+    MountingTransactionMetrics &metrics) {
+  switch (mutation.type) {
+    case facebook::react::ShadowViewMutation::Create: {
+      metrics.createCount++;
+      auto &newChildShadowView = mutation.newChildShadowView;
+      auto &newChildViewDescriptor = m_registry.dequeueComponentViewWithComponentHandle(
+          newChildShadowView.componentHandle, newChildShadowView.tag, m_compContext);
+      // observerCoordinator.registerViewComponentDescriptor(newChildViewDescriptor, surfaceId);
+      if (m_mountingLayoutAnimation) {
+        m_layoutAnimationCreatedTags.insert(newChildShadowView.tag);
       }
+      break;
+    }
 
-      case facebook::react::ShadowViewMutation::Delete: {
+    case facebook::react::ShadowViewMutation::Delete: {
+      metrics.deleteCount++;
 // #define DETECT_COMPONENT_OUTLIVE_DELETE_MUTATION
 #ifdef DETECT_COMPONENT_OUTLIVE_DELETE_MUTATION
-        winrt::weak_ref<winrt::Microsoft::ReactNative::ComponentView> wkView;
+      winrt::weak_ref<winrt::Microsoft::ReactNative::ComponentView> wkView;
 #endif
-        {
-          auto &oldChildShadowView = mutation.oldChildShadowView;
-          auto &oldChildViewDescriptor = m_registry.componentViewDescriptorWithTag(oldChildShadowView.tag);
-          // observerCoordinator.unregisterViewComponentDescriptor(oldChildViewDescriptor, surfaceId);
+      {
+        auto &oldChildShadowView = mutation.oldChildShadowView;
+        auto &oldChildViewDescriptor = m_registry.componentViewDescriptorWithTag(oldChildShadowView.tag);
+        // observerCoordinator.unregisterViewComponentDescriptor(oldChildViewDescriptor, surfaceId);
 #ifdef DETECT_COMPONENT_OUTLIVE_DELETE_MUTATION
-          wkView = winrt::make_weak(oldChildViewDescriptor.view);
+        wkView = winrt::make_weak(oldChildViewDescriptor.view);
 #endif
-          m_registry.enqueueComponentViewWithComponentHandle(
-              oldChildShadowView.componentHandle, oldChildShadowView.tag, oldChildViewDescriptor);
-        }
+        invalidateParentComponentViewCache(oldChildShadowView.tag);
+        m_registry.enqueueComponentViewWithComponentHandle(
+            oldChildShadowView.componentHandle, oldChildShadowView.tag, oldChildViewDescriptor);
+      }
 #ifdef DETECT_COMPONENT_OUTLIVE_DELETE_MUTATION
-        // After handling a delete mutation, nothing should be holding on to the view.  If there is thats an indication
-        // of a leak, or at least something holding on to a view longer than it should
-        assert(!wkView.get());
+      // After handling a delete mutation, nothing should be holding on to the view.  If there is thats an indication
+      // of a leak, or at least something holding on to a view longer than it should
+      assert(!wkView.get());
 #endif
-        break;
-      }
+      break;
+    }
 
-      case facebook::react::ShadowViewMutation::Insert: {
-        auto &oldChildShadowView = mutation.oldChildShadowView;
-        auto &newChildShadowView = mutation.newChildShadowView;
-        auto &parentTag = mutation.parentTag;
-        auto &newChildViewDescriptor = m_registry.componentViewDescriptorWithTag(newChildShadowView.tag);
-        auto parentViewDescriptor = m_registry.componentViewDescriptorWithTag(parentTag);
-        auto newChildComponentView =
-            winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(newChildViewDescriptor.view);
+    case facebook::react::ShadowViewMutation::Insert: {
+      metrics.insertCount++;
+      auto newChildComponentView = updateComponentViewForInsert(mutation);
+      parentComponentViewWithTag(mutation.parentTag)->MountChildComponentView(newChildComponentView, mutation.index);
+      break;
+    }
 
+    case facebook::react::ShadowViewMutation::Remove: {
+      metrics.removeCount++;
+      auto &oldChildShadowView = mutation.oldChildShadowView;
+      auto &parentTag = mutation.parentTag;
+      auto &oldChildViewDescriptor = m_registry.componentViewDescriptorWithTag(oldChildShadowView.tag);
+      parentComponentViewWithTag(parentTag)->UnmountChildComponentView(oldChildViewDescriptor.view, mutation.index);
+      break;
+    }
+
+    case facebook::react::ShadowViewMutation::Update: {
+      metrics.updateCount++;
+      auto &oldChildShadowView = mutation.oldChildShadowView;
+      auto &newChildShadowView = mutation.newChildShadowView;
+      auto &newChildViewDescriptor = m_registry.componentViewDescriptorWithTag(newChildShadowView.tag);
+      auto newChildComponentView =
+          winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(newChildViewDescriptor.view);
+      auto mask = winrt::Microsoft::ReactNative::ComponentViewUpdateMask::None;
+
+      if (oldChildShadowView.props != newChildShadowView.props) {
         newChildComponentView->updateProps(newChildShadowView.props, oldChildShadowView.props);
+        mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::Props;
+      }
+
+      if (oldChildShadowView.eventEmitter != newChildShadowView.eventEmitter) {
         newChildComponentView->updateEventEmitter(newChildShadowView.eventEmitter);
+        mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::EventEmitter;
+      }
+
+      if (oldChildShadowView.state != newChildShadowView.state) {
         newChildComponentView->updateState(newChildShadowView.state, oldChildShadowView.state);
+        mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::State;
+      }
+
+      if (oldChildShadowView.layoutMetrics != newChildShadowView.layoutMetrics) {
         newChildComponentView->updateLayoutMetrics(newChildShadowView.layoutMetrics, oldChildShadowView.layoutMetrics);
-        newChildComponentView->FinalizeUpdates(winrt::Microsoft::ReactNative::ComponentViewUpdateMask::All);
+        mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::LayoutMetrics;
+      }
 
-        winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(parentViewDescriptor.view)
-            ->MountChildComponentView(*newChildComponentView, mutation.index);
-        break;
+      if (mask != winrt::Microsoft::ReactNative::ComponentViewUpdateMask::None) {
+        adoptPreparedTextLayout(newChildShadowView, *newChildComponentView);
+        winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(newChildViewDescriptor.view)
+            ->FinalizeUpdates(mask);
       }
 
-      case facebook::react::ShadowViewMutation::Remove: {
-        auto &oldChildShadowView = mutation.oldChildShadowView;
-        auto &parentTag = mutation.parentTag;
-        auto &oldChildViewDescriptor = m_registry.componentViewDescriptorWithTag(oldChildShadowView.tag);
-        auto &parentViewDescriptor = m_registry.componentViewDescriptorWithTag(parentTag);
-        winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(parentViewDescriptor.view)
-            ->UnmountChildComponentView(oldChildViewDescriptor.view, mutation.index);
-        break;
+      if (m_mountingLayoutAnimation &&
+          (mask & winrt::Microsoft::ReactNative::ComponentViewUpdateMask::LayoutMetrics) ==
+              winrt::Microsoft::ReactNative::ComponentViewUpdateMask::LayoutMetrics) {
+        startLayoutTransition(mutation, newChildViewDescriptor.view);
       }
 
-      case facebook::react::ShadowViewMutation::Update: {
-        auto &oldChildShadowView = mutation.oldChildShadowView;
-        auto &newChildShadowView = mutation.newChildShadowView;
-        auto &newChildViewDescriptor = m_registry.componentViewDescriptorWithTag(newChildShadowView.tag);
-        auto newChildComponentView =
-            winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(newChildViewDescriptor.view);
-        auto mask = winrt::Microsoft::ReactNative::ComponentViewUpdateMask::None;
-
-        if (oldChildShadowView.props != newChildShadowView.props) {
-          newChildComponentView->updateProps(newChildShadowView.props, oldChildShadowView.props);
-          mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::Props;
-        }
+      break;
+    }
+  }
+}
 
-        if (oldChildShadowView.eventEmitter != newChildShadowView.eventEmitter) {
-          newChildComponentView->updateEventEmitter(newChildShadowView.eventEmitter);
-          mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::EventEmitter;
-        }
+// Adds the composition work done on the UI thread since start to the metrics of the transaction being mounted
+static void AddCompositionWork(
+    MountingTransactionMetrics &metrics,
+    const Composition::CompositionWorkCounts &start) noexcept {
+  auto end = Composition::CurrentThreadCompositionWork();
+  metrics.compositionObjectCreations += end.ObjectCreations - start.ObjectCreations;
+  metrics.compositionPropertySets += end.PropertySets - start.PropertySets;
+  metrics.compositionBrushUpdates += end.BrushUpdates - start.BrushUpdates;
+}
 
-        if (oldChildShadowView.state != newChildShadowView.state) {
-          newChildComponentView->updateState(newChildShadowView.state, oldChildShadowView.state);
-          mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::State;
-        }
+void FabricUIManager::traceCompositionCommit(MountingTransactionMetrics const &metrics) noexcept {
+  if (!facebook::react::tracing::isMountTracing()) {
+    return;
+  }
 
-        if (oldChildShadowView.layoutMetrics != newChildShadowView.layoutMetrics) {
-          newChildComponentView->updateLayoutMetrics(
-              newChildShadowView.layoutMetrics, oldChildShadowView.layoutMetrics);
-          mask |= winrt::Microsoft::ReactNative::ComponentViewUpdateMask::LayoutMetrics;
-        }
+  // The current commit batch is the one that the compositor commits with the changes made by the mount
+  auto onCommitted = [surfaceId = metrics.surfaceId,
+                      transactionNumber = metrics.transactionNumber,
+                      mountEndTime = std::chrono::steady_clock::now()](auto const &, auto const &) noexcept {
+    facebook::react::tracing::logCompositionCommit(
+        surfaceId,
+        transactionNumber,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mountEndTime).count());
+  };
+  if (auto compositor =
+          winrt::Microsoft::ReactNative::Composition::Experimental::CompositionContextHelper::InnerCompositor(
+              m_compContext)) {
+    compositor.GetCommitBatch(winrt::Microsoft::UI::Composition::CompositionBatchTypes::None).Completed(onCommitted);
+  } else if (
+      auto systemCompositor =
+          winrt::Microsoft::ReactNative::Composition::Experimental::SystemCompositionContextHelper::InnerCompositor(
+              m_compContext)) {
+    systemCompositor.GetCommitBatch(winrt::Windows::UI::Composition::CompositionBatchTypes::None)
+        .Completed(onCommitted);
+  }
+}
 
-        if (mask != winrt::Microsoft::ReactNative::ComponentViewUpdateMask::None) {
-          winrt::get_self<winrt::Microsoft::ReactNative::implementation::ComponentView>(newChildViewDescriptor.view)
-              ->FinalizeUpdates(mask);
-        }
+void FabricUIManager::completeMountingTransaction(
+    facebook::react::MountingTransaction const &transaction,
+    facebook::react::SurfaceTelemetry const &surfaceTelemetry,
+    MountingTransactionMetrics &metrics) noexcept {
+  auto surfaceId = transaction.getSurfaceId();
+  metrics.surfaceId = surfaceId;
+  metrics.transactionNumber = transaction.getNumber();
+  auto commitEndTime = transaction.getTelemetry().getCommitEndTime();
+  if (commitEndTime != facebook::react::kTelemetryUndefinedTimePoint) {
+    metrics.commitToMountLatency = facebook::react::telemetryTimePointNow() - commitEndTime;
+  }
 
-        break;
-      }
-    }
+  for (auto const &observer : m_mountingTransactionObservers) {
+    observer->mountingTransactionDidMount(transaction, surfaceTelemetry, metrics);
   }
+  publishMountingTransactionMetrics(metrics);
+  traceCompositionCommit(metrics);
+  // Mounting is what fills the caches of text layouts, images and brushes
+  m_cacheBudgetManager->EnforceBudget();
+  // Mounting takes views out of the recycle pools, which makes room for preallocations
+  refreshPreallocationCapacities();
+
+  didMountComponentsWithRootTag(surfaceId);
+  //[self.delegate mountingManager:self didMountComponentsWithRootTag:surfaceId];
 }
 
 void FabricUIManager::performTransaction(
     std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator) {
   auto surfaceId = mountingCoordinator->getSurfaceId();
+  Mso::DispatchQueueMetrics::SetCurrentTaskName("MountTransaction");
+  Mso::DispatchQueueMetrics::SetCurrentTaskOrigin("MountTransaction surface " + std::to_string(surfaceId));
+
+  MountingTransactionMetrics metrics;
+  bool timeSliced = false;
 
   mountingCoordinator->getTelemetryController().pullTransaction(
       [&](facebook::react::MountingTransaction const &transaction,
           facebook::react::SurfaceTelemetry const &surfaceTelemetry) {
         //[self.delegate mountingManager:self willMountComponentsWithRootTag:surfaceId];
-        // _observerCoordinator.notifyObserversMountingTransactionWillMount(transaction, surfaceTelemetry);
+        for (auto const &observer : m_mountingTransactionObservers) {
+          observer->mountingTransactionWillMount(transaction, surfaceTelemetry);
+        }
       },
       [&](facebook::react::MountingTransaction const &transaction,
           facebook::react::SurfaceTelemetry const &surfaceTelemetry) {
-        RCTPerformMountInstructions(
-            transaction.getMutations(), /* _componentViewRegistry, _observerCoordinator,*/ surfaceId);
+        if (m_timeSlicedMountingEnabled && transaction.getMutations().size() >= TimeSlicedMountingMutationThreshold) {
+          startTimeSlicedMount(transaction);
+          timeSliced = true;
+          return;
+        }
+
+        auto mountStartTime = facebook::react::telemetryTimePointNow();
+        auto compositionWorkStart = Composition::CurrentThreadCompositionWork();
+        RCTPerformMountInstructions(transaction.getMutations(), /* _componentViewRegistry,*/ metrics, surfaceId);
+        metrics.mountDuration = facebook::react::telemetryTimePointNow() - mountStartTime;
+        AddCompositionWork(metrics, compositionWorkStart);
       },
       [&](facebook::react::MountingTransaction const &transaction,
           facebook::react::SurfaceTelemetry const &surfaceTelemetry) {
-        //_observerCoordinator.notifyObserversMountingTransactionDidMount(transaction, surfaceTelemetry);
-        didMountComponentsWithRootTag(surfaceId);
-        //[self.delegate mountingManager:self didMountComponentsWithRootTag:surfaceId];
+        if (timeSliced) {
+          // The transaction is completed once its last slice has been mounted
+          m_timeSlicedMounts.at(surfaceId)->surfaceTelemetry = surfaceTelemetry;
+          return;
+        }
+        completeMountingTransaction(transaction, surfaceTelemetry, metrics);
       });
 }
 
+bool FabricUIManager::isMountPending() const noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+  return !m_timeSlicedMounts.empty();
+}
+
+void FabricUIManager::startTimeSlicedMount(facebook::react::MountingTransaction const &transaction) noexcept {
+  // Transactions this large are not animated, but the LayoutAnimation they were configured with still completes
+  if (m_layoutAnimationDelegate) {
+    if (auto layoutAnimation = m_layoutAnimationDelegate->takePendingLayoutAnimation();
+        layoutAnimation && layoutAnimation->onComplete) {
+      layoutAnimation->onComplete();
+    }
+  }
+
+  // MountingTransaction is not copyable, so make our own copy that outlives the pullTransaction call
+  auto surfaceId = transaction.getSurfaceId();
+  auto mutations = transaction.getMutations();
+  auto &timeSlicedMount = *(m_timeSlicedMounts[surfaceId] = std::make_unique<TimeSlicedMount>(
+                                facebook::react::MountingTransaction{
+                                    surfaceId,
+                                    transaction.getNumber(),
+                                    std::move(mutations),
+                                    transaction.getTelemetry()}));
+  auto const &transactionMutations = timeSlicedMount.transaction.getMutations();
+  std::unordered_set<facebook::react::Tag> createdTags;
+  for (size_t i = 0; i < transactionMutations.size(); i++) {
+    auto const &mutation = transactionMutations[i];
+    bool detached = false;
+    switch (mutation.type) {
+      case facebook::react::ShadowViewMutation::Create:
+        createdTags.insert(mutation.newChildShadowView.tag);
+        detached = true;
+        break;
+      case facebook::react::ShadowViewMutation::Insert:
+        // A view that was already mounted could be moving into a new parent, which requires its Remove to run first
+        detached = createdTags.count(mutation.parentTag) && createdTags.count(mutation.newChildShadowView.tag);
+        break;
+      case facebook::react::ShadowViewMutation::Update:
+        detached = createdTags.count(mutation.newChildShadowView.tag);
+        break;
+      default:
+        break;
+    }
+    (detached ? timeSlicedMount.detachedMutations : timeSlicedMount.attachedMutations).push_back(i);
+  }
+
+  m_context.UIDispatcher().Post([wkThis = weak_from_this(), surfaceId]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->continueTimeSlicedMount(surfaceId);
+    }
+  });
+}
+
+static bool HasPendingInput() noexcept {
+  return HIWORD(::GetQueueStatus(QS_INPUT)) != 0;
+}
+
+void FabricUIManager::continueTimeSlicedMount(facebook::react::SurfaceId surfaceId, bool untilComplete) noexcept {
+  // The mount was completed when its surface stopped
+  auto it = m_timeSlicedMounts.find(surfaceId);
+  if (it == m_timeSlicedMounts.end()) {
+    return;
+  }
+
+  auto &timeSlicedMount = *it->second;
+  auto const &mutations = timeSlicedMount.transaction.getMutations();
+  auto const &detachedMutations = timeSlicedMount.detachedMutations;
+
+  auto sliceStartTime = facebook::react::telemetryTimePointNow();
+  auto sliceEndTime = sliceStartTime + TimeSlicedMountingSliceDuration;
+  auto compositionWorkStart = Composition::CurrentThreadCompositionWork();
+  m_mountingTextLayouts = &timeSlicedMount.textLayouts;
+  while (timeSlicedMount.nextDetachedMutation < detachedMutations.size()) {
+    performMountInstruction(
+        mutations[detachedMutations[timeSlicedMount.nextDetachedMutation++]], timeSlicedMount.metrics);
+    if (!untilComplete &&
+        (facebook::react::telemetryTimePointNow() >= sliceEndTime ||
+         ((timeSlicedMount.nextDetachedMutation % TimeSlicedMountingInputCheckInterval) == 0 && HasPendingInput()))) {
+      break;
+    }
+  }
+
+  if (timeSlicedMount.nextDetachedMutation < detachedMutations.size()) {
+    m_mountingTextLayouts = nullptr;
+    timeSlicedMount.metrics.mountDuration += facebook::react::telemetryTimePointNow() - sliceStartTime;
+    AddCompositionWork(timeSlicedMount.metrics, compositionWorkStart);
+    // Yield so that rendering and input can be processed before the next slice
+    m_context.UIDispatcher().Post([wkThis = weak_from_this(), surfaceId]() {
+      if (auto pThis = wkThis.lock()) {
+        pThis->continueTimeSlicedMount(surfaceId);
+      }
+    });
+    return;
+  }
+
+  // Everything that changes what is visible on the surface is applied at once
+  for (auto index : timeSlicedMount.attachedMutations) {
+    performMountInstruction(mutations[index], timeSlicedMount.metrics);
+  }
+  m_mountingTextLayouts = nullptr;
+  timeSlicedMount.metrics.mountDuration += facebook::react::telemetryTimePointNow() - sliceStartTime;
+  AddCompositionWork(timeSlicedMount.metrics, compositionWorkStart);
+
+  auto completedMount = std::move(it->second);
+  m_timeSlicedMounts.erase(it);
+  completeMountingTransaction(completedMount->transaction, completedMount->surfaceTelemetry, completedMount->metrics);
+
+  if (auto pending = m_pendingTimeSlicedCoordinators.find(surfaceId);
+      pending != m_pendingTimeSlicedCoordinators.end()) {
+    auto mountingCoordinator = std::move(pending->second);
+    m_pendingTimeSlicedCoordinators.erase(pending);
+    initiateTransaction(mountingCoordinator);
+  }
+  mountPreparedTransactions();
+}
+
+// Views that are hidden, and everything below them, are redrawn after all the visible views
+static void CollectRenderingDeviceRecoveryTags(
+    winrt::Microsoft::ReactNative::ComponentView const &view,
+    bool visible,
+    std::vector<facebook::react::Tag> &visibleTags,
+    std::vector<facebook::react::Tag> &hiddenTags) noexcept {
+  if (auto componentView = view.try_as<winrt::Microsoft::ReactNative::Composition::implementation::ComponentView>()) {
+    visible = visible && componentView->layoutMetrics().displayType != facebook::react::DisplayType::None;
+  }
+  if (auto viewComponentView =
+          view.try_as<winrt::Microsoft::ReactNative::Composition::implementation::ViewComponentView>()) {
+    visible = visible && !viewComponentView->Culled();
+  }
+
+  (visible ? visibleTags : hiddenTags).push_back(view.Tag());
+  for (auto const &child : view.Children()) {
+    CollectRenderingDeviceRecoveryTags(child, visible, visibleTags, hiddenTags);
+  }
+}
+
+void FabricUIManager::startRenderingDeviceRecovery() noexcept {
+  assert(m_context.UIDispatcher().HasThreadAccess());
+
+  // A device that is lost again during a recovery restarts it, as everything drawn so far was lost too
+  auto recoveryInProgress = m_nextRenderingDeviceRecoveryTag < m_renderingDeviceRecoveryTags.size();
+  std::vector<facebook::react::Tag> hiddenTags;
+  m_renderingDeviceRecoveryTags.clear();
+  m_nextRenderingDeviceRecoveryTag = 0;
+  for (auto const &surface : m_surfaceRegistry) {
+    if (auto rootView = m_registry.findComponentViewWithTag(surface.first)) {
+      CollectRenderingDeviceRecoveryTags(rootView, true /*visible*/, m_renderingDeviceRecoveryTags, hiddenTags);
+    }
+  }
+  m_renderingDeviceRecoveryTags.insert(m_renderingDeviceRecoveryTags.end(), hiddenTags.begin(), hiddenTags.end());
+
+  if (!recoveryInProgress) {
+    continueRenderingDeviceRecovery();
+  }
+}
+
+void FabricUIManager::continueRenderingDeviceRecovery() noexcept {
+  auto sliceEndTime = facebook::react::telemetryTimePointNow() + TimeSlicedMountingSliceDuration;
+  while (m_nextRenderingDeviceRecoveryTag < m_renderingDeviceRecoveryTags.size()) {
+    // Views deleted since the recovery started are skipped
+    if (auto view = m_registry.findComponentViewWithTag(
+            m_renderingDeviceRecoveryTags[m_nextRenderingDeviceRecoveryTag++])) {
+      if (auto componentView =
+              view.try_as<winrt::Microsoft::ReactNative::Composition::implementation::ComponentView>()) {
+        componentView->OnRenderingDeviceLost();
+      }
+    }
+
+    if (facebook::react::telemetryTimePointNow() >= sliceEndTime) {
+      break;
+    }
+  }
+
+  if (m_nextRenderingDeviceRecoveryTag < m_renderingDeviceRecoveryTags.size()) {
+    m_context.UIDispatcher().Post([wkThis = weak_from_this()]() {
+      if (auto pThis = wkThis.lock()) {
+        pThis->continueRenderingDeviceRecovery();
+      }
+    });
+    return;
+  }
+
+  m_renderingDeviceRecoveryTags.clear();
+  m_nextRenderingDeviceRecoveryTag = 0;
+}
+
+void FabricUIManager::postTransaction(
+    std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator) noexcept {
+  // Mounts share the UI batching queue with the updates of the native animated nodes, so that both are applied in the
+  // order they were posted, in as few UI tasks as possible.  That queue records its tasks in the UI queue metrics.
+  if (auto postToUIBatchingQueue = m_context.Properties().Get(
+          winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueueProperty())) {
+    postToUIBatchingQueue(
+        [mountingCoordinator, self = shared_from_this()]() { self->initiateTransaction(mountingCoordinator); });
+    return;
+  }
+
+  if (!m_uiQueueMetrics) {
+    m_context.UIDispatcher().Post(
+        [mountingCoordinator, self = shared_from_this()]() { self->initiateTransaction(mountingCoordinator); });
+    return;
+  }
+
+  // The UI dispatcher does not measure its tasks, so they are recorded like the tasks of the UI queue, which lets the
+  // long mounts be reported
+  m_uiQueueMetrics->TaskPosted();
+  m_context.UIDispatcher().Post([mountingCoordinator,
+                                 self = shared_from_this(),
+                                 postTime = Mso::DispatchQueueMetrics::Clock::now(),
+                                 origin = Mso::DispatchQueueMetrics::CurrentOrigin()]() {
+    Mso::DispatchQueueMetrics::TaskScope scope{self->m_uiQueueMetrics.get(), postTime, origin};
+    self->initiateTransaction(mountingCoordinator);
+  });
+}
+
 void FabricUIManager::initiateTransaction(
     std::shared_ptr<const facebook::react::MountingCoordinator> mountingCoordinator) {
+  auto surfaceId = mountingCoordinator->getSurfaceId();
+  if (m_timeSlicedMounts.count(surfaceId)) {
+    // The transactions of a surface have to be mounted in order, so wait until its time sliced mount has completed
+    m_pendingTimeSlicedCoordinators[surfaceId] = std::move(mountingCoordinator);
+    return;
+  }
+
   if (m_transactionInFlight) {
     m_followUpTransactionRequired = true;
     return;
@@ -380,46 +1310,302 @@ void FabricUIManager::initiateTransaction(
     m_transactionInFlight = true;
     performTransaction(mountingCoordinator);
     m_transactionInFlight = false;
+
+    if (m_timeSlicedMounts.count(surfaceId)) {
+      if (m_followUpTransactionRequired) {
+        m_pendingTimeSlicedCoordinators[surfaceId] = mountingCoordinator;
+      }
+      break;
+    }
   } while (m_followUpTransactionRequired);
 }
 
+// Paragraphs in a transaction below this many are laid out on the preparation thread alone
+constexpr size_t ParallelTextLayoutThreshold = 8;
+// The minimum number of paragraphs worth handing to another thread pool thread
+constexpr size_t ParallelTextLayoutsPerThread = 4;
+
+// A Paragraph of a transaction which is about to be mounted, whose text layout is built off the UI thread
+struct PendingTextLayout {
+  facebook::react::ShadowView const *shadowView;
+  winrt::com_ptr<::IDWriteTextLayout> textLayout;
+};
+
+static void BuildPendingTextLayout(PendingTextLayout &pending) noexcept {
+  auto const &shadowView = *pending.shadowView;
+  auto const &stateData =
+      std::static_pointer_cast<facebook::react::ParagraphShadowNode::ConcreteState const>(shadowView.state)->getData();
+  winrt::Microsoft::ReactNative::Composition::implementation::ParagraphComponentView::CreateTextLayout(
+      facebook::react::AttributedStringBox(stateData.attributedString),
+      stateData.paragraphAttributes,
+      shadowView.layoutMetrics,
+      *std::static_pointer_cast<const facebook::react::ParagraphProps>(shadowView.props),
+      pending.textLayout);
+}
+
+// DirectWrite factories are free threaded, so large transactions, such as a list rendering a new window of items,
+// spread their layouts over the thread pool.  The calling thread takes part, and only waits for layouts that another
+// thread has already started, so this completes even if the thread pool does not run the posted tasks.
+static void BuildPendingTextLayouts(std::vector<PendingTextLayout> &pendingLayouts) noexcept {
+  struct SharedState {
+    // Only valid until all layouts are built, tasks that run later see that none are left from count alone
+    PendingTextLayout *pendingLayouts;
+    size_t count;
+    std::atomic<size_t> nextIndex{0};
+    size_t completedCount{0};
+    std::mutex mutex;
+    std::condition_variable completed;
+
+    // Returns once no layouts are left to start
+    void run() noexcept {
+      size_t builtCount = 0;
+      for (size_t index; (index = nextIndex++) < count;) {
+        BuildPendingTextLayout(pendingLayouts[index]);
+        builtCount++;
+      }
+      if (builtCount) {
+        std::lock_guard<std::mutex> lock(mutex);
+        completedCount += builtCount;
+        if (completedCount == count) {
+          completed.notify_all();
+        }
+      }
+    }
+  };
+
+  auto threadCount = std::min<size_t>(
+      std::max(std::thread::hardware_concurrency(), 1u), pendingLayouts.size() / ParallelTextLayoutsPerThread);
+  if (pendingLayouts.size() < ParallelTextLayoutThreshold || threadCount < 2) {
+    for (auto &pending : pendingLayouts) {
+      BuildPendingTextLayout(pending);
+    }
+    return;
+  }
+
+  auto state = std::make_shared<SharedState>();
+  state->pendingLayouts = pendingLayouts.data();
+  state->count = pendingLayouts.size();
+  for (size_t i = 1; i < threadCount; i++) {
+    Mso::DispatchQueue::ConcurrentQueue().Post([state]() noexcept { state->run(); });
+  }
+  state->run();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->completed.wait(lock, [&state]() { return state->completedCount == state->count; });
+}
+
+void FabricUIManager::prepareTransaction(
+    std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator) {
+  m_mountPreparationDispatcher.Post([mountingCoordinator, wkThis = weak_from_this()]() {
+    auto pThis = wkThis.lock();
+    if (!pThis) {
+      return;
+    }
+
+    // The coordinator is thread safe, and since this queue is serial, transactions are still pulled in commit order
+    auto transaction = mountingCoordinator->pullTransaction();
+    if (!transaction) {
+      return;
+    }
+
+    auto prepared = std::make_shared<PreparedTransaction>(std::move(*transaction));
+    std::vector<PendingTextLayout> pendingLayouts;
+    for (auto const &mutation : prepared->transaction.getMutations()) {
+      auto const &shadowView = mutation.newChildShadowView;
+      if ((mutation.type != facebook::react::ShadowViewMutation::Insert &&
+           mutation.type != facebook::react::ShadowViewMutation::Update) ||
+          shadowView.componentHandle != facebook::react::ParagraphShadowNode::Handle() || !shadowView.state) {
+        continue;
+      }
+
+      // An update that does not change the text keeps the view's existing layout
+      if (mutation.type == facebook::react::ShadowViewMutation::Update &&
+          mutation.oldChildShadowView.state == shadowView.state &&
+          mutation.oldChildShadowView.props == shadowView.props &&
+          mutation.oldChildShadowView.layoutMetrics == shadowView.layoutMetrics) {
+        continue;
+      }
+
+      pendingLayouts.push_back({&shadowView, nullptr});
+    }
+
+    BuildPendingTextLayouts(pendingLayouts);
+    for (auto &pending : pendingLayouts) {
+      if (pending.textLayout) {
+        prepared->textLayouts[pending.shadowView->tag] = std::move(pending.textLayout);
+      }
+    }
+
+    pThis->m_context.UIDispatcher().Post([prepared, wkThis]() {
+      if (auto pThis = wkThis.lock()) {
+        pThis->m_preparedTransactions.push_back(prepared);
+        pThis->mountPreparedTransactions();
+      }
+    });
+  });
+}
+
+void FabricUIManager::mountPreparedTransactions() noexcept {
+  // The transactions of a surface have to be mounted in order, so they wait while a time sliced mount of the surface is
+  // in progress.  Those of other surfaces are mounted.
+  while (true) {
+    auto it = std::find_if(
+        m_preparedTransactions.begin(), m_preparedTransactions.end(), [this](auto const &prepared) {
+          return !m_timeSlicedMounts.count(prepared->transaction.getSurfaceId());
+        });
+    if (it == m_preparedTransactions.end()) {
+      break;
+    }
+    auto prepared = std::move(*it);
+    m_preparedTransactions.erase(it);
+
+    auto &transaction = prepared->transaction;
+    auto surfaceId = transaction.getSurfaceId();
+    auto &surfaceTelemetry = m_preparedSurfaceTelemetry[surfaceId];
+
+    for (auto const &observer : m_mountingTransactionObservers) {
+      observer->mountingTransactionWillMount(transaction, surfaceTelemetry);
+    }
+
+    auto &telemetry = transaction.getTelemetry();
+    auto numberOfMutations = static_cast<int>(transaction.getMutations().size());
+    telemetry.willMount();
+
+    if (m_timeSlicedMountingEnabled && transaction.getMutations().size() >= TimeSlicedMountingMutationThreshold) {
+      startTimeSlicedMount(transaction);
+      telemetry.didMount();
+      surfaceTelemetry.incorporate(telemetry, numberOfMutations);
+      auto &timeSlicedMount = *m_timeSlicedMounts.at(surfaceId);
+      timeSlicedMount.surfaceTelemetry = surfaceTelemetry;
+      timeSlicedMount.textLayouts = std::move(prepared->textLayouts);
+      continue;
+    }
+
+    MountingTransactionMetrics metrics;
+    m_mountingTextLayouts = &prepared->textLayouts;
+    auto mountStartTime = facebook::react::telemetryTimePointNow();
+    auto compositionWorkStart = Composition::CurrentThreadCompositionWork();
+    RCTPerformMountInstructions(transaction.getMutations(), metrics, surfaceId);
+    metrics.mountDuration = facebook::react::telemetryTimePointNow() - mountStartTime;
+    AddCompositionWork(metrics, compositionWorkStart);
+    m_mountingTextLayouts = nullptr;
+
+    telemetry.didMount();
+    surfaceTelemetry.incorporate(telemetry, numberOfMutations);
+    completeMountingTransaction(transaction, surfaceTelemetry, metrics);
+  }
+}
+
 void FabricUIManager::schedulerDidFinishTransaction(
     const std::shared_ptr<const facebook::react::MountingCoordinator> &mountingCoordinator) {
   // Should cache this locally
 
+  if (m_startupTimeline) {
+    m_startupTimeline->StopPhase(Mso::React::StartupPhase::FirstCommit);
+    m_startupTimeline->StartPhase(Mso::React::StartupPhase::FirstMount);
+  }
+
+  if (deferFrozenSurfaceTransaction(mountingCoordinator)) {
+    return;
+  }
+
+  if (m_backgroundMountPreparationEnabled) {
+    prepareTransaction(mountingCoordinator);
+    return;
+  }
+
+  if (CollectSurfaceLayoutTransaction(mountingCoordinator)) {
+    return;
+  }
+
   if (m_context.UIDispatcher().HasThreadAccess()) {
     initiateTransaction(mountingCoordinator);
   } else {
-    m_context.UIDispatcher().Post(
-        [mountingCoordinator, self = shared_from_this()]() { self->initiateTransaction(mountingCoordinator); });
+    postTransaction(mountingCoordinator);
   }
 }
 
 void FabricUIManager::schedulerShouldRenderTransactions(
     const std::shared_ptr<const facebook::react::MountingCoordinator> &mountingCoordinator) {
+  if (deferFrozenSurfaceTransaction(mountingCoordinator)) {
+    return;
+  }
+
+  if (m_backgroundMountPreparationEnabled) {
+    prepareTransaction(mountingCoordinator);
+    return;
+  }
+
+  if (CollectSurfaceLayoutTransaction(mountingCoordinator)) {
+    return;
+  }
+
   if (m_context.UIDispatcher().HasThreadAccess()) {
     initiateTransaction(mountingCoordinator);
   } else {
-    m_context.UIDispatcher().Post(
-        [mountingCoordinator, self = shared_from_this()]() { self->initiateTransaction(mountingCoordinator); });
+    postTransaction(mountingCoordinator);
   }
 }
 
 void FabricUIManager::schedulerDidRequestPreliminaryViewAllocation(const facebook::react::ShadowNode &shadowView) {
-  // iOS does not do this optimization, but Android does.  It maybe that android's allocations are more expensive due to
-  // the Java boundary.
-  // TODO: We should do some perf tests to see if this is worth doing.
+  // iOS does not do this optimization, but Android does.  Views created here go into the recycle pools of
+  // m_registry, so the Create mutations that follow become pool pops rather than allocations.
+  {
+    std::lock_guard<std::mutex> lock(m_preallocationMutex);
+    // Views beyond the budget of their type would only be created to be destroyed
+    auto itCapacity = m_preallocationCapacities.find(shadowView.getComponentHandle());
+    if (itCapacity == m_preallocationCapacities.end() || itCapacity->second == 0) {
+      return;
+    }
+    --itCapacity->second;
+    m_pendingPreallocations.push_back(shadowView.getComponentHandle());
+    if (m_preallocationScheduled) {
+      return;
+    }
+    m_preallocationScheduled = true;
+  }
 
-  /* -- No sense doing this until we recycle views... since this just throws away the view currently
-  if (m_context.UIDispatcher().HasThreadAccess()) {
-    m_registry.dequeueComponentViewWithComponentHandle(shadowView.getComponentHandle(), surfaceId, m_compContext);
-  } else {
-    m_context.UIDispatcher().Post(
-        [componentHandle = shadowView.getComponentHandle(), surfaceId, self = shared_from_this()]() {
-          self->m_registry.dequeueComponentViewWithComponentHandle(componentHandle, surfaceId, self->m_compContext);
-        });
+  m_context.UIDispatcher().Post([wkThis = weak_from_this()]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->performPreliminaryViewAllocations();
+    }
+  });
+}
+
+void FabricUIManager::refreshPreallocationCapacities() noexcept {
+  std::lock_guard<std::mutex> lock(m_preallocationMutex);
+  // The queued preallocations are already counted against the capacities, until the queue is drained
+  if (m_pendingPreallocations.empty()) {
+    m_preallocationCapacities = m_registry.preallocationCapacities();
   }
-  */
+}
+
+// Time allowed for preallocating views in a single UI thread task, to avoid delaying input or mount work
+constexpr std::chrono::milliseconds PreliminaryViewAllocationSliceDuration{4};
+
+void FabricUIManager::performPreliminaryViewAllocations() noexcept {
+  auto sliceEnd = std::chrono::steady_clock::now() + PreliminaryViewAllocationSliceDuration;
+  while (std::chrono::steady_clock::now() < sliceEnd) {
+    facebook::react::ComponentHandle componentHandle;
+    {
+      std::lock_guard<std::mutex> lock(m_preallocationMutex);
+      if (m_pendingPreallocations.empty()) {
+        m_preallocationScheduled = false;
+        m_preallocationCapacities = m_registry.preallocationCapacities();
+        return;
+      }
+      componentHandle = m_pendingPreallocations.front();
+      m_pendingPreallocations.pop_front();
+    }
+    m_registry.preallocateComponentView(componentHandle, m_compContext);
+  }
+
+  // Yield to other UI work before continuing
+  m_context.UIDispatcher().Post([wkThis = weak_from_this()]() {
+    if (auto pThis = wkThis.lock()) {
+      pThis->performPreliminaryViewAllocations();
+    }
+  });
 }
 
 struct HandleCommandArgs : public winrt::Microsoft::ReactNative::implementation::HandleCommandArgsT<HandleCommandArgs> {
@@ -495,6 +1681,36 @@ void FabricUIManager::Initialize(winrt::Microsoft::ReactNative::ReactContext con
           reactContext.Properties().Handle());
 
   m_registry.Initialize(reactContext);
+  refreshPreallocationCapacities();
+
+  if (auto deviceReplaced =
+          m_compContext.try_as<::Microsoft::ReactNative::Composition::ICompositionRenderingDeviceReplaced>()) {
+    m_renderingDeviceReplacedToken = deviceReplaced->RenderingDeviceReplaced([wkThis = weak_from_this()]() noexcept {
+      if (auto pThis = wkThis.lock()) {
+        pThis->startRenderingDeviceRecovery();
+      }
+    });
+  }
+
+  facebook::react::tracing::initializeETW();
+  m_mountingTransactionTelemetryEnabled =
+      m_context.Properties().Get(MountingTransactionTelemetryEnabledProperty()).value_or(false);
+  m_timeSlicedMountingEnabled = m_context.Properties().Get(TimeSlicedMountingProperty()).value_or(false);
+  m_backgroundMountPreparationEnabled =
+      m_context.Properties().Get(BackgroundMountPreparationProperty()).value_or(false);
+  m_startupTimeline = Mso::React::StartupTimeline::Get(m_context.Properties());
+  if (auto queueMetrics = m_context.Properties().Get(
+          winrt::Microsoft::ReactNative::implementation::ReactContext::DispatchQueueMetricsProperty())) {
+    for (const auto &metrics : *queueMetrics) {
+      if (metrics->QueueName() == "UI") {
+        m_uiQueueMetrics = metrics;
+      }
+    }
+  }
+  registerCaches();
+  if (m_backgroundMountPreparationEnabled) {
+    m_mountPreparationDispatcher = winrt::Microsoft::ReactNative::ReactDispatcher::CreateSerialDispatcher();
+  }
 
   m_context.Properties().Set(FabicUIManagerProperty(), shared_from_this());
 
@@ -6,8 +6,22 @@
 #include <NativeModules.h>
 #include <React.h>
 #include <react/renderer/scheduler/SchedulerDelegate.h>
+#include <dwrite.h>
 #include <winrt/Windows.UI.Composition.h>
+#include <deque>
+#include <unordered_set>
 #include "Composition/ComponentViewRegistry.h"
+#include "LayoutAnimationDelegate.h"
+#include "MountingTransactionObserver.h"
+
+namespace Mso {
+struct DispatchQueueMetrics;
+} // namespace Mso
+
+namespace Mso::React {
+class CacheBudgetManager;
+class StartupTimeline;
+} // namespace Mso::React
 
 namespace facebook::react {
 class Scheduler;
@@ -17,6 +31,8 @@ class SurfaceHandler;
 
 namespace Microsoft::ReactNative {
 
+class PerformanceOverlay;
+
 REACT_MODULE(FabricUIManager)
 struct FabricUIManager final : public std::enable_shared_from_this<FabricUIManager>,
                                facebook::react::SchedulerDelegate {
@@ -42,6 +58,15 @@ struct FabricUIManager final : public std::enable_shared_from_this<FabricUIManag
       const facebook::react::LayoutConstraints &layoutConstraints,
       const facebook::react::LayoutContext &layoutContext) const noexcept;
 
+  // Lays out the surface with the constraints in a UI thread task, together with the other surfaces scheduled until
+  // then.  Surfaces have independent shadow trees, so several of them are laid out in parallel on the thread pool, and
+  // their transactions are mounted once all are committed.  Only the latest constraints of a surface are used.  Must be
+  // called on the UI thread.
+  void scheduleSurfaceLayout(
+      facebook::react::SurfaceId surfaceId,
+      const facebook::react::LayoutConstraints &layoutConstraints,
+      const facebook::react::LayoutContext &layoutContext) noexcept;
+
   facebook::react::Size measureSurface(
       facebook::react::SurfaceId surfaceId,
       const facebook::react::LayoutConstraints &layoutConstraints,
@@ -49,20 +74,110 @@ struct FabricUIManager final : public std::enable_shared_from_this<FabricUIManag
 
   void setProps(facebook::react::SurfaceId surfaceId, const folly::dynamic &props) const noexcept;
 
+  // Freezes a surface that is navigated away from, so that it can be shown again instantly.  Its views are kept, and
+  // the transactions committed while it is frozen are not mounted until it is unfrozen, when only the latest state of
+  // its shadow tree is.  At most a few surfaces are kept frozen, and all of them on memory pressure, the others are
+  // released: their views are deleted, and the surface is started again from scratch when it is unfrozen.  Must be
+  // called on the UI thread.
+  void freezeSurface(facebook::react::SurfaceId surfaceId) noexcept;
+  void unfreezeSurface(facebook::react::SurfaceId surfaceId) noexcept;
+
   const IComponentViewRegistry &GetViewRegistry() const noexcept;
 
   static winrt::Microsoft::ReactNative::ReactNotificationId<facebook::react::SurfaceId> NotifyMountedId() noexcept;
 
+  // Sent after each mounting transaction when MountingTransactionTelemetryEnabledProperty is set on the instance
+  // properties.  The notification data is an IReactPropertyBag with the following properties in the
+  // "ReactNative.Fabric.MountingTransaction" namespace:
+  //   SurfaceId (int32), TransactionNumber (int64), CreateCount, DeleteCount, InsertCount, RemoveCount,
+  //   UpdateCount, CompositionObjectCreations, CompositionPropertySets, CompositionBrushUpdates (uint32),
+  //   MountDurationMs, CommitToMountLatencyMs (double)
+  static winrt::Microsoft::ReactNative::ReactNotificationId<winrt::Microsoft::ReactNative::IReactPropertyBag>
+  NotifyMountingTransactionId() noexcept;
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> MountingTransactionTelemetryEnabledProperty() noexcept;
+
+  // When set on the instance properties, very large mounting transactions are applied over multiple UI thread tasks,
+  // each limited to a fraction of a frame, so that rendering and pending input are not blocked until the whole
+  // transaction is mounted.  Only views that are not yet attached to the surface are touched before the final slice,
+  // so the surface stays visually consistent.
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> TimeSlicedMountingProperty() noexcept;
+
+  // When set on the instance properties, mounting transactions are pulled from their coordinators on a background
+  // queue instead of the UI thread.  The work that does not depend on UI thread affine objects, such as building the
+  // text layouts of paragraphs, is done there as well, and the prepared transactions are then mounted on the UI thread
+  // in the order they were committed.
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> BackgroundMountPreparationProperty() noexcept;
+
+  // When set on the instance properties, events are flushed to JS as the compositor commits a frame, see
+  // CompositorEventBeat.  Ignored when the composition context does not use Microsoft.UI.Composition.
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> CompositorEventBeatProperty() noexcept;
+
+  // Observers are called on the UI thread, and must be added and removed on the UI thread
+  void addMountingTransactionObserver(std::shared_ptr<IMountingTransactionObserver> const &observer) noexcept;
+  void removeMountingTransactionObserver(std::shared_ptr<IMountingTransactionObserver> const &observer) noexcept;
+
+  // Shows or hides the PerformanceOverlay on the instance's surfaces.  Can be called from any thread.
+  void setPerformanceOverlayVisible(bool visible) noexcept;
+  void togglePerformanceOverlay() noexcept;
+
+  // For the memory report, see Mso::React::MemoryReport.  Called on the UI thread.
+  std::map<std::string, ComponentViewRegistry::ComponentViewCount> componentViewCounts() const noexcept;
+
  private:
   void installFabricUIManager() noexcept;
+  void registerCaches() noexcept;
   void initiateTransaction(std::shared_ptr<const facebook::react::MountingCoordinator> mountingCoordinator);
+  void postTransaction(std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator) noexcept;
   void performTransaction(std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator);
   void RCTPerformMountInstructions(
       facebook::react::ShadowViewMutationList const &mutations,
       // facebook::react::RCTComponentViewRegistry* registry,
-      // facebook::react::RCTMountingTransactionObserverCoordinator& observerCoordinator,
+      MountingTransactionMetrics &metrics,
       facebook::react::SurfaceId surfaceId);
+  winrt::Microsoft::ReactNative::implementation::ComponentView *parentComponentViewWithTag(
+      facebook::react::Tag tag) noexcept;
+  void invalidateParentComponentViewCache(facebook::react::Tag tag) noexcept;
+  static size_t mountInstructionRunLength(
+      facebook::react::ShadowViewMutationList const &mutations,
+      size_t start) noexcept;
+  void performBatchedMountInstructions(
+      facebook::react::ShadowViewMutationList const &mutations,
+      size_t start,
+      size_t count,
+      MountingTransactionMetrics &metrics);
+  winrt::Microsoft::ReactNative::ComponentView updateComponentViewForInsert(
+      facebook::react::ShadowViewMutation const &mutation) noexcept;
+  void startLayoutTransition(
+      facebook::react::ShadowViewMutation const &mutation,
+      winrt::Microsoft::ReactNative::ComponentView const &componentView) noexcept;
+  void performMountInstruction(
+      facebook::react::ShadowViewMutation const &mutation,
+      MountingTransactionMetrics &metrics);
+  void completeMountingTransaction(
+      facebook::react::MountingTransaction const &transaction,
+      facebook::react::SurfaceTelemetry const &surfaceTelemetry,
+      MountingTransactionMetrics &metrics) noexcept;
+  void traceCompositionCommit(MountingTransactionMetrics const &metrics) noexcept;
+  bool isMountPending() const noexcept;
+  void startTimeSlicedMount(facebook::react::MountingTransaction const &transaction) noexcept;
+  // Mounts the next slice, or all the remaining mutations if untilComplete is set, like when the surface stops
+  void continueTimeSlicedMount(facebook::react::SurfaceId surfaceId, bool untilComplete = false) noexcept;
+  void startRenderingDeviceRecovery() noexcept;
+  void continueRenderingDeviceRecovery() noexcept;
+  void prepareTransaction(std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator);
+  void mountPreparedTransactions() noexcept;
+  void adoptPreparedTextLayout(
+      facebook::react::ShadowView const &shadowView,
+      winrt::Microsoft::ReactNative::implementation::ComponentView &componentView) noexcept;
   void didMountComponentsWithRootTag(facebook::react::SurfaceId surfaceId) noexcept;
+  void publishMountingTransactionMetrics(MountingTransactionMetrics const &metrics) noexcept;
+  void updatePerformanceOverlay(bool visible) noexcept;
+  void performPreliminaryViewAllocations() noexcept;
+  void refreshPreallocationCapacities() noexcept;
+  void performScheduledSurfaceLayouts() noexcept;
+  bool deferFrozenSurfaceTransaction(
+      std::shared_ptr<const facebook::react::MountingCoordinator> const &mountingCoordinator) noexcept;
+  void releaseFrozenSurfaces(size_t keepCount) noexcept;
 
   void visit(
       facebook::react::SurfaceId surfaceId,
@@ -70,18 +185,111 @@ struct FabricUIManager final : public std::enable_shared_from_this<FabricUIManag
 
   winrt::Microsoft::ReactNative::ReactContext m_context;
   winrt::Microsoft::ReactNative::Composition::Experimental::ICompositionContext m_compContext;
+  // Declared before m_scheduler, which holds on to it
+  std::unique_ptr<LayoutAnimationDelegate> m_layoutAnimationDelegate;
   std::shared_ptr<facebook::react::Scheduler> m_scheduler;
   std::mutex m_schedulerMutex; // Protect m_scheduler
   bool m_transactionInFlight{false};
   bool m_followUpTransactionRequired{false};
+  bool m_mountingTransactionTelemetryEnabled{false};
+  bool m_timeSlicedMountingEnabled{false};
+  bool m_backgroundMountPreparationEnabled{false};
+  std::vector<std::shared_ptr<IMountingTransactionObserver>> m_mountingTransactionObservers;
+  std::shared_ptr<PerformanceOverlay> m_performanceOverlay; // Set while the overlay is shown
+  std::shared_ptr<Mso::React::StartupTimeline> m_startupTimeline; // Records the first commit and the first mount
+  std::shared_ptr<Mso::React::CacheBudgetManager> m_cacheBudgetManager;
+  std::vector<uint32_t> m_cacheRegistrationTokens;
+  // Measures the transactions posted to the UI thread, when the metrics of the UI queue are recorded
+  std::shared_ptr<Mso::DispatchQueueMetrics> m_uiQueueMetrics;
+
+  // Text layouts of Paragraph views built off the UI thread, keyed by tag
+  using PreparedTextLayouts = std::unordered_map<facebook::react::Tag, winrt::com_ptr<::IDWriteTextLayout>>;
+
+  // A transaction pulled on m_mountPreparationDispatcher, waiting to be mounted on the UI thread
+  struct PreparedTransaction {
+    PreparedTransaction(facebook::react::MountingTransaction &&transaction) noexcept
+        : transaction(std::move(transaction)) {}
+
+    facebook::react::MountingTransaction transaction;
+    PreparedTextLayouts textLayouts;
+  };
+  winrt::Microsoft::ReactNative::ReactDispatcher m_mountPreparationDispatcher{nullptr};
+  std::deque<std::shared_ptr<PreparedTransaction>> m_preparedTransactions;
+  // Transactions pulled off the UI thread bypass the coordinator's TelemetryController, so the surface telemetry is
+  // accumulated here instead
+  std::unordered_map<facebook::react::SurfaceId, facebook::react::SurfaceTelemetry> m_preparedSurfaceTelemetry;
+  // The text layouts of the transaction being mounted, if it was prepared
+  PreparedTextLayouts *m_mountingTextLayouts{nullptr};
+  // The LayoutAnimation of the transaction being mounted by RCTPerformMountInstructions, and the views it created
+  const LayoutAnimationDelegate::PendingLayoutAnimation *m_mountingLayoutAnimation{nullptr};
+  std::unordered_set<facebook::react::Tag> m_layoutAnimationCreatedTags;
+  // Collects the transitions to know when they have all completed.  Suspended while mounting, since the expression
+  // animations that views start as they are created would never complete.
+  winrt::Microsoft::UI::Composition::CompositionScopedBatch m_layoutAnimationBatch{nullptr};
+
+  struct TimeSlicedMount {
+    TimeSlicedMount(facebook::react::MountingTransaction &&transaction) noexcept
+        : transaction(std::move(transaction)) {}
+
+    facebook::react::MountingTransaction transaction;
+    facebook::react::SurfaceTelemetry surfaceTelemetry;
+    // Indices of mutations that only touch views created by this transaction, which are not attached to the surface yet
+    std::vector<size_t> detachedMutations;
+    // Indices of all other mutations, which are applied together in the final slice
+    std::vector<size_t> attachedMutations;
+    size_t nextDetachedMutation{0};
+    MountingTransactionMetrics metrics;
+    PreparedTextLayouts textLayouts;
+  };
+  // By surface, so that a large transaction of one surface does not hold back the transactions of the others
+  std::unordered_map<facebook::react::SurfaceId, std::unique_ptr<TimeSlicedMount>> m_timeSlicedMounts;
+  // The coordinators with transactions that are waiting for the time sliced mount of their surface to complete
+  std::unordered_map<facebook::react::SurfaceId, std::shared_ptr<const facebook::react::MountingCoordinator>>
+      m_pendingTimeSlicedCoordinators;
+
+  winrt::event_token m_renderingDeviceReplacedToken;
+  // Views to redraw once the rendering device has been replaced, those that are visible first.  Redrawn in slices, so
+  // that the first frames show the visible content again without waiting for everything else.
+  std::vector<facebook::react::Tag> m_renderingDeviceRecoveryTags;
+  size_t m_nextRenderingDeviceRecoveryTag{0};
 
   ComponentViewRegistry m_registry;
+  // Consecutive Insert and Remove mutations usually target the same parent, so the last parent looked up is cached.
+  // Invalidated when the view with that tag is deleted.
+  facebook::react::Tag m_cachedParentTag{-1};
+  winrt::Microsoft::ReactNative::implementation::ComponentView *m_cachedParentComponentView{nullptr};
+
+  struct ScheduledSurfaceLayout {
+    facebook::react::LayoutConstraints layoutConstraints;
+    facebook::react::LayoutContext layoutContext;
+  };
+  // Only used on the UI thread, see scheduleSurfaceLayout
+  std::unordered_map<facebook::react::SurfaceId, ScheduledSurfaceLayout> m_scheduledSurfaceLayouts;
+
+  std::mutex m_preallocationMutex; // Protect the preallocation members below
+  std::deque<facebook::react::ComponentHandle> m_pendingPreallocations;
+  // The number of preallocations that can still be queued for each pooled component type, which is refreshed from
+  // m_registry on the UI thread whenever the queue is empty.  Types that are not pooled are not queued.
+  std::unordered_map<facebook::react::ComponentHandle, size_t> m_preallocationCapacities;
+  bool m_preallocationScheduled{false};
   struct SurfaceInfo {
     winrt::weak_ref<winrt::Microsoft::ReactNative::ReactNativeIsland> wkRootView{nullptr};
   };
 
   std::unordered_map<facebook::react::SurfaceId, SurfaceInfo> m_surfaceRegistry;
 
+  struct FrozenSurface {
+    // The coordinator of the latest transaction committed while the surface was frozen
+    std::shared_ptr<const facebook::react::MountingCoordinator> pendingCoordinator;
+    // The surfaces frozen first are released first
+    uint64_t freezeOrder{0};
+    // Stopped to release its views, so its transactions are mounted
+    bool released{false};
+  };
+  std::mutex m_frozenSurfacesMutex; // Protect m_frozenSurfaces
+  std::unordered_map<facebook::react::SurfaceId, FrozenSurface> m_frozenSurfaces;
+  uint64_t m_nextFreezeOrder{0};
+
   std::unordered_map<facebook::react::SurfaceId, facebook::react::SurfaceHandler> m_handlerRegistry{};
   mutable std::shared_mutex m_handlerMutex;
 
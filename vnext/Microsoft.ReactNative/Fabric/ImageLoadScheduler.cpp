@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "ImageLoadScheduler.h"
+
+#include <CppRuntimeOptions.h>
+#include <algorithm>
+
+namespace Microsoft::ReactNative {
+
+constexpr size_t DefaultMaxRunningLoads = 6;
+
+static winrt::fire_and_forget RunLoadAsync(ImageLoadScheduler::StartLoad startLoad, ImageLoadScheduler::LoadSlot slot) {
+  co_await winrt::resume_background();
+  startLoad(std::move(slot));
+}
+
+ImageLoadScheduler &ImageLoadScheduler::Instance() noexcept {
+  // Intentionally leaked, like the DecodedImageCache that loads complete into
+  static ImageLoadScheduler *s_instance = new ImageLoadScheduler();
+  return *s_instance;
+}
+
+ImageLoadScheduler::ImageLoadScheduler() noexcept {
+  auto maxRunningLoads = Microsoft::React::GetRuntimeOptionInt("Image.MaxConcurrentLoads");
+  m_maxRunningLoads = maxRunningLoads > 0 ? static_cast<size_t>(maxRunningLoads) : DefaultMaxRunningLoads;
+}
+
+ImageLoadScheduler::LoadId ImageLoadScheduler::schedule(
+    std::optional<DecodedImageCache::Key> key,
+    ImageLoadPriority defaultPriority,
+    StartLoad startLoad) noexcept {
+  LoadId id;
+  {
+    std::scoped_lock lock{m_mutex};
+    id = m_nextLoadId++;
+    m_queue.push_back({id, std::move(key), defaultPriority, std::move(startLoad)});
+  }
+  startLoads();
+  return id;
+}
+
+void ImageLoadScheduler::cancel(LoadId load) noexcept {
+  StartLoad droppedLoad;
+  {
+    std::scoped_lock lock{m_mutex};
+    auto it =
+        std::find_if(m_queue.begin(), m_queue.end(), [load](const QueuedLoad &queued) { return queued.id == load; });
+    if (it == m_queue.end()) {
+      return;
+    }
+    droppedLoad = std::move(it->startLoad);
+    m_queue.erase(it);
+  }
+  // Released outside of the lock, since it might hold the last reference to the requests of the load
+  droppedLoad = nullptr;
+}
+
+void ImageLoadScheduler::setPriority(
+    const facebook::react::ImageResponseObserverCoordinator *observer,
+    ImageLoadPriority priority) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_priorities[observer] = priority;
+}
+
+void ImageLoadScheduler::clearPriority(const facebook::react::ImageResponseObserverCoordinator *observer) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_priorities.erase(observer);
+}
+
+ImageLoadPriority ImageLoadScheduler::priorityLocked(const QueuedLoad &load) const noexcept {
+  if (!load.key) {
+    return load.defaultPriority;
+  }
+
+  std::optional<ImageLoadPriority> priority;
+  for (const auto &observer : DecodedImageCache::Instance().pendingObservers(*load.key)) {
+    auto observerCoordinator = observer.lock();
+    if (!observerCoordinator) {
+      continue;
+    }
+    auto it = m_priorities.find(observerCoordinator.get());
+    auto observerPriority = it == m_priorities.end() ? load.defaultPriority : it->second;
+    priority = priority ? std::min(*priority, observerPriority) : observerPriority;
+  }
+  return priority.value_or(load.defaultPriority);
+}
+
+void ImageLoadScheduler::startLoads() noexcept {
+  std::vector<std::pair<StartLoad, LoadSlot>> loadsToStart;
+  {
+    std::scoped_lock lock{m_mutex};
+    while (m_runningLoads < m_maxRunningLoads && !m_queue.empty()) {
+      // Priorities change while loads are queued, so the most urgent load is searched for each time.  Loads of the
+      // same priority start in the order they were scheduled.
+      auto next = m_queue.begin();
+      auto nextPriority = priorityLocked(*next);
+      for (auto it = std::next(m_queue.begin()); it != m_queue.end() && nextPriority != ImageLoadPriority::Visible;
+           ++it) {
+        auto priority = priorityLocked(*it);
+        if (priority < nextPriority) {
+          next = it;
+          nextPriority = priority;
+        }
+      }
+
+      m_runningLoads++;
+      loadsToStart.emplace_back(
+          std::move(next->startLoad), LoadSlot{nullptr, [](void *) { ImageLoadScheduler::Instance().releaseSlot(); }});
+      m_queue.erase(next);
+    }
+  }
+
+  for (auto &[startLoad, slot] : loadsToStart) {
+    RunLoadAsync(std::move(startLoad), std::move(slot));
+  }
+}
+
+void ImageLoadScheduler::releaseSlot() noexcept {
+  {
+    std::scoped_lock lock{m_mutex};
+    m_runningLoads--;
+  }
+  startLoads();
+}
+
+} // namespace Microsoft::ReactNative
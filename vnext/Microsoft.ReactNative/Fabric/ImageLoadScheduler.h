@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/imagemanager/ImageResponseObserverCoordinator.h>
+
+#include <Fabric/DecodedImageCache.h>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace Microsoft::ReactNative {
+
+// Most urgent first
+enum class ImageLoadPriority {
+  Visible,
+  NearViewport,
+  Prefetch,
+  Offscreen,
+};
+
+// Process wide queue of image loads, which runs at most a fixed number of loads at once, set with the
+// "Image.MaxConcurrentLoads" runtime option, and starts the most urgent queued load whenever one finishes.
+// Loads of the WindowsImageManager are as urgent as the most urgent request waiting on them, which ImageComponentViews
+// update as they scroll in and out of the viewport, so that images scrolled past do not hold up the visible ones.
+class ImageLoadScheduler final {
+ public:
+  using LoadId = uint64_t;
+  // Held by a running load, the next queued load starts once every copy of it is released
+  using LoadSlot = std::shared_ptr<void>;
+  using StartLoad = std::function<void(LoadSlot slot)>;
+
+  static ImageLoadScheduler &Instance() noexcept;
+
+  // Queues a load, started on a background thread.  Loads of a cache key are as urgent as the requests waiting on the
+  // key in the DecodedImageCache, or defaultPriority for requests without a priority.
+  LoadId schedule(
+      std::optional<DecodedImageCache::Key> key,
+      ImageLoadPriority defaultPriority,
+      StartLoad startLoad) noexcept;
+
+  // Drops the load if it has not started yet
+  void cancel(LoadId load) noexcept;
+
+  void setPriority(
+      const facebook::react::ImageResponseObserverCoordinator *observer,
+      ImageLoadPriority priority) noexcept;
+  void clearPriority(const facebook::react::ImageResponseObserverCoordinator *observer) noexcept;
+
+ private:
+  struct QueuedLoad {
+    LoadId id;
+    std::optional<DecodedImageCache::Key> key;
+    ImageLoadPriority defaultPriority;
+    StartLoad startLoad;
+  };
+
+  ImageLoadScheduler() noexcept;
+
+  ImageLoadPriority priorityLocked(const QueuedLoad &load) const noexcept;
+  void startLoads() noexcept;
+  void releaseSlot() noexcept;
+
+  std::mutex m_mutex;
+  std::vector<QueuedLoad> m_queue;
+  std::unordered_map<const facebook::react::ImageResponseObserverCoordinator *, ImageLoadPriority> m_priorities;
+  LoadId m_nextLoadId{1};
+  size_t m_runningLoads{0};
+  size_t m_maxRunningLoads;
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "LayoutAnimationDelegate.h"
+
+#include <folly/dynamic.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/RawValue.h>
+
+namespace Microsoft::ReactNative {
+
+static std::shared_ptr<facebook::jsi::Function> CallbackFunction(
+    facebook::jsi::Runtime &runtime,
+    const facebook::jsi::Value &callback) noexcept {
+  if (!callback.isObject()) {
+    return nullptr;
+  }
+
+  auto object = callback.getObject(runtime);
+  if (!object.isFunction(runtime)) {
+    return nullptr;
+  }
+  return std::make_shared<facebook::jsi::Function>(object.getFunction(runtime));
+}
+
+LayoutAnimationDelegate::LayoutAnimationDelegate(facebook::react::RuntimeExecutor runtimeExecutor) noexcept
+    : m_runtimeExecutor(std::move(runtimeExecutor)) {}
+
+void LayoutAnimationDelegate::uiManagerDidConfigureNextLayoutAnimation(
+    facebook::jsi::Runtime &runtime,
+    const facebook::react::RawValue &config,
+    const facebook::jsi::Value &successCallback,
+    const facebook::jsi::Value &failureCallback) const {
+  PendingLayoutAnimation layoutAnimation;
+  try {
+    layoutAnimation.animations = facebook::react::LayoutAnimation((folly::dynamic)config).Properties();
+  } catch (const std::exception &) {
+    if (auto onFailure = CallbackFunction(runtime, failureCallback)) {
+      onFailure->call(runtime);
+    }
+    return;
+  }
+
+  if (auto onSuccess = CallbackFunction(runtime, successCallback)) {
+    // The function is moved back to the JS thread to be called, so that it is never released on the UI thread
+    layoutAnimation.onComplete = [runtimeExecutor = m_runtimeExecutor, onSuccess = std::move(onSuccess)]() mutable {
+      runtimeExecutor(
+          [onSuccess = std::move(onSuccess)](facebook::jsi::Runtime &runtime) { onSuccess->call(runtime); });
+    };
+  }
+
+  std::optional<PendingLayoutAnimation> replacedLayoutAnimation;
+  {
+    std::scoped_lock lock(m_mutex);
+    replacedLayoutAnimation = std::exchange(m_pendingLayoutAnimation, std::move(layoutAnimation));
+  }
+  // A config that no transaction was mounted with is dropped, here on the JS thread
+}
+
+void LayoutAnimationDelegate::setComponentDescriptorRegistry(
+    const facebook::react::SharedComponentDescriptorRegistry & /*componentDescriptorRegistry*/) {}
+
+bool LayoutAnimationDelegate::shouldAnimateFrame() const {
+  return false;
+}
+
+void LayoutAnimationDelegate::stopSurface(facebook::react::SurfaceId /*surfaceId*/) {}
+
+std::optional<LayoutAnimationDelegate::PendingLayoutAnimation>
+LayoutAnimationDelegate::takePendingLayoutAnimation() noexcept {
+  std::scoped_lock lock(m_mutex);
+  return std::exchange(m_pendingLayoutAnimation, std::nullopt);
+}
+
+} // namespace Microsoft::ReactNative
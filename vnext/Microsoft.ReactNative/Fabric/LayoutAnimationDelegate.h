@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/uimanager/UIManagerAnimationDelegate.h>
+
+#include <LayoutAnimation.h>
+#include <ReactCommon/RuntimeExecutor.h>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+namespace Microsoft::ReactNative {
+
+// Receives the configs of LayoutAnimation.configureNext, and hands each one to the next mounting transaction.  The
+// create and update transitions of that transaction then run as composition animations on the views' visuals, rather
+// than through the frame by frame interpolation of the shadow tree that the LayoutAnimationDriver does.
+class LayoutAnimationDelegate final : public facebook::react::UIManagerAnimationDelegate {
+ public:
+  struct PendingLayoutAnimation {
+    facebook::react::LayoutAnimation::LayoutAnimations animations;
+    // Calls the success callback of the config on the JS thread, once the transitions have completed
+    std::function<void()> onComplete;
+  };
+
+  explicit LayoutAnimationDelegate(facebook::react::RuntimeExecutor runtimeExecutor) noexcept;
+
+  void uiManagerDidConfigureNextLayoutAnimation(
+      facebook::jsi::Runtime &runtime,
+      const facebook::react::RawValue &config,
+      const facebook::jsi::Value &successCallback,
+      const facebook::jsi::Value &failureCallback) const override;
+  void setComponentDescriptorRegistry(
+      const facebook::react::SharedComponentDescriptorRegistry &componentDescriptorRegistry) override;
+  // The compositor runs the transitions, so there are never frames for the UIManager to animate
+  bool shouldAnimateFrame() const override;
+  void stopSurface(facebook::react::SurfaceId surfaceId) override;
+
+  // Called on the UI thread as a mounting transaction starts
+  std::optional<PendingLayoutAnimation> takePendingLayoutAnimation() noexcept;
+
+ private:
+  facebook::react::RuntimeExecutor m_runtimeExecutor;
+  mutable std::mutex m_mutex; // Protect m_pendingLayoutAnimation
+  mutable std::optional<PendingLayoutAnimation> m_pendingLayoutAnimation;
+};
+
+} // namespace Microsoft::ReactNative
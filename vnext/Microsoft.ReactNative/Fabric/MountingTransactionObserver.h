@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/mounting/MountingTransaction.h>
+#include <react/renderer/telemetry/SurfaceTelemetry.h>
+#include <react/utils/Telemetry.h>
+
+namespace Microsoft::ReactNative {
+
+// Timings and mutation counts collected while a single MountingTransaction is applied to the component views
+struct MountingTransactionMetrics {
+  facebook::react::SurfaceId surfaceId{-1};
+  facebook::react::MountingTransaction::Number transactionNumber{0};
+
+  uint32_t createCount{0};
+  uint32_t deleteCount{0};
+  uint32_t insertCount{0};
+  uint32_t removeCount{0};
+  uint32_t updateCount{0};
+
+  // Composition objects created, properties set on visuals and shadows, and brushes set on visuals while mounting, see
+  // Composition::CurrentThreadCompositionWork.  A prop change that recreates brushes shows up here.
+  uint32_t compositionObjectCreations{0};
+  uint32_t compositionPropertySets{0};
+  uint32_t compositionBrushUpdates{0};
+
+  // Time spent in FabricUIManager::RCTPerformMountInstructions
+  facebook::react::TelemetryDuration mountDuration{};
+  // Time between the end of the commit on the JS/background thread and the end of the mount on the UI thread
+  facebook::react::TelemetryDuration commitToMountLatency{};
+};
+
+// Equivalent of RCTMountingTransactionObserving on iOS.  Observers are registered on the FabricUIManager and are
+// always called on the UI thread.
+struct IMountingTransactionObserver {
+  virtual ~IMountingTransactionObserver() = default;
+
+  virtual void mountingTransactionWillMount(
+      facebook::react::MountingTransaction const & /*transaction*/,
+      facebook::react::SurfaceTelemetry const & /*surfaceTelemetry*/) noexcept {}
+
+  virtual void mountingTransactionDidMount(
+      facebook::react::MountingTransaction const & /*transaction*/,
+      facebook::react::SurfaceTelemetry const & /*surfaceTelemetry*/,
+      MountingTransactionMetrics const & /*metrics*/) noexcept {}
+};
+
+} // namespace Microsoft::ReactNative
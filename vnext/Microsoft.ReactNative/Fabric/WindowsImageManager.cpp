@@ -6,17 +6,24 @@
 #include "WindowsImageManager.h"
 
 #include <CppRuntimeOptions.h>
+#include <Fabric/AnimatedImage.h>
 #include <Fabric/Composition/CompositionContextHelper.h>
 #include <Fabric/Composition/ImageResponseImage.h>
 #include <Fabric/Composition/UriImageManager.h>
+#include <Fabric/DecodedImageCache.h>
+#include <Fabric/ImageLoadScheduler.h>
+#include <Networking/HttpRequestScheduler.h>
 #include <Networking/NetworkPropertyIds.h>
 #include <Utils/CppWinrtLessExceptions.h>
+#include <Utils/ImageDiskCache.h>
 #include <Utils/ImageUtils.h>
 #include <fmt/format.h>
 #include <functional/functor.h>
+#include <tracing/tracing.h>
 #include <shcore.h>
 #include <wincodec.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
+#include <winrt/Windows.Storage.FileProperties.h>
 #include <winrt/Windows.Web.Http.Headers.h>
 #include <winrt/Windows.Web.Http.h>
 
@@ -44,6 +51,28 @@ WindowsImageManager::WindowsImageManager(winrt::Microsoft::ReactNative::ReactCon
   }
 }
 
+static std::tuple<
+    winrt::com_ptr<IWICBitmapSource>,
+    winrt::com_ptr<IWICImagingFactory>,
+    std::shared_ptr<facebook::react::ImageErrorInfo>>
+wicBitmapSourceFromIStream(
+    const winrt::com_ptr<IWICImagingFactory> &imagingFactory,
+    const winrt::com_ptr<IStream> &istream) {
+  winrt::com_ptr<IWICBitmapDecoder> bitmapDecoder;
+  winrt::check_hresult(imagingFactory->CreateDecoderFromStream(
+      istream.get(), nullptr, WICDecodeMetadataCacheOnDemand, bitmapDecoder.put()));
+
+  if (!bitmapDecoder) {
+    auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
+    errorInfo->error = "Failed to decode the image.";
+    return {nullptr, nullptr, errorInfo};
+  }
+
+  winrt::com_ptr<IWICBitmapFrameDecode> decodedFrame;
+  winrt::check_hresult(bitmapDecoder->GetFrame(0, decodedFrame.put()));
+  return {decodedFrame, imagingFactory, nullptr};
+}
+
 std::tuple<
     winrt::com_ptr<IWICBitmapSource>,
     winrt::com_ptr<IWICImagingFactory>,
@@ -57,31 +86,256 @@ wicBitmapSourceFromStream(const winrt::Windows::Storage::Streams::IRandomAccessS
     winrt::check_hresult(
         CreateStreamOverRandomAccessStream(stream.as<IUnknown>().get(), __uuidof(IStream), istream.put_void()));
 
-    winrt::com_ptr<IWICBitmapDecoder> bitmapDecoder;
-    winrt::check_hresult(imagingFactory->CreateDecoderFromStream(
-        istream.get(), nullptr, WICDecodeMetadataCacheOnDemand, bitmapDecoder.put()));
+    return wicBitmapSourceFromIStream(imagingFactory, istream);
+  } catch (winrt::hresult_error const &ex) {
+    auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
+    errorInfo->error = ::Microsoft::ReactNative::FormatHResultError(winrt::hresult_error(ex));
+    return {nullptr, nullptr, errorInfo};
+  }
+}
 
-    if (!bitmapDecoder) {
-      auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-      errorInfo->error = "Failed to decode the image.";
-      return {nullptr, nullptr, errorInfo};
-    }
+std::tuple<
+    winrt::com_ptr<IWICBitmapSource>,
+    winrt::com_ptr<IWICImagingFactory>,
+    std::shared_ptr<facebook::react::ImageErrorInfo>>
+wicBitmapSourceFromMemory(const uint8_t *data, size_t size) noexcept {
+  try {
+    winrt::com_ptr<IWICImagingFactory> imagingFactory;
+    winrt::check_hresult(WICCreateImagingFactory_Proxy(WINCODEC_SDK_VERSION, imagingFactory.put()));
+
+    // The decoder reads the memory in place, it has to outlive the returned bitmap source
+    winrt::com_ptr<IWICStream> wicStream;
+    winrt::check_hresult(imagingFactory->CreateStream(wicStream.put()));
+    winrt::check_hresult(wicStream->InitializeFromMemory(const_cast<uint8_t *>(data), static_cast<DWORD>(size)));
 
-    winrt::com_ptr<IWICBitmapFrameDecode> decodedFrame;
-    winrt::check_hresult(bitmapDecoder->GetFrame(0, decodedFrame.put()));
-    return {decodedFrame, imagingFactory, nullptr};
+    return wicBitmapSourceFromIStream(imagingFactory, wicStream.as<IStream>());
   } catch (winrt::hresult_error const &ex) {
     auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-    errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
     errorInfo->error = ::Microsoft::ReactNative::FormatHResultError(winrt::hresult_error(ex));
     return {nullptr, nullptr, errorInfo};
   }
 }
 
+// Returns the frame scaled to the given size.  Decoders that implement IWICBitmapSourceTransform, like the JPEG
+// decoder, can scale while decoding (by a power of two, in the DCT), so the frame never has to be decoded at its full
+// size; the remaining scaling is done by an IWICBitmapScaler.
+static winrt::com_ptr<IWICBitmapSource> ScaleBitmapSource(
+    IWICImagingFactory *imagingFactory,
+    const winrt::com_ptr<IWICBitmapSource> &frame,
+    UINT width,
+    UINT height) {
+  winrt::com_ptr<IWICBitmapSource> source = frame;
+  UINT sourceWidth = 0, sourceHeight = 0;
+  winrt::check_hresult(frame->GetSize(&sourceWidth, &sourceHeight));
+
+  if (auto transform = frame.try_as<IWICBitmapSourceTransform>()) {
+    UINT transformedWidth = width, transformedHeight = height;
+    WICPixelFormatGUID pixelFormat = GUID_WICPixelFormat32bppPBGRA;
+    if (SUCCEEDED(transform->GetClosestSize(&transformedWidth, &transformedHeight)) && transformedWidth >= width &&
+        transformedHeight >= height && transformedWidth < sourceWidth &&
+        SUCCEEDED(transform->GetClosestPixelFormat(&pixelFormat))) {
+      winrt::com_ptr<IWICComponentInfo> componentInfo;
+      winrt::check_hresult(imagingFactory->CreateComponentInfo(pixelFormat, componentInfo.put()));
+      UINT bitsPerPixel = 0;
+      winrt::check_hresult(componentInfo.as<IWICPixelFormatInfo>()->GetBitsPerPixel(&bitsPerPixel));
+
+      const UINT stride = ((transformedWidth * bitsPerPixel + 31) / 32) * 4;
+      std::vector<BYTE> pixels(static_cast<size_t>(stride) * transformedHeight);
+      winrt::check_hresult(transform->CopyPixels(
+          nullptr,
+          transformedWidth,
+          transformedHeight,
+          &pixelFormat,
+          WICBitmapTransformRotate0,
+          stride,
+          static_cast<UINT>(pixels.size()),
+          pixels.data()));
+
+      winrt::com_ptr<IWICBitmap> transformedBitmap;
+      winrt::check_hresult(imagingFactory->CreateBitmapFromMemory(
+          transformedWidth,
+          transformedHeight,
+          pixelFormat,
+          stride,
+          static_cast<UINT>(pixels.size()),
+          pixels.data(),
+          transformedBitmap.put()));
+      source = transformedBitmap;
+      sourceWidth = transformedWidth;
+      sourceHeight = transformedHeight;
+    }
+  }
+
+  if (sourceWidth != width || sourceHeight != height) {
+    winrt::com_ptr<IWICBitmapScaler> scaler;
+    winrt::check_hresult(imagingFactory->CreateBitmapScaler(scaler.put()));
+    winrt::check_hresult(scaler->Initialize(source.get(), width, height, WICBitmapInterpolationModeFant));
+    source = scaler;
+  }
+  return source;
+}
+
+// Converts the frame to a bitmap that can be drawn, at the size it is shown at
+static std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>
+DecodeImageResponseImage(
+    IWICImagingFactory *imagingFactory,
+    winrt::com_ptr<IWICBitmapSource> decodedFrame,
+    const facebook::react::Size &decodeSize) {
+  auto image = std::make_shared<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>();
+  winrt::check_hresult(decodedFrame->GetSize(&image->m_naturalWidth, &image->m_naturalHeight));
+
+  // The resize mode of the view is not known here.  Scaling the image down until it just covers the view in both
+  // dimensions keeps enough pixels for Cover, which needs the most of the modes that scale the image.
+  const double scale = std::max(
+      decodeSize.width / std::max<UINT>(image->m_naturalWidth, 1),
+      decodeSize.height / std::max<UINT>(image->m_naturalHeight, 1));
+  if (scale > 0 && scale < 1) {
+    decodedFrame = ScaleBitmapSource(
+        imagingFactory,
+        decodedFrame,
+        std::max(static_cast<UINT>(std::ceil(image->m_naturalWidth * scale)), 1u),
+        std::max(static_cast<UINT>(std::ceil(image->m_naturalHeight * scale)), 1u));
+  }
+
+  winrt::com_ptr<IWICFormatConverter> converter;
+  winrt::check_hresult(imagingFactory->CreateFormatConverter(converter.put()));
+
+  winrt::check_hresult(converter->Initialize(
+      decodedFrame.get(),
+      GUID_WICPixelFormat32bppPBGRA,
+      WICBitmapDitherTypeNone,
+      nullptr,
+      0.0f,
+      WICBitmapPaletteTypeMedianCut));
+
+  winrt::check_hresult(
+      imagingFactory->CreateBitmapFromSource(converter.get(), WICBitmapCacheOnLoad, image->m_wicbmp.put()));
+  return image;
+}
+
+// Decodes the most refined level of a progressive JPEG, or an interlaced PNG or GIF, that the data received so far
+// holds, trying the levels from nextLevel on.  The last level is the full image, which is decoded once it is complete.
+// Returns nullptr when no further level can be decoded yet.
+static std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>
+DecodeProgressivePreview(
+    const std::vector<uint8_t> &received,
+    const facebook::react::Size &decodeSize,
+    UINT &nextLevel) noexcept {
+  auto [decodedFrame, imagingFactory, errorInfo] = wicBitmapSourceFromMemory(received.data(), received.size());
+  if (errorInfo) {
+    return nullptr;
+  }
+
+  auto levelControl = decodedFrame.try_as<IWICProgressiveLevelControl>();
+  UINT levelCount = 0;
+  if (!levelControl || FAILED(levelControl->GetLevelCount(&levelCount))) {
+    return nullptr;
+  }
+
+  std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage> preview;
+  for (; nextLevel + 1 < levelCount; nextLevel++) {
+    try {
+      winrt::check_hresult(levelControl->SetCurrentLevel(nextLevel));
+      preview = DecodeImageResponseImage(imagingFactory.get(), decodedFrame, decodeSize);
+    } catch (winrt::hresult_error const &) {
+      // The data of the level has not been received yet
+      break;
+    }
+  }
+  return preview;
+}
+
+// Responses decoded straight from the memory the body was received into
+static winrt::Microsoft::ReactNative::Composition::ImageResponse BodyImageResponse(
+    std::shared_ptr<const std::vector<uint8_t>> body) noexcept {
+  return winrt::make<winrt::Microsoft::ReactNative::Composition::implementation::StreamImageResponse>(std::move(body));
+}
+
+// Local files shown much smaller than they are, like the photos of a gallery, are read from the thumbnail cache of the
+// shell instead of being decoded from the whole file.  Returns nullptr when the file has to be decoded, like when its
+// thumbnail is smaller than the decode size, or is not an image of it.
+static winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::ReactNative::Composition::ImageResponse>
+FileThumbnailImageResponseAsync(winrt::Windows::Storage::StorageFile file, facebook::react::Size decodeSize) {
+  constexpr uint32_t maxThumbnailSize = 256;
+
+  // Thumbnails only hold the first frame of animated images
+  const auto fileType = file.FileType();
+  if (decodeSize.width <= 0 || decodeSize.height <= 0 || _wcsicmp(fileType.c_str(), L".gif") == 0 ||
+      _wcsicmp(fileType.c_str(), L".webp") == 0) {
+    co_return nullptr;
+  }
+
+  try {
+    // Only the metadata of the file is read for its size
+    const auto imageProperties = co_await file.Properties().GetImagePropertiesAsync();
+    const auto naturalWidth = imageProperties.Width();
+    const auto naturalHeight = imageProperties.Height();
+    const auto orientation = imageProperties.Orientation();
+    if (!naturalWidth || !naturalHeight ||
+        (orientation != winrt::Windows::Storage::FileProperties::PhotoOrientation::Normal &&
+         orientation != winrt::Windows::Storage::FileProperties::PhotoOrientation::Unspecified)) {
+      co_return nullptr;
+    }
+
+    // The thumbnail has to cover the decode size, like the scaled decode of the image does
+    const double scale = std::max(decodeSize.width / naturalWidth, decodeSize.height / naturalHeight);
+    const auto thumbnailSize =
+        static_cast<uint32_t>(std::ceil(std::max(naturalWidth, naturalHeight) * std::min(scale, 1.0)));
+    if (scale >= 1 || thumbnailSize > maxThumbnailSize) {
+      co_return nullptr;
+    }
+
+    const auto thumbnail = co_await file.GetThumbnailAsync(
+        winrt::Windows::Storage::FileProperties::ThumbnailMode::SingleItem,
+        thumbnailSize,
+        winrt::Windows::Storage::FileProperties::ThumbnailOptions::ResizeThumbnail);
+    if (!thumbnail || thumbnail.Type() != winrt::Windows::Storage::FileProperties::ThumbnailType::Image ||
+        thumbnail.ReturnedSmallerCachedSize()) {
+      co_return nullptr;
+    }
+
+    co_return winrt::make<winrt::Microsoft::ReactNative::Composition::implementation::StreamImageResponse>(
+        thumbnail, naturalWidth, naturalHeight);
+  } catch (winrt::hresult_error const &) {
+    co_return nullptr;
+  }
+}
+
+// Resumes the coroutine once the HttpRequestScheduler starts the download, with the slot of its origin, on the thread
+// that started it
+static auto ScheduleImageDownload(winrt::Windows::Foundation::Uri const &uri) noexcept {
+  using Microsoft::React::Networking::HttpRequestPriority;
+  using Microsoft::React::Networking::HttpRequestScheduler;
+
+  struct awaitable {
+    winrt::Windows::Foundation::Uri uri;
+    HttpRequestScheduler::Slot slot;
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    void await_suspend(winrt::impl::coroutine_handle<> handle) noexcept {
+      HttpRequestScheduler::Instance().Schedule(
+          uri, HttpRequestPriority::Image, [this, handle](HttpRequestScheduler::Slot slot) {
+            this->slot = std::move(slot);
+            handle();
+          });
+    }
+
+    HttpRequestScheduler::Slot await_resume() noexcept {
+      return std::move(slot);
+    }
+  };
+  return awaitable{uri, nullptr};
+}
+
 winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::ReactNative::Composition::ImageResponse>
 WindowsImageManager::GetImageRandomAccessStreamAsync(
     ReactImageSource source,
-    std::function<void(uint64_t loaded, uint64_t total)> progressCallback) const {
+    facebook::react::Size decodeSize,
+    std::function<void(uint64_t loaded, uint64_t total)> progressCallback,
+    std::function<void(const std::vector<uint8_t> &received)> partialContentCallback) const {
   co_await winrt::resume_background();
 
   winrt::Windows::Foundation::Uri uri(winrt::to_hstring(source.uri));
@@ -103,9 +357,30 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
       co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(L"Failed to get file.");
     }
 
+    if (isFile) {
+      if (auto thumbnailResponse = co_await FileThumbnailImageResponseAsync(file, decodeSize)) {
+        co_return thumbnailResponse;
+      }
+    }
+
     co_return winrt::Microsoft::ReactNative::Composition::StreamImageResponse(co_await file.OpenReadAsync());
   }
 
+  // Responses to plain GET requests are kept in the ImageDiskCache, and used while they are fresh
+  auto &diskCache = ImageDiskCache::Instance();
+  auto cacheKey = ImageDiskCache::Key(source);
+  auto cachedEntry = diskCache.read(cacheKey);
+  if (cachedEntry && cachedEntry->isFresh()) {
+    facebook::react::tracing::logImageLoad(
+        source.uri.c_str(), cachedEntry->body.size(), cachedEntry->body.size() /*bytesCopied*/);
+    co_return BodyImageResponse(std::make_shared<std::vector<uint8_t>>(std::move(cachedEntry->body)));
+  }
+
+  // Downloads share the connections to their origin with fetch, and wait behind its more urgent requests. The slot is
+  // held until the body has been read.
+  auto originSlot = co_await ScheduleImageDownload(uri);
+  co_await winrt::resume_background();
+
   auto httpMethod{
       source.method.empty() ? winrt::Windows::Web::Http::HttpMethod::Get()
                             : winrt::Windows::Web::Http::HttpMethod{winrt::to_hstring(source.method)}};
@@ -132,6 +407,10 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
     request.Content(bodyContent);
   }
 
+  if (cachedEntry) {
+    ImageDiskCache::AddValidators(request, *cachedEntry);
+  }
+
   auto asyncOp = m_httpClient.SendRequestAsync(request);
   co_await lessthrow_await_adapter<winrt::Windows::Foundation::IAsyncOperationWithProgress<
       winrt::Windows::Web::Http::HttpResponseMessage,
@@ -139,6 +418,11 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
 
   if (asyncOp.Status() == winrt::Windows::Foundation::AsyncStatus::Error ||
       asyncOp.Status() == winrt::Windows::Foundation::AsyncStatus::Canceled) {
+    if (cachedEntry && asyncOp.Status() == winrt::Windows::Foundation::AsyncStatus::Error) {
+      // Outdated images are better than none while offline
+      co_return BodyImageResponse(std::make_shared<std::vector<uint8_t>>(std::move(cachedEntry->body)));
+    }
+
     auto errorMessage = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
     co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
         winrt::to_hstring("Network request failed: " + errorMessage));
@@ -146,6 +430,11 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
 
   winrt::Windows::Web::Http::HttpResponseMessage response = asyncOp.GetResults();
 
+  if (cachedEntry && response.StatusCode() == winrt::Windows::Web::Http::HttpStatusCode::NotModified) {
+    diskCache.revalidate(cacheKey, *cachedEntry, response);
+    co_return BodyImageResponse(std::make_shared<std::vector<uint8_t>>(std::move(cachedEntry->body)));
+  }
+
   if (!response.IsSuccessStatusCode()) {
     co_return winrt::Microsoft::ReactNative::Composition::ImageFailedResponse(
         response.ReasonPhrase(), response.StatusCode(), response.Headers());
@@ -156,7 +445,13 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
   uint64_t total = contentLengthRef ? contentLengthRef.GetUInt64() : 0;
   uint64_t loaded = 0;
 
-  winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
+  // The body is read into a single buffer, which is decoded in place and written to the disk cache from there
+  auto body = std::make_shared<std::vector<uint8_t>>();
+  // Content-Length is only a hint for the size of the buffer, bodies that claim to be huge grow it as they arrive
+  constexpr uint64_t maxReservedBodySize = 64 * 1024 * 1024;
+  body->reserve(static_cast<size_t>(std::min(total, maxReservedBodySize)));
+  uint64_t bytesCopied = 0;
+
   winrt::Windows::Storage::Streams::DataReader reader(inputStream);
   constexpr uint32_t bufferSize = 16 * 1024;
 
@@ -165,87 +460,206 @@ WindowsImageManager::GetImageRandomAccessStreamAsync(
     if (loadedBuffer == 0)
       break;
 
-    auto buffer = reader.ReadBuffer(loadedBuffer);
-    co_await memoryStream.WriteAsync(buffer);
+    const auto offset = body->size();
+    if (offset + loadedBuffer > body->capacity()) {
+      // Growing the buffer moves the data received so far
+      bytesCopied += offset;
+      body->reserve(std::max<size_t>(body->capacity() * 2, offset + loadedBuffer));
+    }
+    body->resize(offset + loadedBuffer);
+    reader.ReadBytes(winrt::array_view<uint8_t>(body->data() + offset, body->data() + body->size()));
+    bytesCopied += loadedBuffer;
     loaded += loadedBuffer;
 
+    if (partialContentCallback && loaded != total) {
+      partialContentCallback(*body);
+    }
+
     if (progressCallback) {
       progressCallback(loaded, total);
     }
   }
 
-  memoryStream.Seek(0);
+  if (!cacheKey.empty()) {
+    diskCache.store(cacheKey, response, *body);
+  }
 
-  co_return winrt::Microsoft::ReactNative::Composition::StreamImageResponse(memoryStream.CloneStream());
+  facebook::react::tracing::logImageLoad(source.uri.c_str(), body->size(), bytesCopied);
+  co_return BodyImageResponse(std::move(body));
 }
 
-facebook::react::ImageRequest WindowsImageManager::requestImage(
-    const facebook::react::ImageSource &imageSource,
-    facebook::react::SurfaceId surfaceId) const {
-  auto imageRequest = facebook::react::ImageRequest(imageSource, nullptr, {});
-
-  auto weakObserverCoordinator = (std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator>)
-                                     imageRequest.getSharedObserverCoordinator();
+static winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo ResolveImageResponse(
+    const winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::ReactNative::Composition::ImageResponse>
+        &asyncOp,
+    winrt::Windows::Foundation::AsyncStatus status,
+    const facebook::react::Size &decodeSize) {
+  if (status == winrt::Windows::Foundation::AsyncStatus::Completed) {
+    auto imageResponse = asyncOp.GetResults();
+    auto selfImageResponse =
+        winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponse>(imageResponse);
+    return selfImageResponse->ResolveImage(decodeSize);
+  }
 
-  auto rnImageSource = winrt::Microsoft::ReactNative::Composition::implementation::MakeImageSource(imageSource);
-  auto provider = m_uriImageManager->TryGetUriImageProvider(m_reactContext.Handle(), rnImageSource);
+  winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo imageOrError;
+  imageOrError.errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
+  imageOrError.errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
+  return imageOrError;
+}
 
-  winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::ReactNative::Composition::ImageResponse>
-      imageResponseTask{nullptr};
+// ImageShadowNode requests images with the layout size of the view in the image source
+static facebook::react::Size DecodeSize(const facebook::react::ImageSource &imageSource) noexcept {
+  return {imageSource.size.width * imageSource.scale, imageSource.size.height * imageSource.scale};
+}
 
-  if (provider) {
-    imageResponseTask = provider.GetImageResponseAsync(m_reactContext.Handle(), rnImageSource);
+static void NotifyImageResponse(
+    const facebook::react::ImageResponseObserverCoordinator &observerCoordinator,
+    const winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo
+        &imageResultOrError) {
+  if (imageResultOrError.image) {
+    observerCoordinator.nativeImageResponseComplete(
+        facebook::react::ImageResponse(imageResultOrError.image, nullptr /*metadata*/));
   } else {
-    ReactImageSource source;
-    source.uri = imageSource.uri;
-    source.height = imageSource.size.height;
-    source.width = imageSource.size.width;
-    source.sourceType = ImageSourceType::Download;
-    source.body = imageSource.body;
-
-    auto progressCallback = [weakObserverCoordinator](int64_t loaded, int64_t total) {
-      if (auto observerCoordinator = weakObserverCoordinator.lock()) {
-        float progress = total > 0 ? static_cast<float>(loaded) / static_cast<float>(total) : 1.0f;
-        observerCoordinator->nativeImageResponseProgress(progress, loaded, total);
-      }
-    };
-    imageResponseTask = GetImageRandomAccessStreamAsync(source, progressCallback);
+    observerCoordinator.nativeImageResponseFailed(facebook::react::ImageLoadError(imageResultOrError.errorInfo));
   }
+}
 
-  imageResponseTask.Completed([weakObserverCoordinator](auto asyncOp, auto status) {
-    auto observerCoordinator = weakObserverCoordinator.lock();
-    if (!observerCoordinator) {
+void WindowsImageManager::loadImage(
+    const facebook::react::ImageSource &imageSource,
+    const std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator> &weakObserverCoordinator,
+    bool useCachedImage) const {
+  auto &cache = DecodedImageCache::Instance();
+  DecodedImageCache::Key cacheKey{imageSource};
+  if (useCachedImage) {
+    if (auto image = cache.find(cacheKey)) {
+      // The observer coordinator keeps the response, and passes it on to the observers added later
+      if (auto observerCoordinator = weakObserverCoordinator.lock()) {
+        observerCoordinator->nativeImageResponseComplete(facebook::react::ImageResponse(image, nullptr /*metadata*/));
+      }
       return;
     }
+  }
 
-    switch (status) {
-      case winrt::Windows::Foundation::AsyncStatus::Completed: {
-        auto imageResponse = asyncOp.GetResults();
-        auto selfImageResponse =
-            winrt::get_self<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponse>(imageResponse);
-        auto imageResultOrError = selfImageResponse->ResolveImage();
-        if (imageResultOrError.image) {
-          observerCoordinator->nativeImageResponseComplete(
-              facebook::react::ImageResponse(imageResultOrError.image, nullptr /*metadata*/));
-        } else {
-          observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(imageResultOrError.errorInfo));
+  if (!cache.addRequest(cacheKey, weakObserverCoordinator)) {
+    // Another request is already loading the same image, and will complete this one as well
+    return;
+  }
+
+  // Loads are queued in the ImageLoadScheduler, which might start them after this image manager is gone
+  auto scheduledLoad = ImageLoadScheduler::Instance().schedule(
+      cacheKey,
+      ImageLoadPriority::NearViewport,
+      [this, weakLifetime = std::weak_ptr<void>(m_lifetime), imageSource, cacheKey](
+          ImageLoadScheduler::LoadSlot slot) {
+        auto &cache = DecodedImageCache::Instance();
+        if (cache.pendingObservers(cacheKey).empty()) {
+          // Every request waiting on the load was cancelled before it started
+          return;
         }
-        break;
-      }
-      case winrt::Windows::Foundation::AsyncStatus::Canceled: {
-        auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-        errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
-        observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(errorInfo));
-        break;
-      }
-      case winrt::Windows::Foundation::AsyncStatus::Error: {
-        auto errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
-        errorInfo->error = FormatHResultError(winrt::hresult_error(asyncOp.ErrorCode()));
-        observerCoordinator->nativeImageResponseFailed(facebook::react::ImageLoadError(errorInfo));
-        break;
-      }
-    }
-  });
+
+        auto lifetime = weakLifetime.lock();
+        if (!lifetime) {
+          cache.completeRequest(cacheKey, nullptr);
+          return;
+        }
+
+        ReactImageSource source;
+        source.uri = imageSource.uri;
+        source.height = imageSource.size.height;
+        source.width = imageSource.size.width;
+        source.sourceType = ImageSourceType::Download;
+        source.body = imageSource.body;
+
+        auto progressCallback = [cacheKey](int64_t loaded, int64_t total) {
+          float progress = total > 0 ? static_cast<float>(loaded) / static_cast<float>(total) : 1.0f;
+          for (const auto &observer : DecodedImageCache::Instance().pendingObservers(cacheKey)) {
+            if (auto observerCoordinator = observer.lock()) {
+              observerCoordinator->nativeImageResponseProgress(progress, loaded, total);
+            }
+          }
+        };
+        // Progressive images are shown at increasing quality while they download, the first preview is attempted after
+        // a few KB have arrived, and further ones each time the received data doubles
+        struct PreviewProgress {
+          uint64_t nextAttemptAt{8 * 1024};
+          UINT nextLevel{0};
+        };
+        auto partialContentCallback =
+            [cacheKey, decodeSize = DecodeSize(imageSource), previewProgress = std::make_shared<PreviewProgress>()](
+                const std::vector<uint8_t> &received) {
+              if (received.size() < previewProgress->nextAttemptAt) {
+                return;
+              }
+              previewProgress->nextAttemptAt = received.size() * 2;
+              if (auto preview = DecodeProgressivePreview(received, decodeSize, previewProgress->nextLevel)) {
+                DecodedImageCache::Instance().setRequestPreview(cacheKey, preview);
+              }
+            };
+        auto imageResponseTask = GetImageRandomAccessStreamAsync(
+            source, DecodeSize(imageSource), progressCallback, partialContentCallback);
+        cache.setRequestOperation(cacheKey, imageResponseTask);
+
+        // The load keeps its slot in the scheduler until the image is decoded
+        imageResponseTask.Completed(
+            [cacheKey, decodeSize = DecodeSize(imageSource), slot = std::move(slot)](
+                auto asyncOp, auto status) mutable {
+              auto &cache = DecodedImageCache::Instance();
+
+              // Requests for the same image added while it is resolved are completed by this load as well
+              auto imageResultOrError = ResolveImageResponse(asyncOp, status, decodeSize);
+              cache.insert(cacheKey, imageResultOrError.image);
+              for (const auto &observer : cache.completeRequest(cacheKey, asyncOp)) {
+                if (auto observerCoordinator = observer.lock()) {
+                  NotifyImageResponse(*observerCoordinator, imageResultOrError);
+                }
+              }
+              slot = nullptr;
+            });
+      });
+  cache.setRequestLoad(cacheKey, scheduledLoad);
+}
+
+facebook::react::ImageRequest WindowsImageManager::requestImage(
+    const facebook::react::ImageSource &imageSource,
+    facebook::react::SurfaceId surfaceId) const {
+  auto rnImageSource = winrt::Microsoft::ReactNative::Composition::implementation::MakeImageSource(imageSource);
+  auto provider = m_uriImageManager->TryGetUriImageProvider(m_reactContext.Handle(), rnImageSource);
+
+  if (provider) {
+    auto imageRequest = facebook::react::ImageRequest(imageSource, nullptr, {});
+    auto weakObserverCoordinator = (std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator>)
+                                       imageRequest.getSharedObserverCoordinator();
+
+    auto imageResponseTask = provider.GetImageResponseAsync(m_reactContext.Handle(), rnImageSource);
+    imageResponseTask.Completed(
+        [weakObserverCoordinator, decodeSize = DecodeSize(imageSource)](auto asyncOp, auto status) {
+          if (auto observerCoordinator = weakObserverCoordinator.lock()) {
+            NotifyImageResponse(*observerCoordinator, ResolveImageResponse(asyncOp, status, decodeSize));
+          }
+        });
+    return imageRequest;
+  }
+
+  // Images without a custom UriImageProvider are decoded to bitmaps, which are shared through the DecodedImageCache.
+  // Loads are shared by all the requests for the same image, so cancelling a request only stops it from waiting on the
+  // load, and resuming it waits on the load again, or starts a new one once the load was cancelled.
+  auto weakObserverCoordinator =
+      std::make_shared<std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator>>();
+  auto imageRequest = facebook::react::ImageRequest(
+      imageSource,
+      nullptr,
+      facebook::react::SharedFunction<>{[this, imageSource, weakObserverCoordinator]() {
+        loadImage(imageSource, *weakObserverCoordinator, true /*useCachedImage*/);
+      }},
+      facebook::react::SharedFunction<>{[cacheKey = DecodedImageCache::Key{imageSource}, weakObserverCoordinator]() {
+        auto observerCoordinator = weakObserverCoordinator->lock();
+        DecodedImageCache::Instance().cancelRequest(cacheKey, observerCoordinator.get());
+      }});
+  *weakObserverCoordinator = imageRequest.getSharedObserverCoordinator();
+
+  loadImage(
+      imageSource,
+      *weakObserverCoordinator,
+      imageSource.cache != facebook::react::ImageSource::CacheStategy::Reload /*useCachedImage*/);
   return imageRequest;
 }
 
@@ -261,42 +675,50 @@ facebook::react::ImageRequest WindowsImageManager::requestImage(
 
 namespace winrt::Microsoft::ReactNative::Composition::implementation {
 
-ImageResponseOrImageErrorInfo StreamImageResponse::ResolveImage() {
+ImageResponseOrImageErrorInfo StreamImageResponse::ResolveImage(const facebook::react::Size &decodeSize) {
   ImageResponseOrImageErrorInfo imageOrError;
   try {
-    auto result = ::Microsoft::ReactNative::wicBitmapSourceFromStream(m_stream);
+    // Animated images are decoded at their natural size, the size of the canvas their frames are composed onto
+    auto animatedImage = m_body ? ::Microsoft::ReactNative::AnimatedImage::TryCreate(m_body)
+                                : ::Microsoft::ReactNative::AnimatedImage::TryCreate(m_stream);
+    if (animatedImage) {
+      imageOrError.image = std::make_shared<ImageResponseImage>();
+      imageOrError.image->m_wicbmp = animatedImage->firstFrame();
+      imageOrError.image->m_naturalWidth = animatedImage->width();
+      imageOrError.image->m_naturalHeight = animatedImage->height();
+      imageOrError.image->m_animatedImage = std::move(animatedImage);
+      return imageOrError;
+    }
+    if (m_stream) {
+      m_stream.Seek(0);
+    }
+
+    auto result = m_body ? ::Microsoft::ReactNative::wicBitmapSourceFromMemory(m_body->data(), m_body->size())
+                         : ::Microsoft::ReactNative::wicBitmapSourceFromStream(m_stream);
 
     if (auto errorInfo = std::get<std::shared_ptr<facebook::react::ImageErrorInfo>>(result)) {
       imageOrError.errorInfo = errorInfo;
       return imageOrError;
     }
 
-    auto imagingFactory = std::get<winrt::com_ptr<IWICImagingFactory>>(result);
-    auto decodedFrame = std::get<winrt::com_ptr<IWICBitmapSource>>(result);
-
-    winrt::com_ptr<IWICFormatConverter> converter;
-    winrt::check_hresult(imagingFactory->CreateFormatConverter(converter.put()));
-
-    winrt::check_hresult(converter->Initialize(
-        decodedFrame.get(),
-        GUID_WICPixelFormat32bppPBGRA,
-        WICBitmapDitherTypeNone,
-        nullptr,
-        0.0f,
-        WICBitmapPaletteTypeMedianCut));
-
-    imageOrError.image =
-        std::make_shared<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>();
-    winrt::check_hresult(imagingFactory->CreateBitmapFromSource(
-        converter.get(), WICBitmapCacheOnLoad, imageOrError.image->m_wicbmp.put()));
+    imageOrError.image = ::Microsoft::ReactNative::DecodeImageResponseImage(
+        std::get<winrt::com_ptr<IWICImagingFactory>>(result).get(),
+        std::get<winrt::com_ptr<IWICBitmapSource>>(result),
+        decodeSize);
+    if (m_naturalWidth && m_naturalHeight) {
+      imageOrError.image->m_naturalWidth = m_naturalWidth;
+      imageOrError.image->m_naturalHeight = m_naturalHeight;
+    }
   } catch (winrt::hresult_error const &ex) {
+    imageOrError.image = nullptr;
     imageOrError.errorInfo = std::make_shared<facebook::react::ImageErrorInfo>();
     imageOrError.errorInfo->error = ::Microsoft::ReactNative::FormatHResultError(winrt::hresult_error(ex));
   }
   return imageOrError;
 }
 
-ImageResponseOrImageErrorInfo UriBrushFactoryImageResponse::ResolveImage() {
+ImageResponseOrImageErrorInfo UriBrushFactoryImageResponse::ResolveImage(
+    const facebook::react::Size & /*decodeSize*/) {
   ImageResponseOrImageErrorInfo imageOrError;
   imageOrError.image =
       std::make_shared<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>();
@@ -322,7 +744,7 @@ ImageResponseOrImageErrorInfo UriBrushFactoryImageResponse::ResolveImage() {
 namespace winrt::Microsoft::ReactNative::Composition::Experimental::implementation {
 
 winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo
-UriBrushFactoryImageResponse::ResolveImage() {
+UriBrushFactoryImageResponse::ResolveImage(const facebook::react::Size & /*decodeSize*/) {
   winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseOrImageErrorInfo imageOrError;
   imageOrError.image =
       std::make_shared<winrt::Microsoft::ReactNative::Composition::implementation::ImageResponseImage>();
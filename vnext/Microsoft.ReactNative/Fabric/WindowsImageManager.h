@@ -28,15 +28,24 @@ struct WindowsImageManager {
       facebook::react::Tag /* tag */) const;
 
  private:
+  void loadImage(
+      const facebook::react::ImageSource &imageSource,
+      const std::weak_ptr<const facebook::react::ImageResponseObserverCoordinator> &weakObserverCoordinator,
+      bool useCachedImage) const;
+
   winrt::Windows::Foundation::IAsyncOperation<winrt::Microsoft::ReactNative::Composition::ImageResponse>
   GetImageRandomAccessStreamAsync(
       ReactImageSource source,
-      std::function<void(uint64_t loaded, uint64_t total)> progressCallback) const;
+      facebook::react::Size decodeSize,
+      std::function<void(uint64_t loaded, uint64_t total)> progressCallback,
+      std::function<void(const std::vector<uint8_t> &received)> partialContentCallback) const;
 
   winrt::Windows::Web::Http::HttpClient m_httpClient;
   winrt::Microsoft::ReactNative::ReactContext m_reactContext;
   winrt::hstring m_defaultUserAgent;
   std::shared_ptr<winrt::Microsoft::ReactNative::Composition::implementation::UriImageManager> m_uriImageManager;
+  // Lets queued image loads find out whether the image manager is still alive when they start
+  std::shared_ptr<void> m_lifetime{std::make_shared<bool>(true)};
 };
 
 std::tuple<
@@ -45,4 +54,10 @@ std::tuple<
     std::shared_ptr<facebook::react::ImageErrorInfo>>
 wicBitmapSourceFromStream(const winrt::Windows::Storage::Streams::IRandomAccessStream &stream) noexcept;
 
+std::tuple<
+    winrt::com_ptr<IWICBitmapSource>,
+    winrt::com_ptr<IWICImagingFactory>,
+    std::shared_ptr<facebook::react::ImageErrorInfo>>
+wicBitmapSourceFromMemory(const uint8_t *data, size_t size) noexcept;
+
 } // namespace Microsoft::ReactNative
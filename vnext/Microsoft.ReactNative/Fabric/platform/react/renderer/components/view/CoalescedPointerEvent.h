@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <react/renderer/components/view/PointerEvent.h>
+#include <vector>
+
+namespace facebook::react {
+
+// A pointermove sent for several moves of the pointer, which are exposed to JS as the coalescedEvents of the event,
+// backing PointerEvent.getCoalescedEvents()
+struct CoalescedPointerEvent : public PointerEvent {
+  CoalescedPointerEvent(const PointerEvent &event, std::vector<PointerEvent> coalescedEvents)
+      : PointerEvent(event), coalescedEvents(std::move(coalescedEvents)){};
+
+  std::vector<PointerEvent> coalescedEvents;
+
+  jsi::Value asJSIValue(jsi::Runtime &runtime) const override {
+    auto payload = PointerEvent::asJSIValue(runtime).asObject(runtime);
+    auto events = jsi::Array(runtime, coalescedEvents.size());
+    for (size_t i = 0; i < coalescedEvents.size(); i++) {
+      events.setValueAtIndex(runtime, i, coalescedEvents[i].asJSIValue(runtime));
+    }
+    payload.setProperty(runtime, "coalescedEvents", events);
+    return payload;
+  };
+};
+
+} // namespace facebook::react
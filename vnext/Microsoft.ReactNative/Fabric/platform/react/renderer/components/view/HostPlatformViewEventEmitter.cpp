@@ -46,6 +46,14 @@ void HostPlatformViewEventEmitter::onMouseLeave(MouseEvent const &pointerEvent)
   dispatchEvent("mouseLeave", std::make_shared<MouseEvent>(pointerEvent), RawEvent::Category::ContinuousStart);
 }
 
+#pragma mark - Pointer Events
+
+void HostPlatformViewEventEmitter::onCoalescedPointerMove(
+    PointerEvent const &pointerEvent,
+    std::vector<PointerEvent> coalescedEvents) const {
+  dispatchUniqueEvent("pointerMove", std::make_shared<CoalescedPointerEvent>(pointerEvent, std::move(coalescedEvents)));
+}
+
 #pragma mark - Touch Events
 
 void HostPlatformViewEventEmitter::onPressIn(GestureResponderEvent event) const {
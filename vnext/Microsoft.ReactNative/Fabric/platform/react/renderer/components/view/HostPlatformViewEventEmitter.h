@@ -4,6 +4,7 @@
 #pragma once
 
 #include <react/renderer/components/view/BaseViewEventEmitter.h>
+#include "CoalescedPointerEvent.h"
 #include "KeyEvent.h"
 #include "MouseEvent.h"
 
@@ -36,6 +37,11 @@ class HostPlatformViewEventEmitter : public BaseViewEventEmitter {
   void onMouseEnter(MouseEvent const &pointerEvent) const;
   void onMouseLeave(MouseEvent const &pointerEvent) const;
 
+#pragma mark - Pointer Events
+
+  // pointerMove for the latest of the coalescedEvents, which end with it
+  void onCoalescedPointerMove(PointerEvent const &pointerEvent, std::vector<PointerEvent> coalescedEvents) const;
+
 #pragma mark - Touch Events
 
   virtual void onPressIn(GestureResponderEvent event) const;
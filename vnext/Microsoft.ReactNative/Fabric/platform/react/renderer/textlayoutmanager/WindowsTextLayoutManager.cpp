@@ -7,9 +7,13 @@
 
 #include <Fabric/DWriteHelpers.h>
 #include <Utils/TransformableText.h>
+#include <algorithm>
 #include <dwrite.h>
 #include <dwrite_1.h>
+#include <list>
+#include <mutex>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
+#include <react/utils/SimpleThreadSafeCache.h>
 #include "WindowsTextLayoutManager.h"
 
 #include <unicode.h>
@@ -66,6 +70,166 @@ class AttachmentInlineObject : public winrt::implements<AttachmentInlineObject,
   float m_height;
 };
 
+// The parts of the TextAttributes of the outer fragment that IDWriteTextFormat is created from
+struct TextFormatKey {
+  std::string fontFamily;
+  DWRITE_FONT_WEIGHT fontWeight;
+  DWRITE_FONT_STYLE fontStyle;
+  float fontSize;
+  std::optional<float> lineHeight;
+  std::optional<DWRITE_READING_DIRECTION> readingDirection;
+  DWRITE_TEXT_ALIGNMENT alignment;
+
+  bool operator==(const TextFormatKey &rhs) const noexcept {
+    return fontFamily == rhs.fontFamily && fontWeight == rhs.fontWeight && fontStyle == rhs.fontStyle &&
+        fontSize == rhs.fontSize && lineHeight == rhs.lineHeight && readingDirection == rhs.readingDirection &&
+        alignment == rhs.alignment;
+  }
+};
+
+} // namespace facebook::react
+
+template <>
+struct std::hash<facebook::react::TextFormatKey> {
+  size_t operator()(const facebook::react::TextFormatKey &key) const noexcept {
+    size_t seed = std::hash<std::string>{}(key.fontFamily);
+    auto combine = [&seed](size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+    combine(std::hash<int>{}(key.fontWeight));
+    combine(std::hash<int>{}(key.fontStyle));
+    combine(std::hash<float>{}(key.fontSize));
+    combine(std::hash<std::optional<float>>{}(key.lineHeight));
+    combine(key.readingDirection ? std::hash<int>{}(*key.readingDirection) : 0x7f);
+    combine(std::hash<int>{}(key.alignment));
+    return seed;
+  }
+};
+
+namespace facebook::react {
+
+// Most apps use a handful of fonts, so the UTF-16 family names are only converted once
+constexpr int kFontFamilyNameCacheSize = 64;
+// Enough for the text styles of a typical app, formats are small
+constexpr int kTextFormatCacheSize = 256;
+
+static std::wstring FontFamilyName(const std::string &fontFamily) noexcept {
+  if (fontFamily.empty()) {
+    return L"Segoe UI";
+  }
+
+  static SimpleThreadSafeCache<std::string, std::wstring, kFontFamilyNameCacheSize> s_fontFamilyNames;
+  return s_fontFamilyNames.get(
+      fontFamily, [&fontFamily]() { return Microsoft::Common::Unicode::Utf8ToUtf16(fontFamily); });
+}
+
+// Text formats are only configured when they are created, so they can be shared by all the layouts that use the same
+// attributes.  The shared DWrite factory makes them safe to use from any thread.
+static winrt::com_ptr<IDWriteTextFormat> CachedTextFormat(const TextFormatKey &key) noexcept {
+  static SimpleThreadSafeCache<TextFormatKey, winrt::com_ptr<IDWriteTextFormat>, kTextFormatCacheSize> s_textFormats;
+  return s_textFormats.get(key, [&key]() {
+    winrt::com_ptr<IDWriteTextFormat> spTextFormat;
+    winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextFormat(
+        FontFamilyName(key.fontFamily).c_str(),
+        nullptr, // Font collection (nullptr sets it to use the system font collection).
+        key.fontWeight,
+        key.fontStyle,
+        DWRITE_FONT_STRETCH_NORMAL,
+        key.fontSize,
+        L"",
+        spTextFormat.put()));
+
+    if (key.lineHeight) {
+      winrt::check_hresult(spTextFormat->SetLineSpacing(
+          DWRITE_LINE_SPACING_METHOD_UNIFORM,
+          *key.lineHeight,
+          // Recommended ratio of baseline to lineSpacing is 80%
+          // https://learn.microsoft.com/en-us/windows/win32/api/dwrite/nf-dwrite-idwritetextformat-getlinespacing
+          // It is possible we need to load full font metrics to calculate a better baseline value.
+          // For a particular font, you can determine what lineSpacing and baseline should be by examining a
+          // DWRITE_FONT_METRICS method available from the GetMetrics method of IDWriteFont or IDWriteFontFace. For
+          // normal behavior, you'd set lineSpacing to the sum of ascent, descent and lineGap (adjusted for the em size,
+          // of course), and baseline to the ascent value.
+          *key.lineHeight * 0.8f));
+    }
+
+    if (key.readingDirection) {
+      winrt::check_hresult(spTextFormat->SetReadingDirection(*key.readingDirection));
+    }
+
+    winrt::check_hresult(spTextFormat->SetTextAlignment(key.alignment));
+    return spTextFormat;
+  });
+}
+
+// Layouts are usually taken by the paint of their text shortly after they were measured, so this only needs to cover
+// the text nodes of a few commits
+constexpr size_t kMeasuredTextLayoutCacheSize = 128;
+
+struct MeasuredTextLayout {
+  size_t hash;
+  AttributedString attributedString;
+  ParagraphAttributes paragraphAttributes;
+  winrt::com_ptr<IDWriteTextLayout> spTextLayout;
+};
+
+static std::mutex s_measuredTextLayoutsMutex;
+// Ordered from the oldest to the most recently measured
+static std::list<MeasuredTextLayout> s_measuredTextLayouts;
+
+static size_t MeasuredTextLayoutHash(
+    const AttributedString &attributedString,
+    const ParagraphAttributes &paragraphAttributes) noexcept {
+  auto seed = std::hash<AttributedString>{}(attributedString);
+  return seed ^ (std::hash<ParagraphAttributes>{}(paragraphAttributes) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+void WindowsTextLayoutManager::CacheMeasuredTextLayout(
+    const AttributedString &attributedString,
+    const ParagraphAttributes &paragraphAttributes,
+    winrt::com_ptr<IDWriteTextLayout> &&spTextLayout) noexcept {
+  MeasuredTextLayout entry{
+      MeasuredTextLayoutHash(attributedString, paragraphAttributes),
+      attributedString,
+      paragraphAttributes,
+      std::move(spTextLayout)};
+
+  std::scoped_lock lock(s_measuredTextLayoutsMutex);
+  s_measuredTextLayouts.push_back(std::move(entry));
+  if (s_measuredTextLayouts.size() > kMeasuredTextLayoutCacheSize) {
+    s_measuredTextLayouts.pop_front();
+  }
+}
+
+winrt::com_ptr<IDWriteTextLayout> WindowsTextLayoutManager::TakeMeasuredTextLayout(
+    const AttributedString &attributedString,
+    const ParagraphAttributes &paragraphAttributes) noexcept {
+  auto hash = MeasuredTextLayoutHash(attributedString, paragraphAttributes);
+
+  std::scoped_lock lock(s_measuredTextLayoutsMutex);
+  // Search from the most recent, which is the most likely to be painted next
+  for (auto it = s_measuredTextLayouts.rbegin(); it != s_measuredTextLayouts.rend(); ++it) {
+    if (it->hash == hash && it->attributedString == attributedString &&
+        it->paragraphAttributes == paragraphAttributes) {
+      auto spTextLayout = std::move(it->spTextLayout);
+      s_measuredTextLayouts.erase(std::next(it).base());
+      return spTextLayout;
+    }
+  }
+  return nullptr;
+}
+
+size_t WindowsTextLayoutManager::MeasuredTextLayoutCount() noexcept {
+  std::scoped_lock lock(s_measuredTextLayoutsMutex);
+  return s_measuredTextLayouts.size();
+}
+
+void WindowsTextLayoutManager::ClearMeasuredTextLayouts() noexcept {
+  std::list<MeasuredTextLayout> measuredTextLayouts;
+  {
+    std::scoped_lock lock(s_measuredTextLayoutsMutex);
+    measuredTextLayouts.swap(s_measuredTextLayouts);
+  }
+}
+
 TextLayoutManager::TextLayoutManager(const std::shared_ptr<const ContextContainer> &contextContainer)
     : contextContainer_(contextContainer), textMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
 
@@ -94,8 +258,6 @@ void WindowsTextLayoutManager::GetTextLayout(
   else if (outerFragment.textAttributes.fontStyle == facebook::react::FontStyle::Oblique)
     style = DWRITE_FONT_STYLE_OBLIQUE;
 
-  winrt::com_ptr<IDWriteTextFormat> spTextFormat;
-
   float fontSizeText = outerFragment.textAttributes.fontSize;
   if (outerFragment.textAttributes.allowFontScaling.value_or(true) &&
       !std::isnan(outerFragment.textAttributes.fontSizeMultiplier)) {
@@ -109,31 +271,18 @@ void WindowsTextLayoutManager::GetTextLayout(
         : outerFragment.textAttributes.fontSizeMultiplier;
   }
 
-  winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextFormat(
-      outerFragment.textAttributes.fontFamily.empty()
-          ? L"Segoe UI"
-          : Microsoft::Common::Unicode::Utf8ToUtf16(outerFragment.textAttributes.fontFamily).c_str(),
-      nullptr, // Font collection (nullptr sets it to use the system font collection).
+  TextFormatKey textFormatKey{
+      outerFragment.textAttributes.fontFamily,
       static_cast<DWRITE_FONT_WEIGHT>(outerFragment.textAttributes.fontWeight.value_or(
           static_cast<facebook::react::FontWeight>(DWRITE_FONT_WEIGHT_REGULAR))),
       style,
-      DWRITE_FONT_STRETCH_NORMAL,
       fontSizeText,
-      L"",
-      spTextFormat.put()));
+      std::nullopt,
+      std::nullopt,
+      DWRITE_TEXT_ALIGNMENT_LEADING};
 
   if (!isnan(outerFragment.textAttributes.lineHeight)) {
-    winrt::check_hresult(spTextFormat->SetLineSpacing(
-        DWRITE_LINE_SPACING_METHOD_UNIFORM,
-        outerFragment.textAttributes.lineHeight,
-        // Recommended ratio of baseline to lineSpacing is 80%
-        // https://learn.microsoft.com/en-us/windows/win32/api/dwrite/nf-dwrite-idwritetextformat-getlinespacing
-        // It is possible we need to load full font metrics to calculate a better baseline value.
-        // For a particular font, you can determine what lineSpacing and baseline should be by examining a
-        // DWRITE_FONT_METRICS method available from the GetMetrics method of IDWriteFont or IDWriteFontFace. For normal
-        // behavior, you'd set lineSpacing to the sum of ascent, descent and lineGap (adjusted for the em size, of
-        // course), and baseline to the ascent value.
-        outerFragment.textAttributes.lineHeight * 0.8f));
+    textFormatKey.lineHeight = outerFragment.textAttributes.lineHeight;
   }
 
   // Set reading direction (RTL/LTR) based on baseWritingDirection
@@ -152,7 +301,7 @@ void WindowsTextLayoutManager::GetTextLayout(
       isRTL = (outerFragment.textAttributes.layoutDirection == facebook::react::LayoutDirection::RightToLeft);
       readingDirection = isRTL ? DWRITE_READING_DIRECTION_RIGHT_TO_LEFT : DWRITE_READING_DIRECTION_LEFT_TO_RIGHT;
     }
-    winrt::check_hresult(spTextFormat->SetReadingDirection(readingDirection));
+    textFormatKey.readingDirection = readingDirection;
   }
 
   // Set text alignment
@@ -179,10 +328,13 @@ void WindowsTextLayoutManager::GetTextLayout(
         assert(false);
     }
   }
-  winrt::check_hresult(spTextFormat->SetTextAlignment(alignment));
+  textFormatKey.alignment = alignment;
+
+  auto spTextFormat = CachedTextFormat(textFormatKey);
 
   // Get text with Object Replacement Characters for attachments
-  auto str = GetTransformedText(attributedStringBox);
+  auto transformedText = GetTransformedText(attributedStringBox);
+  const auto &str = transformedText->text;
   winrt::check_hresult(Microsoft::ReactNative::DWriteFactory()->CreateTextLayout(
       str.c_str(), // The string to be laid out and formatted.
       static_cast<UINT32>(str.size()), // The length of the string.
@@ -226,8 +378,9 @@ void WindowsTextLayoutManager::GetTextLayout(
   }
 
   // Calculate positions for attachments and set inline objects
-  unsigned int position = 0;
-  for (const auto &fragment : fragments) {
+  for (size_t fragmentIndex = 0; fragmentIndex < fragments.size(); fragmentIndex++) {
+    const auto &fragment = fragments[fragmentIndex];
+    const auto position = transformedText->fragmentOffsets[fragmentIndex];
     if (fragment.isAttachment()) {
       float width = fragment.parentShadowView.layoutMetrics.frame.size.width;
       float height = fragment.parentShadowView.layoutMetrics.frame.size.height;
@@ -262,9 +415,8 @@ void WindowsTextLayoutManager::GetTextLayout(
       };
       attachment.isClipped = isClipped;
       attachments.push_back(attachment);
-      position += 1;
     } else {
-      unsigned int length = static_cast<UINT32>(fragment.string.length());
+      const auto length = transformedText->fragmentOffsets[fragmentIndex + 1] - position;
       DWRITE_TEXT_RANGE range = {position, length};
       TextAttributes attributes = fragment.textAttributes;
       DWRITE_FONT_STYLE fragmentStyle = DWRITE_FONT_STYLE_NORMAL;
@@ -273,10 +425,7 @@ void WindowsTextLayoutManager::GetTextLayout(
       else if (attributes.fontStyle == facebook::react::FontStyle::Oblique)
         fragmentStyle = DWRITE_FONT_STYLE_OBLIQUE;
 
-      winrt::check_hresult(spTextLayout->SetFontFamilyName(
-          attributes.fontFamily.empty() ? L"Segoe UI"
-                                        : Microsoft::Common::Unicode::Utf8ToUtf16(attributes.fontFamily).c_str(),
-          range));
+      winrt::check_hresult(spTextLayout->SetFontFamilyName(FontFamilyName(attributes.fontFamily).c_str(), range));
       winrt::check_hresult(spTextLayout->SetFontWeight(
           static_cast<DWRITE_FONT_WEIGHT>(
               attributes.fontWeight.value_or(static_cast<facebook::react::FontWeight>(DWRITE_FONT_WEIGHT_REGULAR))),
@@ -299,7 +448,6 @@ void WindowsTextLayoutManager::GetTextLayout(
         winrt::check_hresult(
             spTextLayout.as<IDWriteTextLayout1>()->SetCharacterSpacing(0, attributes.letterSpacing, 0, range));
       }
-      position += length;
     }
   }
 }
@@ -323,10 +471,49 @@ void WindowsTextLayoutManager::GetTextLayout(
     GetTextLayoutByAdjustingFontSizeToFit(
         attributedStringBox, paragraphAttributes, layoutConstraints, spTextLayout, attachments, minimumFontScale);
   } else {
+    // Reuse the layout from measuring the text if there is one.  Only the layout box can differ, and changing it keeps
+    // the shaping work that makes up most of the cost of a layout.
+    if (auto spMeasuredTextLayout = TakeMeasuredTextLayout(attributedStringBox.getValue(), paragraphAttributes)) {
+      winrt::check_hresult(spMeasuredTextLayout->SetMaxWidth(layoutConstraints.maximumSize.width));
+      winrt::check_hresult(spMeasuredTextLayout->SetMaxHeight(layoutConstraints.maximumSize.height));
+      spTextLayout = std::move(spMeasuredTextLayout);
+      return;
+    }
+
     GetTextLayout(attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
   }
 }
 
+// The font size that adjustsFontSizeToFit settled on for a text, within a box
+struct FittedFontSizeKey {
+  AttributedString attributedString;
+  ParagraphAttributes paragraphAttributes;
+  Size maximumSize;
+
+  bool operator==(const FittedFontSizeKey &rhs) const noexcept {
+    return maximumSize == rhs.maximumSize && paragraphAttributes == rhs.paragraphAttributes &&
+        attributedString == rhs.attributedString;
+  }
+};
+
+} // namespace facebook::react
+
+template <>
+struct std::hash<facebook::react::FittedFontSizeKey> {
+  size_t operator()(const facebook::react::FittedFontSizeKey &key) const noexcept {
+    size_t seed = std::hash<facebook::react::AttributedString>{}(key.attributedString);
+    auto combine = [&seed](size_t value) { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+    combine(std::hash<facebook::react::ParagraphAttributes>{}(key.paragraphAttributes));
+    combine(std::hash<float>{}(key.maximumSize.width));
+    combine(std::hash<float>{}(key.maximumSize.height));
+    return seed;
+  }
+};
+
+namespace facebook::react {
+
+constexpr int kFittedFontSizeCacheSize = 256;
+
 void WindowsTextLayoutManager::GetTextLayoutByAdjustingFontSizeToFit(
     AttributedStringBox attributedStringBox,
     const ParagraphAttributes &paragraphAttributes,
@@ -336,59 +523,140 @@ void WindowsTextLayoutManager::GetTextLayoutByAdjustingFontSizeToFit(
     float minimumFontScale) noexcept {
   /* This function constructs a text layout from the given parameters.
   If the generated text layout doesn't fit within the given layout constraints,
-  it will reduce the font size and construct a new text layout. This process will
-  be repeated until the text layout meets the constraints.*/
+  it reduces the font size in steps of fontReduceFactor, and uses the largest size that fits.
+  Fitting is monotonic in the font size, so the step is found with a binary search, which starts from an estimate
+  based on how much the first layout overflows.  The result is remembered for the text and box.*/
 
-  DWRITE_TEXT_METRICS metrics;
-
-  // Better Approach should be implemented, this uses O(n)
   constexpr auto fontReduceFactor = 1.0f;
-  auto attributedStringToResize = attributedStringBox.getValue();
-  auto fragmentsCopyToResize = attributedStringToResize.getFragments();
-  if (fragmentsCopyToResize.empty()) {
+  const auto &attributedString = attributedStringBox.getValue();
+  const auto &fragments = attributedString.getFragments();
+  if (fragments.empty()) {
     return; // No fragments to process
   }
 
-  float initialFontSize = fragmentsCopyToResize[0].textAttributes.fontSize;
-  float currentFontSize = initialFontSize;
+  float initialFontSize = fragments[0].textAttributes.fontSize;
 
   // Calculate the minimum font size as per Android/IOS
   float minimumFontSize = std::max(minimumFontScale * initialFontSize, 4.0f);
 
-  // Initial measurement
-  GetTextLayout(attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
-  if (spTextLayout) {
-    winrt::check_hresult(spTextLayout->GetMetrics(&metrics));
-  } else {
-    return;
-  }
-
-  // Loop until the font size is reduced to the minimum or the layout fits
-  while ((currentFontSize > minimumFontSize) &&
-         ((paragraphAttributes.maximumNumberOfLines != 0 &&
-           paragraphAttributes.maximumNumberOfLines < static_cast<int>(metrics.lineCount)) ||
-          metrics.height > metrics.layoutHeight || metrics.width > metrics.layoutWidth)) {
-    // Reduce the font size by 1 point (or a configurable factor)
-    currentFontSize = std::max(currentFontSize - fontReduceFactor, minimumFontSize);
+  auto fontSizeAtStep = [&](int step) noexcept {
+    return std::max(initialFontSize - step * fontReduceFactor, minimumFontSize);
+  };
+
+  auto layoutAtFontSize = [&](float fontSize,
+                              winrt::com_ptr<IDWriteTextLayout> &layout,
+                              TextMeasurement::Attachments &layoutAttachments) {
+    layout = nullptr;
+    layoutAttachments.clear();
+    if (fontSize == initialFontSize) {
+      GetTextLayout(attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, layout, layoutAttachments);
+      return;
+    }
 
     // Adjust font size for all fragments proportionally
+    AttributedString attributedStringToResize = attributedString;
     attributedStringToResize.getFragments().clear();
-    for (auto fragment : fragmentsCopyToResize) {
+    for (auto fragment : fragments) {
       fragment.textAttributes.fontSize =
-          std::max(fragment.textAttributes.fontSize * (currentFontSize / initialFontSize), minimumFontSize);
+          std::max(fragment.textAttributes.fontSize * (fontSize / initialFontSize), minimumFontSize);
       attributedStringToResize.appendFragment(std::move(fragment));
     }
+    GetTextLayout(
+        AttributedStringBox(attributedStringToResize),
+        paragraphAttributes,
+        layoutConstraints.maximumSize,
+        layout,
+        layoutAttachments);
+  };
+
+  auto fits = [&](const DWRITE_TEXT_METRICS &metrics) noexcept {
+    return !(
+        (paragraphAttributes.maximumNumberOfLines != 0 &&
+         paragraphAttributes.maximumNumberOfLines < static_cast<int>(metrics.lineCount)) ||
+        metrics.height > metrics.layoutHeight || metrics.width > metrics.layoutWidth);
+  };
+
+  static SimpleThreadSafeCache<FittedFontSizeKey, float, kFittedFontSizeCacheSize> s_fittedFontSizes;
+  FittedFontSizeKey fittedFontSizeKey{attributedString, paragraphAttributes, layoutConstraints.maximumSize};
+  if (auto fittedFontSize = s_fittedFontSizes.get(fittedFontSizeKey)) {
+    layoutAtFontSize(*fittedFontSize, spTextLayout, attachments);
+    return;
+  }
 
-    attributedStringBox = facebook::react::AttributedStringBox(attributedStringToResize);
+  // Initial measurement
+  DWRITE_TEXT_METRICS metrics;
+  layoutAtFontSize(initialFontSize, spTextLayout, attachments);
+  if (!spTextLayout) {
+    return;
+  }
+  winrt::check_hresult(spTextLayout->GetMetrics(&metrics));
 
-    // Re-measure the text layout
-    GetTextLayout(attributedStringBox, paragraphAttributes, layoutConstraints.maximumSize, spTextLayout, attachments);
-    if (spTextLayout) {
-      winrt::check_hresult(spTextLayout->GetMetrics(&metrics));
-    } else {
-      return;
+  float fittedFontSize = initialFontSize;
+  if (initialFontSize > minimumFontSize && !fits(metrics)) {
+    // Steps in (notFittingStep, candidateStep] contain the answer, which is the smallest step that fits, or the last
+    // step (the minimum font size) if none does
+    int notFittingStep = 0;
+    int candidateStep = static_cast<int>(std::ceil((initialFontSize - minimumFontSize) / fontReduceFactor));
+    winrt::com_ptr<IDWriteTextLayout> spCandidateTextLayout;
+    TextMeasurement::Attachments candidateAttachments;
+
+    // Text shrinks about linearly with the font size along a line, and the number of lines shrinks with it as well,
+    // so the overflow ratio gives a good first probe
+    float scale = 1.0f;
+    if (metrics.width > metrics.layoutWidth && metrics.width > 0) {
+      scale = std::min(scale, metrics.layoutWidth / metrics.width);
+    }
+    if (metrics.height > metrics.layoutHeight && metrics.height > 0) {
+      scale = std::min(scale, std::sqrt(metrics.layoutHeight / metrics.height));
     }
+    if (paragraphAttributes.maximumNumberOfLines != 0 &&
+        paragraphAttributes.maximumNumberOfLines < static_cast<int>(metrics.lineCount)) {
+      scale = std::min(scale, static_cast<float>(paragraphAttributes.maximumNumberOfLines) / metrics.lineCount);
+    }
+    int probeStep = std::clamp(
+        static_cast<int>(std::ceil(initialFontSize * (1.0f - scale) / fontReduceFactor)),
+        notFittingStep + 1,
+        candidateStep);
+
+    while (true) {
+      winrt::com_ptr<IDWriteTextLayout> spProbeTextLayout;
+      TextMeasurement::Attachments probeAttachments;
+      layoutAtFontSize(fontSizeAtStep(probeStep), spProbeTextLayout, probeAttachments);
+      if (!spProbeTextLayout) {
+        spTextLayout = nullptr;
+        return;
+      }
+      winrt::check_hresult(spProbeTextLayout->GetMetrics(&metrics));
+
+      if (fits(metrics)) {
+        candidateStep = probeStep;
+        spCandidateTextLayout = std::move(spProbeTextLayout);
+        candidateAttachments = std::move(probeAttachments);
+      } else {
+        notFittingStep = probeStep;
+        if (probeStep == candidateStep) {
+          // Nothing fits, so the text uses the minimum font size
+          spCandidateTextLayout = std::move(spProbeTextLayout);
+          candidateAttachments = std::move(probeAttachments);
+          break;
+        }
+      }
+
+      if (candidateStep - notFittingStep <= 1) {
+        break;
+      }
+      probeStep = notFittingStep + (candidateStep - notFittingStep) / 2;
+    }
+
+    if (!spCandidateTextLayout) {
+      layoutAtFontSize(fontSizeAtStep(candidateStep), spCandidateTextLayout, candidateAttachments);
+    }
+    fittedFontSize = fontSizeAtStep(candidateStep);
+    spTextLayout = std::move(spCandidateTextLayout);
+    attachments = std::move(candidateAttachments);
   }
+
+  s_fittedFontSizes.get(fittedFontSizeKey, [fittedFontSize]() { return fittedFontSize; });
 }
 
 // measure entire text (inluding attachments)
@@ -431,6 +699,13 @@ TextMeasurement TextLayoutManager::measure(
       winrt::check_hresult(spTextLayout->GetMetrics(&dtm));
       measurement.size = {dtm.width, std::min(dtm.height, maxHeight)};
       measurement.attachments = attachments;
+
+      // The sizes of attachments depend on the layout box, and fitting the font size depends on the constraints, so
+      // those layouts cannot be reused for a different box
+      if (attachments.empty() && !paragraphAttributes.adjustsFontSizeToFit) {
+        WindowsTextLayoutManager::CacheMeasuredTextLayout(
+            attributedString, paragraphAttributes, std::move(spTextLayout));
+      }
     }
 
     if (telemetry) {
@@ -461,21 +736,39 @@ Microsoft::ReactNative::TextTransform ConvertTextTransform(std::optional<TextTra
   return Microsoft::ReactNative::TextTransform::Undefined;
 }
 
-winrt::hstring WindowsTextLayoutManager::GetTransformedText(const AttributedStringBox &attributedStringBox) {
-  winrt::hstring result{};
-  const auto &attributedString = attributedStringBox.getValue();
+std::optional<size_t> WindowsTextLayoutManager::TransformedText::fragmentAtPosition(uint32_t position) const noexcept {
+  if (fragmentOffsets.empty() || position >= fragmentOffsets.back()) {
+    return std::nullopt;
+  }
+  // The first offset past the position is the end of its fragment, which skips over empty fragments
+  auto end = std::upper_bound(fragmentOffsets.begin(), fragmentOffsets.end(), position);
+  return static_cast<size_t>(end - fragmentOffsets.begin()) - 1;
+}
 
-  for (const auto &fragment : attributedString.getFragments()) {
-    if (fragment.isAttachment()) {
-      result = result + L"\uFFFC"; // Unicode Object Replacement Character, will be replaced with an inline object
-    } else {
-      result = result +
-          Microsoft::ReactNative::TransformableText::TransformText(
-                   winrt::hstring{Microsoft::Common::Unicode::Utf8ToUtf16(fragment.string)},
-                   ConvertTextTransform(fragment.textAttributes.textTransform));
+std::shared_ptr<const WindowsTextLayoutManager::TransformedText> WindowsTextLayoutManager::GetTransformedText(
+    const AttributedString &attributedString) {
+  constexpr auto kTransformedTextCacheSize = 256;
+  static SimpleThreadSafeCache<AttributedString, std::shared_ptr<const TransformedText>, kTransformedTextCacheSize>
+      s_transformedTexts;
+
+  return s_transformedTexts.get(attributedString, [&attributedString]() {
+    auto result = std::make_shared<TransformedText>();
+    const auto &fragments = attributedString.getFragments();
+    result->fragmentOffsets.reserve(fragments.size() + 1);
+
+    for (const auto &fragment : fragments) {
+      result->fragmentOffsets.push_back(static_cast<uint32_t>(result->text.size()));
+      if (fragment.isAttachment()) {
+        result->text += L'\uFFFC'; // Unicode Object Replacement Character, will be replaced with an inline object
+      } else {
+        result->text += Microsoft::ReactNative::TransformableText::TransformText(
+            winrt::hstring{Microsoft::Common::Unicode::Utf8ToUtf16(fragment.string)},
+            ConvertTextTransform(fragment.textAttributes.textTransform));
+      }
     }
-  }
-  return result;
+    result->fragmentOffsets.push_back(static_cast<uint32_t>(result->text.size()));
+    return std::shared_ptr<const TransformedText>{std::move(result)};
+  });
 }
 
 } // namespace facebook::react
@@ -15,6 +15,9 @@
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <react/utils/ContextContainer.h>
 #include <memory>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace facebook::react {
 
@@ -56,7 +59,37 @@ class WindowsTextLayoutManager : public TextLayoutManager {
       TextMeasurement::Attachments &attachments,
       float minimumFontScale) noexcept;
 
-  static winrt::hstring GetTransformedText(const AttributedStringBox &attributedStringBox);
+  // The text of an attributed string as it is laid out, with the text transforms applied and each attachment replaced
+  // by an object replacement character
+  struct TransformedText {
+    std::wstring text;
+    // The UTF-16 position in text of each fragment, followed by the length of text
+    std::vector<uint32_t> fragmentOffsets;
+
+    // Returns the index of the fragment at the position, or std::nullopt if it is past the end of the text
+    std::optional<size_t> fragmentAtPosition(uint32_t position) const noexcept;
+  };
+
+  // The result is cached, so hit testing and laying out the same text share a single conversion
+  static std::shared_ptr<const TransformedText> GetTransformedText(const AttributedString &attributedString);
+  static std::shared_ptr<const TransformedText> GetTransformedText(const AttributedStringBox &attributedStringBox) {
+    return GetTransformedText(attributedStringBox.getValue());
+  }
+
+  // Keeps a layout created while measuring, so that painting the same text can take it instead of laying it out again
+  static void CacheMeasuredTextLayout(
+      const AttributedString &attributedString,
+      const ParagraphAttributes &paragraphAttributes,
+      winrt::com_ptr<IDWriteTextLayout> &&spTextLayout) noexcept;
+
+  // Removes the layout from the cache, so the caller is free to modify it
+  static winrt::com_ptr<IDWriteTextLayout> TakeMeasuredTextLayout(
+      const AttributedString &attributedString,
+      const ParagraphAttributes &paragraphAttributes) noexcept;
+
+  // For the memory report, and to release the layouts on memory pressure
+  static size_t MeasuredTextLayoutCount() noexcept;
+  static void ClearMeasuredTextLayouts() noexcept;
 
  private:
   static void GetTextLayout(
@@ -28,6 +28,9 @@ class MessageQueueThreadImpl : public MessageQueueThread {
  public:
   MessageQueueThreadImpl() noexcept = default;
   explicit MessageQueueThreadImpl(int priorityOffset) noexcept : taskDispatchThread_("MessageQueue", priorityOffset) {}
+  // [Windows] Records the wait and run times of the queued jobs
+  explicit MessageQueueThreadImpl(std::shared_ptr<Mso::DispatchQueueMetrics> metrics) noexcept
+      : taskDispatchThread_("", 0, std::move(metrics)) {}
 
   ~MessageQueueThreadImpl() noexcept override = default;
 
@@ -10,6 +10,8 @@
 
 #include "TaskDispatchThread.h"
 
+#include <dispatchQueue/dispatchQueueMetrics.h>
+
 #include <folly/portability/SysResource.h>
 #include <folly/system/ThreadName.h>
 #include <condition_variable>
@@ -30,7 +32,7 @@ namespace facebook::react {
 
 class TaskDispatchThread::Impl : public std::enable_shared_from_this<TaskDispatchThread::Impl> {
  public:
-  Impl(std::string &&threadName) noexcept;
+  Impl(std::string &&threadName, std::shared_ptr<Mso::DispatchQueueMetrics> &&metrics) noexcept;
   ~Impl() noexcept;
 
   void start() noexcept;
@@ -45,8 +47,13 @@ class TaskDispatchThread::Impl : public std::enable_shared_from_this<TaskDispatc
   struct Task {
     TimePoint dispatchTime;
     TaskFn fn;
+    // [Windows] The time at which the task is due, which its wait time is measured from
+    std::chrono::steady_clock::time_point dueTime;
+    // [Windows] The origin of the thread that posted the task, when the metrics are recorded
+    std::string origin;
 
-    Task(TimePoint dispatchTime, TaskFn &&fn) : dispatchTime(dispatchTime), fn(std::move(fn)) {}
+    Task(TimePoint dispatchTime, TaskFn &&fn, std::chrono::steady_clock::time_point dueTime, std::string origin)
+        : dispatchTime(dispatchTime), fn(std::move(fn)), dueTime(dueTime), origin(std::move(origin)) {}
 
     bool operator<(const Task &other) const {
       // Have the earliest tasks be at the front of the queue.
@@ -59,11 +66,15 @@ class TaskDispatchThread::Impl : public std::enable_shared_from_this<TaskDispatc
   std::priority_queue<Task> queue_;
   std::atomic<bool> running_{true};
   std::string threadName_;
+  const std::shared_ptr<Mso::DispatchQueueMetrics> metrics_; // [Windows]
   std::thread thread_;
 };
 
-TaskDispatchThread::TaskDispatchThread(std::string threadName, int /*priorityOffset*/) noexcept
-    : impl_(std::make_shared<Impl>(std::move(threadName))) {
+TaskDispatchThread::TaskDispatchThread(
+    std::string threadName,
+    int /*priorityOffset*/,
+    std::shared_ptr<Mso::DispatchQueueMetrics> metrics) noexcept
+    : impl_(std::make_shared<Impl>(std::move(threadName), std::move(metrics))) {
   impl_->start();
 }
 
@@ -91,7 +102,10 @@ void TaskDispatchThread::quit() noexcept {
   impl_->quit();
 }
 
-TaskDispatchThread::Impl::Impl(std::string &&threadName) noexcept : threadName_(std::move(threadName)) {}
+TaskDispatchThread::Impl::Impl(
+    std::string &&threadName,
+    std::shared_ptr<Mso::DispatchQueueMetrics> &&metrics) noexcept
+    : threadName_(std::move(threadName)), metrics_(std::move(metrics)) {}
 
 TaskDispatchThread::Impl::~Impl() noexcept {
   quit();
@@ -113,9 +127,14 @@ void TaskDispatchThread::Impl::runAsync(TaskFn &&task, std::chrono::milliseconds
   if (!running_) {
     return;
   }
+  std::string origin;
+  if (metrics_) {
+    metrics_->TaskPosted();
+    origin = Mso::DispatchQueueMetrics::CurrentOrigin();
+  }
   std::lock_guard<std::mutex> guard(queueLock_);
   auto dispatchTime = std::chrono::system_clock::now() + delayMs;
-  queue_.emplace(dispatchTime, std::move(task));
+  queue_.emplace(dispatchTime, std::move(task), std::chrono::steady_clock::now() + delayMs, std::move(origin));
   loopCv_.notify_one();
 }
 
@@ -162,13 +181,21 @@ void TaskDispatchThread::Impl::loop() noexcept {
           // Shutting down, skip all the delayed tasks that are not to be
           // executed yet
           queue_.pop();
+          if (metrics_) {
+            metrics_->TaskCanceled();
+          }
         }
         continue;
       }
 
       queue_.pop();
       lock.unlock();
-      task.fn();
+      if (metrics_) {
+        Mso::DispatchQueueMetrics::TaskScope scope{metrics_.get(), task.dueTime, std::move(task.origin)};
+        task.fn();
+      } else {
+        task.fn();
+      }
       lock.lock();
     }
   }
@@ -14,6 +14,10 @@
 #include <functional>
 #include <memory>
 
+namespace Mso {
+struct DispatchQueueMetrics;
+} // namespace Mso
+
 namespace facebook::react {
 
 /**
@@ -25,7 +29,11 @@ class TaskDispatchThread {
   using TaskFn = std::function<void()>;
   using TimePoint = std::chrono::time_point<std::chrono::system_clock>;
 
-  TaskDispatchThread(std::string threadName = "", int priorityOffset = 0) noexcept;
+  // [Windows] The optional metrics record the wait and run times of the tasks
+  TaskDispatchThread(
+      std::string threadName = "",
+      int priorityOffset = 0,
+      std::shared_ptr<Mso::DispatchQueueMetrics> metrics = nullptr) noexcept;
 
   ~TaskDispatchThread() noexcept;
 
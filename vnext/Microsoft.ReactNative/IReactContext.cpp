@@ -5,7 +5,10 @@
 #include "IReactContext.h"
 #include "DynamicWriter.h"
 
+#include <future/futureWinRT.h>
 #include "CallInvoker.h"
+#include "Hermes/HermesProductionProfiler.h"
+#include "NativeModuleProfiler.h"
 #include "Utils/Helpers.h"
 
 namespace winrt::Microsoft::ReactNative::implementation {
@@ -155,8 +158,191 @@ void ReactContext::EmitJSEvent(
   m_context->CallJSFunction(to_string(eventEmitterName), "emit", std::move(params));
 }
 
+void ReactContext::WriteDispatchQueueMetrics(IJSValueWriter const &writer) noexcept {
+  auto toMs = [](Mso::DispatchQueueMetrics::Clock::duration time) noexcept {
+    return std::chrono::duration<double, std::milli>(time).count();
+  };
+  auto writeHistogram = [&writer](const Mso::DispatchQueueMetrics::Histogram &histogram) noexcept {
+    writer.WriteArrayBegin();
+    for (auto count : histogram) {
+      writer.WriteInt64(static_cast<int64_t>(count));
+    }
+    writer.WriteArrayEnd();
+  };
+
+  writer.WriteArrayBegin();
+  if (auto metricsList = ReactPropertyBag(Properties()).Get(DispatchQueueMetricsProperty())) {
+    for (const auto &metrics : *metricsList) {
+      auto snapshot = metrics->GetSnapshot();
+      writer.WriteObjectBegin();
+      writer.WritePropertyName(L"queueName");
+      writer.WriteString(winrt::to_hstring(snapshot.QueueName));
+      writer.WritePropertyName(L"taskCount");
+      writer.WriteInt64(static_cast<int64_t>(snapshot.TaskCount));
+      writer.WritePropertyName(L"queueDepth");
+      writer.WriteInt64(static_cast<int64_t>(snapshot.QueueDepth));
+      writer.WritePropertyName(L"maxQueueDepth");
+      writer.WriteInt64(static_cast<int64_t>(snapshot.MaxQueueDepth));
+      writer.WritePropertyName(L"totalWaitTimeMs");
+      writer.WriteDouble(toMs(snapshot.TotalWaitTime));
+      writer.WritePropertyName(L"maxWaitTimeMs");
+      writer.WriteDouble(toMs(snapshot.MaxWaitTime));
+      writer.WritePropertyName(L"totalRunTimeMs");
+      writer.WriteDouble(toMs(snapshot.TotalRunTime));
+      writer.WritePropertyName(L"maxRunTimeMs");
+      writer.WriteDouble(toMs(snapshot.MaxRunTime));
+
+      writer.WritePropertyName(L"histogramBoundsMs");
+      writer.WriteArrayBegin();
+      for (auto bound : Mso::DispatchQueueMetrics::HistogramBounds) {
+        writer.WriteDouble(toMs(bound));
+      }
+      writer.WriteArrayEnd();
+      writer.WritePropertyName(L"waitTimeHistogram");
+      writeHistogram(snapshot.WaitTimeHistogram);
+      writer.WritePropertyName(L"runTimeHistogram");
+      writeHistogram(snapshot.RunTimeHistogram);
+
+      writer.WritePropertyName(L"topTasks");
+      writer.WriteArrayBegin();
+      for (const auto &task : snapshot.TopTasks) {
+        writer.WriteObjectBegin();
+        writer.WritePropertyName(L"name");
+        writer.WriteString(winrt::to_hstring(task.Name));
+        writer.WritePropertyName(L"count");
+        writer.WriteInt64(static_cast<int64_t>(task.Count));
+        writer.WritePropertyName(L"totalRunTimeMs");
+        writer.WriteDouble(toMs(task.TotalRunTime));
+        writer.WritePropertyName(L"maxRunTimeMs");
+        writer.WriteDouble(toMs(task.MaxRunTime));
+        writer.WriteObjectEnd();
+      }
+      writer.WriteArrayEnd();
+      writer.WriteObjectEnd();
+    }
+  }
+  writer.WriteArrayEnd();
+}
+
+// Runs the profiler action, which calls back with its error or with nullptr when it is done
+template <class TAction>
+static winrt::Windows::Foundation::IAsyncAction RunProfilerAction(
+    IReactPropertyBag const &properties,
+    TAction &&action) noexcept {
+  Mso::Promise<void> promise;
+  if (auto profiler = ReactPropertyBag(properties).Get(ReactContext::HermesProductionProfilerProperty())) {
+    action(**profiler, [promise](std::exception_ptr error) noexcept {
+      if (error) {
+        promise.SetError(Mso::ExceptionErrorProvider().MakeErrorCode(std::move(error)));
+      } else {
+        promise.SetValue();
+      }
+    });
+  } else {
+    promise.SetError(Mso::ExceptionErrorProvider().MakeErrorCode(std::make_exception_ptr(std::logic_error(
+        "Production profiling is not enabled, or the React instance does not use the Hermes runtime."))));
+  }
+  return make<Mso::AsyncActionFutureAdapter>(promise.AsFuture());
+}
+
+void ReactContext::WriteNativeModuleProfile(IJSValueWriter const &writer) noexcept {
+  auto toMs = [](NativeModuleProfiler::Clock::duration time) noexcept {
+    return std::chrono::duration<double, std::milli>(time).count();
+  };
+
+  writer.WriteArrayBegin();
+  if (auto profiler = ReactPropertyBag(Properties()).Get(NativeModuleProfilerProperty())) {
+    for (const auto &stats : (*profiler)->GetSnapshot()) {
+      writer.WriteObjectBegin();
+      writer.WritePropertyName(L"moduleName");
+      writer.WriteString(winrt::to_hstring(stats.ModuleName));
+      writer.WritePropertyName(L"methodName");
+      writer.WriteString(winrt::to_hstring(stats.MethodName));
+      writer.WritePropertyName(L"callCount");
+      writer.WriteInt64(static_cast<int64_t>(stats.CallCount));
+      writer.WritePropertyName(L"resultCount");
+      writer.WriteInt64(static_cast<int64_t>(stats.ResultCount));
+      writer.WritePropertyName(L"argMarshalingTimeMs");
+      writer.WriteDouble(toMs(stats.ArgMarshalingTime));
+      writer.WritePropertyName(L"executionTimeMs");
+      writer.WriteDouble(toMs(stats.ExecutionTime));
+      writer.WritePropertyName(L"resultMarshalingTimeMs");
+      writer.WriteDouble(toMs(stats.ResultMarshalingTime));
+      writer.WritePropertyName(L"maxCallTimeMs");
+      writer.WriteDouble(toMs(stats.MaxCallTime));
+
+      writer.WritePropertyName(L"threads");
+      writer.WriteArrayBegin();
+      for (const auto &[threadId, callCount] : stats.ThreadCallCounts) {
+        writer.WriteObjectBegin();
+        writer.WritePropertyName(L"threadId");
+        writer.WriteInt64(threadId);
+        writer.WritePropertyName(L"callCount");
+        writer.WriteInt64(static_cast<int64_t>(callCount));
+        writer.WriteObjectEnd();
+      }
+      writer.WriteArrayEnd();
+      writer.WriteObjectEnd();
+    }
+  }
+  writer.WriteArrayEnd();
+}
+
+winrt::Windows::Foundation::IAsyncAction ReactContext::StartSamplingProfiler() noexcept {
+  return RunProfilerAction(Properties(), [](auto &profiler, auto &&callback) noexcept {
+    profiler.StartSamplingProfiler(std::move(callback));
+  });
+}
+
+winrt::Windows::Foundation::IAsyncAction ReactContext::StopSamplingProfiler(hstring const &filePath) noexcept {
+  return RunProfilerAction(Properties(), [&filePath](auto &profiler, auto &&callback) noexcept {
+    profiler.StopSamplingProfiler(std::wstring{filePath}, std::move(callback));
+  });
+}
+
+winrt::Windows::Foundation::IAsyncAction ReactContext::CaptureHeapSnapshot(hstring const &filePath) noexcept {
+  return RunProfilerAction(Properties(), [&filePath](auto &profiler, auto &&callback) noexcept {
+    profiler.CaptureHeapSnapshot(std::wstring{filePath}, std::move(callback));
+  });
+}
+
 Mso::React::IReactContext &ReactContext::GetInner() const noexcept {
   return *m_context;
 }
 
+/*static*/ ReactPropertyId<bool> ReactContext::DispatchQueueMetricsEnabledProperty() noexcept {
+  return {L"ReactNative.Threading", L"DispatchQueueMetricsEnabled"};
+}
+
+/*static*/ ReactPropertyId<ReactNonAbiValue<std::vector<std::shared_ptr<Mso::DispatchQueueMetrics>>>>
+ReactContext::DispatchQueueMetricsProperty() noexcept {
+  return {L"ReactNative.Threading", L"DispatchQueueMetrics"};
+}
+
+/*static*/ ReactPropertyId<uint32_t> ReactContext::LongTaskThresholdMsProperty() noexcept {
+  return {L"ReactNative.Threading", L"LongTaskThresholdMs"};
+}
+
+/*static*/ ReactPropertyId<bool> ReactContext::LongTaskJSStackSamplingEnabledProperty() noexcept {
+  return {L"ReactNative.Diagnostics", L"LongTaskJSStackSamplingEnabled"};
+}
+
+/*static*/ ReactPropertyId<bool> ReactContext::ProductionProfilingEnabledProperty() noexcept {
+  return {L"ReactNative.Diagnostics", L"ProductionProfilingEnabled"};
+}
+
+/*static*/ ReactPropertyId<ReactNonAbiValue<std::shared_ptr<::Microsoft::ReactNative::HermesProductionProfiler>>>
+ReactContext::HermesProductionProfilerProperty() noexcept {
+  return {L"ReactNative.Diagnostics", L"HermesProductionProfiler"};
+}
+
+/*static*/ ReactPropertyId<bool> ReactContext::NativeModuleProfilerEnabledProperty() noexcept {
+  return {L"ReactNative.Diagnostics", L"NativeModuleProfilerEnabled"};
+}
+
+/*static*/ ReactPropertyId<ReactNonAbiValue<std::shared_ptr<NativeModuleProfiler>>>
+ReactContext::NativeModuleProfilerProperty() noexcept {
+  return {L"ReactNative.Diagnostics", L"NativeModuleProfiler"};
+}
+
 } // namespace winrt::Microsoft::ReactNative::implementation
@@ -3,9 +3,19 @@
 
 #pragma once
 
+#include <dispatchQueue/dispatchQueueMetrics.h>
 #include "ReactHost/React.h"
+#include "ReactPropertyBag.h"
 #include "winrt/Microsoft.ReactNative.h"
 
+namespace Microsoft::ReactNative {
+class HermesProductionProfiler;
+} // namespace Microsoft::ReactNative
+
+namespace winrt::Microsoft::ReactNative {
+class NativeModuleProfiler;
+} // namespace winrt::Microsoft::ReactNative
+
 namespace winrt::Microsoft::ReactNative::implementation {
 
 struct ReactSettingsSnapshot : winrt::implements<ReactSettingsSnapshot, IReactSettingsSnapshot> {
@@ -54,12 +64,40 @@ struct ReactContext : winrt::implements<ReactContext, IReactContext> {
       hstring const &eventEmitterName,
       hstring const &eventName,
       JSValueArgWriter const &paramsArgWriter) noexcept;
+  void WriteDispatchQueueMetrics(IJSValueWriter const &writer) noexcept;
+  void WriteNativeModuleProfile(IJSValueWriter const &writer) noexcept;
+  winrt::Windows::Foundation::IAsyncAction StartSamplingProfiler() noexcept;
+  winrt::Windows::Foundation::IAsyncAction StopSamplingProfiler(hstring const &filePath) noexcept;
+  winrt::Windows::Foundation::IAsyncAction CaptureHeapSnapshot(hstring const &filePath) noexcept;
 
  public: // IReactContext
          // Not part of the public ABI interface
          // Internal accessor for within the Microsoft.ReactNative dll to allow calling into internal methods
   Mso::React::IReactContext &GetInner() const noexcept;
 
+  // Set to true in the instance settings properties to collect the metrics of the JS and UI queues
+  static ReactPropertyId<bool> DispatchQueueMetricsEnabledProperty() noexcept;
+  // The metrics of the queues of the instance, when they are enabled
+  static ReactPropertyId<ReactNonAbiValue<std::vector<std::shared_ptr<Mso::DispatchQueueMetrics>>>>
+  DispatchQueueMetricsProperty() noexcept;
+
+  // Set in the instance settings properties to report the tasks of the JS and UI queues that run longer, in ms
+  static ReactPropertyId<uint32_t> LongTaskThresholdMsProperty() noexcept;
+  // Set to true in the instance settings properties to sample the JS stacks of the long tasks of the JS queue
+  static ReactPropertyId<bool> LongTaskJSStackSamplingEnabledProperty() noexcept;
+
+  // Set to true in the instance settings properties to capture JS profiles and heap snapshots in release builds
+  static ReactPropertyId<bool> ProductionProfilingEnabledProperty() noexcept;
+  // The profiler of the Hermes runtime of the instance, when it is enabled
+  static ReactPropertyId<ReactNonAbiValue<std::shared_ptr<::Microsoft::ReactNative::HermesProductionProfiler>>>
+  HermesProductionProfilerProperty() noexcept;
+
+  // Set to true in the instance settings properties to profile the calls of the native module methods
+  static ReactPropertyId<bool> NativeModuleProfilerEnabledProperty() noexcept;
+  // The profiler of the native module methods of the instance, when it is enabled
+  static ReactPropertyId<ReactNonAbiValue<std::shared_ptr<NativeModuleProfiler>>>
+  NativeModuleProfilerProperty() noexcept;
+
  private:
   Mso::CntPtr<Mso::React::IReactContext> m_context;
   ReactNative::IReactSettingsSnapshot m_settings{nullptr};
@@ -12,6 +12,18 @@ using namespace Windows::Foundation;
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
+static_assert(
+    static_cast<int32_t>(ReactDispatcherPriority::Immediate) ==
+    static_cast<int32_t>(Mso::DispatchTaskPriority::Immediate));
+static_assert(
+    static_cast<int32_t>(ReactDispatcherPriority::UserBlocking) ==
+    static_cast<int32_t>(Mso::DispatchTaskPriority::UserBlocking));
+static_assert(
+    static_cast<int32_t>(ReactDispatcherPriority::Normal) == static_cast<int32_t>(Mso::DispatchTaskPriority::Normal));
+static_assert(
+    static_cast<int32_t>(ReactDispatcherPriority::Background) ==
+    static_cast<int32_t>(Mso::DispatchTaskPriority::Background));
+
 // Implements IDispatchQueue2 on top of a custom IReactDispatcher provided by the application
 struct WrappedReactDispatcher : public Mso::UnknownObject<Mso::React::IDispatchQueue2> {
   WrappedReactDispatcher(const winrt::Microsoft::ReactNative::IReactDispatcher &dispatcher) noexcept
@@ -21,6 +33,14 @@ struct WrappedReactDispatcher : public Mso::UnknownObject<Mso::React::IDispatchQ
     m_dispatcher.Post(task);
   }
 
+  void Post(Mso::DispatchTask &&task, Mso::DispatchTaskPriority priority) const noexcept override {
+    if (auto dispatcher2 = m_dispatcher.try_as<IReactDispatcher2>()) {
+      dispatcher2.PostWithPriority(task, static_cast<ReactDispatcherPriority>(priority));
+    } else {
+      m_dispatcher.Post(task);
+    }
+  }
+
   void InvokeElsePost(Mso::DispatchTask &&task) const noexcept override {
     if (m_dispatcher.HasThreadAccess()) {
       task();
@@ -56,10 +76,22 @@ void ReactDispatcher::Post(ReactDispatcherCallback const &callback) noexcept {
   return m_queue.Post([callback = CreateLoggingCallback(callback)]() noexcept { callback(); });
 }
 
+void ReactDispatcher::PostWithPriority(
+    ReactDispatcherCallback const &callback,
+    ReactDispatcherPriority priority) noexcept {
+  return m_queue.Post(
+      [callback = CreateLoggingCallback(callback)]() noexcept { callback(); },
+      static_cast<Mso::DispatchTaskPriority>(priority));
+}
+
 void ReactDispatcher::Post(Mso::DispatchTask &&task) const noexcept {
   m_queue.Post(std::move(task));
 }
 
+void ReactDispatcher::Post(Mso::DispatchTask &&task, Mso::DispatchTaskPriority priority) const noexcept {
+  m_queue.Post(std::move(task), priority);
+}
+
 void ReactDispatcher::InvokeElsePost(Mso::DispatchTask &&task) const noexcept {
   m_queue.InvokeElsePost(std::move(task));
 }
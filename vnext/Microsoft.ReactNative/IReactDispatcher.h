@@ -13,6 +13,9 @@ struct IDispatchQueue2 : ::IUnknown {
   //! Post the task to the end of the queue for asynchronous invocation.
   virtual void Post(Mso::DispatchTask &&task) const noexcept = 0;
 
+  //! Post the task to the end of the priority lane of the queue for asynchronous invocation.
+  virtual void Post(Mso::DispatchTask &&task, Mso::DispatchTaskPriority priority) const noexcept = 0;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   virtual void InvokeElsePost(Mso::DispatchTask &&task) const noexcept = 0;
@@ -22,12 +25,14 @@ struct IDispatchQueue2 : ::IUnknown {
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
-struct ReactDispatcher : implements<ReactDispatcher, IReactDispatcher, Mso::React::IDispatchQueue2> {
+struct ReactDispatcher
+    : implements<ReactDispatcher, IReactDispatcher, IReactDispatcher2, Mso::React::IDispatchQueue2> {
   ReactDispatcher() = default;
   ReactDispatcher(Mso::DispatchQueue &&queue) noexcept;
 
   bool HasThreadAccess() noexcept;
   void Post(ReactDispatcherCallback const &callback) noexcept;
+  void PostWithPriority(ReactDispatcherCallback const &callback, ReactDispatcherPriority priority) noexcept;
 
   static IReactDispatcher CreateSerialDispatcher() noexcept;
 
@@ -44,6 +49,7 @@ struct ReactDispatcher : implements<ReactDispatcher, IReactDispatcher, Mso::Reac
   static IReactPropertyName JSDispatcherIdleWaitCompletedEventName() noexcept;
 
   void Post(Mso::DispatchTask &&task) const noexcept;
+  void Post(Mso::DispatchTask &&task, Mso::DispatchTaskPriority priority) const noexcept;
   void InvokeElsePost(Mso::DispatchTask &&task) const noexcept;
 
  private:
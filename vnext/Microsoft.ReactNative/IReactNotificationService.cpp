@@ -232,6 +232,11 @@ void ReactNotificationService::ModifySubscriptions(
       continue;
     }
 
+    m_subscriptionCount.store(
+        m_subscriptionCount.load(std::memory_order_relaxed) - (snapshotPtr ? snapshotPtr->size() : 0) +
+            newSnapshot.size(),
+        std::memory_order_release);
+
     if (newSnapshot.empty()) {
       if (it != m_subscriptions.end()) {
         m_subscriptions.erase(it);
@@ -311,6 +316,7 @@ void ReactNotificationService::UnsubscribeAll() noexcept {
   {
     std::scoped_lock lock{*m_mutex};
     subscriptions = std::move(m_subscriptions);
+    m_subscriptionCount.store(0, std::memory_order_release);
   }
 
   // Unsubscribe outside of lock.
@@ -329,6 +335,11 @@ void ReactNotificationService::SendNotification(
     // Notification are always sent from the root notification service.
     m_parentNotificationService.SendNotification(notificationName, sender, data);
   } else {
+    if (m_subscriptionCount.load(std::memory_order_acquire) == 0) {
+      // Nobody listens: skip the lock and the lookup.
+      return;
+    }
+
     SubscriptionSnapshotPtr currentSnapshotPtr;
 
     {
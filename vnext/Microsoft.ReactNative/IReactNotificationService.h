@@ -62,6 +62,8 @@ struct ReactNotificationArgs : implements<ReactNotificationArgs, IReactNotificat
 // replace the old list. The copy/modify/replace is done in a cycle in case if other thread replaces
 // the list first. If it happens, then the copy/modify/replace is done with the new list.
 // When we send a notification we take the current list snapshot and send notifications outside of lock.
+// High-rate notifications, such as the JS dispatcher task events, are usually sent with no subscriptions at all.
+// The service keeps an atomic count of its subscriptions, so such notifications return without taking the lock.
 struct ReactNotificationService : implements<ReactNotificationService, IReactNotificationService> {
   ReactNotificationService();
   explicit ReactNotificationService(IReactNotificationService const parentNotificationService) noexcept;
@@ -105,6 +107,8 @@ struct ReactNotificationService : implements<ReactNotificationService, IReactNot
   const IReactNotificationService m_parentNotificationService;
   Mso::RefCountedPtr<std::mutex> m_mutex{Mso::Make_RefCounted<std::mutex>()};
   std::unordered_map<IReactPropertyName, SubscriptionSnapshotPtr> m_subscriptions;
+  // Total size of all snapshots in m_subscriptions. It is only modified under the m_mutex lock.
+  std::atomic<size_t> m_subscriptionCount{0};
 };
 
 struct ReactNotificationServiceHelper {
@@ -146,7 +146,7 @@ com_ptr<ReactPropertyName> ReactPropertyNamespace::GetLocalName(hstring const &l
 namespace winrt::Microsoft::ReactNative::implementation {
 
 IInspectable ReactPropertyBag::Get(IReactPropertyName const &propertyName) noexcept {
-  std::scoped_lock lock{m_mutex};
+  std::shared_lock lock{m_mutex};
   auto it = m_entries.find(propertyName);
   if (it != m_entries.end()) {
     return it->second;
@@ -194,7 +194,7 @@ IInspectable ReactPropertyBag::Set(IReactPropertyName const &propertyName, IInsp
 void ReactPropertyBag::CopyFrom(IReactPropertyBag const &other) noexcept {
   std::scoped_lock lock{m_mutex};
   auto otherImpl = winrt::get_self<ReactPropertyBag>(other);
-  std::scoped_lock otherLock{otherImpl->m_mutex};
+  std::shared_lock otherLock{otherImpl->m_mutex};
   for (auto const &entry : otherImpl->m_entries) {
     m_entries.emplace(entry);
   }
@@ -4,6 +4,8 @@
 #pragma once
 #include "ReactPropertyBagHelper.g.h"
 #include <winrt/Windows.Foundation.Collections.h>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
@@ -17,8 +19,17 @@ struct ReactPropertyBag : implements<ReactPropertyBag, IReactPropertyBag> {
   void CopyFrom(IReactPropertyBag const &) noexcept;
 
  private:
-  std::mutex m_mutex;
-  std::map<IReactPropertyName, IInspectable> m_entries;
+  // Property names are unique objects per namespace and local name, so they are hashed by identity
+  struct PropertyNameHash {
+    size_t operator()(IReactPropertyName const &name) const noexcept {
+      return std::hash<void *>{}(get_abi(name));
+    }
+  };
+
+  // Properties are read far more often than they are set, by framework code on every thread, so reads only take a
+  // shared lock and do not contend with each other
+  std::shared_mutex m_mutex;
+  std::unordered_map<IReactPropertyName, IInspectable, PropertyNameHash> m_entries;
 };
 
 struct ReactPropertyBagHelper {
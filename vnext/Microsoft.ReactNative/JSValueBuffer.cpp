@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSValueBuffer.h"
+#include <cstring>
+
+namespace winrt::Microsoft::ReactNative {
+
+//===========================================================================
+// JSValueBuffer implementation
+//===========================================================================
+
+JSValueBuffer::JSValueBuffer(uint8_t *data, uint32_t size, bool isBorrowed) noexcept
+    : m_data{data}, m_capacity{size}, m_length{size} {
+  if (!isBorrowed) {
+    m_bytes = std::make_unique<::Microsoft::JSI::ByteArrayBuffer>(size);
+    if (size > 0) {
+      memcpy(m_bytes->data(), data, size);
+    }
+    m_data = m_bytes->data();
+  }
+}
+
+uint32_t JSValueBuffer::Capacity() noexcept {
+  return m_capacity;
+}
+
+uint32_t JSValueBuffer::Length() noexcept {
+  return m_length;
+}
+
+void JSValueBuffer::Length(uint32_t value) {
+  if (value > m_capacity) {
+    throw hresult_invalid_argument();
+  }
+  m_length = value;
+}
+
+HRESULT __stdcall JSValueBuffer::Buffer(uint8_t **value) noexcept {
+  *value = m_data;
+  return S_OK;
+}
+
+} // namespace winrt::Microsoft::ReactNative
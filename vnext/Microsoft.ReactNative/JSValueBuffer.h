@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <JSI/ByteArrayBuffer.h>
+#include <robuffer.h>
+#include <winrt/Windows.Storage.Streams.h>
+
+namespace winrt::Microsoft::ReactNative {
+
+// IBuffer with the bytes of an ArrayBuffer that is read from JS.
+// It either has a copy of the bytes, or borrows the memory of the JS value without keeping the value alive.
+struct JSValueBuffer
+    : implements<JSValueBuffer, Windows::Storage::Streams::IBuffer, ::Windows::Storage::Streams::IBufferByteAccess> {
+  JSValueBuffer(uint8_t *data, uint32_t size, bool isBorrowed) noexcept;
+
+ public: // IBuffer
+  uint32_t Capacity() noexcept;
+  uint32_t Length() noexcept;
+  void Length(uint32_t value);
+
+ public: // IBufferByteAccess
+  HRESULT __stdcall Buffer(uint8_t **value) noexcept final;
+
+ private:
+  std::unique_ptr<::Microsoft::JSI::ByteArrayBuffer> m_bytes;
+  uint8_t *m_data{nullptr};
+  uint32_t m_capacity{0};
+  uint32_t m_length{0};
+};
+
+} // namespace winrt::Microsoft::ReactNative
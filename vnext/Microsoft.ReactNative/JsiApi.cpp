@@ -9,6 +9,7 @@
 #include <crash/verifyElseCrash.h>
 #include <winrt/Windows.Foundation.Collections.h>
 #include "HermesRuntimeHolder.h"
+#include "JSI/JsiAbiApi.h"
 #include "ReactHost/MsoUtils.h"
 
 namespace winrt::Microsoft::ReactNative::implementation {
@@ -279,6 +280,10 @@ struct RuntimeAccessor : facebook::jsi::Runtime {
 
   static std::shared_ptr<facebook::jsi::HostObject> MakeHostObject(
       Microsoft::ReactNative::IJsiHostObject const &hostObject) {
+    if (auto inProcHostObject = Microsoft::ReactNative::TryGetInProcHostObject(hostObject)) {
+      return std::make_shared<HostObjectWrapper>(hostObject, std::move(inProcHostObject));
+    }
+
     return std::make_shared<HostObjectWrapper>(hostObject);
   }
 
@@ -319,9 +324,18 @@ struct RuntimeAccessor : facebook::jsi::Runtime {
 HostObjectWrapper::HostObjectWrapper(Microsoft::ReactNative::IJsiHostObject const &hostObject) noexcept
     : m_hostObject{hostObject} {}
 
+HostObjectWrapper::HostObjectWrapper(
+    Microsoft::ReactNative::IJsiHostObject const &hostObject,
+    std::shared_ptr<facebook::jsi::HostObject> &&inProcHostObject) noexcept
+    : m_hostObject{hostObject}, m_inProcHostObject{std::move(inProcHostObject)} {}
+
 facebook::jsi::Value HostObjectWrapper::get(
     facebook::jsi::Runtime &runtime,
     facebook::jsi::PropNameID const &name) try {
+  if (m_inProcHostObject) {
+    return m_inProcHostObject->get(runtime, name);
+  }
+
   ReactNative::JsiRuntime jsiRuntime = JsiRuntime::FromRuntime(runtime);
   return RuntimeAccessor::ToValue(m_hostObject.GetProperty(jsiRuntime, PointerAccessor::ToJsiPropertyNameIdData(name)));
 } catch (hresult_error const &) {
@@ -333,6 +347,11 @@ void HostObjectWrapper::set(
     facebook::jsi::Runtime &runtime,
     facebook::jsi::PropNameID const &name,
     facebook::jsi::Value const &value) try {
+  if (m_inProcHostObject) {
+    m_inProcHostObject->set(runtime, name, value);
+    return;
+  }
+
   ReactNative::JsiRuntime jsiRuntime = JsiRuntime::FromRuntime(runtime);
   m_hostObject.SetProperty(
       jsiRuntime, PointerAccessor::ToJsiPropertyNameIdData(name), ValueAccessor::ToJsiValueData(value));
@@ -342,19 +361,19 @@ void HostObjectWrapper::set(
 }
 
 std::vector<facebook::jsi::PropNameID> HostObjectWrapper::getPropertyNames(facebook::jsi::Runtime &runtime) try {
+  if (m_inProcHostObject) {
+    return m_inProcHostObject->getPropertyNames(runtime);
+  }
+
   std::vector<facebook::jsi::PropNameID> result;
   ReactNative::JsiRuntime jsiRuntime = JsiRuntime::FromRuntime(runtime);
   auto names = m_hostObject.GetPropertyIds(jsiRuntime);
-  result.reserve(names.Size());
-  constexpr uint32_t bufferSize = 200;
-  JsiPropertyIdRef nameBuffer[bufferSize];
-  for (uint32_t startIndex = 0; startIndex < names.Size(); startIndex += bufferSize) {
-    names.GetMany(startIndex, nameBuffer);
-    size_t bufferLength = std::min(bufferSize, names.Size() - startIndex);
-    for (size_t i = 0; i < bufferLength; ++i) {
-      auto ptr = reinterpret_cast<RuntimeAccessor::PointerValue *>(nameBuffer[i].Data);
-      result.emplace_back(std::move(*reinterpret_cast<facebook::jsi::PropNameID *>(&ptr)));
-    }
+  std::vector<JsiPropertyIdRef> nameBuffer(names.Size());
+  names.GetMany(0, nameBuffer);
+  result.reserve(nameBuffer.size());
+  for (auto const &name : nameBuffer) {
+    auto ptr = reinterpret_cast<RuntimeAccessor::PointerValue *>(name.Data);
+    result.emplace_back(std::move(*reinterpret_cast<facebook::jsi::PropNameID *>(&ptr)));
   }
 
   return result;
@@ -758,7 +777,7 @@ JsiObjectRef JsiRuntime::CreateObjectWithHostObject(IJsiHostObject const &hostOb
 IJsiHostObject JsiRuntime::GetHostObject(JsiObjectRef obj) try {
   auto objPtr = RuntimeAccessor::AsPointerValue(obj);
   auto hostObject = m_runtimeAccessor->getHostObject(RuntimeAccessor::AsObject(&objPtr));
-  auto wrapper = std::static_pointer_cast<HostObjectWrapper>(hostObject);
+  auto wrapper = std::dynamic_pointer_cast<HostObjectWrapper>(hostObject);
   return wrapper ? wrapper->Get() : nullptr;
 } catch (JSI_SET_ERROR) {
   throw;
@@ -38,8 +38,13 @@ struct JsiError : JsiErrorT<JsiError> {
 };
 
 // Wraps up the IJsiHostObject
+// If the IJsiHostObject wraps a facebook::jsi::HostObject created in this binary, then the calls go to it directly
+// instead of going through the ABI.
 struct HostObjectWrapper final : facebook::jsi::HostObject {
   HostObjectWrapper(Microsoft::ReactNative::IJsiHostObject const &hostObject) noexcept;
+  HostObjectWrapper(
+      Microsoft::ReactNative::IJsiHostObject const &hostObject,
+      std::shared_ptr<facebook::jsi::HostObject> &&inProcHostObject) noexcept;
 
   facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &name) override;
   void set(facebook::jsi::Runtime &, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value) override;
@@ -51,6 +56,7 @@ struct HostObjectWrapper final : facebook::jsi::HostObject {
 
  private:
   Microsoft::ReactNative::IJsiHostObject m_hostObject;
+  std::shared_ptr<facebook::jsi::HostObject> m_inProcHostObject;
 };
 
 struct RuntimeAccessor;
@@ -6,6 +6,7 @@
 
 #include "pch.h"
 #include "JsiReader.h"
+#include "JSValueBuffer.h"
 #ifdef __APPLE__
 #include "Crash.h"
 #else
@@ -63,6 +64,10 @@ bool JsiReader::GetNextObjectProperty(hstring &propertyName) noexcept {
     return false;
   }
 
+  if (!top.PropertyNames) {
+    top.PropertyNames = ReadOptional(top.CurrentObject).getPropertyNames(m_runtime);
+  }
+
   top.Index++;
   if (top.Index < static_cast<int>(ReadOptional(top.PropertyNames).size(m_runtime))) {
     auto propertyId =
@@ -143,13 +148,124 @@ double JsiReader::GetDouble() noexcept {
   return ReadOptional(m_currentPrimitiveValue).getNumber();
 }
 
+bool JsiReader::TryGetDoubleArray(com_array<double> &values) noexcept {
+  auto array = TryGetUnreadArray();
+  if (!array) {
+    return false;
+  }
+
+  com_array<double> result(static_cast<uint32_t>(array->size(m_runtime)));
+  for (uint32_t i = 0; i < result.size(); ++i) {
+    auto item = array->getValueAtIndex(m_runtime, i);
+    if (!item.isNumber()) {
+      return false;
+    }
+    result[i] = item.getNumber();
+  }
+
+  values = std::move(result);
+  SkipContainer();
+  return true;
+}
+
+bool JsiReader::TryGetInt64Array(com_array<int64_t> &values) noexcept {
+  auto array = TryGetUnreadArray();
+  if (!array) {
+    return false;
+  }
+
+  com_array<int64_t> result(static_cast<uint32_t>(array->size(m_runtime)));
+  for (uint32_t i = 0; i < result.size(); ++i) {
+    auto item = array->getValueAtIndex(m_runtime, i);
+    // The same test for integers as in ValueType
+    if (!item.isNumber() || floor(item.getNumber()) != item.getNumber()) {
+      return false;
+    }
+    result[i] = static_cast<int64_t>(item.getNumber());
+  }
+
+  values = std::move(result);
+  SkipContainer();
+  return true;
+}
+
+com_array<uint8_t> JsiReader::GetUtf8String() noexcept {
+  if (ValueType() != JSValueType::String) {
+    return {};
+  }
+  auto value = ReadOptional(m_currentPrimitiveValue).getString(m_runtime).utf8(m_runtime);
+  auto data = reinterpret_cast<const uint8_t *>(value.data());
+  return com_array<uint8_t>(data, data + value.size());
+}
+
+facebook::jsi::Array *JsiReader::TryGetUnreadArray() noexcept {
+  if (m_currentPrimitiveValue || m_containers.empty()) {
+    return nullptr;
+  }
+
+  auto &top = m_containers[m_containers.size() - 1];
+  if (top.Type != ContainerType::Array || top.Index != -1) {
+    return nullptr;
+  }
+  return &ReadOptional(top.CurrentArray);
+}
+
+Windows::Storage::Streams::IBuffer JsiReader::TryGetArrayBuffer(bool isBorrowed) noexcept {
+  auto object = TryGetUnreadObject();
+  if (!object) {
+    return nullptr;
+  }
+
+  uint8_t *data{nullptr};
+  size_t size{0};
+  if (object->isArrayBuffer(m_runtime)) {
+    auto arrayBuffer = object->getArrayBuffer(m_runtime);
+    data = arrayBuffer.data(m_runtime);
+    size = arrayBuffer.size(m_runtime);
+  } else {
+    // JSI has no API for typed arrays and DataView: read the part of their ArrayBuffer they are about
+    auto isView = m_runtime.global()
+                      .getPropertyAsObject(m_runtime, "ArrayBuffer")
+                      .getPropertyAsFunction(m_runtime, "isView")
+                      .call(m_runtime, *object);
+    if (!isView.isBool() || !isView.getBool()) {
+      return nullptr;
+    }
+
+    auto arrayBuffer = object->getPropertyAsObject(m_runtime, "buffer").getArrayBuffer(m_runtime);
+    auto byteOffset = static_cast<size_t>(object->getProperty(m_runtime, "byteOffset").asNumber());
+    size = static_cast<size_t>(object->getProperty(m_runtime, "byteLength").asNumber());
+    data = arrayBuffer.data(m_runtime) + byteOffset;
+  }
+
+  SkipContainer();
+  return make<JSValueBuffer>(data, static_cast<uint32_t>(size), isBorrowed);
+}
+
+facebook::jsi::Object *JsiReader::TryGetUnreadObject() noexcept {
+  if (m_currentPrimitiveValue || m_containers.empty()) {
+    return nullptr;
+  }
+
+  auto &top = m_containers[m_containers.size() - 1];
+  if (top.Type != ContainerType::Object || top.Index != -1) {
+    return nullptr;
+  }
+  return &ReadOptional(top.CurrentObject);
+}
+
+void JsiReader::SkipContainer() noexcept {
+  m_containers.pop_back();
+  m_currentPrimitiveValue.reset();
+}
+
 void JsiReader::SetValue(const facebook::jsi::Value &value) noexcept {
   if (value.isObject()) {
     auto obj = value.getObject(m_runtime);
     if (obj.isArray(m_runtime)) {
       m_containers.push_back(obj.getArray(m_runtime));
     } else {
-      m_containers.push_back({m_runtime, std::move(obj)});
+      m_containers.push_back(std::move(obj));
     }
     m_currentPrimitiveValue = std::nullopt;
   } else if (value.isString() || value.isBool() || value.isNumber()) {
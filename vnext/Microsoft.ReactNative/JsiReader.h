@@ -20,7 +20,7 @@ decltype(auto) ReadOptional(std::optional<T> &opt) {
 }
 #endif
 
-struct JsiReader : implements<JsiReader, IJSValueReader> {
+struct JsiReader : implements<JsiReader, IJSValueReader, IJSValueReader2> {
   JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value &root) noexcept;
   JsiReader(facebook::jsi::Runtime &runtime, const facebook::jsi::Value *args, size_t count) noexcept;
 
@@ -33,6 +33,12 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
   int64_t GetInt64() noexcept;
   double GetDouble() noexcept;
 
+ public: // IJSValueReader2
+  bool TryGetDoubleArray(com_array<double> &values) noexcept;
+  bool TryGetInt64Array(com_array<int64_t> &values) noexcept;
+  com_array<uint8_t> GetUtf8String() noexcept;
+  Windows::Storage::Streams::IBuffer TryGetArrayBuffer(bool isBorrowed) noexcept;
+
  private:
   enum class ContainerType {
     Object,
@@ -43,16 +49,16 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
   struct Container {
     ContainerType Type;
     std::optional<facebook::jsi::Object> CurrentObject; // valid for ContainerType::Object
-    std::optional<facebook::jsi::Array> PropertyNames; // valid for ContainerType::Object
+    // valid for ContainerType::Object after the first GetNextObjectProperty, so that reading an ArrayBuffer or a
+    // typed array does not get the names of all its items
+    std::optional<facebook::jsi::Array> PropertyNames;
     std::optional<facebook::jsi::Array> CurrentArray; // valid for ContainerType::Array
     const facebook::jsi::Value *ArgElements = nullptr; // valid for ContainerType::Args
     size_t ArgLength = 0; // valid for ContainerType::Args
     int Index = -1;
 
-    Container(facebook::jsi::Runtime &runtime, facebook::jsi::Object &&value) noexcept
-        : Type(ContainerType::Object), CurrentObject(std::make_optional<facebook::jsi::Object>(std::move(value))) {
-      PropertyNames = ReadOptional(CurrentObject).getPropertyNames(runtime);
-    }
+    Container(facebook::jsi::Object &&value) noexcept
+        : Type(ContainerType::Object), CurrentObject(std::make_optional<facebook::jsi::Object>(std::move(value))) {}
 
     Container(facebook::jsi::Array &&value) noexcept
         : Type(ContainerType::Array), CurrentArray(std::make_optional<facebook::jsi::Array>(std::move(value))) {}
@@ -66,6 +72,12 @@ struct JsiReader : implements<JsiReader, IJSValueReader> {
 
  private:
   void SetValue(const facebook::jsi::Value &value) noexcept;
+  // Returns the current value when it is an array that is not read yet
+  facebook::jsi::Array *TryGetUnreadArray() noexcept;
+  // Returns the current value when it is an object that is not read yet
+  facebook::jsi::Object *TryGetUnreadObject() noexcept;
+  // Moves past the current array or object, as GetNextArrayItem or GetNextObjectProperty do after its last item
+  void SkipContainer() noexcept;
 
  private:
   facebook::jsi::Runtime &m_runtime;
@@ -6,6 +6,7 @@
 
 #include "pch.h"
 #include "JsiWriter.h"
+#include <winrt/Windows.Storage.Streams.h>
 #ifdef __APPLE__
 #include "Crash.h"
 #else
@@ -19,10 +20,41 @@ namespace winrt::Microsoft::ReactNative {
 // JsiWriter implementation
 //===========================================================================
 
+// Promises and callbacks of native modules write their results with a new JsiWriter each time. The writers on a JS
+// thread reuse the container stack and the array element vectors of the previous ones, so that writing results does
+// not allocate them in steady state. The scratch memory holds no JSI values, and it is bounded.
+struct JsiWriter::Scratch {
+  static constexpr size_t MaxArrayElementsCount = 16;
+  static constexpr size_t MaxArrayElementsCapacity = 1024;
+
+  std::vector<Container> Containers;
+  std::vector<std::vector<facebook::jsi::Value>> ArrayElements;
+};
+
+/*static*/ JsiWriter::Scratch &JsiWriter::GetScratch() noexcept {
+  thread_local Scratch scratch;
+  return scratch;
+}
+
 JsiWriter::JsiWriter(facebook::jsi::Runtime &runtime) noexcept : m_runtime(runtime) {
+  // Nested writers on the same thread get a new stack when the previous one is in use
+  std::swap(m_containers, GetScratch().Containers);
   Push({ContainerState::AcceptValueAndFinish});
 }
 
+JsiWriter::~JsiWriter() noexcept {
+  if (m_resultAsContainer) {
+    m_resultAsContainer->CurrentArrayElements.clear();
+    RecycleArrayElements(std::move(m_resultAsContainer->CurrentArrayElements));
+  }
+
+  m_containers.clear();
+  auto &scratch = GetScratch();
+  if (m_containers.capacity() > scratch.Containers.capacity()) {
+    std::swap(m_containers, scratch.Containers);
+  }
+}
+
 facebook::jsi::Value JsiWriter::MoveResult() noexcept {
   VerifyElseCrash(m_containers.size() == 0);
   if (m_resultAsContainer.has_value()) {
@@ -87,7 +119,7 @@ void JsiWriter::WriteObjectEnd() noexcept {
 void JsiWriter::WriteArrayBegin() noexcept {
   // legal to create an array only when it is accepting a value
   VerifyElseCrash(Top().State != ContainerState::AcceptPropertyName);
-  Push({ContainerState::AcceptArrayElement});
+  Push(MakeArrayContainer());
 }
 
 void JsiWriter::WriteArrayEnd() noexcept {
@@ -96,6 +128,70 @@ void JsiWriter::WriteArrayEnd() noexcept {
   WriteContainer(Pop());
 }
 
+void JsiWriter::WriteDoubleArray(array_view<double const> values) noexcept {
+  // legal to create an array only when it is accepting a value
+  VerifyElseCrash(Top().State != ContainerState::AcceptPropertyName);
+  Container container = MakeArrayContainer();
+  container.CurrentArrayElements.reserve(values.size());
+  for (double value : values) {
+    container.CurrentArrayElements.emplace_back(value);
+  }
+  WriteContainer(std::move(container));
+}
+
+void JsiWriter::WriteInt64Array(array_view<int64_t const> values) noexcept {
+  // legal to create an array only when it is accepting a value
+  VerifyElseCrash(Top().State != ContainerState::AcceptPropertyName);
+  Container container = MakeArrayContainer();
+  container.CurrentArrayElements.reserve(values.size());
+  for (int64_t value : values) {
+    container.CurrentArrayElements.emplace_back(static_cast<double>(value));
+  }
+  WriteContainer(std::move(container));
+}
+
+void JsiWriter::WriteUtf8String(array_view<uint8_t const> value) noexcept {
+  WriteValue({facebook::jsi::String::createFromUtf8(m_runtime, value.data(), value.size())});
+}
+
+void JsiWriter::WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept {
+  // The memory of the IBuffer is used by the ArrayBuffer while the JS value is alive
+  struct JSValueMutableBuffer final : facebook::jsi::MutableBuffer {
+    JSValueMutableBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept : m_buffer{buffer} {}
+
+    size_t size() const override {
+      return m_buffer.Length();
+    }
+
+    uint8_t *data() override {
+      return m_buffer.data();
+    }
+
+   private:
+    const Windows::Storage::Streams::IBuffer m_buffer;
+  };
+
+  WriteValue({facebook::jsi::ArrayBuffer(m_runtime, std::make_shared<JSValueMutableBuffer>(buffer))});
+}
+
+JsiWriter::Container JsiWriter::MakeArrayContainer() noexcept {
+  Container container{ContainerState::AcceptArrayElement};
+  auto &arrayElements = GetScratch().ArrayElements;
+  if (!arrayElements.empty()) {
+    container.CurrentArrayElements = std::move(arrayElements.back());
+    arrayElements.pop_back();
+  }
+  return container;
+}
+
+void JsiWriter::RecycleArrayElements(std::vector<facebook::jsi::Value> &&elements) noexcept {
+  auto &arrayElements = GetScratch().ArrayElements;
+  if (elements.empty() && elements.capacity() > 0 && elements.capacity() <= Scratch::MaxArrayElementsCapacity &&
+      arrayElements.size() < Scratch::MaxArrayElementsCount) {
+    arrayElements.push_back(std::move(elements));
+  }
+}
+
 facebook::jsi::Value JsiWriter::ContainerToValue(Container &&container) noexcept {
   switch (container.State) {
     case ContainerState::AcceptPropertyName: {
@@ -106,6 +202,8 @@ facebook::jsi::Value JsiWriter::ContainerToValue(Container &&container) noexcept
       for (size_t i = 0; i < container.CurrentArrayElements.size(); i++) {
         createdArray.setValueAtIndex(m_runtime, i, std::move(container.CurrentArrayElements.at(i)));
       }
+      container.CurrentArrayElements.clear();
+      RecycleArrayElements(std::move(container.CurrentArrayElements));
       return std::move(createdArray);
     }
     default:
@@ -11,8 +11,9 @@
 
 namespace winrt::Microsoft::ReactNative {
 
-struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
+struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter, IJSValueWriter2> {
   JsiWriter(facebook::jsi::Runtime &runtime) noexcept;
+  ~JsiWriter() noexcept;
 
   // MoveResult crashes when the root object is not closed.
   // MoveResult returns the constructed root object.
@@ -35,6 +36,12 @@ struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
   void WriteArrayBegin() noexcept;
   void WriteArrayEnd() noexcept;
 
+ public: // IJSValueWriter2
+  void WriteDoubleArray(array_view<double const> values) noexcept;
+  void WriteInt64Array(array_view<int64_t const> values) noexcept;
+  void WriteUtf8String(array_view<uint8_t const> value) noexcept;
+  void WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept;
+
  private:
   enum class ContainerState {
     AcceptValueAndFinish,
@@ -58,6 +65,12 @@ struct JsiWriter : winrt::implements<JsiWriter, IJSValueWriter> {
   };
 
  private:
+  // Memory of the previous writers on the thread that the next writers reuse
+  struct Scratch;
+  static Scratch &GetScratch() noexcept;
+
+  Container MakeArrayContainer() noexcept;
+  void RecycleArrayElements(std::vector<facebook::jsi::Value> &&elements) noexcept;
   facebook::jsi::Value ContainerToValue(Container &&container) noexcept;
   void WriteContainer(Container &&container) noexcept;
   void WriteValue(facebook::jsi::Value &&value) noexcept;
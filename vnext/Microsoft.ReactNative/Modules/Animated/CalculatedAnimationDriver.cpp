@@ -4,47 +4,189 @@
 #include "pch.h"
 
 #include <math.h>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 #include "CalculatedAnimationDriver.h"
 
 namespace Microsoft::ReactNative {
 
+namespace {
+
+// The key frames of a curve, with the normalized progress of each
+struct CalculatedKeyFrames {
+  std::chrono::milliseconds duration{0};
+  std::vector<std::pair<float, float>> keyFrames;
+};
+
+// Starting many animations of the same curve, like the same spring in every row of a list, computes its key frames
+// once.  A curve is only defined by the config of the animation and the value it starts from.
+class CalculatedKeyFramesCache {
+ public:
+  static CalculatedKeyFramesCache &Instance() noexcept {
+    // Intentionally leaked
+    static CalculatedKeyFramesCache *s_instance = new CalculatedKeyFramesCache();
+    return *s_instance;
+  }
+
+  std::shared_ptr<const CalculatedKeyFrames> find(const std::string &key) noexcept {
+    std::scoped_lock lock{m_mutex};
+    auto it = m_entries.find(key);
+    return it == m_entries.end() ? nullptr : it->second;
+  }
+
+  void insert(const std::string &key, std::shared_ptr<const CalculatedKeyFrames> keyFrames) noexcept {
+    std::scoped_lock lock{m_mutex};
+    if (m_entries.emplace(key, std::move(keyFrames)).second) {
+      m_order.push_back(key);
+      if (m_order.size() > s_maxEntries) {
+        m_entries.erase(m_order.front());
+        m_order.pop_front();
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t s_maxEntries = 64;
+
+  std::mutex m_mutex;
+  std::unordered_map<std::string, std::shared_ptr<const CalculatedKeyFrames>> m_entries;
+  std::deque<std::string> m_order;
+};
+
+void AppendCacheKey(std::string &key, const winrt::Microsoft::ReactNative::JSValue &value) noexcept {
+  switch (value.Type()) {
+    case winrt::Microsoft::ReactNative::JSValueType::Object:
+      key += '{';
+      for (const auto &[name, property] : value.AsObject()) {
+        key += name;
+        key += ':';
+        AppendCacheKey(key, property);
+        key += ',';
+      }
+      key += '}';
+      break;
+    case winrt::Microsoft::ReactNative::JSValueType::Array:
+      key += '[';
+      for (const auto &item : value.AsArray()) {
+        AppendCacheKey(key, item);
+        key += ',';
+      }
+      key += ']';
+      break;
+    case winrt::Microsoft::ReactNative::JSValueType::Double: {
+      // Exact, so that curves that only differ slightly are not shared
+      const auto number = value.AsDouble();
+      char bits[sizeof(number)];
+      memcpy(bits, &number, sizeof(number));
+      key.append(bits, sizeof(bits));
+      break;
+    }
+    default:
+      key += value.AsJSString();
+      break;
+  }
+}
+
+// Drops the samples of the curve that linear interpolation between the samples kept reproduces within the tolerance,
+// so flat parts of the curve get few key frames and sharply curved parts keep their samples
+std::vector<bool> SamplesToKeep(const std::vector<float> &samples, double tolerance) noexcept {
+  std::vector<bool> keep(samples.size(), false);
+  keep.front() = true;
+  keep.back() = true;
+
+  std::vector<std::pair<size_t, size_t>> spans{{0, samples.size() - 1}};
+  while (!spans.empty()) {
+    const auto [first, last] = spans.back();
+    spans.pop_back();
+
+    auto maxError = 0.0;
+    auto maxErrorIndex = first;
+    for (auto i = first + 1; i < last; i++) {
+      const auto interpolated = samples[first] +
+          (static_cast<double>(samples[last]) - samples[first]) * static_cast<double>(i - first) / (last - first);
+      const auto error = std::abs(samples[i] - interpolated);
+      if (error > maxError) {
+        maxError = error;
+        maxErrorIndex = i;
+      }
+    }
+
+    if (maxError > tolerance) {
+      keep[maxErrorIndex] = true;
+      spans.push_back({first, maxErrorIndex});
+      spans.push_back({maxErrorIndex, last});
+    }
+  }
+  return keep;
+}
+
+} // namespace
+
 std::tuple<comp::CompositionAnimation, comp::CompositionScopedBatch> CalculatedAnimationDriver::MakeAnimation(
     const winrt::Microsoft::ReactNative::JSValueObject & /*config*/) {
   assert(m_useComposition);
-  const auto [scopedBatch, animation, easingFunction] = [manager = m_manager.lock()]() {
-    const auto compositor = manager->Compositor();
-    return std::make_tuple(
-        compositor.CreateScopedBatch(comp::CompositionBatchTypes::AllAnimations),
-        compositor.CreateScalarKeyFrameAnimation(),
-        compositor.CreateLinearEasingFunction());
-  }();
+  const auto manager = m_manager.lock();
+  const auto compositor = manager->Compositor();
+  // Each start needs its own batch to complete when its animation does
+  const auto scopedBatch = compositor.CreateScopedBatch(comp::CompositionBatchTypes::AllAnimations);
 
   m_originalValue = GetAnimatedValue()->RawValue();
-  std::vector<float> keyFrames = [this]() {
-    std::vector<float> keyFrames;
+  const auto fromValue = static_cast<float>(m_originalValue.value());
+
+  std::string cacheKey;
+  AppendCacheKey(cacheKey, winrt::Microsoft::ReactNative::JSValue(m_config.Copy()));
+  AppendCacheKey(cacheKey, winrt::Microsoft::ReactNative::JSValue(static_cast<double>(fromValue)));
+
+  // The key frame animation of a curve, which also depends on the iterations, is shared by the starts of this
+  // manager's compositor
+  const auto animationCacheKey = cacheKey + std::to_string(m_iterations);
+  if (const auto cachedAnimation = manager->FindKeyFrameAnimation(animationCacheKey)) {
+    return std::make_tuple(cachedAnimation, scopedBatch);
+  }
+  const auto animation = compositor.CreateScalarKeyFrameAnimation();
+  const auto easingFunction = compositor.CreateLinearEasingFunction();
+
+  auto calculatedKeyFrames = CalculatedKeyFramesCache::Instance().find(cacheKey);
+  if (!calculatedKeyFrames) {
+    // The curve is sampled every frame until it is done, starting with the value it starts from
+    std::vector<float> samples{fromValue};
     bool done = false;
     double time = 0;
     std::optional<double> previousValue = std::nullopt;
     while (!done) {
       time += 1.0f / 60.0f;
       auto [currentValue, currentVelocity] = GetValueAndVelocityForTime(time);
-      keyFrames.push_back(currentValue);
+      samples.push_back(currentValue);
       if (IsAnimationDone(currentValue, previousValue, currentVelocity)) {
         done = true;
       }
       previousValue = currentValue;
     }
-    return keyFrames;
-  }();
 
-  std::chrono::milliseconds duration(static_cast<int>(keyFrames.size() / 60.0f * 1000.0f));
-  animation.Duration(duration);
-  auto normalizedProgress = 0.0f;
-  auto fromValue = static_cast<float>(m_originalValue.value());
-  animation.InsertKeyFrame(normalizedProgress, fromValue, easingFunction);
-  for (const auto keyFrame : keyFrames) {
-    normalizedProgress = std::min(normalizedProgress + 1.0f / keyFrames.size(), 1.0f);
-    animation.InsertKeyFrame(normalizedProgress, keyFrame, easingFunction);
+    // The key frames only need to be as precise as the curve is large, a fraction of a pixel for a translation
+    auto extent = 0.0;
+    for (const auto sample : samples) {
+      extent = std::max(extent, std::abs(static_cast<double>(sample) - fromValue));
+    }
+    const auto keep = SamplesToKeep(samples, std::max(extent, 1.0) * s_keyFrameTolerance);
+
+    auto keyFrames = std::make_shared<CalculatedKeyFrames>();
+    const auto frameCount = samples.size() - 1;
+    keyFrames->duration = std::chrono::milliseconds(static_cast<int>(frameCount / 60.0f * 1000.0f));
+    for (size_t i = 0; i < samples.size(); i++) {
+      if (keep[i]) {
+        keyFrames->keyFrames.push_back({std::min(static_cast<float>(i) / frameCount, 1.0f), samples[i]});
+      }
+    }
+
+    CalculatedKeyFramesCache::Instance().insert(cacheKey, keyFrames);
+    calculatedKeyFrames = std::move(keyFrames);
+  }
+
+  animation.Duration(calculatedKeyFrames->duration);
+  for (const auto &[normalizedProgress, value] : calculatedKeyFrames->keyFrames) {
+    animation.InsertKeyFrame(normalizedProgress, value, easingFunction);
   }
 
   if (m_iterations == -1) {
@@ -54,6 +196,7 @@ std::tuple<comp::CompositionAnimation, comp::CompositionScopedBatch> CalculatedA
     animation.IterationBehavior(winrt::AnimationIterationBehavior::Count);
   }
 
+  manager->CacheKeyFrameAnimation(animationCacheKey, animation);
   return std::make_tuple(animation, scopedBatch);
 }
 
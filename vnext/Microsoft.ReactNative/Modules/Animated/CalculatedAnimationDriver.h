@@ -18,5 +18,8 @@ class CalculatedAnimationDriver : public AnimationDriver {
  protected:
   virtual std::tuple<float, double> GetValueAndVelocityForTime(double time) = 0;
   virtual bool IsAnimationDone(double currentValue, std::optional<double> previousValue, double currentVelocity) = 0;
+
+  // Largest error of the key frames, relative to how far the curve moves from its start
+  static constexpr double s_keyFrameTolerance = 0.0005;
 };
 } // namespace Microsoft::ReactNative
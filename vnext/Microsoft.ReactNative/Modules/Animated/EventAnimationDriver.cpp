@@ -6,6 +6,9 @@
 #include "EventAnimationDriver.h"
 #include "NativeAnimatedNodeManager.h"
 
+#include <Fabric/Composition/ScrollViewComponentView.h>
+#include <Fabric/FabricUIManagerModule.h>
+
 namespace Microsoft::ReactNative {
 EventAnimationDriver::EventAnimationDriver(
     const std::vector<std::string> &eventPath,
@@ -17,6 +20,14 @@ EventAnimationDriver::EventAnimationDriver(
   }
 }
 
+EventAnimationDriver::~EventAnimationDriver() {
+  if (m_compositionAnimation) {
+    if (const auto value = AnimatedValue()) {
+      value->PropertySet().StopAnimation(ValueAnimatedNode::s_valueName);
+    }
+  }
+}
+
 ValueAnimatedNode *EventAnimationDriver::AnimatedValue() {
   if (const auto manager = m_manager.lock()) {
     return manager->GetValueAnimatedNode(m_animatedValueTag);
@@ -24,4 +35,49 @@ ValueAnimatedNode *EventAnimationDriver::AnimatedValue() {
   return static_cast<ValueAnimatedNode *>(nullptr);
 }
 
+EventAnimationDriver::CompositionAnimationResult EventAnimationDriver::StartCompositionAnimation(
+    int64_t viewTag,
+    const std::string &eventName) {
+  if (eventName != "onScroll" && eventName != "topScroll") {
+    return CompositionAnimationResult::Unsupported;
+  }
+  if (m_eventPath.size() != 2 || m_eventPath[0] != "contentOffset" ||
+      (m_eventPath[1] != "x" && m_eventPath[1] != "y")) {
+    return CompositionAnimationResult::Unsupported;
+  }
+
+  const auto manager = m_manager.lock();
+  const auto value = AnimatedValue();
+  if (!manager || !value || !value->UseComposition()) {
+    return CompositionAnimationResult::Unsupported;
+  }
+
+  const auto fabricuiManager = FabricUIManager::FromProperties(manager->ReactContext().Properties());
+  if (!fabricuiManager) {
+    return CompositionAnimationResult::Unsupported;
+  }
+  const auto componentView =
+      fabricuiManager->GetViewRegistry().findComponentViewWithTag(static_cast<facebook::react::Tag>(viewTag));
+  if (!componentView) {
+    return CompositionAnimationResult::ViewNotMounted;
+  }
+  const auto scrollView =
+      componentView.try_as<winrt::Microsoft::ReactNative::Composition::implementation::ScrollViewComponentView>();
+  if (!scrollView) {
+    return CompositionAnimationResult::Unsupported;
+  }
+  const auto scrollPropertySet = scrollView->EnsureScrollPropertySet();
+  if (!scrollPropertySet) {
+    return CompositionAnimationResult::Unsupported;
+  }
+
+  // The scroll view keeps the content offset on the compositor, so the value follows the scrolling even while the UI
+  // thread is busy, and without onScroll events reaching the driver
+  m_compositionAnimation = manager->Compositor().CreateExpressionAnimation(
+      m_eventPath[1] == "x" ? L"scroll.contentOffset.X" : L"scroll.contentOffset.Y");
+  m_compositionAnimation.SetReferenceParameter(L"scroll", scrollPropertySet);
+  value->PropertySet().StartAnimation(ValueAnimatedNode::s_valueName, m_compositionAnimation);
+  return CompositionAnimationResult::Started;
+}
+
 } // namespace Microsoft::ReactNative
@@ -14,11 +14,28 @@ class EventAnimationDriver {
       const std::vector<std::string> &eventPath,
       int64_t animatedValueTag,
       const std::shared_ptr<NativeAnimatedNodeManager> &manager);
+  ~EventAnimationDriver();
   ValueAnimatedNode *AnimatedValue();
 
+  enum class CompositionAnimationResult {
+    Started,
+    // The view can still be mounted, and the animation started then
+    ViewNotMounted,
+    Unsupported,
+  };
+
+  // Drives the value from the compositor, which is possible when the event is the scroll event of a ScrollView and
+  // the value is read from its contentOffset.
+  CompositionAnimationResult StartCompositionAnimation(int64_t viewTag, const std::string &eventName);
+
+  bool HasCompositionAnimation() const noexcept {
+    return m_compositionAnimation != nullptr;
+  }
+
  private:
   std::vector<std::string> m_eventPath{};
   int64_t m_animatedValueTag{};
   std::weak_ptr<NativeAnimatedNodeManager> m_manager{};
+  comp::ExpressionAnimation m_compositionAnimation{nullptr};
 };
 } // namespace Microsoft::ReactNative
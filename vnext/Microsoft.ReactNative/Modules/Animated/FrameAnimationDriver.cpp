@@ -24,13 +24,25 @@ FrameAnimationDriver::FrameAnimationDriver(
 std::tuple<comp::CompositionAnimation, comp::CompositionScopedBatch> FrameAnimationDriver::MakeAnimation(
     const winrt::Microsoft::ReactNative::JSValueObject & /*config*/) {
   assert(m_useComposition);
-  const auto [scopedBatch, animation] = [manager = m_manager.lock()]() {
-    const auto compositor = manager->Compositor();
-    return std::make_tuple(
-        compositor.CreateScopedBatch(
-            IsRS5OrHigher() ? comp::CompositionBatchTypes::AllAnimations : comp::CompositionBatchTypes::Animation),
-        compositor.CreateScalarKeyFrameAnimation());
-  }();
+  const auto manager = m_manager.lock();
+  const auto compositor = manager->Compositor();
+  // Each start needs its own batch to complete when its animation does
+  const auto scopedBatch = compositor.CreateScopedBatch(
+      IsRS5OrHigher() ? comp::CompositionBatchTypes::AllAnimations : comp::CompositionBatchTypes::Animation);
+
+  // The same timing animation started on many values, like the enter animation of every row of a list, shares its
+  // key frames
+  const auto fromValue = GetAnimatedValue()->RawValue();
+  std::string cacheKey{"frames:"};
+  for (const auto value : {fromValue, m_toValue, static_cast<double>(m_iterations)}) {
+    cacheKey.append(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  cacheKey.append(reinterpret_cast<const char *>(m_frames.data()), m_frames.size() * sizeof(double));
+  if (const auto cachedAnimation = manager->FindKeyFrameAnimation(cacheKey)) {
+    return std::make_tuple(cachedAnimation, scopedBatch);
+  }
+
+  const auto animation = compositor.CreateScalarKeyFrameAnimation();
 
   // Frames contains 60 values per second of duration of the animation, convert
   // the size of frames to duration in ms.
@@ -39,7 +51,6 @@ std::tuple<comp::CompositionAnimation, comp::CompositionScopedBatch> FrameAnimat
 
   auto normalizedProgress = 0.0f;
   auto step = 1.0f / m_frames.size();
-  auto fromValue = GetAnimatedValue()->RawValue();
   for (auto frame : m_frames) {
     normalizedProgress = std::min(normalizedProgress += step, 1.0f);
     animation.InsertKeyFrame(normalizedProgress, static_cast<float>(fromValue + frame * (m_toValue - fromValue)));
@@ -52,6 +63,7 @@ std::tuple<comp::CompositionAnimation, comp::CompositionScopedBatch> FrameAnimat
     animation.IterationBehavior(winrt::AnimationIterationBehavior::Count);
   }
 
+  manager->CacheKeyFrameAnimation(cacheKey, animation);
   return std::make_tuple(animation, scopedBatch);
 }
 
@@ -3,12 +3,49 @@
 
 #include "pch.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
 #include "AnimationUtils.h"
 #include "ExtrapolationType.h"
 #include "InterpolationAnimatedNode.h"
 #include "NativeAnimatedNodeManager.h"
 
 namespace Microsoft::ReactNative {
+
+namespace {
+
+// The expressions of the interpolations, which are only defined by the value they interpolate, the number of stops and
+// the extrapolation. There are few distinct ones, so they are kept for the lifetime of the process.
+class InterpolationExpressionCache {
+ public:
+  using Key = std::tuple<std::wstring, size_t, ExtrapolationType, ExtrapolationType>;
+
+  static InterpolationExpressionCache &Instance() noexcept {
+    // Intentionally leaked
+    static InterpolationExpressionCache *s_instance = new InterpolationExpressionCache();
+    return *s_instance;
+  }
+
+  template <typename TBuild>
+  winrt::hstring GetOrBuild(Key &&key, TBuild &&build) {
+    std::scoped_lock lock{m_mutex};
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+      auto expression = build(key);
+      it = m_entries.emplace(std::move(key), std::move(expression)).first;
+    }
+    return it->second;
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::map<Key, winrt::hstring> m_entries;
+};
+
+} // namespace
+
 InterpolationAnimatedNode::InterpolationAnimatedNode(
     int64_t tag,
     const winrt::Microsoft::ReactNative::JSValueObject &config,
@@ -102,99 +139,109 @@ comp::ExpressionAnimation InterpolationAnimatedNode::CreateExpressionAnimation(
 }
 
 winrt::hstring InterpolationAnimatedNode::GetExpression(const winrt::hstring &value) {
-  const auto leftInterpolateExpression = GetInterpolateExpression(
-      value,
-      s_inputName.data() + std::to_wstring(0),
-      s_inputName.data() + std::to_wstring(1),
-      s_outputName.data() + std::to_wstring(0),
-      s_outputName.data() + std::to_wstring(1));
-
-  const auto size = m_inputRanges.size();
-  const auto rightInterpolateExpression = GetInterpolateExpression(
-      value,
-      s_inputName.data() + std::to_wstring(size - 2),
-      s_inputName.data() + std::to_wstring(size - 1),
-      s_outputName.data() + std::to_wstring(size - 2),
-      s_outputName.data() + std::to_wstring(size - 1));
-
-  auto returnValue =
-      GetLeftExpression(value, leftInterpolateExpression) + GetRightExpression(value, rightInterpolateExpression);
-
-  // Start at 1 because we use the index and previous for each step.
-  for (size_t i = 1; i < size - 1; i++) {
-    const std::wstring inMin = s_inputName.data() + std::to_wstring(i - 1);
-    const std::wstring inMax = s_inputName.data() + std::to_wstring(i);
-    const std::wstring outMin = s_outputName.data() + std::to_wstring(i - 1);
-    const std::wstring outMax = s_outputName.data() + std::to_wstring(i);
-
-    returnValue = returnValue + value + L" >= " + inMin + L" && " + value + L" <= " + inMax + L" ? " +
-        GetInterpolateExpression(value, inMin, inMax, outMin, outMax) + L" : ";
-  }
-
-  returnValue = returnValue + // L"asd" +
-      GetInterpolateExpression(
-                    value,
-                    s_inputName.data() + std::to_wstring(size - 2),
-                    s_inputName.data() + std::to_wstring(size - 1),
-                    s_outputName.data() + std::to_wstring(size - 2),
-                    s_outputName.data() + std::to_wstring(size - 1));
-
-  return returnValue;
+  return InterpolationExpressionCache::Instance().GetOrBuild(
+      {std::wstring{value},
+       m_inputRanges.size(),
+       ExtrapolationTypeFromString(m_extrapolateLeft),
+       ExtrapolationTypeFromString(m_extrapolateRight)},
+      [](const InterpolationExpressionCache::Key &key) {
+        return BuildExpression(std::get<0>(key), std::get<1>(key), std::get<2>(key), std::get<3>(key));
+      });
 }
 
-winrt::hstring InterpolationAnimatedNode::GetInterpolateExpression(
-    const winrt::hstring &value,
-    const std::wstring &inputMin,
-    const std::wstring &inputMax,
-    const std::wstring &outputMin,
-    const std::wstring &outputMax) {
-  return outputMin + static_cast<winrt::hstring>(L" + ((") + outputMax + L" - " + outputMin + L") * ((" + value +
-      L" - " + inputMin + L") / (" + inputMax + L" - " + inputMin + L")))";
+/*static*/ winrt::hstring InterpolationAnimatedNode::BuildExpression(
+    const std::wstring &value,
+    size_t size,
+    ExtrapolationType left,
+    ExtrapolationType right) {
+  std::wstring expression;
+  AppendExtrapolateExpression(expression, value, L" < ", 0, 0, left);
+  AppendExtrapolateExpression(expression, value, L" > ", size - 1, size - 2, right);
+  AppendSegmentsExpression(expression, value, 0, size - 2);
+  return winrt::hstring{expression};
 }
 
-winrt::hstring InterpolationAnimatedNode::GetLeftExpression(
-    const winrt::hstring &value,
-    const winrt::hstring &leftInterpolateExpression) {
-  const auto firstInput = s_inputName.data() + std::to_wstring(0);
-  const auto firstOutput = s_outputName.data() + std::to_wstring(0);
-  switch (ExtrapolationTypeFromString(m_extrapolateLeft)) {
+/*static*/ void InterpolationAnimatedNode::AppendExtrapolateExpression(
+    std::wstring &expression,
+    const std::wstring &value,
+    std::wstring_view comparison,
+    size_t stop,
+    size_t segment,
+    ExtrapolationType type) {
+  expression += value;
+  expression += comparison;
+  AppendParameterName(expression, s_inputName, stop);
+  expression += L" ? ";
+  switch (type) {
     case ExtrapolationType::Clamp:
-      return value + L" < " + firstInput + L" ? " + firstOutput + L" : ";
+      AppendParameterName(expression, s_outputName, stop);
+      break;
     case ExtrapolationType::Identity:
-      return value + L" < " + firstInput + L" ? " + value + L" : ";
+      expression += value;
+      break;
     case ExtrapolationType::Extend:
-      return value + L" < " + firstInput + L" ? " + leftInterpolateExpression + L" : ";
-    default:
-      return L"";
+      AppendInterpolateExpression(expression, value, segment);
+      break;
   }
+  expression += L" : ";
 }
 
-winrt::hstring InterpolationAnimatedNode::GetRightExpression(
-    const winrt::hstring &value,
-    const winrt::hstring &rightInterpolateExpression) {
-  const auto lastInput = s_inputName.data() + std::to_wstring(m_inputRanges.size() - 1);
-  const auto lastOutput = s_outputName.data() + std::to_wstring(m_outputRanges.size() - 1);
-  switch (ExtrapolationTypeFromString(m_extrapolateRight)) {
-    case ExtrapolationType::Clamp:
-      return value + L" > " + lastInput + L" ? " + lastOutput + L" : ";
-    case ExtrapolationType::Identity:
-      return value + L" > " + lastInput + L" ? " + value + L" : ";
-    case ExtrapolationType::Extend:
-      return value + L" > " + lastInput + L" ? " + rightInterpolateExpression + L" : ";
-    default:
-      return L"";
+// Picks the segment of the value with a balanced tree of comparisons, so that each frame evaluates a logarithmic
+// number of them instead of one per stop. Like InterpolateValue, it is the first segment that ends at or after the
+// value, or the last one.
+/*static*/ void InterpolationAnimatedNode::AppendSegmentsExpression(
+    std::wstring &expression,
+    const std::wstring &value,
+    size_t first,
+    size_t last) {
+  if (first == last) {
+    AppendInterpolateExpression(expression, value, first);
+    return;
   }
+
+  const auto middle = first + (last - first) / 2;
+  expression += L"(";
+  expression += value;
+  expression += L" <= ";
+  AppendParameterName(expression, s_inputName, middle + 1);
+  expression += L" ? ";
+  AppendSegmentsExpression(expression, value, first, middle);
+  expression += L" : ";
+  AppendSegmentsExpression(expression, value, middle + 1, last);
+  expression += L")";
+}
+
+/*static*/ void InterpolationAnimatedNode::AppendInterpolateExpression(
+    std::wstring &expression,
+    const std::wstring &value,
+    size_t segment) {
+  // o0 + ((o1 - o0) * ((value - i0) / (i1 - i0)))
+  AppendParameterName(expression, s_outputName, segment);
+  expression += L" + ((";
+  AppendParameterName(expression, s_outputName, segment + 1);
+  expression += L" - ";
+  AppendParameterName(expression, s_outputName, segment);
+  expression += L") * ((";
+  expression += value;
+  expression += L" - ";
+  AppendParameterName(expression, s_inputName, segment);
+  expression += L") / (";
+  AppendParameterName(expression, s_inputName, segment + 1);
+  expression += L" - ";
+  AppendParameterName(expression, s_inputName, segment);
+  expression += L")))";
+}
+
+/*static*/ void
+InterpolationAnimatedNode::AppendParameterName(std::wstring &expression, std::wstring_view name, size_t index) {
+  expression += name;
+  expression += std::to_wstring(index);
 }
 
 double InterpolationAnimatedNode::InterpolateValue(double value) {
-  // Compute range index
-  size_t index = 1;
-  for (; index < m_inputRanges.size() - 1; ++index) {
-    if (m_inputRanges[index] >= value) {
-      break;
-    }
-  }
-  index--;
+  // The range is the first one that ends at or after the value, or the last one
+  const auto end = std::lower_bound(m_inputRanges.begin() + 1, m_inputRanges.end() - 1, value);
+  const auto index = static_cast<size_t>(end - m_inputRanges.begin()) - 1;
 
   return Interpolate(
       value,
@@ -4,6 +4,8 @@
 #pragma once
 #include "ValueAnimatedNode.h"
 
+enum class ExtrapolationType;
+
 namespace Microsoft::ReactNative {
 
 class InterpolationAnimatedNode final : public ValueAnimatedNode {
@@ -24,15 +26,21 @@ class InterpolationAnimatedNode final : public ValueAnimatedNode {
  private:
   comp::ExpressionAnimation CreateExpressionAnimation(const winrt::Compositor &compositor, ValueAnimatedNode &parent);
 
+  // The expression only refers to the ranges through the scalar parameters of the animation, so it is shared by the
+  // nodes with as many stops and the same extrapolation
   winrt::hstring GetExpression(const winrt::hstring &value);
-  winrt::hstring GetInterpolateExpression(
-      const winrt::hstring &value,
-      const std::wstring &inputMin,
-      const std::wstring &inputMax,
-      const std::wstring &outputMin,
-      const std::wstring &outputMax);
-  winrt::hstring GetLeftExpression(const winrt::hstring &value, const winrt::hstring &leftInterpolateExpression);
-  winrt::hstring GetRightExpression(const winrt::hstring &, const winrt::hstring &rightInterpolateExpression);
+  static winrt::hstring
+  BuildExpression(const std::wstring &value, size_t size, ExtrapolationType left, ExtrapolationType right);
+  static void AppendExtrapolateExpression(
+      std::wstring &expression,
+      const std::wstring &value,
+      std::wstring_view comparison,
+      size_t stop,
+      size_t segment,
+      ExtrapolationType type);
+  static void AppendSegmentsExpression(std::wstring &expression, const std::wstring &value, size_t first, size_t last);
+  static void AppendInterpolateExpression(std::wstring &expression, const std::wstring &value, size_t segment);
+  static void AppendParameterName(std::wstring &expression, std::wstring_view name, size_t index);
 
   double InterpolateValue(double value);
 
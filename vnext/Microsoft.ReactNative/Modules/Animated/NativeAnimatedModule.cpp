@@ -7,6 +7,7 @@
 
 #include <DynamicWriter.h>
 #include <ReactCoreInjection.h>
+#include <cmath>
 
 namespace Microsoft::ReactNative {
 
@@ -65,15 +66,7 @@ void NativeAnimatedModule::startListeningToAnimatedNodeValue(double tag) noexcep
   winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueue(
       m_context.Handle(), [wkThis = std::weak_ptr(this->shared_from_this()), nodeTag = static_cast<int64_t>(tag)]() {
         if (auto pThis = wkThis.lock()) {
-          pThis->m_nodesManager->StartListeningToAnimatedNodeValue(
-              nodeTag, [context = pThis->m_context, nodeTag](double value) {
-                // This event could be coalesced, however it doesn't appear to be
-                // coalesced on Android or iOS, so leaving it without coalescing.
-                context.EmitJSEvent(
-                    L"RCTDeviceEventEmitter",
-                    L"onAnimatedValueUpdate",
-                    ::React::JSValueObject{{"tag", nodeTag}, {"value", value}});
-              });
+          pThis->m_nodesManager->StartListeningToAnimatedNodeValue(nodeTag, pThis->MakeValueListener(nodeTag));
         }
       });
 }
@@ -82,11 +75,66 @@ void NativeAnimatedModule::stopListeningToAnimatedNodeValue(double tag) noexcept
   winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueue(
       m_context.Handle(), [wkThis = std::weak_ptr(this->shared_from_this()), nodeTag = static_cast<int64_t>(tag)]() {
         if (auto pThis = wkThis.lock()) {
-          pThis->m_nodesManager->StopListeningToAnimatedNodeValue(nodeTag);
+          pThis->StopListening(nodeTag);
         }
       });
 }
 
+ValueListenerCallback NativeAnimatedModule::MakeValueListener(int64_t tag) noexcept {
+  return [context = m_context, weakUpdates = std::weak_ptr(m_valueUpdates), tag](double value) {
+    auto updates = weakUpdates.lock();
+    if (!updates) {
+      return;
+    }
+
+    {
+      std::scoped_lock lock{updates->Mutex};
+      auto sent = updates->Sent.find(tag);
+      if (sent != updates->Sent.end() && std::abs(sent->second - value) <= ValueUpdates::s_epsilon) {
+        updates->Pending.erase(tag);
+        return;
+      }
+      updates->Pending[tag] = value;
+      if (updates->IsDeliveryScheduled) {
+        return;
+      }
+      updates->IsDeliveryScheduled = true;
+    }
+
+    context.JSDispatcher().Post([context, weakUpdates]() noexcept {
+      auto updates = weakUpdates.lock();
+      if (!updates) {
+        return;
+      }
+
+      std::unordered_map<int64_t, double> pending;
+      {
+        std::scoped_lock lock{updates->Mutex};
+        pending.swap(updates->Pending);
+        for (const auto &[pendingTag, pendingValue] : pending) {
+          updates->Sent[pendingTag] = pendingValue;
+        }
+        updates->IsDeliveryScheduled = false;
+      }
+
+      for (const auto &[pendingTag, pendingValue] : pending) {
+        context.EmitJSEvent(
+            L"RCTDeviceEventEmitter",
+            L"onAnimatedValueUpdate",
+            ::React::JSValueObject{{"tag", pendingTag}, {"value", pendingValue}});
+      }
+    });
+  };
+}
+
+void NativeAnimatedModule::StopListening(int64_t tag) noexcept {
+  m_nodesManager->StopListeningToAnimatedNodeValue(tag);
+
+  std::scoped_lock lock{m_valueUpdates->Mutex};
+  m_valueUpdates->Pending.erase(tag);
+  m_valueUpdates->Sent.erase(tag);
+}
+
 void NativeAnimatedModule::connectAnimatedNodes(double parentTag, double childTag) noexcept {
   winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueue(
       m_context.Handle(),
@@ -272,8 +320,154 @@ void NativeAnimatedModule::removeListeners(double count) noexcept {
   // no-op
 }
 
+// The operations are a flat array of operation ids, each followed by its fixed number of arguments, in the order of
+// the method names in createNativeOperations of NativeAnimatedHelper.  The whole batch runs in one UI batch, instead
+// of posting, and marshaling the arguments of, every operation on its own.
 void NativeAnimatedModule::queueAndExecuteBatchedOperations(::React::JSValueArray &&operationsAndArgs) noexcept {
-  assert(false); // JS currently only calls this on Android
+  winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueue(
+      m_context.Handle(),
+      [wkThis = std::weak_ptr(this->shared_from_this()), operations = std::move(operationsAndArgs)]() {
+        if (auto pThis = wkThis.lock()) {
+          pThis->ExecuteBatchedOperations(operations);
+        }
+      });
+}
+
+void NativeAnimatedModule::ExecuteBatchedOperations(const ::React::JSValueArray &operations) noexcept {
+  auto &nodesManager = m_nodesManager;
+  size_t index = 0;
+  const auto nextTag = [&]() { return index < operations.size() ? operations[index++].AsInt64() : 0; };
+  const auto nextDouble = [&]() { return index < operations.size() ? operations[index++].AsDouble() : 0.0; };
+  const auto nextValue = [&]() -> const ::React::JSValue & {
+    return index < operations.size() ? operations[index++] : ::React::JSValue::Null;
+  };
+
+  while (index < operations.size()) {
+    switch (static_cast<BatchedOperation>(nextTag())) {
+      case BatchedOperation::CreateAnimatedNode: {
+        const auto tag = nextTag();
+        nodesManager->CreateAnimatedNode(tag, nextValue().AsObject(), m_context, nodesManager);
+        break;
+      }
+      case BatchedOperation::UpdateAnimatedNodeConfig:
+        // NYI, like its own method
+        nextTag();
+        nextValue();
+        break;
+      case BatchedOperation::GetValue: {
+        const auto tag = nextTag();
+        nodesManager->GetValue(tag, [context = m_context, tag](double value) {
+          context.EmitJSEvent(
+              L"RCTDeviceEventEmitter",
+              L"onNativeAnimatedModuleGetValue",
+              ::React::JSValueObject{{"tag", tag}, {"value", value}});
+        });
+        break;
+      }
+      case BatchedOperation::StartListeningToAnimatedNodeValue: {
+        const auto tag = nextTag();
+        nodesManager->StartListeningToAnimatedNodeValue(tag, MakeValueListener(tag));
+        break;
+      }
+      case BatchedOperation::StopListeningToAnimatedNodeValue:
+        StopListening(nextTag());
+        break;
+      case BatchedOperation::ConnectAnimatedNodes: {
+        const auto parentTag = nextTag();
+        nodesManager->ConnectAnimatedNode(parentTag, nextTag());
+        break;
+      }
+      case BatchedOperation::DisconnectAnimatedNodes: {
+        const auto parentTag = nextTag();
+        nodesManager->DisconnectAnimatedNode(parentTag, nextTag());
+        break;
+      }
+      case BatchedOperation::StartAnimatingNode: {
+        const auto animationId = nextTag();
+        const auto nodeTag = nextTag();
+        // The end callback of the animation is kept by JS, which is sent the result as an event
+        nodesManager->StartAnimatingNode(
+            animationId,
+            nodeTag,
+            nextValue().AsObject(),
+            [context = m_context, animationId](bool finished) {
+              context.EmitJSEvent(
+                  L"RCTDeviceEventEmitter",
+                  L"onNativeAnimatedModuleAnimationFinished",
+                  ::React::JSValueObject{{"animationId", animationId}, {"finished", finished}});
+            },
+            nodesManager);
+        break;
+      }
+      case BatchedOperation::StopAnimation:
+        nodesManager->StopAnimation(nextTag());
+        break;
+      case BatchedOperation::SetAnimatedNodeValue: {
+        const auto nodeTag = nextTag();
+        nodesManager->SetAnimatedNodeValue(nodeTag, nextDouble());
+        break;
+      }
+      case BatchedOperation::SetAnimatedNodeOffset: {
+        const auto nodeTag = nextTag();
+        nodesManager->SetAnimatedNodeOffset(nodeTag, nextDouble());
+        break;
+      }
+      case BatchedOperation::FlattenAnimatedNodeOffset:
+        nodesManager->FlattenAnimatedNodeOffset(nextTag());
+        break;
+      case BatchedOperation::ExtractAnimatedNodeOffset:
+        nodesManager->ExtractAnimatedNodeOffset(nextTag());
+        break;
+      case BatchedOperation::ConnectAnimatedNodeToView: {
+        const auto nodeTag = nextTag();
+        nodesManager->ConnectAnimatedNodeToView(nodeTag, nextTag());
+        break;
+      }
+      case BatchedOperation::DisconnectAnimatedNodeFromView: {
+        const auto nodeTag = nextTag();
+        const auto viewTag = nextTag();
+        nodesManager->RestoreDefaultValues(viewTag);
+        nodesManager->DisconnectAnimatedNodeToView(nodeTag, viewTag);
+        break;
+      }
+      case BatchedOperation::RestoreDefaultValues:
+        nodesManager->RestoreDefaultValues(nextTag());
+        break;
+      case BatchedOperation::DropAnimatedNode:
+        nodesManager->DropAnimatedNode(nextTag());
+        break;
+      case BatchedOperation::AddAnimatedEventToView: {
+        const auto viewTag = nextTag();
+        const auto eventName = nextValue().AsString();
+        const auto &mapping = nextValue().AsObject();
+        ReactNativeSpecs::AnimatedModuleSpec_EventMapping eventMapping;
+        for (const auto &pathElement : mapping["nativeEventPath"].AsArray()) {
+          eventMapping.nativeEventPath.push_back(pathElement.AsString());
+        }
+        if (!mapping["animatedValueTag"].IsNull()) {
+          eventMapping.animatedValueTag = mapping["animatedValueTag"].AsDouble();
+        }
+        nodesManager->AddAnimatedEventToView(viewTag, eventName, eventMapping, nodesManager);
+        break;
+      }
+      case BatchedOperation::RemoveAnimatedEventFromView: {
+        const auto viewTag = nextTag();
+        const auto eventName = nextValue().AsString();
+        nodesManager->RemoveAnimatedEventFromView(viewTag, eventName, nextTag());
+        break;
+      }
+      case BatchedOperation::AddListener:
+        nextValue();
+        break;
+      case BatchedOperation::RemoveListeners:
+        nextDouble();
+        break;
+      default:
+        // The arguments of an unknown operation can't be skipped
+        assert(false);
+        return;
+    }
+  }
 }
 
 } // namespace Microsoft::ReactNative
@@ -7,6 +7,9 @@
 
 #include "NativeAnimatedNodeManager.h"
 
+#include <mutex>
+#include <unordered_map>
+
 /// <summary>
 /// Module that exposes interface for creating and managing animated nodes
 /// on the "native" side.
@@ -144,7 +147,49 @@ struct NativeAnimatedModule : std::enable_shared_from_this<NativeAnimatedModule>
   void queueAndExecuteBatchedOperations(::React::JSValueArray &&operationsAndArgs) noexcept;
 
  private:
+  // Ids of the operations in the buffer of queueAndExecuteBatchedOperations
+  enum class BatchedOperation : int64_t {
+    CreateAnimatedNode = 1,
+    UpdateAnimatedNodeConfig,
+    GetValue,
+    StartListeningToAnimatedNodeValue,
+    StopListeningToAnimatedNodeValue,
+    ConnectAnimatedNodes,
+    DisconnectAnimatedNodes,
+    StartAnimatingNode,
+    StopAnimation,
+    SetAnimatedNodeValue,
+    SetAnimatedNodeOffset,
+    FlattenAnimatedNodeOffset,
+    ExtractAnimatedNodeOffset,
+    ConnectAnimatedNodeToView,
+    DisconnectAnimatedNodeFromView,
+    RestoreDefaultValues,
+    DropAnimatedNode,
+    AddAnimatedEventToView,
+    RemoveAnimatedEventFromView,
+    AddListener,
+    RemoveListeners,
+  };
+
+  // Coalesces the updates of the listened values, which change on every frame of their animations.  The value of a
+  // node is sent to JS at most once per JS task that delivers them, only its latest value, and only when it moved
+  // by more than s_epsilon since it was last sent, so that a busy JS thread does not fall behind the animation.
+  struct ValueUpdates {
+    std::mutex Mutex;
+    std::unordered_map<int64_t, double> Pending;
+    std::unordered_map<int64_t, double> Sent;
+    bool IsDeliveryScheduled{false};
+
+    static constexpr double s_epsilon{1e-5};
+  };
+
+  void ExecuteBatchedOperations(const ::React::JSValueArray &operations) noexcept;
+  ValueListenerCallback MakeValueListener(int64_t tag) noexcept;
+  void StopListening(int64_t tag) noexcept;
+
   std::shared_ptr<NativeAnimatedNodeManager> m_nodesManager;
+  std::shared_ptr<ValueUpdates> m_valueUpdates{std::make_shared<ValueUpdates>()};
   winrt::Microsoft::ReactNative::ReactContext m_context;
 };
 } // namespace Microsoft::ReactNative
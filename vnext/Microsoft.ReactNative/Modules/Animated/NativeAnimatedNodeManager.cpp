@@ -24,6 +24,7 @@
 #include "FacadeType.h"
 
 #include <Windows.Foundation.h>
+#include <algorithm>
 #include <queue>
 
 #include <Fabric/Composition/CompositionContextHelper.h>
@@ -49,6 +50,50 @@ comp::Compositor NativeAnimatedNodeManager::Compositor() const noexcept {
   return nullptr;
 }
 
+void NativeAnimatedNodeManager::EnsureSharedAnimationsCompositor(const comp::Compositor &compositor) noexcept {
+  if (m_sharedAnimationsCompositor != compositor) {
+    m_sharedAnimationsCompositor = compositor;
+    m_sharedExpressionAnimations.clear();
+    m_keyFrameAnimations.clear();
+    m_keyFrameAnimationsOrder.clear();
+  }
+}
+
+comp::ExpressionAnimation NativeAnimatedNodeManager::SharedExpressionAnimation(
+    const winrt::hstring &expression,
+    const winrt::hstring &target) {
+  const auto compositor = Compositor();
+  EnsureSharedAnimationsCompositor(compositor);
+
+  auto key = std::wstring(target) + L'=' + std::wstring(expression);
+  auto it = m_sharedExpressionAnimations.find(key);
+  if (it == m_sharedExpressionAnimations.end()) {
+    auto animation = compositor.CreateExpressionAnimation(expression);
+    animation.Target(target);
+    it = m_sharedExpressionAnimations.emplace(std::move(key), std::move(animation)).first;
+  }
+  return it->second;
+}
+
+comp::KeyFrameAnimation NativeAnimatedNodeManager::FindKeyFrameAnimation(const std::string &key) {
+  EnsureSharedAnimationsCompositor(Compositor());
+  auto it = m_keyFrameAnimations.find(key);
+  return it == m_keyFrameAnimations.end() ? nullptr : it->second;
+}
+
+void NativeAnimatedNodeManager::CacheKeyFrameAnimation(
+    const std::string &key,
+    const comp::KeyFrameAnimation &animation) {
+  EnsureSharedAnimationsCompositor(animation.Compositor());
+  if (m_keyFrameAnimations.emplace(key, animation).second) {
+    m_keyFrameAnimationsOrder.push_back(key);
+    if (m_keyFrameAnimationsOrder.size() > s_maxKeyFrameAnimations) {
+      m_keyFrameAnimations.erase(m_keyFrameAnimationsOrder.front());
+      m_keyFrameAnimationsOrder.pop_front();
+    }
+  }
+}
+
 void NativeAnimatedNodeManager::CreateAnimatedNode(
     int64_t tag,
     const ::React::JSValueObject &config,
@@ -59,6 +104,7 @@ void NativeAnimatedNodeManager::CreateAnimatedNode(
     throw std::invalid_argument("AnimatedNode with tag " + std::to_string(tag) + " already exists.");
     return;
   }
+  InvalidateUpdatePlan();
 
   switch (const auto type = AnimatedNodeTypeFromString(config["type"].AsString())) {
     case AnimatedNodeType::Style: {
@@ -146,6 +192,7 @@ void NativeAnimatedNodeManager::RestoreDefaultValues(int64_t tag) {
 void NativeAnimatedNodeManager::ConnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
   if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
     parentNode->AddChild(childNodeTag);
+    InvalidateUpdatePlan();
     if (!parentNode->UseComposition()) {
       m_updatedNodes.insert(childNodeTag);
       EnsureRendering();
@@ -156,6 +203,7 @@ void NativeAnimatedNodeManager::ConnectAnimatedNode(int64_t parentNodeTag, int64
 void NativeAnimatedNodeManager::DisconnectAnimatedNode(int64_t parentNodeTag, int64_t childNodeTag) {
   if (const auto parentNode = GetAnimatedNode(parentNodeTag)) {
     parentNode->RemoveChild(childNodeTag);
+    InvalidateUpdatePlan();
     if (!parentNode->UseComposition()) {
       m_updatedNodes.insert(childNodeTag);
       EnsureRendering();
@@ -338,6 +386,7 @@ void NativeAnimatedNodeManager::StartAnimatingNode(
 }
 
 void NativeAnimatedNodeManager::DropAnimatedNode(int64_t tag) {
+  InvalidateUpdatePlan();
   m_valueNodes.erase(tag);
   m_propsNodes.erase(tag);
   m_styleNodes.erase(tag);
@@ -399,15 +448,49 @@ void NativeAnimatedNodeManager::AddAnimatedEventToView(
   const auto pathList = eventMapping.nativeEventPath;
 
   const auto key = std::make_tuple(viewTag, eventName);
+  auto driver = std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager);
+  if (driver->StartCompositionAnimation(viewTag, eventName) ==
+      EventAnimationDriver::CompositionAnimationResult::ViewNotMounted) {
+    AddDelayedEventDrivers(key);
+  }
+
   if (m_eventDrivers.count(key)) {
-    m_eventDrivers.at(key).emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
+    m_eventDrivers.at(key).emplace_back(std::move(driver));
   } else {
     auto vector = std::vector<std::unique_ptr<EventAnimationDriver>>{};
-    vector.emplace_back(std::make_unique<EventAnimationDriver>(pathList, valueNodeTag, manager));
+    vector.emplace_back(std::move(driver));
     m_eventDrivers.insert({key, std::move(vector)});
   }
 }
 
+void NativeAnimatedNodeManager::ProcessDelayedEventDrivers() {
+  // Drivers of views that are still not mounted are put back into the queue, like the delayed props nodes
+  const auto delayedEventDrivers = m_delayedEventDrivers;
+  m_delayedEventDrivers.clear();
+  for (const auto &key : delayedEventDrivers) {
+    if (m_eventDrivers.count(key)) {
+      for (const auto &driver : m_eventDrivers.at(key)) {
+        if (!driver->HasCompositionAnimation() &&
+            driver->StartCompositionAnimation(std::get<0>(key), std::get<1>(key)) ==
+                EventAnimationDriver::CompositionAnimationResult::ViewNotMounted) {
+          AddDelayedEventDrivers(key);
+        }
+      }
+    }
+  }
+}
+
+void NativeAnimatedNodeManager::AddDelayedEventDrivers(const std::tuple<int64_t, std::string> &key) {
+  if (std::find(m_delayedEventDrivers.begin(), m_delayedEventDrivers.end(), key) != m_delayedEventDrivers.end()) {
+    return;
+  }
+  m_delayedEventDrivers.push_back(key);
+  if (m_delayedEventDrivers.size() <= 1) {
+    winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueue(
+        m_context.Handle(), [this]() { ProcessDelayedEventDrivers(); });
+  }
+}
+
 void NativeAnimatedNodeManager::RemoveAnimatedEventFromView(
     int64_t viewTag,
     const std::string &eventName,
@@ -628,6 +711,29 @@ void NativeAnimatedNodeManager::UpdateActiveAnimationIds() {
 }
 
 void NativeAnimatedNodeManager::UpdateNodes(std::unordered_set<int64_t> &nodes) {
+  // The nodes driven each frame rarely change while animations run, so the update order is only derived again when
+  // they, or the graph, change
+  std::vector<int64_t> roots(nodes.begin(), nodes.end());
+  std::sort(roots.begin(), roots.end());
+  if (!m_updatePlanValid || roots != m_updatePlanRoots) {
+    BuildUpdatePlan(roots);
+  }
+
+  for (const auto &step : m_updatePlan) {
+    step.node->Update();
+    if (step.propsNode) {
+      step.propsNode->UpdateView();
+    } else if (step.valueNode) {
+      step.valueNode->OnValueUpdate();
+    }
+  }
+}
+
+void NativeAnimatedNodeManager::BuildUpdatePlan(std::vector<int64_t> roots) {
+  m_updatePlan.clear();
+  m_updatePlanRoots = std::move(roots);
+  m_updatePlanValid = true;
+
   auto activeNodesCount = 0;
   auto updatedNodesCount = 0;
 
@@ -636,10 +742,9 @@ void NativeAnimatedNodeManager::UpdateNodes(std::unordered_set<int64_t> &nodes)
   std::unordered_map<int64_t, int64_t> incomingNodeCounts;
 
   // STEP 1.
-  // BFS over graph of nodes starting from IDs in `nodes` argument and IDs that are attached to
-  // active animations (from `m_activeAnimations)`. Update `incomingNodeCounts` map for each node
-  // during that BFS. Store number of visited nodes in `activeNodesCount`. We "execute" active
-  // animations as a part of this step.
+  // BFS over graph of nodes starting from IDs in `roots` argument, which include the IDs that are attached to
+  // active animations (from `m_activeAnimations)`. Update `incomingNodeCounts` map for each node during that BFS.
+  // Store number of visited nodes in `activeNodesCount`.
 
   m_animatedGraphBFSColor++; /* use new color */
   if (m_animatedGraphBFSColor == 0) {
@@ -648,7 +753,7 @@ void NativeAnimatedNodeManager::UpdateNodes(std::unordered_set<int64_t> &nodes)
   }
 
   std::queue<int64_t> nodesQueue{};
-  for (auto id : nodes) {
+  for (auto id : m_updatePlanRoots) {
     if (!bfsColors.count(id) || bfsColors.at(id) != m_animatedGraphBFSColor) {
       bfsColors[id] = m_animatedGraphBFSColor;
       activeNodesCount++;
@@ -692,7 +797,7 @@ void NativeAnimatedNodeManager::UpdateNodes(std::unordered_set<int64_t> &nodes)
 
   // find nodes with zero "incoming nodes", those can be either nodes from `m_updatedNodes` or
   // ones connected to active animations
-  for (auto id : nodes) {
+  for (auto id : m_updatePlanRoots) {
     if (!incomingNodeCounts.count(id) ||
         incomingNodeCounts.at(id) == 0 && bfsColors.at(id) != m_animatedGraphBFSColor) {
       bfsColors[id] = m_animatedGraphBFSColor;
@@ -701,17 +806,13 @@ void NativeAnimatedNodeManager::UpdateNodes(std::unordered_set<int64_t> &nodes)
     }
   }
 
-  // Run main "update" loop
+  // Record the "update" order, resolving each node once rather than every frame
   while (nodesQueue.size() > 0) {
     auto id = nodesQueue.front();
     nodesQueue.pop();
     if (auto node = GetAnimatedNode(id)) {
-      node->Update();
-      if (auto propsNode = GetPropsAnimatedNode(id)) {
-        propsNode->UpdateView();
-      } else if (auto valueNode = GetValueAnimatedNode(id)) {
-        valueNode->OnValueUpdate();
-      }
+      auto propsNode = GetPropsAnimatedNode(id);
+      m_updatePlan.push_back({node, propsNode, propsNode ? nullptr : GetValueAnimatedNode(id)});
 
       for (auto &childId : node->Children()) {
         auto &incomingCount = incomingNodeCounts.at(childId);
@@ -731,4 +832,9 @@ void NativeAnimatedNodeManager::UpdateNodes(std::unordered_set<int64_t> &nodes)
   // visited in the step above so that `incomingNodeCounts` for all node IDs are set to zero
   assert(activeNodesCount == updatedNodesCount);
 }
+
+void NativeAnimatedNodeManager::InvalidateUpdatePlan() noexcept {
+  m_updatePlanValid = false;
+  m_updatePlan.clear();
+}
 } // namespace Microsoft::ReactNative
@@ -14,6 +14,8 @@
 #include "TransformAnimatedNode.h"
 #include "ValueAnimatedNode.h"
 
+#include <deque>
+
 #include "codegen/NativeAnimatedModuleSpec.g.h"
 
 namespace Microsoft::ReactNative {
@@ -43,6 +45,11 @@ class NativeAnimatedNodeManager {
   NativeAnimatedNodeManager(winrt::Microsoft::ReactNative::ReactContext const &reactContext);
   const winrt::Microsoft::ReactNative::ReactContext &ReactContext() const noexcept;
   comp::Compositor Compositor() const noexcept;
+  // Animations are copied when they are started, so the nodes and drivers share immutable ones instead of creating
+  // them for each view and each start.  The reference parameters of a shared expression are set before each start.
+  comp::ExpressionAnimation SharedExpressionAnimation(const winrt::hstring &expression, const winrt::hstring &target);
+  comp::KeyFrameAnimation FindKeyFrameAnimation(const std::string &key);
+  void CacheKeyFrameAnimation(const std::string &key, const comp::KeyFrameAnimation &animation);
   void CreateAnimatedNode(
       int64_t tag,
       const winrt::Microsoft::ReactNative::JSValueObject &config,
@@ -88,6 +95,8 @@ class NativeAnimatedNodeManager {
   void RemoveAnimatedEventFromView(int64_t viewTag, const std::string &eventName, int64_t animatedValueTag);
   void ProcessDelayedPropsNodes();
   void AddDelayedPropsNode(int64_t propsNodeTag, const winrt::Microsoft::ReactNative::ReactContext &context);
+  void ProcessDelayedEventDrivers();
+  void AddDelayedEventDrivers(const std::tuple<int64_t, std::string> &key);
 
   AnimatedNode *GetAnimatedNode(int64_t tag);
   ValueAnimatedNode *GetValueAnimatedNode(int64_t tag);
@@ -113,6 +122,16 @@ class NativeAnimatedNodeManager {
   void StopAnimationsForNode(int64_t tag);
   void UpdateActiveAnimationIds();
   void UpdateNodes(std::unordered_set<int64_t> &nodes);
+  void BuildUpdatePlan(std::vector<int64_t> roots);
+  void InvalidateUpdatePlan() noexcept;
+  void EnsureSharedAnimationsCompositor(const comp::Compositor &compositor) noexcept;
+
+  // A node to update, with the kinds it is resolved to, in the order UpdateNodes updates them
+  struct UpdatePlanStep {
+    AnimatedNode *node;
+    PropsAnimatedNode *propsNode;
+    ValueAnimatedNode *valueNode;
+  };
 
   std::unordered_map<int64_t, std::unique_ptr<ValueAnimatedNode>> m_valueNodes{};
   std::unordered_map<int64_t, std::unique_ptr<PropsAnimatedNode>> m_propsNodes{};
@@ -127,12 +146,24 @@ class NativeAnimatedNodeManager {
   std::unordered_map<int64_t, int64_t> m_deferredAnimationForValues{};
   std::vector<std::tuple<int64_t, int64_t>> m_trackingAndLeadNodeTags{};
   std::vector<int64_t> m_delayedPropsNodes{};
+  // Event drivers, by view and event, to drive from the compositor once their view is mounted
+  std::vector<std::tuple<int64_t, std::string>> m_delayedEventDrivers{};
   winrt::Microsoft::ReactNative::ReactContext m_context;
 
   std::unordered_set<int64_t> m_updatedNodes{};
   std::vector<int64_t> m_activeAnimationIds{};
   int64_t m_animatedGraphBFSColor{};
+  // Topologically sorted nodes reachable from m_updatePlanRoots, dropped when the graph changes
+  std::vector<int64_t> m_updatePlanRoots{};
+  std::vector<UpdatePlanStep> m_updatePlan{};
+  bool m_updatePlanValid{false};
   xaml::Media::CompositionTarget::Rendering_revoker m_renderingRevoker;
+  // The shared animations, which all belong to m_sharedAnimationsCompositor
+  comp::Compositor m_sharedAnimationsCompositor{nullptr};
+  std::unordered_map<std::wstring, comp::ExpressionAnimation> m_sharedExpressionAnimations{};
+  std::unordered_map<std::string, comp::KeyFrameAnimation> m_keyFrameAnimations{};
+  std::deque<std::string> m_keyFrameAnimationsOrder{};
+  static constexpr size_t s_maxKeyFrameAnimations{64};
 
   static constexpr std::string_view s_toValueIdName{"toValue"};
   static constexpr std::string_view s_framesName{"frames"};
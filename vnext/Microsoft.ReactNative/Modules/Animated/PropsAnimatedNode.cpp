@@ -31,15 +31,6 @@ PropsAnimatedNode::PropsAnimatedNode(
     m_subchannelPropertySet.InsertScalar(L"TranslationY", 0.0f);
     m_subchannelPropertySet.InsertScalar(L"ScaleX", 1.0f);
     m_subchannelPropertySet.InsertScalar(L"ScaleY", 1.0f);
-
-    m_translationCombined =
-        compositor.CreateExpressionAnimation(L"Vector3(subchannels.TranslationX, subchannels.TranslationY, 0.0)");
-    m_translationCombined.SetReferenceParameter(L"subchannels", m_subchannelPropertySet);
-    m_translationCombined.Target(L"Translation");
-
-    m_scaleCombined = compositor.CreateExpressionAnimation(L"Vector3(subchannels.ScaleX, subchannels.ScaleY, 1.0)");
-    m_scaleCombined.SetReferenceParameter(L"subchannels", m_subchannelPropertySet);
-    m_scaleCombined.Target(L"Scale");
   }
 }
 
@@ -132,20 +123,27 @@ void PropsAnimatedNode::StartAnimations() {
   assert(m_useComposition);
   if (m_expressionAnimations.size()) {
     AnimationView view = GetAnimationView();
-    if (view) {
+    const auto manager = m_manager.lock();
+    if (view && manager) {
+      const auto startCombinedAnimation = [&](const winrt::hstring &expression, const winrt::hstring &target) {
+        auto combined = manager->SharedExpressionAnimation(expression, target);
+        combined.SetReferenceParameter(L"subchannels", m_subchannelPropertySet);
+        StartAnimation(view, combined);
+      };
+
       for (const auto &anim : m_expressionAnimations) {
         if (anim.second.Target() == L"Translation.X") {
           m_subchannelPropertySet.StartAnimation(L"TranslationX", anim.second);
-          StartAnimation(view, m_translationCombined);
+          startCombinedAnimation(s_translationCombinedExpression, L"Translation");
         } else if (anim.second.Target() == L"Translation.Y") {
           m_subchannelPropertySet.StartAnimation(L"TranslationY", anim.second);
-          StartAnimation(view, m_translationCombined);
+          startCombinedAnimation(s_translationCombinedExpression, L"Translation");
         } else if (anim.second.Target() == L"Scale.X") {
           m_subchannelPropertySet.StartAnimation(L"ScaleX", anim.second);
-          StartAnimation(view, m_scaleCombined);
+          startCombinedAnimation(s_scaleCombinedExpression, L"Scale");
         } else if (anim.second.Target() == L"Scale.Y") {
           m_subchannelPropertySet.StartAnimation(L"ScaleY", anim.second);
-          StartAnimation(view, m_scaleCombined);
+          startCombinedAnimation(s_scaleCombinedExpression, L"Scale");
         } else if (anim.second.Target() == L"Rotation") {
           if (view.m_componentView) {
             auto visual =
@@ -162,12 +160,10 @@ void PropsAnimatedNode::StartAnimations() {
       }
       if (m_needsCenterPointAnimation) {
         if (!m_centerPointAnimation) {
-          if (const auto manager = m_manager.lock()) {
-            m_centerPointAnimation = manager->Compositor().CreateExpressionAnimation();
-            m_centerPointAnimation.Target(L"CenterPoint");
-            m_centerPointAnimation.SetReferenceParameter(L"centerPointPropertySet", EnsureCenterPointPropertySet(view));
-            m_centerPointAnimation.Expression(L"centerPointPropertySet.center");
-          }
+          m_centerPointAnimation = manager->Compositor().CreateExpressionAnimation();
+          m_centerPointAnimation.Target(L"CenterPoint");
+          m_centerPointAnimation.SetReferenceParameter(L"centerPointPropertySet", EnsureCenterPointPropertySet(view));
+          m_centerPointAnimation.Expression(L"centerPointPropertySet.center");
         }
 
         StartAnimation(view, m_centerPointAnimation);
@@ -314,6 +310,7 @@ void PropsAnimatedNode::StartAnimation(
       if (targetProp == L"Rotation") {
         targetProp = L"RotationAngleInDegrees";
       } else if (targetProp == L"Transform") {
+        baseComponentView->EnsureTransformMatrixFacade();
         baseComponentView->EnsureCenterPointPropertySet().StartAnimation(L"transform", animation);
         return;
       } else if (targetProp == L"Translation") {
@@ -57,8 +57,11 @@ class PropsAnimatedNode final : public AnimatedNode {
   winrt::Numerics::float3 m_rotationAxis{0, 0, 1};
   bool m_needsCenterPointAnimation{false};
   comp::CompositionPropertySet m_subchannelPropertySet{nullptr};
-  comp::CompositionAnimation m_translationCombined{nullptr};
-  comp::CompositionAnimation m_scaleCombined{nullptr};
+
+  // Combine the animated subchannels of the node, shared by all the nodes through NativeAnimatedNodeManager
+  static constexpr std::wstring_view s_translationCombinedExpression{
+      L"Vector3(subchannels.TranslationX, subchannels.TranslationY, 0.0)"};
+  static constexpr std::wstring_view s_scaleCombinedExpression{L"Vector3(subchannels.ScaleX, subchannels.ScaleY, 1.0)"};
 
   static constexpr int64_t s_connectedViewTagUnset{-1};
 };
@@ -7,6 +7,7 @@
 #include <Utils/Helpers.h>
 #include <XamlUtils.h>
 #include <winrt/Windows.ApplicationModel.DataTransfer.h>
+#include "ReactHost/React.h"
 #include "Unicode.h"
 
 using namespace winrt::Windows::UI::Core;
@@ -16,7 +17,19 @@ namespace Microsoft::ReactNative {
 void AppState::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
   m_deactivated = false;
-  m_enteredBackground = false;
+  m_backgroundMode = Mso::React::BackgroundMode::FromProperties(reactContext.Properties());
+  m_enteredBackground = m_backgroundMode->IsInBackground();
+  m_backgroundListenerToken = m_backgroundMode->AddListener([weakThis = weak_from_this()](bool isInBackground) {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->SetEnteredBackground(isInBackground);
+    }
+  });
+}
+
+AppState::~AppState() noexcept {
+  if (m_backgroundMode) {
+    m_backgroundMode->RemoveListener(m_backgroundListenerToken);
+  }
 }
 
 void AppState::GetCurrentAppState(
@@ -4,6 +4,7 @@
 
 #include "codegen/NativeAppStateSpec.g.h"
 #include <NativeModules.h>
+#include <ReactHost/BackgroundMode.h>
 #include <winrt/Windows.ApplicationModel.h>
 #include <winrt/Windows.Foundation.h>
 
@@ -16,6 +17,8 @@ struct AppState : public std::enable_shared_from_this<AppState> {
   using ModuleSpec = ReactNativeSpecs::AppStateSpec;
   using AppStateChangeArgs = ReactNativeSpecs::AppStateSpec_AppState;
 
+  ~AppState() noexcept;
+
   REACT_INIT(Initialize)
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
 
@@ -46,6 +49,9 @@ struct AppState : public std::enable_shared_from_this<AppState> {
   std::atomic<bool> m_enteredBackground;
   char const *m_lastState{nullptr};
   winrt::Microsoft::ReactNative::ReactContext m_context;
+  // Reports the background mode that the host sets with ReactNativeHost.IsInBackground
+  std::shared_ptr<Mso::React::BackgroundMode> m_backgroundMode;
+  uint32_t m_backgroundListenerToken{0};
 };
 
 } // namespace Microsoft::ReactNative
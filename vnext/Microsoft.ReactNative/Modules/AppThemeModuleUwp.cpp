@@ -40,22 +40,20 @@ static const React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<AppT
 // AppThemeHolder
 //
 
-AppThemeHolder::AppThemeHolder(const Mso::React::IReactContext &context) : m_context(&context) {
+AppThemeHolder::AppThemeHolder(const ReactNotificationService &notifications) {
   NotifyHighContrastChanged();
   m_wmSubscription = SubscribeToWindowMessage(
-      ReactNotificationService(m_context->Notifications()), WM_THEMECHANGED, [this](const auto &, const auto &) {
-        NotifyHighContrastChanged();
-      });
+      notifications, WM_THEMECHANGED, [this](const auto &, const auto &) { NotifyHighContrastChanged(); });
 }
 
 ReactNativeSpecs::AppThemeSpec_AppThemeData AppThemeHolder::GetConstants() noexcept {
   return m_appThemeData;
 }
 
-/*static*/ void AppThemeHolder::InitAppThemeHolder(const Mso::React::IReactContext &context) noexcept {
-  auto appThemeHolder = std::make_shared<AppThemeHolder>(context);
-  winrt::Microsoft::ReactNative::ReactPropertyBag pb{context.Properties()};
-  pb.Set(AppThemeHolderPropertyId(), std::move(appThemeHolder));
+/*static*/ void AppThemeHolder::EnsureAppThemeHolder(const React::ReactContext &context) noexcept {
+  context.Properties().GetOrCreate(AppThemeHolderPropertyId(), [&context]() -> std::shared_ptr<AppThemeHolder> {
+    return std::make_shared<AppThemeHolder>(context.Notifications());
+  });
 }
 
 void AppThemeHolder::SetCallback(
@@ -100,6 +98,7 @@ void AppThemeHolder::NotifyHighContrastChanged() noexcept {
 void AppTheme::Initialize(React::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
 
+  AppThemeHolder::EnsureAppThemeHolder(m_context);
   AppThemeHolder::SetCallback(
       m_context.Properties(), [weakThis = weak_from_this()](React::JSValueObject &&appThemeInfo) {
         if (auto strongThis = weakThis.lock()) {
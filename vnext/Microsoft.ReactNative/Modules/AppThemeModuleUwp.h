@@ -16,9 +16,11 @@ namespace Microsoft::ReactNative {
 
 class AppThemeHolder {
  public:
-  AppThemeHolder(const Mso::React::IReactContext &reactContext);
+  AppThemeHolder(const winrt::Microsoft::ReactNative::ReactNotificationService &notifications);
 
-  static void InitAppThemeHolder(const Mso::React::IReactContext &context) noexcept;
+  // The holder is created the first time that the AppTheme module is used. Its colors are read from UISettings, which
+  // can be used from any thread.
+  static void EnsureAppThemeHolder(const winrt::Microsoft::ReactNative::ReactContext &context) noexcept;
   ReactNativeSpecs::AppThemeSpec_AppThemeData GetConstants() noexcept;
   static void SetCallback(
       const winrt::Microsoft::ReactNative::ReactPropertyBag &propertyBag,
@@ -29,7 +31,6 @@ class AppThemeHolder {
   static std::string FormatRGB(winrt::Windows::UI::Color ElementColor);
   void NotifyHighContrastChanged() noexcept;
 
-  Mso::CntPtr<const Mso::React::IReactContext> m_context;
   Mso::Functor<void(winrt::Microsoft::ReactNative::JSValueObject &&)> m_notifyCallback;
   ReactNativeSpecs::AppThemeSpec_AppThemeData m_appThemeData;
   winrt::Windows::UI::ViewManagement::UISettings m_uiSettings{};
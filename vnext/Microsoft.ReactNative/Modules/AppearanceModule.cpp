@@ -68,20 +68,14 @@ void Appearance::RequeryTheme() noexcept {
   }
 }
 
-void Appearance::InitOnUIThread(const Mso::React::IReactContext &context) noexcept {
-  xaml::ApplicationTheme theme = ApplicationTheme::Light;
-  theme = CurrentThemeFromUISettings(winrt::Windows::UI::ViewManagement::UISettings());
-
-  winrt::Microsoft::ReactNative::ReactPropertyBag pb{context.Properties()};
-  pb.Set(AppearanceCurrentThemePropertyId(), theme);
-}
-
 void Appearance::setColorScheme(std::string style) noexcept {
   // no-op
 }
 
 std::optional<std::string> Appearance::getColorScheme() noexcept {
-  return ToString(*(m_context.Properties().Get(AppearanceCurrentThemePropertyId())));
+  // The theme is read here the first time, before the UI thread requeries it
+  return ToString(*m_context.Properties().GetOrCreate(
+      AppearanceCurrentThemePropertyId(), [this]() { return CurrentThemeFromUISettings(m_uiSettings); }));
 }
 
 void Appearance::addListener(std::string eventName) noexcept {
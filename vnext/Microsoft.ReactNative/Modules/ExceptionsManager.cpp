@@ -4,9 +4,8 @@
 #include "pch.h"
 #include "ExceptionsManager.h"
 
-#include <DynamicWriter.h>
 #include <IRedBoxHandler.h>
-#include <JSValueWriter.h>
+#include <Modules/CxxModuleUtilities.h>
 
 namespace Microsoft::ReactNative {
 
@@ -69,10 +68,8 @@ void ExceptionsManager::reportException(ReactNativeSpecs::ExceptionsManagerSpec_
     errorInfo.ComponentStack = data.componentStack.value_or("");
     errorInfo.Id = static_cast<uint32_t>(data.id);
 
-    auto writer = winrt::make_self<winrt::Microsoft::ReactNative::DynamicWriter>();
-    winrt::Microsoft::ReactNative::WriteValue(
-        writer.as<winrt::Microsoft::ReactNative::IJSValueWriter>(), data.extraData);
-    errorInfo.ExtraData = writer->TakeValue();
+    errorInfo.ExtraData =
+        data.extraData ? Microsoft::React::Modules::ToDynamic(std::move(*data.extraData)) : folly::dynamic{nullptr};
 
     for (auto frame : data.stack) {
       errorInfo.Callstack.push_back(Mso::React::ErrorFrameInfo{
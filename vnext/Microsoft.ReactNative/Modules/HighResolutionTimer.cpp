@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "HighResolutionTimer.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace Microsoft::ReactNative {
+
+struct HighResolutionTimer::State : std::enable_shared_from_this<State> {
+  ~State() noexcept {
+    if (Wait) {
+      Disarm();
+      WaitForThreadpoolWaitCallbacks(Wait, TRUE);
+      CloseThreadpoolWait(Wait);
+    }
+  }
+
+  void Arm() noexcept {
+    // Negative due times are relative, in 100 ns units
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -std::max<int64_t>(Interval.count(), 0);
+    SetWaitableTimerEx(Timer.get(), &dueTime, 0, nullptr, nullptr, nullptr, 0);
+    SetThreadpoolWait(Wait, Timer.get(), nullptr);
+  }
+
+  void Disarm() noexcept {
+    SetThreadpoolWait(Wait, nullptr, nullptr);
+    CancelWaitableTimer(Timer.get());
+  }
+
+  static void CALLBACK OnSignaled(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WAIT, TP_WAIT_RESULT) noexcept {
+    auto state = static_cast<State *>(context);
+    state->Dispatcher.Post([weakState = state->weak_from_this(), generation = state->Generation.load()]() noexcept {
+      auto strongState = weakState.lock();
+      // Drops the ticks of a timer that was stopped or started again since
+      if (!strongState || strongState->Generation != generation) {
+        return;
+      }
+
+      strongState->TickEvent(nullptr, nullptr);
+      if (strongState->Generation == generation) {
+        strongState->Arm();
+      }
+    });
+  }
+
+  winrt::Microsoft::ReactNative::IReactDispatcher Dispatcher{nullptr};
+  winrt::handle Timer;
+  PTP_WAIT Wait{nullptr};
+  winrt::Windows::Foundation::TimeSpan Interval{0};
+  // Changes each time the timer is started or stopped
+  std::atomic<uint32_t> Generation{0};
+  winrt::event<winrt::Windows::Foundation::EventHandler<winrt::IInspectable>> TickEvent;
+};
+
+/*static*/ winrt::Microsoft::ReactNative::ITimer HighResolutionTimer::TryCreate(
+    const winrt::Microsoft::ReactNative::IReactDispatcher &dispatcher) noexcept {
+  auto state = std::make_shared<State>();
+  state->Timer.attach(
+      CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS));
+  if (!state->Timer) {
+    return nullptr;
+  }
+
+  state->Wait = CreateThreadpoolWait(&State::OnSignaled, state.get(), nullptr);
+  if (!state->Wait) {
+    return nullptr;
+  }
+
+  state->Dispatcher = dispatcher;
+  return winrt::make<HighResolutionTimer>(std::move(state));
+}
+
+HighResolutionTimer::HighResolutionTimer(std::shared_ptr<State> &&state) noexcept : m_state(std::move(state)) {}
+
+winrt::Windows::Foundation::TimeSpan HighResolutionTimer::Interval() noexcept {
+  return m_state->Interval;
+}
+
+void HighResolutionTimer::Interval(winrt::Windows::Foundation::TimeSpan value) noexcept {
+  m_state->Interval = value;
+}
+
+void HighResolutionTimer::Start() noexcept {
+  m_state->Generation++;
+  m_state->Arm();
+}
+
+void HighResolutionTimer::Stop() noexcept {
+  m_state->Generation++;
+  m_state->Disarm();
+}
+
+winrt::event_token HighResolutionTimer::Tick(
+    const winrt::Windows::Foundation::EventHandler<winrt::IInspectable> &handler) {
+  return m_state->TickEvent.add(handler);
+}
+
+void HighResolutionTimer::Tick(winrt::event_token const &token) noexcept {
+  m_state->TickEvent.remove(token);
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <winrt/Microsoft.ReactNative.h>
+#include <memory>
+
+namespace Microsoft::ReactNative {
+
+// ITimer on a high resolution waitable timer, for the intervals that are shorter than the resolution of the system
+// timer, about 15.6 ms, which DispatcherQueueTimer rounds them up to.  The timer is waited on by the thread pool, and
+// its ticks are raised on the dispatcher.  Like DispatcherQueueTimer, it ticks every interval until it is stopped.
+// Each tick wakes the CPU, so it is only meant for short waits.
+struct HighResolutionTimer : winrt::implements<HighResolutionTimer, winrt::Microsoft::ReactNative::ITimer> {
+  // nullptr when the OS does not support high resolution timers, before Windows 10 1803
+  static winrt::Microsoft::ReactNative::ITimer TryCreate(
+      const winrt::Microsoft::ReactNative::IReactDispatcher &dispatcher) noexcept;
+
+  struct State;
+  HighResolutionTimer(std::shared_ptr<State> &&state) noexcept;
+
+  winrt::Windows::Foundation::TimeSpan Interval() noexcept;
+  void Interval(winrt::Windows::Foundation::TimeSpan value) noexcept;
+  void Start() noexcept;
+  void Stop() noexcept;
+
+  winrt::event_token Tick(const winrt::Windows::Foundation::EventHandler<winrt::IInspectable> &handler);
+  void Tick(winrt::event_token const &token) noexcept;
+
+ private:
+  // Shared with the ticks posted to the dispatcher, which may run after the timer is released
+  std::shared_ptr<State> m_state;
+};
+
+} // namespace Microsoft::ReactNative
@@ -27,13 +27,6 @@ static const React::ReactPropertyId<bool> &ForceRTLPropertyId() noexcept {
   return prop;
 }
 
-void I18nManager::InitI18nInfo(const winrt::Microsoft::ReactNative::ReactPropertyBag &propertyBag) noexcept {
-  DWORD dw;
-  if (GetProcessDefaultLayout(&dw)) {
-    propertyBag.Set(SystemIsRTLPropertyId(), dw == LAYOUT_RTL);
-  }
-}
-
 /*static*/ bool I18nManager::IsRTL(const React::ReactPropertyBag &propertyBag) noexcept {
   if (propertyBag.Get(ForceRTLPropertyId()).value_or(false))
     return true;
@@ -41,7 +34,18 @@ void I18nManager::InitI18nInfo(const winrt::Microsoft::ReactNative::ReactPropert
   if (!propertyBag.Get(AllowRTLPropertyId()).value_or(true))
     return false;
 
-  return propertyBag.Get(SystemIsRTLPropertyId()).value_or(false);
+  // The default layout is set for the whole process, so that it can be read from any thread
+  return propertyBag
+      .GetOrCreate(
+          SystemIsRTLPropertyId(),
+          []() noexcept -> std::optional<bool> {
+            DWORD dw;
+            if (GetProcessDefaultLayout(&dw)) {
+              return dw == LAYOUT_RTL;
+            }
+            return std::nullopt;
+          })
+      .value_or(false);
 }
 
 void I18nManager::AllowRTL(bool allowRTL) noexcept {
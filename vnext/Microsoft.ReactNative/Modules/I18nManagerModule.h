@@ -10,14 +10,12 @@
 
 namespace Microsoft::ReactNative {
 
-// Since I18nModule provides constants that require the UI thread, we need to initialize those constants before module
-// creation (module creation can happen on background thread) InitI18nInfo will store the required information in the
-// PropertyBag so that the I18nModule can return the constants synchronously.
+// The system RTL layout is read into the PropertyBag the first time that IsRTL is called, so that the I18nModule can
+// return the constants synchronously from the thread it is created on.
 REACT_MODULE(I18nManager)
 struct I18nManager {
   using ModuleSpec = ReactNativeSpecs::I18nManagerSpec;
 
-  static void InitI18nInfo(const React::ReactPropertyBag &propertyBag) noexcept;
   static bool IsRTL(const React::ReactPropertyBag &propertyBag) noexcept;
 
   REACT_INIT(Initialize)
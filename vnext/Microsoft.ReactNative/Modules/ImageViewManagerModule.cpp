@@ -2,16 +2,16 @@
 // Licensed under the MIT License.
 
 // NYI:
-//   implement image cache
-//   implement prefetch functionality
 //   implement multi source (parse out most suitable image source from array of
 //   sources)
 #include "pch.h"
 
 #include "ImageViewManagerModule.h"
 
+#include <Fabric/ImageLoadScheduler.h>
 #include <Fabric/WindowsImageManager.h>
 #include <Utils/Helpers.h>
+#include <Utils/ImageDiskCache.h>
 #include <cxxreact/JsArgumentHelpers.h>
 #include <wincodec.h>
 #include <winrt/Windows.Storage.Streams.h>
@@ -71,6 +71,57 @@ winrt::fire_and_forget GetImageSizeAsync(
   co_return;
 }
 
+// The coroutine holds on to the slot of the scheduler until the image is fetched
+winrt::fire_and_forget PrefetchScheduledImageAsync(
+    winrt::Microsoft::ReactNative::IReactPropertyBag properties,
+    ReactImageSource source,
+    React::ReactPromise<bool> result,
+    ImageLoadScheduler::LoadSlot /*slot*/) {
+  auto stream = co_await GetImageStreamAsync(properties, std::move(source));
+  if (stream) {
+    result.Resolve(true);
+  } else {
+    result.Reject("Failed to prefetch the image");
+  }
+}
+
+void PrefetchImage(
+    const winrt::Microsoft::ReactNative::IReactPropertyBag &properties,
+    std::string uri,
+    React::ReactPromise<bool> result) {
+  ReactImageSource source;
+  source.uri = std::move(uri);
+  source.sourceType = ImageSourceType::Download;
+
+  // Only images kept by the ImageDiskCache can be prefetched, there is nothing to do for other sources
+  if (ImageDiskCache::Key(source).empty()) {
+    result.Resolve(true);
+    return;
+  }
+
+  // Prefetches wait for the images shown on screen to load first
+  ImageLoadScheduler::Instance().schedule(
+      std::nullopt,
+      ImageLoadPriority::Prefetch,
+      [properties, source = std::move(source), result](ImageLoadScheduler::LoadSlot slot) {
+        PrefetchScheduledImageAsync(properties, source, result, std::move(slot));
+      });
+}
+
+winrt::fire_and_forget QueryCacheAsync(std::vector<std::string> uris, React::ReactPromise<React::JSValue> result) {
+  co_await winrt::resume_background();
+
+  React::JSValueObject cached;
+  for (auto &uri : uris) {
+    ReactImageSource source;
+    source.uri = uri;
+    if (ImageDiskCache::Instance().contains(ImageDiskCache::Key(source))) {
+      cached[std::move(uri)] = std::string{"disk"};
+    }
+  }
+  result.Resolve(std::move(cached));
+}
+
 void ImageLoader::Initialize(React::ReactContext const &reactContext) noexcept {
   m_context = reactContext;
 }
@@ -110,8 +161,7 @@ void ImageLoader::getSizeWithHeaders(
 }
 
 void ImageLoader::prefetchImage(std::string uri, React::ReactPromise<bool> &&result) noexcept {
-  // NYI
-  result.Resolve(true);
+  PrefetchImage(m_context.Properties().Handle(), std::move(uri), std::move(result));
 }
 
 void ImageLoader::prefetchImageWithMetadata(
@@ -119,15 +169,13 @@ void ImageLoader::prefetchImageWithMetadata(
     std::string queryRootName,
     double rootTag,
     React::ReactPromise<bool> &&result) noexcept {
-  // NYI
-  result.Resolve(true);
+  PrefetchImage(m_context.Properties().Handle(), std::move(uri), std::move(result));
 }
 
 void ImageLoader::queryCache(
     std::vector<std::string> const &uris,
     React::ReactPromise<React::JSValue> &&result) noexcept {
-  // NYI
-  result.Resolve(React::JSValueObject{});
+  QueryCacheAsync(uris, std::move(result));
 }
 
 } // namespace Microsoft::ReactNative
@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "SegmentFetcherModule.h"
+
+#include <jsi/jsi.h>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+struct SegmentSource {
+  SegmentFetcherModule::SegmentLoader loader;
+  std::string sourceUrlPrefix;
+};
+
+// Keeps the script alive while the runtime reads it
+class SegmentBuffer final : public facebook::jsi::Buffer {
+ public:
+  SegmentBuffer(std::shared_ptr<const facebook::react::JSBigString> script) noexcept : m_script(std::move(script)) {}
+
+  size_t size() const override {
+    return m_script->size();
+  }
+
+  const uint8_t *data() const override {
+    return reinterpret_cast<const uint8_t *>(m_script->c_str());
+  }
+
+ private:
+  const std::shared_ptr<const facebook::react::JSBigString> m_script;
+};
+
+} // namespace
+
+static const React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<SegmentSource>>>
+    &SegmentSourcePropertyId() noexcept {
+  static const React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<SegmentSource>>> prop{
+      L"ReactNative.SegmentFetcher", L"SegmentSource"};
+  return prop;
+}
+
+static winrt::Microsoft::ReactNative::JSValue SegmentError(std::string &&message) noexcept {
+  return winrt::Microsoft::ReactNative::JSValueObject{{"message", std::move(message)}};
+}
+
+void SegmentFetcherModule::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
+  m_context = reactContext;
+}
+
+void SegmentFetcherModule::SetSegmentLoader(
+    const winrt::Microsoft::ReactNative::ReactPropertyBag &propertyBag,
+    SegmentLoader &&segmentLoader,
+    std::string &&segmentSourceUrlPrefix) noexcept {
+  propertyBag.Set(
+      SegmentSourcePropertyId(),
+      std::make_shared<SegmentSource>(SegmentSource{std::move(segmentLoader), std::move(segmentSourceUrlPrefix)}));
+}
+
+void SegmentFetcherModule::FetchSegment(
+    double segmentId,
+    winrt::Microsoft::ReactNative::JSValueObject && /*options*/,
+    std::function<void(winrt::Microsoft::ReactNative::JSValue)> const &callback) noexcept {
+  auto segmentSource = m_context.Properties().Get(SegmentSourcePropertyId());
+  if (!segmentSource || !*segmentSource) {
+    callback(SegmentError("Segments can only be loaded with a bundle file"));
+    return;
+  }
+
+  // The segment is read on the calling thread, so that the JS thread only evaluates it
+  const auto id = static_cast<uint32_t>(segmentId);
+  std::shared_ptr<const facebook::react::JSBigString> script;
+  try {
+    script = (*segmentSource)->loader(id);
+    if (script) {
+      // Waits for the read, which throws when the segment file is missing
+      script->size();
+    }
+  } catch (...) {
+    script = nullptr;
+  }
+  if (!script) {
+    callback(SegmentError("Segment " + std::to_string(id) + " could not be read"));
+    return;
+  }
+  auto sourceUrl = (*segmentSource)->sourceUrlPrefix + "." + std::to_string(id) + ".bundle";
+
+  m_context.CallInvoker()->invokeAsync([evaluatedSegments = m_evaluatedSegments,
+                                        id,
+                                        script = std::move(script),
+                                        sourceUrl = std::move(sourceUrl),
+                                        callback](facebook::jsi::Runtime &runtime) {
+    // Metro only fetches each segment once, but several modules of a segment can be required at the same time
+    if (!evaluatedSegments->insert(id).second) {
+      callback(nullptr);
+      return;
+    }
+
+    try {
+      runtime.evaluateJavaScript(std::make_shared<SegmentBuffer>(script), sourceUrl);
+      callback(nullptr);
+    } catch (const facebook::jsi::JSIException &ex) {
+      evaluatedSegments->erase(id);
+      callback(SegmentError(ex.what()));
+    }
+  });
+}
+
+} // namespace Microsoft::ReactNative
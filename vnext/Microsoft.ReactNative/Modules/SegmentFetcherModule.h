@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <NativeModules.h>
+#include <cxxreact/JSBigString.h>
+#include <functional>
+#include <memory>
+#include <unordered_set>
+
+namespace Microsoft::ReactNative {
+
+// Loads the segments of split bundles, which Metro's asyncRequire asks for through global.__fetchSegment when a
+// module of a segment is first required.  The startup bundle then only holds what the first screen needs.  Each
+// segment is read or memory mapped from its own file, and evaluated with its own source URL, so that its Hermes
+// bytecode is cached independently of the other segments by the prepared script store of the runtime.
+REACT_MODULE(SegmentFetcherModule, L"SegmentFetcher")
+struct SegmentFetcherModule {
+  // Returns the script of a segment, or nullptr when it cannot be read
+  using SegmentLoader = std::function<std::unique_ptr<const facebook::react::JSBigString>(uint32_t segmentId)>;
+
+  REACT_INIT(Initialize)
+  void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
+
+  // The callback is called with null once the segment is evaluated, or with an error object
+  REACT_METHOD(FetchSegment, L"fetchSegment")
+  void FetchSegment(
+      double segmentId,
+      winrt::Microsoft::ReactNative::JSValueObject &&options,
+      std::function<void(winrt::Microsoft::ReactNative::JSValue)> const &callback) noexcept;
+
+  // Set by the instance for bundles that are loaded from files, segments are not loaded from the packager
+  static void SetSegmentLoader(
+      const winrt::Microsoft::ReactNative::ReactPropertyBag &propertyBag,
+      SegmentLoader &&segmentLoader,
+      std::string &&segmentSourceUrlPrefix) noexcept;
+
+ private:
+  winrt::Microsoft::ReactNative::ReactContext m_context;
+  // Only used on the JS thread
+  std::shared_ptr<std::unordered_set<uint32_t>> m_evaluatedSegments{std::make_shared<std::unordered_set<uint32_t>>()};
+};
+
+} // namespace Microsoft::ReactNative
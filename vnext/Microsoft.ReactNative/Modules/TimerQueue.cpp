@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "TimerQueue.h"
+
+namespace Microsoft::ReactNative {
+
+TimerQueue::TimerQueue() {}
+
+void TimerQueue::Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
+  Remove(id);
+  m_timerIndices[id] = m_timerVector.size();
+  m_timerVector.emplace_back(id, targetTime, period, repeat);
+  SiftUp(m_timerVector.size() - 1);
+}
+
+void TimerQueue::Pop() {
+  RemoveAt(0);
+}
+
+const Timer &TimerQueue::Front() const {
+  return m_timerVector.front();
+}
+
+void TimerQueue::Remove(uint32_t id) {
+  auto found = m_timerIndices.find(id);
+  if (found != m_timerIndices.end())
+    RemoveAt(found->second);
+}
+
+bool TimerQueue::IsEmpty() const {
+  return m_timerVector.empty();
+}
+
+size_t TimerQueue::Size() const {
+  return m_timerVector.size();
+}
+
+void TimerQueue::RemoveAt(size_t index) {
+  m_timerIndices.erase(m_timerVector[index].Id);
+
+  // Fill the hole with the last timer, which then moves up or down to where it belongs
+  const auto last = m_timerVector.size() - 1;
+  if (index != last) {
+    Place(index, std::move(m_timerVector[last]));
+  }
+  m_timerVector.pop_back();
+
+  if (index < m_timerVector.size()) {
+    SiftUp(index);
+    SiftDown(index);
+  }
+}
+
+void TimerQueue::SiftUp(size_t index) {
+  auto timer = std::move(m_timerVector[index]);
+  while (index > 0) {
+    const auto parent = (index - 1) / 2;
+    if (!(timer.TargetTime < m_timerVector[parent].TargetTime))
+      break;
+    Place(index, std::move(m_timerVector[parent]));
+    index = parent;
+  }
+  Place(index, std::move(timer));
+}
+
+void TimerQueue::SiftDown(size_t index) {
+  const auto size = m_timerVector.size();
+  auto timer = std::move(m_timerVector[index]);
+  while (true) {
+    auto child = index * 2 + 1;
+    if (child >= size)
+      break;
+    if (child + 1 < size && m_timerVector[child + 1].TargetTime < m_timerVector[child].TargetTime)
+      ++child;
+    if (!(m_timerVector[child].TargetTime < timer.TargetTime))
+      break;
+    Place(index, std::move(m_timerVector[child]));
+    index = child;
+  }
+  Place(index, std::move(timer));
+}
+
+void TimerQueue::Place(size_t index, Timer &&timer) {
+  m_timerIndices[timer.Id] = index;
+  m_timerVector[index] = std::move(timer);
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <winrt/Windows.Foundation.h>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+typedef winrt::Windows::Foundation::DateTime TDateTime;
+typedef winrt::Windows::Foundation::TimeSpan TTimeSpan;
+
+struct Timer {
+  Timer(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
+    Id = id;
+    TargetTime = targetTime;
+    Period = period;
+    Repeat = repeat;
+  }
+
+  uint32_t Id;
+  TDateTime TargetTime;
+  TTimeSpan Period;
+  bool Repeat;
+};
+
+// Timers ordered by their target time.  The timers are kept in a binary heap which also indexes the position of each
+// timer by its id, so that pushing, popping and removing a timer, like every clearTimeout does, are O(log n).
+class TimerQueue {
+ public:
+  TimerQueue();
+
+  // Replaces the timer with the same id, if there is one
+  void Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat);
+  void Pop();
+  const Timer &Front() const;
+  void Remove(uint32_t id);
+
+  bool IsEmpty() const;
+  size_t Size() const;
+
+ private:
+  void RemoveAt(size_t index);
+  void SiftUp(size_t index);
+  void SiftDown(size_t index);
+  void Place(size_t index, Timer &&timer);
+
+  std::vector<Timer> m_timerVector;
+  std::unordered_map<uint32_t, size_t> m_timerIndices;
+};
+
+} // namespace Microsoft::ReactNative
@@ -9,6 +9,9 @@
 #include <InstanceManager.h>
 #include <Utils/ValueUtils.h>
 #include <XamlUtils.h>
+#include <dispatchQueue/dispatchQueueMetrics.h>
+#include <winrt/Windows.System.Power.h>
+#include "HighResolutionTimer.h"
 
 #include <unknwnbase.h>
 
@@ -21,6 +24,10 @@ using namespace std;
 
 namespace Microsoft::ReactNative {
 
+constexpr TTimeSpan BackgroundTickInterval = std::chrono::seconds(1);
+// The default resolution of the system timer is 15.6 ms
+constexpr TTimeSpan SystemTimerResolution = std::chrono::milliseconds(16);
+
 //
 // IsAnimationFrameRequest
 //
@@ -33,43 +40,6 @@ winrt::Windows::Foundation::TimeSpan TimeSpanFromMs(double ms) {
   return dur;
 }
 
-//
-// TimerQueue
-//
-
-TimerQueue::TimerQueue() {
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-  m_timerVector.emplace_back(id, targetTime, period, repeat);
-  std::push_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-void TimerQueue::Pop() {
-  std::pop_heap(m_timerVector.begin(), m_timerVector.end());
-  m_timerVector.pop_back();
-}
-
-Timer &TimerQueue::Front() {
-  return m_timerVector.front();
-}
-
-void TimerQueue::Remove(uint32_t id) {
-  // TODO: This is very inefficient, but doing this with a heap is inherently
-  // hard. If performance is not good
-  //	enough for the scenarios then a different structure is probably needed.
-  auto found = std::find(m_timerVector.begin(), m_timerVector.end(), id);
-  if (found != m_timerVector.end())
-    m_timerVector.erase(found);
-
-  std::make_heap(m_timerVector.begin(), m_timerVector.end());
-}
-
-bool TimerQueue::IsEmpty() {
-  return m_timerVector.empty();
-}
-
 std::unique_ptr<TimerRegistry> TimerRegistry::CreateTimerRegistry(
     const winrt::Microsoft::ReactNative::IReactPropertyBag &properties) noexcept {
   auto registry = std::make_unique<TimerRegistry>();
@@ -101,6 +71,8 @@ void TimerRegistry::createRecurringTimer(uint32_t timerID, double delayMS) {
 void TimerRegistry::callTimers(const vector<uint32_t> &ids) noexcept {
   if (auto timerManager = m_timerManager.lock()) {
     for (auto id : ids) {
+      // The JS task that calls the timer is attributed to it in the dispatch queue metrics
+      Mso::DispatchQueueMetrics::OriginScope originScope{"Timer " + std::to_string(id)};
       timerManager->callTimer(id);
     }
   }
@@ -120,6 +92,8 @@ void Timing::Initialize(winrt::Microsoft::ReactNative::ReactContext const &react
   m_properties = reactContext.Properties().Handle();
   m_usePostForRendering = true;
   m_uiDispatcher = m_context.UIDispatcher().Handle();
+  ReadTimerOptions();
+  ObserveBackgroundMode();
 }
 
 void Timing::InitializeBridgeless(
@@ -130,6 +104,55 @@ void Timing::InitializeBridgeless(
   m_usePostForRendering = true;
   m_uiDispatcher = {properties.Get(winrt::Microsoft::ReactNative::ReactDispatcherHelper::UIDispatcherProperty())
                         .try_as<winrt::Microsoft::ReactNative::IReactDispatcher>()};
+  ReadTimerOptions();
+  ObserveBackgroundMode();
+}
+
+Timing::~Timing() noexcept {
+  if (m_backgroundMode) {
+    m_backgroundMode->RemoveListener(m_backgroundListenerToken);
+  }
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t> Timing::TimerCoalescingWindowMsProperty() noexcept {
+  return {L"ReactNative.Timing", L"TimerCoalescingWindowMs"};
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> Timing::UseHighResolutionTimersProperty() noexcept {
+  return {L"ReactNative.Timing", L"UseHighResolutionTimers"};
+}
+
+void Timing::ReadTimerOptions() noexcept {
+  winrt::Microsoft::ReactNative::ReactPropertyBag properties{m_properties};
+  m_coalescingWindow = std::chrono::milliseconds(properties.Get(TimerCoalescingWindowMsProperty()).value_or(0));
+  m_useHighResolutionTimers = properties.Get(UseHighResolutionTimersProperty()).value_or(false);
+}
+
+void Timing::ObserveBackgroundMode() noexcept {
+  m_backgroundMode = Mso::React::BackgroundMode::FromProperties(m_properties);
+  m_isInBackground = m_backgroundMode->IsInBackground();
+  m_backgroundListenerToken =
+      m_backgroundMode->AddListener([wkThis = std::weak_ptr(this->shared_from_this())](bool isInBackground) {
+        if (auto pThis = wkThis.lock()) {
+          pThis->OnBackgroundModeChanged(isInBackground);
+        }
+      });
+}
+
+void Timing::OnBackgroundModeChanged(bool isInBackground) noexcept {
+  m_isInBackground = isInBackground;
+  if (m_idleFrameTimer && m_idleWaitStartingRevoker.IsSubscribed()) {
+    if (isInBackground) {
+      m_idleFrameTimer.Stop();
+    } else {
+      m_idleFrameTimer.Start();
+    }
+  }
+
+  // The next tick is scheduled again for the new mode
+  if (!m_timerQueue.IsEmpty() && !m_usingRendering) {
+    StartDispatcherTimer();
+  }
 }
 
 void Timing::DetachBridgeless() {
@@ -139,9 +162,12 @@ void Timing::DetachBridgeless() {
 void Timing::OnTick() {
   vector<uint32_t> readyTimers;
   auto now = TDateTime::clock::now();
+  m_lastTickTime = now;
+  // Timers due shortly after the ones that woke us up go out with them, rather than needing a wake up of their own
+  auto fireBefore = now + m_coalescingWindow;
 
   auto emittedAnimationFrame = false;
-  while (!m_timerQueue.IsEmpty() && m_timerQueue.Front().TargetTime < now) {
+  while (!m_timerQueue.IsEmpty() && m_timerQueue.Front().TargetTime < fireBefore) {
     // Pop first timer from the queue and add it to list of timers ready to fire
     Timer next = m_timerQueue.Front();
     m_timerQueue.Pop();
@@ -168,10 +194,13 @@ void Timing::OnTick() {
 
   if (!readyTimers.empty()) {
     if (m_context) {
+      std::string origin{"Timer"};
       winrt::Microsoft::ReactNative::JSValueArray readyTimersJsArray;
       for (auto id : readyTimers) {
+        origin += ' ' + std::to_string(id);
         readyTimersJsArray.push_back({id});
       }
+      Mso::DispatchQueueMetrics::OriginScope originScope{std::move(origin)};
       m_context.CallJSFunction(
           L"JSTimers", L"callTimers", winrt::Microsoft::ReactNative::JSValueArray{std::move(readyTimersJsArray)});
     } else if (m_timerRegistry) {
@@ -193,6 +222,43 @@ winrt::Microsoft::ReactNative::ITimer Timing::EnsureDispatcherTimer() {
   return m_dispatcherQueueTimer;
 }
 
+winrt::Microsoft::ReactNative::ITimer Timing::EnsureHighResolutionTimer() {
+  if (!m_highResolutionTimer) {
+    if (auto uiDispatcher = m_uiDispatcher.get()) {
+      m_highResolutionTimer = HighResolutionTimer::TryCreate(uiDispatcher);
+    }
+    if (!m_highResolutionTimer) {
+      m_useHighResolutionTimers = false;
+      return nullptr;
+    }
+    m_highResolutionTimer.Tick([wkThis = std::weak_ptr(this->shared_from_this())](auto &&...) {
+      if (auto pThis = wkThis.lock()) {
+        pThis->OnTick();
+      }
+    });
+  }
+
+  return m_highResolutionTimer;
+}
+
+bool Timing::ShouldUseHighResolutionTimer(TTimeSpan interval) noexcept {
+  // Longer waits are precise enough with the system timer, and the extra wake ups of the high resolution timer cost
+  // battery, which the user asks to save with the energy saver
+  if (!m_useHighResolutionTimers || m_isInBackground || interval <= TTimeSpan::zero() ||
+      interval >= SystemTimerResolution) {
+    return false;
+  }
+  return winrt::Windows::System::Power::PowerManager::EnergySaverStatus() !=
+      winrt::Windows::System::Power::EnergySaverStatus::On;
+}
+
+void Timing::StopTimers() noexcept {
+  if (m_dispatcherQueueTimer)
+    m_dispatcherQueueTimer.Stop();
+  if (m_highResolutionTimer)
+    m_highResolutionTimer.Stop();
+}
+
 void Timing::PostRenderFrame() noexcept {
   assert(m_usePostForRendering);
   m_usingRendering = true;
@@ -207,8 +273,13 @@ void Timing::PostRenderFrame() noexcept {
 }
 
 void Timing::StartRendering() {
-  if (m_dispatcherQueueTimer)
-    m_dispatcherQueueTimer.Stop();
+  // Animation frames are throttled like the other timers while nothing is shown
+  if (m_isInBackground) {
+    StartDispatcherTimer();
+    return;
+  }
+
+  StopTimers();
 
   if (m_usePostForRendering) {
     PostRenderFrame();
@@ -234,16 +305,32 @@ void Timing::StartDispatcherTimer() {
   const auto &nextTimer = m_timerQueue.Front();
   m_rendering.revoke();
   m_usingRendering = false;
-  auto timer = EnsureDispatcherTimer();
-  timer.Interval(std::max(nextTimer.TargetTime - TDateTime::clock::now(), TTimeSpan::zero()));
+  auto nextTickTime = nextTimer.TargetTime;
+  if (m_isInBackground) {
+    nextTickTime = std::max(nextTickTime, m_lastTickTime + BackgroundTickInterval);
+  }
+  auto interval = std::max(nextTickTime - TDateTime::clock::now(), TTimeSpan::zero());
+
+  winrt::Microsoft::ReactNative::ITimer timer{nullptr};
+  if (ShouldUseHighResolutionTimer(interval)) {
+    timer = EnsureHighResolutionTimer();
+  }
+  if (timer) {
+    if (m_dispatcherQueueTimer)
+      m_dispatcherQueueTimer.Stop();
+  } else {
+    if (m_highResolutionTimer)
+      m_highResolutionTimer.Stop();
+    timer = EnsureDispatcherTimer();
+  }
+  timer.Interval(interval);
   timer.Start();
 }
 
 void Timing::StopTicks() {
   m_rendering.revoke();
   m_usingRendering = false;
-  if (m_dispatcherQueueTimer)
-    m_dispatcherQueueTimer.Stop();
+  StopTimers();
 }
 
 void Timing::createTimerOnQueue(uint32_t id, double duration, double jsSchedulingTime, bool repeat) noexcept {
@@ -316,8 +403,90 @@ void Timing::deleteTimer(uint32_t id) noexcept {
   }
 }
 
-void Timing::setSendIdleEvents(bool /*sendIdleEvents*/) noexcept {
-  // TODO: Implement.
+void Timing::setSendIdleEvents(bool sendIdleEvents) noexcept {
+  // Idle callbacks are only called through JSTimers, which bridgeless mode schedules itself
+  if (!m_context) {
+    return;
+  }
+
+  winrt::Microsoft::ReactNative::implementation::ReactCoreInjection::PostToUIBatchingQueue(
+      m_context.Handle(), [wkThis = std::weak_ptr(this->shared_from_this()), sendIdleEvents]() {
+        if (auto pThis = wkThis.lock()) {
+          pThis->setSendIdleEventsOnQueue(sendIdleEvents);
+        }
+      });
+}
+
+void Timing::setSendIdleEventsOnQueue(bool sendIdleEvents) noexcept {
+  if (!sendIdleEvents) {
+    m_idleWaitStartingRevoker = nullptr;
+    m_idleWaitCompletedRevoker = nullptr;
+    if (m_idleFrameTimer)
+      m_idleFrameTimer.Stop();
+    return;
+  }
+
+  if (!m_idleWaitStartingRevoker.IsSubscribed()) {
+    // The JS queue is running the call that turned idle events on, and reports when it is done
+    m_jsIdle = false;
+    m_idleWaitStartingRevoker = m_context.Notifications().Subscribe(
+        winrt::auto_revoke,
+        winrt::Microsoft::ReactNative::ReactNotificationId<void>{
+            winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherIdleWaitStartingEventName()},
+        [wkThis = std::weak_ptr(this->shared_from_this())](
+            winrt::Windows::Foundation::IInspectable const &,
+            winrt::Microsoft::ReactNative::ReactNotificationArgs<void> const &) noexcept {
+          if (auto pThis = wkThis.lock()) {
+            pThis->m_jsIdle = true;
+          }
+        });
+    m_idleWaitCompletedRevoker = m_context.Notifications().Subscribe(
+        winrt::auto_revoke,
+        winrt::Microsoft::ReactNative::ReactNotificationId<void>{
+            winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherIdleWaitCompletedEventName()},
+        [wkThis = std::weak_ptr(this->shared_from_this())](
+            winrt::Windows::Foundation::IInspectable const &,
+            winrt::Microsoft::ReactNative::ReactNotificationArgs<void> const &) noexcept {
+          if (auto pThis = wkThis.lock()) {
+            pThis->m_jsIdle = false;
+          }
+        });
+  }
+
+  if (!m_idleFrameTimer) {
+    m_idleFrameTimer = winrt::Microsoft::ReactNative::Timer::Create(m_properties);
+    m_idleFrameTimer.Interval(std::chrono::milliseconds(16));
+    m_idleFrameTimer.Tick([wkThis = std::weak_ptr(this->shared_from_this())](auto &&...) {
+      if (auto pThis = wkThis.lock()) {
+        pThis->OnIdleFrame();
+      }
+    });
+  }
+  if (!m_isInBackground) {
+    m_idleFrameTimer.Start();
+  }
+}
+
+void Timing::OnIdleFrame() noexcept {
+  // At most once a frame, and only when the JS queue has nothing else to do.  The idle callbacks get the rest of the
+  // frame, unless a timer is due before that.
+  constexpr double frameDurationMs = 1000.0 / 60.0;
+  auto deadlineMs = frameDurationMs;
+  if (!m_timerQueue.IsEmpty()) {
+    deadlineMs = std::min(
+        deadlineMs,
+        std::chrono::duration<double, std::milli>(m_timerQueue.Front().TargetTime - TDateTime::clock::now()).count());
+  }
+
+  // JSTimers skips idle callbacks with less than a millisecond left
+  if (deadlineMs < 1 || !m_jsIdle.exchange(false)) {
+    return;
+  }
+
+  // JSTimers gives the callbacks what is left of the frame that started at frameTime
+  const auto frameTime = SchedulingTimeNow() - (frameDurationMs - deadlineMs);
+  m_context.CallJSFunction(
+      L"JSTimers", L"callIdleCallbacks", winrt::Microsoft::ReactNative::JSValueArray{frameTime});
 }
 
 } // namespace Microsoft::ReactNative
@@ -7,54 +7,17 @@
 
 #include <CppWinRTIncludes.h>
 #include <ReactCoreInjection.h>
+#include <ReactHost/BackgroundMode.h>
 #include <react/runtime/PlatformTimerRegistry.h>
 #include <react/runtime/TimerManager.h>
+#include <atomic>
+#include "TimerQueue.h"
 
 namespace Microsoft::ReactNative {
 
-typedef winrt::Windows::Foundation::DateTime TDateTime;
-typedef winrt::Windows::Foundation::TimeSpan TTimeSpan;
-
 class TimingModule;
 struct Timing;
 
-struct Timer {
-  Timer(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat) {
-    Id = id;
-    TargetTime = targetTime;
-    Period = period;
-    Repeat = repeat;
-  }
-
-  bool operator<(const Timer &timer) const {
-    return timer.TargetTime < TargetTime;
-  }
-
-  bool operator==(uint32_t id) const {
-    return id == Id;
-  }
-
-  uint32_t Id;
-  TDateTime TargetTime;
-  TTimeSpan Period;
-  bool Repeat;
-};
-
-class TimerQueue {
- public:
-  TimerQueue();
-
-  void Push(uint32_t id, TDateTime targetTime, TTimeSpan period, bool repeat);
-  void Pop();
-  Timer &Front();
-  void Remove(uint32_t id);
-
-  bool IsEmpty();
-
- private:
-  std::vector<Timer> m_timerVector;
-};
-
 struct TimerRegistry : public facebook::react::PlatformTimerRegistry {
   static std::unique_ptr<TimerRegistry> CreateTimerRegistry(
       const winrt::Microsoft::ReactNative::IReactPropertyBag &properties) noexcept;
@@ -81,6 +44,8 @@ struct Timing : public std::enable_shared_from_this<Timing> {
   // using ModuleSpec = ReactNativeSpecs::TimingSpec;
 
  public:
+  ~Timing() noexcept;
+
   REACT_INIT(Initialize)
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
 
@@ -97,25 +62,61 @@ struct Timing : public std::enable_shared_from_this<Timing> {
   REACT_METHOD(setSendIdleEvents)
   void setSendIdleEvents(bool sendIdleEvents) noexcept;
 
+  // When set on the instance properties, timers that are due within this many milliseconds of the timer that wakes the
+  // queue are sent to JS in the same JSTimers.callTimers call, instead of each waking the UI thread and calling into JS
+  // on its own.  Those timers fire up to that much earlier than they are due.
+  static winrt::Microsoft::ReactNative::ReactPropertyId<uint32_t> TimerCoalescingWindowMsProperty() noexcept;
+
+  // When set to true on the instance properties, the waits shorter than the resolution of the system timer, about
+  // 15.6 ms, use a high resolution timer, so that setTimeout(fn, 1) or setInterval(fn, 4) fire when they are due rather
+  // than on the next system timer tick.  The system timer is still used in the background, and while the energy saver
+  // is on.
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> UseHighResolutionTimersProperty() noexcept;
+
  private:
   void createTimerOnQueue(uint32_t id, double duration, double jsSchedulingTime, bool repeat) noexcept;
   void deleteTimerOnQueue(uint32_t id) noexcept;
   void OnTick();
   winrt::Microsoft::ReactNative::ITimer EnsureDispatcherTimer();
+  winrt::Microsoft::ReactNative::ITimer EnsureHighResolutionTimer();
+  bool ShouldUseHighResolutionTimer(TTimeSpan interval) noexcept;
+  void StopTimers() noexcept;
   void StartRendering();
   void PostRenderFrame() noexcept;
   void StartDispatcherTimer();
   void StopTicks();
+  void setSendIdleEventsOnQueue(bool sendIdleEvents) noexcept;
+  void OnIdleFrame() noexcept;
+  void ReadTimerOptions() noexcept;
+  void ObserveBackgroundMode() noexcept;
+  void OnBackgroundModeChanged(bool isInBackground) noexcept;
 
   winrt::Microsoft::ReactNative::ReactContext m_context; // !bridgeless
   TimerRegistry *m_timerRegistry{nullptr}; // bridgeless
   winrt::Microsoft::ReactNative::IReactPropertyBag m_properties{nullptr};
   TimerQueue m_timerQueue;
+  TTimeSpan m_coalescingWindow{0};
   xaml::Media::CompositionTarget::Rendering_revoker m_rendering;
   winrt::Microsoft::ReactNative::ITimer m_dispatcherQueueTimer{nullptr};
+  // For the waits shorter than the system timer resolution, with UseHighResolutionTimersProperty
+  winrt::Microsoft::ReactNative::ITimer m_highResolutionTimer{nullptr};
+  bool m_useHighResolutionTimers{false};
   winrt::weak_ref<winrt::Microsoft::ReactNative::IReactDispatcher> m_uiDispatcher;
   bool m_usingRendering{false};
   bool m_usePostForRendering{false};
+
+  // requestIdleCallback, while JS has idle callbacks waiting
+  winrt::Microsoft::ReactNative::ITimer m_idleFrameTimer{nullptr};
+  winrt::Microsoft::ReactNative::ReactNotificationSubscriptionRevoker m_idleWaitStartingRevoker;
+  winrt::Microsoft::ReactNative::ReactNotificationSubscriptionRevoker m_idleWaitCompletedRevoker;
+  // Whether the JS queue waits for work, set on the JS thread
+  std::atomic<bool> m_jsIdle{false};
+
+  // In the background the queue wakes at most once per BackgroundTickInterval, and idle callbacks are not sent
+  std::shared_ptr<Mso::React::BackgroundMode> m_backgroundMode;
+  uint32_t m_backgroundListenerToken{0};
+  bool m_isInBackground{false};
+  TDateTime m_lastTickTime;
 };
 
 } // namespace Microsoft::ReactNative
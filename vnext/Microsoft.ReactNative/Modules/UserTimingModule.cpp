@@ -0,0 +1,23 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "UserTimingModule.h"
+
+#include <tracing/tracing.h>
+
+namespace Microsoft::ReactNative {
+
+static int64_t ToMicroseconds(double milliseconds) noexcept {
+  return static_cast<int64_t>(milliseconds * 1000);
+}
+
+void UserTimingModule::Mark(std::string name, double startTime, std::string track) noexcept {
+  facebook::react::tracing::logReactPerfMark(name, ToMicroseconds(startTime), track);
+}
+
+void UserTimingModule::Measure(std::string name, double startTime, double endTime, std::string track) noexcept {
+  facebook::react::tracing::logReactPerfMeasure(name, ToMicroseconds(startTime), ToMicroseconds(endTime), track);
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <NativeModules.h>
+#include <string>
+
+namespace Microsoft::ReactNative {
+
+// Bridges the marks and measures of the User Timing API to ETW, so that JS hot paths can be lined up with the native
+// work in one trace.  They are logged as the ReactPerfMark and ReactPerfMeasure events of the
+// Microsoft.ReactNativeWindows provider, like the tracks of React, and kept in the ring buffer that
+// ReactNativeHost.WriteUserTimingReport writes.  The times are those of performance.now(), in milliseconds of the
+// steady clock, which is QueryPerformanceCounter like the times of the native events.  The track is empty when the
+// entry has none.
+REACT_MODULE(UserTimingModule, L"UserTiming")
+struct UserTimingModule {
+  REACT_METHOD(Mark, L"mark")
+  void Mark(std::string name, double startTime, std::string track) noexcept;
+
+  REACT_METHOD(Measure, L"measure")
+  void Measure(std::string name, double startTime, double endTime, std::string track) noexcept;
+};
+
+} // namespace Microsoft::ReactNative
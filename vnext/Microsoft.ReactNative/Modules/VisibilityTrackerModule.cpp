@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "VisibilityTrackerModule.h"
+
+namespace Microsoft::ReactNative {
+
+void VisibilityTrackerModule::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
+  m_context = reactContext;
+
+  // The entries of the updates that JS has not received yet are delivered together
+  auto eventBatcher =
+      std::make_shared<winrt::Microsoft::ReactNative::ReactEventBatcher>(reactContext, L"RCTDeviceEventEmitter");
+  m_tracker = std::make_shared<VisibilityTracker>(
+      reactContext, [eventBatcher](std::vector<VisibilityTracker::Entry> &&entries) noexcept {
+        for (auto const &entry : entries) {
+          eventBatcher->Emit(
+              L"visibilityChanged",
+              VisibilityChangedEntry{
+                  static_cast<double>(entry.tag),
+                  entry.intersectionRatio,
+                  entry.isIntersecting,
+                  static_cast<double>(entry.thresholdIndex)});
+        }
+      });
+}
+
+void VisibilityTrackerModule::Observe(double tag, std::vector<double> thresholds) noexcept {
+  std::vector<float> floatThresholds(thresholds.begin(), thresholds.end());
+  m_context.UIDispatcher().Post([tracker = m_tracker, tag, thresholds = std::move(floatThresholds)]() mutable {
+    tracker->observe(static_cast<facebook::react::Tag>(tag), std::move(thresholds));
+  });
+}
+
+void VisibilityTrackerModule::Unobserve(double tag) noexcept {
+  m_context.UIDispatcher().Post(
+      [tracker = m_tracker, tag]() { tracker->unobserve(static_cast<facebook::react::Tag>(tag)); });
+}
+
+void VisibilityTrackerModule::AddListener(std::string /*eventName*/) noexcept {
+  // noop
+}
+
+void VisibilityTrackerModule::RemoveListeners(double /*count*/) noexcept {
+  // noop
+}
+
+} // namespace Microsoft::ReactNative
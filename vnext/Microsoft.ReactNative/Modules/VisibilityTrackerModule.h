@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Fabric/Composition/VisibilityTracker.h>
+#include <NativeModules.h>
+#include <ReactEventBatcher.h>
+
+namespace Microsoft::ReactNative {
+
+REACT_STRUCT(VisibilityChangedEntry)
+struct VisibilityChangedEntry {
+  REACT_FIELD(tag)
+  double tag;
+  REACT_FIELD(intersectionRatio)
+  double intersectionRatio;
+  REACT_FIELD(isIntersecting)
+  bool isIntersecting;
+  REACT_FIELD(thresholdIndex)
+  double thresholdIndex;
+};
+
+// Reports to JS when observed views cross the visibility thresholds that JS registered for them, see VisibilityTracker.
+// Each "visibilityChanged" event of RCTDeviceEventEmitter has the array of the entries that changed since the last one.
+REACT_MODULE(VisibilityTrackerModule, L"VisibilityTracker")
+struct VisibilityTrackerModule {
+  REACT_INIT(Initialize)
+  void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
+
+  REACT_METHOD(Observe, L"observe")
+  void Observe(double tag, std::vector<double> thresholds) noexcept;
+
+  REACT_METHOD(Unobserve, L"unobserve")
+  void Unobserve(double tag) noexcept;
+
+  REACT_METHOD(AddListener, L"addListener")
+  void AddListener(std::string eventName) noexcept;
+
+  REACT_METHOD(RemoveListeners, L"removeListeners")
+  void RemoveListeners(double count) noexcept;
+
+ private:
+  winrt::Microsoft::ReactNative::ReactContext m_context;
+  // Only used on the UI thread
+  std::shared_ptr<VisibilityTracker> m_tracker;
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,325 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "NativeModuleProfiler.h"
+#include <tracing/tracing.h>
+#include <algorithm>
+#include "CallInvokerWriter.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+//===========================================================================
+// NativeModuleProfiler implementation
+//===========================================================================
+
+MethodDelegate NativeModuleProfiler::ProfileMethod(
+    const std::string &moduleName,
+    const std::string &methodName,
+    MethodDelegate method) {
+  auto &stats = GetMethodStats(moduleName, methodName);
+  return [profiler = shared_from_this(), &stats, method = std::move(method)](
+             IJSValueReader const &argReader,
+             IJSValueWriter const &argWriter,
+             MethodResultCallback const &resolve,
+             MethodResultCallback const &reject) {
+    const auto startTime = Clock::now();
+    auto timedReader = winrt::make_self<TimedJSValueReader>(argReader, startTime);
+    // The result of the methods that have one is written to a CallInvokerWriter, now or once they call back
+    auto resultWriter = argWriter ? argWriter.try_as<CallInvokerWriter>() : nullptr;
+    if (resultWriter) {
+      resultWriter->OnResultMarshaled([profiler, &stats](Clock::duration marshalingTime) noexcept {
+        profiler->RecordResult(stats, marshalingTime);
+      });
+    }
+
+    method(*timedReader, argWriter, resolve, reject);
+
+    const auto endTime = Clock::now();
+    const auto firstWriteTime = resultWriter ? resultWriter->FirstWriteTime() : std::nullopt;
+    profiler->RecordCall(stats, startTime, timedReader->LastReadTime(), firstWriteTime.value_or(endTime));
+  };
+}
+
+SyncMethodDelegate NativeModuleProfiler::ProfileSyncMethod(
+    const std::string &moduleName,
+    const std::string &methodName,
+    SyncMethodDelegate method) {
+  auto &stats = GetMethodStats(moduleName, methodName);
+  return [profiler = shared_from_this(), &stats, method = std::move(method)](
+             IJSValueReader const &argReader, IJSValueWriter const &argWriter) {
+    const auto startTime = Clock::now();
+    // Like the reader and the writer that they forward to, they only live for the duration of the call
+    TimedJSValueReader timedReader{argReader, startTime};
+    TimedJSValueWriter timedWriter{argWriter};
+
+    method(timedReader, timedWriter);
+
+    const auto endTime = Clock::now();
+    const auto firstWriteTime = timedWriter.FirstWriteTime();
+    profiler->RecordCall(stats, startTime, timedReader.LastReadTime(), firstWriteTime.value_or(endTime));
+    if (firstWriteTime) {
+      profiler->RecordResult(stats, endTime - *firstWriteTime);
+    }
+  };
+}
+
+JsiSyncMethodDelegate NativeModuleProfiler::ProfileJsiSyncMethod(
+    const std::string &moduleName,
+    const std::string &methodName,
+    JsiSyncMethodDelegate method) {
+  auto &stats = GetMethodStats(moduleName, methodName);
+  return [profiler = shared_from_this(), &stats, method = std::move(method)](
+             facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
+    const auto startTime = Clock::now();
+    auto result = method(rt, args, count);
+    profiler->RecordCall(stats, startTime, startTime, Clock::now());
+    return result;
+  };
+}
+
+std::vector<NativeModuleProfiler::MethodStats> NativeModuleProfiler::GetSnapshot() const noexcept {
+  std::vector<MethodStats> snapshot;
+  {
+    std::scoped_lock lock{m_mutex};
+    for (const auto &[key, stats] : m_methodStats) {
+      if (stats.CallCount > 0) {
+        snapshot.push_back(stats);
+      }
+    }
+  }
+
+  auto totalTime = [](const MethodStats &stats) noexcept {
+    return stats.ArgMarshalingTime + stats.ExecutionTime + stats.ResultMarshalingTime;
+  };
+  std::sort(snapshot.begin(), snapshot.end(), [&totalTime](const MethodStats &left, const MethodStats &right) {
+    return totalTime(left) > totalTime(right);
+  });
+  return snapshot;
+}
+
+NativeModuleProfiler::MethodStats &NativeModuleProfiler::GetMethodStats(
+    const std::string &moduleName,
+    const std::string &methodName) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto [it, inserted] = m_methodStats.try_emplace({moduleName, methodName});
+  if (inserted) {
+    it->second.ModuleName = moduleName;
+    it->second.MethodName = methodName;
+  }
+  return it->second;
+}
+
+void NativeModuleProfiler::RecordCall(
+    MethodStats &stats,
+    Clock::time_point startTime,
+    Clock::time_point argsReadTime,
+    Clock::time_point executedTime) noexcept {
+  const uint32_t threadId = ::GetCurrentThreadId();
+  const auto argMarshalingTime = argsReadTime - startTime;
+  const auto executionTime = executedTime - argsReadTime;
+  {
+    std::scoped_lock lock{m_mutex};
+    stats.CallCount++;
+    stats.ArgMarshalingTime += argMarshalingTime;
+    stats.ExecutionTime += executionTime;
+    stats.MaxCallTime = std::max(stats.MaxCallTime, executedTime - startTime);
+    auto it = std::find_if(stats.ThreadCallCounts.begin(), stats.ThreadCallCounts.end(), [threadId](const auto &entry) {
+      return entry.first == threadId;
+    });
+    if (it != stats.ThreadCallCounts.end()) {
+      it->second++;
+    } else {
+      stats.ThreadCallCounts.emplace_back(threadId, 1);
+    }
+  }
+
+  // The names never change once the stats are created
+  facebook::react::tracing::logNativeModuleCall(
+      stats.ModuleName,
+      stats.MethodName,
+      threadId,
+      Milliseconds(argMarshalingTime).count(),
+      Milliseconds(executionTime).count());
+}
+
+void NativeModuleProfiler::RecordResult(MethodStats &stats, Clock::duration marshalingTime) noexcept {
+  {
+    std::scoped_lock lock{m_mutex};
+    stats.ResultCount++;
+    stats.ResultMarshalingTime += marshalingTime;
+  }
+
+  facebook::react::tracing::logNativeModuleResult(
+      stats.ModuleName, stats.MethodName, ::GetCurrentThreadId(), Milliseconds(marshalingTime).count());
+}
+
+//===========================================================================
+// TimedJSValueReader implementation
+//===========================================================================
+
+TimedJSValueReader::TimedJSValueReader(
+    IJSValueReader const &reader,
+    NativeModuleProfiler::Clock::time_point startTime) noexcept
+    : m_reader(reader), m_reader2(reader.try_as<IJSValueReader2>()), m_lastReadTime(startTime) {}
+
+NativeModuleProfiler::Clock::time_point TimedJSValueReader::LastReadTime() const noexcept {
+  return m_lastReadTime;
+}
+
+JSValueType TimedJSValueReader::ValueType() noexcept {
+  auto result = m_reader.ValueType();
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+bool TimedJSValueReader::GetNextObjectProperty(hstring &propertyName) noexcept {
+  auto result = m_reader.GetNextObjectProperty(propertyName);
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+bool TimedJSValueReader::GetNextArrayItem() noexcept {
+  auto result = m_reader.GetNextArrayItem();
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+hstring TimedJSValueReader::GetString() noexcept {
+  auto result = m_reader.GetString();
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+bool TimedJSValueReader::GetBoolean() noexcept {
+  auto result = m_reader.GetBoolean();
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+int64_t TimedJSValueReader::GetInt64() noexcept {
+  auto result = m_reader.GetInt64();
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+double TimedJSValueReader::GetDouble() noexcept {
+  auto result = m_reader.GetDouble();
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+bool TimedJSValueReader::TryGetDoubleArray(com_array<double> &values) noexcept {
+  auto result = m_reader2 && m_reader2.TryGetDoubleArray(values);
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+bool TimedJSValueReader::TryGetInt64Array(com_array<int64_t> &values) noexcept {
+  auto result = m_reader2 && m_reader2.TryGetInt64Array(values);
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+com_array<uint8_t> TimedJSValueReader::GetUtf8String() noexcept {
+  auto result = m_reader2 ? m_reader2.GetUtf8String() : com_array<uint8_t>{};
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+Windows::Storage::Streams::IBuffer TimedJSValueReader::TryGetArrayBuffer(bool isBorrowed) noexcept {
+  auto result = m_reader2 ? m_reader2.TryGetArrayBuffer(isBorrowed) : nullptr;
+  m_lastReadTime = NativeModuleProfiler::Clock::now();
+  return result;
+}
+
+//===========================================================================
+// TimedJSValueWriter implementation
+//===========================================================================
+
+TimedJSValueWriter::TimedJSValueWriter(IJSValueWriter const &writer) noexcept
+    : m_writer(writer), m_writer2(writer.try_as<IJSValueWriter2>()) {}
+
+std::optional<NativeModuleProfiler::Clock::time_point> TimedJSValueWriter::FirstWriteTime() const noexcept {
+  return m_firstWriteTime;
+}
+
+void TimedJSValueWriter::OnWrite() noexcept {
+  if (!m_firstWriteTime) {
+    m_firstWriteTime = NativeModuleProfiler::Clock::now();
+  }
+}
+
+void TimedJSValueWriter::WriteNull() noexcept {
+  OnWrite();
+  m_writer.WriteNull();
+}
+
+void TimedJSValueWriter::WriteBoolean(bool value) noexcept {
+  OnWrite();
+  m_writer.WriteBoolean(value);
+}
+
+void TimedJSValueWriter::WriteInt64(int64_t value) noexcept {
+  OnWrite();
+  m_writer.WriteInt64(value);
+}
+
+void TimedJSValueWriter::WriteDouble(double value) noexcept {
+  OnWrite();
+  m_writer.WriteDouble(value);
+}
+
+void TimedJSValueWriter::WriteString(const winrt::hstring &value) noexcept {
+  OnWrite();
+  m_writer.WriteString(value);
+}
+
+void TimedJSValueWriter::WriteObjectBegin() noexcept {
+  OnWrite();
+  m_writer.WriteObjectBegin();
+}
+
+void TimedJSValueWriter::WritePropertyName(const winrt::hstring &name) noexcept {
+  OnWrite();
+  m_writer.WritePropertyName(name);
+}
+
+void TimedJSValueWriter::WriteObjectEnd() noexcept {
+  OnWrite();
+  m_writer.WriteObjectEnd();
+}
+
+void TimedJSValueWriter::WriteArrayBegin() noexcept {
+  OnWrite();
+  m_writer.WriteArrayBegin();
+}
+
+void TimedJSValueWriter::WriteArrayEnd() noexcept {
+  OnWrite();
+  m_writer.WriteArrayEnd();
+}
+
+void TimedJSValueWriter::WriteDoubleArray(array_view<double const> values) noexcept {
+  OnWrite();
+  m_writer2.WriteDoubleArray(values);
+}
+
+void TimedJSValueWriter::WriteInt64Array(array_view<int64_t const> values) noexcept {
+  OnWrite();
+  m_writer2.WriteInt64Array(values);
+}
+
+void TimedJSValueWriter::WriteUtf8String(array_view<uint8_t const> value) noexcept {
+  OnWrite();
+  m_writer2.WriteUtf8String(value);
+}
+
+void TimedJSValueWriter::WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept {
+  OnWrite();
+  m_writer2.WriteArrayBuffer(buffer);
+}
+
+} // namespace winrt::Microsoft::ReactNative
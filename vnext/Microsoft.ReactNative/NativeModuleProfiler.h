@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <JSI/JsiSyncMethod.h>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "winrt/Microsoft.ReactNative.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+// Records how often the methods of the TurboModules are called, and where the time of their calls goes: reading the
+// arguments from their JS values, running the method, and writing its result back to JS values. Each call is also
+// logged to ETW. It is only created when the NativeModuleProfilerEnabled property in the ReactNative.Diagnostics
+// namespace of the instance settings properties is true, since it wraps the methods and reads the clock around every
+// call.
+class NativeModuleProfiler final : public std::enable_shared_from_this<NativeModuleProfiler> {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct MethodStats {
+    std::string ModuleName;
+    std::string MethodName;
+    uint64_t CallCount{0};
+    // The calls that wrote a result, returned or passed to a callback or a promise
+    uint64_t ResultCount{0};
+    Clock::duration ArgMarshalingTime{};
+    Clock::duration ExecutionTime{};
+    Clock::duration ResultMarshalingTime{};
+    Clock::duration MaxCallTime{};
+    // The number of calls that ran on each thread, by thread id
+    std::vector<std::pair<uint32_t, uint64_t>> ThreadCallCounts;
+  };
+
+  // The methods time their calls, as long as they are alive
+  MethodDelegate ProfileMethod(const std::string &moduleName, const std::string &methodName, MethodDelegate method);
+  SyncMethodDelegate
+  ProfileSyncMethod(const std::string &moduleName, const std::string &methodName, SyncMethodDelegate method);
+  // The method reads its arguments and writes its result itself, so all of its time is execution time
+  JsiSyncMethodDelegate
+  ProfileJsiSyncMethod(const std::string &moduleName, const std::string &methodName, JsiSyncMethodDelegate method);
+
+  // The methods that were called, the longest total time first
+  std::vector<MethodStats> GetSnapshot() const noexcept;
+
+ private:
+  MethodStats &GetMethodStats(const std::string &moduleName, const std::string &methodName) noexcept;
+  // The arguments are read from startTime to argsReadTime, and the method runs from then to executedTime
+  void RecordCall(
+      MethodStats &stats,
+      Clock::time_point startTime,
+      Clock::time_point argsReadTime,
+      Clock::time_point executedTime) noexcept;
+  void RecordResult(MethodStats &stats, Clock::duration marshalingTime) noexcept;
+
+  mutable std::mutex m_mutex;
+  // The stats are kept by reference in the profiled methods, so they are never removed
+  std::map<std::pair<std::string, std::string>, MethodStats> m_methodStats;
+};
+
+// Forwards the reads of the arguments of a profiled call, and keeps the time of the last one, which is when the
+// arguments are read, since the method wrappers of NativeModules.h read all of them before calling the method
+struct TimedJSValueReader : implements<TimedJSValueReader, IJSValueReader, IJSValueReader2> {
+  TimedJSValueReader(IJSValueReader const &reader, NativeModuleProfiler::Clock::time_point startTime) noexcept;
+
+  NativeModuleProfiler::Clock::time_point LastReadTime() const noexcept;
+
+ public: // IJSValueReader
+  JSValueType ValueType() noexcept;
+  bool GetNextObjectProperty(hstring &propertyName) noexcept;
+  bool GetNextArrayItem() noexcept;
+  hstring GetString() noexcept;
+  bool GetBoolean() noexcept;
+  int64_t GetInt64() noexcept;
+  double GetDouble() noexcept;
+
+ public: // IJSValueReader2
+  bool TryGetDoubleArray(com_array<double> &values) noexcept;
+  bool TryGetInt64Array(com_array<int64_t> &values) noexcept;
+  com_array<uint8_t> GetUtf8String() noexcept;
+  Windows::Storage::Streams::IBuffer TryGetArrayBuffer(bool isBorrowed) noexcept;
+
+ private:
+  IJSValueReader m_reader;
+  IJSValueReader2 m_reader2;
+  NativeModuleProfiler::Clock::time_point m_lastReadTime;
+};
+
+// Forwards the writes of the result of a profiled synchronous call, and keeps the time of the first one, which is when
+// the method returned
+struct TimedJSValueWriter : implements<TimedJSValueWriter, IJSValueWriter, IJSValueWriter2> {
+  TimedJSValueWriter(IJSValueWriter const &writer) noexcept;
+
+  std::optional<NativeModuleProfiler::Clock::time_point> FirstWriteTime() const noexcept;
+
+ public: // IJSValueWriter
+  void WriteNull() noexcept;
+  void WriteBoolean(bool value) noexcept;
+  void WriteInt64(int64_t value) noexcept;
+  void WriteDouble(double value) noexcept;
+  void WriteString(const winrt::hstring &value) noexcept;
+  void WriteObjectBegin() noexcept;
+  void WritePropertyName(const winrt::hstring &name) noexcept;
+  void WriteObjectEnd() noexcept;
+  void WriteArrayBegin() noexcept;
+  void WriteArrayEnd() noexcept;
+
+ public: // IJSValueWriter2
+  void WriteDoubleArray(array_view<double const> values) noexcept;
+  void WriteInt64Array(array_view<int64_t const> values) noexcept;
+  void WriteUtf8String(array_view<uint8_t const> value) noexcept;
+  void WriteArrayBuffer(const Windows::Storage::Streams::IBuffer &buffer) noexcept;
+
+ private:
+  void OnWrite() noexcept;
+
+  IJSValueWriter m_writer;
+  IJSValueWriter2 m_writer2;
+  std::optional<NativeModuleProfiler::Clock::time_point> m_firstWriteTime;
+};
+
+} // namespace winrt::Microsoft::ReactNative
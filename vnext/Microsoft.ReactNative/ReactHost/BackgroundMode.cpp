@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "BackgroundMode.h"
+
+#include <algorithm>
+
+using namespace winrt::Microsoft::ReactNative;
+
+namespace Mso::React {
+
+static const ReactPropertyId<ReactNonAbiValue<std::shared_ptr<BackgroundMode>>> &BackgroundModePropertyId() noexcept {
+  static const ReactPropertyId<ReactNonAbiValue<std::shared_ptr<BackgroundMode>>> prop{
+      L"ReactNative.AppState", L"BackgroundMode"};
+  return prop;
+}
+
+/*static*/ std::shared_ptr<BackgroundMode> BackgroundMode::FromProperties(const ReactPropertyBag &properties) noexcept {
+  return *properties.GetOrCreate(BackgroundModePropertyId(), []() -> std::shared_ptr<BackgroundMode> {
+    return std::make_shared<BackgroundMode>();
+  });
+}
+
+bool BackgroundMode::IsInBackground() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_isInBackground;
+}
+
+void BackgroundMode::IsInBackground(bool value) noexcept {
+  std::vector<Entry> listeners;
+  {
+    std::scoped_lock lock{m_mutex};
+    if (m_isInBackground == value) {
+      return;
+    }
+    m_isInBackground = value;
+    // The listeners are called without holding the lock, so that they can remove themselves
+    listeners = m_listeners;
+  }
+
+  for (const auto &entry : listeners) {
+    entry.Callback(value);
+  }
+}
+
+uint32_t BackgroundMode::AddListener(Listener &&listener) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto token = m_nextToken++;
+  m_listeners.push_back({token, std::move(listener)});
+  return token;
+}
+
+void BackgroundMode::RemoveListener(uint32_t token) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_listeners.erase(
+      std::remove_if(
+          m_listeners.begin(),
+          m_listeners.end(),
+          [token](const Entry &entry) noexcept { return entry.Token == token; }),
+      m_listeners.end());
+}
+
+} // namespace Mso::React
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <ReactPropertyBag.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mso::React {
+
+// Whether the app is in the background, as the host reports it with ReactNativeHost.IsInBackground.  In the background
+// the instance stops the work that only matters to what is on screen: the timers and animation frames are throttled and
+// the idle callbacks are suspended, see Timing, and the caches are trimmed to their background budget, see
+// CacheBudgetManager.  The mode is kept in the instance properties, so that it outlives the reloads of the instance.
+class BackgroundMode final {
+ public:
+  using Listener = std::function<void(bool isInBackground)>;
+
+  BackgroundMode() noexcept = default;
+
+  BackgroundMode(const BackgroundMode &) = delete;
+  BackgroundMode &operator=(const BackgroundMode &) = delete;
+
+  // Creates the mode on first use
+  static std::shared_ptr<BackgroundMode> FromProperties(
+      const winrt::Microsoft::ReactNative::ReactPropertyBag &properties) noexcept;
+
+  bool IsInBackground() const noexcept;
+
+  // Calls the listeners on the calling thread, which must be the UI thread
+  void IsInBackground(bool value) noexcept;
+
+  // Returns a token to remove the listener with
+  uint32_t AddListener(Listener &&listener) noexcept;
+  void RemoveListener(uint32_t token) noexcept;
+
+ private:
+  struct Entry {
+    uint32_t Token;
+    Listener Callback;
+  };
+
+  mutable std::mutex m_mutex;
+  std::vector<Entry> m_listeners;
+  uint32_t m_nextToken{1};
+  bool m_isInBackground{false};
+};
+
+} // namespace Mso::React
@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "CacheBudgetManager.h"
+
+#include <CppRuntimeOptions.h>
+#include <algorithm>
+
+using namespace winrt::Microsoft::ReactNative;
+
+namespace Mso::React {
+
+constexpr std::chrono::seconds BudgetCheckInterval{1};
+constexpr uint64_t DefaultBudgetPhysicalMemoryDivisor = 32;
+constexpr size_t DefaultBackgroundBudgetDivisor = 4;
+
+static const ReactPropertyId<ReactNonAbiValue<std::shared_ptr<CacheBudgetManager>>>
+    &CacheBudgetManagerPropertyId() noexcept {
+  static const ReactPropertyId<ReactNonAbiValue<std::shared_ptr<CacheBudgetManager>>> prop{
+      L"ReactNative.Cache", L"CacheBudgetManager"};
+  return prop;
+}
+
+static size_t ConfiguredBudget() noexcept {
+  auto budgetMB = ::Microsoft::React::GetRuntimeOptionInt("Cache.MemoryBudgetMB");
+  if (budgetMB < 0) {
+    return 0;
+  }
+  if (budgetMB > 0) {
+    return static_cast<size_t>(budgetMB) * 1024 * 1024;
+  }
+
+  MEMORYSTATUSEX memoryStatus{sizeof(MEMORYSTATUSEX)};
+  if (!GlobalMemoryStatusEx(&memoryStatus)) {
+    return 0;
+  }
+  return static_cast<size_t>(memoryStatus.ullTotalPhys / DefaultBudgetPhysicalMemoryDivisor);
+}
+
+static size_t ConfiguredBackgroundBudget(size_t budget) noexcept {
+  auto budgetMB = ::Microsoft::React::GetRuntimeOptionInt("Cache.BackgroundMemoryBudgetMB");
+  if (budgetMB < 0) {
+    return 0;
+  }
+  if (budgetMB > 0) {
+    return static_cast<size_t>(budgetMB) * 1024 * 1024;
+  }
+  return budget / DefaultBackgroundBudgetDivisor;
+}
+
+CacheBudgetManager::CacheBudgetManager() noexcept
+    : m_budget{ConfiguredBudget()}, m_backgroundBudget{ConfiguredBackgroundBudget(m_budget)} {}
+
+/*static*/ std::shared_ptr<CacheBudgetManager> CacheBudgetManager::FromProperties(
+    const ReactPropertyBag &properties) noexcept {
+  return *properties.GetOrCreate(CacheBudgetManagerPropertyId(), []() -> std::shared_ptr<CacheBudgetManager> {
+    return std::make_shared<CacheBudgetManager>();
+  });
+}
+
+uint32_t CacheBudgetManager::Register(CacheRegistration &&cache) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto token = m_nextToken++;
+  m_entries.push_back({token, std::move(cache)});
+  return token;
+}
+
+void CacheBudgetManager::Unregister(uint32_t token) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_entries.erase(
+      std::remove_if(
+          m_entries.begin(), m_entries.end(), [token](const Entry &entry) noexcept { return entry.Token == token; }),
+      m_entries.end());
+}
+
+size_t CacheBudgetManager::Budget() const noexcept {
+  return m_budget;
+}
+
+size_t CacheBudgetManager::BackgroundBudget() const noexcept {
+  return m_backgroundBudget;
+}
+
+std::vector<CacheBudgetManager::Entry> CacheBudgetManager::SortedEntries() noexcept {
+  std::vector<Entry> entries;
+  {
+    std::scoped_lock lock{m_mutex};
+    entries = m_entries;
+  }
+  std::stable_sort(entries.begin(), entries.end(), [](const Entry &left, const Entry &right) noexcept {
+    return left.Cache.Priority < right.Cache.Priority;
+  });
+  return entries;
+}
+
+void CacheBudgetManager::EnforceBudget() noexcept {
+  if (m_budget == 0) {
+    return;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  if (now - m_lastBudgetCheck < BudgetCheckInterval) {
+    return;
+  }
+  m_lastBudgetCheck = now;
+  TrimToBudget(m_budget);
+}
+
+void CacheBudgetManager::TrimToBudget(size_t budget) noexcept {
+  if (budget == 0) {
+    return;
+  }
+
+  auto entries = SortedEntries();
+  auto byteCount = [&entries]() noexcept {
+    size_t total = 0;
+    for (const auto &entry : entries) {
+      if (entry.Cache.ByteCount) {
+        total += entry.Cache.ByteCount();
+      }
+    }
+    return total;
+  };
+
+  // Each cache is first trimmed by half, and then completely, before moving on to the next one
+  for (const auto &entry : entries) {
+    if (!entry.Cache.ByteCount) {
+      continue;
+    }
+    for (auto level : {CacheTrimLevel::Moderate, CacheTrimLevel::Complete}) {
+      if (byteCount() <= budget) {
+        return;
+      }
+      entry.Cache.Trim(level);
+    }
+  }
+}
+
+void CacheBudgetManager::TrimAll(CacheTrimLevel level) noexcept {
+  for (const auto &entry : SortedEntries()) {
+    entry.Cache.Trim(level);
+  }
+}
+
+} // namespace Mso::React
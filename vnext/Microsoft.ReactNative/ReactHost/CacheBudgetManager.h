@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <ReactPropertyBag.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mso::React {
+
+enum class CacheTrimLevel {
+  // Releases about half of what the cache holds
+  Moderate,
+  // Releases everything that the cache can create again
+  Complete,
+};
+
+// The caches with a lower priority are trimmed first
+enum class CacheTrimPriority {
+  // Cheap to create again, such as brushes
+  First,
+  Normal,
+  // Expensive to create again, such as decoded images
+  Last,
+};
+
+struct CacheRegistration {
+  const char *Name;
+  CacheTrimPriority Priority;
+  // The bytes that the cache holds, or nullptr when they are not known.  Only the caches that know their bytes count
+  // towards the budget, the others are only trimmed on memory pressure.
+  std::function<size_t()> ByteCount;
+  std::function<void(CacheTrimLevel)> Trim;
+};
+
+// Keeps the caches of an instance, and the process wide caches that the instance uses, within a common byte budget,
+// so that the worst case memory of the app is predictable.  The budget can be set in megabytes with the
+// "Cache.MemoryBudgetMB" runtime option, a negative value disables it.  It defaults to 1/32 of the physical memory,
+// which is 128 MB on a 4 GB device.
+//
+// The caches are trimmed by priority when they go over the budget, and all of them are trimmed when the memory usage
+// of the app gets high, see TrimMemoryOnMemoryPressure.  When the app enters the background, they are trimmed to the
+// background budget, which can be set with the "Cache.BackgroundMemoryBudgetMB" runtime option and defaults to a
+// quarter of the budget.  The manager is kept in the instance properties.
+// Caches can be registered from any thread, and are trimmed on the UI thread.
+class CacheBudgetManager final {
+ public:
+  CacheBudgetManager() noexcept;
+
+  CacheBudgetManager(const CacheBudgetManager &) = delete;
+  CacheBudgetManager &operator=(const CacheBudgetManager &) = delete;
+
+  // Creates the manager on first use
+  static std::shared_ptr<CacheBudgetManager> FromProperties(
+      const winrt::Microsoft::ReactNative::ReactPropertyBag &properties) noexcept;
+
+  // Returns a token to unregister the cache with
+  uint32_t Register(CacheRegistration &&cache) noexcept;
+  void Unregister(uint32_t token) noexcept;
+
+  // 0 when there is no budget
+  size_t Budget() const noexcept;
+  size_t BackgroundBudget() const noexcept;
+
+  // Trims the caches in priority order until the bytes that they hold are within the budget.  Cheap enough to be
+  // called after each mount, since it only looks at the caches once a second.
+  void EnforceBudget() noexcept;
+
+  // Trims the caches in priority order until the bytes that they hold are within the given budget, unless it is 0
+  void TrimToBudget(size_t budget) noexcept;
+
+  void TrimAll(CacheTrimLevel level) noexcept;
+
+ private:
+  struct Entry {
+    uint32_t Token;
+    CacheRegistration Cache;
+  };
+
+  // Copies the entries, so that they are called without holding the lock, sorted by priority
+  std::vector<Entry> SortedEntries() noexcept;
+
+  std::mutex m_mutex;
+  std::vector<Entry> m_entries;
+  uint32_t m_nextToken{1};
+  const size_t m_budget;
+  const size_t m_backgroundBudget;
+  std::chrono::steady_clock::time_point m_lastBudgetCheck;
+};
+
+} // namespace Mso::React
@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "MemoryReport.h"
+
+#include "CacheBudgetManager.h"
+
+#include <Fabric/Composition/CompositionHelpers.h>
+#include <Fabric/Composition/ImageSurfaceCache.h>
+#include <Fabric/DecodedImageCache.h>
+#include <Fabric/FabricUIManagerModule.h>
+#include <IBlobPersistor.h>
+#include <IReactDispatcher.h>
+#include <Networking/NetworkPropertyIds.h>
+#include <TurboModulesProvider.h>
+#include <react/bridging/LongLivedObject.h>
+#include <react/renderer/textlayoutmanager/WindowsTextLayoutManager.h>
+#include <tracing/tracing.h>
+
+using namespace winrt::Microsoft::ReactNative;
+
+namespace Mso::React {
+
+static const char *DrawingSurfaceOwnerName(::Microsoft::ReactNative::Composition::DrawingSurfaceOwner owner) noexcept {
+  switch (owner) {
+    case ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Text:
+      return "text";
+    case ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Border:
+      return "border";
+    case ::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Image:
+      return "image";
+    default:
+      return "other";
+  }
+}
+
+std::vector<MemoryUsage> CollectMemoryUsage(
+    const ReactPropertyBag &properties,
+    const std::shared_ptr<TurboModulesProvider> &turboModulesProvider) noexcept {
+  std::vector<MemoryUsage> usages;
+
+  auto uiDispatcher = implementation::ReactDispatcher::GetUIDispatcher(properties.Handle());
+  if (uiDispatcher && uiDispatcher.HasThreadAccess()) {
+    if (auto fabricUIManager = ::Microsoft::ReactNative::FabricUIManager::FromProperties(properties)) {
+      for (auto &[type, count] : fabricUIManager->componentViewCounts()) {
+        if (count.mounted) {
+          usages.push_back({"componentViews", type, count.mounted});
+        }
+        if (count.recycled) {
+          usages.push_back({"recycledComponentViews", type, count.recycled});
+        }
+      }
+    }
+  }
+
+  usages.push_back({"visuals", {}, ::Microsoft::ReactNative::Composition::LiveVisualCount()});
+  for (size_t i = 0; i < static_cast<size_t>(::Microsoft::ReactNative::Composition::DrawingSurfaceOwner::Count); ++i) {
+    auto owner = static_cast<::Microsoft::ReactNative::Composition::DrawingSurfaceOwner>(i);
+    auto surfaces = ::Microsoft::ReactNative::Composition::LiveDrawingSurfaceUsage(owner);
+    usages.push_back({"drawingSurfaces", DrawingSurfaceOwnerName(owner), surfaces.Count, surfaces.ByteCount});
+  }
+
+  usages.push_back(
+      {"textLayoutCache", {}, facebook::react::WindowsTextLayoutManager::MeasuredTextLayoutCount(), std::nullopt});
+
+  auto &decodedImageCache = ::Microsoft::ReactNative::DecodedImageCache::Instance();
+  usages.push_back({"decodedImageCache", {}, decodedImageCache.size(), decodedImageCache.byteSize()});
+  usages.push_back(
+      {"imageSurfaceCache", {}, Composition::implementation::ImageSurfaceCache::Instance().size(), std::nullopt});
+
+  if (auto blobPersistorProperty = properties.Get(::Microsoft::React::BlobModulePersistorPropertyId())) {
+    if (auto blobPersistor = blobPersistorProperty.Value().lock()) {
+      usages.push_back({"blobPersistor", {}, blobPersistor->BlobCount(), blobPersistor->MemoryUsage()});
+    }
+  }
+
+  if (turboModulesProvider) {
+    usages.push_back(
+        {"longLivedJSIObjects", {}, turboModulesProvider->LongLivedObjectCollection()->size(), std::nullopt});
+    usages.push_back({"pendingJSICallbacks", {}, turboModulesProvider->LongLivedJsiObjectCount(), std::nullopt});
+  }
+
+  return usages;
+}
+
+void WriteMemoryReport(const std::vector<MemoryUsage> &usages, const IJSValueWriter &writer) noexcept {
+  writer.WriteArrayBegin();
+  for (const auto &usage : usages) {
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"category");
+    writer.WriteString(winrt::to_hstring(usage.Category));
+    if (!usage.Type.empty()) {
+      writer.WritePropertyName(L"type");
+      writer.WriteString(winrt::to_hstring(usage.Type));
+    }
+    writer.WritePropertyName(L"count");
+    writer.WriteInt64(static_cast<int64_t>(usage.Count));
+    if (usage.ByteCount) {
+      writer.WritePropertyName(L"byteCount");
+      writer.WriteInt64(static_cast<int64_t>(*usage.ByteCount));
+    }
+    writer.WriteObjectEnd();
+  }
+  writer.WriteArrayEnd();
+}
+
+void LogMemoryReport(const std::vector<MemoryUsage> &usages) noexcept {
+  for (const auto &usage : usages) {
+    facebook::react::tracing::logMemoryUsage(
+        usage.Category, usage.Type.c_str(), usage.Count, usage.ByteCount.value_or(0));
+  }
+}
+
+winrt::Windows::System::MemoryManager::AppMemoryUsageIncreased_revoker TrimMemoryOnMemoryPressure(
+    const ReactPropertyBag &properties,
+    std::weak_ptr<TurboModulesProvider> &&turboModulesProvider) noexcept {
+  try {
+    return winrt::Windows::System::MemoryManager::AppMemoryUsageIncreased(
+        winrt::auto_revoke,
+        [weakProperties = winrt::make_weak(properties.Handle()),
+         turboModulesProvider = std::move(turboModulesProvider)](
+            const winrt::Windows::Foundation::IInspectable &, const winrt::Windows::Foundation::IInspectable &) {
+          auto level = winrt::Windows::System::MemoryManager::AppMemoryUsageLevel();
+          if (level < winrt::Windows::System::AppMemoryUsageLevel::High) {
+            return;
+          }
+
+          auto strongProperties = weakProperties.get();
+          if (!strongProperties) {
+            return;
+          }
+
+          auto uiDispatcher = implementation::ReactDispatcher::GetUIDispatcher(strongProperties);
+          if (!uiDispatcher) {
+            return;
+          }
+
+          uiDispatcher.Post([weakProperties, turboModulesProvider, level]() noexcept {
+            auto strongProperties = weakProperties.get();
+            if (!strongProperties) {
+              return;
+            }
+
+            ReactPropertyBag properties{strongProperties};
+            LogMemoryReport(CollectMemoryUsage(properties, turboModulesProvider.lock()));
+
+            CacheBudgetManager::FromProperties(properties)->TrimAll(
+                level == winrt::Windows::System::AppMemoryUsageLevel::OverLimit ? CacheTrimLevel::Complete
+                                                                                : CacheTrimLevel::Moderate);
+          });
+        });
+  } catch (winrt::hresult_error const &) {
+    // Memory usage notifications are not available to every process
+    return {};
+  }
+}
+
+} // namespace Mso::React
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <ReactPropertyBag.h>
+#include <winrt/Microsoft.ReactNative.h>
+#include <winrt/Windows.System.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+class TurboModulesProvider;
+} // namespace winrt::Microsoft::ReactNative
+
+namespace Mso::React {
+
+// One category of the memory that react-native-windows holds: the component views and the recycled component views by
+// the class of their implementation, the composition visuals, the drawing surfaces by their owner, the cached text
+// layouts, the decoded images and the surfaces shared by image views, the blobs, the long lived JSI objects, and the
+// callbacks and promises that the modules did not complete yet.
+struct MemoryUsage {
+  const char *Category;
+  // Empty unless the category is broken down by type
+  std::string Type;
+  uint64_t Count{0};
+  // Missing when the bytes are not known
+  std::optional<uint64_t> ByteCount;
+};
+
+// Collects the memory held by the instance with the properties, and by the caches that all instances share.
+// The component views are only counted on the UI thread, which owns them.
+std::vector<MemoryUsage> CollectMemoryUsage(
+    const winrt::Microsoft::ReactNative::ReactPropertyBag &properties,
+    const std::shared_ptr<winrt::Microsoft::ReactNative::TurboModulesProvider> &turboModulesProvider) noexcept;
+
+// Writes an array with the category, type, count and byteCount of each usage, without the missing fields
+void WriteMemoryReport(
+    const std::vector<MemoryUsage> &usages,
+    const winrt::Microsoft::ReactNative::IJSValueWriter &writer) noexcept;
+
+// Logs each usage as a ReactMemoryUsage ETW event
+void LogMemoryReport(const std::vector<MemoryUsage> &usages) noexcept;
+
+// When the memory usage of the app gets high, logs the memory report of the instance on its UI thread, and trims the
+// caches registered with its CacheBudgetManager: by half, or completely once the usage is over the limit.
+winrt::Windows::System::MemoryManager::AppMemoryUsageIncreased_revoker TrimMemoryOnMemoryPressure(
+    const winrt::Microsoft::ReactNative::ReactPropertyBag &properties,
+    std::weak_ptr<winrt::Microsoft::ReactNative::TurboModulesProvider> &&turboModulesProvider) noexcept;
+
+} // namespace Mso::React
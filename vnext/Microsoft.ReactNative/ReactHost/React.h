@@ -192,6 +192,9 @@ struct ReactOptions {
   //! Base path of the SDX. The absolute path of the SDX can be constructed from this and the Identity.
   std::string BundleRootPath;
 
+  //! Origins that the first requests of the SDX go to. They are prepared while the JavaScript bundles load.
+  std::vector<std::string> PreconnectOrigins;
+
   //! JavaScript Bundles
   //! This List includes both Platform and User JavaScript Bundles
   //! Bundles are loaded into JavaScript engine in the same order
@@ -283,6 +286,26 @@ struct ReactOptions {
       bool value) noexcept;
   static bool EnableDefaultCrashHandler(winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept;
 
+  //! Runs a full garbage collection of the JavaScript heap when the app enters the background
+  static void SetCollectJSGarbageInBackground(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+      bool value) noexcept;
+  static bool CollectJSGarbageInBackground(winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept;
+
+  //! Runs a full garbage collection of the JavaScript heap when the memory usage level of the app rises to high
+  static void SetCollectJSGarbageOnMemoryPressure(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+      bool value) noexcept;
+  static bool CollectJSGarbageOnMemoryPressure(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept;
+
+  //! Runs the JS queue of the instance on a thread pool shared with the other instances that use it, instead of a
+  //! thread of its own
+  static void SetUseSharedJSThreadPool(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+      bool value) noexcept;
+  static bool UseSharedJSThreadPool(winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept;
+
   //! Adds registered JS bundle to JSBundles.
   LIBLET_PUBLICAPI ReactOptions &AddRegisteredJSBundle(std::string_view jsBundleId) noexcept;
 
@@ -334,6 +357,10 @@ struct DECLSPEC_NOVTABLE IReactHost : IUnknown {
   //! Unloads the ReactNative instance and associated ReactViews.
   virtual Mso::Future<void> UnloadInstance() noexcept = 0;
 
+  //! Calls loadInstance in the native queue unless the ReactNative instance is already loaded or loading without
+  //! errors, so that ReactViews attached later only need to render. Returns the future of the instance load.
+  virtual Mso::Future<void> PrewarmInstance(Mso::Functor<Mso::Future<void>()> &&loadInstance) noexcept = 0;
+
   //! Creates a new instance of IReactViewHost.
   //! The IReactViewHost is added to the list of view hosts only after a IReactViewInstance is attached to it.
   virtual Mso::CntPtr<IReactViewHost> MakeViewHost(ReactViewOptions &&options) noexcept = 0;
@@ -94,6 +94,30 @@ winrt::Microsoft::ReactNative::IReactPropertyName EnableDefaultCrashHandlerPrope
   return propName;
 }
 
+winrt::Microsoft::ReactNative::IReactPropertyName CollectJSGarbageInBackgroundProperty() noexcept {
+  static winrt::Microsoft::ReactNative::IReactPropertyName propName =
+      winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetName(
+          winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetNamespace(L"ReactNative.ReactOptions"),
+          L"CollectJSGarbageInBackground");
+  return propName;
+}
+
+winrt::Microsoft::ReactNative::IReactPropertyName CollectJSGarbageOnMemoryPressureProperty() noexcept {
+  static winrt::Microsoft::ReactNative::IReactPropertyName propName =
+      winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetName(
+          winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetNamespace(L"ReactNative.ReactOptions"),
+          L"CollectJSGarbageOnMemoryPressure");
+  return propName;
+}
+
+winrt::Microsoft::ReactNative::IReactPropertyName UseSharedJSThreadPoolProperty() noexcept {
+  static winrt::Microsoft::ReactNative::IReactPropertyName propName =
+      winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetName(
+          winrt::Microsoft::ReactNative::ReactPropertyBagHelper::GetNamespace(L"ReactNative.ReactOptions"),
+          L"UseSharedJSThreadPool");
+  return propName;
+}
+
 //=============================================================================================
 // ReactOptions implementation
 //=============================================================================================
@@ -252,6 +276,39 @@ bool ReactOptions::EnableDefaultCrashHandler() const noexcept {
   return winrt::unbox_value_or<bool>(properties.Get(EnableDefaultCrashHandlerProperty()), false);
 }
 
+/*static*/ void ReactOptions::SetCollectJSGarbageInBackground(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+    bool value) noexcept {
+  properties.Set(CollectJSGarbageInBackgroundProperty(), winrt::box_value(value));
+}
+
+/*static*/ bool ReactOptions::CollectJSGarbageInBackground(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept {
+  return winrt::unbox_value_or<bool>(properties.Get(CollectJSGarbageInBackgroundProperty()), false);
+}
+
+/*static*/ void ReactOptions::SetCollectJSGarbageOnMemoryPressure(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+    bool value) noexcept {
+  properties.Set(CollectJSGarbageOnMemoryPressureProperty(), winrt::box_value(value));
+}
+
+/*static*/ bool ReactOptions::CollectJSGarbageOnMemoryPressure(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept {
+  return winrt::unbox_value_or<bool>(properties.Get(CollectJSGarbageOnMemoryPressureProperty()), false);
+}
+
+/*static*/ void ReactOptions::SetUseSharedJSThreadPool(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+    bool value) noexcept {
+  properties.Set(UseSharedJSThreadPoolProperty(), winrt::box_value(value));
+}
+
+/*static*/ bool ReactOptions::UseSharedJSThreadPool(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties) noexcept {
+  return winrt::unbox_value_or<bool>(properties.Get(UseSharedJSThreadPoolProperty()), false);
+}
+
 //=============================================================================================
 // ReactNativeWindowsFeatureFlags implementation
 //=============================================================================================
@@ -429,14 +486,35 @@ Mso::Future<void> ReactHost::ReloadInstance() noexcept {
 
 Mso::Future<void> ReactHost::ReloadInstanceWithOptions(ReactOptions &&options) noexcept {
   return PostInQueue([this, options = std::move(options)]() mutable noexcept {
-    return m_actionQueue.Load()->PostActions(
+    auto whenLoaded = m_actionQueue.Load()->PostActions(
         {MakeUnloadInstanceAction(UnloadReason::Unload), MakeLoadInstanceAction(std::move(options))});
+    m_whenInstanceLoaded.Store(Mso::Copy(whenLoaded));
+    return whenLoaded;
   });
 }
 
 Mso::Future<void> ReactHost::UnloadInstance() noexcept {
-  return PostInQueue(
-      [this]() noexcept { return m_actionQueue.Load()->PostAction(MakeUnloadInstanceAction(UnloadReason::Unload)); });
+  return PostInQueue([this]() noexcept {
+    m_whenInstanceLoaded.Store({});
+    return m_actionQueue.Load()->PostAction(MakeUnloadInstanceAction(UnloadReason::Unload));
+  });
+}
+
+Mso::Future<void> ReactHost::PrewarmInstance(Mso::Functor<Mso::Future<void>()> &&loadInstance) noexcept {
+  return PostInQueue([this, loadInstance = std::move(loadInstance)]() mutable noexcept {
+    // The instance is null while its load action waits in the action queue
+    if (auto &whenLoaded = m_whenInstanceLoaded.Load()) {
+      auto reactInstance = m_reactInstance.Load();
+      if (!reactInstance || reactInstance->State() != ReactInstanceState::HasError) {
+        return Mso::Copy(whenLoaded);
+      }
+    }
+
+    // Stored right away, so that the next prewarm does not load another instance before this load is posted
+    auto whenLoaded = loadInstance();
+    m_whenInstanceLoaded.Store(Mso::Copy(whenLoaded));
+    return whenLoaded;
+  });
 }
 
 AsyncAction ReactHost::MakeLoadInstanceAction(ReactOptions &&options) noexcept {
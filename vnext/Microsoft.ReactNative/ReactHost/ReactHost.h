@@ -45,6 +45,7 @@ class ReactHost final : public Mso::ActiveObject<IReactHost> {
   Mso::Future<void> ReloadInstance() noexcept override;
   Mso::Future<void> ReloadInstanceWithOptions(ReactOptions &&options) noexcept override;
   Mso::Future<void> UnloadInstance() noexcept override;
+  Mso::Future<void> PrewarmInstance(Mso::Functor<Mso::Future<void>()> &&loadInstance) noexcept override;
   Mso::CntPtr<IReactViewHost> MakeViewHost(ReactViewOptions &&options) noexcept override;
   Mso::Future<std::vector<Mso::CntPtr<IReactViewHost>>> GetViewHostList() noexcept override;
 
@@ -106,6 +107,7 @@ class ReactHost final : public Mso::ActiveObject<IReactHost> {
   size_t m_pendingUnloadActionId{0};
   size_t m_nextUnloadActionId{0};
   const Mso::ActiveField<bool> m_isInstanceUnloading{false, Queue()};
+  const Mso::ActiveField<Mso::Future<void>> m_whenInstanceLoaded{Queue()}; // Empty when no instance load is requested
 
   const std::shared_ptr<facebook::react::jsinspector_modern::HostTargetDelegate> m_inspectorHostTargetDelegate;
   std::shared_ptr<facebook::react::jsinspector_modern::HostTarget> m_inspectorHostTarget;
@@ -8,10 +8,12 @@
 #include <CppRuntimeOptions.h>
 #include <CreateModules.h>
 #include <JSCallInvokerScheduler.h>
+#include <Networking/IHttpResource.h>
 #include <OInstance.h>
 #include <PackagerConnection.h>
 #include <QuirkSettings.h>
 #include <Shared/DevServerHelper.h>
+#include <Threading/BatchingMessageQueue.h>
 #include <Threading/MessageDispatchQueue.h>
 #include <Threading/MessageQueueThreadFactory.h>
 #include <TurboModuleManager.h>
@@ -21,17 +23,20 @@
 #include <dispatchQueue/dispatchQueue.h>
 #include <react/renderer/runtimescheduler/RuntimeScheduler.h>
 #include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
+#include <tracing/tracing.h>
 #include <winrt/Windows.Storage.h>
 #include <tuple>
 #include "BaseScriptStoreImpl.h"
 #include "CrashManager.h"
 #include "DevMenu.h"
 #include "DynamicWriter.h"
+#include "Hermes/HermesProductionProfiler.h"
 #include "HermesRuntimeHolder.h"
 #include "IReactContext.h"
 #include "IReactDispatcher.h"
 #include "IReactNotificationService.h"
 #include "JsiApi.h"
+#include "MemoryReport.h"
 #include "Modules/DevSettingsModule.h"
 #include "Modules/ExceptionsManager.h"
 #include "Modules/PlatformConstantsWinModule.h"
@@ -42,9 +47,11 @@
 #include "Modules/Timing.h"
 #include "MoveOnCopy.h"
 #include "MsoUtils.h"
+#include "NativeModuleProfiler.h"
 #include "NativeModules.h"
 #include "ReactCoreInjection.h"
 #include "ReactErrorProvider.h"
+#include "ReactNativeHost.h"
 #include "RedBox.h"
 #include "Unicode.h"
 
@@ -61,6 +68,7 @@
 #include <react/runtime/TimerManager.h>
 #include <react/threading/MessageQueueThreadImpl.h>
 #include "Inspector/ReactInspectorThread.h"
+#include "SharedJSThreadPool.h"
 
 #ifndef CORE_ABI
 #include <Utils/UwpPreparedScriptStore.h>
@@ -78,8 +86,11 @@
 #include "Modules/ExceptionsManager.h"
 #include "Modules/PlatformConstantsWinModule.h"
 #include "Modules/ReactRootViewTagGenerator.h"
+#include "Modules/SegmentFetcherModule.h"
+#include "Modules/UserTimingModule.h"
 #include "Modules/SourceCode.h"
 #include "Modules/StatusBarManager.h"
+#include "Modules/VisibilityTrackerModule.h"
 
 #include <Modules/ImageViewManagerModule.h>
 #include "Modules/Animated/NativeAnimatedModule.h"
@@ -143,7 +154,11 @@ ReactInstanceWin::ReactInstanceWin(
       m_reactContext{Mso::Make<ReactContext>(
           this,
           options.Properties,
-          winrt::make<implementation::ReactNotificationService>(options.Notifications))} {
+          winrt::make<implementation::ReactNotificationService>(options.Notifications))},
+      m_startupTimeline{
+          StartupTimeline::ForNewInstance(winrt::Microsoft::ReactNative::ReactPropertyBag(options.Properties))} {
+  m_startupTimeline->StartPhase(StartupPhase::InstanceCreation);
+
   // As soon as the bundle is loaded or failed to load, we set the m_whenLoaded promise value in JS queue.
   // It then synchronously raises the OnInstanceLoaded event in the JS queue.
   // Then, we notify the ReactHost about the load event in the internal queue.
@@ -227,6 +242,10 @@ void ReactInstanceWin::InstanceCrashHandler(int fileDescriptor) noexcept {
   }
 }
 
+// Modules that must be ready by the first frame: the Fabric binding, and the DeviceInfo constants that Dimensions reads
+// while the first render is computed.
+static constexpr const wchar_t *EagerInitModuleNames[] = {L"FabricUIManagerBinding", L"DeviceInfo"};
+
 void ReactInstanceWin::LoadModules(
     const std::shared_ptr<facebook::react::DevSettings> &devSettings,
     const std::shared_ptr<winrt::Microsoft::ReactNative::TurboModulesProvider> &turboModulesProvider) noexcept {
@@ -296,6 +315,17 @@ void ReactInstanceWin::LoadModules(
       L"StatusBarManager",
       winrt::Microsoft::ReactNative::MakeModuleProvider<::Microsoft::ReactNative::StatusBarManager>());
 
+  registerTurboModule(
+      L"VisibilityTracker",
+      winrt::Microsoft::ReactNative::MakeModuleProvider<::Microsoft::ReactNative::VisibilityTrackerModule>());
+
+  registerTurboModule(
+      L"SegmentFetcher",
+      winrt::Microsoft::ReactNative::MakeModuleProvider<::Microsoft::ReactNative::SegmentFetcherModule>());
+
+  registerTurboModule(
+      L"UserTiming", winrt::Microsoft::ReactNative::MakeModuleProvider<::Microsoft::ReactNative::UserTimingModule>());
+
   registerTurboModule(
       L"PlatformConstants",
       winrt::Microsoft::ReactNative::MakeTurboModuleProvider<::Microsoft::ReactNative::PlatformConstants>());
@@ -344,6 +374,11 @@ void ReactInstanceWin::LoadModules(
 
   registerTurboModule(
       ::Microsoft::React::GetFileReaderTurboModuleName(), ::Microsoft::React::GetFileReaderModuleProvider());
+
+  // The other modules are only created the first time that JS uses them
+  for (const wchar_t *moduleName : EagerInitModuleNames) {
+    turboModulesProvider->AddEagerInitModuleName(moduleName);
+  }
 }
 
 //! Initialize() is called from the native queue.
@@ -357,10 +392,8 @@ void ReactInstanceWin::InitDevMenu() noexcept {
 
 void ReactInstanceWin::InitUIDependentCalls() noexcept {
 #ifndef CORE_ABI
-  Microsoft::ReactNative::AppThemeHolder::InitAppThemeHolder(GetReactContext());
-  Microsoft::ReactNative::I18nManager::InitI18nInfo(
-      winrt::Microsoft::ReactNative::ReactPropertyBag(Options().Properties));
-  Microsoft::ReactNative::Appearance::InitOnUIThread(GetReactContext());
+  // The window metrics are read by the first frame. AppTheme, Appearance and I18nManager get their state the first time
+  // that JS uses them.
   Microsoft::ReactNative::DeviceInfoHolder::InitDeviceInfoHolder(GetReactContext());
 #endif // CORE_ABI
 }
@@ -407,22 +440,19 @@ std::shared_ptr<facebook::react::DevSettings> ReactInstanceWin::CreateDevSetting
 Mso::DispatchQueueSettings CreateDispatchQueueSettings(
     const winrt::Microsoft::ReactNative::IReactNotificationService &service) {
   Mso::DispatchQueueSettings queueSettings{};
-  queueSettings.TaskStarting = [service](Mso::DispatchQueue const &) noexcept {
-    service.SendNotification(
-        winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherTaskStartingEventName(), nullptr, nullptr);
-  };
-  queueSettings.IdleWaitStarting = [service](Mso::DispatchQueue const &) noexcept {
-    service.SendNotification(
-        winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherIdleWaitStartingEventName(),
-        nullptr,
-        nullptr);
-  };
-  queueSettings.IdleWaitCompleted = [service](Mso::DispatchQueue const &) noexcept {
-    service.SendNotification(
-        winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherIdleWaitCompletedEventName(),
-        nullptr,
-        nullptr);
-  };
+  // Resolve the event names once instead of on every task.
+  queueSettings.TaskStarting =
+      [service,
+       eventName = winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherTaskStartingEventName()](
+          Mso::DispatchQueue const &) noexcept { service.SendNotification(eventName, nullptr, nullptr); };
+  queueSettings.IdleWaitStarting =
+      [service,
+       eventName = winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherIdleWaitStartingEventName()](
+          Mso::DispatchQueue const &) noexcept { service.SendNotification(eventName, nullptr, nullptr); };
+  queueSettings.IdleWaitCompleted =
+      [service,
+       eventName = winrt::Microsoft::ReactNative::ReactDispatcherHelper::JSDispatcherIdleWaitCompletedEventName()](
+          Mso::DispatchQueue const &) noexcept { service.SendNotification(eventName, nullptr, nullptr); };
   return queueSettings;
 }
 
@@ -430,7 +460,8 @@ std::unique_ptr<facebook::jsi::PreparedScriptStore> CreatePreparedScriptStore()
   std::unique_ptr<facebook::jsi::PreparedScriptStore> preparedScriptStore = nullptr;
   wchar_t tempPath[MAX_PATH];
   if (GetTempPathW(static_cast<DWORD>(std::size(tempPath)), tempPath)) {
-    preparedScriptStore = std::make_unique<facebook::react::BasePreparedScriptStoreImpl>(winrt::to_string(tempPath));
+    preparedScriptStore = std::make_unique<facebook::react::PreparedScriptCache>(
+        winrt::to_string(tempPath) + "ReactNativePreparedScripts\\");
   }
   return preparedScriptStore;
 }
@@ -452,11 +483,106 @@ void SetJSThreadDescription() noexcept {
   reinterpret_cast<SetThreadDescriptionFn>(proc)(GetCurrentThread(), L"React-Native JavaScript Thread");
 }
 
+void ReactInstanceWin::PreconnectOrigins() noexcept {
+  if (m_options.PreconnectOrigins.empty()) {
+    return;
+  }
+
+  // The resources created with the same runtime options share their connections, so the Networking module uses the
+  // ones opened here
+  auto resource = Microsoft::React::Networking::IHttpResource::Make();
+  for (const auto &origin : m_options.PreconnectOrigins) {
+    resource->Preconnect(std::string{origin});
+  }
+}
+
+// Logs the task that ran longer than the long task threshold, and raises the LongTaskDetected event of the host. Called
+// on the thread of the task after it ran, which lets the JS stack be sampled between the tasks of the JS queue.
+static void ReportLongTask(
+    const Mso::DispatchQueueMetrics::TaskRecord &record,
+    const winrt::Microsoft::ReactNative::IReactPropertyBag &properties) noexcept {
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  std::string jsStack;
+  if (record.QueueName == "JS" &&
+      ReactPropertyBag(properties)
+          .Get(winrt::Microsoft::ReactNative::implementation::ReactContext::LongTaskJSStackSamplingEnabledProperty())
+          .value_or(false)) {
+    if (auto profiler = ReactPropertyBag(properties).Get(
+            winrt::Microsoft::ReactNative::implementation::ReactContext::HermesProductionProfilerProperty())) {
+      auto endTimeUs = duration_cast<microseconds>(Mso::DispatchQueueMetrics::Clock::now().time_since_epoch()).count();
+      jsStack = (*profiler)->SampleJSStack(endTimeUs - duration_cast<microseconds>(record.RunTime).count(), endTimeUs);
+    }
+  }
+
+  const double waitTimeMs = Milliseconds(record.WaitTime).count();
+  const double runTimeMs = Milliseconds(record.RunTime).count();
+  facebook::react::tracing::logLongTask(
+      record.QueueName, record.TaskName, record.Origin, waitTimeMs, runTimeMs, jsStack);
+
+  using winrt::Microsoft::ReactNative::implementation::ReactNativeHost;
+  if (auto host = ReactNativeHost::GetReactNativeHost(ReactPropertyBag(properties))) {
+    winrt::get_self<ReactNativeHost>(host)->RaiseLongTaskDetected(
+        winrt::make<winrt::Microsoft::ReactNative::implementation::LongTaskEventArgs>(
+            winrt::to_hstring(record.QueueName),
+            winrt::to_hstring(record.TaskName),
+            winrt::to_hstring(record.Origin),
+            waitTimeMs,
+            runTimeMs,
+            winrt::to_hstring(jsStack)));
+  }
+}
+
 void ReactInstanceWin::InitializeBridgeless() noexcept {
   InitUIQueue();
 
-  m_uiMessageThread.Exchange(std::make_shared<MessageDispatchQueue2>(
-      *m_uiQueue, Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError)));
+  // Connects to the known origins while the bundle loads
+  PreconnectOrigins();
+
+  std::shared_ptr<Mso::DispatchQueueMetrics> uiMetrics;
+  std::shared_ptr<Mso::DispatchQueueMetrics> jsMetrics;
+  const bool metricsEnabled =
+      ReactPropertyBag(m_options.Properties)
+          .Get(winrt::Microsoft::ReactNative::implementation::ReactContext::DispatchQueueMetricsEnabledProperty())
+          .value_or(false);
+  const std::chrono::milliseconds longTaskThreshold{
+      ReactPropertyBag(m_options.Properties)
+          .Get(winrt::Microsoft::ReactNative::implementation::ReactContext::LongTaskThresholdMsProperty())
+          .value_or(0)};
+  if (metricsEnabled || longTaskThreshold.count() > 0) {
+    // The metrics are kept in the properties, so the handler does not keep them alive
+    auto logTask = [metricsEnabled, longTaskThreshold, weakProperties = winrt::make_weak(m_options.Properties)](
+                       const Mso::DispatchQueueMetrics::TaskRecord &record) noexcept {
+      if (metricsEnabled) {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        facebook::react::tracing::logDispatchTask(
+            record.QueueName,
+            record.TaskName,
+            Milliseconds(record.WaitTime).count(),
+            Milliseconds(record.RunTime).count(),
+            record.QueueDepth);
+      }
+
+      if (longTaskThreshold.count() > 0 && record.RunTime >= longTaskThreshold) {
+        if (auto properties = weakProperties.get()) {
+          ReportLongTask(record, properties);
+        }
+      }
+    };
+    uiMetrics = std::make_shared<Mso::DispatchQueueMetrics>("UI", logTask);
+    jsMetrics = std::make_shared<Mso::DispatchQueueMetrics>("JS", logTask);
+    ReactPropertyBag(m_reactContext->Properties())
+        .Set(
+            winrt::Microsoft::ReactNative::implementation::ReactContext::DispatchQueueMetricsProperty(),
+            std::vector<std::shared_ptr<Mso::DispatchQueueMetrics>>{uiMetrics, jsMetrics});
+  }
+
+  // The tasks posted to the UI batching queue within a JS turn, like the updates of the native animated nodes and the
+  // mount transactions, are run as one task of the UI queue
+  m_uiMessageThread.Exchange(std::make_shared<BatchingMessageQueue>(std::make_shared<MessageDispatchQueue2>(
+      *m_uiQueue, Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError), nullptr, uiMetrics)));
 
   ReactPropertyBag(m_reactContext->Properties())
       .Set(
@@ -472,12 +598,12 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
   winrt::Microsoft::ReactNative::Composition::implementation::UriImageManager::Install(
       ReactPropertyBag(m_reactContext->Properties()), m_options.UriImageManager);
 
-  m_uiQueue->Post([this, weakThis = Mso::WeakPtr{this}]() noexcept {
+  m_uiQueue->Post([this, weakThis = Mso::WeakPtr{this}, jsMetrics]() noexcept {
     // Objects that must be created on the UI thread
     if (auto strongThis = weakThis.GetStrongPtr()) {
       InitUIDependentCalls();
 
-      strongThis->Queue().Post([this, weakThis]() noexcept {
+      strongThis->Queue().Post([this, weakThis, jsMetrics]() noexcept {
         if (auto strongThis = weakThis.GetStrongPtr()) {
           auto devSettings = strongThis->CreateDevSettings();
 
@@ -485,61 +611,155 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
             if (devSettings->useFastRefresh || devSettings->liveReloadCallback) {
               Microsoft::ReactNative::PackagerConnection::CreateOrReusePackagerConnection(*devSettings);
             }
-            LoadModules(devSettings, m_options.TurboModuleProvider);
 
-            auto jsMessageThread = std::make_shared<facebook::react::MessageQueueThreadImpl>();
+            // The startup runs as three overlapping phases: the bundle is read or memory mapped on a background
+            // thread, the JS runtime is created on the JS thread, and the native modules are registered on this
+            // queue. They join before the runtime is initialized.
+            std::unique_ptr<const facebook::react::JSBigString> bundleString;
+            if (!m_isFastReloadEnabled) {
+              bundleString =
+                  ::Microsoft::ReactNative::JsBigStringFromPath(devSettings, Mso::Copy(JavaScriptBundleFile()));
+            }
+
+            const bool useSharedJSThreadPool = ReactOptions::UseSharedJSThreadPool(m_options.Properties);
+            std::shared_ptr<facebook::react::MessageQueueThread> jsMessageThread;
+            if (useSharedJSThreadPool) {
+              jsMessageThread = std::make_shared<MessageDispatchQueue>(
+                  MakeSharedJSThreadPoolQueue(),
+                  Mso::MakeWeakMemberFunctor(this, &ReactInstanceWin::OnError),
+                  nullptr,
+                  jsMetrics);
+            } else {
+              jsMessageThread = std::make_shared<facebook::react::MessageQueueThreadImpl>(jsMetrics);
+            }
             m_jsMessageThread.Exchange(jsMessageThread);
 
             std::shared_ptr<facebook::react::CallInvoker> callInvoker;
+            std::exception_ptr runtimeCreationError;
+
+            // It captures the locals by reference, because this queue waits for it below.
+            m_jsMessageThread.Load()->runOnQueue([&]() {
+              m_startupTimeline->StartPhase(StartupPhase::RuntimeInit);
+              try {
+                if (!useSharedJSThreadPool) {
+                  SetJSThreadDescription();
+                }
+                auto timerRegistry =
+                    ::Microsoft::ReactNative::TimerRegistry::CreateTimerRegistry(m_reactContext->Properties());
+                auto timerRegistryRaw = timerRegistry.get();
+
+                auto timerManager = std::make_shared<facebook::react::TimerManager>(std::move(timerRegistry));
+                timerRegistryRaw->setTimerManager(timerManager);
+
+                auto jsErrorHandlingFunc = [this](
+                                               facebook::jsi::Runtime &runtime,
+                                               const facebook::react::JsErrorHandler::ProcessedError &error) noexcept {
+                  OnJSError(runtime, std::move(error));
+                };
+
+                if (devSettings->useDirectDebugger) {
+                  ::Microsoft::ReactNative::GetSharedDevManager()->EnsureInspectorPackagerConnection(
+                      devSettings->sourceBundleHost, devSettings->sourceBundlePort, devSettings->bundleAppId);
+                }
 
-            m_jsMessageThread.Load()->runOnQueueSync([&]() {
-              SetJSThreadDescription();
-              auto timerRegistry =
-                  ::Microsoft::ReactNative::TimerRegistry::CreateTimerRegistry(m_reactContext->Properties());
-              auto timerRegistryRaw = timerRegistry.get();
-
-              auto timerManager = std::make_shared<facebook::react::TimerManager>(std::move(timerRegistry));
-              timerRegistryRaw->setTimerManager(timerManager);
-
-              auto jsErrorHandlingFunc = [this](
-                                             facebook::jsi::Runtime &runtime,
-                                             const facebook::react::JsErrorHandler::ProcessedError &error) noexcept {
-                OnJSError(runtime, std::move(error));
-              };
-
-              if (devSettings->useDirectDebugger) {
-                ::Microsoft::ReactNative::GetSharedDevManager()->EnsureInspectorPackagerConnection(
-                    devSettings->sourceBundleHost, devSettings->sourceBundlePort, devSettings->bundleAppId);
+                auto hermesRuntimeHolder = std::make_shared<Microsoft::ReactNative::HermesRuntimeHolder>(
+                    devSettings,
+                    jsMessageThread,
+                    StartupTimeline::MakeRecordingScriptStore(CreatePreparedScriptStore(), m_startupTimeline));
+                m_jsiRuntimeHolder = hermesRuntimeHolder;
+                ReactPropertyBag(m_reactContext->Properties())
+                    .Set(
+                        Microsoft::ReactNative::HermesRuntimeHolderProperty(),
+                        std::weak_ptr<Microsoft::ReactNative::HermesRuntimeHolder>(hermesRuntimeHolder));
+                if (ReactOptions::CollectJSGarbageOnMemoryPressure(m_options.Properties)) {
+                  m_appMemoryUsageIncreasedRevoker = winrt::Windows::System::MemoryManager::AppMemoryUsageIncreased(
+                      winrt::auto_revoke,
+                      [weakHolder = std::weak_ptr(hermesRuntimeHolder)](
+                          const winrt::Windows::Foundation::IInspectable &,
+                          const winrt::Windows::Foundation::IInspectable &) noexcept {
+                        if (winrt::Windows::System::MemoryManager::AppMemoryUsageLevel() >=
+                            winrt::Windows::System::AppMemoryUsageLevel::High) {
+                          if (auto holder = weakHolder.lock()) {
+                            holder->collectGarbage("MemoryPressure");
+                          }
+                        }
+                      });
+                }
+                const bool sampleLongTaskJSStacks =
+                    ReactPropertyBag(m_options.Properties)
+                        .Get(winrt::Microsoft::ReactNative::implementation::ReactContext::LongTaskThresholdMsProperty())
+                        .value_or(0) > 0 &&
+                    ReactPropertyBag(m_options.Properties)
+                        .Get(winrt::Microsoft::ReactNative::implementation::ReactContext::
+                                 LongTaskJSStackSamplingEnabledProperty())
+                        .value_or(false);
+                if (sampleLongTaskJSStacks ||
+                    ReactPropertyBag(m_options.Properties)
+                        .Get(winrt::Microsoft::ReactNative::implementation::ReactContext::
+                                 ProductionProfilingEnabledProperty())
+                        .value_or(false)) {
+                  auto profiler = std::make_shared<Microsoft::ReactNative::HermesProductionProfiler>(
+                      hermesRuntimeHolder, jsMessageThread);
+                  if (sampleLongTaskJSStacks) {
+                    profiler->StartStackSampling();
+                  }
+                  ReactPropertyBag(m_reactContext->Properties())
+                      .Set(
+                          winrt::Microsoft::ReactNative::implementation::ReactContext::
+                              HermesProductionProfilerProperty(),
+                          std::move(profiler));
+                }
+                auto jsRuntime = std::make_unique<Microsoft::ReactNative::HermesJSRuntime>(m_jsiRuntimeHolder);
+                jsRuntime->getRuntime();
+
+                m_bridgelessReactInstance = std::make_shared<facebook::react::ReactInstance>(
+                    std::move(jsRuntime),
+                    jsMessageThread,
+                    timerManager,
+                    jsErrorHandlingFunc,
+                    m_options.InspectorHostTarget);
+
+                auto bufferedRuntimeExecutor = m_bridgelessReactInstance->getBufferedRuntimeExecutor();
+                timerManager->setRuntimeExecutor(bufferedRuntimeExecutor);
+
+                Microsoft::ReactNative::SchedulerSettings::SetRuntimeScheduler(
+                    winrt::Microsoft::ReactNative::ReactPropertyBag(m_options.Properties),
+                    m_bridgelessReactInstance->getRuntimeScheduler());
+
+                callInvoker = std::make_shared<facebook::react::RuntimeSchedulerCallInvoker>(
+                    m_bridgelessReactInstance->getRuntimeScheduler());
+
+                winrt::Microsoft::ReactNative::implementation::CallInvoker::SetProperties(
+                    ReactPropertyBag(m_options.Properties),
+                    winrt::make<winrt::Microsoft::ReactNative::implementation::CallInvoker>(
+                        *m_reactContext, std::shared_ptr<facebook::react::CallInvoker>(callInvoker)));
+              } catch (...) {
+                runtimeCreationError = std::current_exception();
               }
+            });
 
-              m_jsiRuntimeHolder = std::make_shared<Microsoft::ReactNative::HermesRuntimeHolder>(
-                  devSettings, jsMessageThread, CreatePreparedScriptStore());
-              auto jsRuntime = std::make_unique<Microsoft::ReactNative::HermesJSRuntime>(m_jsiRuntimeHolder);
-              jsRuntime->getRuntime();
-
-              m_bridgelessReactInstance = std::make_shared<facebook::react::ReactInstance>(
-                  std::move(jsRuntime),
-                  jsMessageThread,
-                  timerManager,
-                  jsErrorHandlingFunc,
-                  m_options.InspectorHostTarget);
-
-              auto bufferedRuntimeExecutor = m_bridgelessReactInstance->getBufferedRuntimeExecutor();
-              timerManager->setRuntimeExecutor(bufferedRuntimeExecutor);
-
-              Microsoft::ReactNative::SchedulerSettings::SetRuntimeScheduler(
-                  winrt::Microsoft::ReactNative::ReactPropertyBag(m_options.Properties),
-                  m_bridgelessReactInstance->getRuntimeScheduler());
-
-              callInvoker = std::make_shared<facebook::react::RuntimeSchedulerCallInvoker>(
-                  m_bridgelessReactInstance->getRuntimeScheduler());
+            m_startupTimeline->StartPhase(StartupPhase::ModuleRegistration);
+            LoadModules(devSettings, m_options.TurboModuleProvider);
+            m_startupTimeline->StopPhase(StartupPhase::ModuleRegistration);
 
-              winrt::Microsoft::ReactNative::implementation::CallInvoker::SetProperties(
-                  ReactPropertyBag(m_options.Properties),
-                  winrt::make<winrt::Microsoft::ReactNative::implementation::CallInvoker>(
-                      *m_reactContext, std::shared_ptr<facebook::react::CallInvoker>(callInvoker)));
-            });
+            {
+              // The JS queue is serial, so this returns once the runtime is created.
+              facebook::react::tracing::StartupPhaseScope waitPhase{"RuntimeCreationWait"};
+              m_jsMessageThread.Load()->runOnQueueSync([]() noexcept {});
+            }
+            if (runtimeCreationError) {
+              std::rethrow_exception(runtimeCreationError);
+            }
 
+            if (ReactPropertyBag(m_options.Properties)
+                    .Get(winrt::Microsoft::ReactNative::implementation::ReactContext::
+                             NativeModuleProfilerEnabledProperty())
+                    .value_or(false)) {
+              ReactPropertyBag(m_reactContext->Properties())
+                  .Set(
+                      winrt::Microsoft::ReactNative::implementation::ReactContext::NativeModuleProfilerProperty(),
+                      std::make_shared<winrt::Microsoft::ReactNative::NativeModuleProfiler>());
+            }
             m_options.TurboModuleProvider->SetReactContext(
                 winrt::make<implementation::ReactContext>(Mso::Copy(m_reactContext)));
 
@@ -590,13 +810,18 @@ void ReactInstanceWin::InitializeBridgeless() noexcept {
                   for (const auto &moduleName : turboModuleManager->getEagerInitModuleNames()) {
                     turboModuleManager->getModule(moduleName);
                   }
+                  m_startupTimeline->StopPhase(StartupPhase::RuntimeInit);
 
                   if (onCreated) {
                     onCreated.Get()->Invoke(reactContext);
                   }
                 });
 
-            LoadJSBundlesBridgeless(devSettings);
+            m_trimMemoryRevoker = TrimMemoryOnMemoryPressure(
+                winrt::Microsoft::ReactNative::ReactPropertyBag(m_options.Properties), m_options.TurboModuleProvider);
+
+            m_startupTimeline->StopPhase(StartupPhase::InstanceCreation);
+            LoadJSBundlesBridgeless(devSettings, std::move(bundleString));
             SetupHMRClient();
           } catch (std::exception &e) {
             OnErrorWithMessage(e.what());
@@ -639,7 +864,10 @@ void ReactInstanceWin::SetupHMRClient() noexcept {
   }
 }
 
-void ReactInstanceWin::LoadJSBundlesBridgeless(std::shared_ptr<facebook::react::DevSettings> devSettings) noexcept {
+void ReactInstanceWin::LoadJSBundlesBridgeless(
+    std::shared_ptr<facebook::react::DevSettings> devSettings,
+    std::unique_ptr<const facebook::react::JSBigString> bundleString) noexcept {
+  m_startupTimeline->StartPhase(StartupPhase::BundleLoad);
   if (m_isFastReloadEnabled) {
     // Getting bundle from the packager, so do everything async.
 
@@ -648,6 +876,8 @@ void ReactInstanceWin::LoadJSBundlesBridgeless(std::shared_ptr<facebook::react::
         ::Microsoft::ReactNative::GetSharedDevManager(),
         Mso::Copy(JavaScriptBundleFile()),
         [=](std::unique_ptr<const facebook::react::JSBigStdString> script, const std::string &sourceURL) {
+          m_startupTimeline->SetBundleByteCount(script->size());
+          m_startupTimeline->StartPhase(StartupPhase::FirstJSExecution);
           m_bridgelessReactInstance->loadScript(std::move(script), sourceURL);
         });
 
@@ -661,7 +891,18 @@ void ReactInstanceWin::LoadJSBundlesBridgeless(std::shared_ptr<facebook::react::
           }
         });
   } else {
-    auto bundleString = ::Microsoft::ReactNative::JsBigStringFromPath(devSettings, Mso::Copy(JavaScriptBundleFile()));
+    // The segments of a split bundle are files next to it, named after it and the segment id
+    ::Microsoft::ReactNative::SegmentFetcherModule::SetSegmentLoader(
+        ReactPropertyBag(m_reactContext->Properties()),
+        [devSettings, bundleFile = JavaScriptBundleFile()](uint32_t segmentId) {
+          return ::Microsoft::ReactNative::JsBigStringFromPath(
+              devSettings, bundleFile + "." + std::to_string(segmentId));
+        },
+        JavaScriptBundleFile());
+
+    // It waits for the rest of the bundle read, which is started with the runtime creation
+    m_startupTimeline->SetBundleByteCount(bundleString->size());
+    m_startupTimeline->StartPhase(StartupPhase::FirstJSExecution);
     m_bridgelessReactInstance->loadScript(std::move(bundleString), Mso::Copy(JavaScriptBundleFile()));
 
     m_jsMessageThread.Load()->runOnQueue(
@@ -684,6 +925,8 @@ void ReactInstanceWin::OnReactInstanceLoaded(const Mso::ErrorCode &errorCode) no
   bool isLoadedExpected = false;
   if (m_isLoaded.compare_exchange_strong(isLoadedExpected, true)) {
     if (!errorCode) {
+      m_startupTimeline->StopPhase(StartupPhase::FirstJSExecution);
+      m_startupTimeline->StopPhase(StartupPhase::BundleLoad);
       m_state = ReactInstanceState::Loaded;
       m_whenLoaded.SetValue();
       DrainJSCallQueue();
@@ -725,6 +968,8 @@ Mso::Future<void> ReactInstanceWin::Destroy() noexcept {
           // Release the JSI runtime
           std::scoped_lock lock{m_mutex};
 
+          this->m_appMemoryUsageIncreasedRevoker.revoke();
+          this->m_trimMemoryRevoker.revoke();
           this->m_jsiRuntimeHolder = nullptr;
           this->m_jsiRuntime = nullptr;
         }
@@ -949,6 +1194,7 @@ void ReactInstanceWin::CallJsFunction(
 }
 
 void ReactInstanceWin::DispatchEvent(int64_t viewTag, std::string &&eventName, folly::dynamic &&eventData) noexcept {
+  Mso::DispatchQueueMetrics::OriginScope originScope{"Event " + eventName};
   folly::dynamic params = folly::dynamic::array(viewTag, std::move(eventName), std::move(eventData));
   CallJsFunction("RCTEventEmitter", "receiveEvent", std::move(params));
 }
@@ -10,6 +10,7 @@
 #include "MsoReactContext.h"
 #include "ReactNativeHeaders.h"
 #include "React_win.h"
+#include "StartupTimeline.h"
 #include "activeObject/activeObject.h"
 
 #ifndef CORE_ABI
@@ -18,6 +19,7 @@
 #endif
 
 #include <react/runtime/ReactInstance.h>
+#include <winrt/Windows.System.h>
 
 namespace winrt::Microsoft::ReactNative {
 class TurboModulesProvider;
@@ -97,11 +99,15 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   void SetupHMRClient() noexcept;
 
   void InitializeBridgeless() noexcept;
-  void LoadJSBundlesBridgeless(std::shared_ptr<facebook::react::DevSettings> devSettings) noexcept;
+  // The bundleString is read ahead of time, unless the bundle comes from the packager
+  void LoadJSBundlesBridgeless(
+      std::shared_ptr<facebook::react::DevSettings> devSettings,
+      std::unique_ptr<const facebook::react::JSBigString> bundleString) noexcept;
 
   void InitUIQueue() noexcept;
   void InitDevMenu() noexcept;
   void InitUIDependentCalls() noexcept;
+  void PreconnectOrigins() noexcept;
   void FireInstanceCreatedCallback() noexcept;
 
   std::shared_ptr<facebook::react::DevSettings> CreateDevSettings() noexcept;
@@ -151,6 +157,7 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   const bool m_useDirectDebugger : 1;
 
   const Mso::CntPtr<::Mso::React::ReactContext> m_reactContext;
+  const std::shared_ptr<StartupTimeline> m_startupTimeline;
 
   std::atomic<bool> m_isLoaded{false};
   std::atomic<bool> m_isDestroyed{false};
@@ -171,6 +178,8 @@ class ReactInstanceWin final : public Mso::ActiveObject<IReactInstanceInternal>
   // Bridgeless
   std::shared_ptr<facebook::react::ReactInstance> m_bridgelessReactInstance;
   std::shared_ptr<Microsoft::JSI::RuntimeHolderLazyInit> m_jsiRuntimeHolder;
+  winrt::Windows::System::MemoryManager::AppMemoryUsageIncreased_revoker m_appMemoryUsageIncreasedRevoker; // JS thread
+  winrt::Windows::System::MemoryManager::AppMemoryUsageIncreased_revoker m_trimMemoryRevoker; // JS thread
   winrt::Microsoft::ReactNative::JsiRuntime m_jsiRuntime{nullptr};
 
   std::atomic<ReactInstanceState> m_state{ReactInstanceState::Loading};
@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "SharedJSThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+
+using namespace std::chrono_literals;
+
+namespace Mso::React {
+
+namespace {
+
+// Time a queue keeps a thread of the pool while it has tasks
+constexpr std::chrono::milliseconds TimeSlice{20ms};
+
+struct SharedJSThreadPool {
+  SharedJSThreadPool() noexcept {
+    InitializeThreadpoolEnvironment(&Environment);
+    Pool = CreateThreadpool(nullptr);
+    if (Pool) {
+      SetThreadpoolThreadMaximum(Pool, std::max(2u, std::thread::hardware_concurrency() / 2));
+      SetThreadpoolThreadMinimum(Pool, 1);
+      SetThreadpoolCallbackPool(&Environment, Pool);
+    }
+  }
+
+  // The pool lives as long as the process, since the instances that use it may be released at any time.
+  static SharedJSThreadPool &Get() noexcept {
+    static SharedJSThreadPool *pool = new SharedJSThreadPool();
+    return *pool;
+  }
+
+  PTP_POOL Pool{nullptr};
+  TP_CALLBACK_ENVIRON Environment;
+};
+
+struct SharedJSThreadPoolScheduler : Mso::UnknownObject<IDispatchQueueScheduler> {
+  SharedJSThreadPoolScheduler() noexcept {
+    auto &pool = SharedJSThreadPool::Get();
+    // Without the pool, the queue runs on the default thread pool of the process
+    m_work = CreateThreadpoolWork(&WorkCallback, this, pool.Pool ? &pool.Environment : nullptr);
+    VerifyElseCrash(m_work);
+  }
+
+  ~SharedJSThreadPoolScheduler() noexcept override {
+    AwaitTermination();
+    CloseThreadpoolWork(m_work);
+  }
+
+  static void CALLBACK WorkCallback(PTP_CALLBACK_INSTANCE, PVOID context, PTP_WORK) noexcept {
+    // The scheduler is alive here, because it waits for its work callbacks before it is destroyed.
+    auto self = static_cast<SharedJSThreadPoolScheduler *>(context);
+    auto previousScheduler = std::exchange(tls_scheduler, self);
+
+    if (auto queue = self->m_queue.GetStrongPtr()) {
+      auto endTime = std::chrono::steady_clock::now() + TimeSlice;
+      DispatchTask task;
+      while (queue->TryDequeTask(task)) {
+        queue->InvokeTask(std::move(task), endTime);
+        if (std::chrono::steady_clock::now() > endTime) {
+          break;
+        }
+      }
+
+      self->m_isScheduled = false;
+      if (queue->HasTasks()) {
+        self->Post();
+      }
+    }
+
+    tls_scheduler = previousScheduler;
+  }
+
+ public: // IDispatchQueueScheduler
+  void InitializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override {
+    m_queue = std::move(queue);
+  }
+
+  bool HasThreadAccess() noexcept override {
+    return tls_scheduler == this;
+  }
+
+  bool IsSerial() noexcept override {
+    return true;
+  }
+
+  void Post() noexcept override {
+    // The queue is serial, so it has at most one work item submitted to the pool at a time
+    if (!m_isScheduled.exchange(true)) {
+      SubmitThreadpoolWork(m_work);
+    }
+  }
+
+  void Shutdown() noexcept override {}
+
+  void AwaitTermination() noexcept override {
+    // A queue released from one of its own tasks cannot wait for it
+    if (tls_scheduler != this) {
+      WaitForThreadpoolWorkCallbacks(m_work, false);
+    }
+  }
+
+ private:
+  PTP_WORK m_work{nullptr};
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+  std::atomic<bool> m_isScheduled{false};
+  static thread_local SharedJSThreadPoolScheduler *tls_scheduler;
+};
+
+thread_local SharedJSThreadPoolScheduler *SharedJSThreadPoolScheduler::tls_scheduler{nullptr};
+
+} // namespace
+
+Mso::DispatchQueue MakeSharedJSThreadPoolQueue() noexcept {
+  return Mso::DispatchQueue::MakeCustomQueue(Mso::Make<SharedJSThreadPoolScheduler, IDispatchQueueScheduler>());
+}
+
+} // namespace Mso::React
@@ -0,0 +1,17 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <dispatchQueue/dispatchQueue.h>
+
+namespace Mso::React {
+
+// Makes a serial queue for the JS thread of an instance that shares a process-wide thread pool with the JS queues of
+// the other instances, instead of having a thread of its own.  The pool has one thread per two cores, and at least
+// two, so that a process that hosts many small instances does not have as many idle threads.  A queue runs its tasks
+// on one thread of the pool at a time, and gives the thread back after a few milliseconds so that a busy instance does
+// not hold it from the others.
+Mso::DispatchQueue MakeSharedJSThreadPoolQueue() noexcept;
+
+} // namespace Mso::React
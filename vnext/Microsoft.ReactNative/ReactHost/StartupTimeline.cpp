@@ -0,0 +1,205 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "StartupTimeline.h"
+
+namespace Mso::React {
+
+using namespace winrt::Microsoft::ReactNative;
+
+static const ReactPropertyId<ReactNonAbiValue<std::shared_ptr<StartupTimeline>>> &StartupTimelinePropertyId() noexcept {
+  static const ReactPropertyId<ReactNonAbiValue<std::shared_ptr<StartupTimeline>>> prop{
+      L"ReactNative.Startup", L"StartupTimeline"};
+  return prop;
+}
+
+static StartupTimeline::Clock::duration TimeSinceProcessStart() noexcept {
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+    return {};
+  }
+
+  FILETIME now;
+  GetSystemTimePreciseAsFileTime(&now);
+  auto toTicks = [](const FILETIME &time) noexcept {
+    return (static_cast<int64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+  };
+  // FILETIME ticks are 100 nanoseconds
+  return std::chrono::duration_cast<StartupTimeline::Clock::duration>(
+      std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>{toTicks(now) - toTicks(creationTime)});
+}
+
+StartupTimeline::StartupTimeline() noexcept
+    : m_originTime{Clock::now()}, m_processStartToOrigin{TimeSinceProcessStart()} {}
+
+/*static*/ std::shared_ptr<StartupTimeline> StartupTimeline::Get(const ReactPropertyBag &properties) noexcept {
+  if (auto timeline = properties.Get(StartupTimelinePropertyId())) {
+    return *timeline;
+  }
+  return nullptr;
+}
+
+/*static*/ std::shared_ptr<StartupTimeline> StartupTimeline::Reset(const ReactPropertyBag &properties) noexcept {
+  auto timeline = std::make_shared<StartupTimeline>();
+  properties.Set(StartupTimelinePropertyId(), timeline);
+  return timeline;
+}
+
+/*static*/ std::shared_ptr<StartupTimeline> StartupTimeline::ForNewInstance(
+    const ReactPropertyBag &properties) noexcept {
+  auto timeline = Get(properties);
+  if (!timeline || timeline->HasStarted(StartupPhase::InstanceCreation)) {
+    timeline = Reset(properties);
+  }
+  return timeline;
+}
+
+void StartupTimeline::StartPhase(StartupPhase phase) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto &times = m_phases[static_cast<size_t>(phase)];
+  if (!times.IsStarted) {
+    times.IsStarted = true;
+    times.StartTime = Clock::now();
+    times.ActivityId = facebook::react::tracing::logStartupPhaseStart(PhaseName(phase));
+  }
+}
+
+void StartupTimeline::StopPhase(StartupPhase phase) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto &times = m_phases[static_cast<size_t>(phase)];
+  if (times.IsStarted && !times.IsStopped) {
+    times.IsStopped = true;
+    times.StopTime = Clock::now();
+    auto durationMs = std::chrono::duration<double, std::milli>(times.StopTime - times.StartTime).count();
+    if (phase == StartupPhase::BundleLoad) {
+      facebook::react::tracing::logBundleLoadStop(times.ActivityId, durationMs, m_bundleByteCount, m_bundleCacheHit);
+    } else {
+      facebook::react::tracing::logStartupPhaseStop(PhaseName(phase), times.ActivityId, durationMs);
+    }
+  }
+}
+
+bool StartupTimeline::HasStarted(StartupPhase phase) const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_phases[static_cast<size_t>(phase)].IsStarted;
+}
+
+void StartupTimeline::SetBundleByteCount(uint64_t byteCount) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_bundleByteCount = byteCount;
+}
+
+void StartupTimeline::SetBundleCacheHit(bool cacheHit) noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_bundleCacheHit = cacheHit;
+}
+
+void StartupTimeline::WriteReport(const IJSValueWriter &writer) const noexcept {
+  auto toMs = [](Clock::duration time) noexcept { return std::chrono::duration<double, std::milli>(time).count(); };
+
+  std::scoped_lock lock{m_mutex};
+  writer.WriteObjectBegin();
+  writer.WritePropertyName(L"processStartToHostCreationMs");
+  writer.WriteDouble(toMs(m_processStartToOrigin));
+
+  writer.WritePropertyName(L"phases");
+  writer.WriteArrayBegin();
+  for (size_t i = 0; i < m_phases.size(); ++i) {
+    const auto &times = m_phases[i];
+    if (!times.IsStarted) {
+      continue;
+    }
+
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"name");
+    writer.WriteString(winrt::to_hstring(PhaseName(static_cast<StartupPhase>(i))));
+    writer.WritePropertyName(L"startMs");
+    writer.WriteDouble(toMs(times.StartTime - m_originTime));
+    if (times.IsStopped) {
+      writer.WritePropertyName(L"durationMs");
+      writer.WriteDouble(toMs(times.StopTime - times.StartTime));
+    }
+    writer.WriteObjectEnd();
+  }
+  writer.WriteArrayEnd();
+
+  writer.WritePropertyName(L"bundleByteCount");
+  writer.WriteInt64(static_cast<int64_t>(m_bundleByteCount));
+  writer.WritePropertyName(L"bundleCacheHit");
+  writer.WriteBoolean(m_bundleCacheHit);
+
+  const auto &firstMount = m_phases[static_cast<size_t>(StartupPhase::FirstMount)];
+  if (firstMount.IsStopped) {
+    writer.WritePropertyName(L"timeToFirstMountMs");
+    writer.WriteDouble(toMs(firstMount.StopTime - m_originTime));
+  }
+  writer.WriteObjectEnd();
+}
+
+/*static*/ const char *StartupTimeline::PhaseName(StartupPhase phase) noexcept {
+  switch (phase) {
+    case StartupPhase::HostCreation:
+      return "HostCreation";
+    case StartupPhase::InstanceCreation:
+      return "InstanceCreation";
+    case StartupPhase::ModuleRegistration:
+      return "ModuleRegistration";
+    case StartupPhase::RuntimeInit:
+      return "RuntimeInit";
+    case StartupPhase::BundleLoad:
+      return "BundleLoad";
+    case StartupPhase::FirstJSExecution:
+      return "FirstJSExecution";
+    case StartupPhase::FirstCommit:
+      return "FirstCommit";
+    case StartupPhase::FirstMount:
+      return "FirstMount";
+    default:
+      return "Unknown";
+  }
+}
+
+namespace {
+
+struct RecordingScriptStore final : facebook::jsi::PreparedScriptStore {
+  RecordingScriptStore(
+      std::shared_ptr<facebook::jsi::PreparedScriptStore> &&scriptStore,
+      const std::shared_ptr<StartupTimeline> &timeline) noexcept
+      : m_scriptStore{std::move(scriptStore)}, m_timeline{timeline} {}
+
+  std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override {
+    auto preparedScript = m_scriptStore->tryGetPreparedScript(scriptSignature, runtimeSignature, prepareTag);
+    if (auto timeline = m_timeline.lock()) {
+      timeline->SetBundleCacheHit(preparedScript != nullptr);
+    }
+    return preparedScript;
+  }
+
+  void persistPreparedScript(
+      std::shared_ptr<const facebook::jsi::Buffer> preparedScript,
+      const facebook::jsi::ScriptSignature &scriptMetadata,
+      const facebook::jsi::JSRuntimeSignature &runtimeMetadata,
+      const char *prepareTag) noexcept override {
+    m_scriptStore->persistPreparedScript(std::move(preparedScript), scriptMetadata, runtimeMetadata, prepareTag);
+  }
+
+ private:
+  std::shared_ptr<facebook::jsi::PreparedScriptStore> m_scriptStore;
+  std::weak_ptr<StartupTimeline> m_timeline;
+};
+
+} // namespace
+
+/*static*/ std::shared_ptr<facebook::jsi::PreparedScriptStore> StartupTimeline::MakeRecordingScriptStore(
+    std::shared_ptr<facebook::jsi::PreparedScriptStore> &&scriptStore,
+    const std::shared_ptr<StartupTimeline> &timeline) noexcept {
+  if (!scriptStore) {
+    return nullptr;
+  }
+  return std::make_shared<RecordingScriptStore>(std::move(scriptStore), timeline);
+}
+
+} // namespace Mso::React
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <JSI/ScriptStore.h>
+#include <ReactPropertyBag.h>
+#include <tracing/tracing.h>
+#include <winrt/Microsoft.ReactNative.h>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace Mso::React {
+
+// The phases of a cold start. FirstJSExecution is the evaluation of the bundle, FirstCommit is from starting the first
+// surface to its first committed tree, and FirstMount is from that commit to its mount, which is the first frame.
+enum class StartupPhase {
+  HostCreation,
+  InstanceCreation,
+  ModuleRegistration,
+  RuntimeInit,
+  BundleLoad,
+  FirstJSExecution,
+  FirstCommit,
+  FirstMount,
+  Count,
+};
+
+// The timeline of the cold start of a React instance, from the creation of its host to its first mount.
+// Each phase is only recorded the first time that it starts and stops, and it is logged as an ETW activity.
+// The timeline is kept in the instance properties. All methods are thread safe.
+class StartupTimeline final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  StartupTimeline() noexcept;
+
+  StartupTimeline(const StartupTimeline &) = delete;
+  StartupTimeline &operator=(const StartupTimeline &) = delete;
+
+  // Returns nullptr when no instance was created with the properties yet
+  static std::shared_ptr<StartupTimeline> Get(
+      const winrt::Microsoft::ReactNative::ReactPropertyBag &properties) noexcept;
+  // Replaces the timeline of the properties, when their host starts to create a new instance
+  static std::shared_ptr<StartupTimeline> Reset(
+      const winrt::Microsoft::ReactNative::ReactPropertyBag &properties) noexcept;
+  // Returns the timeline that the host started, or a new one when an earlier instance already used it
+  static std::shared_ptr<StartupTimeline> ForNewInstance(
+      const winrt::Microsoft::ReactNative::ReactPropertyBag &properties) noexcept;
+
+  void StartPhase(StartupPhase phase) noexcept;
+  void StopPhase(StartupPhase phase) noexcept;
+  bool HasStarted(StartupPhase phase) const noexcept;
+
+  void SetBundleByteCount(uint64_t byteCount) noexcept;
+  void SetBundleCacheHit(bool cacheHit) noexcept;
+
+  // Writes an object with the time from the process start to the host creation as processStartToHostCreationMs, the
+  // started phases in the phases array with their name, startMs and durationMs relative to the host creation, the
+  // bundleByteCount and bundleCacheHit, and the timeToFirstMountMs once the first frame is mounted.
+  void WriteReport(const winrt::Microsoft::ReactNative::IJSValueWriter &writer) const noexcept;
+
+  // Records in the timeline whether the prepared script of the bundle was found in the store
+  static std::shared_ptr<facebook::jsi::PreparedScriptStore> MakeRecordingScriptStore(
+      std::shared_ptr<facebook::jsi::PreparedScriptStore> &&scriptStore,
+      const std::shared_ptr<StartupTimeline> &timeline) noexcept;
+
+ private:
+  struct PhaseTimes {
+    Clock::time_point StartTime;
+    Clock::time_point StopTime;
+    facebook::react::tracing::ActivityId ActivityId{};
+    bool IsStarted{false};
+    bool IsStopped{false};
+  };
+
+  static const char *PhaseName(StartupPhase phase) noexcept;
+
+ private:
+  const Clock::time_point m_originTime;
+  const Clock::duration m_processStartToOrigin;
+  mutable std::mutex m_mutex;
+  std::array<PhaseTimes, static_cast<size_t>(StartupPhase::Count)> m_phases;
+  uint64_t m_bundleByteCount{0};
+  bool m_bundleCacheHit{false};
+};
+
+} // namespace Mso::React
@@ -111,6 +111,30 @@ void ReactInstanceSettings::EnableDefaultCrashHandler(bool value) noexcept {
   Mso::React::ReactOptions::SetEnableDefaultCrashHandler(m_properties, value);
 }
 
+bool ReactInstanceSettings::CollectJSGarbageInBackground() noexcept {
+  return Mso::React::ReactOptions::CollectJSGarbageInBackground(m_properties);
+}
+
+void ReactInstanceSettings::CollectJSGarbageInBackground(bool value) noexcept {
+  Mso::React::ReactOptions::SetCollectJSGarbageInBackground(m_properties, value);
+}
+
+bool ReactInstanceSettings::CollectJSGarbageOnMemoryPressure() noexcept {
+  return Mso::React::ReactOptions::CollectJSGarbageOnMemoryPressure(m_properties);
+}
+
+void ReactInstanceSettings::CollectJSGarbageOnMemoryPressure(bool value) noexcept {
+  Mso::React::ReactOptions::SetCollectJSGarbageOnMemoryPressure(m_properties, value);
+}
+
+bool ReactInstanceSettings::UseSharedJSThreadPool() noexcept {
+  return Mso::React::ReactOptions::UseSharedJSThreadPool(m_properties);
+}
+
+void ReactInstanceSettings::UseSharedJSThreadPool(bool value) noexcept {
+  Mso::React::ReactOptions::SetUseSharedJSThreadPool(m_properties, value);
+}
+
 bool ReactInstanceSettings::EnableDeveloperMenu() noexcept {
   return UseDeveloperSupport();
 }
@@ -57,6 +57,8 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
 
   winrt::Windows::Foundation::Collections::IVector<IReactPackageProvider> PackageProviders() noexcept;
 
+  winrt::Windows::Foundation::Collections::IVector<hstring> PreconnectOrigins() noexcept;
+
   //! This controls the availability of various developer support functionality including
   //! RedBox, and the Developer Menu
   bool UseDeveloperSupport() noexcept;
@@ -102,6 +104,15 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   bool EnableDefaultCrashHandler() noexcept;
   void EnableDefaultCrashHandler(bool value) noexcept;
 
+  bool CollectJSGarbageInBackground() noexcept;
+  void CollectJSGarbageInBackground(bool value) noexcept;
+
+  bool CollectJSGarbageOnMemoryPressure() noexcept;
+  void CollectJSGarbageOnMemoryPressure(bool value) noexcept;
+
+  bool UseSharedJSThreadPool() noexcept;
+  void UseSharedJSThreadPool(bool value) noexcept;
+
   //! Same as UseDeveloperSupport
   bool EnableDeveloperMenu() noexcept;
   void EnableDeveloperMenu(bool value) noexcept;
@@ -172,6 +183,7 @@ struct ReactInstanceSettings : ReactInstanceSettingsT<ReactInstanceSettings> {
   IReactNotificationService m_notifications{ReactNotificationServiceHelper::CreateNotificationService()};
   ::winrt::Windows::Foundation::Collections::IVector<IReactPackageProvider> m_packageProviders{
       single_threaded_vector<IReactPackageProvider>()};
+  ::winrt::Windows::Foundation::Collections::IVector<hstring> m_preconnectOrigins{single_threaded_vector<hstring>()};
   hstring m_javaScriptBundleFile{};
   hstring m_bundleAppId{};
   bool m_devBundle{true};
@@ -217,6 +229,10 @@ ReactInstanceSettings::PackageProviders() noexcept {
   return m_packageProviders;
 }
 
+inline winrt::Windows::Foundation::Collections::IVector<hstring> ReactInstanceSettings::PreconnectOrigins() noexcept {
+  return m_preconnectOrigins;
+}
+
 inline hstring ReactInstanceSettings::JavaScriptBundleFile() noexcept {
   return m_javaScriptBundleFile;
 }
@@ -3,13 +3,20 @@
 
 #include "pch.h"
 #include "ReactNativeHost.h"
+#include "LongTaskEventArgs.g.cpp"
 #include "ReactNativeHost.g.cpp"
 
+#include "HermesRuntimeHolder.h"
 #include "ReactPackageBuilder.h"
 #include "RedBox.h"
+#include "ReactHost/BackgroundMode.h"
+#include "ReactHost/CacheBudgetManager.h"
+#include "ReactHost/MemoryReport.h"
+#include "ReactHost/StartupTimeline.h"
 #include "TurboModulesProvider.h"
 
 #include <future/futureWinRT.h>
+#include <tracing/tracing.h>
 #include <winrt/Windows.Foundation.Collections.h>
 #include "IReactContext.h"
 #include "ReactInstanceSettings.h"
@@ -28,6 +35,44 @@ using namespace Windows::Foundation::Collections;
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
+LongTaskEventArgs::LongTaskEventArgs(
+    hstring queueName,
+    hstring taskName,
+    hstring origin,
+    double waitTimeMs,
+    double runTimeMs,
+    hstring jsStack) noexcept
+    : m_queueName{std::move(queueName)},
+      m_taskName{std::move(taskName)},
+      m_origin{std::move(origin)},
+      m_waitTimeMs{waitTimeMs},
+      m_runTimeMs{runTimeMs},
+      m_jsStack{std::move(jsStack)} {}
+
+hstring LongTaskEventArgs::QueueName() noexcept {
+  return m_queueName;
+}
+
+hstring LongTaskEventArgs::TaskName() noexcept {
+  return m_taskName;
+}
+
+hstring LongTaskEventArgs::Origin() noexcept {
+  return m_origin;
+}
+
+double LongTaskEventArgs::WaitTimeMs() noexcept {
+  return m_waitTimeMs;
+}
+
+double LongTaskEventArgs::RunTimeMs() noexcept {
+  return m_runTimeMs;
+}
+
+hstring LongTaskEventArgs::JSStack() noexcept {
+  return m_jsStack;
+}
+
 ReactNativeHost::ReactNativeHost() noexcept : m_reactHost{Mso::React::MakeReactHost()} {
 #if _DEBUG
   facebook::react::InitializeLogging([](facebook::react::RCTLogLevel /*logLevel*/, const char *message) {
@@ -82,6 +127,13 @@ ReactNativeHostProperty() noexcept {
 }
 
 IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
+  return make<Mso::AsyncActionFutureAdapter>(ReloadReactHost());
+}
+
+Mso::Future<void> ReactNativeHost::ReloadReactHost() noexcept {
+  auto startupTimeline = Mso::React::StartupTimeline::Reset(ReactPropertyBag(InstanceSettings().Properties()));
+  startupTimeline->StartPhase(Mso::React::StartupPhase::HostCreation);
+
   auto turboModulesProvider = std::make_shared<TurboModulesProvider>();
 
   auto uriImageManager =
@@ -121,6 +173,9 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
   reactOptions.SetUseLiveReload(m_instanceSettings.UseLiveReload());
   reactOptions.EnableJITCompilation = m_instanceSettings.EnableJITCompilation();
   reactOptions.BundleRootPath = to_string(m_instanceSettings.BundleRootPath());
+  for (auto const &origin : m_instanceSettings.PreconnectOrigins()) {
+    reactOptions.PreconnectOrigins.push_back(to_string(origin));
+  }
   reactOptions.DeveloperSettings.DebuggerPort = m_instanceSettings.DebuggerPort();
   reactOptions.DeveloperSettings.DebuggerRuntimeName = to_string(m_instanceSettings.DebuggerRuntimeName());
   if (m_instanceSettings.RedBoxHandler()) {
@@ -174,13 +229,129 @@ IAsyncAction ReactNativeHost::ReloadInstance() noexcept {
   }
 
   reactOptions.Identity = jsBundleFile;
-  return make<Mso::AsyncActionFutureAdapter>(m_reactHost->ReloadInstanceWithOptions(std::move(reactOptions)));
+  startupTimeline->StopPhase(Mso::React::StartupPhase::HostCreation);
+  return m_reactHost->ReloadInstanceWithOptions(std::move(reactOptions));
 }
 
 IAsyncAction ReactNativeHost::UnloadInstance() noexcept {
   return make<Mso::AsyncActionFutureAdapter>(m_reactHost->UnloadInstance());
 }
 
+IAsyncAction ReactNativeHost::PrewarmInstance() noexcept {
+  // The packages are only created again when a new instance is loaded
+  return make<Mso::AsyncActionFutureAdapter>(
+      m_reactHost->PrewarmInstance([weakThis = get_weak()]() noexcept -> Mso::Future<void> {
+        if (auto strongThis = weakThis.get()) {
+          return strongThis->ReloadReactHost();
+        }
+        return Mso::MakeCanceledFuture();
+      }));
+}
+
+void ReactNativeHost::WriteStartupReport(IJSValueWriter const &writer) noexcept {
+  if (auto startupTimeline = Mso::React::StartupTimeline::Get(ReactPropertyBag(InstanceSettings().Properties()))) {
+    startupTimeline->WriteReport(writer);
+  } else {
+    writer.WriteNull();
+  }
+}
+
+void ReactNativeHost::CollectJSGarbage() noexcept {
+  if (auto runtimeHolder = ReactPropertyBag(InstanceSettings().Properties())
+                               .Get(::Microsoft::ReactNative::HermesRuntimeHolderProperty())) {
+    if (auto strongRuntimeHolder = runtimeHolder->lock()) {
+      strongRuntimeHolder->collectGarbage("Host");
+    }
+  }
+}
+
+void ReactNativeHost::WriteMemoryReport(IJSValueWriter const &writer) noexcept {
+  Mso::React::WriteMemoryReport(
+      Mso::React::CollectMemoryUsage(
+          ReactPropertyBag(InstanceSettings().Properties()), m_reactHost->Options().TurboModuleProvider),
+      writer);
+}
+
+void ReactNativeHost::WriteUserTimingReport(IJSValueWriter const &writer) noexcept {
+  writer.WriteArrayBegin();
+  for (const auto &entry : facebook::react::tracing::getReactPerfEntries()) {
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"name");
+    writer.WriteString(winrt::to_hstring(entry.name));
+    writer.WritePropertyName(L"entryType");
+    writer.WriteString(entry.isMark ? L"mark" : L"measure");
+    writer.WritePropertyName(L"startTime");
+    writer.WriteDouble(static_cast<double>(entry.startTimeUs) / 1000);
+    writer.WritePropertyName(L"duration");
+    writer.WriteDouble(static_cast<double>(entry.endTimeUs - entry.startTimeUs) / 1000);
+    if (!entry.track.empty()) {
+      writer.WritePropertyName(L"track");
+      writer.WriteString(winrt::to_hstring(entry.track));
+    }
+    writer.WriteObjectEnd();
+  }
+  writer.WriteArrayEnd();
+}
+
+bool ReactNativeHost::IsInBackground() noexcept {
+  return Mso::React::BackgroundMode::FromProperties(ReactPropertyBag(InstanceSettings().Properties()))
+      ->IsInBackground();
+}
+
+void ReactNativeHost::IsInBackground(bool value) noexcept {
+  ReactPropertyBag properties{InstanceSettings().Properties()};
+  auto backgroundMode = Mso::React::BackgroundMode::FromProperties(properties);
+  if (backgroundMode->IsInBackground() == value) {
+    return;
+  }
+  backgroundMode->IsInBackground(value);
+  if (!value) {
+    return;
+  }
+
+  auto cacheBudgetManager = Mso::React::CacheBudgetManager::FromProperties(properties);
+  cacheBudgetManager->TrimToBudget(cacheBudgetManager->BackgroundBudget());
+
+  if (Mso::React::ReactOptions::CollectJSGarbageInBackground(properties.Handle())) {
+    if (auto runtimeHolder = properties.Get(::Microsoft::ReactNative::HermesRuntimeHolderProperty())) {
+      if (auto strongRuntimeHolder = runtimeHolder->lock()) {
+        strongRuntimeHolder->collectGarbage("Background");
+      }
+    }
+  }
+}
+
+uint32_t ReactNativeHost::LongTaskThresholdMs() noexcept {
+  return ReactPropertyBag(InstanceSettings().Properties()).Get(ReactContext::LongTaskThresholdMsProperty()).value_or(0);
+}
+
+void ReactNativeHost::LongTaskThresholdMs(uint32_t value) noexcept {
+  ReactPropertyBag(InstanceSettings().Properties()).Set(ReactContext::LongTaskThresholdMsProperty(), value);
+}
+
+bool ReactNativeHost::SampleLongTaskJSStacks() noexcept {
+  return ReactPropertyBag(InstanceSettings().Properties())
+      .Get(ReactContext::LongTaskJSStackSamplingEnabledProperty())
+      .value_or(false);
+}
+
+void ReactNativeHost::SampleLongTaskJSStacks(bool value) noexcept {
+  ReactPropertyBag(InstanceSettings().Properties()).Set(ReactContext::LongTaskJSStackSamplingEnabledProperty(), value);
+}
+
+winrt::event_token ReactNativeHost::LongTaskDetected(
+    winrt::Windows::Foundation::EventHandler<ReactNative::LongTaskEventArgs> const &handler) {
+  return m_longTaskDetectedEvent.add(handler);
+}
+
+void ReactNativeHost::LongTaskDetected(winrt::event_token const &token) noexcept {
+  m_longTaskDetectedEvent.remove(token);
+}
+
+void ReactNativeHost::RaiseLongTaskDetected(ReactNative::LongTaskEventArgs const &args) noexcept {
+  m_longTaskDetectedEvent(*this, args);
+}
+
 Mso::React::IReactHost *ReactNativeHost::ReactHost() noexcept {
   return m_reactHost.Get();
 }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "LongTaskEventArgs.g.h"
 #include "ReactNativeHost.g.h"
 
 #include "ReactHost/React.h"
@@ -11,6 +12,31 @@
 
 namespace winrt::Microsoft::ReactNative::implementation {
 
+struct LongTaskEventArgs : LongTaskEventArgsT<LongTaskEventArgs> {
+  LongTaskEventArgs(
+      hstring queueName,
+      hstring taskName,
+      hstring origin,
+      double waitTimeMs,
+      double runTimeMs,
+      hstring jsStack) noexcept;
+
+  hstring QueueName() noexcept;
+  hstring TaskName() noexcept;
+  hstring Origin() noexcept;
+  double WaitTimeMs() noexcept;
+  double RunTimeMs() noexcept;
+  hstring JSStack() noexcept;
+
+ private:
+  const hstring m_queueName;
+  const hstring m_taskName;
+  const hstring m_origin;
+  const double m_waitTimeMs;
+  const double m_runTimeMs;
+  const hstring m_jsStack;
+};
+
 // WinRT ABI-safe implementation of ReactHost.
 struct ReactNativeHost : ReactNativeHostT<ReactNativeHost> {
  public: // ReactNativeHost ABI API
@@ -28,16 +54,35 @@ struct ReactNativeHost : ReactNativeHostT<ReactNativeHost> {
   winrt::Windows::Foundation::IAsyncAction LoadInstance() noexcept;
   winrt::Windows::Foundation::IAsyncAction ReloadInstance() noexcept;
   winrt::Windows::Foundation::IAsyncAction UnloadInstance() noexcept;
+  winrt::Windows::Foundation::IAsyncAction PrewarmInstance() noexcept;
+  void WriteStartupReport(IJSValueWriter const &writer) noexcept;
+  void CollectJSGarbage() noexcept;
+  void WriteMemoryReport(IJSValueWriter const &writer) noexcept;
+  void WriteUserTimingReport(IJSValueWriter const &writer) noexcept;
+  bool IsInBackground() noexcept;
+  void IsInBackground(bool value) noexcept;
+  uint32_t LongTaskThresholdMs() noexcept;
+  void LongTaskThresholdMs(uint32_t value) noexcept;
+  bool SampleLongTaskJSStacks() noexcept;
+  void SampleLongTaskJSStacks(bool value) noexcept;
+  winrt::event_token LongTaskDetected(
+      winrt::Windows::Foundation::EventHandler<ReactNative::LongTaskEventArgs> const &handler);
+  void LongTaskDetected(winrt::event_token const &token) noexcept;
 
  public:
   Mso::React::IReactHost *ReactHost() noexcept;
+  // Called on the thread of the long task
+  void RaiseLongTaskDetected(ReactNative::LongTaskEventArgs const &args) noexcept;
   static ReactNative::ReactNativeHost GetReactNativeHost(ReactPropertyBag const &properties) noexcept;
 
  private:
+  Mso::Future<void> ReloadReactHost() noexcept;
+
   Mso::CntPtr<Mso::React::IReactHost> m_reactHost;
 
   ReactNative::ReactInstanceSettings m_instanceSettings{nullptr};
   ReactNative::IReactPackageBuilder m_packageBuilder;
+  winrt::event<winrt::Windows::Foundation::EventHandler<ReactNative::LongTaskEventArgs>> m_longTaskDetectedEvent;
 };
 
 } // namespace winrt::Microsoft::ReactNative::implementation
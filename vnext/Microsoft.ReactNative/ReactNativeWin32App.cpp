@@ -14,6 +14,7 @@
 #include "winrt/Microsoft.UI.Dispatching.h"
 #include "winrt/Microsoft.UI.Interop.h"
 #include "winrt/Microsoft.UI.Windowing.h"
+#include "winrt/Windows.UI.ViewManagement.h"
 
 // Scaling factor for the window's content based on the DPI of the display where the window is located.
 float ScaleFactor(HWND hwnd) noexcept {
@@ -139,11 +140,22 @@ void ReactNativeWin32App::Start() {
     m_reactNativeIsland = winrt::Microsoft::ReactNative::ReactNativeIsland(m_compositor);
   }
 
+  // Fill the window with the system background until the first frame of the app is mounted, rather than leaving it
+  // empty while the JavaScript runtime starts
+  if (!m_reactNativeIsland.Placeholder()) {
+    auto placeholder = m_compositor.CreateSpriteVisual();
+    placeholder.Brush(m_compositor.CreateColorBrush(winrt::Windows::UI::ViewManagement::UISettings().GetColorValue(
+        winrt::Windows::UI::ViewManagement::UIColorType::Background)));
+    m_reactNativeIsland.Placeholder(placeholder);
+  }
+
   m_reactNativeIsland.ReactViewHost(
       winrt::Microsoft::ReactNative::ReactCoreInjection::MakeViewHost(ReactNativeHost(), ReactViewOptions()));
 
-  // Update the size of the RootView when the AppWindow changes size
-  m_appWindow.Changed([wkRootView = winrt::make_weak(m_reactNativeIsland)](
+  // Update the size of the RootView when the AppWindow changes size, and put the app in the background while the
+  // AppWindow is minimized or hidden
+  m_appWindow.Changed([wkRootView = winrt::make_weak(m_reactNativeIsland),
+                       wkHost = winrt::make_weak(ReactNativeHost())](
                           winrt::Microsoft::UI::Windowing::AppWindow const &window,
                           winrt::Microsoft::UI::Windowing::AppWindowChangedEventArgs const &args) {
     if (args.DidSizeChange() || args.DidVisibilityChange()) {
@@ -151,6 +163,13 @@ void ReactNativeWin32App::Start() {
         UpdateRootViewSizeToAppWindow(rootView, window);
       }
     }
+
+    if (auto host = wkHost.get()) {
+      auto presenter = window.Presenter().try_as<winrt::Microsoft::UI::Windowing::OverlappedPresenter>();
+      host.IsInBackground(
+          !window.IsVisible() ||
+          (presenter && presenter.State() == winrt::Microsoft::UI::Windowing::OverlappedPresenterState::Minimized));
+    }
   });
 
   // Quit application when main window is closed
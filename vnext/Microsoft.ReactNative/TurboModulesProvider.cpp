@@ -11,10 +11,14 @@
 #include <ReactCommon/TurboModuleUtils.h>
 #include <react/bridging/EventEmitter.h>
 #include "CallInvokerWriter.h"
+#include "IReactDispatcher.h"
+#include "JSI/JsiSyncMethod.h"
+#include "JSValueTreeReader.h"
 #include "JSValueWriter.h"
 #include "JsiApi.h"
 #include "JsiReader.h"
 #include "JsiWriter.h"
+#include "NativeModuleProfiler.h"
 #ifdef __APPLE__
 #include "Crash.h"
 #else
@@ -33,9 +37,29 @@ namespace winrt::Microsoft::ReactNative {
 struct TurboModuleMethodInfo {
   MethodReturnType ReturnType;
   MethodDelegate Method;
+  MethodDispatcher Dispatcher{MethodDispatcher::JS};
 };
 
-struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBuilder> {
+// The getConstants member that returns the constants of all constant providers
+struct TurboModuleConstantsInfo {};
+
+struct TurboModuleMember {
+  std::string Name;
+  std::variant<
+      TurboModuleConstantsInfo,
+      TurboModuleMethodInfo,
+      SyncMethodDelegate,
+      JsiSyncMethodDelegate,
+      EventEmitterInitializerDelegate>
+      Info;
+};
+
+// Builds the dispatch table of the module members when the module is registered.
+// The TurboModule finds a member index by its name, and keeps the JSI objects of a member at the same index.
+struct TurboModuleBuilder
+    : winrt::implements<TurboModuleBuilder, IReactModuleBuilder, IReactModuleBuilder2, IJsiSyncMethodBuilder> {
+  static constexpr size_t NotFound = static_cast<size_t>(-1);
+
   TurboModuleBuilder(const IReactContext &reactContext) noexcept : m_reactContext(reactContext) {}
 
  public: // IReactModuleBuilder
@@ -52,62 +76,69 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   }
 
   void AddConstantProvider(ConstantProviderDelegate const &constantProvider) noexcept {
-    EnsureMemberNotSet("getConstants", false);
+    // all constant providers share the getConstants member
+    size_t index = FindMember("getConstants");
+    if (index == NotFound) {
+      AddMember("getConstants", TurboModuleConstantsInfo{});
+    } else {
+      VerifyElseCrash(std::holds_alternative<TurboModuleConstantsInfo>(m_members[index].Info));
+    }
     m_constantProviders.push_back(constantProvider);
   }
 
   void AddMethod(hstring const &name, MethodReturnType returnType, MethodDelegate const &method) noexcept {
-    auto key = to_string(name);
-    EnsureMemberNotSet(key, true);
-    m_methods.insert({key, {returnType, method}});
+    AddMember(to_string(name), TurboModuleMethodInfo{returnType, method});
   }
 
   void AddEventEmitter(hstring const &name, EventEmitterInitializerDelegate const &emitter) noexcept {
-    auto key = to_string(name);
-    EnsureMemberNotSet(key, true);
-    m_eventEmitters.insert({key, emitter});
+    AddMember(to_string(name), emitter);
   }
 
   void AddSyncMethod(hstring const &name, SyncMethodDelegate const &method) noexcept {
-    auto key = to_string(name);
-    EnsureMemberNotSet(key, true);
-    m_syncMethods.insert({key, method});
+    AddMember(to_string(name), method);
+  }
+
+ public: // IReactModuleBuilder2
+  void AddMethodOnDispatcher(
+      hstring const &name,
+      MethodReturnType returnType,
+      MethodDispatcher dispatcher,
+      MethodDelegate const &method) noexcept {
+    AddMember(to_string(name), TurboModuleMethodInfo{returnType, method, dispatcher});
+  }
+
+ public: // IJsiSyncMethodBuilder
+  void __stdcall AddJsiSyncMethod(std::wstring_view name, JsiSyncMethodDelegate const &method) noexcept override {
+    AddMember(to_string(name), method);
   }
 
  public:
-  const std::unordered_map<std::string, TurboModuleMethodInfo> &Methods() const noexcept {
-    return m_methods;
+  const std::vector<TurboModuleMember> &Members() const noexcept {
+    return m_members;
   }
 
-  const std::unordered_map<std::string, SyncMethodDelegate> &SyncMethods() const noexcept {
-    return m_syncMethods;
+  // Returns NotFound if there is no member with the name
+  size_t FindMember(const std::string &name) const noexcept {
+    auto it = m_memberIndexes.find(name);
+    return it != m_memberIndexes.end() ? it->second : NotFound;
   }
 
   const std::vector<ConstantProviderDelegate> &ConstantProviders() const noexcept {
     return m_constantProviders;
   }
 
-  const std::unordered_map<std::string, EventEmitterInitializerDelegate> &EventEmitters() const noexcept {
-    return m_eventEmitters;
-  }
-
  private:
-  void EnsureMemberNotSet(const std::string &key, bool checkingMethod) noexcept {
-    VerifyElseCrash(m_methods.find(key) == m_methods.end());
-    VerifyElseCrash(m_syncMethods.find(key) == m_syncMethods.end());
-    VerifyElseCrash(m_eventEmitters.find(key) == m_eventEmitters.end());
-    if (checkingMethod && key == "getConstants") {
-      VerifyElseCrash(m_constantProviders.size() == 0);
-    }
+  template <class TInfo>
+  void AddMember(std::string &&name, TInfo &&info) noexcept {
+    VerifyElseCrash(m_memberIndexes.try_emplace(name, m_members.size()).second);
+    m_members.push_back({std::move(name), std::forward<TInfo>(info)});
   }
 
  private:
   IReactContext m_reactContext;
-  std::unordered_map<std::string, EventEmitterInitializerDelegate> m_eventEmitters;
-  std::unordered_map<std::string, TurboModuleMethodInfo> m_methods;
-  std::unordered_map<std::string, SyncMethodDelegate> m_syncMethods;
+  std::vector<TurboModuleMember> m_members;
+  std::unordered_map<std::string, size_t> m_memberIndexes;
   std::vector<ConstantProviderDelegate> m_constantProviders;
-  bool m_constantsEvaluated{false};
 };
 
 /*-------------------------------------------------------------------------------
@@ -120,11 +151,13 @@ class TurboModuleImpl : public facebook::react::TurboModule {
       const IReactContext &reactContext,
       const std::string &name,
       const std::shared_ptr<facebook::react::CallInvoker> &jsInvoker,
-      std::weak_ptr<facebook::react::LongLivedObjectCollection> longLivedObjectCollection,
-      const ReactModuleProvider &reactModuleProvider)
+      std::weak_ptr<TurboModulesProvider> turboModulesProvider,
+      const ReactModuleProvider &reactModuleProvider,
+      std::shared_ptr<NativeModuleProfiler> profiler)
       : facebook::react::TurboModule(name, jsInvoker),
         m_reactContext(reactContext),
-        m_longLivedObjectCollection(std::move(longLivedObjectCollection)),
+        m_turboModulesProvider(std::move(turboModulesProvider)),
+        m_profiler(std::move(profiler)),
         m_moduleBuilder(winrt::make_self<TurboModuleBuilder>(reactContext)),
         m_providedModule(reactModuleProvider(m_moduleBuilder.as<IReactModuleBuilder>())) {
     if (auto hostObject = m_providedModule.try_as<IJsiHostObject>()) {
@@ -136,41 +169,87 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     }
   }
 
+  ~TurboModuleImpl() noexcept override {
+    // The module goes away with the instance, so the calls that are still queued on its serial dispatcher are dropped
+    if (m_serialQueue) {
+      m_serialQueue.Shutdown(Mso::PendingTaskAction::Cancel);
+    }
+  }
+
   std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &rt) override {
     if (m_hostObjectWrapper) {
       return m_hostObjectWrapper->getPropertyNames(rt);
     }
 
     std::vector<facebook::jsi::PropNameID> propertyNames;
-    propertyNames.reserve(
-        m_moduleBuilder->Methods().size() + m_moduleBuilder->SyncMethods().size() +
-        (m_moduleBuilder->ConstantProviders().empty() ? 0 : 1));
+    propertyNames.reserve(m_moduleBuilder->Members().size());
+    for (auto &member : m_moduleBuilder->Members()) {
+      // event emitters are not listed
+      if (!std::holds_alternative<EventEmitterInitializerDelegate>(member.Info)) {
+        propertyNames.push_back(facebook::jsi::PropNameID::forAscii(rt, member.Name));
+      }
+    }
+
+    return propertyNames;
+  };
 
-    for (auto &methodInfo : m_moduleBuilder->Methods()) {
-      propertyNames.push_back(facebook::jsi::PropNameID::forAscii(rt, methodInfo.first));
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &propName) override {
+    if (m_hostObjectWrapper) {
+      return m_hostObjectWrapper->get(runtime, propName);
     }
 
-    for (auto &syncMethodInfo : m_moduleBuilder->SyncMethods()) {
-      propertyNames.push_back(facebook::jsi::PropNameID::forAscii(rt, syncMethodInfo.first));
+    size_t memberIndex = m_moduleBuilder->FindMember(propName.utf8(runtime));
+    if (memberIndex == TurboModuleBuilder::NotFound) {
+      // returns undefined if the expected member is not found
+      return facebook::jsi::Value::undefined();
     }
 
-    if (!m_moduleBuilder->ConstantProviders().empty()) {
-      propertyNames.push_back(facebook::jsi::PropNameID::forAscii(rt, "getConstants"));
+    const TurboModuleMember &member = m_moduleBuilder->Members()[memberIndex];
+    if (auto emitterInitializer = std::get_if<EventEmitterInitializerDelegate>(&member.Info)) {
+      return GetEventEmitter(runtime, memberIndex, *emitterInitializer);
     }
 
-    return propertyNames;
-  };
+    // it is not safe to assume that "runtime" never changes, so the host functions are cached per runtime
+    if (m_hostFunctionsRuntime != &runtime) {
+      m_hostFunctionsRuntime = &runtime;
+      m_hostFunctions.assign(m_moduleBuilder->Members().size(), {});
+      m_longLivedJsiObjects.reset();
+      if (auto turboModulesProvider = m_turboModulesProvider.lock()) {
+        m_longLivedJsiObjects = turboModulesProvider->LongLivedJsiObjects(runtime);
+      }
+    }
 
-  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &propName) override {
+    auto &cachedFunction = m_hostFunctions[memberIndex];
+    if (auto function = cachedFunction.lock()) {
+      return facebook::jsi::Value(runtime, function->Value());
+    }
+
+    auto result = CreateHostFunction(runtime, propName, member);
+    auto longLivedJsiObjects = m_longLivedJsiObjects.lock();
+    if (longLivedJsiObjects && result.isObject()) {
+      // the table releases the function before the runtime is destroyed
+      cachedFunction = LongLivedJsiFunction::CreateWeak(
+          longLivedJsiObjects, runtime, result.getObject(runtime).getFunction(runtime));
+    }
+
+    return result;
+  }
+
+  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
+      override {
     if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->get(runtime, propName);
+      return m_hostObjectWrapper->set(rt, name, value);
     }
 
-    // it is not safe to assume that "runtime" never changes, so members are not cached here
-    std::string key = propName.utf8(runtime);
+    facebook::react::TurboModule::set(rt, name, value);
+  }
 
-    if (key == "getConstants" && !m_moduleBuilder->ConstantProviders().empty()) {
-      // try to find getConstants if there is any constant
+ private:
+  facebook::jsi::Value CreateHostFunction(
+      facebook::jsi::Runtime &runtime,
+      const facebook::jsi::PropNameID &propName,
+      const TurboModuleMember &member) noexcept {
+    if (std::holds_alternative<TurboModuleConstantsInfo>(member.Info)) {
       return facebook::jsi::Function::createFromHostFunction(
           runtime,
           propName,
@@ -191,270 +270,323 @@ class TurboModuleImpl : public facebook::react::TurboModule {
           });
     }
 
-    {
-      // try to find a Method
-      auto it = m_moduleBuilder->Methods().find(key);
-      if (it != m_moduleBuilder->Methods().end()) {
-        TurboModuleMethodInfo const &methodInfo = it->second;
-        switch (methodInfo.ReturnType) {
-          case MethodReturnType::Void:
-            return facebook::jsi::Function::createFromHostFunction(
-                runtime,
-                propName,
-                0,
-                [method = methodInfo.Method](
-                    facebook::jsi::Runtime &rt,
-                    const facebook::jsi::Value & /*thisVal*/,
-                    const facebook::jsi::Value *args,
-                    size_t argCount) {
-                  method(winrt::make<JsiReader>(rt, args, argCount), nullptr, nullptr, nullptr);
-                  return facebook::jsi::Value::undefined();
-                });
-          case MethodReturnType::Callback:
-            return facebook::jsi::Function::createFromHostFunction(
-                runtime,
-                propName,
-                0,
-                [jsInvoker = jsInvoker_,
-                 method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
-                    facebook::jsi::Runtime &rt,
-                    const facebook::jsi::Value & /*thisVal*/,
-                    const facebook::jsi::Value *args,
-                    size_t argCount) {
-                  VerifyElseCrash(argCount > 0);
-                  if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
-                    auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
-                    auto writer = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder);
-                    method(
-                        winrt::make<JsiReader>(rt, args, argCount - 1),
-                        writer,
-                        MakeCallback(rt, strongLongLivedObjectCollection, args[argCount - 1]),
-                        nullptr);
-                    winrt::get_self<CallInvokerWriter>(writer)->ExitCurrentCallInvokeScope();
-                  }
-                  return facebook::jsi::Value::undefined();
-                });
-          case MethodReturnType::TwoCallbacks:
-            return facebook::jsi::Function::createFromHostFunction(
-                runtime,
-                propName,
-                0,
-                [jsInvoker = jsInvoker_,
-                 method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
-                    facebook::jsi::Runtime &rt,
-                    const facebook::jsi::Value & /*thisVal*/,
-                    const facebook::jsi::Value *args,
-                    size_t argCount) {
-                  VerifyElseCrash(argCount > 1);
-                  if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
-                    auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
-                    auto weakCallback1 = LongLivedJsiFunction::CreateWeak(
-                        strongLongLivedObjectCollection, rt, args[argCount - 2].getObject(rt).getFunction(rt));
-                    auto weakCallback2 = LongLivedJsiFunction::CreateWeak(
-                        strongLongLivedObjectCollection, rt, args[argCount - 1].getObject(rt).getFunction(rt));
-
-                    auto writer = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder);
-                    method(
-                        winrt::make<JsiReader>(rt, args, argCount - 2),
-                        writer,
-                        [weakCallback1, weakCallback2, jsiRuntimeHolder](const IJSValueWriter &writer) noexcept {
-                          writer.as<CallInvokerWriter>()->WithResultArgs(
-                              [weakCallback1, weakCallback2, jsiRuntimeHolder](
-                                  facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
-                                if (auto callback1 = weakCallback1.lock()) {
-                                  callback1->Value().call(rt, args, count);
-                                  callback1->allowRelease();
-                                }
-                                if (auto callback2 = weakCallback2.lock()) {
-                                  callback2->allowRelease();
-                                }
-                                if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                  runtimeHolder->allowRelease();
-                                }
-                              });
-                        },
-                        [weakCallback1, weakCallback2, jsiRuntimeHolder](const IJSValueWriter &writer) noexcept {
-                          writer.as<CallInvokerWriter>()->WithResultArgs(
-                              [weakCallback1, weakCallback2, jsiRuntimeHolder](
-                                  facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
-                                if (auto callback2 = weakCallback2.lock()) {
-                                  callback2->Value().call(rt, args, count);
-                                  callback2->allowRelease();
-                                }
-                                if (auto callback1 = weakCallback1.lock()) {
-                                  callback1->allowRelease();
-                                }
-                                if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                  runtimeHolder->allowRelease();
-                                }
-                              });
-                        });
-                    winrt::get_self<CallInvokerWriter>(writer)->ExitCurrentCallInvokeScope();
-                  }
-                  return facebook::jsi::Value::undefined();
-                });
-          case MethodReturnType::Promise:
-            return facebook::jsi::Function::createFromHostFunction(
-                runtime,
-                propName,
-                0,
-                [jsInvoker = jsInvoker_,
-                 method = methodInfo.Method,
-                 longLivedObjectCollection = m_longLivedObjectCollection](
-                    facebook::jsi::Runtime &rt,
-                    const facebook::jsi::Value & /*thisVal*/,
-                    const facebook::jsi::Value *args,
-                    size_t count) {
-                  if (auto strongLongLivedObjectCollection = longLivedObjectCollection.lock()) {
-                    auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedObjectCollection, rt);
-                    auto argReader = winrt::make<JsiReader>(rt, args, count);
-                    auto argWriter = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder);
-                    return facebook::react::createPromiseAsJSIValue(
-                        rt,
-                        [method, argReader, argWriter, strongLongLivedObjectCollection, jsiRuntimeHolder](
-                            facebook::jsi::Runtime &runtime, std::shared_ptr<facebook::react::Promise> promise) {
-                          auto weakResolve = LongLivedJsiFunction::CreateWeak(
-                              strongLongLivedObjectCollection, runtime, std::move(promise->resolve_));
-                          auto weakReject = LongLivedJsiFunction::CreateWeak(
-                              strongLongLivedObjectCollection, runtime, std::move(promise->reject_));
-                          method(
-                              argReader,
-                              argWriter,
-                              [weakResolve, weakReject, jsiRuntimeHolder](const IJSValueWriter &writer) {
-                                writer.as<CallInvokerWriter>()->WithResultArgs(
-                                    [weakResolve, weakReject, jsiRuntimeHolder](
-                                        facebook::jsi::Runtime &runtime,
-                                        facebook::jsi::Value const *args,
-                                        size_t argCount) {
-                                      VerifyElseCrash(argCount == 1);
-                                      if (auto resolveHolder = weakResolve.lock()) {
-                                        resolveHolder->Value().call(runtime, args[0]);
-                                        resolveHolder->allowRelease();
-                                      }
-                                      if (auto rejectHolder = weakReject.lock()) {
-                                        rejectHolder->allowRelease();
-                                      }
-                                      if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                        runtimeHolder->allowRelease();
-                                      }
-                                    });
-                              },
-                              [weakResolve, weakReject, jsiRuntimeHolder](const IJSValueWriter &writer) {
-                                writer.as<CallInvokerWriter>()->WithResultArgs(
-                                    [weakResolve, weakReject, jsiRuntimeHolder](
-                                        facebook::jsi::Runtime &runtime,
-                                        facebook::jsi::Value const *args,
-                                        size_t argCount) {
-                                      VerifyElseCrash(argCount == 1);
-                                      if (auto rejectHolder = weakReject.lock()) {
-                                        // To match the Android and iOS TurboModule behavior we create the Error object
-                                        // for the Promise rejection the same way as in updateErrorWithErrorData method.
-                                        // See react-native/Libraries/BatchedBridge/NativeModules.js for details.
-                                        auto error = runtime.global()
-                                                         .getPropertyAsFunction(runtime, "Error")
-                                                         .callAsConstructor(runtime, {});
-                                        auto &errorData = args[0];
-                                        if (errorData.isObject()) {
-                                          runtime.global()
-                                              .getPropertyAsObject(runtime, "Object")
-                                              .getPropertyAsFunction(runtime, "assign")
-                                              .call(runtime, error, errorData.getObject(runtime));
-                                        }
-                                        rejectHolder->Value().call(runtime, args[0]);
-                                        rejectHolder->allowRelease();
-                                      }
-                                      if (auto resolveHolder = weakResolve.lock()) {
-                                        resolveHolder->allowRelease();
-                                      }
-                                      if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
-                                        runtimeHolder->allowRelease();
-                                      }
-                                    });
-                              });
-                          winrt::get_self<CallInvokerWriter>(argWriter)->ExitCurrentCallInvokeScope();
-                        });
-                  }
-                  return facebook::jsi::Value::undefined();
-                });
-          default:
-            VerifyElseCrash(false);
+    if (auto methodInfo = std::get_if<TurboModuleMethodInfo>(&member.Info)) {
+      return CreateMethodFunction(runtime, propName, *methodInfo);
+    }
+
+    if (auto syncMethod = std::get_if<SyncMethodDelegate>(&member.Info)) {
+      SyncMethodDelegate method =
+          m_profiler ? m_profiler->ProfileSyncMethod(name_, propName.utf8(runtime), *syncMethod) : *syncMethod;
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          propName,
+          0,
+          [method = std::move(method)](
+              facebook::jsi::Runtime &rt,
+              const facebook::jsi::Value &thisVal,
+              const facebook::jsi::Value *args,
+              size_t count) {
+            // The reader and writer only live for the duration of the call, so they are created on the stack and
+            // the method gets non-owning interface references to them. A sync method must not keep them.
+            JsiReader argReader{rt, args, count};
+            JsiWriter argWriter{rt};
+            method(argReader, argWriter);
+            return argWriter.MoveResult();
+          });
+    }
+
+    // a SyncMethod that converts its JSI arguments and result itself
+    JsiSyncMethodDelegate method = std::get<JsiSyncMethodDelegate>(member.Info);
+    if (m_profiler) {
+      method = m_profiler->ProfileJsiSyncMethod(name_, propName.utf8(runtime), std::move(method));
+    }
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          propName,
+          0,
+          [method = std::move(method)](
+              facebook::jsi::Runtime &rt,
+              const facebook::jsi::Value & /*thisVal*/,
+              const facebook::jsi::Value *args,
+              size_t count) { return method(rt, args, count); });
+  }
+
+  // Returns null for the methods that run on the JS thread
+  IReactDispatcher GetMethodDispatcher(MethodDispatcher dispatcher) noexcept {
+    switch (dispatcher) {
+      case MethodDispatcher::UI:
+        return m_reactContext.UIDispatcher();
+      case MethodDispatcher::Serial:
+        if (!m_serialQueue) {
+          m_serialQueue = Mso::DispatchQueue{};
         }
-      }
+        return winrt::make<implementation::ReactDispatcher>(Mso::DispatchQueue{m_serialQueue});
+      case MethodDispatcher::Concurrent:
+        return winrt::make<implementation::ReactDispatcher>(Mso::DispatchQueue{Mso::DispatchQueue::ConcurrentQueue()});
+      default:
+        return nullptr;
     }
+  }
+
+  // Posts the calls of the method to the dispatcher. The arguments are copied before, since the reader reads them from
+  // the JSI values of the call. The copy is a JSValue, which has no ArrayBuffer type, so the method cannot read its
+  // arguments with TryGetArrayBuffer. The result is written to the CallInvokerWriter, which passes it back to the JS
+  // thread.
+  static MethodDelegate DispatchMethod(MethodDelegate method, IReactDispatcher dispatcher) noexcept {
+    return [method = std::move(method), dispatcher = std::move(dispatcher)](
+               IJSValueReader const &argReader,
+               IJSValueWriter const &argWriter,
+               MethodResultCallback const &resolve,
+               MethodResultCallback const &reject) {
+      auto args = std::make_shared<JSValue>(JSValue::ReadFrom(argReader));
+      dispatcher.Post([method, args, argWriter, resolve, reject]() {
+        method(winrt::make<JSValueTreeReader>(std::move(*args)), argWriter, resolve, reject);
+      });
+    };
+  }
 
-    {
-      // try to find a SyncMethod
-      auto it = m_moduleBuilder->SyncMethods().find(key);
-      if (it != m_moduleBuilder->SyncMethods().end()) {
+  facebook::jsi::Value CreateMethodFunction(
+      facebook::jsi::Runtime &runtime,
+      const facebook::jsi::PropNameID &propName,
+      const TurboModuleMethodInfo &methodInfo) noexcept {
+    // The JS tasks that call back the method are attributed to it in the dispatch queue metrics
+    auto origin = std::make_shared<const std::string>("NativeModule " + name_ + "." + propName.utf8(runtime));
+    MethodDelegate method =
+        m_profiler ? m_profiler->ProfileMethod(name_, propName.utf8(runtime), methodInfo.Method) : methodInfo.Method;
+    // The profiled method is what gets posted, so that the profiler times the method where it runs rather than the post
+    if (auto dispatcher = GetMethodDispatcher(methodInfo.Dispatcher)) {
+      method = DispatchMethod(std::move(method), std::move(dispatcher));
+    }
+    switch (methodInfo.ReturnType) {
+      case MethodReturnType::Void:
+        return facebook::jsi::Function::createFromHostFunction(
+            runtime,
+            propName,
+            0,
+            [method](
+                facebook::jsi::Runtime &rt,
+                const facebook::jsi::Value & /*thisVal*/,
+                const facebook::jsi::Value *args,
+                size_t argCount) {
+              method(winrt::make<JsiReader>(rt, args, argCount), nullptr, nullptr, nullptr);
+              return facebook::jsi::Value::undefined();
+            });
+      case MethodReturnType::Callback:
+        return facebook::jsi::Function::createFromHostFunction(
+            runtime,
+            propName,
+            0,
+            [jsInvoker = jsInvoker_,
+             method,
+             longLivedJsiObjects = m_longLivedJsiObjects,
+             origin](
+                facebook::jsi::Runtime &rt,
+                const facebook::jsi::Value & /*thisVal*/,
+                const facebook::jsi::Value *args,
+                size_t argCount) {
+              VerifyElseCrash(argCount > 0);
+              if (auto strongLongLivedJsiObjects = longLivedJsiObjects.lock()) {
+                auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedJsiObjects, rt);
+                auto writer = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder, origin);
+                method(
+                    winrt::make<JsiReader>(rt, args, argCount - 1),
+                    writer,
+                    MakeCallback(rt, strongLongLivedJsiObjects, args[argCount - 1]),
+                    nullptr);
+                winrt::get_self<CallInvokerWriter>(writer)->ExitCurrentCallInvokeScope();
+              }
+              return facebook::jsi::Value::undefined();
+            });
+      case MethodReturnType::TwoCallbacks:
         return facebook::jsi::Function::createFromHostFunction(
             runtime,
             propName,
             0,
-            [method = it->second](
+            [jsInvoker = jsInvoker_,
+             method,
+             longLivedJsiObjects = m_longLivedJsiObjects,
+             origin](
                 facebook::jsi::Runtime &rt,
-                const facebook::jsi::Value &thisVal,
+                const facebook::jsi::Value & /*thisVal*/,
+                const facebook::jsi::Value *args,
+                size_t argCount) {
+              VerifyElseCrash(argCount > 1);
+              if (auto strongLongLivedJsiObjects = longLivedJsiObjects.lock()) {
+                auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedJsiObjects, rt);
+                auto weakCallback1 = LongLivedJsiFunction::CreateWeak(
+                    strongLongLivedJsiObjects, rt, args[argCount - 2].getObject(rt).getFunction(rt));
+                auto weakCallback2 = LongLivedJsiFunction::CreateWeak(
+                    strongLongLivedJsiObjects, rt, args[argCount - 1].getObject(rt).getFunction(rt));
+
+                auto writer = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder, origin);
+                method(
+                    winrt::make<JsiReader>(rt, args, argCount - 2),
+                    writer,
+                    [weakCallback1, weakCallback2, jsiRuntimeHolder](const IJSValueWriter &writer) noexcept {
+                      writer.as<CallInvokerWriter>()->WithResultArgs(
+                          [weakCallback1, weakCallback2, jsiRuntimeHolder](
+                              facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
+                            if (auto callback1 = weakCallback1.lock()) {
+                              callback1->Value().call(rt, args, count);
+                              callback1->allowRelease();
+                            }
+                            if (auto callback2 = weakCallback2.lock()) {
+                              callback2->allowRelease();
+                            }
+                            if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
+                              runtimeHolder->allowRelease();
+                            }
+                          });
+                    },
+                    [weakCallback1, weakCallback2, jsiRuntimeHolder](const IJSValueWriter &writer) noexcept {
+                      writer.as<CallInvokerWriter>()->WithResultArgs(
+                          [weakCallback1, weakCallback2, jsiRuntimeHolder](
+                              facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
+                            if (auto callback2 = weakCallback2.lock()) {
+                              callback2->Value().call(rt, args, count);
+                              callback2->allowRelease();
+                            }
+                            if (auto callback1 = weakCallback1.lock()) {
+                              callback1->allowRelease();
+                            }
+                            if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
+                              runtimeHolder->allowRelease();
+                            }
+                          });
+                    });
+                winrt::get_self<CallInvokerWriter>(writer)->ExitCurrentCallInvokeScope();
+              }
+              return facebook::jsi::Value::undefined();
+            });
+      case MethodReturnType::Promise:
+        return facebook::jsi::Function::createFromHostFunction(
+            runtime,
+            propName,
+            0,
+            [jsInvoker = jsInvoker_,
+             method,
+             longLivedJsiObjects = m_longLivedJsiObjects,
+             origin](
+                facebook::jsi::Runtime &rt,
+                const facebook::jsi::Value & /*thisVal*/,
                 const facebook::jsi::Value *args,
                 size_t count) {
-              auto argReader = winrt::make<JsiReader>(rt, args, count);
-              auto argWriter = winrt::make<JsiWriter>(rt);
-              method(argReader, argWriter);
-              return argWriter.as<JsiWriter>()->MoveResult();
+              if (auto strongLongLivedJsiObjects = longLivedJsiObjects.lock()) {
+                auto jsiRuntimeHolder = LongLivedJsiRuntime::CreateWeak(strongLongLivedJsiObjects, rt);
+                auto argReader = winrt::make<JsiReader>(rt, args, count);
+                auto argWriter = winrt::make<CallInvokerWriter>(jsInvoker, jsiRuntimeHolder, origin);
+                return facebook::react::createPromiseAsJSIValue(
+                    rt,
+                    [method, argReader, argWriter, strongLongLivedJsiObjects, jsiRuntimeHolder](
+                        facebook::jsi::Runtime &runtime, std::shared_ptr<facebook::react::Promise> promise) {
+                      auto weakResolve = LongLivedJsiFunction::CreateWeak(
+                          strongLongLivedJsiObjects, runtime, std::move(promise->resolve_));
+                      auto weakReject = LongLivedJsiFunction::CreateWeak(
+                          strongLongLivedJsiObjects, runtime, std::move(promise->reject_));
+                      method(
+                          argReader,
+                          argWriter,
+                          [weakResolve, weakReject, jsiRuntimeHolder](const IJSValueWriter &writer) {
+                            writer.as<CallInvokerWriter>()->WithResultArgs(
+                                [weakResolve, weakReject, jsiRuntimeHolder](
+                                    facebook::jsi::Runtime &runtime,
+                                    facebook::jsi::Value const *args,
+                                    size_t argCount) {
+                                  VerifyElseCrash(argCount == 1);
+                                  if (auto resolveHolder = weakResolve.lock()) {
+                                    resolveHolder->Value().call(runtime, args[0]);
+                                    resolveHolder->allowRelease();
+                                  }
+                                  if (auto rejectHolder = weakReject.lock()) {
+                                    rejectHolder->allowRelease();
+                                  }
+                                  if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
+                                    runtimeHolder->allowRelease();
+                                  }
+                                });
+                          },
+                          [weakResolve, weakReject, jsiRuntimeHolder](const IJSValueWriter &writer) {
+                            writer.as<CallInvokerWriter>()->WithResultArgs(
+                                [weakResolve, weakReject, jsiRuntimeHolder](
+                                    facebook::jsi::Runtime &runtime,
+                                    facebook::jsi::Value const *args,
+                                    size_t argCount) {
+                                  VerifyElseCrash(argCount == 1);
+                                  if (auto rejectHolder = weakReject.lock()) {
+                                    // To match the Android and iOS TurboModule behavior we create the Error object
+                                    // for the Promise rejection the same way as in updateErrorWithErrorData method.
+                                    // See react-native/Libraries/BatchedBridge/NativeModules.js for details.
+                                    auto error = runtime.global()
+                                                     .getPropertyAsFunction(runtime, "Error")
+                                                     .callAsConstructor(runtime, {});
+                                    auto &errorData = args[0];
+                                    if (errorData.isObject()) {
+                                      runtime.global()
+                                          .getPropertyAsObject(runtime, "Object")
+                                          .getPropertyAsFunction(runtime, "assign")
+                                          .call(runtime, error, errorData.getObject(runtime));
+                                    }
+                                    rejectHolder->Value().call(runtime, args[0]);
+                                    rejectHolder->allowRelease();
+                                  }
+                                  if (auto resolveHolder = weakResolve.lock()) {
+                                    resolveHolder->allowRelease();
+                                  }
+                                  if (auto runtimeHolder = jsiRuntimeHolder.lock()) {
+                                    runtimeHolder->allowRelease();
+                                  }
+                                });
+                          });
+                      winrt::get_self<CallInvokerWriter>(argWriter)->ExitCurrentCallInvokeScope();
+                    });
+              }
+              return facebook::jsi::Value::undefined();
             });
-      }
+      default:
+        VerifyElseCrash(false);
     }
 
-    {
-      // try to find an event
-      auto it = m_moduleBuilder->EventEmitters().find(key);
-      if (it != m_moduleBuilder->EventEmitters().end()) {
-        // See if we have an existing eventEmitter
-        auto itEmitter = m_eventEmitters.find(key);
-        if (itEmitter == m_eventEmitters.end()) {
-          m_eventEmitters[key] = std::make_shared<facebook::react::AsyncEventEmitter<facebook::jsi::Value>>();
-
-          itEmitter = m_eventEmitters.find(key);
-
-          it->second([emitter = std::static_pointer_cast<facebook::react::AsyncEventEmitter<facebook::jsi::Value>>(
-                          itEmitter->second),
-                      jsInvoker = jsInvoker_](const JSValueArgWriter &eventDelegate) {
-            auto argWriter = MakeJSValueTreeWriter();
-            eventDelegate(argWriter);
-            emitter->emit(
-                [jsInvoker, eventDelegate, jsValue = std::make_shared<JSValue>(TakeJSValue(argWriter))](
-                    facebook::jsi::Runtime &rt) -> facebook::jsi::Value {
-                  auto argWriter = winrt::make<JsiWriter>(rt);
-                  WriteValue(argWriter, *jsValue);
-                  return argWriter.as<JsiWriter>()->MoveResult();
-                });
-          });
-        }
-
-        return itEmitter->second->get(runtime, jsInvoker_);
-      }
-    }
-
-    // returns undefined if the expected member is not found
     return facebook::jsi::Value::undefined();
   }
 
-  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
-      override {
-    if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->set(rt, name, value);
+  facebook::jsi::Value GetEventEmitter(
+      facebook::jsi::Runtime &runtime,
+      size_t memberIndex,
+      const EventEmitterInitializerDelegate &emitterInitializer) noexcept {
+    if (m_eventEmitters.empty()) {
+      m_eventEmitters.resize(m_moduleBuilder->Members().size());
     }
 
-    facebook::react::TurboModule::set(rt, name, value);
+    // See if we have an existing eventEmitter
+    auto &eventEmitter = m_eventEmitters[memberIndex];
+    if (!eventEmitter) {
+      eventEmitter = std::make_shared<facebook::react::AsyncEventEmitter<facebook::jsi::Value>>();
+
+      emitterInitializer([emitter = std::static_pointer_cast<facebook::react::AsyncEventEmitter<facebook::jsi::Value>>(
+                              eventEmitter),
+                          jsInvoker = jsInvoker_](const JSValueArgWriter &eventDelegate) {
+        auto argWriter = MakeJSValueTreeWriter();
+        eventDelegate(argWriter);
+        emitter->emit(
+            [jsInvoker, eventDelegate, jsValue = std::make_shared<JSValue>(TakeJSValue(argWriter))](
+                facebook::jsi::Runtime &rt) -> facebook::jsi::Value {
+              auto argWriter = winrt::make<JsiWriter>(rt);
+              WriteValue(argWriter, *jsValue);
+              return argWriter.as<JsiWriter>()->MoveResult();
+            });
+      });
+    }
+
+    return eventEmitter->get(runtime, jsInvoker_);
   }
 
  private:
   static MethodResultCallback MakeCallback(
       facebook::jsi::Runtime &rt,
-      const std::shared_ptr<facebook::react::LongLivedObjectCollection> &longLivedObjectCollection,
+      const std::shared_ptr<LongLivedJsiObjectTable> &longLivedJsiObjects,
       const facebook::jsi::Value &callback) noexcept {
     auto weakCallback =
-        LongLivedJsiFunction::CreateWeak(longLivedObjectCollection, rt, callback.getObject(rt).getFunction(rt));
+        LongLivedJsiFunction::CreateWeak(longLivedJsiObjects, rt, callback.getObject(rt).getFunction(rt));
     return [weakCallback = std::move(weakCallback)](const IJSValueWriter &writer) noexcept {
       writer.as<CallInvokerWriter>()->WithResultArgs(
           [weakCallback](facebook::jsi::Runtime &rt, facebook::jsi::Value const *args, size_t count) {
@@ -470,9 +602,18 @@ class TurboModuleImpl : public facebook::react::TurboModule {
   IReactContext m_reactContext;
   winrt::com_ptr<TurboModuleBuilder> m_moduleBuilder;
   IInspectable m_providedModule;
-  std::unordered_map<std::string, std::shared_ptr<facebook::react::IAsyncEventEmitter>> m_eventEmitters;
+  // event emitters and host functions are at the index of their member in m_moduleBuilder->Members()
+  std::vector<std::shared_ptr<facebook::react::IAsyncEventEmitter>> m_eventEmitters;
+  std::vector<std::weak_ptr<LongLivedJsiFunction>> m_hostFunctions;
+  facebook::jsi::Runtime *m_hostFunctionsRuntime{nullptr};
   std::shared_ptr<implementation::HostObjectWrapper> m_hostObjectWrapper;
-  std::weak_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection;
+  std::weak_ptr<TurboModulesProvider> m_turboModulesProvider;
+  // times the calls of the methods, when the native module profiler is enabled
+  std::shared_ptr<NativeModuleProfiler> m_profiler;
+  // runs the calls of the methods on MethodDispatcher::Serial, created on first use and shut down with the module
+  Mso::DispatchQueue m_serialQueue{nullptr};
+  // the table of the callbacks and promises for m_hostFunctionsRuntime
+  std::weak_ptr<LongLivedJsiObjectTable> m_longLivedJsiObjects;
 };
 
 /*-------------------------------------------------------------------------------
@@ -489,25 +630,28 @@ std::shared_ptr<facebook::react::TurboModule> TurboModulesProvider::getModule(
   }
 
   auto tm = std::make_shared<TurboModuleImpl>(
-      m_reactContext, moduleName, callInvoker, m_longLivedObjectCollection, /*reactModuleProvider*/ it->second);
+      m_reactContext, moduleName, callInvoker, weak_from_this(), /*reactModuleProvider*/ it->second, m_profiler);
   return tm;
 }
 
 std::vector<std::string> TurboModulesProvider::getEagerInitModuleNames() noexcept {
   std::vector<std::string> eagerModules;
-  auto it = m_moduleProviders.find("UIManager");
-  if (it != m_moduleProviders.end()) {
-    eagerModules.push_back("UIManager");
-  }
-  it = m_moduleProviders.find("FabricUIManagerBinding");
-  if (it != m_moduleProviders.end()) {
-    eagerModules.push_back("FabricUIManagerBinding");
+  for (const auto &moduleName : m_eagerInitModuleNames) {
+    if (m_moduleProviders.find(moduleName) != m_moduleProviders.end()) {
+      eagerModules.push_back(moduleName);
+    }
   }
   return eagerModules;
 }
 
 void TurboModulesProvider::SetReactContext(const IReactContext &reactContext) noexcept {
   m_reactContext = reactContext;
+  if (auto profiler = ReactPropertyBag(reactContext.Properties())
+                          .Get(implementation::ReactContext::NativeModuleProfilerProperty())) {
+    m_profiler = *profiler;
+  } else {
+    m_profiler = nullptr;
+  }
 }
 
 void TurboModulesProvider::AddModuleProvider(
@@ -524,9 +668,34 @@ void TurboModulesProvider::AddModuleProvider(
   }
 }
 
+void TurboModulesProvider::AddEagerInitModuleName(winrt::hstring const &moduleName) noexcept {
+  auto key = to_string(moduleName);
+  if (std::find(m_eagerInitModuleNames.begin(), m_eagerInitModuleNames.end(), key) == m_eagerInitModuleNames.end()) {
+    m_eagerInitModuleNames.push_back(std::move(key));
+  }
+}
+
 std::shared_ptr<facebook::react::LongLivedObjectCollection> const &
 TurboModulesProvider::LongLivedObjectCollection() noexcept {
   return m_longLivedObjectCollection;
 }
 
+std::shared_ptr<LongLivedJsiObjectTable> TurboModulesProvider::LongLivedJsiObjects(
+    facebook::jsi::Runtime &runtime) noexcept {
+  std::scoped_lock lock{m_longLivedJsiObjectsMutex};
+  auto longLivedJsiObjects = m_longLivedJsiObjects.lock();
+  if (!longLivedJsiObjects || &longLivedJsiObjects->Runtime() != &runtime) {
+    longLivedJsiObjects = LongLivedJsiObjectTable::Create(m_longLivedObjectCollection, runtime);
+    m_longLivedJsiObjects = longLivedJsiObjects;
+  }
+
+  return longLivedJsiObjects;
+}
+
+size_t TurboModulesProvider::LongLivedJsiObjectCount() const noexcept {
+  std::scoped_lock lock{m_longLivedJsiObjectsMutex};
+  auto longLivedJsiObjects = m_longLivedJsiObjects.lock();
+  return longLivedJsiObjects ? longLivedJsiObjects->Size() : 0;
+}
+
 } // namespace winrt::Microsoft::ReactNative
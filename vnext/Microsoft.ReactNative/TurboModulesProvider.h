@@ -6,14 +6,19 @@
 
 #pragma once
 
+#include <JSI/LongLivedJsiValue.h>
 #include <TurboModuleRegistry.h>
 #include <react/bridging/LongLivedObject.h>
+#include <mutex>
 #include "Base/FollyIncludes.h"
 #include "winrt/Microsoft.ReactNative.h"
 
 namespace winrt::Microsoft::ReactNative {
 
-class TurboModulesProvider final : public facebook::react::TurboModuleRegistry {
+class NativeModuleProfiler;
+
+class TurboModulesProvider final : public facebook::react::TurboModuleRegistry,
+                                   public std::enable_shared_from_this<TurboModulesProvider> {
  public: // TurboModuleRegistry implementation
   std::shared_ptr<facebook::react::TurboModule> getModule(
       const std::string &moduleName,
@@ -26,14 +31,26 @@ class TurboModulesProvider final : public facebook::react::TurboModuleRegistry {
       winrt::hstring const &moduleName,
       ReactModuleProvider const &moduleProvider,
       bool overwriteExisting) noexcept;
+  // The module is created with the runtime instead of the first time that JS uses it
+  void AddEagerInitModuleName(winrt::hstring const &moduleName) noexcept;
   std::shared_ptr<facebook::react::LongLivedObjectCollection> const &LongLivedObjectCollection() noexcept;
+  // The table of the callbacks and promises that the modules keep for the runtime. It is created on first use, and
+  // released when the LongLivedObjectCollection is cleared.
+  std::shared_ptr<LongLivedJsiObjectTable> LongLivedJsiObjects(facebook::jsi::Runtime &runtime) noexcept;
+  // The number of callbacks, promise functions and cached module functions kept for the current runtime
+  size_t LongLivedJsiObjectCount() const noexcept;
 
  private:
-  // To keep a list of deferred asynchronous callbacks and promises.
+  // To keep the JSI objects that must be released before the runtime, such as the table of the deferred asynchronous
+  // callbacks and promises.
   std::shared_ptr<facebook::react::LongLivedObjectCollection> m_longLivedObjectCollection{
       std::make_shared<facebook::react::LongLivedObjectCollection>()};
+  mutable std::mutex m_longLivedJsiObjectsMutex;
+  std::weak_ptr<LongLivedJsiObjectTable> m_longLivedJsiObjects;
   std::unordered_map<std::string, ReactModuleProvider> m_moduleProviders;
+  std::vector<std::string> m_eagerInitModuleNames;
   IReactContext m_reactContext;
+  std::shared_ptr<NativeModuleProfiler> m_profiler;
 };
 
 } // namespace winrt::Microsoft::ReactNative
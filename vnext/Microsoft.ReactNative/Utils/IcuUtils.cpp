@@ -4,51 +4,69 @@
 #include "pch.h"
 #include "IcuUtils.h"
 #include <icu.h>
+#include <algorithm>
+#include <memory>
 
 namespace Microsoft::ReactNative::IcuUtils {
 
-void UBreakIteratorDeleter::operator()(void *ptr) const noexcept {
-  if (ptr) {
-    ubrk_close(static_cast<UBreakIterator *>(ptr));
+namespace {
+
+struct UBreakIteratorDeleter {
+  void operator()(UBreakIterator *ptr) const noexcept {
+    ubrk_close(ptr);
   }
-}
+};
+
+} // namespace
+
+WordBoundaries::WordBoundaries(const wchar_t *text, int32_t length) noexcept {
+  // Opening a word break iterator loads its rules, so each thread keeps one and only sets the text on it
+  thread_local std::unique_ptr<UBreakIterator, UBreakIteratorDeleter> s_breakIterator;
 
-WordBreakIterator::WordBreakIterator(const wchar_t *text, int32_t length) noexcept : m_length(length) {
   UErrorCode status = U_ZERO_ERROR;
-  auto *iter = ubrk_open(UBRK_WORD, nullptr, reinterpret_cast<const UChar *>(text), length, &status);
-  if (U_SUCCESS(status)) {
-    m_breakIterator.reset(static_cast<void *>(iter));
+  if (!s_breakIterator) {
+    s_breakIterator.reset(ubrk_open(UBRK_WORD, nullptr, nullptr, 0, &status));
+    if (U_FAILURE(status)) {
+      s_breakIterator.reset();
+      return;
+    }
   }
-}
 
-bool WordBreakIterator::IsValid() const noexcept {
-  return m_breakIterator != nullptr;
-}
+  auto *iter = s_breakIterator.get();
+  ubrk_setText(iter, reinterpret_cast<const UChar *>(text), length, &status);
+  if (U_FAILURE(status)) {
+    return;
+  }
 
-bool WordBreakIterator::GetWordBoundaries(int32_t position, int32_t &outStart, int32_t &outEnd) const noexcept {
-  if (!m_breakIterator || position < 0 || position >= m_length) {
-    return false;
+  m_boundaries.push_back(ubrk_first(iter));
+  for (int32_t boundary = ubrk_next(iter); boundary != UBRK_DONE; boundary = ubrk_next(iter)) {
+    // The rule status of a boundary is the one of the segment that it ends
+    m_isWord.push_back(ubrk_getRuleStatus(iter) != UBRK_WORD_NONE);
+    m_boundaries.push_back(boundary);
   }
 
-  auto *iter = static_cast<UBreakIterator *>(m_breakIterator.get());
+  // The iterator must not keep pointing to the text after it is freed
+  ubrk_setText(iter, nullptr, 0, &status);
+}
 
-  int32_t start = ubrk_preceding(iter, position + 1);
-  if (start == UBRK_DONE) {
-    start = 0;
-  }
+bool WordBoundaries::IsValid() const noexcept {
+  return !m_boundaries.empty();
+}
 
-  int32_t end = ubrk_following(iter, position);
-  if (end == UBRK_DONE) {
-    end = m_length;
+bool WordBoundaries::GetWordBoundaries(int32_t position, int32_t &outStart, int32_t &outEnd) const noexcept {
+  if (m_boundaries.empty() || position < 0 || position >= m_boundaries.back()) {
+    return false;
   }
 
-  int32_t ruleStatus = ubrk_getRuleStatus(iter);
-  if (ruleStatus == UBRK_WORD_NONE) {
+  // The segment of the position starts at the last boundary that is not past it
+  auto next = std::upper_bound(m_boundaries.begin(), m_boundaries.end(), position);
+  auto segment = static_cast<size_t>(next - m_boundaries.begin()) - 1;
+  if (!m_isWord[segment]) {
     return false;
   }
 
-  outStart = start;
-  outEnd = end;
+  outStart = m_boundaries[segment];
+  outEnd = m_boundaries[segment + 1];
   return true;
 }
 
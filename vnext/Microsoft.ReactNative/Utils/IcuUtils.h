@@ -4,7 +4,7 @@
 #pragma once
 
 #include <cstdint>
-#include <memory>
+#include <vector>
 
 // ICU utilities wrapped in a namespace to avoid UChar naming conflicts with Folly's FBString.
 // Folly has a template parameter named 'UChar' which conflicts with ICU's global UChar typedef.
@@ -12,26 +12,22 @@ namespace Microsoft::ReactNative::IcuUtils {
 
 using UChar32 = int32_t;
 
-struct UBreakIteratorDeleter {
-  void operator()(void *ptr) const noexcept;
-};
-
-class WordBreakIterator {
+// The word boundaries of a text, found in a single pass so that repeated word lookups, like double-click selection
+// and word navigation, are binary searches instead of new break iterations over the text.
+class WordBoundaries {
  public:
-  WordBreakIterator(const wchar_t *text, int32_t length) noexcept;
-
-  WordBreakIterator(const WordBreakIterator &) = delete;
-  WordBreakIterator &operator=(const WordBreakIterator &) = delete;
-  WordBreakIterator(WordBreakIterator &&) = default;
-  WordBreakIterator &operator=(WordBreakIterator &&) = default;
+  WordBoundaries(const wchar_t *text, int32_t length) noexcept;
 
   bool IsValid() const noexcept;
 
+  // Returns false if the position is not within a word
   bool GetWordBoundaries(int32_t position, int32_t &outStart, int32_t &outEnd) const noexcept;
 
  private:
-  std::unique_ptr<void, UBreakIteratorDeleter> m_breakIterator{nullptr};
-  int32_t m_length = 0;
+  // Every boundary of the text, starting with 0 and ending with its length
+  std::vector<int32_t> m_boundaries;
+  // Whether the segment that starts at each boundary but the last is a word
+  std::vector<bool> m_isWord;
 };
 
 bool IsAlphanumeric(UChar32 codePoint) noexcept;
@@ -0,0 +1,405 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "ImageDiskCache.h"
+
+#include <AppModelHelpers.h>
+#include <CppRuntimeOptions.h>
+#include <winrt/Windows.Storage.h>
+#include <winrt/Windows.Web.Http.Headers.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+constexpr size_t DefaultBudgetBytes = 128 * 1024 * 1024;
+constexpr char EntryMagic[8] = {'R', 'N', 'I', 'M', 'G', 'C', '0', '1'};
+constexpr wchar_t EntryExtension[] = L".img";
+constexpr wchar_t TemporaryExtension[] = L".tmp";
+
+struct EntryPrefix {
+  char magic[sizeof(EntryMagic)];
+  int64_t freshUntil;
+  uint32_t keyLength;
+  uint32_t etagLength;
+  uint32_t lastModifiedLength;
+};
+
+uint64_t Fnv1aHash(const void *data, size_t length) noexcept {
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= static_cast<const uint8_t *>(data)[i];
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+std::wstring HexString(uint64_t value) noexcept {
+  wchar_t buffer[17];
+  swprintf_s(buffer, L"%016llx", value);
+  return buffer;
+}
+
+int64_t NowSeconds() noexcept {
+  return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+int64_t ToSeconds(winrt::Windows::Foundation::DateTime dateTime) noexcept {
+  return std::chrono::duration_cast<std::chrono::seconds>(winrt::clock::to_sys(dateTime).time_since_epoch()).count();
+}
+
+template <class THeaders>
+std::string HeaderValue(const THeaders &headers, const wchar_t *name) {
+  return headers.HasKey(name) ? winrt::to_string(headers.Lookup(name)) : std::string{};
+}
+
+// Returns std::nullopt when Cache-Control does not allow the response to be stored
+std::optional<int64_t> FreshUntil(const winrt::Windows::Web::Http::HttpResponseMessage &response) {
+  auto now = NowSeconds();
+
+  auto cacheControl = HeaderValue(response.Headers(), L"Cache-Control");
+  std::transform(cacheControl.begin(), cacheControl.end(), cacheControl.begin(), [](char c) {
+    return static_cast<char>(tolower(static_cast<unsigned char>(c)));
+  });
+
+  bool noCache = false;
+  std::optional<int64_t> maxAge;
+  size_t start = 0;
+  while (start < cacheControl.size()) {
+    auto end = std::min(cacheControl.find(',', start), cacheControl.size());
+    auto directiveStart = std::min(cacheControl.find_first_not_of(' ', start), end);
+    std::string_view directive(cacheControl.c_str() + directiveStart, end - directiveStart);
+    start = end + 1;
+
+    if (directive.substr(0, 8) == "no-store") {
+      return std::nullopt;
+    } else if (directive.substr(0, 8) == "no-cache") {
+      noCache = true;
+    } else if (directive.substr(0, 8) == "max-age=") {
+      maxAge = _atoi64(std::string(directive.substr(8)).c_str());
+    }
+  }
+
+  if (noCache) {
+    return now;
+  }
+  if (maxAge) {
+    return now + *maxAge;
+  }
+
+  if (auto content = response.Content()) {
+    if (auto expires = content.Headers().Expires()) {
+      return ToSeconds(expires.Value());
+    }
+
+    // Heuristic freshness (RFC 9111, section 4.2.2): a tenth of the time since the image was last modified, capped
+    if (auto lastModified = content.Headers().LastModified()) {
+      constexpr int64_t maxHeuristicSeconds = 24 * 60 * 60;
+      return now + std::clamp<int64_t>((now - ToSeconds(lastModified.Value())) / 10, 0, maxHeuristicSeconds);
+    }
+  }
+
+  // Without any freshness information the entry is revalidated on every use, or just used when offline
+  return now;
+}
+
+std::wstring CacheDirectory() noexcept {
+  try {
+    if (HasPackageIdentity()) {
+      return std::wstring(winrt::Windows::Storage::ApplicationData::Current().LocalCacheFolder().Path()) +
+          L"\\ReactNativeImageCache";
+    }
+  } catch (winrt::hresult_error const &) {
+  }
+
+  wchar_t tempPath[MAX_PATH];
+  wchar_t modulePath[MAX_PATH];
+  if (!GetTempPathW(static_cast<DWORD>(std::size(tempPath)), tempPath) ||
+      !GetModuleFileNameW(nullptr, modulePath, static_cast<DWORD>(std::size(modulePath)))) {
+    return {};
+  }
+
+  // Unpackaged apps share the temp folder, so each executable gets a cache of its own
+  return std::wstring(tempPath) + L"ReactNativeImageCache\\" +
+      HexString(Fnv1aHash(modulePath, wcslen(modulePath) * sizeof(wchar_t)));
+}
+
+} // namespace
+
+bool ImageDiskCache::Entry::isFresh() const noexcept {
+  return freshUntil > NowSeconds();
+}
+
+ImageDiskCache &ImageDiskCache::Instance() noexcept {
+  static ImageDiskCache s_instance;
+  return s_instance;
+}
+
+ImageDiskCache::ImageDiskCache() noexcept {
+  auto directory = CacheDirectory();
+  if (directory.empty()) {
+    return;
+  }
+
+  std::error_code ec;
+  fs::create_directories(directory, ec);
+  if (ec) {
+    return;
+  }
+  m_directory = std::move(directory);
+
+  try {
+    for (auto const &file : fs::directory_iterator(m_directory, ec)) {
+      if (file.path().extension() == TemporaryExtension) {
+        // Left over from a write that was interrupted
+        fs::remove(file.path(), ec);
+      } else if (file.path().extension() == EntryExtension) {
+        m_byteSize += static_cast<size_t>(file.file_size(ec));
+      }
+    }
+  } catch (fs::filesystem_error const &) {
+  }
+}
+
+size_t ImageDiskCache::Budget() noexcept {
+  auto budgetMB = Microsoft::React::GetRuntimeOptionInt("Image.DiskCacheSizeMB");
+  if (budgetMB < 0) {
+    return 0;
+  }
+  return budgetMB == 0 ? DefaultBudgetBytes : static_cast<size_t>(budgetMB) * 1024 * 1024;
+}
+
+std::string ImageDiskCache::Key(const ReactImageSource &source) noexcept {
+  // Only plain GET requests are cached, other methods and requests with a body are not expected to be repeatable
+  if (!source.body.empty() || (!source.method.empty() && _stricmp(source.method.c_str(), "GET") != 0) ||
+      (_strnicmp(source.uri.c_str(), "http://", 7) != 0 && _strnicmp(source.uri.c_str(), "https://", 8) != 0)) {
+    return {};
+  }
+
+  // Headers such as Authorization can change what the server responds with
+  std::string key = source.uri;
+  for (auto const &[name, value] : source.headers) {
+    key.append("\n").append(name).append(": ").append(value);
+  }
+  return key;
+}
+
+std::wstring ImageDiskCache::entryPath(const std::string &key) const noexcept {
+  return m_directory + L"\\" + HexString(Fnv1aHash(key.data(), key.size())) + EntryExtension;
+}
+
+std::optional<ImageDiskCache::Entry> ImageDiskCache::read(const std::string &key) noexcept {
+  if (m_directory.empty() || key.empty() || Budget() == 0) {
+    return std::nullopt;
+  }
+
+  auto path = entryPath(key);
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return std::nullopt;
+  }
+
+  std::streamsize size = file.tellg();
+  file.seekg(0, std::ios::beg);
+
+  EntryPrefix prefix;
+  if (size < static_cast<std::streamsize>(sizeof(prefix)) ||
+      !file.read(reinterpret_cast<char *>(&prefix), sizeof(prefix)) ||
+      memcmp(prefix.magic, EntryMagic, sizeof(EntryMagic)) != 0) {
+    return std::nullopt;
+  }
+
+  auto headerSize = static_cast<std::streamsize>(sizeof(prefix)) + prefix.keyLength + prefix.etagLength +
+      prefix.lastModifiedLength;
+  if (size < headerSize || prefix.keyLength != key.size()) {
+    return std::nullopt;
+  }
+
+  // The stored key guards against digest collisions
+  std::string storedKey(prefix.keyLength, '\0');
+  Entry entry;
+  entry.freshUntil = prefix.freshUntil;
+  entry.etag.resize(prefix.etagLength);
+  entry.lastModified.resize(prefix.lastModifiedLength);
+  entry.body.resize(static_cast<size_t>(size - headerSize));
+  if (!file.read(storedKey.data(), storedKey.size()) || storedKey != key ||
+      !file.read(entry.etag.data(), entry.etag.size()) ||
+      !file.read(entry.lastModified.data(), entry.lastModified.size()) ||
+      !file.read(reinterpret_cast<char *>(entry.body.data()), entry.body.size())) {
+    return std::nullopt;
+  }
+  file.close();
+
+  // The modification time orders the entries for trimming, so a read marks the entry as recently used
+  std::error_code ec;
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  return entry;
+}
+
+bool ImageDiskCache::contains(const std::string &key) noexcept {
+  std::error_code ec;
+  return !m_directory.empty() && !key.empty() && fs::exists(entryPath(key), ec);
+}
+
+void ImageDiskCache::store(
+    const std::string &key,
+    const winrt::Windows::Web::Http::HttpResponseMessage &response,
+    const std::vector<uint8_t> &body) noexcept {
+  if (m_directory.empty() || key.empty()) {
+    return;
+  }
+
+  try {
+    auto freshUntil = FreshUntil(response);
+    if (!freshUntil) {
+      std::error_code ec;
+      fs::remove(entryPath(key), ec);
+      return;
+    }
+
+    Entry entry;
+    entry.freshUntil = *freshUntil;
+    entry.etag = HeaderValue(response.Headers(), L"ETag");
+    if (auto content = response.Content()) {
+      entry.lastModified = HeaderValue(content.Headers(), L"Last-Modified");
+    }
+    write(key, entry, body);
+  } catch (winrt::hresult_error const &) {
+  }
+}
+
+void ImageDiskCache::revalidate(
+    const std::string &key,
+    Entry &entry,
+    const winrt::Windows::Web::Http::HttpResponseMessage &response) noexcept {
+  try {
+    auto freshUntil = FreshUntil(response);
+    if (!freshUntil) {
+      std::error_code ec;
+      fs::remove(entryPath(key), ec);
+      return;
+    }
+
+    entry.freshUntil = *freshUntil;
+    if (auto etag = HeaderValue(response.Headers(), L"ETag"); !etag.empty()) {
+      entry.etag = std::move(etag);
+    }
+    write(key, entry, entry.body);
+  } catch (winrt::hresult_error const &) {
+  }
+}
+
+void ImageDiskCache::AddValidators(
+    const winrt::Windows::Web::Http::HttpRequestMessage &request,
+    const Entry &entry) noexcept {
+  if (!entry.etag.empty()) {
+    request.Headers().TryAppendWithoutValidation(L"If-None-Match", winrt::to_hstring(entry.etag));
+  }
+  if (!entry.lastModified.empty()) {
+    request.Headers().TryAppendWithoutValidation(L"If-Modified-Since", winrt::to_hstring(entry.lastModified));
+  }
+}
+
+winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Storage::Streams::IRandomAccessStream>
+ImageDiskCache::StreamFromBody(std::vector<uint8_t> body) {
+  winrt::Windows::Storage::Streams::InMemoryRandomAccessStream memoryStream;
+  winrt::Windows::Storage::Streams::DataWriter writer(memoryStream);
+  writer.WriteBytes(body);
+  co_await writer.StoreAsync();
+  writer.DetachStream();
+  memoryStream.Seek(0);
+  co_return memoryStream;
+}
+
+void ImageDiskCache::write(const std::string &key, const Entry &entry, const std::vector<uint8_t> &body) noexcept {
+  auto budget = Budget();
+  auto entrySize = sizeof(EntryPrefix) + key.size() + entry.etag.size() + entry.lastModified.size() + body.size();
+  if (entrySize > budget / 4) {
+    return;
+  }
+
+  EntryPrefix prefix;
+  memcpy(prefix.magic, EntryMagic, sizeof(EntryMagic));
+  prefix.freshUntil = entry.freshUntil;
+  prefix.keyLength = static_cast<uint32_t>(key.size());
+  prefix.etagLength = static_cast<uint32_t>(entry.etag.size());
+  prefix.lastModifiedLength = static_cast<uint32_t>(entry.lastModified.size());
+
+  // Entries are written to a temporary file first, so that readers never see a partially written entry
+  auto path = entryPath(key);
+  auto temporaryPath = path + L"." + std::to_wstring(GetCurrentThreadId()) + TemporaryExtension;
+  {
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return;
+    }
+    file.write(reinterpret_cast<const char *>(&prefix), sizeof(prefix));
+    file.write(key.data(), key.size());
+    file.write(entry.etag.data(), entry.etag.size());
+    file.write(entry.lastModified.data(), entry.lastModified.size());
+    file.write(reinterpret_cast<const char *>(body.data()), body.size());
+    if (!file) {
+      file.close();
+      std::error_code ec;
+      fs::remove(temporaryPath, ec);
+      return;
+    }
+  }
+
+  std::scoped_lock lock{m_mutex};
+  std::error_code ec;
+  auto replacedSize = fs::exists(path, ec) ? static_cast<size_t>(fs::file_size(path, ec)) : 0;
+  if (!MoveFileExW(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+    fs::remove(temporaryPath, ec);
+    return;
+  }
+
+  m_byteSize = m_byteSize - std::min(m_byteSize, replacedSize) + entrySize;
+  if (m_byteSize > budget) {
+    // Trim below the cap, so that the directory is not scanned again on the next write
+    trimLocked(budget / 4 * 3);
+  }
+}
+
+void ImageDiskCache::trimLocked(size_t budget) noexcept {
+  struct File {
+    fs::file_time_type lastUsed;
+    size_t size;
+    fs::path path;
+  };
+
+  std::vector<File> files;
+  size_t byteSize = 0;
+  std::error_code ec;
+  try {
+    for (auto const &file : fs::directory_iterator(m_directory, ec)) {
+      if (file.path().extension() == EntryExtension) {
+        auto size = static_cast<size_t>(file.file_size(ec));
+        files.push_back({file.last_write_time(ec), size, file.path()});
+        byteSize += size;
+      }
+    }
+  } catch (fs::filesystem_error const &) {
+    return;
+  }
+
+  std::sort(files.begin(), files.end(), [](const File &a, const File &b) { return a.lastUsed < b.lastUsed; });
+  for (auto const &file : files) {
+    if (byteSize <= budget) {
+      break;
+    }
+    if (fs::remove(file.path, ec)) {
+      byteSize -= file.size;
+    }
+  }
+  m_byteSize = byteSize;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Utils/ImageUtils.h>
+#include <winrt/Windows.Storage.Streams.h>
+#include <winrt/Windows.Web.Http.h>
+#include <mutex>
+#include <optional>
+
+namespace Microsoft::ReactNative {
+
+// Persistent cache of the responses of HTTP image requests, which keeps images loaded by earlier runs of the app.
+// Entries are stored in files named after a digest of the request, which hold the body of the response along with its
+// ETag, Last-Modified and the time until which Cache-Control (or Expires) lets it be used without revalidation.
+// The cache is capped in size, set in megabytes with the "Image.DiskCacheSizeMB" runtime option (a negative value
+// disables the cache), and the least recently used entries are deleted when it grows over the cap.
+// All methods do file IO, and should not be called on the UI thread.
+class ImageDiskCache final {
+ public:
+  struct Entry {
+    std::vector<uint8_t> body;
+    std::string etag;
+    std::string lastModified;
+    // Seconds since the Unix epoch
+    int64_t freshUntil{0};
+
+    bool isFresh() const noexcept;
+  };
+
+  static ImageDiskCache &Instance() noexcept;
+
+  // Returns an empty key when responses to the request are not cached
+  static std::string Key(const ReactImageSource &source) noexcept;
+
+  std::optional<Entry> read(const std::string &key) noexcept;
+  bool contains(const std::string &key) noexcept;
+
+  // Stores the body of a successful response, unless its Cache-Control forbids it
+  void store(
+      const std::string &key,
+      const winrt::Windows::Web::Http::HttpResponseMessage &response,
+      const std::vector<uint8_t> &body) noexcept;
+
+  // Updates the freshness of the entry from a 304 Not Modified response to a request made with AddValidators
+  void revalidate(
+      const std::string &key,
+      Entry &entry,
+      const winrt::Windows::Web::Http::HttpResponseMessage &response) noexcept;
+
+  // Makes the request conditional on the entry being outdated
+  static void AddValidators(const winrt::Windows::Web::Http::HttpRequestMessage &request, const Entry &entry) noexcept;
+
+  static winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Storage::Streams::IRandomAccessStream>
+  StreamFromBody(std::vector<uint8_t> body);
+
+ private:
+  ImageDiskCache() noexcept;
+
+  static size_t Budget() noexcept;
+  std::wstring entryPath(const std::string &key) const noexcept;
+  // Writes the entry with the given body, entry.body is ignored
+  void write(const std::string &key, const Entry &entry, const std::vector<uint8_t> &body) noexcept;
+  void trimLocked(size_t budget) noexcept;
+
+  std::wstring m_directory;
+  std::mutex m_mutex;
+  size_t m_byteSize{0};
+};
+
+} // namespace Microsoft::ReactNative
@@ -8,6 +8,8 @@
 #include <Networking/NetworkPropertyIds.h>
 #include <Shared/cdebug.h>
 #include <Utils/CppWinrtLessExceptions.h>
+#include <Utils/ImageDiskCache.h>
+#include <utilities.h>
 #include <windows.Web.Http.h>
 #include <winrt/Windows.Security.Cryptography.h>
 #include <winrt/Windows.Web.Http.Headers.h>
@@ -65,6 +67,13 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageStreamAsync(
       co_return stream;
     }
 
+    auto &diskCache = ImageDiskCache::Instance();
+    auto cacheKey = ImageDiskCache::Key(source);
+    auto cachedEntry = diskCache.read(cacheKey);
+    if (cachedEntry && cachedEntry->isFresh()) {
+      co_return co_await ImageDiskCache::StreamFromBody(std::move(cachedEntry->body));
+    }
+
     auto httpMethod{
         source.method.empty() ? winrt::HttpMethod::Get() : winrt::HttpMethod{winrt::to_hstring(source.method)}};
 
@@ -94,6 +103,10 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageStreamAsync(
       }
     }
 
+    if (cachedEntry) {
+      ImageDiskCache::AddValidators(request, *cachedEntry);
+    }
+
     winrt::HttpClient httpClient;
     auto httpClientAbi = reinterpret_cast<ABI::Windows::Web::Http::IHttpClient *>(winrt::get_abi(httpClient));
 
@@ -120,11 +133,38 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageStreamAsync(
         winrt::Windows::Web::Http::HttpProgress>>{asyncRequest};
 
     if (FAILED(asyncRequest.ErrorCode())) {
+      if (cachedEntry) {
+        // Outdated images are better than none while offline
+        co_return co_await ImageDiskCache::StreamFromBody(std::move(cachedEntry->body));
+      }
       co_return nullptr;
     }
 
     winrt::HttpResponseMessage response{asyncRequest.GetResults()};
 
+    if (response && cachedEntry && response.StatusCode() == winrt::HttpStatusCode::NotModified) {
+      diskCache.revalidate(cacheKey, *cachedEntry, response);
+      co_return co_await ImageDiskCache::StreamFromBody(std::move(cachedEntry->body));
+    }
+
+    if (response && response.StatusCode() == winrt::HttpStatusCode::Ok && !cacheKey.empty()) {
+      auto asyncBuffer = response.Content().ReadAsBufferAsync();
+      co_await lessthrow_await_adapter<
+          winrt::Windows::Foundation::IAsyncOperationWithProgress<winrt::Windows::Storage::Streams::IBuffer, uint64_t>>{
+          asyncBuffer};
+      if (FAILED(asyncBuffer.ErrorCode())) {
+        co_return nullptr;
+      }
+
+      winrt::IBuffer buffer{asyncBuffer.GetResults()};
+      diskCache.store(cacheKey, response, std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.Length()));
+
+      winrt::InMemoryRandomAccessStream memoryStream;
+      co_await memoryStream.WriteAsync(buffer);
+      memoryStream.Seek(0);
+      co_return memoryStream;
+    }
+
     if (response && response.StatusCode() == winrt::HttpStatusCode::Ok) {
       auto asyncRead = response.Content().ReadAsInputStreamAsync();
       co_await lessthrow_await_adapter<winrt::Windows::Foundation::IAsyncOperationWithProgress<
@@ -163,11 +203,14 @@ winrt::IAsyncOperation<winrt::IRandomAccessStream> GetImageInlineDataAsync(React
     co_await winrt::resume_background();
 
     std::string_view base64String(source.uri.c_str() + start + 1, source.uri.length() - start - 1);
-    auto buffer = winrt::Windows::Security::Cryptography::CryptographicBuffer::DecodeFromBase64String(
-        winrt::to_hstring(base64String));
+    std::vector<uint8_t> bytes;
+    if (!Microsoft::React::Utilities::TryDecodeBase64(base64String, bytes)) {
+      co_return nullptr;
+    }
 
     winrt::InMemoryRandomAccessStream memoryStream;
-    co_await memoryStream.WriteAsync(buffer);
+    co_await memoryStream.WriteAsync(
+        winrt::Windows::Security::Cryptography::CryptographicBuffer::CreateFromByteArray(bytes));
     memoryStream.Seek(0);
 
     co_return memoryStream;
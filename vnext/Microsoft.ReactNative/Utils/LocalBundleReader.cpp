@@ -3,8 +3,10 @@
 
 #include "pch.h"
 
+#include <MemoryMappedBuffer.h>
 #include <Utils/LocalBundleReader.h>
 #include <fmt/format.h>
+#include <tracing/tracing.h>
 #include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Storage.h>
 #include "Unicode.h"
@@ -16,42 +18,134 @@
 
 namespace Microsoft::ReactNative {
 
-std::string GetBundleFromEmbeddedResource(const winrt::Windows::Foundation::Uri &uri) {
-  auto moduleName = uri.Host();
-  auto path = uri.Path();
-  // skip past the leading / slash
-  auto resourceName = path.c_str() + 1;
-
-  auto hmodule = GetModuleHandle(moduleName != L"" ? moduleName.c_str() : nullptr);
-  if (!hmodule) {
-    throw std::invalid_argument(fmt::format("Couldn't find module {}", winrt::to_string(moduleName)));
+// The data of a resource embedded in a module, which keeps the module loaded while the data is in use.
+class EmbeddedResourceBuffer final : public facebook::jsi::Buffer {
+ public:
+  EmbeddedResourceBuffer(const winrt::Windows::Foundation::Uri &uri) {
+    auto moduleName = uri.Host();
+    auto path = uri.Path();
+    // skip past the leading / slash
+    auto resourceName = path.c_str() + 1;
+
+    // Unlike GetModuleHandle, this adds a reference to the module, which is released with the buffer.
+    if (!GetModuleHandleExW(0, moduleName != L"" ? moduleName.c_str() : nullptr, &m_module)) {
+      throw std::invalid_argument(fmt::format("Couldn't find module {}", winrt::to_string(moduleName)));
+    }
+
+    try {
+      auto resource = FindResourceW(m_module, resourceName, RT_RCDATA);
+      if (!resource) {
+        throw std::invalid_argument(fmt::format(
+            "Couldn't find resource {} in module {}", winrt::to_string(resourceName), winrt::to_string(moduleName)));
+      }
+
+      auto hglobal = LoadResource(m_module, resource);
+      if (!hglobal) {
+        throw std::invalid_argument(fmt::format(
+            "Couldn't load resource {} in module {}", winrt::to_string(resourceName), winrt::to_string(moduleName)));
+      }
+
+      m_data = static_cast<const uint8_t *>(LockResource(hglobal));
+      if (!m_data) {
+        throw std::invalid_argument(fmt::format(
+            "Couldn't lock resource {} in module {}", winrt::to_string(resourceName), winrt::to_string(moduleName)));
+      }
+
+      m_size = SizeofResource(m_module, resource);
+      if (!m_size) {
+        throw std::invalid_argument(fmt::format(
+            "Couldn't get size of resource {} in module {}",
+            winrt::to_string(resourceName),
+            winrt::to_string(moduleName)));
+      }
+    } catch (...) {
+      FreeLibrary(m_module);
+      throw;
+    }
   }
 
-  auto resource = FindResourceW(hmodule, resourceName, RT_RCDATA);
-  if (!resource) {
-    throw std::invalid_argument(fmt::format(
-        "Couldn't find resource {} in module {}", winrt::to_string(resourceName), winrt::to_string(moduleName)));
+  EmbeddedResourceBuffer(const EmbeddedResourceBuffer &) = delete;
+  EmbeddedResourceBuffer &operator=(const EmbeddedResourceBuffer &) = delete;
+
+  ~EmbeddedResourceBuffer() override {
+    FreeLibrary(m_module);
   }
 
-  auto hglobal = LoadResource(hmodule, resource);
-  if (!hglobal) {
-    throw std::invalid_argument(fmt::format(
-        "Couldn't load resource {} in module {}", winrt::to_string(resourceName), winrt::to_string(moduleName)));
+  const uint8_t *data() const override {
+    return m_data;
   }
 
-  auto start = static_cast<char *>(LockResource(hglobal));
-  if (!start) {
-    throw std::invalid_argument(fmt::format(
-        "Couldn't lock resource {} in module {}", winrt::to_string(resourceName), winrt::to_string(moduleName)));
+  size_t size() const override {
+    return m_size;
   }
 
-  auto size = SizeofResource(hmodule, resource);
-  if (!size) {
-    throw std::invalid_argument(fmt::format(
-        "Couldn't get size of resource {} in module {}", winrt::to_string(resourceName), winrt::to_string(moduleName)));
+  // Leaves out the terminating null character of the resource from the size of the buffer
+  bool TrimNullTerminator() noexcept {
+    if (m_data[m_size - 1] != '\0') {
+      return false;
+    }
+    --m_size;
+    return true;
   }
 
-  return std::string(start, start + size);
+ private:
+  HMODULE m_module{};
+  const uint8_t *m_data{};
+  size_t m_size{};
+};
+
+std::string GetBundleFromEmbeddedResource(const winrt::Windows::Foundation::Uri &uri) {
+  EmbeddedResourceBuffer buffer{uri};
+  auto start = reinterpret_cast<const char *>(buffer.data());
+  return std::string(start, start + buffer.size());
+}
+
+std::unique_ptr<const facebook::jsi::Buffer> MapBundleResource(const winrt::Windows::Foundation::Uri &uri) {
+  // Resources are mapped with their module, so a bundle that is embedded with its terminating null character is used
+  // in place. Any other bundle has to be copied to be null terminated.
+  auto buffer = std::make_unique<EmbeddedResourceBuffer>(uri);
+  if (buffer->TrimNullTerminator()) {
+    return buffer;
+  }
+
+  return std::make_unique<facebook::jsi::StringBuffer>(
+      std::string(reinterpret_cast<const char *>(buffer->data()), buffer->size()));
+}
+
+// Read the buffer manually to avoid a Utf8 -> Utf16 -> Utf8 encoding roundtrip.
+std::string ReadBundleBuffer(const winrt::Windows::Storage::Streams::IBuffer &fileBuffer) {
+  auto dataReader{winrt::Windows::Storage::Streams::DataReader::FromBuffer(fileBuffer)};
+
+  // No need to use length + 1, STL guarantees that string storage is null-terminated.
+  std::string script(fileBuffer.Length(), '\0');
+
+  // Construct the array_view to slice into the first fileBuffer.Length bytes.
+  // DataReader.ReadBytes will read as many bytes as are present in the
+  // array_view. The backing string has fileBuffer.Length() + 1 bytes, without
+  // an explicit end it will read 1 byte to many and throw.
+  dataReader.ReadBytes(winrt::array_view<uint8_t>{
+      reinterpret_cast<uint8_t *>(&script[0]), reinterpret_cast<uint8_t *>(&script[script.length()])});
+  dataReader.Close();
+
+  return script;
+}
+
+std::unique_ptr<const facebook::jsi::Buffer> MapBundleFile(const std::wstring &path) {
+  auto buffer = Microsoft::JSI::MakeMemoryMappedBuffer(path.c_str());
+
+  // The view is zero filled from the end of the file to the end of its page, which null terminates the bundle. A file
+  // that ends on a page boundary has to be copied to be null terminated.
+  static const DWORD s_pageSize = [] {
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwPageSize;
+  }();
+  if (buffer->size() % s_pageSize != 0) {
+    return buffer;
+  }
+
+  return std::make_unique<facebook::jsi::StringBuffer>(
+      std::string(reinterpret_cast<const char *>(buffer->data()), buffer->size()));
 }
 
 std::future<std::string> LocalBundleReader::LoadBundleAsync(const std::wstring bundleUri) {
@@ -71,23 +165,38 @@ std::future<std::string> LocalBundleReader::LoadBundleAsync(const std::wstring b
       file = co_await winrt::Windows::Storage::StorageFile::GetFileFromPathAsync(bundleUri);
     }
 
-    // Read the buffer manually to avoid a Utf8 -> Utf16 -> Utf8 encoding
-    // roundtrip.
-    auto fileBuffer{co_await winrt::Windows::Storage::FileIO::ReadBufferAsync(file)};
-    auto dataReader{winrt::Windows::Storage::Streams::DataReader::FromBuffer(fileBuffer)};
+    co_return ReadBundleBuffer(co_await winrt::Windows::Storage::FileIO::ReadBufferAsync(file));
+  }
+  // RuntimeScheduler only handles std::exception or jsi::JSError
+  catch (winrt::hresult_error const &e) {
+    throw std::exception(winrt::to_string(e.message()).c_str());
+  }
+}
+
+std::future<std::unique_ptr<const facebook::jsi::Buffer>> LocalBundleReader::LoadBundleBufferAsync(
+    const std::wstring bundleUri) {
+  try {
+    co_await winrt::resume_background();
+    facebook::react::tracing::StartupPhaseScope readPhase{"BundleRead"};
 
-    // No need to use length + 1, STL guarantees that string storage is null-terminated.
-    std::string script(fileBuffer.Length(), '\0');
+    if (bundleUri.starts_with(L"resource://")) {
+      winrt::Windows::Foundation::Uri uri(bundleUri);
+      co_return MapBundleResource(uri);
+    }
 
-    // Construct the array_view to slice into the first fileBuffer.Length bytes.
-    // DataReader.ReadBytes will read as many bytes as are present in the
-    // array_view. The backing string has fileBuffer.Length() + 1 bytes, without
-    // an explicit end it will read 1 byte to many and throw.
-    dataReader.ReadBytes(winrt::array_view<uint8_t>{
-        reinterpret_cast<uint8_t *>(&script[0]), reinterpret_cast<uint8_t *>(&script[script.length()])});
-    dataReader.Close();
+    // Supports "ms-appx://" or "ms-appdata://"
+    if (bundleUri.starts_with(L"ms-app")) {
+      winrt::Windows::Foundation::Uri uri(bundleUri);
+      auto file = co_await winrt::Windows::Storage::StorageFile::GetFileFromApplicationUriAsync(uri);
+      if (file.Path().empty()) {
+        co_return std::make_unique<facebook::jsi::StringBuffer>(
+            ReadBundleBuffer(co_await winrt::Windows::Storage::FileIO::ReadBufferAsync(file)));
+      }
+
+      co_return MapBundleFile(std::wstring{file.Path()});
+    }
 
-    co_return script;
+    co_return MapBundleFile(bundleUri);
   }
   // RuntimeScheduler only handles std::exception or jsi::JSError
   catch (winrt::hresult_error const &e) {
@@ -100,7 +209,7 @@ std::string LocalBundleReader::LoadBundle(const std::wstring &bundlePath) {
 }
 
 StorageFileBigString::StorageFileBigString(const std::wstring &path) {
-  m_futureBuffer = LocalBundleReader::LoadBundleAsync(path);
+  m_futureBuffer = LocalBundleReader::LoadBundleBufferAsync(path);
 }
 
 bool StorageFileBigString::isAscii() const {
@@ -109,17 +218,17 @@ bool StorageFileBigString::isAscii() const {
 
 const char *StorageFileBigString::c_str() const {
   ensure();
-  return m_string.c_str();
+  return reinterpret_cast<const char *>(m_buffer->data());
 }
 
 size_t StorageFileBigString::size() const {
   ensure();
-  return m_string.size();
+  return m_buffer->size();
 }
 
 void StorageFileBigString::ensure() const {
-  if (m_string.empty()) {
-    m_string = m_futureBuffer.get();
+  if (!m_buffer) {
+    m_buffer = m_futureBuffer.get();
   }
 }
 
@@ -3,7 +3,9 @@
 
 #pragma once
 #include <cxxreact/JSBigString.h>
+#include <jsi/jsi.h>
 #include <future>
+#include <memory>
 #include <string>
 
 namespace Microsoft::ReactNative {
@@ -12,6 +14,9 @@ class LocalBundleReader {
  public:
   static std::future<std::string> LoadBundleAsync(const std::wstring bundlePath);
   static std::string LoadBundle(const std::wstring &bundlePath);
+  // File paths, ms-appx/ms-appdata bundles and null terminated resource:// bundles are memory mapped instead of copied
+  // to the heap
+  static std::future<std::unique_ptr<const facebook::jsi::Buffer>> LoadBundleBufferAsync(const std::wstring bundlePath);
 };
 
 class StorageFileBigString : public facebook::react::JSBigString {
@@ -24,8 +29,8 @@ class StorageFileBigString : public facebook::react::JSBigString {
   void ensure() const;
 
  private:
-  mutable std::future<std::string> m_futureBuffer;
-  mutable std::string m_string;
+  mutable std::future<std::unique_ptr<const facebook::jsi::Buffer>> m_futureBuffer;
+  mutable std::unique_ptr<const facebook::jsi::Buffer> m_buffer;
 };
 
 } // namespace Microsoft::ReactNative
@@ -1,5 +1,6 @@
 #include "pch.h"
 
+#include <MemoryMappedBuffer.h>
 #include <Utils/UwpPreparedScriptStore.h>
 #include <Utils/UwpScriptStore.h>
 #include <jsi/jsi.h>
@@ -31,21 +32,15 @@ std::shared_ptr<const facebook::jsi::Buffer> UwpPreparedScriptStore::tryGetPrepa
     ) noexcept {
   try {
     // check if app bundle version is older than or equal to the prepared script
-    // version if true then just read the buffer from the prepared script and
-    // return
+    // version if true then just map the prepared script and return it
     auto byteCodeFile = TryGetByteCodeFileSync(scriptSignature);
     if (byteCodeFile == nullptr) {
       return nullptr;
     }
 
-    auto buffer = winrt::FileIO::ReadBufferAsync(byteCodeFile).get();
-    auto bytecodeBuffer(std::make_shared<ByteCodeBuffer>(buffer.Length()));
-    auto dataReader{winrt::Streams::DataReader::FromBuffer(buffer)};
-    dataReader.ReadBytes(
-        winrt::array_view<uint8_t>{&bytecodeBuffer->data()[0], &bytecodeBuffer->data()[bytecodeBuffer->size()]});
-    dataReader.Close();
-
-    return bytecodeBuffer;
+    // The file is mapped rather than read, so that its pages are only read when the runtime touches them, and are
+    // backed by the file instead of committed private memory
+    return Microsoft::JSI::MakeMemoryMappedBuffer(byteCodeFile.Path().c_str());
   } catch (...) {
     return nullptr;
   }
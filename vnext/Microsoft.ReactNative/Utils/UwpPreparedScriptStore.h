@@ -37,26 +37,4 @@ class UwpPreparedScriptStore : public facebook::jsi::PreparedScriptStore {
   winrt::Windows::Storage::StorageFile TryGetByteCodeFileSync(const facebook::jsi::ScriptSignature &scriptSignature);
   winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Storage::StorageFile> m_byteCodeFileAsync;
 };
-
-class ByteCodeBuffer final : public facebook::jsi::Buffer {
- public:
-  size_t size() const override {
-    return size_;
-  }
-  const uint8_t *data() const {
-    return byteArray_.get();
-  }
-
-  uint8_t *data() {
-    return byteArray_.get();
-  }
-
-  ByteCodeBuffer(int size) : size_(size), byteArray_(std::make_unique<uint8_t[]>(size)) {}
-  ByteCodeBuffer(const ByteCodeBuffer &) = delete;
-  void operator=(const ByteCodeBuffer &) = delete;
-
- private:
-  int size_;
-  std::unique_ptr<uint8_t[]> byteArray_;
-};
 } // namespace Microsoft::ReactNative
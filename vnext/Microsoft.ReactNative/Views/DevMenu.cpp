@@ -5,6 +5,7 @@
 
 #include "DevMenu.h"
 
+#include <Fabric/FabricUIManagerModule.h>
 #include <winrt/Windows.ApplicationModel.DataTransfer.h>
 #include "IReactDispatcher.h"
 #include "Modules/DevSettingsModule.h"
@@ -107,6 +108,13 @@ struct WindowsPopupMenuDevMenu : public IDevMenu, public std::enable_shared_from
           DevSettings::ToggleElementInspector(*context);
         }));
 
+    m_menu.Commands().Append(winrt::Windows::UI::Popups::UICommand(
+        L"Toggle Performance Monitor", [context = m_context](winrt::Windows::UI::Popups::IUICommand const &) {
+          if (auto fabricUIManager = FabricUIManager::FromProperties(React::ReactPropertyBag(context->Properties()))) {
+            fabricUIManager->togglePerformanceOverlay();
+          }
+        }));
+
     m_menu.ShowAsync({0, 0});
   }
 
@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "future/future.h"
+#include "future/futureWait.h"
+#include "motifCpp/testCheck.h"
+
+namespace DispatchQueueTests {
+
+// Baselines for the dispatch queue and future optimizations. Each benchmark prints its results, and only checks that
+// all of its work was done, so that it never fails on a slow machine.
+TEST_CLASS (DispatchQueueBenchmark) {
+  TEST_METHOD(DispatchQueueBenchmark_PostThroughput) {
+    constexpr uint32_t taskCount = 100000;
+    struct QueueKind {
+      const char *Name;
+      Mso::DispatchQueue (*MakeQueue)();
+    };
+    const QueueKind queueKinds[] = {
+        {"Serial", []() { return Mso::DispatchQueue::MakeSerialQueue(); }},
+        {"Concurrent", []() { return Mso::DispatchQueue::MakeConcurrentQueue(4); }},
+        {"Looper", []() { return Mso::DispatchQueue::MakeLooperQueue(); }},
+        {"Work stealing", []() { return Mso::DispatchQueue::MakeWorkStealingQueue(4); }},
+    };
+
+    for (const auto &queueKind : queueKinds) {
+      auto queue = queueKind.MakeQueue();
+      std::atomic<uint32_t> callCount{0};
+      Mso::ManualResetEvent finished;
+      auto start = std::chrono::steady_clock::now();
+      for (uint32_t i = 0; i < taskCount; ++i) {
+        queue.Post([&callCount, finished]() noexcept {
+          if (++callCount == taskCount) {
+            finished.Set();
+          }
+        });
+      }
+      auto postDuration = std::chrono::steady_clock::now() - start;
+      finished.Wait();
+      auto totalDuration = std::chrono::steady_clock::now() - start;
+
+      TestCheck(callCount == taskCount);
+      std::printf(
+          "%s queue: posted %u tasks in %lld ms, all tasks ran in %lld ms, %.0f tasks/s\n",
+          queueKind.Name,
+          taskCount,
+          ToMilliseconds(postDuration),
+          ToMilliseconds(totalDuration),
+          PerSecond(taskCount, totalDuration));
+    }
+  }
+
+  TEST_METHOD(DispatchQueueBenchmark_CrossThreadLatency) {
+    // The time from posting a task to a looper queue until it runs, when the queue is idle
+    constexpr uint32_t sampleCount = 2000;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue();
+    std::vector<std::chrono::steady_clock::duration> latencies;
+    latencies.reserve(sampleCount);
+    Mso::AutoResetEvent taskRan;
+    for (uint32_t i = 0; i < sampleCount; ++i) {
+      auto postTime = std::chrono::steady_clock::now();
+      queue.Post([&latencies, postTime, taskRan]() noexcept {
+        latencies.push_back(std::chrono::steady_clock::now() - postTime);
+        taskRan.Set();
+      });
+      taskRan.Wait();
+    }
+
+    TestCheck(latencies.size() == sampleCount);
+    std::sort(latencies.begin(), latencies.end());
+    std::printf(
+        "Looper queue latency: median %lld us, p99 %lld us, max %lld us\n",
+        ToMicroseconds(latencies[sampleCount / 2]),
+        ToMicroseconds(latencies[sampleCount * 99 / 100]),
+        ToMicroseconds(latencies.back()));
+  }
+
+  TEST_METHOD(DispatchQueueBenchmark_TaskBatching) {
+    // Posts the tasks from a task of another queue, one by one and then in one batch
+    constexpr uint32_t taskCount = 100000;
+    auto targetQueue = Mso::DispatchQueue::MakeLooperQueue();
+    auto postingQueue = Mso::DispatchQueue::MakeLooperQueue();
+    for (bool useTaskBatch : {false, true}) {
+      std::atomic<uint32_t> callCount{0};
+      Mso::ManualResetEvent finished;
+      auto start = std::chrono::steady_clock::now();
+      postingQueue.Post([&callCount, finished, targetQueue, useTaskBatch]() noexcept {
+        Mso::DispatchTaskBatch taskBatch{nullptr};
+        if (useTaskBatch) {
+          taskBatch = targetQueue.StartTaskBatching();
+        }
+
+        for (uint32_t i = 0; i < taskCount; ++i) {
+          targetQueue.Post([&callCount, finished]() noexcept {
+            if (++callCount == taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+      finished.Wait();
+      auto duration = std::chrono::steady_clock::now() - start;
+
+      TestCheck(callCount == taskCount);
+      std::printf(
+          "%s: %u tasks ran in %lld ms, %.0f tasks/s\n",
+          useTaskBatch ? "Batched" : "Not batched",
+          taskCount,
+          ToMilliseconds(duration),
+          PerSecond(taskCount, duration));
+    }
+  }
+
+  TEST_METHOD(DispatchQueueBenchmark_ThenChain) {
+    // The cost of each continuation in a chain, when it runs inline and when it is posted to a queue
+    constexpr uint32_t chainLength = 100;
+    constexpr uint32_t chainCount = 500;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue();
+    for (bool useQueue : {false, true}) {
+      auto start = std::chrono::steady_clock::now();
+      for (uint32_t chain = 0; chain < chainCount; ++chain) {
+        Mso::Promise<uint32_t> promise;
+        Mso::Future<uint32_t> future = promise.AsFuture();
+        for (uint32_t i = 0; i < chainLength; ++i) {
+          if (useQueue) {
+            future = future.Then(queue, [](uint32_t value) noexcept { return value + 1; });
+          } else {
+            future = future.Then([](uint32_t value) noexcept { return value + 1; });
+          }
+        }
+        promise.SetValue(0);
+        TestCheck(Mso::FutureWaitAndGetValue(future) == chainLength);
+      }
+      auto duration = std::chrono::steady_clock::now() - start;
+
+      std::printf(
+          "%s continuations: %u chains of %u in %lld ms, %.0f ns per continuation\n",
+          useQueue ? "Queued" : "Inline",
+          chainCount,
+          chainLength,
+          ToMilliseconds(duration),
+          std::chrono::duration<double, std::nano>(duration).count() / (chainCount * chainLength));
+    }
+  }
+
+  TEST_METHOD(DispatchQueueBenchmark_ProducerContention) {
+    // The total number of tasks stays the same, while the number of threads posting them grows
+    constexpr uint32_t taskCount = 160000;
+    for (bool useLockFreeTaskQueue : {false, true}) {
+      for (uint32_t producerCount : {1u, 2u, 4u, 8u, 16u}) {
+        Mso::DispatchQueueSettings settings;
+        settings.UseLockFreeTaskQueue = useLockFreeTaskQueue;
+        auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+        const uint32_t tasksPerProducer = taskCount / producerCount;
+        std::atomic<uint32_t> callCount{0};
+        Mso::ManualResetEvent startPosting;
+        Mso::ManualResetEvent finished;
+        std::vector<std::thread> producers;
+        for (uint32_t i = 0; i < producerCount; ++i) {
+          producers.emplace_back([&queue, &callCount, startPosting, finished, tasksPerProducer]() noexcept {
+            startPosting.Wait();
+            for (uint32_t j = 0; j < tasksPerProducer; ++j) {
+              queue.Post([&callCount, finished]() noexcept {
+                if (++callCount == taskCount) {
+                  finished.Set();
+                }
+              });
+            }
+          });
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        startPosting.Set();
+        for (auto &producer : producers) {
+          producer.join();
+        }
+        finished.Wait();
+        auto duration = std::chrono::steady_clock::now() - start;
+
+        TestCheck(callCount == taskCount);
+        std::printf(
+            "%s queue, %u producers: %u tasks ran in %lld ms, %.0f tasks/s\n",
+            useLockFreeTaskQueue ? "Lock free" : "Locked",
+            producerCount,
+            taskCount,
+            ToMilliseconds(duration),
+            PerSecond(taskCount, duration));
+      }
+    }
+  }
+
+ private:
+  static long long ToMilliseconds(std::chrono::steady_clock::duration duration) noexcept {
+    return static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+  }
+
+  static long long ToMicroseconds(std::chrono::steady_clock::duration duration) noexcept {
+    return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+  }
+
+  static double PerSecond(uint32_t count, std::chrono::steady_clock::duration duration) noexcept {
+    auto seconds = std::chrono::duration<double>(duration).count();
+    return seconds > 0 ? count / seconds : 0;
+  }
+};
+
+} // namespace DispatchQueueTests
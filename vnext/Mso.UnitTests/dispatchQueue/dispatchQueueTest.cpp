@@ -2,9 +2,14 @@
 // Licensed under the MIT license.
 
 #include "dispatchQueue/dispatchQueue.h"
+#include "dispatchQueue/dispatchQueueMetrics.h"
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdio>
 #include <mutex>
+#include <thread>
+#include <vector>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "motifCpp/testCheck.h"
 #include "winrt/Windows.Foundation.h"
@@ -46,7 +51,241 @@ TEST_CLASS (DispatchQueueTest) {
     WithSerialQueue(TestShutdownFromPreviousTask);
   }
 
+  TEST_METHOD(DispatchQueue_LockFreeLooperQueue_RunsTasksInOrder) {
+    Mso::DispatchQueueSettings settings;
+    settings.UseLockFreeTaskQueue = true;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+    constexpr int taskCount = 1000;
+    int nextTask = 0;
+    bool isInOrder = true;
+    Mso::ManualResetEvent finished;
+    for (int i = 0; i < taskCount; ++i) {
+      queue.Post([&, i]() {
+        isInOrder = isInOrder && nextTask == i;
+        if (++nextTask == taskCount) {
+          finished.Set();
+        }
+      });
+    }
+
+    finished.Wait();
+    TestCheck(isInOrder);
+  }
+
+  TEST_METHOD(DispatchQueue_LockFreeLooperQueue_Suspend) {
+    Mso::DispatchQueueSettings settings;
+    settings.UseLockFreeTaskQueue = true;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+    std::atomic<int> callCount{0};
+    Mso::ManualResetEvent finished;
+    {
+      auto suspendGuard = queue.Suspend();
+      PostFromThreads(queue, /*threadCount:*/ 4, /*tasksPerThread:*/ 100, callCount, finished);
+      TestCheck(callCount == 0);
+    }
+
+    finished.Wait();
+    TestCheck(callCount == 400);
+  }
+
+  TEST_METHOD(DispatchQueue_LockFreeLooperQueue_ShutdownCompletesPendingTasks) {
+    Mso::DispatchQueueSettings settings;
+    settings.UseLockFreeTaskQueue = true;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+    std::atomic<int> callCount{0};
+    Mso::ManualResetEvent finished;
+    PostFromThreads(queue, /*threadCount:*/ 4, /*tasksPerThread:*/ 100, callCount, finished);
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+
+    TestCheck(callCount == 400);
+  }
+
+  TEST_METHOD(DispatchQueue_LooperQueue_RunsHigherPriorityTasksFirst) {
+    for (bool useLockFreeTaskQueue : {false, true}) {
+      Mso::DispatchQueueSettings settings;
+      settings.UseLockFreeTaskQueue = useLockFreeTaskQueue;
+      auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+      std::vector<int> order;
+      Mso::ManualResetEvent finished;
+      {
+        // Tasks are queued up while the queue is suspended, so that they all wait for the dequeue at once
+        auto suspendGuard = queue.Suspend();
+        queue.Post([&]() { order.push_back(3); }, Mso::DispatchTaskPriority::Background);
+        queue.Post([&]() { order.push_back(2); });
+        queue.Post([&]() { order.push_back(1); }, Mso::DispatchTaskPriority::UserBlocking);
+        queue.Post([&]() { order.push_back(0); }, Mso::DispatchTaskPriority::Immediate);
+        queue.Post([&]() { order.push_back(4); }, Mso::DispatchTaskPriority::Background);
+        queue.Post([&]() { finished.Set(); }, Mso::DispatchTaskPriority::Background);
+      }
+
+      finished.Wait();
+      TestCheck(order == (std::vector<int>{0, 1, 2, 3, 4}));
+    }
+  }
+
+  TEST_METHOD(DispatchQueue_LooperQueue_RecordsMetrics) {
+    auto metrics = std::make_shared<Mso::DispatchQueueMetrics>("Test");
+    Mso::DispatchQueueSettings settings;
+    settings.Metrics = metrics;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+    {
+      auto suspendGuard = queue.Suspend();
+      for (int i = 0; i < 3; ++i) {
+        queue.Post([]() { Mso::DispatchQueueMetrics::SetCurrentTaskName("Layout"); });
+      }
+      queue.Post([]() {});
+      queue.Post([]() {});
+      TestCheck(metrics->GetSnapshot().QueueDepth == 5);
+    }
+
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+
+    auto snapshot = metrics->GetSnapshot();
+    TestCheck(snapshot.QueueName == "Test");
+    TestCheck(snapshot.TaskCount == 5);
+    TestCheck(snapshot.QueueDepth == 0);
+    TestCheck(snapshot.MaxQueueDepth == 5);
+    TestCheck(snapshot.TopTasks.size() == 2);
+    for (const auto &task : snapshot.TopTasks) {
+      TestCheck(task.Count == (task.Name == "Layout" ? 3u : 2u));
+    }
+  }
+
+  TEST_METHOD(DispatchQueue_LooperQueue_RecordsTaskOrigins) {
+    std::vector<std::string> origins;
+    auto metrics = std::make_shared<Mso::DispatchQueueMetrics>(
+        "Test", [&origins](const Mso::DispatchQueueMetrics::TaskRecord &record) noexcept {
+          origins.emplace_back(record.Origin);
+        });
+    Mso::DispatchQueueSettings settings;
+    settings.Metrics = metrics;
+    auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+    Mso::ManualResetEvent finished;
+    {
+      auto suspendGuard = queue.Suspend();
+      {
+        Mso::DispatchQueueMetrics::OriginScope originScope{"Timer 1"};
+        // The task posted by the task has the same origin
+        queue.Post([queue, &finished]() noexcept { queue.Post([&finished]() { finished.Set(); }); });
+      }
+      queue.Post([]() { Mso::DispatchQueueMetrics::SetCurrentTaskOrigin("MountTransaction"); });
+      queue.Post([]() {});
+      TestCheck(Mso::DispatchQueueMetrics::CurrentOrigin().empty());
+    }
+
+    finished.Wait();
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+
+    TestCheck(origins == (std::vector<std::string>{"Timer 1", "MountTransaction", "", "Timer 1"}));
+  }
+
+  TEST_METHOD(DispatchQueue_WorkStealingQueue_RunsNestedTasks) {
+    auto queue = Mso::DispatchQueue::MakeWorkStealingQueue(/*workerCount:*/ 4);
+    TestCheck(!queue.IsSerial());
+
+    constexpr int taskCount = 100;
+    constexpr int nestedTaskCount = 10;
+    std::atomic<int> callCount{0};
+    Mso::ManualResetEvent finished;
+    for (int i = 0; i < taskCount; ++i) {
+      queue.Post([&]() {
+        TestCheck(queue.HasThreadAccess());
+        for (int j = 0; j < nestedTaskCount; ++j) {
+          queue.Post([&]() {
+            if (++callCount == taskCount * nestedTaskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    finished.Wait();
+    TestCheck(!queue.HasThreadAccess());
+    queue.AwaitTermination();
+    TestCheck(callCount == taskCount * nestedTaskCount);
+  }
+
+  TEST_METHOD(DispatchQueue_WorkStealingQueue_ShutdownCompletesPendingTasks) {
+    auto queue = Mso::DispatchQueue::MakeWorkStealingQueue();
+
+    std::atomic<int> callCount{0};
+    Mso::ManualResetEvent finished;
+    PostFromThreads(queue, /*threadCount:*/ 4, /*tasksPerThread:*/ 100, callCount, finished);
+    queue.Shutdown(Mso::PendingTaskAction::Complete);
+    queue.AwaitTermination();
+
+    TestCheck(callCount == 400);
+  }
+
+  // Compares posting from many threads at once with and without the queue lock
+  TEST_METHOD(DispatchQueue_LooperQueue_PostContentionBenchmark) {
+    constexpr uint32_t threadCount = 8;
+    constexpr uint32_t tasksPerThread = 20000;
+    for (bool useLockFreeTaskQueue : {false, true}) {
+      Mso::DispatchQueueSettings settings;
+      settings.UseLockFreeTaskQueue = useLockFreeTaskQueue;
+      auto queue = Mso::DispatchQueue::MakeLooperQueue(settings);
+
+      std::atomic<int> callCount{0};
+      Mso::ManualResetEvent finished;
+      auto start = std::chrono::steady_clock::now();
+      PostFromThreads(queue, threadCount, tasksPerThread, callCount, finished);
+      auto postDuration = std::chrono::steady_clock::now() - start;
+      finished.Wait();
+      auto totalDuration = std::chrono::steady_clock::now() - start;
+
+      TestCheck(callCount == static_cast<int>(threadCount * tasksPerThread));
+      std::printf(
+          "%s queue: %u threads posted %u tasks each in %lld ms, all tasks ran in %lld ms\n",
+          useLockFreeTaskQueue ? "Lock free" : "Locked",
+          threadCount,
+          tasksPerThread,
+          static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(postDuration).count()),
+          static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(totalDuration).count()));
+    }
+  }
+
  private:
+  // Posts the tasks from all threads at the same time, and returns once all of them are posted.
+  // The finished event is set by the last task.
+  static void PostFromThreads(
+      Mso::DispatchQueue const &queue,
+      uint32_t threadCount,
+      uint32_t tasksPerThread,
+      std::atomic<int> &callCount,
+      Mso::ManualResetEvent const &finished) {
+    const int taskCount = static_cast<int>(threadCount * tasksPerThread);
+    Mso::ManualResetEvent startPosting;
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&]() {
+        startPosting.Wait();
+        for (uint32_t j = 0; j < tasksPerThread; ++j) {
+          queue.Post([&callCount, finished, taskCount]() {
+            if (++callCount == taskCount) {
+              finished.Set();
+            }
+          });
+        }
+      });
+    }
+
+    startPosting.Set();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
   static void TestShutdown(Mso::DispatchQueue queue, Mso::VoidFunctor drainQueue) {
     // Check that there is no dead lock if queue is released outside of task.
     int callCount = 0;
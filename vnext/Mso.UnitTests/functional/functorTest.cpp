@@ -2,7 +2,10 @@
 // Licensed under the MIT license.
 
 #include "functional/functor.h"
+#include <memory>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 #include "functorTest.h"
 #include "motifCpp/testCheck.h"
 
@@ -1503,6 +1506,31 @@ TestClassComponent(FunctorNoexceptTest, Mso.Functor.Noexcept) TEST_CLASS (Functo
   TEST_METHOD(Functor_noexcept_CheckOverload) {
     TestCheckEqual(3, CheckFunctorOverload::CheckOverload());
   }
+
+  TEST_METHOD(Functor_Lambda_ReleaseOnOtherThread) {
+    // The functors are created on one thread and released on another one, like the tasks posted to a dispatch queue,
+    // so that their memory goes back to the creating thread through the allocator depot.
+    constexpr int functorCount = 1000;
+    auto value = std::make_shared<int>(0);
+    for (int round = 0; round < 3; ++round) {
+      std::vector<Mso::VoidFunctor> functors;
+      functors.reserve(functorCount);
+      for (int i = 0; i < functorCount; ++i) {
+        functors.push_back([value, i]() noexcept { *value += i; });
+      }
+
+      std::thread invokingThread{[&functors]() noexcept {
+        for (auto &functor : functors) {
+          functor();
+          functor = nullptr;
+        }
+      }};
+      invokingThread.join();
+    }
+
+    TestCheckEqual(3 * functorCount * (functorCount - 1) / 2, *value);
+    TestCheckEqual(1, value.use_count());
+  }
 };
 
 } // namespace FunctionalTests
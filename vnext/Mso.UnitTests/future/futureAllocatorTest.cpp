@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "future/future.h"
+#include "future/futureWait.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "testCheck.h"
+
+namespace FutureTests {
+
+TEST_CLASS_EX (FutureAllocatorTest, LibletAwareMemLeakDetection) {
+  TEST_METHOD(FutureAllocator_LargeContinuation) {
+    // The captured array makes the future too large to be pooled
+    std::array<int, 128> values{};
+    values.back() = 5;
+
+    Mso::Promise<int> p1;
+    auto f1 = p1.AsFuture().Then([values](int value) noexcept { return value + values.back(); });
+    p1.SetValue(3);
+    TestCheckEqual(8, Mso::FutureWaitAndGetValue(f1));
+  }
+
+  TEST_METHOD(FutureAllocator_ReleaseOnOtherThread) {
+    // The futures are created on one thread and released on another one, which caches their memory
+    constexpr int futureCount = 10000;
+    std::vector<Mso::Future<int>> futures;
+    futures.reserve(futureCount);
+    for (int i = 0; i < futureCount; ++i) {
+      Mso::Promise<int> p1;
+      futures.push_back(p1.AsFuture().Then([](int value) noexcept { return value * 2; }));
+      p1.SetValue(i);
+    }
+
+    std::thread releasingThread{[&futures]() {
+      for (int i = 0; i < futureCount; ++i) {
+        TestCheckEqual(i * 2, Mso::FutureWaitAndGetValue(futures[i]));
+        futures[i] = nullptr;
+      }
+    }};
+    releasingThread.join();
+
+    Mso::Promise<int> p2;
+    auto f2 = p2.AsFuture().Then([](int value) noexcept { return value + 1; });
+    p2.SetValue(1);
+    TestCheckEqual(2, Mso::FutureWaitAndGetValue(f2));
+  }
+
+  // Measures the promise and continuation pairs that the ReactHost lifecycle code creates
+  TEST_METHOD(FutureAllocator_ContinuationBenchmark) {
+    constexpr int iterationCount = 200000;
+    int64_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterationCount; ++i) {
+      Mso::Promise<int> p1;
+      auto f1 = p1.AsFuture().Then([i](int value) noexcept { return value + i; }).Then([](int value) noexcept {
+        return static_cast<int64_t>(value);
+      });
+      p1.SetValue(1);
+      sum += Mso::FutureWaitAndGetValue(f1);
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    TestCheck(sum == static_cast<int64_t>(iterationCount) * (iterationCount + 1) / 2);
+    std::printf(
+        "Created %d promises with two continuations each in %lld ms\n",
+        iterationCount,
+        static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()));
+  }
+};
+
+} // namespace FutureTests
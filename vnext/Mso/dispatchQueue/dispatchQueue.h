@@ -5,6 +5,7 @@
 #ifndef MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 #define MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 
+#include <memory>
 #include <optional>
 #include <thread>
 #include "functional/functor.h"
@@ -22,6 +23,7 @@ using DispatchTask = VoidFunctor;
 // Forward declarations
 struct DispatchLocalValueGuard;
 struct DispatchQueue;
+struct DispatchQueueMetrics;
 struct DispatchQueueSettings;
 struct DispatchSuspendGuard;
 struct DispatchTaskBatch;
@@ -48,6 +50,20 @@ enum class PendingTaskAction {
   Cancel,
 };
 
+//! Priority lane of a posted task.
+//! A queue invokes tasks of a higher priority before the tasks of a lower priority, and tasks of the same priority in
+//! the order they are posted. Tasks of a lower priority wait for as long as there are tasks of a higher priority.
+enum class DispatchTaskPriority : int32_t {
+  //! Work that must run before anything else.
+  Immediate,
+  //! Work that the user is waiting for, like a response to input.
+  UserBlocking,
+  //! Default priority of posted tasks.
+  Normal,
+  //! Work that can wait until the queue has nothing else to do.
+  Background,
+};
+
 //! Callback type to handle queue local values
 using SwapDispatchLocalValueCallback = void (*)(void **localValue, void **tlsValue) noexcept;
 
@@ -91,6 +107,13 @@ struct DispatchQueueSettings {
   Mso::Functor<void(DispatchQueue const &)> TaskCompleted;
   Mso::Functor<void(DispatchQueue const &)> IdleWaitStarting;
   Mso::Functor<void(DispatchQueue const &)> IdleWaitCompleted;
+
+  //! Post tasks without taking the queue lock, which avoids contention when many threads post to the queue at once.
+  //! Each posted task then needs its own allocation.
+  bool UseLockFreeTaskQueue{false};
+
+  //! Record the wait and run times of posted tasks and the queue depth. See dispatchQueueMetrics.h.
+  std::shared_ptr<DispatchQueueMetrics> Metrics;
 };
 
 //! Serial or concurrent dispatch queue main API.
@@ -139,6 +162,13 @@ struct DispatchQueue {
   //! running tasks.
   static DispatchQueue MakeConcurrentQueue(uint32_t maxThreads) noexcept;
 
+  //! Create a concurrent queue that runs its tasks on its own workerCount threads, which is suited for CPU bound work.
+  //! Each thread has its own deque of tasks, and takes tasks from the other deques when its own deque is empty. Tasks
+  //! posted from a task of the queue run on the same thread, unless other threads run out of tasks.
+  //! If workerCount is zero, then it uses one thread per core.
+  //! Tasks already taken by the threads are completed on shutdown.
+  static DispatchQueue MakeWorkStealingQueue(uint32_t workerCount = 0) noexcept;
+
   //! Create a dispatch queue on top of custom IDispatchQueueScheduler.
   //! The IDispatchQueueScheduler defines how the dispatch queue items are handled.
   static DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept;
@@ -149,6 +179,10 @@ struct DispatchQueue {
   //! Post the task to the end of the queue for asynchronous invocation.
   void Post(DispatchTask &&task) const noexcept;
 
+  //! Post the task to the end of the priority lane of the queue for asynchronous invocation.
+  //! Tasks of a priority other than Normal are not added to the task batch of the current thread.
+  void Post(DispatchTask &&task, DispatchTaskPriority priority) const noexcept;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   void InvokeElsePost(DispatchTask &&task) const noexcept;
@@ -332,6 +366,9 @@ struct IDispatchQueueService : IUnknown {
   //! Add task to the end of asynchronous queue for invocation.
   virtual void Post(DispatchTask &&task) noexcept = 0;
 
+  //! Add task to the end of the priority lane of asynchronous queue for invocation.
+  virtual void Post(DispatchTask &&task, DispatchTaskPriority priority) noexcept = 0;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   virtual void InvokeElsePost(DispatchTask &&task) noexcept = 0;
@@ -439,6 +476,9 @@ struct IDispatchQueueStatic : IUnknown {
   //! running tasks.
   virtual DispatchQueue MakeConcurrentQueue(uint32_t maxThreads) noexcept = 0;
 
+  //! Create a concurrent queue on top of its own work stealing threads.
+  virtual DispatchQueue MakeWorkStealingQueue(uint32_t workerCount) noexcept = 0;
+
   //! Create a dispatch queue on top of custom IDispatchQueueScheduler.
   //! The IDispatchQueueScheduler defines how the dispatch queue items are handled.
   virtual DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept = 0;
@@ -565,6 +605,10 @@ inline /*static*/ DispatchQueue DispatchQueue::MakeConcurrentQueue(uint32_t maxT
   return IDispatchQueueStatic::Instance()->MakeConcurrentQueue(maxThreads);
 }
 
+inline /*static*/ DispatchQueue DispatchQueue::MakeWorkStealingQueue(uint32_t workerCount) noexcept {
+  return IDispatchQueueStatic::Instance()->MakeWorkStealingQueue(workerCount);
+}
+
 inline /*static*/ DispatchQueue DispatchQueue::MakeCustomQueue(
     Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept {
   return IDispatchQueueStatic::Instance()->MakeCustomQueue(std::move(scheduler));
@@ -578,6 +622,10 @@ inline void DispatchQueue::Post(DispatchTask &&task) const noexcept {
   m_state->Post(std::move(task));
 }
 
+inline void DispatchQueue::Post(DispatchTask &&task, DispatchTaskPriority priority) const noexcept {
+  m_state->Post(std::move(task), priority);
+}
+
 inline void DispatchQueue::InvokeElsePost(DispatchTask &&task) const noexcept {
   m_state->InvokeElsePost(std::move(task));
 }
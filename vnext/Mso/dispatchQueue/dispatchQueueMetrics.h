@@ -0,0 +1,165 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#ifndef MSO_DISPATCHQUEUE_DISPATCHQUEUEMETRICS_H
+#define MSO_DISPATCHQUEUE_DISPATCHQUEUEMETRICS_H
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+
+namespace Mso {
+
+//! Opt-in queueing metrics of a dispatch queue.
+//! They tell a long running task apart from a backlog of tasks: the wait time of a task is the time from posting it to
+//! starting it, the run time is the time it takes to run, and the queue depth is the number of tasks waiting to run.
+//! Tasks are grouped by the name they set with SetCurrentTaskName while they run.
+//! Tasks are also attributed to an origin, like the module method, timer, event or mount transaction that they run
+//! for, which the task completed handler gets to report long tasks with. A task gets the origin of the thread that
+//! posted it, which is set with an OriginScope or with SetCurrentTaskOrigin, so the tasks posted by a task share its
+//! origin.
+//! Queues record their tasks with MakeMeasuredDispatchTask or with a TaskScope. All methods are thread safe.
+struct DispatchQueueMetrics final {
+  using Clock = std::chrono::steady_clock;
+
+  //! Upper bounds of the histogram buckets. The last bucket holds the times above the last bound.
+  static constexpr std::array<std::chrono::microseconds, 7> HistogramBounds{
+      std::chrono::microseconds{100},
+      std::chrono::milliseconds{1},
+      std::chrono::milliseconds{4},
+      std::chrono::milliseconds{16},
+      std::chrono::milliseconds{50},
+      std::chrono::milliseconds{100},
+      std::chrono::milliseconds{500}};
+  static constexpr size_t HistogramBucketCount{HistogramBounds.size() + 1};
+  using Histogram = std::array<uint64_t, HistogramBucketCount>;
+
+  static constexpr size_t TopTaskCount{10};
+
+  //! Number of task names that the top tasks are taken from. Other names are counted as OtherTaskName.
+  static constexpr size_t MaxTaskNameCount{256};
+  static constexpr std::string_view UnnamedTaskName{"(unnamed)"};
+  static constexpr std::string_view OtherTaskName{"(other)"};
+
+  struct TaskTime {
+    std::string Name;
+    uint64_t Count{0};
+    Clock::duration TotalRunTime{};
+    Clock::duration MaxRunTime{};
+  };
+
+  struct Snapshot {
+    std::string QueueName;
+    uint64_t TaskCount{0};
+    size_t QueueDepth{0};
+    size_t MaxQueueDepth{0};
+    Clock::duration TotalWaitTime{};
+    Clock::duration MaxWaitTime{};
+    Clock::duration TotalRunTime{};
+    Clock::duration MaxRunTime{};
+    Histogram WaitTimeHistogram{};
+    Histogram RunTimeHistogram{};
+    std::vector<TaskTime> TopTasks; // By total run time, the longest first
+  };
+
+  //! A task that completed, as it is reported to the task completed handler.
+  struct TaskRecord {
+    std::string_view QueueName;
+    std::string_view TaskName;
+    std::string_view Origin; // Empty when it is unknown
+    Clock::duration WaitTime{};
+    Clock::duration RunTime{};
+    size_t QueueDepth{0};
+  };
+
+  //! Records the run of a task from its construction to its destruction.
+  struct TaskScope {
+    //! The origin is the CurrentOrigin of the thread that posted the task.
+    TaskScope(DispatchQueueMetrics *metrics, Clock::time_point postTime, std::string origin = {}) noexcept;
+    ~TaskScope() noexcept;
+
+    TaskScope(TaskScope const &other) = delete;
+    TaskScope &operator=(TaskScope const &other) = delete;
+
+   private:
+    DispatchQueueMetrics *m_metrics;
+    Clock::time_point m_postTime;
+    Clock::time_point m_startTime;
+    const char *m_enclosingTaskName;
+    std::string m_enclosingOrigin;
+  };
+
+  //! Sets the origin of the current thread while it lives, so that the tasks posted meanwhile are attributed to it.
+  struct OriginScope {
+    OriginScope(std::string origin) noexcept;
+    ~OriginScope() noexcept;
+
+    OriginScope(OriginScope const &other) = delete;
+    OriginScope &operator=(OriginScope const &other) = delete;
+
+   private:
+    std::string m_enclosingOrigin;
+  };
+
+  //! The taskCompleted handler is called on the thread of each task after the task runs.
+  DispatchQueueMetrics(
+      std::string queueName,
+      Mso::Functor<void(TaskRecord const &)> &&taskCompleted = nullptr) noexcept;
+
+  DispatchQueueMetrics(DispatchQueueMetrics const &other) = delete;
+  DispatchQueueMetrics &operator=(DispatchQueueMetrics const &other) = delete;
+
+  std::string const &QueueName() const noexcept;
+
+  //! Called by the queue for each posted task, and for each posted task that is canceled instead of run.
+  void TaskPosted() noexcept;
+  void TaskCanceled() noexcept;
+
+  Snapshot GetSnapshot() const noexcept;
+
+  //! Clears the recorded tasks. The queue depth is kept.
+  void Reset() noexcept;
+
+  //! Sets the name that the task running on the current thread is recorded with.
+  //! The name must outlive the task, which is the case for string literals.
+  static void SetCurrentTaskName(const char *name) noexcept;
+
+  //! Sets the origin that the task running on the current thread is reported with, and that the tasks it posts get.
+  static void SetCurrentTaskOrigin(std::string origin) noexcept;
+
+  //! The origin of the current thread, which the queues keep with the tasks posted from it.
+  static std::string const &CurrentOrigin() noexcept;
+
+ private:
+  void TaskCompleted(
+      const char *taskName,
+      std::string_view origin,
+      Clock::duration waitTime,
+      Clock::duration runTime) noexcept;
+  static size_t HistogramBucket(Clock::duration time) noexcept;
+
+ private:
+  const std::string m_queueName;
+  const Mso::Functor<void(TaskRecord const &)> m_taskCompleted;
+  mutable std::mutex m_mutex;
+  Snapshot m_totals; // Without the top tasks, which are kept in m_taskTimes
+  // Keys are views of the task names, which outlive the tasks
+  std::unordered_map<std::string_view, TaskTime> m_taskTimes;
+  static thread_local const char *tls_taskName;
+  static thread_local std::string tls_origin;
+};
+
+//! Makes a task of the queue with the metrics from the posted task, and records that it is posted.
+//! The cancellation of the posted task is forwarded to it.
+DispatchTask MakeMeasuredDispatchTask(std::shared_ptr<DispatchQueueMetrics> metrics, DispatchTask &&task) noexcept;
+
+} // namespace Mso
+
+#endif // MSO_DISPATCHQUEUE_DISPATCHQUEUEMETRICS_H
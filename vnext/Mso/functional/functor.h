@@ -9,8 +9,9 @@
   Mso::Functor is a replacement for std::function that uses intrusive reference
   counting and is always non-throwing (even if it is wrapping a throwing function
   object). Mso::Functor has the following semantics:
-  - Always performs a heap allocation when creating a new instance from a function object, unless the function object is
-  stateless.
+  - Always allocates a wrapper when creating a new instance from a function object, unless the function object is
+  stateless. The small wrappers come from Mso::Memory::SmallBlockAllocator, which mostly reuses the memory of the
+  wrappers released before, so that posting a lambda with a few captures to a dispatch queue does not go to the heap.
   - Are small (size of a CntPtr).
   - Cheap to copy and move.
   - There will only be one outstanding copy of the function object given to the Mso::Functor.
@@ -23,6 +24,7 @@
   - If you need to keep the functor for longer, use Mso::SmallFunctor.
 */
 
+#include <memoryApi/smallBlockAllocator.h>
 #include <object/unknownObject.h>
 #include <functional>
 #include <type_traits>
@@ -150,10 +152,47 @@ struct ConstexprFunctorBase : public TIFunctor {
   }
 };
 
+//! Base class for function object wrappers. Same as Mso::UnknownObject<Mso::RefCountStrategy::SimpleNoQuery>,
+//! except that the memory is allocated with Mso::Memory::SmallBlockAllocator.
+template <typename TIFunctor>
+class DECLSPEC_NOVTABLE SmallBlockFunctorBase : public TIFunctor {
+ public:
+  using RefCountPolicy = Mso::SimpleRefCountPolicy<Mso::DefaultRefCountedDeleter, Mso::Memory::SmallBlockAllocator>;
+  friend RefCountPolicy;
+
+  using TypeToDelete = SmallBlockFunctorBase;
+
+  MSO_OBJECT_SIMPLEREFCOUNT(SmallBlockFunctorBase);
+
+  _Success_(return == S_OK)
+      STDMETHOD(QueryInterface)(const GUID & /*riid*/, _Outptr_ void ** /*ppvObject*/) noexcept override {
+    return E_FAIL;
+  }
+
+  STDMETHOD_(ULONG, AddRef)() noexcept override {
+    ++m_refCount;
+    return 1;
+  }
+
+  STDMETHOD_(ULONG, Release)() noexcept override {
+    if (--m_refCount == 0) {
+      RefCountPolicy::Delete(this);
+    }
+
+    return 1;
+  }
+
+ protected:
+  SmallBlockFunctorBase() noexcept = default;
+  virtual ~SmallBlockFunctorBase() noexcept = default;
+
+ private:
+  mutable std::atomic<uint32_t> m_refCount{1};
+};
+
 //! Function object wrapper. It can be a lambda or a class implementing call operator().
 template <typename TFunc, typename TResult, typename... TArgs>
-class FunctionObjectWrapper final
-    : public Mso::UnknownObject<Mso::RefCountStrategy::SimpleNoQuery, Mso::IFunctor<TResult, TArgs...>> {
+class FunctionObjectWrapper final : public SmallBlockFunctorBase<Mso::IFunctor<TResult, TArgs...>> {
  public:
   FunctionObjectWrapper() = delete;
   MSO_NO_COPY_CTOR_AND_ASSIGNMENT(FunctionObjectWrapper);
@@ -171,8 +210,7 @@ class FunctionObjectWrapper final
 
 //! Throwing function object wrapper. It can be a lambda or a class implementing call operator().
 template <typename TFunc, typename TResult, typename... TArgs>
-class FunctionObjectWrapperThrow final
-    : public Mso::UnknownObject<Mso::RefCountStrategy::SimpleNoQuery, Mso::IFunctorThrow<TResult, TArgs...>> {
+class FunctionObjectWrapperThrow final : public SmallBlockFunctorBase<Mso::IFunctorThrow<TResult, TArgs...>> {
  public:
   FunctionObjectWrapperThrow() = delete;
   MSO_NO_COPY_CTOR_AND_ASSIGNMENT(FunctionObjectWrapperThrow);
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+#ifndef MSO_MEMORYAPI_SMALLBLOCKALLOCATOR_H
+#define MSO_MEMORYAPI_SMALLBLOCKALLOCATOR_H
+
+#include <cstddef>
+
+namespace Mso {
+namespace Memory {
+
+/**
+Allocates the small short lived blocks that are created and freed at a high rate, such as the futures and the function
+objects of the tasks posted to dispatch queues.
+
+The blocks of up to MaxPooledSize bytes are rounded up to a multiple of PooledSizeGranularity, and kept in a cache of
+the thread that frees them, so that they are mostly reused instead of going to the heap. A thread that frees more
+blocks than it allocates, such as a queue thread running the tasks posted by other threads, moves them in batches of
+BatchSize blocks to a shared depot, where the allocating threads pick them up. Each thread caches at most
+MaxCachedBlockCount blocks of each size, and frees them when it exits.
+*/
+struct SmallBlockAllocator {
+  static constexpr size_t PooledSizeGranularity = 32;
+  static constexpr size_t MaxPooledSize = 256;
+  static constexpr size_t BatchSize = 16;
+  static constexpr size_t MaxCachedBlockCount = 2 * BatchSize;
+  static constexpr size_t MaxDepotBatchCount = 64;
+
+  //! Never returns nullptr. The memory is aligned by 8 bytes.
+  static void *Allocate(size_t size) noexcept;
+
+  //! Can be called on any thread.
+  static void Deallocate(void *ptr) noexcept;
+};
+
+} // namespace Memory
+} // namespace Mso
+
+#endif // MSO_MEMORYAPI_SMALLBLOCKALLOCATOR_H
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "dispatchQueue/dispatchQueueMetrics.h"
+#include <algorithm>
+#include <utility>
+
+namespace Mso {
+
+//=============================================================================
+// DispatchQueueMetrics implementation.
+//=============================================================================
+
+/*static*/ thread_local const char *DispatchQueueMetrics::tls_taskName{nullptr};
+/*static*/ thread_local std::string DispatchQueueMetrics::tls_origin;
+
+DispatchQueueMetrics::DispatchQueueMetrics(
+    std::string queueName,
+    Mso::Functor<void(TaskRecord const &)> &&taskCompleted) noexcept
+    : m_queueName{std::move(queueName)}, m_taskCompleted{std::move(taskCompleted)} {
+  m_totals.QueueName = m_queueName;
+}
+
+std::string const &DispatchQueueMetrics::QueueName() const noexcept {
+  return m_queueName;
+}
+
+void DispatchQueueMetrics::TaskPosted() noexcept {
+  std::lock_guard lock{m_mutex};
+  m_totals.MaxQueueDepth = std::max(m_totals.MaxQueueDepth, ++m_totals.QueueDepth);
+}
+
+void DispatchQueueMetrics::TaskCanceled() noexcept {
+  std::lock_guard lock{m_mutex};
+  if (m_totals.QueueDepth > 0) {
+    --m_totals.QueueDepth;
+  }
+}
+
+void DispatchQueueMetrics::TaskCompleted(
+    const char *taskName,
+    std::string_view origin,
+    Clock::duration waitTime,
+    Clock::duration runTime) noexcept {
+  TaskRecord record;
+
+  {
+    std::lock_guard lock{m_mutex};
+    if (m_totals.QueueDepth > 0) {
+      --m_totals.QueueDepth;
+    }
+
+    ++m_totals.TaskCount;
+    m_totals.TotalWaitTime += waitTime;
+    m_totals.MaxWaitTime = std::max(m_totals.MaxWaitTime, waitTime);
+    m_totals.TotalRunTime += runTime;
+    m_totals.MaxRunTime = std::max(m_totals.MaxRunTime, runTime);
+    ++m_totals.WaitTimeHistogram[HistogramBucket(waitTime)];
+    ++m_totals.RunTimeHistogram[HistogramBucket(runTime)];
+
+    std::string_view name = taskName ? std::string_view{taskName} : UnnamedTaskName;
+    auto it = m_taskTimes.find(name);
+    if (it == m_taskTimes.end()) {
+      if (m_taskTimes.size() >= MaxTaskNameCount) {
+        name = OtherTaskName;
+      }
+
+      it = m_taskTimes.try_emplace(name).first;
+      if (it->second.Name.empty()) {
+        it->second.Name = name;
+      }
+    }
+
+    TaskTime &taskTime = it->second;
+    ++taskTime.Count;
+    taskTime.TotalRunTime += runTime;
+    taskTime.MaxRunTime = std::max(taskTime.MaxRunTime, runTime);
+
+    record = {m_queueName, it->first, origin, waitTime, runTime, m_totals.QueueDepth};
+  }
+
+  if (m_taskCompleted) {
+    m_taskCompleted(record);
+  }
+}
+
+DispatchQueueMetrics::Snapshot DispatchQueueMetrics::GetSnapshot() const noexcept {
+  std::lock_guard lock{m_mutex};
+  Snapshot snapshot{m_totals};
+  snapshot.TopTasks.reserve(m_taskTimes.size());
+  for (const auto &entry : m_taskTimes) {
+    snapshot.TopTasks.push_back(entry.second);
+  }
+
+  auto topEnd = snapshot.TopTasks.begin() + std::min(TopTaskCount, snapshot.TopTasks.size());
+  std::partial_sort(
+      snapshot.TopTasks.begin(), topEnd, snapshot.TopTasks.end(), [](const TaskTime &left, const TaskTime &right) {
+        return left.TotalRunTime > right.TotalRunTime;
+      });
+  snapshot.TopTasks.erase(topEnd, snapshot.TopTasks.end());
+  return snapshot;
+}
+
+void DispatchQueueMetrics::Reset() noexcept {
+  std::lock_guard lock{m_mutex};
+  Snapshot totals;
+  totals.QueueName = m_queueName;
+  totals.QueueDepth = m_totals.QueueDepth;
+  totals.MaxQueueDepth = m_totals.QueueDepth;
+  m_totals = std::move(totals);
+  m_taskTimes.clear();
+}
+
+/*static*/ void DispatchQueueMetrics::SetCurrentTaskName(const char *name) noexcept {
+  tls_taskName = name;
+}
+
+/*static*/ void DispatchQueueMetrics::SetCurrentTaskOrigin(std::string origin) noexcept {
+  tls_origin = std::move(origin);
+}
+
+/*static*/ std::string const &DispatchQueueMetrics::CurrentOrigin() noexcept {
+  return tls_origin;
+}
+
+/*static*/ size_t DispatchQueueMetrics::HistogramBucket(Clock::duration time) noexcept {
+  return std::upper_bound(HistogramBounds.begin(), HistogramBounds.end(), time) - HistogramBounds.begin();
+}
+
+//=============================================================================
+// DispatchQueueMetrics::TaskScope implementation.
+//=============================================================================
+
+DispatchQueueMetrics::TaskScope::TaskScope(
+    DispatchQueueMetrics *metrics,
+    Clock::time_point postTime,
+    std::string origin) noexcept
+    : m_metrics{metrics},
+      m_postTime{postTime},
+      m_startTime{Clock::now()},
+      m_enclosingTaskName{std::exchange(tls_taskName, nullptr)},
+      m_enclosingOrigin{std::exchange(tls_origin, std::move(origin))} {}
+
+DispatchQueueMetrics::TaskScope::~TaskScope() noexcept {
+  auto runTime = Clock::now() - m_startTime;
+  const char *taskName = std::exchange(tls_taskName, m_enclosingTaskName);
+  std::string origin = std::exchange(tls_origin, std::move(m_enclosingOrigin));
+  m_metrics->TaskCompleted(taskName, origin, std::max(m_startTime - m_postTime, Clock::duration::zero()), runTime);
+}
+
+//=============================================================================
+// DispatchQueueMetrics::OriginScope implementation.
+//=============================================================================
+
+DispatchQueueMetrics::OriginScope::OriginScope(std::string origin) noexcept
+    : m_enclosingOrigin{std::exchange(tls_origin, std::move(origin))} {}
+
+DispatchQueueMetrics::OriginScope::~OriginScope() noexcept {
+  tls_origin = std::move(m_enclosingOrigin);
+}
+
+//=============================================================================
+// MakeMeasuredDispatchTask implementation.
+//=============================================================================
+
+DispatchTask MakeMeasuredDispatchTask(std::shared_ptr<DispatchQueueMetrics> metrics, DispatchTask &&task) noexcept {
+  metrics->TaskPosted();
+  // Both callbacks share the posted task, and only one of them is called
+  return MakeDispatchTask(
+      [metrics, task, postTime = DispatchQueueMetrics::Clock::now(), origin = DispatchQueueMetrics::CurrentOrigin()](
+          ) noexcept {
+        DispatchQueueMetrics::TaskScope scope{metrics.get(), postTime, origin};
+        task.Get()->Invoke();
+      },
+      [metrics, task]() noexcept {
+        metrics->TaskCanceled();
+        if (auto cancellation = query_cast<ICancellationListener *>(task.Get())) {
+          cancellation->OnCancel();
+        }
+      });
+}
+
+} // namespace Mso
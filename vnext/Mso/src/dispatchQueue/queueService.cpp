@@ -2,6 +2,7 @@
 // Licensed under the MIT license.
 
 #include "queueService.h"
+#include "dispatchQueue/dispatchQueueMetrics.h"
 #include "taskBatch.h"
 #include "taskContext.h"
 
@@ -11,8 +12,19 @@ namespace Mso {
 // QueueService implementation.
 //=============================================================================
 
-QueueService::QueueService(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept
-    : m_scheduler{std::move(scheduler)} {
+QueueService::QueueService(
+    Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+    bool useLockFreeTaskQueue,
+    std::shared_ptr<DispatchQueueMetrics> metrics) noexcept
+    : m_scheduler{std::move(scheduler)},
+      m_metrics{std::move(metrics)},
+      m_queues{{
+          {static_cast<IDispatchQueue *>(this)},
+          {static_cast<IDispatchQueue *>(this)},
+          // Only tasks of the default priority are posted without the lock
+          {static_cast<IDispatchQueue *>(this), useLockFreeTaskQueue},
+          {static_cast<IDispatchQueue *>(this)},
+      }} {
   m_scheduler->InitializeScheduler(this);
 }
 
@@ -21,20 +33,34 @@ QueueService::~QueueService() noexcept {
 }
 
 void QueueService::Post(DispatchTask &&task) noexcept {
+  Post(std::move(task), DispatchTaskPriority::Normal);
+}
+
+void QueueService::Post(DispatchTask &&task, DispatchTaskPriority priority) noexcept {
   VerifyElseCrashSz(task, "The task is empty");
 
+  if (m_metrics) {
+    task = MakeMeasuredDispatchTask(m_metrics, std::move(task));
+  }
+
+  if (priority == DispatchTaskPriority::Normal && TryPostLockFree(task)) {
+    return;
+  }
+
   bool isShutdown = false;
   bool shouldSchedule = false;
 
   {
     std::lock_guard lock{m_mutex};
-    auto it = m_taskBatches.find(std::this_thread::get_id());
+    // Batched tasks are posted as a single task of the default priority
+    auto it = priority == DispatchTaskPriority::Normal ? m_taskBatches.find(std::this_thread::get_id())
+                                                       : m_taskBatches.end();
     if (it != m_taskBatches.end()) {
       it->second->AddTask(std::move(task));
     } else {
       isShutdown = m_shutdownAction.has_value();
       if (!isShutdown) {
-        m_queue.Enqueue(std::move(task));
+        PriorityQueue(priority).Enqueue(std::move(task));
         shouldSchedule = (m_suspendCounter == 0);
       }
     }
@@ -47,6 +73,46 @@ void QueueService::Post(DispatchTask &&task) noexcept {
   }
 }
 
+bool QueueService::TryPostLockFree(DispatchTask &task) noexcept {
+  // Tasks posted while a thread batches tasks take the lock, which finds the batch of the current thread
+  TaskQueue &queue = PriorityQueue(DispatchTaskPriority::Normal);
+  if (!queue.IsLockFree() || m_taskBatchCount > 0) {
+    return false;
+  }
+
+  // Shutdown waits for the posts that did not see it to finish enqueuing, before it cancels the pending tasks
+  ++m_lockFreePostCount;
+  bool isShutdown = m_isShutdown;
+  bool shouldSchedule = false;
+  if (!isShutdown) {
+    queue.Enqueue(std::move(task));
+    // A Resume that misses this task posts it instead
+    shouldSchedule = (m_suspendCounter == 0);
+  }
+  --m_lockFreePostCount;
+
+  if (shouldSchedule) {
+    m_scheduler->Post();
+  } else if (isShutdown) {
+    CancelTask(std::move(task));
+  }
+
+  return true;
+}
+
+TaskQueue &QueueService::PriorityQueue(DispatchTaskPriority priority) noexcept {
+  return m_queues[static_cast<size_t>(priority)];
+}
+
+size_t QueueService::TaskCount() const noexcept {
+  size_t count{0};
+  for (const auto &queue : m_queues) {
+    count += queue.Size();
+  }
+
+  return count;
+}
+
 bool QueueService::ShouldYield(TaskYieldReason *yieldReason) noexcept {
   auto setReason = [&](TaskYieldReason reason) noexcept { return yieldReason ? *yieldReason = reason : reason, true; };
   std::lock_guard lock{m_mutex};
@@ -95,6 +161,7 @@ void QueueService::BeginTaskBatching() noexcept {
     taskBatch->SetEnclosingBatch(std::move(result.first->second));
     result.first->second = std::move(taskBatch);
   }
+  m_taskBatchCount = m_taskBatches.size();
 }
 
 DispatchTask QueueService::EndTaskBatching() noexcept {
@@ -107,6 +174,7 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
       it->second = std::move(enclosingBatch);
     } else {
       m_taskBatches.erase(it);
+      m_taskBatchCount = m_taskBatches.size();
     }
   } else {
     taskBatch = Mso::Make<TaskBatch>();
@@ -156,7 +224,7 @@ void QueueService::Resume() noexcept {
     VerifyElseCrashSz(m_suspendCounter > 0, "m_suspendCounter must not be negative");
 
     if (--m_suspendCounter == 0) {
-      postCount = m_queue.Size();
+      postCount = TaskCount();
     }
   }
 
@@ -171,8 +239,15 @@ void QueueService::Shutdown(PendingTaskAction pendingTaskAction) noexcept {
   {
     std::lock_guard lock{m_mutex};
     m_shutdownAction = pendingTaskAction;
+    m_isShutdown = true;
+    while (m_lockFreePostCount > 0) {
+      std::this_thread::yield();
+    }
+
     if (pendingTaskAction == PendingTaskAction::Cancel) {
-      m_queue.DequeueAll(/*out*/ tasksToCancel);
+      for (auto &queue : m_queues) {
+        queue.DequeueAll(/*out*/ tasksToCancel);
+      }
     }
   }
 
@@ -190,12 +265,22 @@ void QueueService::AwaitTermination() noexcept {
 
 bool QueueService::HasTasks() noexcept {
   std::lock_guard lock{m_mutex};
-  return m_suspendCounter == 0 && !m_queue.IsEmpty();
+  return m_suspendCounter == 0 && TaskCount() > 0;
 }
 
 bool QueueService::TryDequeTask(/*out*/ DispatchTask &task) noexcept {
   std::lock_guard lock{m_mutex};
-  return m_suspendCounter == 0 && m_queue.TryDequeue(/*out*/ task);
+  if (m_suspendCounter > 0) {
+    return false;
+  }
+
+  for (auto &queue : m_queues) {
+    if (queue.TryDequeue(/*out*/ task)) {
+      return true;
+    }
+  }
+
+  return false;
 }
 
 void QueueService::InvokeTask(
@@ -274,13 +359,18 @@ DispatchQueue DispatchQueueStatic::MakeSerialQueue() noexcept {
 }
 
 DispatchQueue DispatchQueueStatic::MakeLooperQueue(DispatchQueueSettings const &settings) noexcept {
-  return Mso::Make<QueueService, IDispatchQueueService>(MakeLooperScheduler(settings));
+  return Mso::Make<QueueService, IDispatchQueueService>(
+      MakeLooperScheduler(settings), settings.UseLockFreeTaskQueue, settings.Metrics);
 }
 
 DispatchQueue DispatchQueueStatic::MakeConcurrentQueue(uint32_t maxThreads) noexcept {
   return Mso::Make<QueueService, IDispatchQueueService>(MakeThreadPoolScheduler(maxThreads));
 }
 
+DispatchQueue DispatchQueueStatic::MakeWorkStealingQueue(uint32_t workerCount) noexcept {
+  return Mso::Make<QueueService, IDispatchQueueService>(MakeWorkStealingScheduler(workerCount));
+}
+
 DispatchQueue DispatchQueueStatic::MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept {
   return Mso::Make<QueueService, IDispatchQueueService>(std::move(scheduler));
 }
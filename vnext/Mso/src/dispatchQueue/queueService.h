@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <thread>
 #include "eventWaitHandle/eventWaitHandle.h"
@@ -23,7 +24,10 @@ enum class LocalValueSwapAction {
 
 // A base class for serial dispatch queues
 struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispatchQueueService, IDispatchQueue> {
-  QueueService(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept;
+  QueueService(
+      Mso::CntPtr<IDispatchQueueScheduler> &&scheduler,
+      bool useLockFreeTaskQueue = false,
+      std::shared_ptr<DispatchQueueMetrics> metrics = nullptr) noexcept;
   ~QueueService() noexcept override;
 
   QueueService(QueueService const &other) = delete;
@@ -31,6 +35,7 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
 
  public: // IDispatchQueueService
   void Post(DispatchTask &&task) noexcept override;
+  void Post(DispatchTask &&task, DispatchTaskPriority priority) noexcept override;
   bool ShouldYield(TaskYieldReason *yieldReason) noexcept override;
   bool IsCurrentQueue() noexcept override;
   bool IsSerial() noexcept override;
@@ -56,14 +61,23 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
       SwapDispatchLocalValueCallback swapLocalValue,
       void **tlsValue,
       LocalValueSwapAction action) noexcept;
+  bool TryPostLockFree(DispatchTask &task) noexcept;
+  TaskQueue &PriorityQueue(DispatchTaskPriority priority) noexcept;
+  size_t TaskCount() const noexcept;
 
  private:
   const Mso::CntPtr<IDispatchQueueScheduler> m_scheduler;
+  const std::shared_ptr<DispatchQueueMetrics> m_metrics;
   ThreadMutex m_mutex;
-  TaskQueue m_queue{static_cast<IDispatchQueue *>(this)};
+  std::array<TaskQueue, 4> m_queues; // One per DispatchTaskPriority, in the order of the priorities
   std::optional<PendingTaskAction> m_shutdownAction;
-  int32_t m_suspendCounter{0};
+  std::atomic<int32_t> m_suspendCounter{0}; // Only changed under the lock
   std::map<std::thread::id, Mso::CntPtr<TaskBatch>> m_taskBatches;
+
+  // Lock free posting state, which mirrors the state above that Post reads
+  std::atomic<bool> m_isShutdown{false};
+  std::atomic<size_t> m_taskBatchCount{0};
+  std::atomic<int32_t> m_lockFreePostCount{0}; // Posts that are enqueuing without the lock
   std::map<ptrdiff_t, QueueLocalValueEntry> m_localValues;
 };
 
@@ -83,6 +97,7 @@ struct DispatchQueueStatic : Mso::UnknownObject<Mso::RefCountStrategy::NoRefCoun
   static DispatchQueueStatic *Instance() noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeLooperScheduler(DispatchQueueSettings const &settings) noexcept;
   static Mso::CntPtr<IDispatchQueueScheduler> MakeThreadPoolScheduler(uint32_t maxThreads) noexcept;
+  static Mso::CntPtr<IDispatchQueueScheduler> MakeWorkStealingScheduler(uint32_t workerCount) noexcept;
 
  public: // IDispatchQueueStatic
   DispatchQueue CurrentQueue() noexcept override;
@@ -91,6 +106,7 @@ struct DispatchQueueStatic : Mso::UnknownObject<Mso::RefCountStrategy::NoRefCoun
   DispatchQueue MakeLooperQueue(DispatchQueueSettings const &settings) noexcept override;
   DispatchQueue GetCurrentUIThreadQueue() noexcept override;
   DispatchQueue MakeConcurrentQueue(uint32_t maxThreads) noexcept override;
+  DispatchQueue MakeWorkStealingQueue(uint32_t workerCount) noexcept override;
   DispatchQueue MakeCustomQueue(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept override;
 };
 
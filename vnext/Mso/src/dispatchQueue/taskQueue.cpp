@@ -34,17 +34,87 @@ bool TaskReadBuffer::IsEmpty() const noexcept {
   return m_index == m_buffer.size();
 }
 
+//=============================================================================
+// LockFreeTaskList implementation.
+//=============================================================================
+
+LockFreeTaskList::LockFreeTaskList(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept
+    : m_weakOwnerPtr{std::move(weakOwnerPtr)}, m_front{new Node()}, m_back{m_front} {}
+
+LockFreeTaskList::~LockFreeTaskList() noexcept {
+  VerifyElseCrashSz(IsEmpty(), "Queue must be empty before destruction.");
+  delete m_front;
+}
+
+void LockFreeTaskList::Enqueue(DispatchTask &&task) noexcept {
+  Node *node = new Node();
+  node->Task = std::move(task);
+  node->StrongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
+
+  // The size is increased first, so that the queue is not seen as empty while the node is linked.
+  // The consumer may still not see the node until it is linked to the previous one.
+  m_size.fetch_add(1, std::memory_order_acq_rel);
+  Node *previous = m_back.exchange(node, std::memory_order_acq_rel);
+  previous->Next.store(node, std::memory_order_release);
+}
+
+bool LockFreeTaskList::TryDequeue(/*out*/ DispatchTask &task) noexcept {
+  Node *front = m_front;
+  Node *next = front->Next.load(std::memory_order_acquire);
+  if (!next) {
+    return false;
+  }
+
+  // The next node becomes the front, once its task is taken out of it.
+  task = std::move(next->Task);
+  Mso::CntPtr<IUnknown> strongOwnerPtr{std::move(next->StrongOwnerPtr)};
+  m_front = next;
+  delete front;
+  m_size.fetch_sub(1, std::memory_order_acq_rel);
+  return true;
+}
+
+bool LockFreeTaskList::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
+  bool result = false;
+  DispatchTask task;
+  while (TryDequeue(/*out*/ task)) {
+    tasks.push_back(std::move(task));
+    result = true;
+  }
+
+  return result;
+}
+
+size_t LockFreeTaskList::Size() const noexcept {
+  return m_size.load(std::memory_order_acquire);
+}
+
+bool LockFreeTaskList::IsEmpty() const noexcept {
+  return Size() == 0;
+}
+
 //=============================================================================
 // TaskQueue implementation.
 //=============================================================================
 
-TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept : m_weakOwnerPtr{std::move(weakOwnerPtr)} {}
+TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr, bool isLockFree) noexcept {
+  if (isLockFree) {
+    m_lockFreeList = std::make_unique<LockFreeTaskList>(std::move(weakOwnerPtr));
+  } else {
+    m_weakOwnerPtr = std::move(weakOwnerPtr);
+  }
+}
 
 TaskQueue::~TaskQueue() noexcept {
   VerifyElseCrashSz(IsEmpty(), "Queue must be empty before destruction.");
 }
 
 void TaskQueue::Enqueue(DispatchTask &&task) noexcept {
+  if (m_lockFreeList) {
+    m_lockFreeList->Enqueue(std::move(task));
+    return;
+  }
+
   bool queueWasEmpty{IsEmpty()};
   m_writeBuffer.push_back(std::move(task));
   if (queueWasEmpty) {
@@ -53,6 +123,10 @@ void TaskQueue::Enqueue(DispatchTask &&task) noexcept {
 }
 
 bool TaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
+  if (m_lockFreeList) {
+    return m_lockFreeList->TryDequeue(/*out*/ task);
+  }
+
   if (m_readBuffer.IsEmpty() && !m_writeBuffer.empty()) {
     m_readBuffer.SwapBuffer(m_writeBuffer);
   }
@@ -66,6 +140,10 @@ bool TaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
 }
 
 bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
+  if (m_lockFreeList) {
+    return m_lockFreeList->DequeueAll(/*out*/ tasks);
+  }
+
   if (IsEmpty()) {
     return false;
   }
@@ -90,11 +168,23 @@ bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
 }
 
 size_t TaskQueue::Size() const noexcept {
+  if (m_lockFreeList) {
+    return m_lockFreeList->Size();
+  }
+
   return m_readBuffer.Size() + m_writeBuffer.size();
 }
 
 bool TaskQueue::IsEmpty() const noexcept {
+  if (m_lockFreeList) {
+    return m_lockFreeList->IsEmpty();
+  }
+
   return m_readBuffer.IsEmpty() && m_writeBuffer.empty();
 }
 
+bool TaskQueue::IsLockFree() const noexcept {
+  return m_lockFreeList != nullptr;
+}
+
 } // namespace Mso
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <vector>
 #include "dispatchQueue/dispatchQueue.h"
 #include "threadMutex.h"
@@ -28,13 +30,46 @@ struct TaskReadBuffer {
   size_t m_index{0};
 };
 
+//! Multiple producer single consumer list of tasks, which tasks are enqueued to without a lock.
+//! Each task is held by its own node, which also keeps a strong reference to the owner, so the owner stays alive while
+//! the list is not empty. Only one thread at a time may dequeue items.
+struct LockFreeTaskList {
+  LockFreeTaskList(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept;
+
+  ~LockFreeTaskList() noexcept;
+
+  // Prohibit copy and move
+  LockFreeTaskList(LockFreeTaskList const &other) = delete;
+  LockFreeTaskList &operator=(LockFreeTaskList const &other) = delete;
+
+  void Enqueue(DispatchTask &&task) noexcept;
+  bool TryDequeue(DispatchTask &task) noexcept;
+  bool DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept;
+  size_t Size() const noexcept;
+  bool IsEmpty() const noexcept;
+
+ private:
+  struct Node {
+    std::atomic<Node *> Next{nullptr};
+    DispatchTask Task;
+    Mso::CntPtr<IUnknown> StrongOwnerPtr;
+  };
+
+  Mso::WeakPtr<IUnknown> m_weakOwnerPtr;
+  Node *m_front; // A node which task is already dequeued. Only used by the consumer.
+  std::atomic<Node *> m_back; // The last enqueued node. Exchanged by producers.
+  std::atomic<size_t> m_size{0};
+};
+
 //! Simple queue that uses two buffers: one for pushing items and another for popping them.
-//! Items are always enqueued under lock.
+//! Items are always enqueued under lock, unless the queue is lock free.
 //!
 //! Internally we have two vectors: one to enqueue items (write) and another to dequeue items (read).
 //! When the read queue is empty we swap them.
+//! A lock free queue keeps the items in a LockFreeTaskList instead, which may be enqueued to from any thread without
+//! a lock, while only one thread at a time dequeues.
 struct TaskQueue {
-  TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept;
+  TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr, bool isLockFree = false) noexcept;
 
   ~TaskQueue() noexcept;
 
@@ -47,8 +82,10 @@ struct TaskQueue {
   bool DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept;
   size_t Size() const noexcept;
   bool IsEmpty() const noexcept;
+  bool IsLockFree() const noexcept;
 
  private:
+  std::unique_ptr<LockFreeTaskList> m_lockFreeList; // Instead of the buffers when the queue is lock free.
   std::vector<DispatchTask> m_writeBuffer; // To enqueue items.
   TaskReadBuffer m_readBuffer; // To dequeue items.
   Mso::WeakPtr<IUnknown> m_weakOwnerPtr;
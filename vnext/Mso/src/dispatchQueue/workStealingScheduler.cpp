@@ -0,0 +1,223 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "queueService.h"
+
+namespace Mso {
+
+//! Runs tasks of a concurrent queue on its own worker threads.
+//! Each worker has its own deque of tasks. Tasks posted from a worker go to the deque of that worker, so that the work
+//! a task posts stays on the same core. Tasks posted from other threads are spread over the workers.
+//! Each worker runs its own tasks in order and steals the oldest tasks of the other workers when it runs out.
+struct WorkStealingScheduler : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispatchQueueScheduler> {
+  WorkStealingScheduler(uint32_t workerCount) noexcept;
+  ~WorkStealingScheduler() noexcept override;
+
+  static void RunWorker(const Mso::WeakPtr<WorkStealingScheduler> &weakSelf, size_t workerIndex) noexcept;
+
+ public: // IDispatchQueueScheduler
+  void InitializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override;
+  bool HasThreadAccess() noexcept override;
+  bool IsSerial() noexcept override;
+  void Post() noexcept override;
+  void Shutdown() noexcept override;
+  void AwaitTermination() noexcept override;
+
+ private:
+  // The task keeps its queue alive, because it is not in the queue anymore.
+  struct WorkItem {
+    Mso::CntPtr<IDispatchQueueService> Queue;
+    DispatchTask Task;
+  };
+
+  struct Worker {
+    std::mutex Mutex;
+    std::deque<WorkItem> Items;
+  };
+
+  bool TryTakeWorkItem(size_t workerIndex, /*out*/ WorkItem &item) noexcept;
+  bool WaitForWork() noexcept;
+  static size_t CurrentWorkerIndex(WorkStealingScheduler *scheduler) noexcept;
+
+ private:
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+  std::vector<std::unique_ptr<Worker>> m_workers;
+  std::atomic<size_t> m_nextWorker{0}; // Round robin index for tasks posted from other threads
+  std::atomic<size_t> m_pendingCount{0};
+  std::atomic<size_t> m_sleepingCount{0};
+  std::atomic_bool m_isShutdown{false};
+  std::mutex m_mutex; // Only used by the sleeping workers and by their wake up
+  std::condition_variable m_wakeUp;
+  std::vector<std::thread> m_threads; // it must be last in the initialization list
+
+  static constexpr size_t NoWorkerIndex{static_cast<size_t>(-1)};
+  static thread_local WorkStealingScheduler *tls_scheduler;
+  static thread_local size_t tls_workerIndex;
+};
+
+//=============================================================================
+// WorkStealingScheduler implementation
+//=============================================================================
+
+/*static*/ thread_local WorkStealingScheduler *WorkStealingScheduler::tls_scheduler{nullptr};
+/*static*/ thread_local size_t WorkStealingScheduler::tls_workerIndex{WorkStealingScheduler::NoWorkerIndex};
+
+WorkStealingScheduler::WorkStealingScheduler(uint32_t workerCount) noexcept {
+  if (workerCount == 0) {
+    workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  m_workers.reserve(workerCount);
+  for (uint32_t i = 0; i < workerCount; ++i) {
+    m_workers.push_back(std::make_unique<Worker>());
+  }
+
+  m_threads.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    m_threads.emplace_back([weakSelf = Mso::WeakPtr{this}, i]() noexcept { RunWorker(weakSelf, i); });
+  }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() noexcept {
+  AwaitTermination();
+}
+
+/*static*/ void WorkStealingScheduler::RunWorker(
+    const Mso::WeakPtr<WorkStealingScheduler> &weakSelf,
+    size_t workerIndex) noexcept {
+  for (;;) {
+    if (auto self = weakSelf.GetStrongPtr()) {
+      tls_scheduler = self.Get();
+      tls_workerIndex = workerIndex;
+
+      WorkItem item;
+      while (self->TryTakeWorkItem(workerIndex, /*out*/ item)) {
+        item.Queue->InvokeTask(std::move(item.Task), std::nullopt);
+        item.Queue = nullptr;
+      }
+
+      tls_scheduler = nullptr;
+      tls_workerIndex = NoWorkerIndex;
+
+      if (self->WaitForWork()) {
+        continue;
+      }
+    }
+
+    break;
+  }
+}
+
+bool WorkStealingScheduler::TryTakeWorkItem(size_t workerIndex, /*out*/ WorkItem &item) noexcept {
+  const size_t workerCount = m_workers.size();
+  for (size_t i = 0; i < workerCount; ++i) {
+    Worker &worker = *m_workers[(workerIndex + i) % workerCount];
+    std::lock_guard lock{worker.Mutex};
+    if (!worker.Items.empty()) {
+      item = std::move(worker.Items.front());
+      worker.Items.pop_front();
+      --m_pendingCount;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Returns false when the scheduler is shut down and has no work left.
+bool WorkStealingScheduler::WaitForWork() noexcept {
+  std::unique_lock lock{m_mutex};
+  // Post reads the sleeping count after it adds to the pending count, so either it wakes us up or we see its task
+  ++m_sleepingCount;
+  m_wakeUp.wait(lock, [this]() noexcept { return m_pendingCount > 0 || m_isShutdown; });
+  --m_sleepingCount;
+  return m_pendingCount > 0 || !m_isShutdown;
+}
+
+/*static*/ size_t WorkStealingScheduler::CurrentWorkerIndex(WorkStealingScheduler *scheduler) noexcept {
+  return tls_scheduler == scheduler ? tls_workerIndex : NoWorkerIndex;
+}
+
+void WorkStealingScheduler::InitializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept {
+  m_queue = std::move(queue);
+}
+
+bool WorkStealingScheduler::HasThreadAccess() noexcept {
+  return CurrentWorkerIndex(this) != NoWorkerIndex;
+}
+
+bool WorkStealingScheduler::IsSerial() noexcept {
+  return m_workers.size() == 1;
+}
+
+void WorkStealingScheduler::Post() noexcept {
+  // The queue calls Post once per task that it schedules. The task is taken out of the queue right away, so that it
+  // can be put on the deque of the worker that posts it.
+  auto queue = m_queue.GetStrongPtr();
+  if (!queue) {
+    return;
+  }
+
+  DispatchTask task;
+  if (!queue->TryDequeTask(/*out*/ task)) {
+    return;
+  }
+
+  size_t workerIndex = CurrentWorkerIndex(this);
+  if (workerIndex == NoWorkerIndex) {
+    workerIndex = m_nextWorker++ % m_workers.size();
+  }
+
+  {
+    Worker &worker = *m_workers[workerIndex];
+    std::lock_guard lock{worker.Mutex};
+    worker.Items.push_back({std::move(queue), std::move(task)});
+  }
+
+  ++m_pendingCount;
+  if (m_sleepingCount > 0) {
+    std::lock_guard lock{m_mutex};
+    m_wakeUp.notify_one();
+  }
+}
+
+void WorkStealingScheduler::Shutdown() noexcept {
+  {
+    std::lock_guard lock{m_mutex};
+    m_isShutdown = true;
+  }
+
+  m_wakeUp.notify_all();
+}
+
+void WorkStealingScheduler::AwaitTermination() noexcept {
+  Shutdown();
+  for (auto &thread : m_threads) {
+    if (thread.joinable()) {
+      if (thread.get_id() != std::this_thread::get_id()) {
+        thread.join();
+      } else {
+        // The queue is released by a task of this worker. See LooperScheduler::AwaitTermination.
+        thread.detach();
+      }
+    }
+  }
+}
+
+//=============================================================================
+// DispatchQueueStatic::MakeWorkStealingScheduler implementation
+//=============================================================================
+
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeWorkStealingScheduler(
+    uint32_t workerCount) noexcept {
+  return Mso::Make<WorkStealingScheduler, IDispatchQueueScheduler>(workerCount);
+}
+
+} // namespace Mso
@@ -5,6 +5,7 @@
 #include <thread>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "future/future.h"
+#include "memoryApi/smallBlockAllocator.h"
 
 #define CheckFutureStateTag(condition, state, crashIfFailed, errorMessage, tag) \
   Statement(if (!(condition)) { return UnexpectedState(state, crashIfFailed, errorMessage, tag); })
@@ -94,7 +95,7 @@ MakeFuture(const FutureTraits &traits, size_t taskSize, _Out_opt_ ByteArrayView
       "taskBuffer pointer must not be null for not zero taskSize",
       0x012ca39b /* tag_blko1 */);
 
-  void *memory = Mso::Memory::FailFast::AllocateEx(memorySize, Mso::Memory::AllocFlags::ShutdownLeak);
+  void *memory = Mso::Memory::SmallBlockAllocator::Allocate(memorySize);
   VerifyElseCrashSzTag(IsAligned(memory), "memory for FutureImpl must be aligned.", 0x012ca39d /* tag_blko3 */);
 
   ::new (memory) FutureWeakRef();
@@ -1040,7 +1041,7 @@ void FutureWeakRef::ReleaseWeakRef() const noexcept {
   Debug(VerifyElseCrashSzTag(
       static_cast<int32_t>(weakRefCount) >= 0, "Weak ref count must not be negative.", 0x01605604 /* tag_byfye */));
   if (weakRefCount == 0) {
-    Mso::MakeAllocator::Deallocate(const_cast<FutureWeakRef *>(this));
+    Mso::Memory::SmallBlockAllocator::Deallocate(const_cast<FutureWeakRef *>(this));
   }
 }
 
@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "memoryApi/smallBlockAllocator.h"
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include "memoryApi/memoryApi.h"
+
+namespace Mso {
+namespace Memory {
+
+static constexpr size_t SizeClassCount =
+    SmallBlockAllocator::MaxPooledSize / SmallBlockAllocator::PooledSizeGranularity;
+static constexpr uint32_t UnpooledSizeClass = UINT32_MAX;
+
+// Precedes the memory returned by Allocate, and keeps the 8 byte alignment of the heap blocks
+struct alignas(8) BlockHeader {
+  uint32_t SizeClass;
+};
+
+static_assert(sizeof(BlockHeader) == 8, "BlockHeader must keep the memory aligned by 8 bytes");
+
+// Overlays the free blocks. The first block of each batch in the depot links to the next batch.
+struct FreeBlock {
+  FreeBlock *Next;
+  FreeBlock *NextBatch;
+};
+
+static_assert(
+    sizeof(FreeBlock) <= sizeof(BlockHeader) + SmallBlockAllocator::PooledSizeGranularity,
+    "FreeBlock must fit into the smallest block");
+
+struct FreeList {
+  FreeBlock *Head{nullptr};
+  size_t Count{0};
+};
+
+struct BlockDepot {
+  struct BatchList {
+    std::mutex Mutex;
+    FreeBlock *Head{nullptr};
+    size_t Count{0};
+  };
+
+  BatchList BatchLists[SizeClassCount];
+};
+
+struct ThreadBlockCache {
+  ~ThreadBlockCache() noexcept;
+
+  FreeList FreeLists[SizeClassCount];
+};
+
+static thread_local ThreadBlockCache tls_blockCache;
+
+// Blocks can still be freed by the thread local objects destroyed after the cache
+static thread_local bool tls_isBlockCacheDestroyed{false};
+
+// The depot is never destroyed, since blocks can be freed by the threads that exit after the static objects are gone
+static BlockDepot &GetBlockDepot() noexcept {
+  static BlockDepot *s_depot = ::new (FailFast::AllocateEx(sizeof(BlockDepot), AllocFlags::IgnoreLeak)) BlockDepot();
+  return *s_depot;
+}
+
+static size_t GetSizeClassBlockSize(uint32_t sizeClass) noexcept {
+  return sizeof(BlockHeader) + (sizeClass + 1) * SmallBlockAllocator::PooledSizeGranularity;
+}
+
+static void FreeBlocks(FreeBlock *block) noexcept {
+  while (block) {
+    FreeBlock *next = block->Next;
+    Mso::Memory::Free(block);
+    block = next;
+  }
+}
+
+// Fills the empty free list with a batch from the depot, when the depot has one
+static bool TakeBatchFromDepot(FreeList &freeList, uint32_t sizeClass) noexcept {
+  auto &batchList = GetBlockDepot().BatchLists[sizeClass];
+  FreeBlock *batch{nullptr};
+  {
+    std::scoped_lock lock{batchList.Mutex};
+    batch = batchList.Head;
+    if (!batch) {
+      return false;
+    }
+    batchList.Head = batch->NextBatch;
+    --batchList.Count;
+  }
+
+  freeList.Head = batch;
+  freeList.Count = SmallBlockAllocator::BatchSize;
+  return true;
+}
+
+// Moves a batch from the free list to the depot, or to the heap when the depot is full
+static void GiveBatchToDepot(FreeList &freeList, uint32_t sizeClass) noexcept {
+  FreeBlock *batch = freeList.Head;
+  FreeBlock *last = batch;
+  for (size_t i = 1; i < SmallBlockAllocator::BatchSize; ++i) {
+    last = last->Next;
+  }
+  freeList.Head = last->Next;
+  freeList.Count -= SmallBlockAllocator::BatchSize;
+  last->Next = nullptr;
+
+  auto &batchList = GetBlockDepot().BatchLists[sizeClass];
+  {
+    std::scoped_lock lock{batchList.Mutex};
+    if (batchList.Count < SmallBlockAllocator::MaxDepotBatchCount) {
+      batch->NextBatch = batchList.Head;
+      batchList.Head = batch;
+      ++batchList.Count;
+      return;
+    }
+  }
+
+  FreeBlocks(batch);
+}
+
+ThreadBlockCache::~ThreadBlockCache() noexcept {
+  tls_isBlockCacheDestroyed = true;
+  for (uint32_t sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass) {
+    auto &freeList = FreeLists[sizeClass];
+    while (freeList.Count >= SmallBlockAllocator::BatchSize) {
+      GiveBatchToDepot(freeList, sizeClass);
+    }
+    FreeBlocks(freeList.Head);
+    freeList = {};
+  }
+}
+
+/*static*/ void *SmallBlockAllocator::Allocate(size_t size) noexcept {
+  void *block = nullptr;
+  uint32_t sizeClass = UnpooledSizeClass;
+  if (size > 0 && size <= MaxPooledSize) {
+    sizeClass = static_cast<uint32_t>((size - 1) / PooledSizeGranularity);
+    if (!tls_isBlockCacheDestroyed) {
+      auto &freeList = tls_blockCache.FreeLists[sizeClass];
+      if (freeList.Head || TakeBatchFromDepot(freeList, sizeClass)) {
+        FreeBlock *freeBlock = freeList.Head;
+        freeList.Head = freeBlock->Next;
+        --freeList.Count;
+        block = freeBlock;
+      }
+    }
+
+    if (!block) {
+      block = FailFast::AllocateEx(GetSizeClassBlockSize(sizeClass), AllocFlags::ShutdownLeak);
+    }
+  } else {
+    block = FailFast::AllocateEx(sizeof(BlockHeader) + size, AllocFlags::ShutdownLeak);
+  }
+
+  BlockHeader *header = ::new (block) BlockHeader{sizeClass};
+  return header + 1;
+}
+
+/*static*/ void SmallBlockAllocator::Deallocate(void *ptr) noexcept {
+  if (!ptr) {
+    return;
+  }
+
+  BlockHeader *header = static_cast<BlockHeader *>(ptr) - 1;
+  const uint32_t sizeClass = header->SizeClass;
+  if (sizeClass != UnpooledSizeClass && !tls_isBlockCacheDestroyed) {
+    auto &freeList = tls_blockCache.FreeLists[sizeClass];
+    if (freeList.Count == MaxCachedBlockCount) {
+      GiveBatchToDepot(freeList, sizeClass);
+    }
+
+    freeList.Head = ::new (header) FreeBlock{freeList.Head, nullptr};
+    ++freeList.Count;
+    return;
+  }
+
+  Mso::Memory::Free(header);
+}
+
+} // namespace Memory
+} // namespace Mso
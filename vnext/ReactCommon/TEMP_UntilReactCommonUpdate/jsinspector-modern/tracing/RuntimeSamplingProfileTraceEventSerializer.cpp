@@ -10,6 +10,7 @@
 #include "ProfileTreeNode.h"
 #include "TraceEventSerializer.h"
 
+#include <tracing.h> // [Windows]
 #include <string_view>
 
 namespace facebook::react::jsinspector_modern::tracing {
@@ -219,6 +220,43 @@ void processCallStack(
   chunk.timeDeltas.push_back(samplesTimeDelta);
 }
 
+// [Windows
+// Also log the sample to ETW, so that trace viewers show the JS samples on the
+// timeline of the native events.
+void logSampleToETW(
+    const RuntimeSamplingProfile::Sample& sample,
+    RuntimeProfileId profileId) {
+  std::string_view functionName;
+  std::string_view scriptUrl;
+  int32_t lineNumber = -1;
+  int32_t columnNumber = -1;
+  if (!sample.callStack.empty()) {
+    const auto& callFrame = sample.callStack.front();
+    functionName = callFrame.kind ==
+            RuntimeSamplingProfile::SampleCallStackFrame::Kind::GarbageCollector
+        ? GARBAGE_COLLECTOR_FRAME_NAME
+        : callFrame.functionName;
+    scriptUrl = callFrame.scriptURL.value_or(std::string_view{});
+    if (callFrame.lineNumber) {
+      lineNumber = static_cast<int32_t>(*callFrame.lineNumber);
+    }
+    if (callFrame.columnNumber) {
+      columnNumber = static_cast<int32_t>(*callFrame.columnNumber);
+    }
+  }
+
+  ::facebook::react::tracing::logJSSample(
+      static_cast<uint64_t>(profileId),
+      static_cast<uint64_t>(sample.threadId),
+      static_cast<int64_t>(sample.timestamp),
+      functionName,
+      scriptUrl,
+      lineNumber,
+      columnNumber,
+      static_cast<uint32_t>(sample.callStack.size()));
+}
+// Windows]
+
 // Send buffered Trace Events and reset the buffer.
 void sendBufferedTraceEvents(
     folly::dynamic&& traceEventBuffer,
@@ -303,6 +341,9 @@ RuntimeSamplingProfileTraceEventSerializer::serializeAndDispatch(
   chunk.nodes.push_back(*idleNode);
   uint32_t idleNodeId = idleNode->getId();
 
+  const bool logSamplesToETW =
+      ::facebook::react::tracing::isReactPerfTracing(); // [Windows]
+
   for (auto& sample : samples) {
     ThreadId currentSampleThreadId = sample.threadId;
     auto currentSampleTimestamp = getHighResTimeStampForSample(sample);
@@ -328,6 +369,10 @@ RuntimeSamplingProfileTraceEventSerializer::serializeAndDispatch(
       traceEventBuffer.reserve(traceEventChunkSize);
     }
 
+    if (logSamplesToETW) { // [Windows]
+      logSampleToETW(sample, profileId); // [Windows]
+    } // [Windows]
+
     processCallStack(
         std::move(sample.callStack),
         chunk,
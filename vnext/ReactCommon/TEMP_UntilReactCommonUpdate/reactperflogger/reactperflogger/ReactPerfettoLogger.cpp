@@ -9,6 +9,9 @@
 
 #if defined(WITH_PERFETTO)
 #include "ReactPerfetto.h"
+#elif defined(_WIN32) // [Windows]
+#include <tracing.h> // [Windows]
+#include <chrono> // [Windows]
 #elif defined(WITH_FBSYSTRACE)
 #include <fbsystrace.h>
 #endif
@@ -43,6 +46,22 @@ std::string toPerfettoTrackName(
 
   return perfettoTrackName;
 }
+#elif defined(_WIN32) // [Windows
+// The ETW events carry their times in microseconds of the steady clock, the time base of the JS samples
+int64_t toSteadyClockMicros(HighResTimeStamp jsTime) {
+  auto now = HighResTimeStamp::now();
+  auto steadyNow = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+  return steadyNow + (jsTime - now).toNanoseconds() / 1000;
+}
+
+std::string_view toTrackName(
+    const std::optional<std::string_view>& trackName,
+    const std::optional<std::string_view>& trackGroup) {
+  return trackName ? *trackName : trackGroup.value_or(std::string_view{});
+}
+// Windows]
 #elif defined(WITH_FBSYSTRACE)
 int64_t getDeltaNanos(HighResTimeStamp jsTime) {
   auto now = HighResTimeStamp::now();
@@ -55,6 +74,8 @@ int64_t getDeltaNanos(HighResTimeStamp jsTime) {
 /* static */ bool ReactPerfettoLogger::isTracing() {
 #if defined(WITH_PERFETTO)
   return TRACE_EVENT_CATEGORY_ENABLED("react-native");
+#elif defined(_WIN32) // [Windows]
+  return tracing::isReactPerfTracing(); // [Windows]
 #elif defined(WITH_FBSYSTRACE)
   // return fbsystrace_is_tracing(TRACE_TAG_REACT_APPS); // [Windows #14699]
   return false; // [Windows #14699]
@@ -81,6 +102,15 @@ int64_t getDeltaNanos(HighResTimeStamp jsTime) {
     TRACE_EVENT_END(
         "react-native", track, highResTimeStampToPerfettoTraceTime(endTime));
   }
+#elif defined(_WIN32) // [Windows
+  if (tracing::isReactPerfTracing()) {
+    tracing::logReactPerfMeasure(
+        eventName,
+        toSteadyClockMicros(startTime),
+        toSteadyClockMicros(endTime),
+        toTrackName(trackName, trackGroup));
+  }
+  // Windows]
 #elif defined(WITH_FBSYSTRACE)
   /* [Windows #14699
   static int cookie = 0;
@@ -106,6 +136,14 @@ int64_t getDeltaNanos(HighResTimeStamp jsTime) {
         getPerfettoWebPerfTrackSync(toPerfettoTrackName(trackName, trackGroup)),
         highResTimeStampToPerfettoTraceTime(startTime));
   }
+#elif defined(_WIN32) // [Windows
+  if (tracing::isReactPerfTracing()) {
+    tracing::logReactPerfMark(
+        eventName,
+        toSteadyClockMicros(startTime),
+        toTrackName(trackName, trackGroup));
+  }
+  // Windows]
 #endif
 }
 
@@ -8,12 +8,23 @@
 // Windows API
 #include <winrt/base.h>
 
+// Standard Library
+#include <algorithm>
+#include <vector>
+
 using std::function;
 using std::shared_ptr;
 using std::string;
 
 namespace Microsoft::React {
 
+namespace {
+
+// A multiple of 3, so that the base64 of consecutive chunks concatenates without padding in between.
+constexpr int64_t s_chunkSize = 3 * 1024 * 1024;
+
+} // namespace
+
 #pragma region BaseFileReaderResource
 
 BaseFileReaderResource::BaseFileReaderResource(std::weak_ptr<IBlobPersistor> weakBlobPersistor) noexcept
@@ -33,17 +44,22 @@ void BaseFileReaderResource::ReadAsText(
     return resolver("Could not find Blob persistor");
   }
 
-  winrt::array_view<uint8_t const> bytes;
+  // #9982 - Handle non-UTF8 encodings
+  //         See https://docs.oracle.com/en/java/javase/11/docs/api/java.base/java/nio/charset/Charset.html
+  // The bytes are copied straight into the result, one chunk at a time.
+  string result;
   try {
-    bytes = persistor->ResolveMessage(std::move(blobId), offset, size);
+    result.resize(static_cast<size_t>((std::max)(size, int64_t{0})));
+    auto data = reinterpret_cast<uint8_t *>(result.data());
+    for (int64_t position = 0; position < size; position += s_chunkSize) {
+      auto length = static_cast<uint32_t>((std::min)(s_chunkSize, size - position));
+      persistor->CopyMessage(string{blobId}, offset + position, winrt::array_view<uint8_t>{data + position, length});
+      ReportProgress(position + length, size);
+    }
   } catch (const std::exception &e) {
     return rejecter(e.what());
   }
 
-  // #9982 - Handle non-UTF8 encodings
-  //         See https://docs.oracle.com/en/java/javase/11/docs/api/java.base/java/nio/charset/Charset.html
-  auto result = string{bytes.cbegin(), bytes.cend()};
-
   resolver(std::move(result));
 }
 
@@ -59,22 +75,45 @@ void BaseFileReaderResource::ReadAsDataUrl(
     return rejecter("Could not find Blob persistor");
   }
 
-  winrt::array_view<uint8_t const> bytes;
+  constexpr std::string_view dataPrefix{"data:"};
+  constexpr std::string_view base64Separator{";base64,"};
+
+  // Each chunk is copied into a buffer that is reused for the next one, and encoded at the end of the result, which
+  // is allocated once. The whole blob is never resolved into contiguous memory.
+  string result;
   try {
-    bytes = persistor->ResolveMessage(std::move(blobId), offset, size);
+    auto byteCount = static_cast<size_t>((std::max)(size, int64_t{0}));
+    result.reserve(
+        dataPrefix.size() + type.size() + base64Separator.size() + Utilities::Base64EncodedLength(byteCount));
+    result += dataPrefix;
+    result += type;
+    result += base64Separator;
+
+    std::vector<uint8_t> chunk((std::min)(static_cast<size_t>(s_chunkSize), byteCount));
+    for (int64_t position = 0; position < size; position += s_chunkSize) {
+      auto length = static_cast<uint32_t>((std::min)(s_chunkSize, size - position));
+      persistor->CopyMessage(string{blobId}, offset + position, winrt::array_view<uint8_t>{chunk.data(), length});
+      Utilities::AppendBase64(std::string_view(reinterpret_cast<const char *>(chunk.data()), length), result);
+      ReportProgress(position + length, size);
+    }
   } catch (const std::exception &e) {
     return rejecter(e.what());
   }
 
-  auto result = string{"data:"};
-  result += type;
-  result += ";base64,";
+  resolver(std::move(result));
+}
 
-  auto chars = reinterpret_cast<const char *>(bytes.data());
-  auto view = std::string_view(chars, bytes.size());
-  result += Utilities::EncodeBase64(view);
+void BaseFileReaderResource::SetOnProgress(function<void(int64_t loaded, int64_t total)> &&handler) noexcept
+/*override*/ {
+  m_onProgress = std::move(handler);
+}
 
-  resolver(std::move(result));
+#pragma endregion IFileReaderResource
+
+void BaseFileReaderResource::ReportProgress(int64_t loaded, int64_t total) noexcept {
+  if (m_onProgress) {
+    m_onProgress(loaded, total);
+  }
 }
 
 /*static*/ shared_ptr<IFileReaderResource> IFileReaderResource::Make(
@@ -82,8 +121,6 @@ void BaseFileReaderResource::ReadAsDataUrl(
   return std::make_shared<BaseFileReaderResource>(weakBlobPersistor);
 }
 
-#pragma endregion IFileReaderResource
-
 #pragma endregion BaseFileReaderResource
 
 } // namespace Microsoft::React
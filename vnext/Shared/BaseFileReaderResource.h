@@ -13,6 +13,9 @@ namespace Microsoft::React {
 class BaseFileReaderResource : public IFileReaderResource, public std::enable_shared_from_this<BaseFileReaderResource> {
  protected:
   std::weak_ptr<IBlobPersistor> m_weakBlobPersistor;
+  std::function<void(int64_t loaded, int64_t total)> m_onProgress;
+
+  void ReportProgress(int64_t loaded, int64_t total) noexcept;
 
  public:
   BaseFileReaderResource(std::weak_ptr<IBlobPersistor> weakBlobPersistor) noexcept;
@@ -35,6 +38,8 @@ class BaseFileReaderResource : public IFileReaderResource, public std::enable_sh
       std::function<void(std::string &&)> &&resolver,
       std::function<void(std::string &&)> &&rejecter) noexcept override;
 
+  void SetOnProgress(std::function<void(int64_t loaded, int64_t total)> &&handler) noexcept override;
+
 #pragma endregion IFileReaderResource
 };
 
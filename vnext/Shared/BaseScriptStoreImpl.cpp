@@ -8,12 +8,18 @@
 #include "MemoryMappedBuffer.h"
 
 #include <CppRuntimeOptions.h>
+#include <tracing/tracing.h>
 
 // C++/WinRT
 #include <winrt/base.h>
 
 // Standard Library
+#include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 
 namespace facebook {
 namespace react {
@@ -100,6 +106,29 @@ struct PreparedScriptSuffix {
   char eof[length__(PERSIST_EOF)];
 };
 
+// Prepared scripts are hashed a chunk at a time, and the memory manager is asked to read the next chunk of a memory
+// mapped script while the current one is hashed, so that the hashing overlaps the reads of the file.
+constexpr size_t HASH_CHUNK_SIZE = 1024 * 1024;
+
+std::optional<std::vector<std::uint8_t>> HashPreparedScript(const std::uint8_t *data, size_t size) noexcept {
+  try {
+    Microsoft::ReactNative::SHA256Hasher hasher;
+    for (size_t offset = 0; offset < size; offset += HASH_CHUNK_SIZE) {
+      size_t chunkSize = std::min(HASH_CHUNK_SIZE, size - offset);
+      if (offset + chunkSize < size) {
+        WIN32_MEMORY_RANGE_ENTRY nextChunk{
+            const_cast<std::uint8_t *>(data + offset + chunkSize),
+            std::min(HASH_CHUNK_SIZE, size - offset - chunkSize)};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &nextChunk, 0);
+      }
+      hasher.HashData(data + offset, chunkSize);
+    }
+    return hasher.GetHashValue();
+  } catch (...) {
+    return std::nullopt;
+  }
+}
+
 } // namespace
 
 jsi::VersionedBuffer BaseScriptStoreImpl::getVersionedScript(const std::string &url) noexcept {
@@ -148,7 +177,7 @@ std::unique_ptr<const jsi::Buffer> LocalFileSimpleBufferStore::getBuffer(const s
     std::terminate();
   }
 
-  if (Microsoft::React::GetRuntimeOptionBool("JSI.MemoryMappedScriptStore")) {
+  if (memoryMapped_ || Microsoft::React::GetRuntimeOptionBool("JSI.MemoryMappedScriptStore")) {
     try {
       return Microsoft::JSI::MakeMemoryMappedBuffer(winrt::to_hstring(storeDirectory_ + bufferId).c_str());
     } catch (const facebook::jsi::JSINativeException &) {
@@ -181,14 +210,33 @@ bool LocalFileSimpleBufferStore::persistBuffer(
   if (storeDirectory_.empty())
     std::terminate();
 
+  // The buffer is written next to its file and then moved over it, so that
+  // readers never see a partially written buffer.
+  const std::filesystem::path path = std::filesystem::u8path(storeDirectory_ + relativeUrl);
+  std::filesystem::path tempPath = path;
+  tempPath += ".tmp";
+
   std::ofstream file;
-  file.open(storeDirectory_ + relativeUrl, std::ios::binary | std::ios::trunc);
+  file.open(tempPath, std::ios::binary | std::ios::trunc);
   if (!file)
     return false;
 
   file.write(reinterpret_cast<const char *>(buffer->data()), buffer->size());
   file.close();
 
+  std::error_code ec;
+  if (file.fail()) {
+    std::filesystem::remove(tempPath, ec);
+    return false;
+  }
+
+  std::filesystem::rename(tempPath, path, ec);
+  if (ec) {
+    // The previous file may still be in use, for example memory mapped by a reader.
+    std::filesystem::remove(tempPath, ec);
+    return false;
+  }
+
   return true;
 }
 
@@ -271,22 +319,27 @@ std::shared_ptr<const jsi::Buffer> BasePreparedScriptStoreImpl::tryGetPreparedSc
     return nullptr;
   }
 
-  std::optional<std::vector<std::uint8_t>> hashBuffer = Microsoft::ReactNative::GetSHA256Hash(
-      reinterpret_cast<const std::uint8_t *>(buffer->data()) + sizeof(PreparedScriptPrefix),
-      static_cast<size_t>(prefix->sizeInBytes));
-  if (!hashBuffer) {
-    // Hashing failed.
-    return nullptr;
-  }
+  PreparedScriptHash prefixHash = std::to_array(prefix->hash);
+  if (!isPreparedScriptTrusted(preparedScriptFilePath, prefixHash)) {
+    std::optional<std::vector<std::uint8_t>> hashBuffer = HashPreparedScript(
+        reinterpret_cast<const std::uint8_t *>(buffer->data()) + sizeof(PreparedScriptPrefix),
+        static_cast<size_t>(prefix->sizeInBytes));
+    if (!hashBuffer) {
+      // Hashing failed.
+      return nullptr;
+    }
 
-  if (hashBuffer.value().size() < sizeof(prefix->hash)) {
-    // Unexpected hash size.
-    return nullptr;
-  }
+    if (hashBuffer.value().size() < sizeof(prefix->hash)) {
+      // Unexpected hash size.
+      return nullptr;
+    }
 
-  if (memcmp(hashBuffer.value().data(), prefix->hash, sizeof(prefix->hash)) != 0) {
-    // Hash doesn't match. Store is possibly corrupted. It is safer to bail out.
-    return nullptr;
+    if (memcmp(hashBuffer.value().data(), prefix->hash, sizeof(prefix->hash)) != 0) {
+      // Hash doesn't match. Store is possibly corrupted. It is safer to bail out.
+      return nullptr;
+    }
+
+    trustPreparedScript(preparedScriptFilePath, prefixHash);
   }
 
   const PreparedScriptSuffix *suffix = reinterpret_cast<const PreparedScriptSuffix *>(
@@ -317,8 +370,23 @@ void BasePreparedScriptStoreImpl::persistPreparedScript(
   prefix->runtimeVersion = runtimeMetadata.version;
   prefix->sizeInBytes = preparedScript->size();
 
-  std::optional<std::vector<std::uint8_t>> hashBuffer =
-      Microsoft::ReactNative::GetSHA256Hash(preparedScript->data(), preparedScript->size());
+  // The script is hashed as it is copied, so that it is only read once
+  std::optional<std::vector<std::uint8_t>> hashBuffer;
+  try {
+    Microsoft::ReactNative::SHA256Hasher hasher;
+    for (size_t offset = 0; offset < preparedScript->size(); offset += HASH_CHUNK_SIZE) {
+      size_t chunkSize = std::min(HASH_CHUNK_SIZE, preparedScript->size() - offset);
+      hasher.HashData(preparedScript->data() + offset, chunkSize);
+      memcpy_s(
+          newBuffer->data() + sizeof(PreparedScriptPrefix) + offset,
+          newBuffer->size() - sizeof(PreparedScriptPrefix) - offset,
+          preparedScript->data() + offset,
+          chunkSize);
+    }
+    hashBuffer = hasher.GetHashValue();
+  } catch (...) {
+  }
+
   if (!hashBuffer) {
     // Hashing failed.
     std::terminate();
@@ -326,19 +394,329 @@ void BasePreparedScriptStoreImpl::persistPreparedScript(
 
   memcpy_s(prefix->hash, sizeof(prefix->hash), hashBuffer.value().data(), hashBuffer.value().size());
 
-  memcpy_s(
-      newBuffer->data() + sizeof(PreparedScriptPrefix),
-      newBuffer->size() - sizeof(PreparedScriptPrefix),
-      preparedScript->data(),
-      preparedScript->size());
-
   PreparedScriptSuffix *suffix = reinterpret_cast<PreparedScriptSuffix *>(
       newBuffer->data() + sizeof(PreparedScriptPrefix) + preparedScript->size());
   memcpy_s(suffix->eof, sizeof(suffix->eof), PERSIST_EOF, sizeof(suffix->eof));
 
   std::string preparedScriptFilePath = getPreparedScriptFileName(scriptMetadata, runtimeMetadata, prepareTag);
 
-  bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer));
+  PreparedScriptHash prefixHash = std::to_array(prefix->hash);
+  if (bufferStore_->persistBuffer(preparedScriptFilePath, std::move(newBuffer))) {
+    trustPreparedScript(preparedScriptFilePath, prefixHash);
+  }
+}
+
+namespace {
+
+constexpr const char *PREPARED_SCRIPT_CACHE_EXTENSION = ".hbc-cache";
+
+// The prepared scripts of the process that are in use, by their path. Entries expire with the last runtime that uses
+// them, and expired entries are removed when a new entry is added.
+// The last loaded script is kept alive: a reload or a reset of the session destroys the runtime before the next one
+// loads, and the next runtime then reuses the mapped and checked script instead of reading it again.
+struct SharedPreparedScripts {
+  std::mutex Mutex;
+  std::unordered_map<std::string, std::weak_ptr<const jsi::Buffer>> Scripts;
+  std::shared_ptr<const jsi::Buffer> LastLoadedScript;
+
+  static SharedPreparedScripts &Get() noexcept {
+    static SharedPreparedScripts sharedScripts;
+    return sharedScripts;
+  }
+};
+
+constexpr const char *PREPARED_SCRIPT_TRUST_EXTENSION = ".trust";
+constexpr const char PERSIST_TRUST_MAGIC[] = "RNWTRST";
+
+// Any write to a file changes its last write time, and replacing it changes its id.
+struct PreparedScriptFileIdentity {
+  std::uint64_t volumeSerialNumber;
+  std::uint8_t fileId[16];
+  std::int64_t size;
+  std::int64_t lastWriteTime;
+};
+
+struct PreparedScriptTrustRecord {
+  char magic[sizeof(PERSIST_TRUST_MAGIC)];
+  PreparedScriptFileIdentity identity;
+  std::uint8_t hash[32];
+};
+
+std::optional<PreparedScriptFileIdentity> GetPreparedScriptFileIdentity(const std::filesystem::path &path) noexcept {
+  winrt::file_handle file{CreateFile2(
+      path.c_str(),
+      FILE_READ_ATTRIBUTES,
+      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+      OPEN_EXISTING,
+      nullptr)};
+  if (!file) {
+    return std::nullopt;
+  }
+
+  FILE_ID_INFO idInfo;
+  FILE_BASIC_INFO basicInfo;
+  FILE_STANDARD_INFO standardInfo;
+  if (!GetFileInformationByHandleEx(file.get(), FileIdInfo, &idInfo, sizeof(idInfo)) ||
+      !GetFileInformationByHandleEx(file.get(), FileBasicInfo, &basicInfo, sizeof(basicInfo)) ||
+      !GetFileInformationByHandleEx(file.get(), FileStandardInfo, &standardInfo, sizeof(standardInfo))) {
+    return std::nullopt;
+  }
+
+  PreparedScriptFileIdentity identity{};
+  identity.volumeSerialNumber = idInfo.VolumeSerialNumber;
+  static_assert(sizeof(identity.fileId) == sizeof(idInfo.FileId));
+  memcpy_s(identity.fileId, sizeof(identity.fileId), &idInfo.FileId, sizeof(idInfo.FileId));
+  identity.size = standardInfo.EndOfFile.QuadPart;
+  identity.lastWriteTime = basicInfo.LastWriteTime.QuadPart;
+  return identity;
+}
+
+bool operator==(const PreparedScriptFileIdentity &left, const PreparedScriptFileIdentity &right) noexcept {
+  return memcmp(&left, &right, sizeof(PreparedScriptFileIdentity)) == 0;
+}
+
+std::optional<PreparedScriptTrustRecord> ReadPreparedScriptTrustRecord(const std::filesystem::path &path) noexcept {
+  std::ifstream file{path, std::ios::binary};
+  PreparedScriptTrustRecord record;
+  if (!file || !file.read(reinterpret_cast<char *>(&record), sizeof(record)) ||
+      memcmp(record.magic, PERSIST_TRUST_MAGIC, sizeof(record.magic)) != 0) {
+    return std::nullopt;
+  }
+  return record;
+}
+
+void WritePreparedScriptTrustRecord(
+    const std::filesystem::path &path,
+    const PreparedScriptFileIdentity &identity,
+    const std::uint8_t (&hash)[32]) noexcept {
+  PreparedScriptTrustRecord record{};
+  memcpy_s(record.magic, sizeof(record.magic), PERSIST_TRUST_MAGIC, sizeof(PERSIST_TRUST_MAGIC));
+  record.identity = identity;
+  memcpy_s(record.hash, sizeof(record.hash), hash, sizeof(hash));
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char *>(&record), sizeof(record));
+  file.close();
+  if (file.fail()) {
+    // A partial record would not match, but it is not worth keeping either.
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+  }
+}
+
+} // namespace
+
+PreparedScriptCache::PreparedScriptCache(const std::string &storeDirectory, uint64_t maxSizeInBytes)
+    : BasePreparedScriptStoreImpl(std::make_shared<LocalFileSimpleBufferStore>(storeDirectory, /*memoryMapped:*/ true)),
+      storeDirectory_(storeDirectory),
+      maxSizeInBytes_(maxSizeInBytes),
+      queue_(Mso::DispatchQueue::MakeSerialQueue()) {
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::u8path(storeDirectory_), ec);
+}
+
+PreparedScriptCache::~PreparedScriptCache() noexcept {
+  // The pending writes use this store.
+  queue_.Shutdown(Mso::PendingTaskAction::Complete);
+  queue_.AwaitTermination();
+}
+
+std::string PreparedScriptCache::getPreparedScriptFileName(
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) {
+  // The parts are separated by their terminating null characters, so that they cannot run into each other.
+  std::optional<std::vector<std::uint8_t>> hash;
+  try {
+    Microsoft::ReactNative::SHA256Hasher hasher;
+    hasher.HashData(scriptSignature.url.c_str(), scriptSignature.url.size() + 1);
+    hasher.HashData(&scriptSignature.version, sizeof(scriptSignature.version));
+    hasher.HashData(runtimeSignature.runtimeName.c_str(), runtimeSignature.runtimeName.size() + 1);
+    hasher.HashData(&runtimeSignature.version, sizeof(runtimeSignature.version));
+    if (prepareTag) {
+      hasher.HashData(prepareTag, strlen(prepareTag) + 1);
+    }
+    hash = hasher.GetHashValue();
+  } catch (...) {
+  }
+
+  if (!hash) {
+    // Without a hash, fall back to the url based name, which is still checked against the versions when it is read.
+    return BasePreparedScriptStoreImpl::getPreparedScriptFileName(scriptSignature, runtimeSignature, prepareTag);
+  }
+
+  constexpr const char *hexDigits = "0123456789abcdef";
+  std::string fileName;
+  fileName.reserve(hash->size() * 2 + strlen(PREPARED_SCRIPT_CACHE_EXTENSION));
+  for (std::uint8_t byte : *hash) {
+    fileName.push_back(hexDigits[byte >> 4]);
+    fileName.push_back(hexDigits[byte & 0xF]);
+  }
+  fileName.append(PREPARED_SCRIPT_CACHE_EXTENSION);
+  return fileName;
+}
+
+std::shared_ptr<const jsi::Buffer> PreparedScriptCache::tryGetPreparedScript(
+    const jsi::ScriptSignature &scriptSignature,
+    const jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) noexcept {
+  std::string fileName = getPreparedScriptFileName(scriptSignature, runtimeSignature, prepareTag);
+  auto preparedScript = tryGetSharedPreparedScript(fileName);
+  if (!preparedScript) {
+    preparedScript = BasePreparedScriptStoreImpl::tryGetPreparedScript(scriptSignature, runtimeSignature, prepareTag);
+    if (preparedScript) {
+      addSharedPreparedScript(fileName, preparedScript);
+    }
+  }
+  tracing::logPreparedScriptLoad(scriptSignature.url.c_str(), prepareTag ? prepareTag : "", preparedScript != nullptr);
+
+  if (preparedScript) {
+    queue_.Post([this, fileName = std::move(fileName)]() noexcept { touchEntry(fileName); });
+  }
+
+  return preparedScript;
+}
+
+std::shared_ptr<const jsi::Buffer> PreparedScriptCache::tryGetSharedPreparedScript(
+    const std::string &fileName) noexcept {
+  // Only the hashed names identify the versions of the script and runtime; the fallback names are checked on read.
+  if (!fileName.ends_with(PREPARED_SCRIPT_CACHE_EXTENSION)) {
+    return nullptr;
+  }
+
+  auto &sharedScripts = SharedPreparedScripts::Get();
+  std::scoped_lock lock{sharedScripts.Mutex};
+  auto it = sharedScripts.Scripts.find(storeDirectory_ + fileName);
+  if (it == sharedScripts.Scripts.end()) {
+    return nullptr;
+  }
+
+  auto preparedScript = it->second.lock();
+  if (preparedScript) {
+    sharedScripts.LastLoadedScript = preparedScript;
+  }
+  return preparedScript;
+}
+
+void PreparedScriptCache::addSharedPreparedScript(
+    const std::string &fileName,
+    const std::shared_ptr<const jsi::Buffer> &preparedScript) noexcept {
+  if (!fileName.ends_with(PREPARED_SCRIPT_CACHE_EXTENSION)) {
+    return;
+  }
+
+  auto &sharedScripts = SharedPreparedScripts::Get();
+  std::scoped_lock lock{sharedScripts.Mutex};
+  std::erase_if(sharedScripts.Scripts, [](const auto &entry) noexcept { return entry.second.expired(); });
+  sharedScripts.Scripts[storeDirectory_ + fileName] = preparedScript;
+  sharedScripts.LastLoadedScript = preparedScript;
+}
+
+void PreparedScriptCache::persistPreparedScript(
+    std::shared_ptr<const jsi::Buffer> preparedScript,
+    const jsi::ScriptSignature &scriptMetadata,
+    const jsi::JSRuntimeSignature &runtimeMetadata,
+    const char *prepareTag) noexcept {
+  if (!preparedScript || preparedScript->size() > maxSizeInBytes_) {
+    return;
+  }
+
+  queue_.Post([this,
+               preparedScript = std::move(preparedScript),
+               scriptMetadata,
+               runtimeMetadata,
+               prepareTag = prepareTag ? std::optional<std::string>{prepareTag} : std::nullopt]() noexcept {
+    BasePreparedScriptStoreImpl::persistPreparedScript(
+        preparedScript, scriptMetadata, runtimeMetadata, prepareTag ? prepareTag->c_str() : nullptr);
+    evictEntries();
+  });
+}
+
+bool PreparedScriptCache::isPreparedScriptTrusted(
+    const std::string &fileName,
+    const PreparedScriptHash &hash) noexcept {
+  const auto trustPath = std::filesystem::u8path(storeDirectory_ + fileName + PREPARED_SCRIPT_TRUST_EXTENSION);
+  auto record = ReadPreparedScriptTrustRecord(trustPath);
+  if (!record || memcmp(record->hash, hash.data(), hash.size()) != 0) {
+    return false;
+  }
+
+  auto identity = GetPreparedScriptFileIdentity(std::filesystem::u8path(storeDirectory_ + fileName));
+  return identity && *identity == record->identity;
+}
+
+void PreparedScriptCache::trustPreparedScript(const std::string &fileName, const PreparedScriptHash &hash) noexcept {
+  auto identity = GetPreparedScriptFileIdentity(std::filesystem::u8path(storeDirectory_ + fileName));
+  if (!identity) {
+    return;
+  }
+
+  std::uint8_t recordHash[32];
+  std::copy(hash.begin(), hash.end(), recordHash);
+  WritePreparedScriptTrustRecord(
+      std::filesystem::u8path(storeDirectory_ + fileName + PREPARED_SCRIPT_TRUST_EXTENSION), *identity, recordHash);
+}
+
+void PreparedScriptCache::touchEntry(const std::string &fileName) noexcept {
+  const auto path = std::filesystem::u8path(storeDirectory_ + fileName);
+  const auto trustPath = std::filesystem::u8path(storeDirectory_ + fileName + PREPARED_SCRIPT_TRUST_EXTENSION);
+  auto identity = GetPreparedScriptFileIdentity(path);
+  auto record = ReadPreparedScriptTrustRecord(trustPath);
+
+  // The last write time of an entry is the time it was last used.
+  std::error_code ec;
+  std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+  if (ec) {
+    return;
+  }
+
+  // Only a record that matched the entry before it was touched is moved to its new identity.
+  if (identity && record && *identity == record->identity) {
+    if (auto touchedIdentity = GetPreparedScriptFileIdentity(path)) {
+      WritePreparedScriptTrustRecord(trustPath, *touchedIdentity, record->hash);
+    }
+  }
+}
+
+void PreparedScriptCache::evictEntries() noexcept {
+  std::error_code ec;
+  std::vector<std::tuple<std::filesystem::file_time_type, uint64_t, std::filesystem::path>> entries;
+  uint64_t totalSize = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(std::filesystem::u8path(storeDirectory_), ec)) {
+    if (entry.path().extension() != PREPARED_SCRIPT_CACHE_EXTENSION || !entry.is_regular_file(ec)) {
+      continue;
+    }
+
+    uint64_t size = entry.file_size(ec);
+    if (ec) {
+      continue;
+    }
+    auto lastWriteTime = entry.last_write_time(ec);
+    if (ec) {
+      continue;
+    }
+
+    entries.emplace_back(lastWriteTime, size, entry.path());
+    totalSize += size;
+  }
+
+  if (totalSize <= maxSizeInBytes_) {
+    return;
+  }
+
+  std::sort(entries.begin(), entries.end());
+  for (const auto &[lastWriteTime, size, path] : entries) {
+    if (totalSize <= maxSizeInBytes_) {
+      break;
+    }
+    // An entry that is still memory mapped cannot be removed; it is tried again after the next write.
+    if (std::filesystem::remove(path, ec)) {
+      totalSize -= size;
+      std::filesystem::path trustPath = path;
+      trustPath += PREPARED_SCRIPT_TRUST_EXTENSION;
+      std::filesystem::remove(trustPath, ec);
+    }
+  }
 }
 
 } // namespace react
@@ -4,9 +4,11 @@
 #pragma once
 
 #include <JSI/ScriptStore.h>
+#include <dispatchQueue/dispatchQueue.h>
 #include <jsi/jsi.h>
 
 #include <algorithm>
+#include <array>
 #include <fstream>
 #include <tuple>
 #include <vector>
@@ -21,13 +23,16 @@ struct BufferStore {
 
 class LocalFileSimpleBufferStore : public BufferStore {
  public:
-  LocalFileSimpleBufferStore(const std::string &storeDirectory) : storeDirectory_(storeDirectory) {}
+  // The buffers are memory mapped when memoryMapped is true or when the JSI.MemoryMappedScriptStore option is set.
+  LocalFileSimpleBufferStore(const std::string &storeDirectory, bool memoryMapped = false)
+      : storeDirectory_(storeDirectory), memoryMapped_(memoryMapped) {}
 
   std::unique_ptr<const facebook::jsi::Buffer> getBuffer(const std::string &bufferId) noexcept override;
   bool persistBuffer(const std::string &bufferId, std::unique_ptr<const facebook::jsi::Buffer>) noexcept override;
 
  private:
   std::string storeDirectory_;
+  bool memoryMapped_;
 };
 
 struct ScriptVersionProvider {
@@ -63,15 +68,76 @@ class BasePreparedScriptStoreImpl : public facebook::jsi::PreparedScriptStore {
 
   BasePreparedScriptStoreImpl(std::shared_ptr<BufferStore> bufferStore) : bufferStore_(std::move(bufferStore)) {}
 
- private:
-  std::string getPreparedScriptFileName(
+ protected:
+  using PreparedScriptHash = std::array<std::uint8_t, 32>;
+
+  virtual std::string getPreparedScriptFileName(
       const facebook::jsi::ScriptSignature &scriptMetadata,
       const facebook::jsi::JSRuntimeSignature &runtimeMetadata,
       const char *prepareTag);
 
+  // A prepared script is hashed when it is read, and checked against the SHA-256 hash it was persisted with, unless the
+  // store trusts the file that it was read from.  A store that can tell when a file changes trusts it from the time it
+  // is written or matches its hash, until it changes.
+  virtual bool isPreparedScriptTrusted(const std::string & /*fileName*/, const PreparedScriptHash & /*hash*/) noexcept {
+    return false;
+  }
+  virtual void trustPreparedScript(const std::string & /*fileName*/, const PreparedScriptHash & /*hash*/) noexcept {}
+
+ private:
   std::shared_ptr<BufferStore> bufferStore_;
 };
 
+// Prepared script store for the bytecode cache of the JS engine, in a directory of its own.
+// Entries are named by a SHA-256 hash of the script url and version, the runtime name and version and the prepare tag,
+// so that any change to them misses the cache. Entries are written and evicted on a background queue, and the least
+// recently used entries are evicted when the directory grows beyond maxSizeInBytes. Each lookup is logged as a hit or
+// a miss.
+// Entries are memory mapped, and the caches of a process share the entries that are in use: the runtimes of all the
+// instances that load the same script run the same mapped bytecode, so each instance only adds its own heap.
+// The last loaded entry stays mapped after its runtimes are gone, so that a reload does not read and check it again.
+// Each entry has a trust record next to it, with its hash and the identity of its file: its id, size and last write
+// time. An entry that still has the identity of its record is not hashed again when it is read.
+class PreparedScriptCache : public BasePreparedScriptStoreImpl {
+ public:
+  static constexpr uint64_t DefaultMaxSizeInBytes{128 * 1024 * 1024};
+
+  // storeDirectory must end with the path delimiter. It is created when it does not exist.
+  PreparedScriptCache(const std::string &storeDirectory, uint64_t maxSizeInBytes = DefaultMaxSizeInBytes);
+  ~PreparedScriptCache() noexcept override;
+
+  std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+  void persistPreparedScript(
+      std::shared_ptr<const facebook::jsi::Buffer> preparedScript,
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+ protected:
+  std::string getPreparedScriptFileName(
+      const facebook::jsi::ScriptSignature &scriptMetadata,
+      const facebook::jsi::JSRuntimeSignature &runtimeMetadata,
+      const char *prepareTag) override;
+  bool isPreparedScriptTrusted(const std::string &fileName, const PreparedScriptHash &hash) noexcept override;
+  void trustPreparedScript(const std::string &fileName, const PreparedScriptHash &hash) noexcept override;
+
+ private:
+  std::shared_ptr<const facebook::jsi::Buffer> tryGetSharedPreparedScript(const std::string &fileName) noexcept;
+  void addSharedPreparedScript(
+      const std::string &fileName,
+      const std::shared_ptr<const facebook::jsi::Buffer> &preparedScript) noexcept;
+  void touchEntry(const std::string &fileName) noexcept;
+  void evictEntries() noexcept;
+
+  const std::string storeDirectory_;
+  const uint64_t maxSizeInBytes_;
+  Mso::DispatchQueue queue_; // Serial queue for the writes, so that they do not block the JS thread
+};
+
 // Dead simple script store implementation assuming that the script url is a
 // local filesystem path and assuming the script version is the script size, but
 // with extension point to provide custom version provider.
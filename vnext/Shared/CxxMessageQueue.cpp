@@ -5,9 +5,10 @@
 
 #include <folly/AtomicIntrusiveLinkedList.h>
 
+#include <algorithm>
 #include <mutex>
-#include <queue>
 #include <unordered_map>
+#include <vector>
 
 #include <glog/logging.h>
 
@@ -29,15 +30,11 @@ time_point now() {
 class Task {
  public:
   static Task *create(std::function<void()> &&func) {
-    return new Task{std::move(func), false, time_point()};
+    return new Task{std::move(func), false};
   }
 
   static Task *createSync(std::function<void()> &&func) {
-    return new Task{std::move(func), true, time_point()};
-  }
-
-  static Task *createDelayed(std::function<void()> &&func, time_point startTime) {
-    return new Task{std::move(func), false, startTime};
+    return new Task{std::move(func), true};
   }
 
   std::function<void()> func;
@@ -46,53 +43,120 @@ class Task {
   // the synchronous task might never resume. We use this flag to detect this
   // case and throw an error.
   bool sync;
-  time_point startTime;
 
   folly::AtomicIntrusiveLinkedListHook<Task> hook;
-
-  // Should this sort consider id also?
-  struct Compare {
-    bool operator()(const Task *a, const Task *b) {
-      return a->startTime > b->startTime;
-    }
-  };
 };
 
+// Min-heap of the delayed tasks by start time, shared by the posting threads
+// and the queue thread. Canceled tasks only lose their function; their heap
+// entries are dropped once they reach the top, or when they make up most of
+// the heap.
+// Tasks without a delay are not in the heap. They are posted like the other
+// tasks, so that they run in posting order, and only their function is kept
+// here so that they can be canceled.
 class DelayedTaskQueue {
  public:
-  ~DelayedTaskQueue() {
-    while (!queue_.empty()) {
-      delete queue_.top();
-      queue_.pop();
-    }
+  void pushImmediate(std::function<void()> &&func, uint64_t id) {
+    std::lock_guard<std::mutex> g(lock_);
+    immediateFuncs_.emplace(id, std::move(func));
   }
 
-  void process() {
-    while (!queue_.empty()) {
-      Task *d = queue_.top();
-      if (now() < d->startTime) {
-        break;
-      }
-      auto owned = std::unique_ptr<Task>(queue_.top());
-      queue_.pop();
-      owned->func();
+  // Takes out the task without a delay, unless it was canceled.
+  bool popImmediate(uint64_t id, std::function<void()> &func) {
+    std::lock_guard<std::mutex> g(lock_);
+    auto it = immediateFuncs_.find(id);
+    if (it == immediateFuncs_.end()) {
+      return false;
     }
+    func = std::move(it->second);
+    immediateFuncs_.erase(it);
+    return true;
+  }
+
+  // Returns true when the task is now the first one to start, so that the
+  // queue thread has to wake up earlier than it planned to.
+  bool push(std::function<void()> &&func, time_point startTime, uint64_t id) {
+    std::lock_guard<std::mutex> g(lock_);
+    funcs_.emplace(id, std::move(func));
+    heap_.push_back({startTime, id});
+    std::push_heap(heap_.begin(), heap_.end(), Entry::Compare{});
+    return heap_.front().id == id;
   }
 
-  void push(Task *t) {
-    queue_.push(t);
+  bool cancel(uint64_t id) {
+    std::lock_guard<std::mutex> g(lock_);
+    if (immediateFuncs_.erase(id) != 0) {
+      return true;
+    }
+    if (funcs_.erase(id) == 0) {
+      return false;
+    }
+    if (heap_.size() > 64 && heap_.size() > funcs_.size() * 2) {
+      compactLocked();
+    }
+    return true;
   }
 
-  bool empty() {
-    return queue_.empty();
+  // Takes out the first task if its start time has come.
+  bool popDue(time_point time, std::function<void()> &func) {
+    std::lock_guard<std::mutex> g(lock_);
+    dropCanceledLocked();
+    if (heap_.empty() || time < heap_.front().startTime) {
+      return false;
+    }
+    auto it = funcs_.find(heap_.front().id);
+    func = std::move(it->second);
+    funcs_.erase(it);
+    popLocked();
+    return true;
   }
 
-  time_point nextTime() {
-    return queue_.top()->startTime;
+  // Returns false when there are no delayed tasks.
+  bool nextTime(time_point &time) {
+    std::lock_guard<std::mutex> g(lock_);
+    dropCanceledLocked();
+    if (heap_.empty()) {
+      return false;
+    }
+    time = heap_.front().startTime;
+    return true;
   }
 
  private:
-  std::priority_queue<Task *, std::vector<Task *>, Task::Compare> queue_;
+  struct Entry {
+    time_point startTime;
+    uint64_t id; // Ids grow, so that tasks with the same start time run in posting order
+
+    struct Compare {
+      bool operator()(const Entry &a, const Entry &b) const {
+        return a.startTime > b.startTime || (a.startTime == b.startTime && a.id > b.id);
+      }
+    };
+  };
+
+  void popLocked() {
+    std::pop_heap(heap_.begin(), heap_.end(), Entry::Compare{});
+    heap_.pop_back();
+  }
+
+  void dropCanceledLocked() {
+    while (!heap_.empty() && funcs_.find(heap_.front().id) == funcs_.end()) {
+      popLocked();
+    }
+  }
+
+  void compactLocked() {
+    heap_.erase(
+        std::remove_if(
+            heap_.begin(), heap_.end(), [this](const Entry &e) { return funcs_.find(e.id) == funcs_.end(); }),
+        heap_.end());
+    std::make_heap(heap_.begin(), heap_.end(), Entry::Compare{});
+  }
+
+  std::mutex lock_;
+  std::vector<Entry> heap_;
+  std::unordered_map<uint64_t, std::function<void()>> funcs_;
+  std::unordered_map<uint64_t, std::function<void()>> immediateFuncs_;
 };
 
 } // namespace
@@ -107,12 +171,29 @@ class CxxMessageQueue::QueueRunner {
     enqueueTask(Task::create(std::move(func)));
   }
 
-  void enqueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
-    if (delayMs) {
-      enqueueTask(Task::createDelayed(std::move(func), now() + std::chrono::milliseconds(delayMs)));
-    } else {
-      enqueue(std::move(func));
+  uint64_t enqueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
+    uint64_t id = nextDelayedId_++;
+    if (delayMs == 0) {
+      // Runs after the tasks posted before it, like runOnQueue, but can still be canceled until it runs
+      delayed_.pushImmediate(std::move(func), id);
+      enqueue([this, id]() {
+        std::function<void()> immediateFunc;
+        if (delayed_.popImmediate(id, immediateFunc)) {
+          immediateFunc();
+        }
+      });
+      return id;
+    }
+
+    // Only an earlier deadline wakes up the queue thread; it already waits for the later ones.
+    if (delayed_.push(std::move(func), now() + std::chrono::milliseconds(delayMs), id)) {
+      pending_.set();
     }
+    return id;
+  }
+
+  bool cancelDelayed(uint64_t id) {
+    return delayed_.cancel(id);
   }
 
   void enqueueSync(std::function<void()> &&func) {
@@ -152,10 +233,11 @@ class CxxMessageQueue::QueueRunner {
     // matter reading stopped_.
     while (!stopped_.load(std::memory_order_relaxed)) {
       sweep();
-      if (delayed_.empty()) {
-        pending_.wait();
+      time_point nextTime;
+      if (delayed_.nextTime(nextTime)) {
+        pending_.wait_until(nextTime);
       } else {
-        pending_.wait_until(delayed_.nextTime());
+        pending_.wait();
       }
     }
     // This sweep is just to catch erroneous enqueueSync. That is, there could
@@ -166,9 +248,7 @@ class CxxMessageQueue::QueueRunner {
   }
 
   // We are processing two queues, the posted tasks (queue_) and the delayed
-  // tasks (delayed_). Delayed tasks first go into posted tasks, and then are
-  // moved to the delayed queue if we pop them before the time they are
-  // scheduled for.
+  // tasks (delayed_), which are posted straight to their heap.
   // As we pop things from queue_, before dealing with that thing, we run any
   // delayed tasks whose scheduled time has arrived.
   void sweep() {
@@ -181,14 +261,17 @@ class CxxMessageQueue::QueueRunner {
         return;
       }
 
-      delayed_.process();
-      if (t->startTime != time_point() && now() <= t->startTime) {
-        delayed_.push(owned.release());
-      } else {
-        t->func();
-      }
+      processDelayed();
+      t->func();
     });
-    delayed_.process();
+    processDelayed();
+  }
+
+  void processDelayed() {
+    std::function<void()> func;
+    while (delayed_.popDue(now(), func)) {
+      func();
+    }
   }
 
   void bindToThisThread() {
@@ -214,6 +297,7 @@ class CxxMessageQueue::QueueRunner {
   folly::AtomicIntrusiveLinkedList<Task, &Task::hook> queue_;
 
   std::atomic_bool stopped_{false};
+  std::atomic<uint64_t> nextDelayedId_{1};
   DelayedTaskQueue delayed_;
 
   BinarySemaphore pending_;
@@ -234,8 +318,12 @@ void CxxMessageQueue::runOnQueue(std::function<void()> &&func) {
   qr_->enqueue(std::move(func));
 }
 
-void CxxMessageQueue::runOnQueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
-  qr_->enqueueDelayed(std::move(func), delayMs);
+CxxMessageQueue::DelayedTaskId CxxMessageQueue::runOnQueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
+  return qr_->enqueueDelayed(std::move(func), delayMs);
+}
+
+bool CxxMessageQueue::cancelDelayed(DelayedTaskId id) {
+  return qr_->cancelDelayed(id);
 }
 
 void CxxMessageQueue::runOnQueueSync(std::function<void()> &&func) {
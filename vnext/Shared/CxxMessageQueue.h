@@ -55,8 +55,13 @@ class CxxMessageQueue : public MessageQueueThread {
  public:
   CxxMessageQueue();
   virtual ~CxxMessageQueue() override;
+  using DelayedTaskId = uint64_t;
+
   virtual void runOnQueue(std::function<void()> &&) override;
-  void runOnQueueDelayed(std::function<void()> &&, uint64_t delayMs);
+  // The returned id cancels the task with cancelDelayed until the task starts running.
+  DelayedTaskId runOnQueueDelayed(std::function<void()> &&, uint64_t delayMs);
+  // Returns false when the task already ran, is running, or was canceled. Can be called from any thread.
+  bool cancelDelayed(DelayedTaskId id);
   // runOnQueueSync and quitSynchronous are dangerous.  They should only be
   // used for initialization and cleanup.
   virtual void runOnQueueSync(std::function<void()> &&) override;
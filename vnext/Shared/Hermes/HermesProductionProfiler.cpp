@@ -0,0 +1,410 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HermesProductionProfiler.h"
+
+#include <folly/dynamic.h>
+#include <folly/json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+int64_t ProfileTimeUs() noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+std::exception_ptr MakeError(const char *message) noexcept {
+  return std::make_exception_ptr(std::runtime_error(message));
+}
+
+//=============================================================================
+// Sampling profile
+//=============================================================================
+
+struct ProfileFrame {
+  std::string FunctionName;
+  std::string ScriptUrl;
+  uint32_t ScriptId{0};
+  uint32_t LineNumber{0}; // Starts at 1, or 0 when it is unknown
+  uint32_t ColumnNumber{0}; // Starts at 1, or 0 when it is unknown
+
+  auto Key() const noexcept {
+    return std::tie(ScriptId, LineNumber, ColumnNumber, FunctionName, ScriptUrl);
+  }
+};
+
+struct ProfileSample {
+  uint64_t Timestamp{0};
+  std::vector<ProfileFrame> Frames; // The innermost frame first
+};
+
+struct ProfileReaderState {
+  std::vector<ProfileSample> Samples;
+};
+
+void NAPI_CDECL OnProfileInfo(void *cbData, size_t sampleCount) {
+  reinterpret_cast<ProfileReaderState *>(cbData)->Samples.reserve(sampleCount);
+}
+
+void NAPI_CDECL OnProfileSample(void *cbData, uint64_t timestamp, uint64_t /*threadId*/, size_t frameCount) {
+  auto &sample = reinterpret_cast<ProfileReaderState *>(cbData)->Samples.emplace_back();
+  sample.Timestamp = timestamp;
+  sample.Frames.reserve(frameCount);
+}
+
+void NAPI_CDECL OnProfileFrame(
+    void *cbData,
+    hermes_call_stack_frame_kind kind,
+    uint32_t scriptId,
+    const char *functionName,
+    size_t functionNameSize,
+    const char *scriptUrl,
+    size_t scriptUrlSize,
+    uint32_t lineNumber,
+    uint32_t columnNumber) {
+  auto &samples = reinterpret_cast<ProfileReaderState *>(cbData)->Samples;
+  if (samples.empty()) {
+    return;
+  }
+
+  ProfileFrame frame;
+  switch (kind) {
+    case hermes_call_stack_frame_kind_gc:
+      frame.FunctionName = "(garbage collector)";
+      break;
+    case hermes_call_stack_frame_kind_js_function:
+    case hermes_call_stack_frame_kind_native_function:
+    case hermes_call_stack_frame_kind_host_function:
+      frame.FunctionName = functionNameSize > 0 ? std::string(functionName, functionNameSize) : "(anonymous)";
+      frame.ScriptUrl = scriptUrl ? std::string(scriptUrl, scriptUrlSize) : std::string{};
+      frame.ScriptId = scriptId;
+      frame.LineNumber = lineNumber;
+      frame.ColumnNumber = columnNumber;
+      break;
+    default:
+      return; // Unknown frame kind, skip
+  }
+  samples.back().Frames.push_back(std::move(frame));
+}
+
+folly::dynamic MakeProfileNode(int64_t id, const ProfileFrame &frame) {
+  // The positions of the call frames of a .cpuprofile start at 0
+  return folly::dynamic::object("id", id)(
+      "callFrame",
+      folly::dynamic::object("functionName", frame.FunctionName)("scriptId", std::to_string(frame.ScriptId))(
+          "url", frame.ScriptUrl)("lineNumber", static_cast<int64_t>(frame.LineNumber) - 1)(
+          "columnNumber", static_cast<int64_t>(frame.ColumnNumber) - 1))("hitCount", 0)(
+      "children", folly::dynamic::array());
+}
+
+// Folds the call stacks of the samples into the node tree of a Chrome .cpuprofile
+folly::dynamic MakeCpuProfile(const std::vector<ProfileSample> &samples, int64_t startTimeUs, int64_t endTimeUs) {
+  ProfileFrame rootFrame;
+  rootFrame.FunctionName = "(root)";
+  folly::dynamic nodes = folly::dynamic::array(MakeProfileNode(1, rootFrame));
+  std::map<std::pair<int64_t, decltype(rootFrame.Key())>, int64_t> childIds;
+
+  folly::dynamic sampleIds = folly::dynamic::array();
+  folly::dynamic timeDeltas = folly::dynamic::array();
+  int64_t previousTime = startTimeUs;
+  for (const auto &sample : samples) {
+    int64_t nodeId = 1;
+    for (auto it = sample.Frames.rbegin(); it != sample.Frames.rend(); ++it) {
+      auto [child, isNew] = childIds.try_emplace({nodeId, it->Key()}, static_cast<int64_t>(nodes.size()) + 1);
+      if (isNew) {
+        nodes[static_cast<size_t>(nodeId - 1)]["children"].push_back(child->second);
+        nodes.push_back(MakeProfileNode(child->second, *it));
+      }
+      nodeId = child->second;
+    }
+
+    auto &node = nodes[static_cast<size_t>(nodeId - 1)];
+    node["hitCount"] = node["hitCount"].asInt() + 1;
+    sampleIds.push_back(nodeId);
+    timeDeltas.push_back(static_cast<int64_t>(sample.Timestamp) - previousTime);
+    previousTime = static_cast<int64_t>(sample.Timestamp);
+  }
+
+  return folly::dynamic::object("nodes", std::move(nodes))("startTime", startTimeUs)("endTime", endTimeUs)(
+      "samples", std::move(sampleIds))("timeDeltas", std::move(timeDeltas));
+}
+
+// Formats the call stack that the most samples between the times have, innermost frame first
+std::string FormatMostSampledStack(const std::vector<ProfileSample> &samples, int64_t startTimeUs, int64_t endTimeUs) {
+  constexpr size_t MaxFrameCount{32};
+  using StackKey = std::vector<decltype(std::declval<const ProfileFrame &>().Key())>;
+  std::map<StackKey, std::pair<size_t, const ProfileSample *>> stackCounts;
+  const ProfileSample *mostSampled{nullptr};
+  size_t maxCount{0};
+  for (const auto &sample : samples) {
+    auto timestamp = static_cast<int64_t>(sample.Timestamp);
+    if (timestamp < startTimeUs || timestamp > endTimeUs || sample.Frames.empty()) {
+      continue;
+    }
+
+    StackKey key;
+    key.reserve(sample.Frames.size());
+    for (const auto &frame : sample.Frames) {
+      key.push_back(frame.Key());
+    }
+    auto &stackCount = stackCounts.try_emplace(std::move(key), 0, &sample).first->second;
+    if (++stackCount.first > maxCount) {
+      maxCount = stackCount.first;
+      mostSampled = stackCount.second;
+    }
+  }
+
+  std::string stack;
+  if (!mostSampled) {
+    return stack;
+  }
+
+  for (size_t i = 0; i < std::min(mostSampled->Frames.size(), MaxFrameCount); ++i) {
+    const auto &frame = mostSampled->Frames[i];
+    if (!stack.empty()) {
+      stack += '\n';
+    }
+    stack += frame.FunctionName;
+    if (!frame.ScriptUrl.empty()) {
+      stack += " (" + frame.ScriptUrl + ':' + std::to_string(frame.LineNumber) + ':' +
+          std::to_string(frame.ColumnNumber) + ')';
+    }
+  }
+  return stack;
+}
+
+//=============================================================================
+// Heap snapshot
+//=============================================================================
+
+constexpr int32_t HeapSnapshotExecutionContextId{1};
+constexpr int64_t HeapSnapshotRequestId{1};
+constexpr std::string_view HeapSnapshotRequest{
+    R"({"id":1,"method":"HeapProfiler.takeHeapSnapshot","params":{"reportProgress":false}})"};
+
+} // namespace
+
+struct HermesProductionProfiler::HeapSnapshotSession {
+  HermesUniqueCdpDebugApi DebugApi;
+  HermesUniqueCdpAgent Agent;
+  std::ofstream File;
+  uint64_t ByteCount{0};
+  std::chrono::steady_clock::time_point StartTime{std::chrono::steady_clock::now()};
+  Callback OnDone;
+  bool IsDone{false};
+};
+
+//=============================================================================
+// HermesProductionProfiler implementation
+//=============================================================================
+
+HermesProductionProfiler::HermesProductionProfiler(
+    std::weak_ptr<HermesRuntimeHolder> runtimeHolder,
+    std::weak_ptr<facebook::react::MessageQueueThread> jsQueue) noexcept
+    : m_runtimeHolder{std::move(runtimeHolder)}, m_jsQueue{std::move(jsQueue)} {}
+
+void HermesProductionProfiler::RunOnJSQueue(
+    Callback &&callback,
+    std::function<void(hermes_runtime runtime, Callback &callback)> &&action) noexcept {
+  auto jsQueue = m_jsQueue.lock();
+  if (!jsQueue) {
+    callback(MakeError("The React instance is unloaded."));
+    return;
+  }
+
+  jsQueue->runOnQueue([weakThis = weak_from_this(), callback = std::move(callback), action = std::move(action)](
+                          ) mutable noexcept {
+    auto strongThis = weakThis.lock();
+    auto runtimeHolder = strongThis ? strongThis->m_runtimeHolder.lock() : nullptr;
+    if (!runtimeHolder) {
+      callback(MakeError("The React instance is unloaded."));
+      return;
+    }
+
+    try {
+      action(runtimeHolder->getHermesRuntime(), callback);
+      if (callback) {
+        callback(nullptr);
+      }
+    } catch (...) {
+      if (callback) {
+        callback(std::current_exception());
+      }
+    }
+  });
+}
+
+void HermesProductionProfiler::StartSamplingProfiler(Callback &&callback) noexcept {
+  RunOnJSQueue(std::move(callback), [this](hermes_runtime runtime, Callback & /*callback*/) {
+    if (m_isSampling) {
+      throw std::logic_error("The sampling profiler is already started.");
+    }
+
+    if (m_isStackSampling) {
+      // Starts the samples over
+      HermesInspectorApi::disableSamplingProfiler(runtime);
+    }
+    HermesInspectorApi::enableSamplingProfiler(runtime);
+    m_isSampling = true;
+    m_samplingActivityId = facebook::react::tracing::logJSSamplingProfileStart(ProfileTimeUs());
+  });
+}
+
+void HermesProductionProfiler::StopSamplingProfiler(std::wstring filePath, Callback &&callback) noexcept {
+  RunOnJSQueue(
+      std::move(callback), [this, filePath = std::move(filePath)](hermes_runtime runtime, Callback & /*callback*/) {
+        if (!m_isSampling) {
+          throw std::logic_error("The sampling profiler is not started.");
+        }
+
+        m_isSampling = false;
+        HermesInspectorApi::disableSamplingProfiler(runtime);
+        const int64_t endTimeUs = ProfileTimeUs();
+
+        ProfileReaderState readerState;
+        auto profile = HermesInspectorApi::collectSamplingProfile(
+            runtime, &readerState, OnProfileInfo, OnProfileSample, OnProfileFrame);
+        if (m_isStackSampling) {
+          HermesInspectorApi::enableSamplingProfiler(runtime);
+        }
+        facebook::react::tracing::logJSSamplingProfileStop(
+            m_samplingActivityId, endTimeUs, static_cast<uint64_t>(readerState.Samples.size()));
+
+        const int64_t startTimeUs = readerState.Samples.empty()
+            ? endTimeUs
+            : static_cast<int64_t>(readerState.Samples.front().Timestamp);
+        std::ofstream file{filePath, std::ios::binary | std::ios::trunc};
+        file << folly::toJson(MakeCpuProfile(readerState.Samples, startTimeUs, endTimeUs));
+        if (!file) {
+          throw std::runtime_error("Failed to write the sampling profile.");
+        }
+      });
+}
+
+void HermesProductionProfiler::CaptureHeapSnapshot(std::wstring filePath, Callback &&callback) noexcept {
+  RunOnJSQueue(
+      std::move(callback), [this, filePath = std::move(filePath)](hermes_runtime runtime, Callback &callback) {
+        if (m_heapSnapshotSession) {
+          throw std::logic_error("A heap snapshot is already being captured.");
+        }
+
+        auto session = std::make_shared<HeapSnapshotSession>();
+        session->File.open(filePath, std::ios::binary | std::ios::trunc);
+        if (!session->File) {
+          throw std::runtime_error("Failed to open the heap snapshot file.");
+        }
+
+        // The agent calls us back on the JS queue. It is released in a later task, after its last call returns.
+        auto onDone = [weakThis = weak_from_this(), weakJSQueue = m_jsQueue, weakSession = std::weak_ptr{session}](
+                          std::exception_ptr error) noexcept {
+          auto session = weakSession.lock();
+          auto jsQueue = weakJSQueue.lock();
+          if (!session || session->IsDone || !jsQueue) {
+            return;
+          }
+
+          session->IsDone = true;
+          session->File.close();
+          if (!error && session->File.fail()) {
+            error = MakeError("Failed to write the heap snapshot.");
+          }
+          facebook::react::tracing::logHeapSnapshot(
+              std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - session->StartTime).count(),
+              session->ByteCount,
+              !error);
+          jsQueue->runOnQueue([weakThis, session = std::move(session), error]() noexcept {
+            if (auto strongThis = weakThis.lock()) {
+              strongThis->m_heapSnapshotSession = nullptr;
+            }
+            session->OnDone(error);
+          });
+        };
+
+        session->DebugApi = HermesInspectorApi::createCdpDebugApi(runtime);
+        session->Agent = HermesInspectorApi::createCdpAgent(
+            session->DebugApi.get(),
+            HeapSnapshotExecutionContextId,
+            AsFunctor<hermes_enqueue_runtime_task_functor>(
+                [weakJSQueue = m_jsQueue, runtime](hermes_run_runtime_task_functor runtimeTask) {
+                  if (auto jsQueue = weakJSQueue.lock()) {
+                    jsQueue->runOnQueue(
+                        [runtime, fn = std::make_shared<FunctorWrapper<hermes_run_runtime_task_functor>>(runtimeTask)](
+                            ) { (*fn)(runtime); });
+                  }
+                }),
+            AsFunctor<hermes_enqueue_frontend_message_functor>(
+                [weakSession = std::weak_ptr{session}, onDone](const char *jsonUtf8, size_t jsonSize) {
+                  auto session = weakSession.lock();
+                  if (!session || session->IsDone) {
+                    return;
+                  }
+
+                  try {
+                    auto message = folly::parseJson(std::string_view(jsonUtf8, jsonSize));
+                    if (auto method = message.get_ptr("method")) {
+                      if (*method == "HeapProfiler.addHeapSnapshotChunk") {
+                        const auto &chunk = message["params"]["chunk"].getString();
+                        session->File.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+                        session->ByteCount += chunk.size();
+                      }
+                    } else if (auto id = message.get_ptr("id"); id && *id == HeapSnapshotRequestId) {
+                      std::exception_ptr error;
+                      if (message.get_ptr("error")) {
+                        error = MakeError("Hermes failed to take the heap snapshot.");
+                      }
+                      onDone(error);
+                    }
+                  } catch (...) {
+                    onDone(std::current_exception());
+                  }
+                }),
+            nullptr);
+
+        HermesInspectorApi::handleCommand(session->Agent.get(), HeapSnapshotRequest.data(), HeapSnapshotRequest.size());
+        // The callback is called when the snapshot is written
+        session->OnDone = std::move(callback);
+        callback = nullptr;
+        m_heapSnapshotSession = std::move(session);
+      });
+}
+
+void HermesProductionProfiler::StartStackSampling() noexcept {
+  RunOnJSQueue([](std::exception_ptr) noexcept {}, [this](hermes_runtime runtime, Callback & /*callback*/) {
+    if (!m_isStackSampling && !m_isSampling) {
+      HermesInspectorApi::enableSamplingProfiler(runtime);
+    }
+    m_isStackSampling = true;
+  });
+}
+
+std::string HermesProductionProfiler::SampleJSStack(int64_t startTimeUs, int64_t endTimeUs) noexcept {
+  auto runtimeHolder = m_runtimeHolder.lock();
+  if (!m_isStackSampling || m_isSampling || !runtimeHolder) {
+    return {};
+  }
+
+  try {
+    // The samples are collected once the profiler is disabled, and they start over when it is enabled again
+    hermes_runtime runtime = runtimeHolder->getHermesRuntime();
+    HermesInspectorApi::disableSamplingProfiler(runtime);
+    ProfileReaderState readerState;
+    auto profile = HermesInspectorApi::collectSamplingProfile(
+        runtime, &readerState, OnProfileInfo, OnProfileSample, OnProfileFrame);
+    HermesInspectorApi::enableSamplingProfiler(runtime);
+    return FormatMostSampledStack(readerState.Samples, startTimeUs, endTimeUs);
+  } catch (...) {
+    return {};
+  }
+}
+
+} // namespace Microsoft::ReactNative
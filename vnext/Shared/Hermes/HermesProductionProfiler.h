@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cxxreact/MessageQueueThread.h>
+#include <tracing/tracing.h>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include "HermesRuntimeHolder.h"
+
+namespace Microsoft::ReactNative {
+
+// Captures sampling profiles and heap snapshots of a Hermes runtime to files, so that the JS of release builds can be
+// diagnosed without a debugger. The captures run on the JS queue, and the callbacks are called there with the error
+// or with nullptr when the file is written. The profiler does not keep the runtime or its queue alive.
+class HermesProductionProfiler final : public std::enable_shared_from_this<HermesProductionProfiler> {
+ public:
+  using Callback = std::function<void(std::exception_ptr)>;
+
+  HermesProductionProfiler(
+      std::weak_ptr<HermesRuntimeHolder> runtimeHolder,
+      std::weak_ptr<facebook::react::MessageQueueThread> jsQueue) noexcept;
+
+  void StartSamplingProfiler(Callback &&callback) noexcept;
+
+  // Writes the samples taken since the start as a Chrome .cpuprofile file. The sample times are in microseconds of the
+  // steady clock, as in the JSSamplingProfile ETW activity that spans the capture.
+  void StopSamplingProfiler(std::wstring filePath, Callback &&callback) noexcept;
+
+  // Writes a Chrome .heapsnapshot file. The Hermes C API only takes heap snapshots through its CDP agent, so the
+  // snapshot is requested with HeapProfiler.takeHeapSnapshot and its chunks are written as they arrive.
+  void CaptureHeapSnapshot(std::wstring filePath, Callback &&callback) noexcept;
+
+  // Keeps the sampling profiler running while the runtime lives, so that the JS stacks of long tasks can be sampled.
+  void StartStackSampling() noexcept;
+
+  // Returns the JS stack sampled the most between the times in microseconds of the steady clock, innermost frame first
+  // and one frame per line, or an empty string when there is none. It is called on the JS queue between its tasks,
+  // after StartStackSampling. The stacks are not sampled while a sampling profile is captured, which keeps its samples.
+  std::string SampleJSStack(int64_t startTimeUs, int64_t endTimeUs) noexcept;
+
+ private:
+  struct HeapSnapshotSession;
+
+  // Runs the action on the JS queue with the Hermes runtime. The callback is called when the action returns or throws,
+  // unless the action moves it to call it later.
+  void RunOnJSQueue(
+      Callback &&callback,
+      std::function<void(hermes_runtime runtime, Callback &callback)> &&action) noexcept;
+
+ private:
+  const std::weak_ptr<HermesRuntimeHolder> m_runtimeHolder;
+  const std::weak_ptr<facebook::react::MessageQueueThread> m_jsQueue;
+  // Only used on the JS queue
+  bool m_isSampling{false};
+  bool m_isStackSampling{false};
+  facebook::react::tracing::ActivityId m_samplingActivityId{};
+  std::shared_ptr<HeapSnapshotSession> m_heapSnapshotSession;
+};
+
+} // namespace Microsoft::ReactNative
@@ -14,8 +14,11 @@
 #include <jsinspector-modern/InspectorInterfaces.h>
 #include <jsinspector-modern/tracing/InstanceTracingProfile.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <tracing/tracing.h>
+#include <chrono>
 #include <cstdio>
 #include <mutex>
+#include <vector>
 #include "Hermes/HermesRuntimeTargetDelegate.h"
 #include "SafeLoadLibrary.h"
 
@@ -35,9 +38,9 @@ void setHermesInspectorVTable(const hermes_inspector_vtable *vtable) {
   HermesInspectorApi::vtable = vtable;
 }
 
-React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<HermesRuntimeHolder>>>
+React::ReactPropertyId<React::ReactNonAbiValue<std::weak_ptr<HermesRuntimeHolder>>>
 HermesRuntimeHolderProperty() noexcept {
-  static React::ReactPropertyId<React::ReactNonAbiValue<std::shared_ptr<HermesRuntimeHolder>>> propId{
+  static React::ReactPropertyId<React::ReactNonAbiValue<std::weak_ptr<HermesRuntimeHolder>>> propId{
       L"ReactNative.HermesRuntimeHolder", L"HermesRuntimeHolder"};
   return propId;
 }
@@ -86,6 +89,13 @@ class HermesTask {
   HermesTask(const HermesTask &other) = delete;
   HermesTask &operator=(const HermesTask &other) = delete;
 
+  HermesTask(HermesTask &&other) noexcept
+      : taskData_(std::exchange(other.taskData_, nullptr)),
+        taskRunCallback_(std::exchange(other.taskRunCallback_, nullptr)),
+        taskDataDeleteCallback_(std::exchange(other.taskDataDeleteCallback_, nullptr)),
+        deleterData_(std::exchange(other.deleterData_, nullptr)) {}
+  HermesTask &operator=(HermesTask &&other) = delete;
+
   ~HermesTask() {
     if (taskDataDeleteCallback_ != nullptr) {
       taskDataDeleteCallback_(taskData_, deleterData_);
@@ -105,6 +115,9 @@ class HermesTask {
   void *deleterData_;
 };
 
+// Promise heavy code posts many tasks in a row.  Rather than a queue callback and a heap allocated task each, the
+// tasks are appended to a list that a single queue callback drains.  The storage of the list is swapped back and forth
+// between posting and draining, so that once it has grown no allocation is made per task.
 class HermesTaskRunner {
  public:
   static void Create(jsr_config config, std::shared_ptr<facebook::react::MessageQueueThread> queue) {
@@ -113,7 +126,16 @@ class HermesTaskRunner {
   }
 
  private:
-  HermesTaskRunner(std::shared_ptr<facebook::react::MessageQueueThread> queue) : queue_(std::move(queue)) {}
+  // Outlives the task runner for as long as a drain is queued
+  struct TaskList {
+    std::mutex mutex;
+    std::vector<HermesTask> pendingTasks; // Protected by mutex
+    bool isDrainQueued{false}; // Protected by mutex
+    std::vector<HermesTask> runningTasks; // Only used on the JS queue
+  };
+
+  HermesTaskRunner(std::shared_ptr<facebook::react::MessageQueueThread> queue)
+      : queue_(std::move(queue)), taskList_(std::make_shared<TaskList>()) {}
 
   static void NAPI_CDECL PostTask(
       void *taskRunnerData,
@@ -121,8 +143,28 @@ class HermesTaskRunner {
       jsr_task_run_cb taskRunCallback,
       jsr_data_delete_cb taskDataDeleteCallback,
       void *deleterData) {
-    auto task = std::make_shared<HermesTask>(taskData, taskRunCallback, taskDataDeleteCallback, deleterData);
-    reinterpret_cast<HermesTaskRunner *>(taskRunnerData)->queue_->runOnQueue([task = std::move(task)] { task->Run(); });
+    auto taskRunner = reinterpret_cast<HermesTaskRunner *>(taskRunnerData);
+    {
+      std::scoped_lock lock(taskRunner->taskList_->mutex);
+      taskRunner->taskList_->pendingTasks.emplace_back(taskData, taskRunCallback, taskDataDeleteCallback, deleterData);
+      if (std::exchange(taskRunner->taskList_->isDrainQueued, true)) {
+        return;
+      }
+    }
+    taskRunner->queue_->runOnQueue([taskList = taskRunner->taskList_] { DrainTasks(*taskList); });
+  }
+
+  static void DrainTasks(TaskList &taskList) {
+    {
+      std::scoped_lock lock(taskList.mutex);
+      std::swap(taskList.pendingTasks, taskList.runningTasks);
+      taskList.isDrainQueued = false;
+    }
+    // Tasks posted while these run go to the next drain, after any work queued in between
+    for (const auto &task : taskList.runningTasks) {
+      task.Run();
+    }
+    taskList.runningTasks.clear();
   }
 
   static void NAPI_CDECL Delete(void *taskRunner, void * /*deleterData*/) {
@@ -131,6 +173,7 @@ class HermesTaskRunner {
 
  private:
   std::shared_ptr<facebook::react::MessageQueueThread> queue_;
+  std::shared_ptr<TaskList> taskList_;
 };
 
 struct HermesJsiBuffer : facebook::jsi::Buffer {
@@ -287,6 +330,7 @@ void HermesRuntimeHolder::initRuntime() noexcept {
 
   napi_env env{};
   CRASH_ON_ERROR(api.jsr_runtime_get_node_api_env(runtime, &env));
+  m_env = env;
 
   m_jsiRuntime = makeNodeApiJsiRuntime(
       env, &api, [runtime]() { CRASH_ON_ERROR(HermesApi::current()->jsr_delete_runtime(runtime)); });
@@ -323,6 +367,28 @@ hermes_runtime HermesRuntimeHolder::getHermesRuntime() noexcept {
   return reinterpret_cast<hermes_runtime>(m_runtime);
 }
 
+void HermesRuntimeHolder::collectGarbage(const char *reason) noexcept {
+  if (!m_jsQueue) {
+    return;
+  }
+
+  m_jsQueue->runOnQueue([weakThis = weak_from_this(), reason]() noexcept {
+    auto strongThis = weakThis.lock();
+    if (!strongThis || !strongThis->m_env) {
+      return;
+    }
+
+    facebook::react::TraceSection s("HermesRuntimeHolder::collectGarbage");
+    auto startTime = std::chrono::steady_clock::now();
+    // A failed collection leaves the heap as it was, so it is only logged
+    bool succeeded = getHermesApi().jsr_collect_garbage(strongThis->m_env) == napi_ok;
+    facebook::react::tracing::logJSGarbageCollection(
+        reason,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count(),
+        succeeded);
+  });
+}
+
 //==============================================================================
 // HermesJSRuntime implementation
 //==============================================================================
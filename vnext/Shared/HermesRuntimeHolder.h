@@ -233,11 +233,16 @@ class HermesRuntimeHolder : public Microsoft::JSI::RuntimeHolderLazyInit,
 
   hermes_runtime getHermesRuntime() noexcept;
 
+  // Posts a full garbage collection of the JS heap to the JS queue. The reason is logged with it and must be a string
+  // literal.
+  void collectGarbage(const char *reason) noexcept;
+
  private:
   void initRuntime() noexcept;
 
  private:
   jsr_runtime m_runtime{};
+  napi_env m_env{};
   std::shared_ptr<facebook::jsi::Runtime> m_jsiRuntime;
   std::once_flag m_onceFlag{};
   std::thread::id m_ownThreadId{};
@@ -246,6 +251,11 @@ class HermesRuntimeHolder : public Microsoft::JSI::RuntimeHolderLazyInit,
   std::shared_ptr<facebook::jsi::PreparedScriptStore> m_preparedScriptStore;
 };
 
+// The runtime holder of a React instance. It is a weak pointer, so that it does not keep the runtime alive.
+winrt::Microsoft::ReactNative::ReactPropertyId<
+    winrt::Microsoft::ReactNative::ReactNonAbiValue<std::weak_ptr<HermesRuntimeHolder>>>
+HermesRuntimeHolderProperty() noexcept;
+
 class HermesJSRuntime final : public facebook::react::JSRuntime {
  public:
   HermesJSRuntime(std::shared_ptr<Microsoft::JSI::RuntimeHolderLazyInit> hermesRuntimeHolder);
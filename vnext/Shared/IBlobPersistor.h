@@ -7,12 +7,19 @@
 #include <winrt/base.h>
 
 // Standard Library
+#include <algorithm>
 #include <string>
 #include <vector>
 
 namespace Microsoft::React {
 
 struct IBlobPersistor {
+  struct BlobSlice {
+    std::string BlobId;
+    int64_t Offset;
+    int64_t Size;
+  };
+
   ///
   /// <exception cref="std::invalid_argument">
   /// When an entry for blobId cannot be found.
@@ -22,9 +29,58 @@ struct IBlobPersistor {
 
   virtual void RemoveMessage(std::string &&blobId) noexcept = 0;
 
+  ///
+  /// Removes several blobs at once.
+  /// Implementations may take their lock once for the whole batch.
+  ///
+  virtual void RemoveMessages(std::vector<std::string> &&blobIds) noexcept {
+    for (auto &blobId : blobIds) {
+      RemoveMessage(std::move(blobId));
+    }
+  }
+
   virtual void StoreMessage(std::vector<uint8_t> &&message, std::string &&blobId) noexcept = 0;
 
   virtual std::string StoreMessage(std::vector<uint8_t> &&message) noexcept = 0;
+
+  ///
+  /// Stores the concatenation of slices of stored blobs under blobId.
+  /// Implementations may share the bytes of the source blobs instead of copying them.
+  /// <exception cref="std::invalid_argument">
+  /// When an entry for a slice's blobId cannot be found.
+  /// </exception>
+  ///
+  virtual void StoreComposite(std::vector<BlobSlice> &&slices, std::string &&blobId) {
+    std::vector<uint8_t> buffer;
+    for (auto &slice : slices) {
+      auto bytes = ResolveMessage(std::move(slice.BlobId), slice.Offset, slice.Size);
+      buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+    }
+
+    StoreMessage(std::move(buffer), std::move(blobId));
+  }
+
+  ///
+  /// Copies destination.size() bytes of the blob, starting at offset, into destination.
+  /// Implementations may copy from storage directly, without resolving the range into contiguous memory.
+  /// <exception cref="std::invalid_argument">
+  /// When an entry for blobId cannot be found.
+  /// </exception>
+  ///
+  virtual void CopyMessage(std::string &&blobId, int64_t offset, winrt::array_view<uint8_t> destination) {
+    auto bytes = ResolveMessage(std::move(blobId), offset, static_cast<int64_t>(destination.size()));
+    std::copy(bytes.begin(), bytes.end(), destination.begin());
+  }
+
+  ///
+  /// Number of stored blobs, for the memory report.
+  ///
+  virtual size_t BlobCount() noexcept = 0;
+
+  ///
+  /// Bytes of the stored blobs held in memory, for the memory report.
+  ///
+  virtual size_t MemoryUsage() noexcept = 0;
 };
 
 } // namespace Microsoft::React
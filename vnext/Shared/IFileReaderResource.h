@@ -30,6 +30,11 @@ struct IFileReaderResource {
       std::function<void(std::string &&)> &&resolver,
       std::function<void(std::string &&)> &&rejecter) noexcept = 0;
 
+  ///
+  /// Called after each chunk of a read is copied, with the number of bytes read so far and the size of the read.
+  ///
+  virtual void SetOnProgress(std::function<void(int64_t loaded, int64_t total)> &&handler) noexcept = 0;
+
   static std::shared_ptr<IFileReaderResource> Make(std::weak_ptr<IBlobPersistor> weakBlobPersistor) noexcept;
 };
 
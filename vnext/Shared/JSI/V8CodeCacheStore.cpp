@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "V8CodeCacheStore.h"
+#include <tracing/tracing.h>
+#include <cstring>
+#include <optional>
+#include "ByteArrayBuffer.h"
+
+namespace Microsoft::ReactNative {
+
+V8CodeCacheStore::V8CodeCacheStore(std::shared_ptr<facebook::jsi::PreparedScriptStore> scriptStore) noexcept
+    : m_scriptStore(std::move(scriptStore)) {}
+
+/*static*/ std::shared_ptr<facebook::jsi::PreparedScriptStore> V8CodeCacheStore::Create(
+    std::shared_ptr<facebook::jsi::PreparedScriptStore> scriptStore) noexcept {
+  if (!scriptStore) {
+    return nullptr;
+  }
+  return std::make_shared<V8CodeCacheStore>(std::move(scriptStore));
+}
+
+std::shared_ptr<const facebook::jsi::Buffer> V8CodeCacheStore::tryGetPreparedScript(
+    const facebook::jsi::ScriptSignature &scriptSignature,
+    const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) noexcept {
+  auto codeCache = m_scriptStore->tryGetPreparedScript(scriptSignature, runtimeSignature, prepareTag);
+  if (!codeCache) {
+    {
+      std::scoped_lock lock{m_mutex};
+      m_missTimes[{scriptSignature.url, prepareTag ? prepareTag : ""}] = Clock::now();
+    }
+    facebook::react::tracing::logV8CodeCacheLoad(scriptSignature.url.c_str(), false, 0, 0);
+    return nullptr;
+  }
+
+  std::chrono::microseconds compileTime{};
+  auto compileTimeBuffer =
+      m_scriptStore->tryGetPreparedScript(scriptSignature, runtimeSignature, CompileTimeTag(prepareTag).c_str());
+  if (compileTimeBuffer && compileTimeBuffer->size() == sizeof(int64_t)) {
+    int64_t compileTimeUs;
+    memcpy(&compileTimeUs, compileTimeBuffer->data(), sizeof(compileTimeUs));
+    compileTime = std::chrono::microseconds{compileTimeUs};
+  }
+
+  facebook::react::tracing::logV8CodeCacheLoad(
+      scriptSignature.url.c_str(),
+      true,
+      codeCache->size(),
+      std::chrono::duration<double, std::milli>(compileTime).count());
+  return codeCache;
+}
+
+void V8CodeCacheStore::persistPreparedScript(
+    std::shared_ptr<const facebook::jsi::Buffer> preparedScript,
+    const facebook::jsi::ScriptSignature &scriptSignature,
+    const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+    const char *prepareTag) noexcept {
+  if (!preparedScript) {
+    return;
+  }
+
+  std::optional<Clock::duration> compileTime;
+  {
+    std::scoped_lock lock{m_mutex};
+    auto it = m_missTimes.find({scriptSignature.url, prepareTag ? prepareTag : ""});
+    if (it != m_missTimes.end()) {
+      compileTime = Clock::now() - it->second;
+      m_missTimes.erase(it);
+    }
+  }
+
+  facebook::react::tracing::logV8CodeCacheStore(
+      scriptSignature.url.c_str(),
+      preparedScript->size(),
+      compileTime ? std::chrono::duration<double, std::milli>(*compileTime).count() : 0);
+  m_scriptStore->persistPreparedScript(std::move(preparedScript), scriptSignature, runtimeSignature, prepareTag);
+
+  if (compileTime) {
+    int64_t compileTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(*compileTime).count();
+    auto compileTimeBuffer = std::make_shared<Microsoft::JSI::ByteArrayBuffer>(sizeof(compileTimeUs));
+    memcpy(compileTimeBuffer->data(), &compileTimeUs, sizeof(compileTimeUs));
+    m_scriptStore->persistPreparedScript(
+        std::move(compileTimeBuffer), scriptSignature, runtimeSignature, CompileTimeTag(prepareTag).c_str());
+  }
+}
+
+/*static*/ std::string V8CodeCacheStore::CompileTimeTag(const char *prepareTag) noexcept {
+  return std::string{prepareTag ? prepareTag : ""} + "-compileTime";
+}
+
+} // namespace Microsoft::ReactNative
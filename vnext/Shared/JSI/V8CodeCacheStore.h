@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ScriptStore.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Microsoft::ReactNative {
+
+// Prepared script store for the code cache of V8, which measures what the cache saves.
+// V8 looks up the code cache of a script before it compiles it, and stores the code cache that it produces after
+// compiling a script that missed. The time from the miss to the store is the compile time of the script, which is
+// stored next to its code cache with the same script and runtime signatures, so that a later hit knows the compile
+// time it saves. Each lookup and store is logged. All methods are thread safe.
+class V8CodeCacheStore final : public facebook::jsi::PreparedScriptStore {
+ public:
+  V8CodeCacheStore(std::shared_ptr<facebook::jsi::PreparedScriptStore> scriptStore) noexcept;
+
+  // Returns nullptr when there is no store to measure
+  static std::shared_ptr<facebook::jsi::PreparedScriptStore> Create(
+      std::shared_ptr<facebook::jsi::PreparedScriptStore> scriptStore) noexcept;
+
+  std::shared_ptr<const facebook::jsi::Buffer> tryGetPreparedScript(
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+  void persistPreparedScript(
+      std::shared_ptr<const facebook::jsi::Buffer> preparedScript,
+      const facebook::jsi::ScriptSignature &scriptSignature,
+      const facebook::jsi::JSRuntimeSignature &runtimeSignature,
+      const char *prepareTag) noexcept override;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  static std::string CompileTimeTag(const char *prepareTag) noexcept;
+
+ private:
+  const std::shared_ptr<facebook::jsi::PreparedScriptStore> m_scriptStore;
+  std::mutex m_mutex;
+  // The time of each miss by script url and prepare tag, until the code cache of the script is stored
+  std::map<std::pair<std::string, std::string>, Clock::time_point> m_missTimes;
+};
+
+} // namespace Microsoft::ReactNative
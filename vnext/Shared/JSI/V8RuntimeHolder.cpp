@@ -6,6 +6,7 @@
 #include <NodeApiJsiRuntime.h>
 #include <crash/verifyElseCrash.h>
 #include "SafeLoadLibrary.h"
+#include "V8CodeCacheStore.h"
 
 using namespace Microsoft::NodeApiJsi;
 
@@ -212,7 +213,7 @@ V8RuntimeHolder::V8RuntimeHolder(
     bool enableMultiThreadingSupport) noexcept
     : m_weakDevSettings(devSettings),
       m_jsQueue(std::move(jsQueue)),
-      m_preparedScriptStore(std::move(preparedScriptStore)),
+      m_preparedScriptStore(V8CodeCacheStore::Create(std::move(preparedScriptStore))),
       m_enableMultiThreadingSupport(enableMultiThreadingSupport) {}
 
 void V8RuntimeHolder::initRuntime() noexcept {
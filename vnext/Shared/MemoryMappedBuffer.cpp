@@ -11,7 +11,7 @@ namespace {
 
 class MemoryMappedBuffer : public facebook::jsi::Buffer {
  public:
-  MemoryMappedBuffer(const wchar_t *const filename, uint32_t offset);
+  MemoryMappedBuffer(const wchar_t *const filename, size_t offset);
 
   size_t size() const override;
   const uint8_t *data() const override;
@@ -24,11 +24,11 @@ class MemoryMappedBuffer : public facebook::jsi::Buffer {
 
   std::unique_ptr<void, decltype(&CloseHandle)> m_fileMapping;
   std::unique_ptr<void, decltype(&FileDataDeleter)> m_fileData;
-  uint32_t m_fileSize = 0;
-  uint32_t m_offset = 0;
+  size_t m_fileSize = 0;
+  size_t m_offset = 0;
 };
 
-MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t offset)
+MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, size_t offset)
     : m_fileMapping{nullptr, &CloseHandle}, m_fileData{nullptr, &FileDataDeleter}, m_offset{offset} {
   if (!filename) {
     throw facebook::jsi::JSINativeException("MemoryMappedBuffer constructor is called with nullptr filename.");
@@ -47,23 +47,26 @@ MemoryMappedBuffer::MemoryMappedBuffer(const wchar_t *const filename, uint32_t o
     throw facebook::jsi::JSINativeException("GetFileSizeEx failed with last error " + std::to_string(GetLastError()));
   }
 
-  if (fileSize.LowPart == 0) {
+  if (fileSize.QuadPart == 0) {
     throw facebook::jsi::JSINativeException("Cannot memory map an empty file.");
   }
 
-  if (fileSize.HighPart != 0) {
-    throw facebook::jsi::JSINativeException(
-        "MemoryMappedBuffer only supports files whose size can fit within an "
-        "uint32_t.");
+  // The whole file is mapped into a single view, which has to fit in the address space
+  if (static_cast<ULONGLONG>(fileSize.QuadPart) > SIZE_MAX) {
+    throw facebook::jsi::JSINativeException("The file is too large to be memory mapped in this process.");
   }
 
-  m_fileSize = fileSize.LowPart;
+  m_fileSize = static_cast<size_t>(fileSize.QuadPart);
   if (m_offset > m_fileSize) {
     throw facebook::jsi::JSINativeException("Invalid offset.");
   }
 
   m_fileMapping.reset(CreateFileMappingFromApp(
-      fileHandle.get(), nullptr /* SecurityAttributes */, PAGE_READONLY, m_fileSize, nullptr /* Name */));
+      fileHandle.get(),
+      nullptr /* SecurityAttributes */,
+      PAGE_READONLY,
+      static_cast<ULONG64>(fileSize.QuadPart),
+      nullptr /* Name */));
 
   if (!m_fileMapping) {
     throw facebook::jsi::JSINativeException(
@@ -91,7 +94,7 @@ const uint8_t *MemoryMappedBuffer::data() const {
 
 namespace Microsoft::JSI {
 
-std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset) {
+std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, size_t offset) {
   return std::make_unique<MemoryMappedBuffer>(filename, offset);
 }
 
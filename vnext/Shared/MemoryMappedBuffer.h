@@ -9,8 +9,9 @@
 
 namespace Microsoft::JSI {
 
-// We only support files whose size can fit within an uint32_t. Memory
-// mapping an empty or a larger file fails.
-std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, uint32_t offset = 0);
+// The whole file is mapped, so on 32-bit processes the file has to fit in the
+// address space. Memory mapping an empty file fails. The data is only
+// null-terminated when the file size is not a multiple of the page size.
+std::unique_ptr<facebook::jsi::Buffer> MakeMemoryMappedBuffer(const wchar_t *const filename, size_t offset = 0);
 
 } // namespace Microsoft::JSI
@@ -14,7 +14,8 @@ BlobCollector::BlobCollector(string blobId, std::shared_ptr<IBlobResource> resou
 
 BlobCollector::~BlobCollector() noexcept {
   if (auto rc = m_weakResource.lock()) {
-    rc->Release(std::move(m_blobId));
+    // Runs from the JS garbage collector, which should not wait on the blob persistor.
+    rc->ReleaseDeferred(std::move(m_blobId));
   }
 }
 
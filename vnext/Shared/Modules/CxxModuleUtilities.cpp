@@ -2,8 +2,6 @@
 // Licensed under the MIT License.
 
 #include "CxxModuleUtilities.h"
-#include <DynamicReader.h>
-#include <DynamicWriter.h>
 
 namespace msrn = winrt::Microsoft::ReactNative;
 
@@ -25,18 +23,120 @@ void SendEvent(
   reactContext.EmitJSEvent(L"RCTDeviceEventEmitter", std::move(eventName), std::move(args));
 }
 
-msrn::JSValue ToJSValue(dynamic &value) noexcept {
-  auto reader = winrt::make<msrn::DynamicReader>(value);
-  auto result = msrn::JSValue::ReadFrom(reader);
+msrn::JSValue ToJSValue(const dynamic &value) noexcept {
+  switch (value.type()) {
+    case dynamic::Type::ARRAY: {
+      msrn::JSValueArray array;
+      array.reserve(value.size());
+      for (const auto &item : value) {
+        array.push_back(ToJSValue(item));
+      }
+      return msrn::JSValue{std::move(array)};
+    }
+    case dynamic::Type::OBJECT: {
+      msrn::JSValueObject object;
+      for (const auto &[key, item] : value.items()) {
+        object.emplace(key.asString(), ToJSValue(item));
+      }
+      return msrn::JSValue{std::move(object)};
+    }
+    case dynamic::Type::STRING:
+      return msrn::JSValue{std::string{value.getString()}};
+    case dynamic::Type::BOOL:
+      return msrn::JSValue{value.getBool()};
+    case dynamic::Type::INT64:
+      return msrn::JSValue{value.getInt()};
+    case dynamic::Type::DOUBLE:
+      // Like DynamicReader, which reports the doubles without a fractional part as integers
+      if (double d = value.getDouble(); static_cast<int64_t>(d) == d) {
+        return msrn::JSValue{static_cast<int64_t>(d)};
+      }
+      return msrn::JSValue{value.getDouble()};
+    default:
+      return msrn::JSValue{nullptr};
+  }
+}
 
-  return result;
+msrn::JSValue ToJSValue(dynamic &&value) noexcept {
+  switch (value.type()) {
+    case dynamic::Type::ARRAY: {
+      msrn::JSValueArray array;
+      array.reserve(value.size());
+      for (auto &item : value) {
+        array.push_back(ToJSValue(std::move(item)));
+      }
+      return msrn::JSValue{std::move(array)};
+    }
+    case dynamic::Type::OBJECT: {
+      // The keys of a dynamic object are const, only the values can be moved
+      msrn::JSValueObject object;
+      for (auto &[key, item] : value.items()) {
+        object.emplace(key.asString(), ToJSValue(std::move(item)));
+      }
+      return msrn::JSValue{std::move(object)};
+    }
+    case dynamic::Type::STRING:
+      return msrn::JSValue{std::move(value).getString()};
+    default:
+      return ToJSValue(static_cast<const dynamic &>(value));
+  }
 }
 
 dynamic ToDynamic(const msrn::JSValue &value) noexcept {
-  auto argWriter = msrn::MakeJSValueArgWriter(value);
-  auto result = msrn::DynamicWriter::ToDynamic(argWriter)[0];
+  switch (value.Type()) {
+    case msrn::JSValueType::Object: {
+      auto object = dynamic::object();
+      for (const auto &[key, item] : value.AsObject()) {
+        object.insert(key, ToDynamic(item));
+      }
+      return object;
+    }
+    case msrn::JSValueType::Array: {
+      auto array = dynamic::array();
+      array.reserve(value.AsArray().size());
+      for (const auto &item : value.AsArray()) {
+        array.push_back(ToDynamic(item));
+      }
+      return array;
+    }
+    case msrn::JSValueType::String:
+      return *value.TryGetString();
+    case msrn::JSValueType::Boolean:
+      return *value.TryGetBoolean();
+    case msrn::JSValueType::Int64:
+      return *value.TryGetInt64();
+    case msrn::JSValueType::Double:
+      return *value.TryGetDouble();
+    default:
+      return nullptr;
+  }
+}
 
-  return result;
+dynamic ToDynamic(msrn::JSValue &&value) noexcept {
+  switch (value.Type()) {
+    case msrn::JSValueType::Object: {
+      // The nodes are extracted from the map, so that their keys can be moved as well
+      auto source = value.MoveObject();
+      auto object = dynamic::object();
+      while (!source.empty()) {
+        auto node = source.extract(source.begin());
+        object.insert(std::move(node.key()), ToDynamic(std::move(node.mapped())));
+      }
+      return object;
+    }
+    case msrn::JSValueType::Array: {
+      auto source = value.MoveArray();
+      auto array = dynamic::array();
+      array.reserve(source.size());
+      for (auto &item : source) {
+        array.push_back(ToDynamic(std::move(item)));
+      }
+      return array;
+    }
+    default:
+      // JSValue does not give its string away, so strings are copied
+      return ToDynamic(static_cast<const msrn::JSValue &>(value));
+  }
 }
 
 } // namespace Microsoft::React::Modules
@@ -25,8 +25,13 @@ void SendEvent(
     std::wstring_view &&eventName,
     winrt::Microsoft::ReactNative::JSValueArray &&args) noexcept;
 
-winrt::Microsoft::ReactNative::JSValue ToJSValue(folly::dynamic &value) noexcept;
+// The conversions walk the values directly, instead of streaming them through an IJSValueReader or IJSValueWriter, so
+// they are only for values that do not cross the ABI.  The overloads taking an rvalue move the strings and the object
+// keys that the target can take over, and leave the source in an unspecified state.
+winrt::Microsoft::ReactNative::JSValue ToJSValue(const folly::dynamic &value) noexcept;
+winrt::Microsoft::ReactNative::JSValue ToJSValue(folly::dynamic &&value) noexcept;
 
 folly::dynamic ToDynamic(const winrt::Microsoft::ReactNative::JSValue &value) noexcept;
+folly::dynamic ToDynamic(winrt::Microsoft::ReactNative::JSValue &&value) noexcept;
 
 } // namespace Microsoft::React::Modules
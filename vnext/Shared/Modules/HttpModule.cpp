@@ -46,6 +46,26 @@ constexpr wchar_t receivedDataW[] = L"didReceiveNetworkData";
 
 msrn::ReactModuleProvider s_moduleProvider = msrn::MakeTurboModuleProvider<Microsoft::React::HttpTurboModule>();
 
+// Network events are emitted from tasks of normal priority, so that the runtime scheduler runs the rendering of user
+// input before them.  All of them take this path, so that the events of a request stay in order.
+void PostNetworkEvent(msrn::ReactContext const &context, function<void()> &&emit) noexcept {
+  if (auto callInvoker = context.Handle().CallInvoker()) {
+    callInvoker.InvokeAsyncWithPriority(
+        msrn::CallInvokerPriority::Normal, [emit = std::move(emit)](IInspectable const & /*runtime*/) { emit(); });
+  } else {
+    emit();
+  }
+}
+
+void SendNetworkEvent(
+    msrn::ReactContext const &context,
+    std::wstring_view &&eventName,
+    msrn::JSValueArray &&args) noexcept {
+  PostNetworkEvent(context, [context, eventName, args = std::make_shared<msrn::JSValueArray>(std::move(args))]() {
+    SendEvent(context, std::wstring_view{eventName}, std::move(*args));
+  });
+}
+
 } // namespace
 
 namespace Microsoft::React {
@@ -57,7 +77,7 @@ void HttpTurboModule::Initialize(msrn::ReactContext const &reactContext) noexcep
   m_resource = IHttpResource::Make(m_context.Properties().Handle());
 
   m_resource->SetOnRequestSuccess([context = m_context](int64_t requestId) {
-    SendEvent(context, completedResponseW, msrn::JSValueArray{requestId});
+    SendNetworkEvent(context, completedResponseW, msrn::JSValueArray{requestId});
   });
 
   m_resource->SetOnResponse([context = m_context](int64_t requestId, IHttpResource::Response &&response) {
@@ -69,32 +89,52 @@ void HttpTurboModule::Initialize(msrn::ReactContext const &reactContext) noexcep
     // TODO: Test response content?
     auto args = msrn::JSValueArray{requestId, response.StatusCode, std::move(headers), response.Url};
 
-    SendEvent(context, receivedResponseW, std::move(args));
+    SendNetworkEvent(context, receivedResponseW, std::move(args));
   });
 
   m_resource->SetOnData([context = m_context](int64_t requestId, string &&responseData) {
-    SendEvent(context, receivedDataW, msrn::JSValueArray{requestId, std::move(responseData)});
+    SendNetworkEvent(context, receivedDataW, msrn::JSValueArray{requestId, std::move(responseData)});
   });
 
   // Explicitly declaring function type to avoid type inference ambiguity.
   function<void(int64_t, msrn::JSValueObject &&)> onDataObject =
       [context = m_context](int64_t requestId, msrn::JSValueObject &&responseData) {
-        SendEvent(context, receivedDataW, msrn::JSValueArray{requestId, std::move(responseData)});
+        SendNetworkEvent(context, receivedDataW, msrn::JSValueArray{requestId, std::move(responseData)});
       };
   m_resource->SetOnData(std::move(onDataObject));
 
+  // The response of a "json" request was parsed on a background thread, and is only turned into JS values here
+  m_resource->SetOnJsonData([context = m_context](int64_t requestId, msrn::JSValue &&responseData) {
+    SendNetworkEvent(context, receivedDataW, msrn::JSValueArray{requestId, std::move(responseData)});
+  });
+
   m_resource->SetOnIncrementalData(
       [context = m_context](int64_t requestId, string &&responseData, int64_t progress, int64_t total) {
-        SendEvent(
+        SendNetworkEvent(
             context, receivedIncrementalDataW, msrn::JSValueArray{requestId, std::move(responseData), progress, total});
       });
 
+  // Binary chunks are sent as ArrayBuffer objects with the same event as text increments
+  m_resource->SetOnIncrementalBinaryData([context = m_context](
+                                             int64_t requestId,
+                                             winrt::Windows::Storage::Streams::IBuffer &&responseData,
+                                             int64_t progress,
+                                             int64_t total) {
+    PostNetworkEvent(context, [context, requestId, responseData = std::move(responseData), progress, total]() {
+      context.EmitJSEvent(L"RCTDeviceEventEmitter", receivedIncrementalDataW, requestId, responseData, progress, total);
+    });
+  });
+
   m_resource->SetOnDataProgress([context = m_context](int64_t requestId, int64_t progress, int64_t total) {
-    SendEvent(context, receivedDataProgressW, msrn::JSValueArray{requestId, progress, total});
+    SendNetworkEvent(context, receivedDataProgressW, msrn::JSValueArray{requestId, progress, total});
+  });
+
+  m_resource->SetOnDataSent([context = m_context](int64_t requestId, int64_t progress, int64_t total) {
+    SendNetworkEvent(context, sentDataW, msrn::JSValueArray{requestId, progress, total});
   });
 
   m_resource->SetOnResponseComplete([context = m_context](int64_t requestId) {
-    SendEvent(context, completedResponseW, msrn::JSValueArray{requestId});
+    SendNetworkEvent(context, completedResponseW, msrn::JSValueArray{requestId});
   });
 
   m_resource->SetOnError([context = m_context](int64_t requestId, string &&message, bool isTimeout) {
@@ -103,7 +143,7 @@ void HttpTurboModule::Initialize(msrn::ReactContext const &reactContext) noexcep
       args.push_back(true);
     }
 
-    SendEvent(context, completedResponseW, std::move(args));
+    SendNetworkEvent(context, completedResponseW, std::move(args));
   });
 }
 
@@ -134,6 +174,14 @@ void HttpTurboModule::AbortRequest(double requestId) noexcept {
   m_resource->AbortRequest(static_cast<int64_t>(requestId));
 }
 
+void HttpTurboModule::AcknowledgeIncrementalData(double requestId, double byteCount) noexcept {
+  m_resource->AcknowledgeIncrementalData(static_cast<int64_t>(requestId), static_cast<int64_t>(byteCount));
+}
+
+void HttpTurboModule::Preconnect(string &&origin) noexcept {
+  m_resource->Preconnect(std::move(origin));
+}
+
 void HttpTurboModule::ClearCookies(function<void(bool)> const &callback) noexcept {
   m_resource->ClearCookies();
 }
@@ -27,6 +27,14 @@ struct HttpTurboModule {
   REACT_METHOD(AbortRequest, L"abortRequest")
   void AbortRequest(double requestId) noexcept;
 
+  // Windows specific: consumers of "arraybuffer" incremental responses report processed chunks to resume reading
+  REACT_METHOD(AcknowledgeIncrementalData, L"acknowledgeIncrementalData")
+  void AcknowledgeIncrementalData(double requestId, double byteCount) noexcept;
+
+  // Windows specific: prepares the first request to an origin, such as an API or CDN host that the app uses first
+  REACT_METHOD(Preconnect, L"preconnect")
+  void Preconnect(std::string &&origin) noexcept;
+
   REACT_METHOD(ClearCookies, L"clearCookies")
   void ClearCookies(std::function<void(bool)> const &callback) noexcept;
 
@@ -6,6 +6,9 @@
 // React Native Windows
 #include <JSValue.h>
 
+// Windows API
+#include <winrt/Windows.Storage.Streams.h>
+
 // Standard Library
 #include <string>
 
@@ -49,6 +52,23 @@ struct IRequestBodyHandler {
   virtual winrt::Microsoft::ReactNative::JSValueObject ToRequestBody(
       winrt::Microsoft::ReactNative::JSValueObject &data,
       std::string &contentType) = 0;
+
+  /// <summary>
+  /// Returns a stream reading the blob referenced by the JS body payload, without copying it into memory first.
+  /// </summary>
+  /// <param name="data">
+  /// Incoming folly object containing the blob metadata. Same structure as for <see cref="ToRequestBody" />.
+  /// </param>
+  /// <param name="contentType">
+  /// Request content type. Replaced by the blob type, if the payload has one.
+  /// </param>
+  /// <param name="size">
+  /// Receives the amount of bytes the stream reads.
+  /// </param>
+  virtual winrt::Windows::Storage::Streams::IInputStream ToRequestStream(
+      winrt::Microsoft::ReactNative::JSValueObject &data,
+      std::string &contentType,
+      uint64_t &size) = 0;
 };
 
 } // namespace Microsoft::React
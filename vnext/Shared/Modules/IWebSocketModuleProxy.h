@@ -6,6 +6,7 @@
 // Standard Library
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Microsoft::React {
 
@@ -17,6 +18,8 @@ struct IWebSocketModuleProxy {
   virtual ~IWebSocketModuleProxy() noexcept {}
 
   virtual void SendBinary(std::string &&base64String, int64_t id) noexcept = 0;
+
+  virtual void SendBinary(std::vector<uint8_t> &&message, int64_t id) noexcept = 0;
 };
 
 } // namespace Microsoft::React
@@ -6,20 +6,20 @@
 #include <Modules/WebSocketModule.h>
 #include <Modules/WebSocketTurboModule.h>
 
+#include <CppRuntimeOptions.h>
 #include <CreateModules.h>
 #include <Modules/CxxModuleUtilities.h>
 #include <Modules/IWebSocketModuleContentHandler.h>
 #include <ReactPropertyBag.h>
+#include <utilities.h>
 #include "Networking/NetworkPropertyIds.h"
 
 // fmt
 #include <fmt/format.h>
 
-// Windows API
-#include <winrt/Windows.Security.Cryptography.h>
-
 // Standard Library
 #include <iomanip>
+#include <mutex>
 
 namespace msrn = winrt::Microsoft::ReactNative;
 using folly::dynamic;
@@ -35,17 +35,71 @@ using winrt::Microsoft::ReactNative::ReactPropertyBag;
 using winrt::Microsoft::ReactNative::ReactPropertyId;
 
 using winrt::Windows::Foundation::IInspectable;
-using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 
 namespace {
 using Microsoft::React::IWebSocketModuleProxy;
 using Microsoft::React::Modules::SendEvent;
 using Microsoft::React::Networking::IWebSocketResource;
+using Microsoft::React::Utilities::EncodeBase64;
 
 constexpr wchar_t s_moduleNameW[] = L"WebSocketModule";
 
 msrn::ReactModuleProvider s_moduleProvider = msrn::MakeTurboModuleProvider<Microsoft::React::WebSocketTurboModule>();
 
+// Messages received by a socket and not yet dispatched to the JavaScript thread
+struct MessageBatch {
+  std::mutex Mutex;
+  msrn::JSValueArray Messages;
+  bool FlushScheduled{false};
+};
+
+// Sends a websocketMessage event, or appends the message to the socket's batch when message coalescing is enabled.
+// All messages appended before the JavaScript thread runs the flush are sent as one websocketMessages event.
+void SendMessageEvent(
+    msrn::ReactContext const &context,
+    shared_ptr<MessageBatch> const &batch,
+    int64_t id,
+    msrn::JSValueObject &&args) noexcept {
+  if (!batch) {
+    return SendEvent(context, L"websocketMessage", std::move(args));
+  }
+
+  std::scoped_lock lock{batch->Mutex};
+  batch->Messages.emplace_back(std::move(args));
+  if (batch->FlushScheduled) {
+    return;
+  }
+
+  batch->FlushScheduled = true;
+  context.JSDispatcher().Post([context, batch, id]() {
+    msrn::JSValueArray messages;
+    {
+      std::scoped_lock lock{batch->Mutex};
+      messages.swap(batch->Messages);
+      batch->FlushScheduled = false;
+    }
+
+    auto args = msrn::JSValueObject{{"id", id}};
+    args["messages"] = std::move(messages);
+    SendEvent(context, L"websocketMessages", std::move(args));
+  });
+}
+
+// Sends a socket event that must not overtake the messages batched before it.
+void SendOrderedEvent(
+    msrn::ReactContext const &context,
+    shared_ptr<MessageBatch> const &batch,
+    std::wstring_view eventName,
+    msrn::JSValueObject &&args) noexcept {
+  if (!batch) {
+    return SendEvent(context, std::move(eventName), std::move(args));
+  }
+
+  context.JSDispatcher().Post([context, eventName, args = std::make_shared<msrn::JSValueObject>(std::move(args))]() {
+    SendEvent(context, std::wstring_view{eventName}, std::move(*args));
+  });
+}
+
 } // anonymous namespace
 
 namespace Microsoft::React {
@@ -77,7 +131,13 @@ shared_ptr<IWebSocketResource> WebSocketTurboModule::CreateResource(int64_t id,
     SendEvent(context, L"websocketOpen", msrn::JSValueObject{{"id", id}});
   });
 
-  rc->SetOnMessage([id, context = m_context](size_t length, const string &message, bool isBinary) {
+  // Opt-in: coalesce messages received within one JavaScript thread turn into a single websocketMessages event.
+  shared_ptr<MessageBatch> batch;
+  if (GetRuntimeOptionBool("WebSocket.CoalesceMessages")) {
+    batch = std::make_shared<MessageBatch>();
+  }
+
+  rc->SetOnMessage([id, context = m_context, batch](size_t length, const string &message, bool isBinary) {
     auto args = msrn::JSValueObject{{"id", id}, {"type", isBinary ? "binary" : "text"}};
     shared_ptr<IWebSocketModuleContentHandler> contentHandler;
     auto propBag = context.Properties();
@@ -85,33 +145,42 @@ shared_ptr<IWebSocketResource> WebSocketTurboModule::CreateResource(int64_t id,
       contentHandler = prop.Value().lock();
 
     if (contentHandler) {
-      if (isBinary) {
-        auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(message));
-        winrt::com_array<uint8_t> arr;
-        CryptographicBuffer::CopyToByteArray(buffer, arr);
-        auto data = vector<uint8_t>(arr.begin(), arr.end());
-
-        contentHandler->ProcessMessage(std::move(data), args);
-      } else {
-        contentHandler->ProcessMessage(string{message}, args);
-      }
+      contentHandler->ProcessMessage(string{message}, args);
     } else {
       args["data"] = message;
     }
 
-    SendEvent(context, L"websocketMessage", std::move(args));
+    SendMessageEvent(context, batch, id, std::move(args));
+  });
+
+  // Binary messages are received as raw bytes to avoid a Base64 round trip for Blob consumers.
+  rc->SetOnBinaryMessage([id, context = m_context, batch](vector<uint8_t> &&message) {
+    auto args = msrn::JSValueObject{{"id", id}, {"type", "binary"}};
+    shared_ptr<IWebSocketModuleContentHandler> contentHandler;
+    auto propBag = context.Properties();
+    if (auto prop = propBag.Get(BlobModuleContentHandlerPropertyId()))
+      contentHandler = prop.Value().lock();
+
+    if (contentHandler) {
+      contentHandler->ProcessMessage(std::move(message), args);
+    } else {
+      // The JavaScript WebSocket expects binary data in Base64 format.
+      args["data"] = EncodeBase64(std::string_view(reinterpret_cast<const char *>(message.data()), message.size()));
+    }
+
+    SendMessageEvent(context, batch, id, std::move(args));
   });
 
-  rc->SetOnClose([id, context = m_context](IWebSocketResource::CloseCode code, const string &reason) {
+  rc->SetOnClose([id, context = m_context, batch](IWebSocketResource::CloseCode code, const string &reason) {
     auto args = msrn::JSValueObject{{"id", id}, {"code", static_cast<uint16_t>(code)}, {"reason", reason}};
 
-    SendEvent(context, L"websocketClosed", std::move(args));
+    SendOrderedEvent(context, batch, L"websocketClosed", std::move(args));
   });
 
-  rc->SetOnError([id, context = m_context](const IWebSocketResource::Error &err) {
+  rc->SetOnError([id, context = m_context, batch](const IWebSocketResource::Error &err) {
     auto errorObj = msrn::JSValueObject{{"id", id}, {"message", err.Message}};
 
-    SendEvent(context, L"websocketFailed", std::move(errorObj));
+    SendOrderedEvent(context, batch, L"websocketFailed", std::move(errorObj));
   });
 
   m_resourceMap.emplace(static_cast<double>(id), rc);
@@ -236,6 +305,19 @@ void WebSocketTurboModuleProxy::SendBinary(string &&base64String, int64_t id) no
   }
 }
 
+void WebSocketTurboModuleProxy::SendBinary(vector<uint8_t> &&message, int64_t id) noexcept /*override*/
+{
+  auto rcItr = m_resourceMap.find(static_cast<double>(id));
+  if (rcItr == m_resourceMap.cend()) {
+    return;
+  }
+
+  weak_ptr<IWebSocketResource> weakRc = (*rcItr).second;
+  if (auto rc = weakRc.lock()) {
+    rc->SendBinary(std::move(message));
+  }
+}
+
 #pragma region WebSocketTurboModule
 
 /*extern*/ const wchar_t *GetWebSocketTurboModuleName() noexcept {
@@ -21,6 +21,8 @@ class WebSocketTurboModuleProxy final : public IWebSocketModuleProxy {
 
   void SendBinary(std::string &&base64String, int64_t id) noexcept override;
 
+  void SendBinary(std::vector<uint8_t> &&message, int64_t id) noexcept override;
+
 #pragma endregion
 };
 
@@ -0,0 +1,446 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#undef WINRT_LEAN_AND_MEAN
+
+#include "CachingHttpFilter.h"
+
+#include "WinRTTypes.h"
+
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+// Standard Library
+#include <algorithm>
+#include <chrono>
+
+using std::shared_ptr;
+using std::wstring;
+using std::wstring_view;
+
+using winrt::hstring;
+using winrt::Windows::Foundation::DateTime;
+using winrt::Windows::Foundation::TimeSpan;
+using winrt::Windows::Foundation::Collections::IMap;
+using winrt::Windows::Storage::Streams::IBuffer;
+using winrt::Windows::Web::Http::HttpBufferContent;
+using winrt::Windows::Web::Http::HttpProgress;
+using winrt::Windows::Web::Http::HttpRequestMessage;
+using winrt::Windows::Web::Http::HttpResponseMessage;
+using winrt::Windows::Web::Http::HttpResponseMessageSource;
+using winrt::Windows::Web::Http::HttpStatusCode;
+using winrt::Windows::Web::Http::HttpStringContent;
+using winrt::Windows::Web::Http::IHttpContent;
+using winrt::Windows::Web::Http::Filters::IHttpFilter;
+
+namespace {
+
+// Upper bound for freshness computed from Last-Modified, see RFC 9111 section 4.2.2
+constexpr auto maxHeuristicFreshness = std::chrono::hours{24};
+
+wstring_view Trim(wstring_view value) noexcept {
+  auto start = value.find_first_not_of(L" \t");
+  if (start == wstring_view::npos) {
+    return {};
+  }
+  auto end = value.find_last_not_of(L" \t");
+  return value.substr(start, end - start + 1);
+}
+
+hstring LookupHeader(IMap<hstring, hstring> const &headers, wstring_view name) noexcept {
+  if (auto value = headers.TryLookup(name)) {
+    return *value;
+  }
+  return {};
+}
+
+// Statuses that may be stored without explicit freshness, see RFC 9110 section 15.1
+bool IsHeuristicallyCacheable(HttpStatusCode status) noexcept {
+  switch (status) {
+    case HttpStatusCode::Ok:
+    case HttpStatusCode::NonAuthoritativeInformation:
+    case HttpStatusCode::NoContent:
+    case HttpStatusCode::MultipleChoices:
+    case HttpStatusCode::MovedPermanently:
+    case HttpStatusCode::PermanentRedirect:
+    case HttpStatusCode::NotFound:
+    case HttpStatusCode::MethodNotAllowed:
+    case HttpStatusCode::Gone:
+    case HttpStatusCode::RequestUriTooLong:
+    case HttpStatusCode::NotImplemented:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void CopyContent(HttpResponseMessage const &response, IHttpContent const &source, IBuffer const &body) {
+  HttpBufferContent content{body};
+  if (source) {
+    for (auto const &header : source.Headers()) {
+      if (!boost::iequals(wstring_view{header.Key()}, L"Content-Length")) {
+        content.Headers().TryAppendWithoutValidation(header.Key(), header.Value());
+      }
+    }
+  }
+  content.Headers().ContentLength(body.Length());
+  response.Content(content);
+}
+
+} // namespace
+
+namespace Microsoft::React::Networking {
+
+#pragma region CachingHttpFilter
+
+CachingHttpFilter::CachingHttpFilter(IHttpFilter const &innerFilter, size_t capacity) noexcept
+    : m_innerFilter{innerFilter}, m_capacity{capacity} {}
+
+/*static*/ CachingHttpFilter::CacheControlDirectives CachingHttpFilter::ParseCacheControl(
+    wstring_view value) noexcept {
+  CacheControlDirectives result;
+
+  size_t start = 0;
+  while (start < value.size()) {
+    auto end = value.find(L',', start);
+    if (end == wstring_view::npos) {
+      end = value.size();
+    }
+
+    auto directive = Trim(value.substr(start, end - start));
+    auto separator = directive.find(L'=');
+    auto name = Trim(directive.substr(0, separator));
+    if (boost::iequals(name, L"no-store")) {
+      result.NoStore = true;
+    } else if (boost::iequals(name, L"no-cache")) {
+      result.NoCache = true;
+    } else if (boost::iequals(name, L"must-revalidate")) {
+      result.MustRevalidate = true;
+    } else if (boost::iequals(name, L"only-if-cached")) {
+      result.OnlyIfCached = true;
+    } else if (boost::iequals(name, L"max-age") && separator != wstring_view::npos) {
+      auto argument = Trim(directive.substr(separator + 1));
+      if (argument.size() >= 2 && argument.front() == L'"' && argument.back() == L'"') {
+        argument = argument.substr(1, argument.size() - 2);
+      }
+
+      // Invalid values are treated as stale, see RFC 9111 section 1.2.2
+      int64_t seconds = 0;
+      for (auto c : argument) {
+        if (c < L'0' || c > L'9') {
+          seconds = 0;
+          break;
+        }
+        seconds = (std::min)(seconds * 10 + (c - L'0'), int64_t{INT32_MAX});
+      }
+      result.MaxAge = seconds;
+    }
+
+    start = end + 1;
+  }
+
+  return result;
+}
+
+CachingHttpFilter::Statistics CachingHttpFilter::GetStatistics() const noexcept {
+  return {m_hits, m_misses, m_revalidations, m_stores, m_bypasses};
+}
+
+void CachingHttpFilter::Clear() noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_index.clear();
+  m_entries.clear();
+  m_size = 0;
+}
+
+shared_ptr<CachingHttpFilter::CacheEntry> CachingHttpFilter::Find(wstring const &key) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto iter = m_index.find(key);
+  if (iter == m_index.end()) {
+    return nullptr;
+  }
+
+  m_entries.splice(m_entries.begin(), m_entries, iter->second);
+  return iter->second->second;
+}
+
+void CachingHttpFilter::Store(wstring &&key, shared_ptr<CacheEntry> &&entry) noexcept {
+  std::scoped_lock lock{m_mutex};
+  EraseLocked(key);
+
+  m_size += entry->Body.Length();
+  m_entries.emplace_front(std::move(key), std::move(entry));
+  m_index.emplace(m_entries.front().first, m_entries.begin());
+
+  // Evict least recently used entries
+  while (m_size > m_capacity && m_entries.size() > 1) {
+    EraseLocked(wstring{m_entries.back().first});
+  }
+}
+
+void CachingHttpFilter::Remove(wstring const &key) noexcept {
+  std::scoped_lock lock{m_mutex};
+  EraseLocked(key);
+}
+
+void CachingHttpFilter::EraseLocked(wstring const &key) noexcept {
+  auto iter = m_index.find(key);
+  if (iter == m_index.end()) {
+    return;
+  }
+
+  m_size -= iter->second->second->Body.Length();
+  m_entries.erase(iter->second);
+  m_index.erase(iter);
+}
+
+/*static*/ shared_ptr<CachingHttpFilter::CacheEntry> CachingHttpFilter::MakeEntry(
+    HttpRequestMessage const &request,
+    HttpResponseMessage const &response,
+    IBuffer const &body) {
+  auto entry = std::make_shared<CacheEntry>();
+  auto headers = response.Headers();
+  auto content = response.Content();
+
+  entry->StatusCode = response.StatusCode();
+  for (auto const &header : headers) {
+    entry->ResponseHeaders.emplace_back(header.Key(), header.Value());
+  }
+  if (content) {
+    for (auto const &header : content.Headers()) {
+      if (!boost::iequals(wstring_view{header.Key()}, L"Content-Length")) {
+        entry->ContentHeaders.emplace_back(header.Key(), header.Value());
+      }
+    }
+  }
+  entry->Body = body;
+
+  auto vary = LookupHeader(headers, L"Vary");
+  std::vector<wstring> varyNames;
+  boost::split(varyNames, wstring_view{vary}, boost::is_any_of(L","));
+  for (auto &name : varyNames) {
+    auto trimmed = Trim(name);
+    if (!trimmed.empty()) {
+      hstring key{trimmed};
+      entry->VaryHeaders.emplace_back(key, LookupHeader(request.Headers(), key));
+    }
+  }
+
+  // See RFC 9111 section 4.2.3
+  auto now = winrt::clock::now();
+  entry->ResponseTime = now;
+  auto date = now;
+  if (auto dateHeader = headers.Date()) {
+    date = dateHeader.Value();
+  }
+  auto apparentAge = (std::max)(TimeSpan{0}, now - date);
+  auto ageValue = headers.Age() ? headers.Age().Value() : TimeSpan{0};
+  entry->InitialAge = (std::max)(apparentAge, ageValue);
+
+  // See RFC 9111 section 4.2.1
+  auto directives = ParseCacheControl(LookupHeader(headers, L"Cache-Control"));
+  entry->NoCache = directives.NoCache;
+  entry->FreshnessLifetime = TimeSpan{0};
+  if (directives.MaxAge) {
+    entry->FreshnessLifetime = std::chrono::seconds{*directives.MaxAge};
+  } else if (auto expires = content ? content.Headers().Expires() : nullptr) {
+    entry->FreshnessLifetime = (std::max)(TimeSpan{0}, expires.Value() - date);
+  } else if (auto lastModified = content ? content.Headers().LastModified() : nullptr) {
+    auto heuristicFreshness = (std::max)(TimeSpan{0}, date - lastModified.Value()) / 10;
+    entry->FreshnessLifetime = (std::min)(heuristicFreshness, TimeSpan{maxHeuristicFreshness});
+  }
+
+  entry->ETag = LookupHeader(headers, L"ETag");
+  if (content) {
+    entry->LastModified = LookupHeader(content.Headers(), L"Last-Modified");
+  }
+
+  return entry;
+}
+
+/*static*/ HttpResponseMessage CachingHttpFilter::MakeResponse(
+    HttpRequestMessage const &request,
+    CacheEntry const &entry) {
+  HttpResponseMessage response{entry.StatusCode};
+  for (auto const &header : entry.ResponseHeaders) {
+    response.Headers().TryAppendWithoutValidation(header.first, header.second);
+  }
+
+  auto age = std::chrono::duration_cast<std::chrono::seconds>(CurrentAge(entry));
+  response.Headers().Remove(L"Age");
+  response.Headers().TryAppendWithoutValidation(L"Age", winrt::to_hstring(age.count()));
+
+  HttpBufferContent content{entry.Body};
+  for (auto const &header : entry.ContentHeaders) {
+    content.Headers().TryAppendWithoutValidation(header.first, header.second);
+  }
+  content.Headers().ContentLength(entry.Body.Length());
+  response.Content(content);
+
+  response.RequestMessage(request);
+  response.Source(HttpResponseMessageSource::Cache);
+
+  return response;
+}
+
+/*static*/ bool CachingHttpFilter::MatchesVary(HttpRequestMessage const &request, CacheEntry const &entry) {
+  for (auto const &header : entry.VaryHeaders) {
+    if (header.first == L"*" || LookupHeader(request.Headers(), header.first) != header.second) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*static*/ TimeSpan CachingHttpFilter::CurrentAge(CacheEntry const &entry) noexcept {
+  return entry.InitialAge + (winrt::clock::now() - entry.ResponseTime);
+}
+
+#pragma region IHttpFilter
+
+winrt::Windows::Foundation::IAsyncOperationWithProgress<HttpResponseMessage, HttpProgress>
+CachingHttpFilter::SendRequestAsync(HttpRequestMessage const &request) {
+  // Keep references after coroutine suspension.
+  auto self = get_strong();
+  auto coRequest = request;
+  auto progress = co_await winrt::get_progress_token();
+
+  auto method = coRequest.Method().Method();
+  auto key = wstring{coRequest.RequestUri().AbsoluteUri()};
+  auto requestHeaders = coRequest.Headers();
+
+  // Safe methods other than GET are not stored and leave stored responses untouched
+  if (method == L"HEAD" || method == L"OPTIONS" || method == L"TRACE") {
+    ++m_bypasses;
+    co_return {co_await ForwardProgress(m_innerFilter.SendRequestAsync(coRequest), progress)};
+  }
+
+  // Unsafe methods invalidate the stored response for their target, see RFC 9111 section 4.4
+  if (method != L"GET") {
+    ++m_bypasses;
+    auto response = co_await ForwardProgress(m_innerFilter.SendRequestAsync(coRequest), progress);
+    if (static_cast<int32_t>(response.StatusCode()) < 400) {
+      Remove(key);
+    }
+    co_return response;
+  }
+
+  auto requestDirectives = ParseCacheControl(LookupHeader(requestHeaders, L"Cache-Control"));
+  if (boost::iequals(wstring_view{LookupHeader(requestHeaders, L"Pragma")}, L"no-cache")) {
+    requestDirectives.NoCache = true;
+  }
+
+  // Conditional and range requests made by the app are answered by the server
+  if (requestDirectives.NoStore || requestHeaders.HasKey(L"If-None-Match") ||
+      requestHeaders.HasKey(L"If-Modified-Since") || requestHeaders.HasKey(L"Range")) {
+    ++m_bypasses;
+    co_return {co_await m_innerFilter.SendRequestAsync(coRequest)};
+  }
+
+  auto entry = Find(key);
+  if (entry && !MatchesVary(coRequest, *entry)) {
+    entry = nullptr;
+  }
+
+  if (entry) {
+    auto lifetime = entry->FreshnessLifetime;
+    if (requestDirectives.MaxAge) {
+      lifetime = (std::min)(lifetime, TimeSpan{std::chrono::seconds{*requestDirectives.MaxAge}});
+    }
+
+    auto fresh = !entry->NoCache && !requestDirectives.NoCache && CurrentAge(*entry) < lifetime;
+    if (fresh || requestDirectives.OnlyIfCached) {
+      ++m_hits;
+      co_return MakeResponse(coRequest, *entry);
+    }
+  } else if (requestDirectives.OnlyIfCached) {
+    ++m_misses;
+    HttpResponseMessage response{HttpStatusCode::GatewayTimeout};
+    response.Content(HttpStringContent{L""});
+    response.RequestMessage(coRequest);
+    co_return response;
+  }
+
+  // Revalidate the stale response, see RFC 9111 section 4.3.1
+  auto revalidating = entry && (!entry->ETag.empty() || !entry->LastModified.empty());
+  if (revalidating) {
+    if (!entry->ETag.empty()) {
+      requestHeaders.TryAppendWithoutValidation(L"If-None-Match", entry->ETag);
+    }
+    if (!entry->LastModified.empty()) {
+      requestHeaders.TryAppendWithoutValidation(L"If-Modified-Since", entry->LastModified);
+    }
+  }
+
+  auto response = co_await m_innerFilter.SendRequestAsync(coRequest);
+
+  if (revalidating && response.StatusCode() == HttpStatusCode::NotModified) {
+    ++m_revalidations;
+
+    // Update the stored response with the headers of the 304 response, see RFC 9111 section 4.3.4
+    auto cachedResponse = MakeResponse(coRequest, *entry);
+    for (auto const &header : response.Headers()) {
+      cachedResponse.Headers().Remove(header.Key());
+      cachedResponse.Headers().TryAppendWithoutValidation(header.Key(), header.Value());
+    }
+    if (auto content = response.Content()) {
+      for (auto const &header : content.Headers()) {
+        wstring_view name{header.Key()};
+        if (!boost::iequals(name, L"Content-Length") && !boost::iequals(name, L"Content-Type")) {
+          cachedResponse.Content().Headers().Remove(header.Key());
+          cachedResponse.Content().Headers().TryAppendWithoutValidation(header.Key(), header.Value());
+        }
+      }
+    }
+
+    try {
+      Store(std::move(key), MakeEntry(coRequest, cachedResponse, entry->Body));
+    } catch (winrt::hresult_error const &) {
+      // Keep the stale entry when the updated headers can not be parsed
+    }
+    co_return cachedResponse;
+  }
+
+  ++m_misses;
+
+  auto responseDirectives = ParseCacheControl(LookupHeader(response.Headers(), L"Cache-Control"));
+  auto content = response.Content();
+  auto contentLength = content ? content.Headers().ContentLength() : nullptr;
+  auto responseHeaders = response.Headers();
+  auto hasFreshnessOrValidators = responseDirectives.MaxAge || responseHeaders.HasKey(L"ETag") ||
+      (content && (content.Headers().HasKey(L"Expires") || content.Headers().HasKey(L"Last-Modified")));
+
+  // Only bodies of known, moderate size are buffered, so large downloads keep streaming
+  auto storable = !responseDirectives.NoStore && IsHeuristicallyCacheable(response.StatusCode()) &&
+      LookupHeader(responseHeaders, L"Vary") != L"*" && hasFreshnessOrValidators && contentLength &&
+      contentLength.Value() <= m_capacity / 8;
+
+  if (!storable) {
+    if (entry) {
+      Remove(key);
+    }
+    co_return response;
+  }
+
+  auto body = co_await content.ReadAsBufferAsync();
+
+  // The original content stream has been consumed
+  CopyContent(response, content, body);
+
+  try {
+    Store(std::move(key), MakeEntry(coRequest, response, body));
+    ++m_stores;
+  } catch (winrt::hresult_error const &) {
+    // Responses with malformed date headers are not stored
+    Remove(key);
+  }
+
+  co_return response;
+}
+
+#pragma endregion IHttpFilter
+
+#pragma endregion CachingHttpFilter
+
+} // namespace Microsoft::React::Networking
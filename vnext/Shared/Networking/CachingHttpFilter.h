@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Windows API
+#include <winrt/Windows.Foundation.Collections.h>
+#include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Storage.Streams.h>
+#include <winrt/Windows.Web.Http.Filters.h>
+#include <winrt/Windows.Web.Http.Headers.h>
+#include <winrt/Windows.Web.Http.h>
+
+// Standard Library
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+/// <summary>
+/// Private in-memory HTTP cache (RFC 9111) for GET responses.
+/// </summary>
+/// <remarks>
+/// Fresh responses are served without reaching the inner filter. Stale responses carrying validators are revalidated
+/// with a conditional request. Requests may override the cache behavior with the Cache-Control and Pragma headers.
+/// </remarks>
+class CachingHttpFilter : public winrt::implements<CachingHttpFilter, winrt::Windows::Web::Http::Filters::IHttpFilter> {
+ public:
+  struct CacheControlDirectives {
+    bool NoStore{false};
+    bool NoCache{false};
+    bool MustRevalidate{false};
+    bool OnlyIfCached{false};
+    std::optional<int64_t> MaxAge;
+  };
+
+  struct Statistics {
+    uint64_t Hits;
+    uint64_t Misses;
+    uint64_t Revalidations;
+    uint64_t Stores;
+    uint64_t Bypasses;
+  };
+
+  static CacheControlDirectives ParseCacheControl(std::wstring_view value) noexcept;
+
+ private:
+  typedef std::vector<std::pair<winrt::hstring, winrt::hstring>> HeaderList;
+
+  struct CacheEntry {
+    winrt::Windows::Web::Http::HttpStatusCode StatusCode;
+    HeaderList ResponseHeaders;
+    HeaderList ContentHeaders;
+    winrt::Windows::Storage::Streams::IBuffer Body;
+
+    // Request header values selected by the Vary response header at the time of storing
+    HeaderList VaryHeaders;
+
+    winrt::Windows::Foundation::DateTime ResponseTime;
+    winrt::Windows::Foundation::TimeSpan InitialAge;
+    winrt::Windows::Foundation::TimeSpan FreshnessLifetime;
+    bool NoCache;
+
+    winrt::hstring ETag;
+    winrt::hstring LastModified;
+  };
+
+  winrt::Windows::Web::Http::Filters::IHttpFilter m_innerFilter;
+  size_t m_capacity;
+  size_t m_size{0};
+
+  std::mutex m_mutex;
+  // Most recently used entries first
+  std::list<std::pair<std::wstring, std::shared_ptr<CacheEntry>>> m_entries;
+  std::unordered_map<std::wstring, decltype(m_entries)::iterator> m_index;
+
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+  std::atomic<uint64_t> m_revalidations{0};
+  std::atomic<uint64_t> m_stores{0};
+  std::atomic<uint64_t> m_bypasses{0};
+
+  std::shared_ptr<CacheEntry> Find(std::wstring const &key) noexcept;
+
+  void Store(std::wstring &&key, std::shared_ptr<CacheEntry> &&entry) noexcept;
+
+  void Remove(std::wstring const &key) noexcept;
+
+  // Requires m_mutex to be held
+  void EraseLocked(std::wstring const &key) noexcept;
+
+  // May throw winrt::hresult_error for malformed date headers
+  static std::shared_ptr<CacheEntry> MakeEntry(
+      winrt::Windows::Web::Http::HttpRequestMessage const &request,
+      winrt::Windows::Web::Http::HttpResponseMessage const &response,
+      winrt::Windows::Storage::Streams::IBuffer const &body);
+
+  static winrt::Windows::Web::Http::HttpResponseMessage MakeResponse(
+      winrt::Windows::Web::Http::HttpRequestMessage const &request,
+      CacheEntry const &entry);
+
+  static bool MatchesVary(winrt::Windows::Web::Http::HttpRequestMessage const &request, CacheEntry const &entry);
+
+  static winrt::Windows::Foundation::TimeSpan CurrentAge(CacheEntry const &entry) noexcept;
+
+ public:
+  CachingHttpFilter(winrt::Windows::Web::Http::Filters::IHttpFilter const &innerFilter, size_t capacity) noexcept;
+
+  Statistics GetStatistics() const noexcept;
+
+  void Clear() noexcept;
+
+#pragma region IHttpFilter
+
+  winrt::Windows::Foundation::IAsyncOperationWithProgress<
+      winrt::Windows::Web::Http::HttpResponseMessage,
+      winrt::Windows::Web::Http::HttpProgress>
+  SendRequestAsync(winrt::Windows::Web::Http::HttpRequestMessage const &request);
+
+#pragma endregion IHttpFilter
+};
+
+} // namespace Microsoft::React::Networking
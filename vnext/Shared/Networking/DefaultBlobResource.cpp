@@ -3,16 +3,24 @@
 
 #include "DefaultBlobResource.h"
 
+#include <CppRuntimeOptions.h>
 #include <Modules/IHttpModuleProxy.h>
 #include <Modules/IWebSocketModuleProxy.h>
 #include <utilities.h>
 #include "NetworkPropertyIds.h"
+#include "SpillingBlobPersistor.h"
 
 // Boost Libraries
 #include <boost/uuid/uuid_io.hpp>
 
 // Windows API
+#include <winrt/Windows.Foundation.h>
 #include <winrt/Windows.Security.Cryptography.h>
+#include <winrt/Windows.Storage.Streams.h>
+
+// Standard Library
+#include <algorithm>
+#include <utility>
 
 using std::scoped_lock;
 using std::shared_ptr;
@@ -20,7 +28,11 @@ using std::string;
 using std::vector;
 using std::weak_ptr;
 using winrt::array_view;
+using winrt::Windows::Foundation::IAsyncOperationWithProgress;
 using winrt::Windows::Security::Cryptography::CryptographicBuffer;
+using winrt::Windows::Storage::Streams::IBuffer;
+using winrt::Windows::Storage::Streams::IInputStream;
+using winrt::Windows::Storage::Streams::InputStreamOptions;
 
 namespace msrn = winrt::Microsoft::ReactNative;
 
@@ -29,6 +41,60 @@ namespace {
 constexpr Microsoft::React::Networking::IBlobResource::BlobFieldNames
     blobKeys{"blob", "blobId", "offset", "size", "type", "data"};
 
+// Blobs of this size or larger are kept in memory-mapped temporary files instead of memory
+constexpr size_t defaultSpillThreshold = 16 * 1024 * 1024;
+
+// In-memory blobs beyond this total are spilled to disk, least recently used first
+constexpr size_t defaultMemoryBudget = 64 * 1024 * 1024;
+
+// Reads a range of a stored blob into the buffers requested by the consumer, one read at a time.
+struct BlobInputStream : winrt::implements<BlobInputStream, IInputStream> {
+  BlobInputStream(
+      shared_ptr<Microsoft::React::IBlobPersistor> blobPersistor,
+      string &&blobId,
+      int64_t offset,
+      uint64_t size)
+      : m_blobPersistor{std::move(blobPersistor)}, m_blobId{std::move(blobId)}, m_offset{offset}, m_size{size} {}
+
+  IAsyncOperationWithProgress<IBuffer, uint32_t> ReadAsync(IBuffer buffer, uint32_t count, InputStreamOptions) {
+    auto self = get_strong();
+
+    // Spilled blobs are paged in from disk.
+    co_await winrt::resume_background();
+
+    auto length =
+        static_cast<uint32_t>((std::min)({uint64_t{count}, uint64_t{buffer.Capacity()}, m_size - m_position}));
+    m_blobPersistor->CopyMessage(
+        string{m_blobId}, m_offset + static_cast<int64_t>(m_position), array_view<uint8_t>{buffer.data(), length});
+    m_position += length;
+    buffer.Length(length);
+
+    co_return buffer;
+  }
+
+  void Close() noexcept {}
+
+ private:
+  shared_ptr<Microsoft::React::IBlobPersistor> m_blobPersistor;
+  string m_blobId;
+  int64_t m_offset;
+  uint64_t m_size;
+  uint64_t m_position{0};
+};
+
+string ResolveContentType(msrn::JSValueObject &data, string const &contentType) {
+  auto type = contentType;
+  auto itr = data.find(blobKeys.Type);
+  if (itr != data.cend() && !(*itr).second.AsString().empty()) {
+    type = (*itr).second.AsString();
+  }
+  if (type.empty()) {
+    type = "application/octet-stream";
+  }
+
+  return type;
+}
+
 } // namespace
 
 namespace Microsoft::React::Networking {
@@ -36,7 +102,7 @@ namespace Microsoft::React::Networking {
 #pragma region DefaultBlobResource
 
 DefaultBlobResource::DefaultBlobResource(
-    shared_ptr<MemoryBlobPersistor> blobPersistor,
+    shared_ptr<IBlobPersistor> blobPersistor,
     shared_ptr<BlobWebSocketModuleContentHandler> contentHandler,
     shared_ptr<BlobModuleRequestBodyHandler> requestBodyHandler,
     shared_ptr<BlobModuleResponseHandler> responseHandler,
@@ -47,6 +113,30 @@ DefaultBlobResource::DefaultBlobResource(
       m_responseHandler{responseHandler},
       m_propertyBag{propertyBag} {}
 
+DefaultBlobResource::~DefaultBlobResource() noexcept {
+  m_blobPersistor->RemoveMessages(TakePendingReleases());
+}
+
+vector<string> DefaultBlobResource::TakePendingReleases() noexcept {
+  vector<string> blobIds;
+  auto node = m_pendingReleases.exchange(nullptr, std::memory_order_acquire);
+  while (node) {
+    blobIds.push_back(std::move(node->BlobId));
+    delete std::exchange(node, node->Next);
+  }
+
+  return blobIds;
+}
+
+winrt::fire_and_forget DefaultBlobResource::DrainPendingReleasesAsync() noexcept {
+  auto self = shared_from_this();
+
+  co_await winrt::resume_background();
+
+  // Releases queued while this batch is removed are drained by the next call.
+  m_blobPersistor->RemoveMessages(TakePendingReleases());
+}
+
 #pragma region IBlobResource
 
 /*static*/ const IBlobResource::BlobFieldNames &IBlobResource::FieldNames() noexcept {
@@ -59,7 +149,17 @@ DefaultBlobResource::DefaultBlobResource(
 
   auto propBag = ReactPropertyBag{inspectableProperties.try_as<IReactPropertyBag>()};
 
-  auto blobPersistor = std::make_shared<MemoryBlobPersistor>();
+  // A negative Blob.SpillThreshold keeps every blob in memory.
+  shared_ptr<IBlobPersistor> blobPersistor;
+  auto spillThreshold = GetRuntimeOptionInt("Blob.SpillThreshold");
+  if (spillThreshold < 0) {
+    blobPersistor = std::make_shared<MemoryBlobPersistor>();
+  } else {
+    auto memoryBudget = GetRuntimeOptionInt("Blob.MemoryBudget");
+    blobPersistor = std::make_shared<SpillingBlobPersistor>(
+        spillThreshold > 0 ? static_cast<size_t>(spillThreshold) : defaultSpillThreshold,
+        memoryBudget > 0 ? static_cast<size_t>(memoryBudget) : defaultMemoryBudget);
+  }
   auto contentHandler = std::make_shared<BlobWebSocketModuleContentHandler>(blobPersistor);
   auto requestBodyHandler = std::make_shared<BlobModuleRequestBodyHandler>(blobPersistor);
   auto responseHandler = std::make_shared<BlobModuleResponseHandler>(blobPersistor);
@@ -91,46 +191,68 @@ void DefaultBlobResource::SendOverSocket(string &&blobId, int64_t offset, int64_
     return m_callbacks.OnError(e.what());
   }
 
-  auto chars = reinterpret_cast<const char *>(data.data());
-  auto view = std::string_view(chars, data.size());
-  wsProxy->SendBinary(Utilities::EncodeBase64(view), socketId);
+  wsProxy->SendBinary(vector<uint8_t>(data.begin(), data.end()), socketId);
 }
 
 void DefaultBlobResource::CreateFromParts(msrn::JSValueArray &&parts, string &&blobId) noexcept /*override*/ {
-  vector<uint8_t> buffer{};
+  // Compose the blob from slices, so the persistor can share the bytes of its parts instead of copying them.
+  vector<IBlobPersistor::BlobSlice> slices;
+
+  // String parts are stored as blobs of their own, only for as long as it takes to compose.
+  vector<string> stringBlobIds;
+  auto releaseStringBlobs = [this, &stringBlobIds]() noexcept {
+    for (auto &stringBlobId : stringBlobIds) {
+      m_blobPersistor->RemoveMessage(std::move(stringBlobId));
+    }
+  };
 
   for (const auto &partItem : parts) {
     auto &part = partItem.AsObject();
     auto type = part.at(blobKeys.Type).AsString();
     if (blobKeys.Blob == type) {
       auto &blob = part.at(blobKeys.Data).AsObject();
-      array_view<uint8_t const> bufferPart;
-      try {
-        bufferPart = m_blobPersistor->ResolveMessage(
-            blob.at(blobKeys.BlobId).AsString(), blob.at(blobKeys.Offset).AsInt64(), blob.at(blobKeys.Size).AsInt64());
-      } catch (const std::exception &e) {
-        return m_callbacks.OnError(e.what());
-      }
-
-      buffer.reserve(buffer.size() + bufferPart.size());
-      buffer.insert(buffer.end(), bufferPart.begin(), bufferPart.end());
+      slices.push_back(
+          {blob.at(blobKeys.BlobId).AsString(), blob.at(blobKeys.Offset).AsInt64(), blob.at(blobKeys.Size).AsInt64()});
     } else if ("string" == type) {
       auto data = part.at(blobKeys.Data).AsString();
+      auto size = static_cast<int64_t>(data.size());
+      auto stringBlobId = m_blobPersistor->StoreMessage(vector<uint8_t>(data.begin(), data.end()));
 
-      buffer.reserve(buffer.size() + data.size());
-      buffer.insert(buffer.end(), data.begin(), data.end());
+      slices.push_back({stringBlobId, 0, size});
+      stringBlobIds.push_back(std::move(stringBlobId));
     } else {
+      releaseStringBlobs();
+
       return m_callbacks.OnError("Invalid type for blob: " + type);
     }
   }
 
-  m_blobPersistor->StoreMessage(std::move(buffer), std::move(blobId));
+  try {
+    m_blobPersistor->StoreComposite(std::move(slices), std::move(blobId));
+  } catch (const std::exception &e) {
+    releaseStringBlobs();
+
+    return m_callbacks.OnError(e.what());
+  }
+
+  releaseStringBlobs();
 }
 
 void DefaultBlobResource::Release(string &&blobId) noexcept /*override*/ {
   m_blobPersistor->RemoveMessage(std::move(blobId));
 }
 
+void DefaultBlobResource::ReleaseDeferred(string &&blobId) noexcept /*override*/ {
+  auto node = new PendingRelease{std::move(blobId), m_pendingReleases.load(std::memory_order_relaxed)};
+  while (!m_pendingReleases.compare_exchange_weak(
+      node->Next, node, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+
+  if (!node->Next) {
+    DrainPendingReleasesAsync();
+  }
+}
+
 void DefaultBlobResource::AddNetworkingHandler() noexcept /*override*/ {
   bool handlerAdded = false;
   if (auto prop = m_propertyBag.Get(HttpModuleProxyPropertyId())) {
@@ -195,6 +317,13 @@ void MemoryBlobPersistor::RemoveMessage(string &&blobId) noexcept {
   m_blobs.erase(std::move(blobId));
 }
 
+void MemoryBlobPersistor::RemoveMessages(vector<string> &&blobIds) noexcept {
+  scoped_lock lock{m_mutex};
+
+  for (const auto &blobId : blobIds)
+    m_blobs.erase(blobId);
+}
+
 void MemoryBlobPersistor::StoreMessage(vector<uint8_t> &&message, string &&blobId) noexcept {
   scoped_lock lock{m_mutex};
 
@@ -210,6 +339,22 @@ string MemoryBlobPersistor::StoreMessage(vector<uint8_t> &&message) noexcept {
   return blobId;
 }
 
+size_t MemoryBlobPersistor::BlobCount() noexcept {
+  scoped_lock lock{m_mutex};
+
+  return m_blobs.size();
+}
+
+size_t MemoryBlobPersistor::MemoryUsage() noexcept {
+  scoped_lock lock{m_mutex};
+
+  size_t memoryUsage = 0;
+  for (auto &[blobId, bytes] : m_blobs)
+    memoryUsage += bytes.size();
+
+  return memoryUsage;
+}
+
 #pragma endregion IBlobPersistor
 
 #pragma endregion MemoryBlobPersistor
@@ -274,14 +419,7 @@ bool BlobModuleRequestBodyHandler::Supports(msrn::JSValueObject &data) /*overrid
 msrn::JSValueObject BlobModuleRequestBodyHandler::ToRequestBody(
     msrn::JSValueObject &data,
     string &contentType) /*override*/ {
-  auto type = contentType;
-  auto itr = data.find(blobKeys.Type);
-  if (itr != data.cend() && !(*itr).second.AsString().empty()) {
-    type = (*itr).second.AsString();
-  }
-  if (type.empty()) {
-    type = "application/octet-stream";
-  }
+  auto type = ResolveContentType(data, contentType);
 
   auto &blob = data[blobKeys.Blob].AsObject();
   auto blobId = blob[blobKeys.BlobId].AsString();
@@ -294,6 +432,23 @@ msrn::JSValueObject BlobModuleRequestBodyHandler::ToRequestBody(
       {"bytes", msrn::JSValueArray(bytes.cbegin(), bytes.cend())}};
 }
 
+IInputStream BlobModuleRequestBodyHandler::ToRequestStream(
+    msrn::JSValueObject &data,
+    string &contentType,
+    uint64_t &size) /*override*/ {
+  contentType = ResolveContentType(data, contentType);
+
+  auto &blob = data[blobKeys.Blob].AsObject();
+  auto offset = blob[blobKeys.Offset].AsInt64();
+  auto length = blob[blobKeys.Size].AsInt64();
+  if (offset < 0 || length < 0)
+    throw std::invalid_argument("Offset or size out of range");
+
+  size = static_cast<uint64_t>(length);
+
+  return winrt::make<BlobInputStream>(m_blobPersistor, blob[blobKeys.BlobId].AsString(), offset, size);
+}
+
 #pragma endregion IRequestBodyHandler
 
 #pragma endregion BlobModuleRequestBodyHandler
@@ -17,6 +17,7 @@
 #include <boost/uuid/uuid_generators.hpp>
 
 // Standard Library
+#include <atomic>
 #include <mutex>
 #include <unordered_set>
 
@@ -34,10 +35,16 @@ class MemoryBlobPersistor final : public IBlobPersistor {
 
   void RemoveMessage(std::string &&blobId) noexcept override;
 
+  void RemoveMessages(std::vector<std::string> &&blobIds) noexcept override;
+
   void StoreMessage(std::vector<uint8_t> &&message, std::string &&blobId) noexcept override;
 
   std::string StoreMessage(std::vector<uint8_t> &&message) noexcept override;
 
+  size_t BlobCount() noexcept override;
+
+  size_t MemoryUsage() noexcept override;
+
 #pragma endregion IBlobPersistor
 };
 
@@ -77,6 +84,11 @@ class BlobModuleRequestBodyHandler final : public IRequestBodyHandler {
       winrt::Microsoft::ReactNative::JSValueObject &data,
       std::string &contentType) override;
 
+  winrt::Windows::Storage::Streams::IInputStream ToRequestStream(
+      winrt::Microsoft::ReactNative::JSValueObject &data,
+      std::string &contentType,
+      uint64_t &size) override;
+
 #pragma endregion IRequestBodyHandler
 };
 
@@ -96,21 +108,36 @@ class BlobModuleResponseHandler final : public IResponseHandler {
 };
 
 class DefaultBlobResource : public IBlobResource, public std::enable_shared_from_this<DefaultBlobResource> {
-  std::shared_ptr<MemoryBlobPersistor> m_blobPersistor;
+  std::shared_ptr<IBlobPersistor> m_blobPersistor;
   std::shared_ptr<BlobWebSocketModuleContentHandler> m_contentHandler;
   std::shared_ptr<BlobModuleRequestBodyHandler> m_requestBodyHandler;
   std::shared_ptr<BlobModuleResponseHandler> m_responseHandler;
   winrt::Microsoft::ReactNative::ReactPropertyBag m_propertyBag;
   BlobCallbacks m_callbacks;
 
+  struct PendingRelease {
+    std::string BlobId;
+    PendingRelease *Next;
+  };
+
+  // Stack of the blobs queued by ReleaseDeferred, pushed to without a lock.
+  // Only the thread that pushes to an empty stack schedules a drain, which takes the whole stack at once.
+  std::atomic<PendingRelease *> m_pendingReleases{nullptr};
+
+  winrt::fire_and_forget DrainPendingReleasesAsync() noexcept;
+
+  std::vector<std::string> TakePendingReleases() noexcept;
+
  public:
   DefaultBlobResource(
-      std::shared_ptr<MemoryBlobPersistor> blobPersistor,
+      std::shared_ptr<IBlobPersistor> blobPersistor,
       std::shared_ptr<BlobWebSocketModuleContentHandler> contentHandler,
       std::shared_ptr<BlobModuleRequestBodyHandler> requestBodyHandler,
       std::shared_ptr<BlobModuleResponseHandler> responseHandler,
       winrt::Microsoft::ReactNative::ReactPropertyBag propertyBag);
 
+  ~DefaultBlobResource() noexcept;
+
 #pragma region IBlobResource
 
   void SendOverSocket(std::string &&blobId, int64_t offset, int64_t size, int64_t socketId) noexcept override;
@@ -119,6 +146,8 @@ class DefaultBlobResource : public IBlobResource, public std::enable_shared_from
 
   void Release(std::string &&blobId) noexcept override;
 
+  void ReleaseDeferred(std::string &&blobId) noexcept override;
+
   void AddNetworkingHandler() noexcept override;
 
   void AddWebSocketHandler(int64_t id) noexcept override;
@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HttpRequestScheduler.h"
+
+#include <CppRuntimeOptions.h>
+
+// Standard Library
+#include <algorithm>
+
+using std::scoped_lock;
+using std::string;
+using std::string_view;
+
+namespace Microsoft::React::Networking {
+
+namespace {
+
+constexpr size_t DefaultMaxRunningRequestsPerOrigin = 6;
+
+// Requests to the same scheme, host and port share the connections of the HTTP stack
+string OriginOf(winrt::Windows::Foundation::Uri const &uri) {
+  return winrt::to_string(uri.SchemeName()) + "://" + winrt::to_string(uri.Host()) + ":" + std::to_string(uri.Port());
+}
+
+string_view Trim(string_view value) noexcept {
+  auto begin = value.find_first_not_of(" \t");
+  if (begin == string_view::npos) {
+    return {};
+  }
+  return value.substr(begin, value.find_last_not_of(" \t") - begin + 1);
+}
+
+} // namespace
+
+/*static*/ HttpRequestScheduler &HttpRequestScheduler::Instance() noexcept {
+  // Intentionally leaked, since requests release their slots on background threads, possibly during shutdown
+  static HttpRequestScheduler *s_instance = [] {
+    auto maxRunningRequests = GetRuntimeOptionInt("Http.MaxConcurrentRequestsPerOrigin");
+    return new HttpRequestScheduler(
+        maxRunningRequests > 0 ? static_cast<size_t>(maxRunningRequests) : DefaultMaxRunningRequestsPerOrigin);
+  }();
+  return *s_instance;
+}
+
+/*static*/ HttpRequestPriority HttpRequestScheduler::PriorityFromHeader(string_view value) noexcept {
+  int urgency = 3;
+  // The header is a structured field dictionary, in which the urgency is the "u" member
+  while (!value.empty()) {
+    auto end = value.find(',');
+    auto member = Trim(value.substr(0, end));
+    if (member.size() == 3 && member[0] == 'u' && member[1] == '=' && member[2] >= '0' && member[2] <= '7') {
+      urgency = member[2] - '0';
+    }
+    value = end == string_view::npos ? string_view{} : value.substr(end + 1);
+  }
+
+  if (urgency <= 1) {
+    return HttpRequestPriority::Critical;
+  }
+  if (urgency <= 4) {
+    return HttpRequestPriority::Default;
+  }
+  return urgency <= 6 ? HttpRequestPriority::Image : HttpRequestPriority::Prefetch;
+}
+
+HttpRequestScheduler::HttpRequestScheduler(size_t maxRunningRequestsPerOrigin) noexcept
+    : m_maxRunningRequestsPerOrigin{std::max<size_t>(maxRunningRequestsPerOrigin, 1)} {}
+
+HttpRequestScheduler::RequestId HttpRequestScheduler::Schedule(
+    winrt::Windows::Foundation::Uri const &uri,
+    HttpRequestPriority priority,
+    StartRequest &&startRequest) noexcept {
+  auto origin = OriginOf(uri);
+  RequestId id;
+  {
+    scoped_lock lock{m_mutex};
+    id = m_nextRequestId++;
+    m_origins[origin].Queue.push_back({id, priority, std::move(startRequest)});
+  }
+  StartRequests(origin);
+  return id;
+}
+
+bool HttpRequestScheduler::Cancel(RequestId request) noexcept {
+  StartRequest droppedRequest;
+  {
+    scoped_lock lock{m_mutex};
+    for (auto &[origin, state] : m_origins) {
+      auto it = std::find_if(state.Queue.begin(), state.Queue.end(), [request](QueuedRequest const &queued) {
+        return queued.Id == request;
+      });
+      if (it != state.Queue.end()) {
+        droppedRequest = std::move(it->Start);
+        state.Queue.erase(it);
+        break;
+      }
+    }
+  }
+  // Released outside of the lock, since it might hold the last reference to the resource of the request
+  return droppedRequest != nullptr;
+}
+
+void HttpRequestScheduler::StartRequests(string const &origin) noexcept {
+  std::vector<std::pair<StartRequest, Slot>> requestsToStart;
+  {
+    scoped_lock lock{m_mutex};
+    auto originIt = m_origins.find(origin);
+    if (originIt == m_origins.end()) {
+      return;
+    }
+
+    auto &state = originIt->second;
+    while (!state.Queue.empty()) {
+      // The first of the most urgent requests
+      auto next = std::min_element(
+          state.Queue.begin(), state.Queue.end(), [](QueuedRequest const &left, QueuedRequest const &right) {
+            return left.Priority < right.Priority;
+          });
+
+      // Less urgent requests have lower limits, so none of them fits once the most urgent one does not
+      auto limit = next->Priority >= HttpRequestPriority::Image && m_maxRunningRequestsPerOrigin > 1
+          ? m_maxRunningRequestsPerOrigin - 1
+          : m_maxRunningRequestsPerOrigin;
+      if (next->Priority != HttpRequestPriority::Critical && state.RunningRequests >= limit) {
+        break;
+      }
+
+      state.RunningRequests++;
+      requestsToStart.emplace_back(
+          std::move(next->Start), Slot{nullptr, [this, origin](void *) { ReleaseSlot(origin); }});
+      state.Queue.erase(next);
+    }
+
+    if (state.RunningRequests == 0 && state.Queue.empty()) {
+      m_origins.erase(originIt);
+    }
+  }
+
+  for (auto &[startRequest, slot] : requestsToStart) {
+    startRequest(std::move(slot));
+  }
+}
+
+void HttpRequestScheduler::ReleaseSlot(string const &origin) noexcept {
+  {
+    scoped_lock lock{m_mutex};
+    m_origins[origin].RunningRequests--;
+  }
+  StartRequests(origin);
+}
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Windows API
+#include <winrt/Windows.Foundation.h>
+
+// Standard Library
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+// Most urgent first
+enum class HttpRequestPriority {
+  Critical,
+  Default,
+  Image,
+  Prefetch,
+};
+
+/// <summary>
+/// Queues HTTP requests per origin, so that requests of lower priority do not hold up the more urgent ones.
+/// </summary>
+/// <remarks>
+/// At most a fixed number of requests run at once for each origin, set with the "Http.MaxConcurrentRequestsPerOrigin"
+/// runtime option. Whenever one finishes, the most urgent queued request of its origin starts, in the order they were
+/// scheduled within a priority.
+/// Critical requests start right away, even when their origin is at its limit.
+/// Image and prefetch requests leave one request of the limit to the more urgent ones, so that a burst of images does
+/// not take every connection to the origin.
+/// </remarks>
+class HttpRequestScheduler final {
+ public:
+  using RequestId = uint64_t;
+  // Held by a running request, the next queued request of its origin starts once every copy of it is released
+  using Slot = std::shared_ptr<void>;
+  using StartRequest = std::function<void(Slot slot)>;
+
+  static HttpRequestScheduler &Instance() noexcept;
+
+  /// <summary>
+  /// Maps the urgency of an RFC 9218 Priority request header, like "u=1, i", to a priority.
+  /// </summary>
+  /// <remarks>
+  /// Urgencies 0 and 1 are critical, 2 to 4 are the default, 5 and 6 are images, and 7 is prefetch.
+  /// Values without an urgency, including empty ones, have the default urgency of 3.
+  /// </remarks>
+  static HttpRequestPriority PriorityFromHeader(std::string_view value) noexcept;
+
+  HttpRequestScheduler(size_t maxRunningRequestsPerOrigin) noexcept;
+
+  /// <summary>
+  /// Queues a request to the origin of a URI.
+  /// </summary>
+  /// <remarks>
+  /// A request that can start is started before this returns, others on the thread that releases the slot they wait
+  /// for. Either way startRequest is called without the lock of the scheduler, and must not block.
+  /// </remarks>
+  RequestId Schedule(
+      winrt::Windows::Foundation::Uri const &uri,
+      HttpRequestPriority priority,
+      StartRequest &&startRequest) noexcept;
+
+  /// <summary>
+  /// Drops the request if it has not started yet.
+  /// </summary>
+  /// <returns>
+  /// Whether the request was still queued.
+  /// </returns>
+  bool Cancel(RequestId request) noexcept;
+
+ private:
+  struct QueuedRequest {
+    RequestId Id;
+    HttpRequestPriority Priority;
+    StartRequest Start;
+  };
+
+  struct Origin {
+    size_t RunningRequests{0};
+    std::vector<QueuedRequest> Queue;
+  };
+
+  // Starts the requests of the origin that fit in its limit, and removes the origin once it is idle
+  void StartRequests(std::string const &origin) noexcept;
+
+  void ReleaseSlot(std::string const &origin) noexcept;
+
+  std::mutex m_mutex;
+  std::unordered_map<std::string, Origin> m_origins;
+  RequestId m_nextRequestId{1};
+  const size_t m_maxRunningRequestsPerOrigin;
+};
+
+} // namespace Microsoft::React::Networking
@@ -44,6 +44,12 @@ struct IBlobResource {
 
   virtual void Release(std::string &&blobId) noexcept = 0;
 
+  ///
+  /// Queues the release of a blob without blocking, so that it can be called from JS finalizers.
+  /// The queued blobs are removed in batches on a background thread.
+  ///
+  virtual void ReleaseDeferred(std::string &&blobId) noexcept = 0;
+
   virtual void AddNetworkingHandler() noexcept = 0;
 
   virtual void AddWebSocketHandler(int64_t id) noexcept = 0;
@@ -8,6 +8,7 @@
 
 // Windows API
 #include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Storage.Streams.h>
 
 // Standard Library
 #include <functional>
@@ -53,6 +54,8 @@ struct IHttpResource {
   /// </param>
   /// <param name="headers">
   /// HTTP request header map.
+  /// The urgency of an RFC 9218 "Priority" header, like "u=0" for critical or "u=7" for prefetch requests, sets the
+  /// priority of the request among the queued requests to its origin.
   /// </param>
   /// <param name="data">
   /// Dynamic map containing request payload.
@@ -63,7 +66,9 @@ struct IHttpResource {
   /// "form"    - Form-encoded data
   /// </param>
   /// <param name="responseType">
-  /// text | binary | blob
+  /// text | binary | blob | arraybuffer | json
+  /// "arraybuffer" with incremental updates streams the response body as binary chunks.
+  /// "json" parses the text response body off the JS thread, and reports it to the handler set by `SetOnJsonData`.
   /// </param>
   /// <param name="useIncrementalUpdates">
   /// Response body to be retrieved in several iterations.
@@ -88,8 +93,33 @@ struct IHttpResource {
       std::function<void(int64_t)> &&callback) noexcept = 0;
   virtual void AbortRequest(int64_t requestId) noexcept = 0;
 
+  /// <summary>
+  /// Reports that the consumer has processed streamed response chunks.
+  /// </summary>
+  /// <remarks>
+  /// Streamed requests stop reading the response while too many delivered bytes are not acknowledged.
+  /// </remarks>
+  /// <param name="requestId">
+  /// Request unique identifier.
+  /// </param>
+  /// <param name="byteCount">
+  /// Number of consumed bytes.
+  /// </param>
+  virtual void AcknowledgeIncrementalData(int64_t requestId, int64_t byteCount) noexcept = 0;
+
   virtual void ClearCookies() noexcept = 0;
 
+  /// <summary>
+  /// Prepares the first request to the origin of a URL.
+  /// </summary>
+  /// <remarks>
+  /// The WinHTTP transport opens a connection to the origin. The default transport can only resolve its host name.
+  /// </remarks>
+  /// <param name="url">
+  /// Server/service remote endpoint that requests will be sent to.
+  /// </param>
+  virtual void Preconnect(std::string &&url) noexcept = 0;
+
   /// <summary>
   /// Sets a function to be invoked when a request has been successfully responded.
   /// </summary>
@@ -149,6 +179,26 @@ struct IHttpResource {
       std::function<void(int64_t requestId, winrt::Microsoft::ReactNative::JSValueObject &&responseData)>
           &&handler) noexcept = 0;
 
+  /// <summary>
+  /// Sets a function to be invoked when the response content of a "json" request has been received and parsed.
+  /// </summary>
+  /// <remarks>
+  /// If the content is not valid JSON, it is reported as text to the handler set by `SetOnData` instead.
+  /// </remarks>
+  /// <param name="handler">
+  ///
+  /// Parameters:
+  ///   <param name="requestId">
+  ///   Unique number identifying the HTTP request
+  ///   </param>
+  ///   <param name="responseData">
+  ///   Parsed response content payload
+  ///   </param>
+  /// </param>
+  virtual void SetOnJsonData(
+      std::function<void(int64_t requestId, winrt::Microsoft::ReactNative::JSValue &&responseData)>
+          &&handler) noexcept = 0;
+
   /// <summary>
   /// Sets a function to be invoked when a response content increment has been received.
   /// </summary>
@@ -177,6 +227,36 @@ struct IHttpResource {
       std::function<void(int64_t requestId, std::string &&responseData, int64_t progress, int64_t total)>
           &&handler) noexcept = 0;
 
+  /// <summary>
+  /// Sets a function to be invoked when a binary response content chunk has been received.
+  /// </summary>
+  /// <remarks>
+  /// The handler set by this method will only be called if the request sets the incremental updates flag and the
+  /// "arraybuffer" response type. The consumer must report processed chunks with `AcknowledgeIncrementalData`.
+  /// </remarks>
+  /// <param name="handler">
+  ///
+  /// Parameters:
+  ///   <param name="requestId">
+  ///   Unique number identifying the HTTP request
+  ///   </param>
+  ///   <param name="responseData">
+  ///   Response content chunk (non-accumulative)
+  ///   </param>
+  ///   <param name="progress">
+  ///   Number of bytes received so far
+  ///   </param>
+  ///   <param name="total">
+  ///   Number of total bytes to receive, or 0 if unknown
+  ///   </param>
+  /// </param>
+  virtual void SetOnIncrementalBinaryData(
+      std::function<void(
+          int64_t requestId,
+          winrt::Windows::Storage::Streams::IBuffer &&responseData,
+          int64_t progress,
+          int64_t total)> &&handler) noexcept = 0;
+
   /// <summary>
   /// Sets a function to be invoked when response content download progress is reported.
   /// </summary>
@@ -196,6 +276,25 @@ struct IHttpResource {
   virtual void SetOnDataProgress(
       std::function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept = 0;
 
+  /// <summary>
+  /// Sets a function to be invoked when request content upload progress is reported.
+  /// </summary>
+  /// <param name="handler">
+  ///
+  /// Parameters:
+  ///   <param name="requestId">
+  ///   Unique number identifying the HTTP request
+  ///   </param>
+  ///   <param name="progress">
+  ///   Number of bytes sent so far
+  ///   </param>
+  ///   <param name="total">
+  ///   Number of total bytes to send
+  ///   </param>
+  /// </param>
+  virtual void SetOnDataSent(
+      std::function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept = 0;
+
   /// <summary>
   /// Sets a function to be invoked when a response has been fully handled (either succeeded or failed).
   /// </summary>
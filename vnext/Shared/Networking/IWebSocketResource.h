@@ -121,6 +121,14 @@ struct IWebSocketResource {
   /// </param>
   virtual void SendBinary(std::string &&base64String) noexcept = 0;
 
+  /// <summary>
+  /// Sends a non-plain-text message to the remote endpoint.
+  /// </summary>
+  /// <param name="message">
+  /// Raw binary message.
+  /// </param>
+  virtual void SendBinary(std::vector<uint8_t> &&message) noexcept = 0;
+
   /// <summary>
   /// Terminates this resource's connection to the remote endpoint.
   /// This instance can't be restarted or re-connected afterwards.
@@ -136,6 +144,11 @@ struct IWebSocketResource {
   /// </returns>
   virtual ReadyState GetReadyState() const noexcept = 0;
 
+  /// <returns>
+  /// Number of bytes queued by <c>Send</c> and <c>SendBinary</c> but not yet transmitted.
+  /// </returns>
+  virtual std::size_t GetBufferedAmount() const noexcept = 0;
+
   /// <summary>
   /// Sets the optional custom behavior on a successful connection.
   /// </summary>
@@ -167,6 +180,16 @@ struct IWebSocketResource {
   virtual void SetOnMessage(
       std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept = 0;
 
+  /// <summary>
+  /// Sets the optional custom behavior to run when there is an incoming
+  /// binary message.
+  /// If set, binary messages are passed as raw bytes to this handler instead
+  /// of Base64-encoded to the <c>SetOnMessage</c> handler.
+  /// </summary>
+  /// <param name="handler">
+  /// </param>
+  virtual void SetOnBinaryMessage(std::function<void(std::vector<uint8_t> &&)> &&handler) noexcept = 0;
+
   /// <summary>
   /// Sets the optional custom behavior to run when this instance is closed.
   /// </summary>
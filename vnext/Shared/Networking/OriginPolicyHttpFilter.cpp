@@ -14,8 +14,10 @@
 #include <boost/lexical_cast/try_lexical_convert.hpp>
 
 // Standard Library
+#include <algorithm>
 #include <queue>
 #include <regex>
+#include <vector>
 
 using std::set;
 using std::string;
@@ -36,6 +38,17 @@ using winrt::Windows::Web::Http::Filters::IHttpFilter;
 using winrt::Windows::Web::Http::Headers::HttpMediaTypeHeaderValue;
 using winrt::Windows::Web::Http::Headers::HttpRequestHeaderCollection;
 
+namespace {
+
+// Default and upper bound of Access-Control-Max-Age in seconds, see https://fetch.spec.whatwg.org/#http-responses
+constexpr int32_t defaultPreflightMaxAge = 5;
+constexpr int32_t maxPreflightMaxAge = 7200;
+
+// Expired entries are dropped once the preflight cache grows past this size
+constexpr size_t maxPreflightCacheEntries = 256;
+
+} // namespace
+
 namespace Microsoft::React::Networking {
 
 #pragma region OriginPolicyHttpFilter
@@ -386,6 +399,70 @@ bool OriginPolicyHttpFilter::CaseInsensitiveComparer::operator()(const wstring &
   }
 }
 
+/*static*/ wstring OriginPolicyHttpFilter::GetPreflightCacheKey(HttpRequestMessage const &request) {
+  std::vector<wstring> headerNames;
+  for (const auto &header : request.Headers()) {
+    headerNames.emplace_back(boost::to_lower_copy(wstring{header.Key()}));
+  }
+  if (request.Content()) {
+    for (const auto &header : request.Content().Headers()) {
+      headerNames.emplace_back(boost::to_lower_copy(wstring{header.Key()}));
+    }
+  }
+  std::sort(headerNames.begin(), headerNames.end());
+
+  bool withCredentials = false;
+  if (auto iReqArgs = request.Properties().TryLookup(L"RequestArgs")) {
+    withCredentials = iReqArgs.as<RequestArgs>()->WithCredentials;
+  }
+
+  auto key = wstring{request.RequestUri().AbsoluteCanonicalUri()} + L'\n' + request.Method().ToString().c_str() +
+      L'\n' + (withCredentials ? L"include" : L"omit");
+  for (const auto &name : headerNames) {
+    key += L'\n' + name;
+  }
+
+  return key;
+}
+
+bool OriginPolicyHttpFilter::HasPreflightCacheEntry(wstring const &key) noexcept {
+  std::scoped_lock lock{m_preflightCacheMutex};
+  auto iter = m_preflightCache.find(key);
+  if (iter == m_preflightCache.end()) {
+    return false;
+  }
+
+  if (iter->second <= std::chrono::steady_clock::now()) {
+    m_preflightCache.erase(iter);
+    return false;
+  }
+
+  return true;
+}
+
+void OriginPolicyHttpFilter::AddPreflightCacheEntry(wstring &&key, HttpResponseMessage const &response) {
+  auto maxAge = defaultPreflightMaxAge;
+  if (auto value = response.Headers().TryLookup(L"Access-Control-Max-Age")) {
+    maxAge = (std::min)(_wtoi(value->c_str()), maxPreflightMaxAge);
+  }
+  if (maxAge <= 0) {
+    return;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  std::scoped_lock lock{m_preflightCacheMutex};
+  if (m_preflightCache.size() >= maxPreflightCacheEntries) {
+    for (auto iter = m_preflightCache.begin(); iter != m_preflightCache.end();) {
+      iter = iter->second <= now ? m_preflightCache.erase(iter) : std::next(iter);
+    }
+    if (m_preflightCache.size() >= maxPreflightCacheEntries) {
+      m_preflightCache.clear();
+    }
+  }
+
+  m_preflightCache[std::move(key)] = now + std::chrono::seconds{maxAge};
+}
+
 OriginPolicyHttpFilter::OriginPolicyHttpFilter(string &&origin, IHttpFilter const &innerFilter)
     : m_origin{nullptr}, m_innerFilter{innerFilter} {
   if (!origin.empty())
@@ -587,8 +664,6 @@ void OriginPolicyHttpFilter::ValidatePreflightResponse(
                 L"] is not allowed by Access-Control-Allow-Headers in preflight response"};
     }
   }
-
-  // #9770 - insert into preflight cache
 }
 
 // See 10.7.4 of https://fetch.spec.whatwg.org/#http-network-or-cache-fetch
@@ -736,6 +811,7 @@ bool OriginPolicyHttpFilter::OnRedirecting(
 
 ResponseOperation OriginPolicyHttpFilter::SendRequestAsync(HttpRequestMessage const &request) {
   auto coRequest = request;
+  auto progress = co_await winrt::get_progress_token();
 
   // Set initial origin policy to global runtime option.
   request.Properties().Insert(L"OriginPolicy", winrt::box_value(GetRuntimeOptionInt("Http.OriginPolicy")));
@@ -761,8 +837,13 @@ ResponseOperation OriginPolicyHttpFilter::SendRequestAsync(HttpRequestMessage co
   }
 
   try {
-    // #9770 - Validate preflight cache
+    // Skip the preflight while a previous one for the same request shape is cached.
+    wstring preflightCacheKey;
     if (originPolicy == OriginPolicy::CrossOriginResourceSharing) {
+      preflightCacheKey = GetPreflightCacheKey(coRequest);
+    }
+
+    if (originPolicy == OriginPolicy::CrossOriginResourceSharing && !HasPreflightCacheEntry(preflightCacheKey)) {
       // If inner filter can AllowRedirect, disable for preflight.
       winrt::impl::com_ref<IHttpBaseProtocolFilter> baseFilter;
       baseFilter = m_innerFilter.try_as<IHttpBaseProtocolFilter>();
@@ -777,6 +858,7 @@ ResponseOperation OriginPolicyHttpFilter::SendRequestAsync(HttpRequestMessage co
       }
 
       ValidatePreflightResponse(coRequest, preflightResponse);
+      AddPreflightCacheEntry(std::move(preflightCacheKey), preflightResponse);
     }
 
     if (originPolicy == OriginPolicy::SimpleCrossOriginResourceSharing ||
@@ -784,7 +866,7 @@ ResponseOperation OriginPolicyHttpFilter::SendRequestAsync(HttpRequestMessage co
       coRequest.Headers().Insert(L"Origin", GetOrigin(m_origin));
     }
 
-    auto response = co_await m_innerFilter.SendRequestAsync(coRequest);
+    auto response = co_await ForwardProgress(m_innerFilter.SendRequestAsync(coRequest), progress);
 
     ValidateResponse(response, originPolicy);
 
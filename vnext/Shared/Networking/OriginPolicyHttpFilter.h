@@ -14,7 +14,10 @@
 #include <winrt/Windows.Web.Http.h>
 
 // Standard Library
+#include <chrono>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 
 namespace Microsoft::React::Networking {
 
@@ -50,6 +53,14 @@ class OriginPolicyHttpFilter
 
   winrt::Windows::Web::Http::Filters::IHttpFilter m_innerFilter;
 
+  // Expiration of successful preflights, see https://fetch.spec.whatwg.org/#cors-preflight-cache
+  std::mutex m_preflightCacheMutex;
+  std::unordered_map<std::wstring, std::chrono::steady_clock::time_point> m_preflightCache;
+
+  bool HasPreflightCacheEntry(std::wstring const &key) noexcept;
+
+  void AddPreflightCacheEntry(std::wstring &&key, winrt::Windows::Web::Http::HttpResponseMessage const &response);
+
  public:
   static bool IsSameOrigin(
       winrt::Windows::Foundation::Uri const &u1,
@@ -72,6 +83,9 @@ class OriginPolicyHttpFilter
 
   static bool IsCorsUnsafeRequestHeaderByte(wchar_t c) noexcept;
 
+  // Identifies the preflight by URL, method, credentials mode and request header names
+  static std::wstring GetPreflightCacheKey(winrt::Windows::Web::Http::HttpRequestMessage const &request);
+
   // Filter out Http-Only cookies from response headers to prevent malicious code from being sent to a malicious server
   static void RemoveHttpOnlyCookiesFromResponseHeaders(
       winrt::Windows::Web::Http::HttpResponseMessage const &response,
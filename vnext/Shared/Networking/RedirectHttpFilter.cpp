@@ -219,6 +219,7 @@ ResponseOperation RedirectHttpFilter::SendRequestAsync(HttpRequestMessage const
   auto coMaxRedirects = m_maximumRedirects;
   auto coRequestFactory = m_requestFactory;
   auto coEventSrc = m_redirEventSrc;
+  auto progress = co_await winrt::get_progress_token();
 
   method = coRequest.Method();
 
@@ -230,8 +231,8 @@ ResponseOperation RedirectHttpFilter::SendRequestAsync(HttpRequestMessage const
     }
 
     // Send subsequent requests through the filter that doesn't have the credentials included in the first request
-    response =
-        co_await (redirectCount > 0 ? m_innerFilterWithNoCredentials : m_innerFilter).SendRequestAsync(coRequest);
+    response = co_await ForwardProgress(
+        (redirectCount > 0 ? m_innerFilterWithNoCredentials : m_innerFilter).SendRequestAsync(coRequest), progress);
 
     // Stop redirecting when a non-redirect status is responded.
     if (response.StatusCode() != HttpStatusCode::MultipleChoices &&
@@ -0,0 +1,380 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "SpillingBlobPersistor.h"
+
+// Boost Libraries
+#include <boost/uuid/uuid_io.hpp>
+
+// Windows API
+#include <windows.h>
+
+// Standard Library
+#include <algorithm>
+
+using std::scoped_lock;
+using std::shared_ptr;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using winrt::array_view;
+
+namespace {
+
+// WriteFile takes a 32-bit length
+constexpr size_t maxWriteLength = 1024 * 1024 * 1024;
+
+} // namespace
+
+namespace Microsoft::React::Networking {
+
+struct SpillingBlobPersistor::SpilledBlob {
+  winrt::file_handle File;
+  winrt::handle Mapping;
+  void *View{nullptr};
+  size_t Size{0};
+
+  ~SpilledBlob() noexcept {
+    if (View) {
+      UnmapViewOfFile(View);
+    }
+  }
+};
+
+bool SpillingBlobPersistor::Chunk::IsInMemory() const noexcept {
+  return !Spilled && !Bytes.empty();
+}
+
+const uint8_t *SpillingBlobPersistor::Chunk::Data() const noexcept {
+  return Spilled ? static_cast<const uint8_t *>(Spilled->View) : Bytes.data();
+}
+
+size_t SpillingBlobPersistor::Chunk::Size() const noexcept {
+  return Spilled ? Spilled->Size : Bytes.size();
+}
+
+SpillingBlobPersistor::SpillingBlobPersistor(size_t spillThreshold, size_t memoryBudget) noexcept
+    : m_spillThreshold{spillThreshold}, m_memoryBudget{memoryBudget} {
+  wchar_t tempPath[MAX_PATH];
+  if (GetTempPathW(static_cast<DWORD>(std::size(tempPath)), tempPath)) {
+    m_directory = tempPath;
+  }
+}
+
+SpillingBlobPersistor::~SpillingBlobPersistor() noexcept = default;
+
+unique_ptr<SpillingBlobPersistor::SpilledBlob> SpillingBlobPersistor::Spill(vector<uint8_t> const &bytes) noexcept {
+  // Empty files cannot be mapped.
+  if (bytes.empty() || m_directory.empty())
+    return nullptr;
+
+  auto path = m_directory + L"ReactNativeBlob-" + std::to_wstring(GetCurrentProcessId()) + L"-" +
+      std::to_wstring(++m_fileCount) + L".tmp";
+
+  // The file is deleted as soon as its last handle closes, including on process termination.
+  CREATEFILE2_EXTENDED_PARAMETERS params{};
+  params.dwSize = sizeof(params);
+  params.dwFileAttributes = FILE_ATTRIBUTE_TEMPORARY;
+  params.dwFileFlags = FILE_FLAG_DELETE_ON_CLOSE;
+
+  auto spilled = std::make_unique<SpilledBlob>();
+  spilled->File.attach(CreateFile2(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, CREATE_NEW, &params));
+  if (!spilled->File)
+    return nullptr;
+
+  size_t written = 0;
+  while (written < bytes.size()) {
+    DWORD length = static_cast<DWORD>((std::min)(bytes.size() - written, maxWriteLength));
+    DWORD lengthWritten = 0;
+    if (!WriteFile(spilled->File.get(), bytes.data() + written, length, &lengthWritten, nullptr /*overlapped*/))
+      return nullptr;
+
+    written += lengthWritten;
+  }
+
+  spilled->Mapping.attach(CreateFileMappingFromApp(
+      spilled->File.get(),
+      nullptr /*SecurityAttributes*/,
+      PAGE_READONLY,
+      static_cast<ULONG64>(bytes.size()),
+      nullptr /*Name*/));
+  if (!spilled->Mapping)
+    return nullptr;
+
+  spilled->View = MapViewOfFileFromApp(spilled->Mapping.get(), FILE_MAP_READ, 0 /*FileOffset*/, 0 /*NumberOfBytes*/);
+  if (!spilled->View)
+    return nullptr;
+
+  spilled->Size = bytes.size();
+
+  return spilled;
+}
+
+shared_ptr<SpillingBlobPersistor::Chunk> SpillingBlobPersistor::AddChunkLocked(
+    vector<uint8_t> &&bytes,
+    unique_ptr<SpilledBlob> &&spilled) noexcept {
+  auto chunk = std::make_shared<Chunk>();
+  if (spilled) {
+    chunk->Spilled = std::move(spilled);
+  } else {
+    chunk->Bytes = std::move(bytes);
+  }
+
+  if (chunk->IsInMemory()) {
+    m_memoryChunks.push_front(chunk.get());
+    chunk->MemoryPosition = m_memoryChunks.begin();
+    m_memoryUsage += chunk->Size();
+  }
+
+  return chunk;
+}
+
+void SpillingBlobPersistor::StoreLocked(string &&blobId, vector<Segment> &&segments) noexcept {
+  EraseLocked(blobId);
+  m_blobs.emplace(std::move(blobId), std::move(segments));
+
+  EnforceBudgetLocked();
+}
+
+void SpillingBlobPersistor::ReleaseLocked(vector<Segment> &segments) noexcept {
+  for (auto &segment : segments) {
+    // All references to chunks are held by m_blobs, so this is the last one.
+    if (segment.Source.use_count() == 1 && segment.Source->IsInMemory()) {
+      m_memoryChunks.erase(segment.Source->MemoryPosition);
+      m_memoryUsage -= segment.Source->Size();
+    }
+
+    segment.Source.reset();
+  }
+
+  segments.clear();
+}
+
+void SpillingBlobPersistor::EraseLocked(string const &blobId) noexcept {
+  auto blobItr = m_blobs.find(blobId);
+  if (blobItr == m_blobs.end())
+    return;
+
+  ReleaseLocked((*blobItr).second);
+  m_blobs.erase(blobItr);
+}
+
+void SpillingBlobPersistor::TouchLocked(Chunk &chunk) noexcept {
+  if (chunk.IsInMemory()) {
+    m_memoryChunks.splice(m_memoryChunks.begin(), m_memoryChunks, chunk.MemoryPosition);
+  }
+}
+
+void SpillingBlobPersistor::EnforceBudgetLocked() noexcept {
+  while (m_memoryUsage > m_memoryBudget && !m_memoryChunks.empty()) {
+    auto &chunk = *m_memoryChunks.back();
+
+    auto spilled = Spill(chunk.Bytes);
+    // Disk is not available. Keep the remaining chunks in memory.
+    if (!spilled)
+      return;
+
+    m_memoryUsage -= chunk.Bytes.size();
+    vector<uint8_t>{}.swap(chunk.Bytes);
+    chunk.Spilled = std::move(spilled);
+    m_memoryChunks.pop_back();
+  }
+}
+
+#pragma region IBlobPersistor
+
+array_view<uint8_t const> SpillingBlobPersistor::ResolveMessage(string &&blobId, int64_t offset, int64_t size) {
+  if (size < 1)
+    return {};
+
+  scoped_lock lock{m_mutex};
+
+  auto blobItr = m_blobs.find(blobId);
+  // Not found.
+  if (blobItr == m_blobs.cend())
+    throw std::invalid_argument("Blob object not found");
+
+  auto &segments = (*blobItr).second;
+  size_t length = 0;
+  for (const auto &segment : segments) {
+    length += segment.Size;
+  }
+
+  auto endBound = static_cast<size_t>(offset + size);
+  // Out of bounds.
+  if (endBound > length || offset >= static_cast<int64_t>(length) || offset < 0)
+    throw std::out_of_range("Offset or size out of range");
+
+  // Ranges within a single segment are resolved in place.
+  auto begin = static_cast<size_t>(offset);
+  size_t segmentStart = 0;
+  for (const auto &segment : segments) {
+    if (begin >= segmentStart && endBound <= segmentStart + segment.Size) {
+      TouchLocked(*segment.Source);
+      auto data = segment.Source->Data() + segment.Offset + (begin - segmentStart);
+
+      return array_view<uint8_t const>(data, data + size);
+    }
+
+    segmentStart += segment.Size;
+  }
+
+  // The range spans several segments. Join the whole blob once, so later reads are resolved in place.
+  vector<uint8_t> bytes;
+  bytes.reserve(length);
+  for (const auto &segment : segments) {
+    auto data = segment.Source->Data() + segment.Offset;
+    bytes.insert(bytes.end(), data, data + segment.Size);
+  }
+
+  unique_ptr<SpilledBlob> spilled;
+  if (length >= m_spillThreshold)
+    spilled = Spill(bytes);
+
+  auto chunk = AddChunkLocked(std::move(bytes), std::move(spilled));
+  ReleaseLocked(segments);
+  segments.push_back({chunk, 0, length});
+
+  EnforceBudgetLocked();
+
+  return array_view<uint8_t const>(chunk->Data() + begin, chunk->Data() + endBound);
+}
+
+void SpillingBlobPersistor::RemoveMessage(string &&blobId) noexcept {
+  scoped_lock lock{m_mutex};
+
+  EraseLocked(blobId);
+}
+
+void SpillingBlobPersistor::RemoveMessages(vector<string> &&blobIds) noexcept {
+  scoped_lock lock{m_mutex};
+
+  for (const auto &blobId : blobIds)
+    EraseLocked(blobId);
+}
+
+void SpillingBlobPersistor::StoreMessage(vector<uint8_t> &&message, string &&blobId) noexcept {
+  // Write large blobs before taking the lock, so that resolving other blobs does not wait on the disk.
+  unique_ptr<SpilledBlob> spilled;
+  if (message.size() >= m_spillThreshold)
+    spilled = Spill(message);
+
+  scoped_lock lock{m_mutex};
+
+  vector<Segment> segments;
+  auto chunk = AddChunkLocked(std::move(message), std::move(spilled));
+  if (auto size = chunk->Size()) {
+    segments.push_back({std::move(chunk), 0, size});
+  }
+
+  StoreLocked(std::move(blobId), std::move(segments));
+}
+
+string SpillingBlobPersistor::StoreMessage(vector<uint8_t> &&message) noexcept {
+  auto blobId = boost::uuids::to_string(m_guidGenerator());
+
+  StoreMessage(std::move(message), string{blobId});
+
+  return blobId;
+}
+
+void SpillingBlobPersistor::StoreComposite(vector<BlobSlice> &&slices, string &&blobId) /*override*/ {
+  scoped_lock lock{m_mutex};
+
+  // Map each slice onto the segments of its source blob, sharing their chunks.
+  vector<Segment> segments;
+  for (const auto &slice : slices) {
+    if (slice.Size < 1)
+      continue;
+
+    auto sourceItr = m_blobs.find(slice.BlobId);
+    // Not found.
+    if (sourceItr == m_blobs.cend())
+      throw std::invalid_argument("Blob object not found");
+
+    auto &sourceSegments = (*sourceItr).second;
+    size_t length = 0;
+    for (const auto &segment : sourceSegments) {
+      length += segment.Size;
+    }
+
+    auto sliceEnd = static_cast<size_t>(slice.Offset + slice.Size);
+    // Out of bounds.
+    if (sliceEnd > length || slice.Offset >= static_cast<int64_t>(length) || slice.Offset < 0)
+      throw std::out_of_range("Offset or size out of range");
+
+    auto sliceBegin = static_cast<size_t>(slice.Offset);
+    size_t segmentStart = 0;
+    for (const auto &segment : sourceSegments) {
+      auto segmentEnd = segmentStart + segment.Size;
+      auto begin = (std::max)(sliceBegin, segmentStart);
+      auto end = (std::min)(sliceEnd, segmentEnd);
+      if (begin < end) {
+        segments.push_back({segment.Source, segment.Offset + (begin - segmentStart), end - begin});
+      }
+
+      segmentStart = segmentEnd;
+    }
+  }
+
+  StoreLocked(std::move(blobId), std::move(segments));
+}
+
+void SpillingBlobPersistor::CopyMessage(
+    string &&blobId,
+    int64_t offset,
+    array_view<uint8_t> destination) /*override*/ {
+  if (destination.empty())
+    return;
+
+  scoped_lock lock{m_mutex};
+
+  auto blobItr = m_blobs.find(blobId);
+  // Not found.
+  if (blobItr == m_blobs.cend())
+    throw std::invalid_argument("Blob object not found");
+
+  auto &segments = (*blobItr).second;
+  size_t length = 0;
+  for (const auto &segment : segments) {
+    length += segment.Size;
+  }
+
+  auto endBound = static_cast<size_t>(offset) + destination.size();
+  // Out of bounds.
+  if (endBound > length || offset >= static_cast<int64_t>(length) || offset < 0)
+    throw std::out_of_range("Offset or size out of range");
+
+  // Copy segment by segment while holding the lock, so neither joining nor spilling can move the source bytes.
+  auto begin = static_cast<size_t>(offset);
+  auto target = destination.begin();
+  size_t segmentStart = 0;
+  for (const auto &segment : segments) {
+    auto segmentEnd = segmentStart + segment.Size;
+    auto copyBegin = (std::max)(begin, segmentStart);
+    auto copyEnd = (std::min)(endBound, segmentEnd);
+    if (copyBegin < copyEnd) {
+      TouchLocked(*segment.Source);
+      auto data = segment.Source->Data() + segment.Offset + (copyBegin - segmentStart);
+      target = std::copy(data, data + (copyEnd - copyBegin), target);
+    }
+
+    segmentStart = segmentEnd;
+  }
+}
+
+size_t SpillingBlobPersistor::BlobCount() noexcept {
+  scoped_lock lock{m_mutex};
+
+  return m_blobs.size();
+}
+
+size_t SpillingBlobPersistor::MemoryUsage() noexcept {
+  scoped_lock lock{m_mutex};
+
+  return m_memoryUsage;
+}
+
+#pragma endregion IBlobPersistor
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <IBlobPersistor.h>
+
+// Boost Libraries
+#include <boost/uuid/uuid_generators.hpp>
+
+// Standard Library
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Microsoft::React::Networking {
+
+/// <summary>
+/// Blob persistor that keeps small blobs in memory and spills large ones to memory-mapped temporary files.
+/// </summary>
+/// <remarks>
+/// Blobs at or above the spill threshold are written to disk when stored.
+/// When the in-memory blobs exceed the memory budget, the least recently resolved ones are spilled to disk as well.
+/// Temporary files are deleted when their last blob is removed or the persistor is destroyed.
+/// If a blob cannot be written to disk, it stays in memory.
+///
+/// Blobs are lists of segments over immutable chunks shared between blobs, so composite blobs copy nothing.
+/// A composite blob is joined into one contiguous chunk the first time a range spanning several segments is
+/// resolved.
+///
+/// Spilling and joining only happen while storing or resolving, so a view returned by ResolveMessage stays valid
+/// until the next call that stores or resolves a blob.
+/// </remarks>
+class SpillingBlobPersistor final : public IBlobPersistor {
+  // Temporary file and its read-only mapped view
+  struct SpilledBlob;
+
+  // Immutable bytes, shared by every blob that refers to them
+  struct Chunk {
+    std::vector<uint8_t> Bytes;
+    std::unique_ptr<SpilledBlob> Spilled;
+
+    // Position in m_memoryChunks, only meaningful while the chunk is held in memory
+    std::list<Chunk *>::iterator MemoryPosition;
+
+    bool IsInMemory() const noexcept;
+
+    const uint8_t *Data() const noexcept;
+
+    size_t Size() const noexcept;
+  };
+
+  struct Segment {
+    std::shared_ptr<Chunk> Source;
+    size_t Offset;
+    size_t Size;
+  };
+
+  std::unordered_map<std::string, std::vector<Segment>> m_blobs;
+
+  // In-memory chunks, most recently used first
+  std::list<Chunk *> m_memoryChunks;
+
+  size_t m_memoryUsage{0};
+  size_t m_spillThreshold;
+  size_t m_memoryBudget;
+  std::wstring m_directory;
+  std::atomic<uint64_t> m_fileCount{0};
+  std::mutex m_mutex;
+  boost::uuids::random_generator m_guidGenerator;
+
+  std::unique_ptr<SpilledBlob> Spill(std::vector<uint8_t> const &bytes) noexcept;
+
+  // The following methods require m_mutex to be held
+
+  std::shared_ptr<Chunk> AddChunkLocked(
+      std::vector<uint8_t> &&bytes,
+      std::unique_ptr<SpilledBlob> &&spilled) noexcept;
+
+  void StoreLocked(std::string &&blobId, std::vector<Segment> &&segments) noexcept;
+
+  void ReleaseLocked(std::vector<Segment> &segments) noexcept;
+
+  void EraseLocked(std::string const &blobId) noexcept;
+
+  void TouchLocked(Chunk &chunk) noexcept;
+
+  void EnforceBudgetLocked() noexcept;
+
+ public:
+  SpillingBlobPersistor(size_t spillThreshold, size_t memoryBudget) noexcept;
+
+  ~SpillingBlobPersistor() noexcept;
+
+#pragma region IBlobPersistor
+
+  winrt::array_view<uint8_t const> ResolveMessage(std::string &&blobId, int64_t offset, int64_t size) override;
+
+  void RemoveMessage(std::string &&blobId) noexcept override;
+
+  void RemoveMessages(std::vector<std::string> &&blobIds) noexcept override;
+
+  void StoreMessage(std::vector<uint8_t> &&message, std::string &&blobId) noexcept override;
+
+  std::string StoreMessage(std::vector<uint8_t> &&message) noexcept override;
+
+  void StoreComposite(std::vector<BlobSlice> &&slices, std::string &&blobId) override;
+
+  void CopyMessage(std::string &&blobId, int64_t offset, winrt::array_view<uint8_t> destination) override;
+
+  size_t BlobCount() noexcept override;
+
+  size_t MemoryUsage() noexcept override;
+
+#pragma endregion IBlobPersistor
+};
+
+} // namespace Microsoft::React::Networking
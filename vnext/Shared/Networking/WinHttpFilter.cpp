@@ -0,0 +1,476 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#undef WINRT_LEAN_AND_MEAN
+
+#include "WinHttpFilter.h"
+
+#include "WinRTTypes.h"
+
+// Boost Libraries
+#include <boost/algorithm/string.hpp>
+
+// Windows API
+#include <winhttp.h>
+#include <winrt/Windows.Foundation.Collections.h>
+#include <winrt/Windows.Storage.Streams.h>
+#include <winrt/Windows.Web.Http.Headers.h>
+
+// Standard Library
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+using std::shared_ptr;
+using std::wstring;
+using std::wstring_view;
+
+using winrt::hstring;
+using winrt::Windows::Foundation::IAsyncAction;
+using winrt::Windows::Foundation::IAsyncOperationWithProgress;
+using winrt::Windows::Foundation::IReference;
+using winrt::Windows::Foundation::Uri;
+using winrt::Windows::Storage::Streams::IBuffer;
+using winrt::Windows::Storage::Streams::IInputStream;
+using winrt::Windows::Storage::Streams::InputStreamOptions;
+using winrt::Windows::Web::Http::HttpProgress;
+using winrt::Windows::Web::Http::HttpProgressStage;
+using winrt::Windows::Web::Http::HttpRequestMessage;
+using winrt::Windows::Web::Http::HttpResponseMessage;
+using winrt::Windows::Web::Http::HttpResponseMessageSource;
+using winrt::Windows::Web::Http::HttpStatusCode;
+using winrt::Windows::Web::Http::HttpStreamContent;
+using winrt::Windows::Web::Http::HttpVersion;
+
+namespace {
+
+using Microsoft::React::Networking::WinHttpFilter;
+
+// Request content is written in chunks of this size, so that its upload progress can be reported
+constexpr uint32_t WriteChunkSize = 64 * 1024;
+
+// Response headers that HttpClient keeps in the header collection of the content
+constexpr wstring_view ContentHeaderNames[] = {
+    L"Allow",
+    L"Content-Disposition",
+    L"Content-Encoding",
+    L"Content-Language",
+    L"Content-Length",
+    L"Content-Location",
+    L"Content-MD5",
+    L"Content-Range",
+    L"Content-Type",
+    L"Expires",
+    L"Last-Modified"};
+
+void Check(bool succeeded) {
+  if (!succeeded) {
+    winrt::throw_last_error();
+  }
+}
+
+// Options that the running version of Windows does not know are ignored
+void SetOption(HINTERNET handle, DWORD option, DWORD value) noexcept {
+  WinHttpSetOption(handle, option, &value, sizeof(value));
+}
+
+wstring_view Trim(wstring_view value) noexcept {
+  auto start = value.find_first_not_of(L" \t");
+  if (start == wstring_view::npos) {
+    return {};
+  }
+  auto end = value.find_last_not_of(L" \t");
+  return value.substr(start, end - start + 1);
+}
+
+bool IsContentHeader(wstring_view name) noexcept {
+  return std::any_of(std::begin(ContentHeaderNames), std::end(ContentHeaderNames), [name](wstring_view contentName) {
+    return boost::iequals(name, contentName);
+  });
+}
+
+wstring GetPathAndQuery(Uri const &uri) {
+  wstring result{uri.Path()};
+  if (result.empty()) {
+    result = L"/";
+  }
+  result += uri.Query();
+
+  return result;
+}
+
+wstring FormatRequestHeaders(HttpRequestMessage const &request) {
+  wstring result;
+  auto append = [&result](hstring const &name, hstring const &value) {
+    result.append(name);
+    result.append(L": ");
+    result.append(value);
+    result.append(L"\r\n");
+  };
+
+  for (auto const &header : request.Headers()) {
+    append(header.Key(), header.Value());
+  }
+  if (auto content = request.Content()) {
+    for (auto const &header : content.Headers()) {
+      // WinHTTP sends the Content-Length of the data it is given
+      if (!boost::iequals(wstring_view{header.Key()}, L"Content-Length")) {
+        append(header.Key(), header.Value());
+      }
+    }
+  }
+
+  return result;
+}
+
+wstring QueryHeader(HINTERNET request, DWORD infoLevel) {
+  DWORD size = 0;
+  WinHttpQueryHeaders(request, infoLevel, WINHTTP_HEADER_NAME_BY_INDEX, WINHTTP_NO_OUTPUT_BUFFER, &size, nullptr);
+  if (GetLastError() == ERROR_WINHTTP_HEADER_NOT_FOUND) {
+    return {};
+  }
+  Check(GetLastError() == ERROR_INSUFFICIENT_BUFFER);
+
+  // The size is in bytes, and includes the null terminator
+  wstring result(size / sizeof(wchar_t), L'\0');
+  Check(WinHttpQueryHeaders(request, infoLevel, WINHTTP_HEADER_NAME_BY_INDEX, result.data(), &size, nullptr));
+  result.resize(size / sizeof(wchar_t));
+
+  return result;
+}
+
+// Content codings that WINHTTP_DECOMPRESSION_FLAG_ALL decodes
+bool IsDecodedContentEncoding(wstring_view encoding) noexcept {
+  return boost::iequals(encoding, L"gzip") || boost::iequals(encoding, L"x-gzip") ||
+      boost::iequals(encoding, L"deflate");
+}
+
+// Adds the raw response headers, except for the status line, to the response and its content.
+// The headers describing the encoded content are left out once WinHTTP decodes it.
+void AppendResponseHeaders(
+    HttpResponseMessage const &response,
+    HttpStreamContent const &content,
+    wstring_view raw,
+    bool isDecoded) {
+  bool isStatusLine = true;
+  while (!raw.empty()) {
+    auto lineEnd = raw.find(L"\r\n");
+    auto line = raw.substr(0, lineEnd);
+    raw = lineEnd == wstring_view::npos ? wstring_view{} : raw.substr(lineEnd + 2);
+
+    auto separator = line.find(L':');
+    if (isStatusLine || separator == wstring_view::npos) {
+      isStatusLine = false;
+      continue;
+    }
+
+    hstring name{Trim(line.substr(0, separator))};
+    hstring value{Trim(line.substr(separator + 1))};
+    if (isDecoded && (boost::iequals(wstring_view{name}, L"Content-Encoding") ||
+                      boost::iequals(wstring_view{name}, L"Content-Length"))) {
+      continue;
+    }
+
+    if (IsContentHeader(name)) {
+      content.Headers().TryAppendWithoutValidation(name, value);
+    } else {
+      response.Headers().TryAppendWithoutValidation(name, value);
+    }
+  }
+}
+
+shared_ptr<void> OpenSession(WinHttpFilter::Options const &options) noexcept {
+  shared_ptr<void> result{
+      WinHttpOpen(
+          nullptr /*agent*/,
+          WINHTTP_ACCESS_TYPE_AUTOMATIC_PROXY,
+          WINHTTP_NO_PROXY_NAME,
+          WINHTTP_NO_PROXY_BYPASS,
+          0),
+      WinHttpCloseHandle};
+  auto session = result.get();
+  if (!session) {
+    // The requests fail when they try to connect
+    return result;
+  }
+
+  // RedirectHttpFilter follows the redirects
+  SetOption(session, WINHTTP_OPTION_REDIRECT_POLICY, WINHTTP_OPTION_REDIRECT_POLICY_NEVER);
+  SetOption(session, WINHTTP_OPTION_DECOMPRESSION, WINHTTP_DECOMPRESSION_FLAG_ALL);
+  if (options.MaxConnectionsPerServer > 0) {
+    SetOption(session, WINHTTP_OPTION_MAX_CONNS_PER_SERVER, options.MaxConnectionsPerServer);
+    SetOption(session, WINHTTP_OPTION_MAX_CONNS_PER_1_0_SERVER, options.MaxConnectionsPerServer);
+  }
+
+  // Like with HttpClient, only the timeout of the request limits how long its response takes
+  WinHttpSetTimeouts(session, 0 /*resolve*/, 60000 /*connect*/, 0 /*send*/, 0 /*receive*/);
+
+  return result;
+}
+
+// The sessions are kept for the lifetime of the process, so that the connections opened ahead of the first request,
+// or by a React instance that was reloaded, are still there for the next requests.
+shared_ptr<void> GetSession(WinHttpFilter::Options const &options) noexcept {
+  using SessionKey = std::tuple<uint32_t, bool, bool>;
+  struct SessionCache {
+    std::mutex Mutex;
+    std::map<SessionKey, shared_ptr<void>> Sessions;
+  };
+  // Never destroyed, since WinHTTP must not be called while the module is unloaded
+  static SessionCache *s_cache = new SessionCache();
+
+  SessionKey key{options.MaxConnectionsPerServer, options.EnableHttp2, options.DisableStreamQueue};
+  std::scoped_lock lock{s_cache->Mutex};
+  auto &session = s_cache->Sessions[key];
+  if (!session) {
+    session = OpenSession(options);
+  }
+
+  return session;
+}
+
+// Owns the connection and request handles of a request. Closing the request handle aborts its calls in progress.
+class WinHttpRequest {
+  shared_ptr<void> m_session;
+  std::unique_ptr<void, decltype(&WinHttpCloseHandle)> m_connection;
+  std::atomic<HINTERNET> m_request{nullptr};
+
+ public:
+  WinHttpRequest(
+      shared_ptr<void> session,
+      WinHttpFilter::Options const &options,
+      Uri const &uri,
+      hstring const &method,
+      wstring const &path)
+      : m_session{std::move(session)},
+        m_connection{
+            WinHttpConnect(
+                m_session.get(),
+                uri.Host().c_str(),
+                uri.Port() > 0 ? static_cast<INTERNET_PORT>(uri.Port()) : INTERNET_DEFAULT_PORT,
+                0),
+            WinHttpCloseHandle} {
+    Check(m_connection != nullptr);
+
+    auto request = WinHttpOpenRequest(
+        m_connection.get(),
+        method.c_str(),
+        path.c_str(),
+        nullptr /*version*/,
+        WINHTTP_NO_REFERER,
+        WINHTTP_DEFAULT_ACCEPT_TYPES,
+        uri.SchemeName() == L"https" ? WINHTTP_FLAG_SECURE : 0);
+    Check(request != nullptr);
+    m_request = request;
+
+    if (options.EnableHttp2) {
+      SetOption(request, WINHTTP_OPTION_ENABLE_HTTP_PROTOCOL, WINHTTP_PROTOCOL_FLAG_HTTP2);
+    }
+    if (options.DisableStreamQueue) {
+      SetOption(request, WINHTTP_OPTION_DISABLE_STREAM_QUEUE, TRUE);
+    }
+  }
+
+  ~WinHttpRequest() noexcept {
+    Close();
+  }
+
+  // Returns nullptr once the request is closed
+  HINTERNET Handle() const noexcept {
+    return m_request;
+  }
+
+  void Close() noexcept {
+    if (auto request = m_request.exchange(nullptr)) {
+      WinHttpCloseHandle(request);
+    }
+  }
+};
+
+// Reads the response content from the connection as the consumer asks for it
+class WinHttpResponseStream : public winrt::implements<WinHttpResponseStream, IInputStream> {
+  shared_ptr<WinHttpRequest> m_request;
+  shared_ptr<WinHttpFilter::StatisticsCounters> m_statistics;
+  // Size of the decoded content as it was sent, or -1 when the content is not decoded or its size was not sent
+  int64_t m_wireLength;
+  uint64_t m_decodedLength{0};
+
+  void OnEndOfContent() noexcept {
+    if (m_wireLength >= 0) {
+      m_statistics->WireBytes += static_cast<uint64_t>(m_wireLength);
+      m_statistics->DecodedBytes += m_decodedLength;
+      m_wireLength = -1;
+    }
+  }
+
+ public:
+  WinHttpResponseStream(
+      shared_ptr<WinHttpRequest> request,
+      shared_ptr<WinHttpFilter::StatisticsCounters> statistics,
+      int64_t wireLength) noexcept
+      : m_request{std::move(request)}, m_statistics{std::move(statistics)}, m_wireLength{wireLength} {}
+
+  IAsyncOperationWithProgress<IBuffer, uint32_t> ReadAsync(IBuffer buffer, uint32_t count, InputStreamOptions options) {
+    auto strongThis = get_strong();
+    auto request = m_request;
+    co_await winrt::resume_background();
+
+    const uint32_t length = std::min(count, buffer.Capacity());
+    uint32_t bytesRead = 0;
+    while (bytesRead < length) {
+      DWORD chunkLength = 0;
+      Check(WinHttpReadData(request->Handle(), buffer.data() + bytesRead, length - bytesRead, &chunkLength));
+
+      // Zero bytes are read at the end of the content
+      if (chunkLength == 0) {
+        strongThis->OnEndOfContent();
+        break;
+      }
+      bytesRead += chunkLength;
+      strongThis->m_decodedLength += chunkLength;
+
+      if ((options & InputStreamOptions::Partial) == InputStreamOptions::Partial) {
+        break;
+      }
+    }
+    buffer.Length(bytesRead);
+
+    co_return buffer;
+  }
+
+  void Close() noexcept {
+    m_request->Close();
+  }
+};
+
+} // namespace
+
+namespace Microsoft::React::Networking {
+
+#pragma region WinHttpFilter
+
+WinHttpFilter::WinHttpFilter(Options const &options) noexcept : m_session{GetSession(options)}, m_options{options} {}
+
+WinHttpFilter::Statistics WinHttpFilter::GetStatistics() const noexcept {
+  return {m_statistics->Responses, m_statistics->DecodedResponses, m_statistics->WireBytes, m_statistics->DecodedBytes};
+}
+
+IAsyncAction WinHttpFilter::PreconnectAsync(Uri uri) {
+  auto session = m_session;
+  auto options = m_options;
+  co_await winrt::resume_background();
+
+  WinHttpRequest request{std::move(session), options, uri, L"OPTIONS", L"*"};
+  Check(WinHttpSendRequest(request.Handle(), WINHTTP_NO_ADDITIONAL_HEADERS, 0, WINHTTP_NO_REQUEST_DATA, 0, 0, 0));
+  Check(WinHttpReceiveResponse(request.Handle(), nullptr));
+
+  // The content must be read for the connection to go back to the pool
+  uint8_t buffer[1024];
+  DWORD chunkLength = 0;
+  do {
+    Check(WinHttpReadData(request.Handle(), buffer, sizeof(buffer), &chunkLength));
+  } while (chunkLength > 0);
+}
+
+#pragma region IHttpFilter
+
+ResponseOperation WinHttpFilter::SendRequestAsync(HttpRequestMessage const &request) {
+  auto coRequest = request;
+  auto coSession = m_session;
+  auto coOptions = m_options;
+  auto coStatistics = m_statistics;
+  auto progress = co_await winrt::get_progress_token();
+  auto cancellation = co_await winrt::get_cancellation_token();
+
+  IBuffer body{nullptr};
+  if (auto content = coRequest.Content()) {
+    body = co_await content.ReadAsBufferAsync();
+  }
+
+  // WinHTTP is used synchronously, off the calling thread
+  co_await winrt::resume_background();
+
+  auto uri = coRequest.RequestUri();
+  auto winHttpRequest = std::make_shared<WinHttpRequest>(
+      std::move(coSession), coOptions, uri, coRequest.Method().Method(), GetPathAndQuery(uri));
+  cancellation.callback([winHttpRequest]() noexcept { winHttpRequest->Close(); });
+
+  auto headers = FormatRequestHeaders(coRequest);
+  const uint32_t bodyLength = body ? body.Length() : 0;
+  Check(WinHttpSendRequest(
+      winHttpRequest->Handle(),
+      headers.empty() ? WINHTTP_NO_ADDITIONAL_HEADERS : headers.c_str(),
+      static_cast<DWORD>(headers.size()),
+      WINHTTP_NO_REQUEST_DATA,
+      0,
+      bodyLength,
+      0));
+
+  uint32_t bytesSent = 0;
+  while (bytesSent < bodyLength) {
+    DWORD chunkLength = 0;
+    Check(WinHttpWriteData(
+        winHttpRequest->Handle(),
+        body.data() + bytesSent,
+        std::min(WriteChunkSize, bodyLength - bytesSent),
+        &chunkLength));
+    bytesSent += chunkLength;
+
+    HttpProgress sendProgress{};
+    sendProgress.Stage = HttpProgressStage::SendingContent;
+    sendProgress.BytesSent = bytesSent;
+    sendProgress.TotalBytesToSend = IReference<uint64_t>{bodyLength};
+    progress(sendProgress);
+  }
+
+  Check(WinHttpReceiveResponse(winHttpRequest->Handle(), nullptr));
+
+  DWORD statusCode = 0;
+  DWORD statusCodeSize = sizeof(statusCode);
+  Check(WinHttpQueryHeaders(
+      winHttpRequest->Handle(),
+      WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
+      WINHTTP_HEADER_NAME_BY_INDEX,
+      &statusCode,
+      &statusCodeSize,
+      WINHTTP_NO_HEADER_INDEX));
+
+  DWORD protocol = 0;
+  DWORD protocolSize = sizeof(protocol);
+  WinHttpQueryOption(winHttpRequest->Handle(), WINHTTP_OPTION_HTTP_PROTOCOL_USED, &protocol, &protocolSize);
+
+  HttpResponseMessage response{static_cast<HttpStatusCode>(statusCode)};
+  response.ReasonPhrase(QueryHeader(winHttpRequest->Handle(), WINHTTP_QUERY_STATUS_TEXT));
+  response.Version((protocol & WINHTTP_PROTOCOL_FLAG_HTTP2) ? HttpVersion::Http20 : HttpVersion::Http11);
+  response.Source(HttpResponseMessageSource::Network);
+  response.RequestMessage(coRequest);
+
+  // The session decodes the content while it is read, so that the consumer gets it without another pass
+  const bool isDecoded =
+      IsDecodedContentEncoding(QueryHeader(winHttpRequest->Handle(), WINHTTP_QUERY_CONTENT_ENCODING));
+  int64_t wireLength = -1;
+  ++coStatistics->Responses;
+  if (isDecoded) {
+    ++coStatistics->DecodedResponses;
+    auto contentLength = QueryHeader(winHttpRequest->Handle(), WINHTTP_QUERY_CONTENT_LENGTH);
+    if (!contentLength.empty()) {
+      wireLength = static_cast<int64_t>(_wcstoui64(contentLength.c_str(), nullptr, 10));
+    }
+  }
+
+  HttpStreamContent content{winrt::make<WinHttpResponseStream>(winHttpRequest, coStatistics, wireLength)};
+  AppendResponseHeaders(
+      response, content, QueryHeader(winHttpRequest->Handle(), WINHTTP_QUERY_RAW_HEADERS_CRLF), isDecoded);
+  response.Content(content);
+
+  co_return response;
+}
+
+#pragma endregion IHttpFilter
+
+#pragma endregion WinHttpFilter
+
+} // namespace Microsoft::React::Networking
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Windows API
+#include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Web.Http.Filters.h>
+#include <winrt/Windows.Web.Http.h>
+
+// Standard Library
+#include <atomic>
+#include <memory>
+
+namespace Microsoft::React::Networking {
+
+/// <summary>
+/// Transport filter that sends the requests through WinHTTP instead of HttpBaseProtocolFilter.
+/// </summary>
+/// <remarks>
+/// All the filters with the same options share one WinHTTP session for the lifetime of the process, and so its
+/// connection pool, its HTTP/2 connections and its TLS sessions. Redirects are never followed, so that
+/// RedirectHttpFilter keeps handling them. Response content is streamed from the connection as it is read, and
+/// compressed content is decoded by WinHTTP on the thread that reads it.
+/// </remarks>
+class WinHttpFilter : public winrt::implements<WinHttpFilter, winrt::Windows::Web::Http::Filters::IHttpFilter> {
+ public:
+  struct Options {
+    // Zero keeps the WinHTTP default
+    uint32_t MaxConnectionsPerServer{0};
+    bool EnableHttp2{true};
+    // Opens new connections instead of queueing the requests that exceed the stream limit of an HTTP/2 connection
+    bool DisableStreamQueue{false};
+  };
+
+  struct Statistics {
+    uint64_t Responses;
+    // Responses sent with a gzip or deflate Content-Encoding, which WinHTTP decodes while they are read
+    uint64_t DecodedResponses;
+    // Body sizes of the decoded responses that were read to the end, when their Content-Length was sent
+    uint64_t WireBytes;
+    uint64_t DecodedBytes;
+  };
+
+  // Shared with the response content streams, which may outlive the filter
+  struct StatisticsCounters {
+    std::atomic<uint64_t> Responses{0};
+    std::atomic<uint64_t> DecodedResponses{0};
+    std::atomic<uint64_t> WireBytes{0};
+    std::atomic<uint64_t> DecodedBytes{0};
+  };
+
+ private:
+  // WinHTTP session handle
+  std::shared_ptr<void> m_session;
+  Options m_options;
+  std::shared_ptr<StatisticsCounters> m_statistics{std::make_shared<StatisticsCounters>()};
+
+ public:
+  WinHttpFilter(Options const &options) noexcept;
+
+  Statistics GetStatistics() const noexcept;
+
+  /// <summary>
+  /// Connects to the origin of a URI ahead of its first request, so that the request does not wait for the name
+  /// resolution and the TCP and TLS handshakes.
+  /// </summary>
+  /// <remarks>
+  /// Sends an "OPTIONS *" request, and keeps the connection in the pool whatever its response is.
+  /// </remarks>
+  winrt::Windows::Foundation::IAsyncAction PreconnectAsync(winrt::Windows::Foundation::Uri uri);
+
+#pragma region IHttpFilter
+
+  winrt::Windows::Foundation::IAsyncOperationWithProgress<
+      winrt::Windows::Web::Http::HttpResponseMessage,
+      winrt::Windows::Web::Http::HttpProgress>
+  SendRequestAsync(winrt::Windows::Web::Http::HttpRequestMessage const &request);
+
+#pragma endregion IHttpFilter
+};
+
+} // namespace Microsoft::React::Networking
@@ -7,11 +7,13 @@
 
 #include "HttpSettings.g.cpp"
 #include <CppRuntimeOptions.h>
+#include <Modules/CxxModuleUtilities.h>
 #include <Networking/IBlobResource.h>
 #include <ReactPropertyBag.h>
 #include <Utils/CppWinrtLessExceptions.h>
 #include <Utils/WinRTConversions.h>
 #include <utilities.h>
+#include "CachingHttpFilter.h"
 #include "IRedirectEventSource.h"
 #include "Networking/NetworkPropertyIds.h"
 #include "OriginPolicyHttpFilter.h"
@@ -20,12 +22,21 @@
 // Boost Libraries
 #include <boost/algorithm/string.hpp>
 
+// Folly
+#include <folly/json.h>
+
 // Windows API
 #include <winrt/Windows.Foundation.Collections.h>
+#include <winrt/Windows.Networking.Sockets.h>
+#include <winrt/Windows.Networking.h>
 #include <winrt/Windows.Security.Cryptography.h>
 #include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Web.Http.Headers.h>
 
+// Standard Library
+#include <algorithm>
+#include <optional>
+
 using std::function;
 using std::scoped_lock;
 using std::shared_ptr;
@@ -36,6 +47,7 @@ using std::weak_ptr;
 using winrt::fire_and_forget;
 using winrt::hresult_error;
 using winrt::to_hstring;
+using winrt::Microsoft::ReactNative::JSValue;
 using winrt::Microsoft::ReactNative::JSValueObject;
 using winrt::Windows::Foundation::IAsyncOperation;
 using winrt::Windows::Foundation::IInspectable;
@@ -46,6 +58,8 @@ using winrt::Windows::Storage::Streams::DataReader;
 using winrt::Windows::Storage::Streams::UnicodeEncoding;
 using winrt::Windows::Web::Http::HttpBufferContent;
 using winrt::Windows::Web::Http::HttpMethod;
+using winrt::Windows::Web::Http::HttpProgress;
+using winrt::Windows::Web::Http::HttpProgressStage;
 using winrt::Windows::Web::Http::HttpRequestMessage;
 using winrt::Windows::Web::Http::HttpStreamContent;
 using winrt::Windows::Web::Http::HttpStringContent;
@@ -66,6 +80,51 @@ constexpr uint32_t operator""_MiB(unsigned long long int x) {
 constexpr char responseTypeText[] = "text";
 constexpr char responseTypeBase64[] = "base64";
 constexpr char responseTypeBlob[] = "blob";
+constexpr char responseTypeArrayBuffer[] = "arraybuffer";
+constexpr char responseTypeJson[] = "json";
+
+// Streamed responses stop reading while the consumer has not acknowledged this many delivered bytes
+constexpr int64_t maxUnacknowledgedBytes = 1_MiB;
+
+// Default memory capacity of the response cache enabled by the Http.ResponseCache runtime option
+constexpr size_t defaultResponseCacheSize = 16_MiB;
+
+// Resolves a host name into the DNS cache of the system, which all the HTTP stacks of the process use
+fire_and_forget PrefetchHostName(winrt::Windows::Networking::HostName hostName, winrt::hstring serviceName) noexcept {
+  try {
+    co_await winrt::Windows::Networking::Sockets::DatagramSocket::GetEndpointPairsAsync(hostName, serviceName);
+  } catch (const hresult_error &) {
+    // The request reports the failure once it is sent
+  }
+}
+
+// Appends the loaded bytes of the reader to the end of the container, reading them in place
+template <typename TContainer>
+void AppendUnconsumedBytes(DataReader const &reader, TContainer &container) {
+  const auto length = reader.UnconsumedBufferLength();
+  const auto offset = container.size();
+  container.resize(offset + length);
+  reader.ReadBytes(winrt::array_view<uint8_t>(reinterpret_cast<uint8_t *>(container.data()) + offset, length));
+}
+
+// Returns the Content-Length of the response when known, to pre-size the response buffer
+size_t GetContentLengthHint(winrt::Windows::Web::Http::IHttpContent const &content) noexcept {
+  if (auto contentLength = content.Headers().ContentLength()) {
+    // Do not trust the header for allocations beyond what a single response buffer may hold
+    return static_cast<size_t>((std::min)(contentLength.Value(), static_cast<uint64_t>(256_MiB)));
+  }
+  return 0;
+}
+
+// Parses the response text on the calling thread, so that the JS thread only has to create the JS values.
+// Returns nullopt if the text is not valid JSON, to let the JS code report the error when it parses the text.
+std::optional<JSValue> TryParseJson(string const &text) noexcept {
+  try {
+    return Microsoft::React::Modules::ToJSValue(folly::parseJson(text));
+  } catch (std::exception const &) {
+    return std::nullopt;
+  }
+}
 
 } // namespace
 namespace Microsoft::React::Networking {
@@ -102,6 +161,9 @@ void AttachMultipartHeaders(IHttpContent content, const JSValueObject &headers)
 
 WinRTHttpResource::WinRTHttpResource(IHttpClient &&client) noexcept : m_client{std::move(client)} {}
 
+WinRTHttpResource::WinRTHttpResource(IHttpClient &&client, winrt::com_ptr<WinHttpFilter> &&transportFilter) noexcept
+    : m_client{std::move(client)}, m_transportFilter{std::move(transportFilter)} {}
+
 WinRTHttpResource::WinRTHttpResource() noexcept : WinRTHttpResource(winrt::Windows::Web::Http::HttpClient{}) {}
 
 #pragma region IWinRTHttpRequestFactory
@@ -176,28 +238,32 @@ IAsyncOperation<HttpRequestMessage> WinRTHttpResource::CreateRequest(
     auto bodyHandler = self->m_requestBodyHandler.lock();
     if (bodyHandler && bodyHandler->Supports(data)) {
       auto contentTypeString = contentType ? winrt::to_string(contentType.ToString()) : "";
-      JSValueObject blob;
+      uint64_t size = 0;
       try {
-        blob = bodyHandler->ToRequestBody(data, contentTypeString);
+        // Read the blob straight from its storage while uploading, instead of copying it into a buffer first.
+        auto stream = bodyHandler->ToRequestStream(data, contentTypeString, size);
+        content = HttpStreamContent{std::move(stream)};
+        content.Headers().ContentLength(size);
+        if (!contentType) {
+          HttpMediaTypeHeaderValue::TryParse(to_hstring(contentTypeString), contentType);
+        }
       } catch (const std::invalid_argument &e) {
         if (self->m_onError) {
           self->m_onError(reqArgs->RequestId, e.what(), false);
         }
         co_return nullptr;
       }
-      auto &bytes = blob["bytes"].AsArray();
-      auto byteVector = vector<uint8_t>(bytes.size());
-      for (auto &byte : bytes) {
-        byteVector.push_back(static_cast<uint8_t>(byte.AsUInt8()));
-      }
-      auto view = winrt::array_view<uint8_t const>{byteVector};
-      auto buffer = CryptographicBuffer::CreateFromByteArray(view);
-      content = HttpBufferContent{std::move(buffer)};
     } else if (data.find("string") != data.cend()) {
       content = HttpStringContent{to_hstring(data["string"].AsString())};
     } else if (data.find("base64") != data.cend()) {
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(to_hstring(data["base64"].AsString()));
-      content = HttpBufferContent{std::move(buffer)};
+      vector<uint8_t> bytes;
+      if (!Utilities::TryDecodeBase64(data["base64"].AsString(), bytes)) {
+        if (self->m_onError) {
+          self->m_onError(reqArgs->RequestId, "Invalid Base64 request body", false);
+        }
+        co_return nullptr;
+      }
+      content = HttpBufferContent{CryptographicBuffer::CreateFromByteArray(bytes)};
     } else if (data.find("uri") != data.cend()) {
       auto file = co_await StorageFile::GetFileFromApplicationUriAsync(Uri{to_hstring(data["uri"].AsString())});
       auto stream = co_await file.OpenReadAsync();
@@ -212,7 +278,20 @@ IAsyncOperation<HttpRequestMessage> WinRTHttpResource::CreateRequest(
       for (auto &formDataPart : formData) {
         IHttpContent formContent{nullptr};
         auto &formDataPartObj = formDataPart.AsObject();
-        if (!formDataPartObj["string"].IsNull()) {
+        if (bodyHandler && bodyHandler->Supports(formDataPartObj)) {
+          auto partContentType = string{};
+          uint64_t size = 0;
+          try {
+            auto stream = bodyHandler->ToRequestStream(formDataPartObj, partContentType, size);
+            formContent = HttpStreamContent{std::move(stream)};
+            formContent.Headers().ContentLength(size);
+          } catch (const std::invalid_argument &e) {
+            if (self->m_onError) {
+              self->m_onError(reqArgs->RequestId, e.what(), false);
+            }
+            co_return nullptr;
+          }
+        } else if (!formDataPartObj["string"].IsNull()) {
           formContent = HttpStringContent{to_hstring(formDataPartObj["string"].AsString())};
         } else if (!formDataPartObj["uri"].IsNull()) {
           auto filePath = to_hstring(formDataPartObj["uri"].AsString());
@@ -282,7 +361,9 @@ void WinRTHttpResource::SendRequest(
     bool withCredentials,
     std::function<void(int64_t)> &&callback) noexcept /*override*/ {
   // Enforce supported args
-  assert(responseType == responseTypeText || responseType == responseTypeBase64 || responseType == responseTypeBlob);
+  assert(
+      responseType == responseTypeText || responseType == responseTypeBase64 || responseType == responseTypeBlob ||
+      responseType == responseTypeArrayBuffer || responseType == responseTypeJson);
 
   if (callback) {
     callback(requestId);
@@ -302,7 +383,42 @@ void WinRTHttpResource::SendRequest(
     reqArgs->ResponseType = std::move(responseType);
     reqArgs->Timeout = timeout;
 
-    PerformSendRequest(std::move(httpMethod), std::move(uri), iReqArgs);
+    // Only network requests share connections, other schemes are served without waiting
+    auto scheme = uri.SchemeName();
+    if (scheme != L"http" && scheme != L"https") {
+      PerformSendRequest(std::move(httpMethod), std::move(uri), iReqArgs, nullptr);
+      return;
+    }
+
+    auto priority = HttpRequestPriority::Default;
+    for (auto &header : reqArgs->Headers) {
+      if (boost::iequals(header.first, "Priority")) {
+        priority = HttpRequestScheduler::PriorityFromHeader(header.second);
+      }
+    }
+
+    // Registered before scheduling, since the request can start before Schedule returns
+    {
+      scoped_lock lock{m_mutex};
+      m_queuedRequests[requestId] = 0;
+    }
+    auto queuedId = HttpRequestScheduler::Instance().Schedule(
+        uri,
+        priority,
+        [weakThis = weak_from_this(), httpMethod, uri, iReqArgs, requestId](HttpRequestScheduler::Slot slot) {
+          if (auto strongThis = weakThis.lock()) {
+            {
+              scoped_lock lock{strongThis->m_mutex};
+              strongThis->m_queuedRequests.erase(requestId);
+            }
+            strongThis->PerformSendRequest(HttpMethod{httpMethod}, Uri{uri}, iReqArgs, std::move(slot));
+          }
+        });
+
+    scoped_lock lock{m_mutex};
+    if (auto iter = m_queuedRequests.find(requestId); iter != std::end(m_queuedRequests)) {
+      iter->second = queuedId;
+    }
   } catch (std::exception const &e) {
     if (m_onError) {
       m_onError(requestId, e.what(), false);
@@ -320,6 +436,23 @@ void WinRTHttpResource::SendRequest(
 
 void WinRTHttpResource::AbortRequest(int64_t requestId) noexcept /*override*/ {
   ResponseOperation request{nullptr};
+  bool dequeued = false;
+
+  {
+    scoped_lock lock{m_mutex};
+    if (auto queued = m_queuedRequests.find(requestId); queued != std::end(m_queuedRequests)) {
+      dequeued = HttpRequestScheduler::Instance().Cancel(queued->second);
+      m_queuedRequests.erase(queued);
+    }
+  }
+
+  // A request still waiting for its origin never started, so it fails like a cancelled one
+  if (dequeued) {
+    if (m_onError) {
+      m_onError(requestId, Utilities::HResultToString(HRESULT_FROM_WIN32(ERROR_CANCELLED)), false);
+    }
+    return;
+  }
 
   {
     scoped_lock lock{m_mutex};
@@ -337,6 +470,34 @@ void WinRTHttpResource::AbortRequest(int64_t requestId) noexcept /*override*/ {
       m_onError(requestId, Utilities::HResultToString(e), false);
     }
   }
+
+  // Wake up a streamed response waiting for acknowledgements, so it stops reading
+  shared_ptr<ResponseStreamWindow> window;
+  {
+    scoped_lock lock{m_mutex};
+    if (auto iter = m_streamWindows.find(requestId); iter != std::end(m_streamWindows)) {
+      window = iter->second;
+    }
+  }
+  if (window) {
+    window->Aborted = true;
+    ::SetEvent(window->Signal.get());
+  }
+}
+
+void WinRTHttpResource::AcknowledgeIncrementalData(int64_t requestId, int64_t byteCount) noexcept /*override*/ {
+  shared_ptr<ResponseStreamWindow> window;
+  {
+    scoped_lock lock{m_mutex};
+    auto iter = m_streamWindows.find(requestId);
+    if (iter == std::end(m_streamWindows)) {
+      return;
+    }
+    window = iter->second;
+  }
+
+  window->PendingBytes -= byteCount;
+  ::SetEvent(window->Signal.get());
 }
 
 void WinRTHttpResource::ClearCookies() noexcept /*override*/ {
@@ -344,6 +505,22 @@ void WinRTHttpResource::ClearCookies() noexcept /*override*/ {
   // NOT IMPLEMENTED
 }
 
+void WinRTHttpResource::Preconnect(string &&url) noexcept /*override*/ {
+  try {
+    Uri uri{to_hstring(url)};
+
+    // Preconnecting is best effort, so its result is not observed
+    if (m_transportFilter) {
+      m_transportFilter->PreconnectAsync(uri);
+    } else {
+      // HttpBaseProtocolFilter has no way to connect ahead of a request
+      PrefetchHostName(winrt::Windows::Networking::HostName{uri.Host()}, to_hstring(uri.Port()));
+    }
+  } catch (const hresult_error &) {
+    // Malformed URLs fail once they are requested
+  }
+}
+
 void WinRTHttpResource::SetOnRequestSuccess(function<void(int64_t requestId)> &&handler) noexcept /*override*/ {
   m_onRequestSuccess = std::move(handler);
 }
@@ -364,18 +541,39 @@ void WinRTHttpResource::SetOnData(function<void(int64_t requestId, JSValueObject
   m_onDataObject = std::move(handler);
 }
 
+void WinRTHttpResource::SetOnJsonData(function<void(int64_t requestId, JSValue &&responseData)> &&handler) noexcept
+/*override*/ {
+  m_onJsonData = std::move(handler);
+}
+
 void WinRTHttpResource::SetOnIncrementalData(
     function<void(int64_t requestId, string &&responseData, int64_t progress, int64_t total)> &&handler) noexcept
 /*override*/ {
   m_onIncrementalData = std::move(handler);
 }
 
+void WinRTHttpResource::SetOnIncrementalBinaryData(
+    function<void(
+        int64_t requestId,
+        winrt::Windows::Storage::Streams::IBuffer &&responseData,
+        int64_t progress,
+        int64_t total)> &&handler) noexcept
+/*override*/ {
+  m_onIncrementalBinaryData = std::move(handler);
+}
+
 void WinRTHttpResource::SetOnDataProgress(
     function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept
 /*override*/ {
   m_onDataProgress = std::move(handler);
 }
 
+void WinRTHttpResource::SetOnDataSent(
+    function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept
+/*override*/ {
+  m_onDataSent = std::move(handler);
+}
+
 void WinRTHttpResource::SetOnResponseComplete(function<void(int64_t requestId)> &&handler) noexcept /*override*/ {
   m_onComplete = std::move(handler);
 }
@@ -398,9 +596,25 @@ void WinRTHttpResource::UntrackResponse(int64_t requestId) noexcept {
   m_responses.erase(requestId);
 }
 
+shared_ptr<ResponseStreamWindow> WinRTHttpResource::TrackStreamWindow(int64_t requestId) noexcept {
+  auto window = std::make_shared<ResponseStreamWindow>();
+  scoped_lock lock{m_mutex};
+  m_streamWindows[requestId] = window;
+  return window;
+}
+
+void WinRTHttpResource::UntrackStreamWindow(int64_t requestId) noexcept {
+  scoped_lock lock{m_mutex};
+  m_streamWindows.erase(requestId);
+}
+
 fire_and_forget
-WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspectable const &args) noexcept {
-  // Keep references after coroutine suspension.
+WinRTHttpResource::PerformSendRequest(
+    HttpMethod &&method,
+    Uri &&rtUri,
+    IInspectable const &args,
+    HttpRequestScheduler::Slot slot) noexcept {
+  // Keep references after coroutine suspension. The slot of the origin is held until the response is read.
   auto self = shared_from_this();
   auto coArgs = args;
   auto reqArgs = coArgs.as<RequestArgs>();
@@ -454,7 +668,20 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
   try {
     auto sendRequestOp = self->m_client.SendRequestAsync(coRequest);
 
-    auto isText = reqArgs->ResponseType == responseTypeText;
+    if (self->m_onDataSent && coRequest.Content()) {
+      sendRequestOp.Progress([self, requestId = reqArgs->RequestId](
+                                 ResponseOperation const & /*sender*/, HttpProgress const &progress) {
+        if (progress.Stage != HttpProgressStage::SendingContent)
+          return;
+
+        auto total = progress.TotalBytesToSend() ? progress.TotalBytesToSend().Value() : 0;
+        self->m_onDataSent(requestId, static_cast<int64_t>(progress.BytesSent), static_cast<int64_t>(total));
+      });
+    }
+
+    // JSON responses are read as text, and parsed once they are complete
+    auto isJson = reqArgs->ResponseType == responseTypeJson;
+    auto isText = reqArgs->ResponseType == responseTypeText || isJson;
 
     self->TrackResponse(reqArgs->RequestId, sendRequestOp);
 
@@ -530,13 +757,11 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
       // Let response handler take over, if set
       if (auto responseHandler = self->m_responseHandler.lock()) {
         if (responseHandler->Supports(reqArgs->ResponseType)) {
+          // Read each segment straight into the final buffer, which is then handed over without a copy
           vector<uint8_t> responseData{};
+          responseData.reserve(GetContentLengthHint(response.Content()));
           while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
-            auto length = reader.UnconsumedBufferLength();
-            auto data = vector<uint8_t>(length);
-            reader.ReadBytes(data);
-
-            responseData.insert(responseData.cend(), data.cbegin(), data.cend());
+            AppendUnconsumedBytes(reader, responseData);
           }
 
           auto blob = responseHandler->ToResponseData(std::move(responseData));
@@ -553,39 +778,74 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
         }
       }
 
+      // Stream binary chunks, reading ahead only as far as the consumer keeps up
+      if (reqArgs->IncrementalUpdates && reqArgs->ResponseType == responseTypeArrayBuffer) {
+        auto window = self->TrackStreamWindow(reqArgs->RequestId);
+        const auto total = static_cast<int64_t>(GetContentLengthHint(response.Content()));
+        int64_t receivedBytes = 0;
+        while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
+          auto length = reader.UnconsumedBufferLength();
+          receivedBytes += length;
+
+          // The chunk buffer backs the JS ArrayBuffer without another copy
+          auto chunk = reader.ReadBuffer(length);
+          if (self->m_onIncrementalBinaryData) {
+            window->PendingBytes += length;
+            self->m_onIncrementalBinaryData(reqArgs->RequestId, std::move(chunk), receivedBytes, total);
+          }
+
+          while (window->PendingBytes >= maxUnacknowledgedBytes && !window->Aborted) {
+            co_await winrt::resume_on_signal(window->Signal.get());
+          }
+          if (window->Aborted) {
+            break;
+          }
+        }
+        self->UntrackStreamWindow(reqArgs->RequestId);
+
+        if (!window->Aborted && self->m_onComplete) {
+          self->m_onComplete(reqArgs->RequestId);
+        }
+        co_return self->UntrackResponse(reqArgs->RequestId);
+      }
+
       if (isText) {
         reader.UnicodeEncoding(UnicodeEncoding::Utf8);
       }
 
       int64_t receivedBytes = 0;
       string responseData;
-      winrt::Windows::Storage::Streams::IBuffer buffer;
+      if (isText && !reqArgs->IncrementalUpdates) {
+        responseData.reserve(GetContentLengthHint(response.Content()));
+      } else if (!isText) {
+        responseData.reserve(Utilities::Base64EncodedLength(GetContentLengthHint(response.Content())));
+      }
+      // Binary bytes not encoded yet. Chunks are encoded in whole 3-byte groups so no padding lands mid-stream.
+      vector<uint8_t> pendingBytes;
       while (auto loaded = co_await reader.LoadAsync(segmentSize)) {
         auto length = reader.UnconsumedBufferLength();
         receivedBytes += length;
 
         if (isText) {
-          auto data = vector<uint8_t>(length);
-          reader.ReadBytes(data);
-
-          auto incrementData = string(Common::Utilities::CheckedReinterpretCast<char *>(data.data()), data.size());
           // #9534 - Send incremental updates.
           // See https://github.com/facebook/react-native/blob/v0.70.6/Libraries/Network/RCTNetworking.mm#L561
           if (reqArgs->IncrementalUpdates) {
-            responseData = std::move(incrementData);
+            responseData.clear();
+            AppendUnconsumedBytes(reader, responseData);
 
             if (self->m_onIncrementalData) {
               // For total, see #10849
               self->m_onIncrementalData(reqArgs->RequestId, std::move(responseData), receivedBytes, 0 /*total*/);
             }
           } else {
-            responseData += std::move(incrementData);
+            AppendUnconsumedBytes(reader, responseData);
           }
         } else {
-          buffer = reader.ReadBuffer(length);
-          auto data = CryptographicBuffer::EncodeToBase64String(buffer);
-
-          responseData += winrt::to_string(std::wstring_view(data));
+          AppendUnconsumedBytes(reader, pendingBytes);
+          const auto encodedSize = pendingBytes.size() - pendingBytes.size() % 3;
+          Utilities::AppendBase64(
+              std::string_view(reinterpret_cast<const char *>(pendingBytes.data()), encodedSize), responseData);
+          pendingBytes.erase(pendingBytes.begin(), pendingBytes.begin() + encodedSize);
 
           if (self->m_onDataProgress) {
             // For total, see #10849
@@ -594,8 +854,18 @@ WinRTHttpResource::PerformSendRequest(HttpMethod &&method, Uri &&rtUri, IInspect
         }
       }
 
-      // If dealing with text-incremental response data, use m_onIncrementalData instead
-      if (self->m_onData && !(reqArgs->IncrementalUpdates && isText)) {
+      Utilities::AppendBase64(
+          std::string_view(reinterpret_cast<const char *>(pendingBytes.data()), pendingBytes.size()), responseData);
+
+      std::optional<JSValue> jsonData;
+      if (isJson && !reqArgs->IncrementalUpdates && self->m_onJsonData) {
+        jsonData = TryParseJson(responseData);
+      }
+
+      if (jsonData) {
+        self->m_onJsonData(reqArgs->RequestId, std::move(*jsonData));
+      } else if (self->m_onData && !(reqArgs->IncrementalUpdates && isText)) {
+        // If dealing with text-incremental response data, use m_onIncrementalData instead
         self->m_onData(reqArgs->RequestId, std::move(responseData));
       }
 
@@ -664,20 +934,46 @@ void WinRTHttpResource::AddResponseHandler(shared_ptr<IResponseHandler> response
     defaultUserAgent = winrt::to_hstring(userAgent);
   }
 
-  auto redirFilter = winrt::make<RedirectHttpFilter>(defaultUserAgent);
-  HttpClient client;
+  winrt::com_ptr<WinHttpFilter> transportFilter;
+  winrt::Windows::Web::Http::Filters::IHttpFilter redirFilter{nullptr};
+  if (GetRuntimeOptionBool("Http.WinHttp")) {
+    WinHttpFilter::Options transportOptions;
+    transportOptions.MaxConnectionsPerServer =
+        static_cast<uint32_t>(std::max(0, GetRuntimeOptionInt("Http.WinHttp.MaxConnectionsPerServer")));
+    transportOptions.EnableHttp2 = !GetRuntimeOptionBool("Http.WinHttp.DisableHttp2");
+    transportOptions.DisableStreamQueue = GetRuntimeOptionBool("Http.WinHttp.DisableStreamQueue");
+    transportFilter = winrt::make_self<WinHttpFilter>(transportOptions);
+
+    // The transport adds no credentials of its own, so the requests after a redirect can share its connections
+    redirFilter = winrt::make<RedirectHttpFilter>(
+        transportFilter.as<winrt::Windows::Web::Http::Filters::IHttpFilter>(),
+        transportFilter.as<winrt::Windows::Web::Http::Filters::IHttpFilter>(),
+        defaultUserAgent);
+  } else {
+    redirFilter = winrt::make<RedirectHttpFilter>(defaultUserAgent);
+  }
+  winrt::Windows::Web::Http::Filters::IHttpFilter filter;
 
   if (static_cast<OriginPolicy>(GetRuntimeOptionInt("Http.OriginPolicy")) == OriginPolicy::None) {
-    client = HttpClient{redirFilter};
+    filter = redirFilter;
   } else {
     auto globalOrigin = GetRuntimeOptionString("Http.GlobalOrigin");
     auto opFilter = winrt::make<OriginPolicyHttpFilter>(std::move(globalOrigin), redirFilter);
     redirFilter.as<RedirectHttpFilter>()->SetRedirectSource(opFilter.as<IRedirectEventSource>());
 
-    client = HttpClient{opFilter};
+    filter = opFilter;
   }
 
-  auto result = std::make_shared<WinRTHttpResource>(std::move(client));
+  // The response cache stores responses after origin policy validation
+  if (GetRuntimeOptionBool("Http.ResponseCache")) {
+    auto cacheSize = GetRuntimeOptionInt("Http.ResponseCacheSize");
+    filter = winrt::make<CachingHttpFilter>(
+        filter, cacheSize > 0 ? static_cast<size_t>(cacheSize) : defaultResponseCacheSize);
+  }
+
+  HttpClient client{filter};
+
+  auto result = std::make_shared<WinRTHttpResource>(std::move(client), std::move(transportFilter));
 
   // Allow redirect filter to create requests based on the resource's state
   redirFilter.as<RedirectHttpFilter>()->SetRequestFactory(weak_ptr<IWinRTHttpRequestFactory>{result});
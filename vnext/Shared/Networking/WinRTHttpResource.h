@@ -7,7 +7,9 @@
 
 #include "HttpSettings.g.h"
 #include <Modules/IHttpModuleProxy.h>
+#include "HttpRequestScheduler.h"
 #include "IWinRTHttpRequestFactory.h"
+#include "WinHttpFilter.h"
 #include "WinRTTypes.h"
 
 // Windows API
@@ -23,17 +25,30 @@ class WinRTHttpResource : public IHttpResource,
                           public IWinRTHttpRequestFactory,
                           public std::enable_shared_from_this<WinRTHttpResource> {
   winrt::Windows::Web::Http::IHttpClient m_client;
+  // Set when the requests are sent through WinHTTP
+  winrt::com_ptr<WinHttpFilter> m_transportFilter;
   std::mutex m_mutex;
   std::unordered_map<int64_t, ResponseOperation> m_responses;
+  // Requests waiting in the HttpRequestScheduler for their origin
+  std::unordered_map<int64_t, HttpRequestScheduler::RequestId> m_queuedRequests;
+  std::unordered_map<int64_t, std::shared_ptr<ResponseStreamWindow>> m_streamWindows;
 
   std::function<void(int64_t requestId)> m_onRequestSuccess;
   std::function<void(int64_t requestId, Response &&response)> m_onResponse;
   std::function<void(int64_t requestId, std::string &&responseData)> m_onData;
   std::function<void(int64_t requestId, winrt::Microsoft::ReactNative::JSValueObject &&responseData)> m_onDataObject;
+  std::function<void(int64_t requestId, winrt::Microsoft::ReactNative::JSValue &&responseData)> m_onJsonData;
   std::function<void(int64_t requestId, std::string &&errorMessage, bool isTimeout)> m_onError;
   std::function<void(int64_t requestId, std::string &&responseData, int64_t progress, int64_t total)>
       m_onIncrementalData;
+  std::function<void(
+      int64_t requestId,
+      winrt::Windows::Storage::Streams::IBuffer &&responseData,
+      int64_t progress,
+      int64_t total)>
+      m_onIncrementalBinaryData;
   std::function<void(int64_t requestId, int64_t progress, int64_t total)> m_onDataProgress;
+  std::function<void(int64_t requestId, int64_t progress, int64_t total)> m_onDataSent;
   std::function<void(int64_t requestId)> m_onComplete;
 
   // Used for IHttpModuleProxy
@@ -45,16 +60,25 @@ class WinRTHttpResource : public IHttpResource,
 
   void UntrackResponse(int64_t requestId) noexcept;
 
+  std::shared_ptr<ResponseStreamWindow> TrackStreamWindow(int64_t requestId) noexcept;
+
+  void UntrackStreamWindow(int64_t requestId) noexcept;
+
   winrt::fire_and_forget PerformSendRequest(
       winrt::Windows::Web::Http::HttpMethod &&method,
       winrt::Windows::Foundation::Uri &&uri,
-      winrt::Windows::Foundation::IInspectable const &args) noexcept;
+      winrt::Windows::Foundation::IInspectable const &args,
+      HttpRequestScheduler::Slot slot) noexcept;
 
  public:
   WinRTHttpResource() noexcept;
 
   WinRTHttpResource(winrt::Windows::Web::Http::IHttpClient &&client) noexcept;
 
+  WinRTHttpResource(
+      winrt::Windows::Web::Http::IHttpClient &&client,
+      winrt::com_ptr<WinHttpFilter> &&transportFilter) noexcept;
+
 #pragma region IWinRTHttpRequestFactory
 
   winrt::Windows::Foundation::IAsyncOperation<winrt::Windows::Web::Http::HttpRequestMessage> CreateRequest(
@@ -79,18 +103,30 @@ class WinRTHttpResource : public IHttpResource,
       bool withCredentials,
       std::function<void(int64_t)> &&callback) noexcept override;
   void AbortRequest(int64_t requestId) noexcept override;
+  void AcknowledgeIncrementalData(int64_t requestId, int64_t byteCount) noexcept override;
   void ClearCookies() noexcept override;
+  void Preconnect(std::string &&url) noexcept override;
 
   void SetOnRequestSuccess(std::function<void(int64_t requestId)> &&handler) noexcept override;
   void SetOnResponse(std::function<void(int64_t requestId, Response &&response)> &&handler) noexcept override;
   void SetOnData(std::function<void(int64_t requestId, std::string &&responseData)> &&handler) noexcept override;
   void SetOnData(std::function<void(int64_t requestId, winrt::Microsoft::ReactNative::JSValueObject &&responseData)>
                      &&handler) noexcept override;
+  void SetOnJsonData(std::function<void(int64_t requestId, winrt::Microsoft::ReactNative::JSValue &&responseData)>
+                         &&handler) noexcept override;
   void SetOnIncrementalData(
       std::function<void(int64_t requestId, std::string &&responseData, int64_t progress, int64_t total)>
           &&handler) noexcept override;
+  void SetOnIncrementalBinaryData(
+      std::function<void(
+          int64_t requestId,
+          winrt::Windows::Storage::Streams::IBuffer &&responseData,
+          int64_t progress,
+          int64_t total)> &&handler) noexcept override;
   void SetOnDataProgress(
       std::function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept override;
+  void SetOnDataSent(
+      std::function<void(int64_t requestId, int64_t progress, int64_t total)> &&handler) noexcept override;
   void SetOnResponseComplete(std::function<void(int64_t requestId)> &&handler) noexcept override;
   void SetOnError(
       std::function<void(int64_t requestId, std::string &&errorMessage, bool isTimeout)> &&handler) noexcept override;
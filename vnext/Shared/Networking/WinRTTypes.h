@@ -12,6 +12,7 @@
 #include <winrt/Windows.Web.Http.h>
 
 // Standard Library
+#include <atomic>
 #include <mutex>
 
 namespace Microsoft::React::Networking {
@@ -26,8 +27,28 @@ struct RequestArgs : public winrt::implements<RequestArgs, winrt::Windows::Found
   int64_t Timeout;
 };
 
+// Flow control state of a response streamed in binary chunks
+struct ResponseStreamWindow {
+  // Delivered bytes not yet acknowledged by the consumer
+  std::atomic<int64_t> PendingBytes{0};
+  std::atomic<bool> Aborted{false};
+  // Auto-reset event signaled on acknowledgement or abort
+  winrt::handle Signal{::CreateEventW(nullptr, false, false, nullptr)};
+};
+
 typedef winrt::Windows::Foundation::
     IAsyncOperationWithProgress<winrt::Windows::Web::Http::HttpResponseMessage, winrt::Windows::Web::Http::HttpProgress>
         ResponseOperation;
 
+// Reports the progress of an inner filter's operation through the progress token of the calling coroutine.
+template <typename TProgressToken>
+ResponseOperation ForwardProgress(ResponseOperation &&operation, TProgressToken const &progress) {
+  operation.Progress(
+      [progress](ResponseOperation const & /*sender*/, winrt::Windows::Web::Http::HttpProgress const &value) {
+        progress(value);
+      });
+
+  return std::move(operation);
+}
+
 } // namespace Microsoft::React::Networking
@@ -3,6 +3,7 @@
 
 #include "WinRTWebSocketResource.h"
 
+#include <CppRuntimeOptions.h>
 #include <Utilities.h>
 #include <Utils/CppWinrtLessExceptions.h>
 #include <Utils/WinRTConversions.h>
@@ -17,7 +18,6 @@
 #include <windows.Networking.Sockets.h>
 #include <windows.Storage.Streams.h>
 #include <winrt/Windows.Foundation.Collections.h>
-#include <winrt/Windows.Security.Cryptography.h>
 
 using Microsoft::Common::Utilities::CheckedReinterpretCast;
 
@@ -27,6 +27,7 @@ using std::function;
 using std::lock_guard;
 using std::mutex;
 using std::string;
+using std::string_view;
 using std::vector;
 
 using winrt::fire_and_forget;
@@ -44,7 +45,6 @@ using winrt::Windows::Networking::Sockets::IWebSocketClosedEventArgs;
 using winrt::Windows::Networking::Sockets::MessageWebSocket;
 using winrt::Windows::Networking::Sockets::SocketMessageType;
 using winrt::Windows::Networking::Sockets::WebSocketClosedEventArgs;
-using winrt::Windows::Security::Cryptography::CryptographicBuffer;
 using winrt::Windows::Security::Cryptography::Certificates::ChainValidationResult;
 using winrt::Windows::Storage::Streams::DataWriter;
 using winrt::Windows::Storage::Streams::DataWriterStoreOperation;
@@ -82,6 +82,9 @@ auto resume_in_queue(const DispatchQueue &queue) noexcept {
   return awaitable{queue};
 } // resume_in_queue
 
+// Default limit of queued outgoing bytes, overridable with the WebSocket.MaxBufferedAmount runtime option
+constexpr size_t defaultMaxBufferedAmount = 16 * 1024 * 1024;
+
 DispatchQueue GetCurrentOrSerialQueue() noexcept {
   auto queue = DispatchQueue::CurrentQueue();
   if (!queue)
@@ -104,6 +107,9 @@ WinRTWebSocketResource2::WinRTWebSocketResource2(
       m_writer(std::move(writer)),
       m_readyState{ReadyState::Connecting},
       m_callingQueue{callingQueue} {
+  auto maxBufferedAmount = GetRuntimeOptionInt("WebSocket.MaxBufferedAmount");
+  m_maxBufferedAmount = maxBufferedAmount > 0 ? static_cast<size_t>(maxBufferedAmount) : defaultMaxBufferedAmount;
+
   for (const auto &certException : certExceptions) {
     m_socket.Control().IgnorableServerCertificateErrors().Append(certException);
   }
@@ -179,25 +185,39 @@ void WinRTWebSocketResource2::OnMessageReceived(
     return;
   }
 
+  vector<uint8_t> binaryResponse;
+  bool isRawBinary = args.MessageType() == SocketMessageType::Binary && self->m_binaryReadHandler;
   try {
     auto len = reader.UnconsumedBufferLength();
     if (args.MessageType() == SocketMessageType::Utf8) {
       reader.UnicodeEncoding(UnicodeEncoding::Utf8);
+      // Text messages are read straight into the string that is delivered, so that a large message is only copied once
+      response.resize(len);
+      reader.ReadBytes(winrt::array_view<uint8_t>(CheckedReinterpretCast<uint8_t *>(response.data()), len));
+    } else if (isRawBinary) {
+      binaryResponse.resize(len);
+      reader.ReadBytes(binaryResponse);
+    } else {
       vector<uint8_t> data(len);
       reader.ReadBytes(data);
 
-      response = string(CheckedReinterpretCast<char *>(data.data()), data.size());
-    } else {
-      auto buffer = reader.ReadBuffer(len);
-      auto data = CryptographicBuffer::EncodeToBase64String(buffer);
-
-      response = winrt::to_string(std::wstring_view(data));
+      Utilities::AppendBase64(string_view(CheckedReinterpretCast<char *>(data.data()), data.size()), response);
     }
   } catch (hresult_error const &e) {
     return self->Fail(e, ErrorType::Receive);
   }
 
   // Posting inside try-catch block causes errors.
+  if (isRawBinary) {
+    self->m_callingQueue.Post([self, binaryResponse = std::move(binaryResponse)]() mutable {
+      if (self->m_binaryReadHandler) {
+        self->m_binaryReadHandler(std::move(binaryResponse));
+      }
+    });
+
+    return;
+  }
+
   self->m_callingQueue.Post([self, response = std::move(response), messageType = args.MessageType()]() {
     if (self->m_readHandler) {
       self->m_readHandler(response.length(), response, messageType == SocketMessageType::Binary);
@@ -273,58 +293,94 @@ fire_and_forget WinRTWebSocketResource2::PerformClose() noexcept {
   });
 }
 
-fire_and_forget WinRTWebSocketResource2::EnqueueWrite(string &&message, bool isBinary) noexcept {
+void WinRTWebSocketResource2::EnqueueWrite(vector<uint8_t> &&message, SocketMessageType type) noexcept {
+  auto length = message.size();
+
+  // See https://websockets.spec.whatwg.org/#dom-websocket-send
+  // If the data cannot be buffered because the buffer is full, the connection is closed.
+  if (m_bufferedAmount.fetch_add(length) + length > m_maxBufferedAmount) {
+    m_bufferedAmount -= length;
+    Close(CloseCode::GoingAway, "Send buffer is full");
+
+    return Fail("Send buffer is full", ErrorType::Send);
+  }
+
+  bool scheduleWrites;
+  {
+    lock_guard<mutex> guard{m_writeQueueMutex};
+    m_writeQueue.push_back({std::move(message), type});
+
+    // A single sequenced task flushes every write queued until it runs.
+    scheduleWrites = !m_writeScheduled;
+    m_writeScheduled = true;
+  }
+
+  if (scheduleWrites) {
+    PerformWrites();
+  }
+}
+
+fire_and_forget WinRTWebSocketResource2::PerformWrites() noexcept {
   auto self = shared_from_this();
-  string coMessage = std::move(message);
 
   co_await resume_in_queue(self->m_backgroundQueue);
 
-  co_await self->m_sequencer.QueueTaskAsync(
-      [self = self->shared_from_this(), message = std::move(coMessage), isBinary]() -> IAsyncAction {
-        auto coSelf = self->shared_from_this();
-        auto coMessage = std::move(message);
+  co_await self->m_sequencer.QueueTaskAsync([self = self->shared_from_this()]() -> IAsyncAction {
+    auto coSelf = self->shared_from_this();
 
-        co_await coSelf->PerformWrite(std::move(coMessage), isBinary);
-      });
+    co_await coSelf->FlushWriteQueue();
+  });
 }
 
-IAsyncAction WinRTWebSocketResource2::PerformWrite(string &&message, bool isBinary) noexcept {
+IAsyncAction WinRTWebSocketResource2::FlushWriteQueue() noexcept {
   auto self = shared_from_this();
+  std::deque<PendingWrite> writes;
 
-  try {
-    if (isBinary) {
-      self->m_socket.Control().MessageType(SocketMessageType::Binary);
-
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(message));
-      if (buffer) {
-        self->m_writer.WriteBuffer(buffer);
+  while (true) {
+    {
+      lock_guard<mutex> guard{self->m_writeQueueMutex};
+      if (self->m_writeQueue.empty()) {
+        self->m_writeScheduled = false;
+        co_return;
       }
-    } else {
-      self->m_socket.Control().MessageType(SocketMessageType::Utf8);
 
-      winrt::array_view<const uint8_t> view(
-          CheckedReinterpretCast<const uint8_t *>(message.c_str()),
-          CheckedReinterpretCast<const uint8_t *>(message.c_str()) + message.length());
-      self->m_writer.WriteBytes(view);
+      writes.swap(self->m_writeQueue);
     }
-  } catch (hresult_error const &e) { // TODO: Remove after fixing unit tests exceptions.
-    self->Fail(e, ErrorType::Send);
-  } catch (const std::exception &e) {
-    self->Fail(e.what(), ErrorType::Send);
-  }
 
-  co_await resume_in_queue(self->m_backgroundQueue);
-  // If an exception occurred, abort write process.
-  if (self->m_readyState != ReadyState::Open) {
-    co_return;
-  }
+    co_await resume_in_queue(self->m_backgroundQueue);
+
+    // Each write is stored separately, as every DataWriter store is sent as one WebSocket message.
+    for (auto &write : writes) {
+      auto length = write.Data.size();
+
+      // If an exception occurred, abort write process.
+      if (self->m_readyState == ReadyState::Open) {
+        bool written = false;
+        try {
+          self->m_socket.Control().MessageType(write.Type);
+          self->m_writer.WriteBytes(write.Data);
+          written = true;
+        } catch (hresult_error const &e) { // TODO: Remove after fixing unit tests exceptions.
+          self->Fail(e, ErrorType::Send);
+        } catch (const std::exception &e) {
+          self->Fail(e.what(), ErrorType::Send);
+        }
 
-  auto async = self->m_writer.StoreAsync();
-  co_await lessthrow_await_adapter<DataWriterStoreOperation>{async};
+        if (written) {
+          auto async = self->m_writer.StoreAsync();
+          co_await lessthrow_await_adapter<DataWriterStoreOperation>{async};
 
-  auto result = async.ErrorCode();
-  if (result < 0) {
-    self->Fail(std::move(result), ErrorType::Send);
+          auto result = async.ErrorCode();
+          if (result < 0) {
+            self->Fail(std::move(result), ErrorType::Send);
+          }
+        }
+      }
+
+      self->m_bufferedAmount -= length;
+    }
+
+    writes.clear();
   }
 }
 
@@ -387,11 +443,20 @@ void WinRTWebSocketResource2::Connect(string &&url, const Protocols &protocols,
 void WinRTWebSocketResource2::Ping() noexcept {}
 
 void WinRTWebSocketResource2::Send(string &&message) noexcept {
-  EnqueueWrite(std::move(message), false);
+  EnqueueWrite(vector<uint8_t>(message.cbegin(), message.cend()), SocketMessageType::Utf8);
 }
 
 void WinRTWebSocketResource2::SendBinary(string &&base64String) noexcept {
-  EnqueueWrite(std::move(base64String), true);
+  vector<uint8_t> message;
+  if (!Utilities::TryDecodeBase64(base64String, message)) {
+    return Fail("Invalid Base64 message", ErrorType::Send);
+  }
+
+  EnqueueWrite(std::move(message), SocketMessageType::Binary);
+}
+
+void WinRTWebSocketResource2::SendBinary(vector<uint8_t> &&message) noexcept {
+  EnqueueWrite(std::move(message), SocketMessageType::Binary);
 }
 
 void WinRTWebSocketResource2::Close(CloseCode code, const string &reason) noexcept {
@@ -404,6 +469,10 @@ IWebSocketResource::ReadyState WinRTWebSocketResource2::GetReadyState() const no
   return m_readyState;
 }
 
+size_t WinRTWebSocketResource2::GetBufferedAmount() const noexcept {
+  return m_bufferedAmount;
+}
+
 void WinRTWebSocketResource2::SetOnConnect(function<void()> &&handler) noexcept {
   m_connectHandler = std::move(handler);
 }
@@ -416,6 +485,10 @@ void WinRTWebSocketResource2::SetOnMessage(function<void(size_t, const string &,
   m_readHandler = std::move(handler);
 }
 
+void WinRTWebSocketResource2::SetOnBinaryMessage(function<void(vector<uint8_t> &&)> &&handler) noexcept {
+  m_binaryReadHandler = std::move(handler);
+}
+
 void WinRTWebSocketResource2::SetOnClose(function<void(CloseCode, const string &)> &&handler) noexcept {
   m_closeHandler = std::move(handler);
 }
@@ -563,11 +636,15 @@ fire_and_forget WinRTWebSocketResource::PerformWrite(string &&message, bool isBi
     if (isBinaryLocal) {
       self->m_socket.Control().MessageType(SocketMessageType::Binary);
 
-      auto buffer = CryptographicBuffer::DecodeFromBase64String(winrt::to_hstring(messageLocal));
-      if (buffer) {
-        length = buffer.Length();
-        self->m_writer.WriteBuffer(buffer);
+      vector<uint8_t> bytes;
+      if (!Utilities::TryDecodeBase64(messageLocal, bytes)) {
+        if (self->m_errorHandler) {
+          self->m_errorHandler({"Invalid Base64 message", ErrorType::Send});
+        }
+        co_return;
       }
+      length = bytes.size();
+      self->m_writer.WriteBytes(bytes);
     } else {
       self->m_socket.Control().MessageType(SocketMessageType::Utf8);
 
@@ -675,11 +752,17 @@ void WinRTWebSocketResource::Connect(string &&url, const Protocols &protocols, c
         reader.ReadBytes(data);
 
         response = string(CheckedReinterpretCast<char *>(data.data()), data.size());
+      } else if (self->m_binaryReadHandler) {
+        vector<uint8_t> data(len);
+        reader.ReadBytes(data);
+
+        self->m_binaryReadHandler(std::move(data));
+        return;
       } else {
-        auto buffer = reader.ReadBuffer(len);
-        hstring data = CryptographicBuffer::EncodeToBase64String(buffer);
+        vector<uint8_t> data(len);
+        reader.ReadBytes(data);
 
-        response = winrt::to_string(std::wstring_view(data));
+        Utilities::AppendBase64(string_view(CheckedReinterpretCast<char *>(data.data()), data.size()), response);
       }
 
       if (self->m_readHandler) {
@@ -765,6 +848,12 @@ void WinRTWebSocketResource::SendBinary(string &&base64String) noexcept {
   PerformWrite(std::move(base64String), true);
 }
 
+void WinRTWebSocketResource::SendBinary(vector<uint8_t> &&message) noexcept {
+  // The legacy write queue only holds Base64 binary messages.
+  PerformWrite(
+      Utilities::EncodeBase64(string_view(CheckedReinterpretCast<const char *>(message.data()), message.size())), true);
+}
+
 void WinRTWebSocketResource::Close(CloseCode code, const string &reason) noexcept {
   if (m_readyState == ReadyState::Closing || m_readyState == ReadyState::Closed)
     return;
@@ -781,6 +870,11 @@ IWebSocketResource::ReadyState WinRTWebSocketResource::GetReadyState() const noe
   return m_readyState;
 }
 
+size_t WinRTWebSocketResource::GetBufferedAmount() const noexcept {
+  // Not tracked by this implementation.
+  return 0;
+}
+
 void WinRTWebSocketResource::SetOnConnect(function<void()> &&handler) noexcept {
   m_connectHandler = std::move(handler);
 }
@@ -797,6 +891,10 @@ void WinRTWebSocketResource::SetOnMessage(function<void(size_t, const string &,
   m_readHandler = std::move(handler);
 }
 
+void WinRTWebSocketResource::SetOnBinaryMessage(function<void(vector<uint8_t> &&)> &&handler) noexcept {
+  m_binaryReadHandler = std::move(handler);
+}
+
 void WinRTWebSocketResource::SetOnClose(function<void(CloseCode, const string &)> &&handler) noexcept {
   m_closeHandler = std::move(handler);
 }
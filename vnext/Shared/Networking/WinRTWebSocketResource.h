@@ -10,6 +10,7 @@
 #include "IWebSocketResource.h"
 
 // Standard Library
+#include <deque>
 #include <future>
 #include <mutex>
 #include <queue>
@@ -118,11 +119,23 @@ class WinRTWebSocketResource2 : public IWebSocketResource,
 
   std::function<void()> m_connectHandler;
   std::function<void(std::size_t, const std::string &, bool)> m_readHandler;
+  std::function<void(std::vector<uint8_t> &&)> m_binaryReadHandler;
   std::function<void(CloseCode, const std::string &)> m_closeHandler;
   std::function<void(Error &&)> m_errorHandler;
 
   winrt::Windows::Storage::Streams::IDataWriter m_writer;
 
+  struct PendingWrite {
+    std::vector<uint8_t> Data;
+    winrt::Windows::Networking::Sockets::SocketMessageType Type;
+  };
+
+  std::mutex m_writeQueueMutex;
+  std::deque<PendingWrite> m_writeQueue;
+  bool m_writeScheduled{false};
+  std::atomic<std::size_t> m_bufferedAmount{0};
+  std::size_t m_maxBufferedAmount;
+
   void Fail(std::string &&message, ErrorType type) noexcept;
   void Fail(winrt::hresult &&e, ErrorType type) noexcept;
   void Fail(winrt::hresult_error const &e, ErrorType type) noexcept;
@@ -136,8 +149,11 @@ class WinRTWebSocketResource2 : public IWebSocketResource,
       winrt::Windows::Networking::Sockets::IWebSocketClosedEventArgs const &args);
 
   winrt::fire_and_forget PerformConnect(winrt::Windows::Foundation::Uri &&uri) noexcept;
-  winrt::fire_and_forget EnqueueWrite(std::string &&message, bool isBinary) noexcept;
-  winrt::Windows::Foundation::IAsyncAction PerformWrite(std::string &&message, bool isBinary) noexcept;
+  void EnqueueWrite(
+      std::vector<uint8_t> &&message,
+      winrt::Windows::Networking::Sockets::SocketMessageType type) noexcept;
+  winrt::fire_and_forget PerformWrites() noexcept;
+  winrt::Windows::Foundation::IAsyncAction FlushWriteQueue() noexcept;
   winrt::fire_and_forget PerformClose() noexcept;
 
   WinRTWebSocketResource2(
@@ -178,6 +194,11 @@ class WinRTWebSocketResource2 : public IWebSocketResource,
   /// </summary>
   void SendBinary(std::string &&base64String) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SendBinary" />
+  /// </summary>
+  void SendBinary(std::vector<uint8_t> &&message) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::Close" />
   /// </summary>
@@ -185,6 +206,11 @@ class WinRTWebSocketResource2 : public IWebSocketResource,
 
   ReadyState GetReadyState() const noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::GetBufferedAmount" />
+  /// </summary>
+  std::size_t GetBufferedAmount() const noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnConnect" />
   /// </summary>
@@ -205,6 +231,11 @@ class WinRTWebSocketResource2 : public IWebSocketResource,
   /// </summary>
   void SetOnMessage(std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SetOnBinaryMessage" />
+  /// </summary>
+  void SetOnBinaryMessage(std::function<void(std::vector<uint8_t> &&)> &&handler) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnClose" />
   /// </summary>
@@ -241,6 +272,7 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   std::function<void()> m_pingHandler;
   std::function<void(std::size_t)> m_writeHandler;
   std::function<void(std::size_t, const std::string &, bool)> m_readHandler;
+  std::function<void(std::vector<uint8_t> &&)> m_binaryReadHandler;
   std::function<void(CloseCode, const std::string &)> m_closeHandler;
   std::function<void(Error &&)> m_errorHandler;
 
@@ -288,6 +320,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   /// </summary>
   void SendBinary(std::string &&base64String) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SendBinary" />
+  /// </summary>
+  void SendBinary(std::vector<uint8_t> &&message) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::Close" />
   /// </summary>
@@ -295,6 +332,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
 
   ReadyState GetReadyState() const noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::GetBufferedAmount" />
+  /// </summary>
+  std::size_t GetBufferedAmount() const noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnConnect" />
   /// </summary>
@@ -315,6 +357,11 @@ class WinRTWebSocketResource : public IWebSocketResource, public std::enable_sha
   /// </summary>
   void SetOnMessage(std::function<void(std::size_t, const std::string &, bool isBinary)> &&handler) noexcept override;
 
+  /// <summary>
+  /// <see cref="IWebSocketResource::SetOnBinaryMessage" />
+  /// </summary>
+  void SetOnBinaryMessage(std::function<void(std::vector<uint8_t> &&)> &&handler) noexcept override;
+
   /// <summary>
   /// <see cref="IWebSocketResource::SetOnClose" />
   /// </summary>
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <iterator>
+#include <utility>
+#include "BatchingMessageQueue.h"
+
+namespace Mso::React {
+
+// The queue whose batch is running on this thread, if any
+static thread_local const BatchingMessageQueue *t_runningBatchQueue = nullptr;
+
+BatchingMessageQueue::BatchingMessageQueue(std::shared_ptr<facebook::react::MessageQueueThread> innerQueue) noexcept
+    : m_innerQueue{std::move(innerQueue)} {}
+
+void BatchingMessageQueue::runOnQueue(std::function<void()> &&func) {
+  bool startBatch;
+  {
+    std::scoped_lock lock{m_mutex};
+    startBatch = m_batch.empty();
+    m_batch.push_back(std::move(func));
+  }
+
+  if (startBatch) {
+    postBatch();
+  }
+}
+
+void BatchingMessageQueue::postBatch() {
+  m_innerQueue->runOnQueue([weakThis = weak_from_this()]() {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->runBatch();
+    }
+  });
+}
+
+void BatchingMessageQueue::runBatch() {
+  std::vector<std::function<void()>> batch;
+  {
+    std::scoped_lock lock{m_mutex};
+    batch.swap(m_batch);
+  }
+
+  auto outerBatchQueue = std::exchange(t_runningBatchQueue, this);
+  for (size_t i = 0; i < batch.size(); ++i) {
+    try {
+      batch[i]();
+    } catch (...) {
+      t_runningBatchQueue = outerBatchQueue;
+
+      // The tasks after the one that threw still run, ahead of the ones posted since, and the exception is left to the
+      // inner queue to report
+      bool startBatch;
+      {
+        std::scoped_lock lock{m_mutex};
+        startBatch = m_batch.empty() && i + 1 < batch.size();
+        m_batch.insert(
+            m_batch.begin(), std::make_move_iterator(batch.begin() + i + 1), std::make_move_iterator(batch.end()));
+      }
+
+      if (startBatch) {
+        postBatch();
+      }
+      throw;
+    }
+  }
+  t_runningBatchQueue = outerBatchQueue;
+}
+
+void BatchingMessageQueue::runOnQueueSync(std::function<void()> &&func) {
+  // From a task of the running batch, the inner queue runs func inline.  Running the batch there would run the tasks
+  // posted since then ahead of the rest of the running batch, so the batch is left to the task already posted for it.
+  bool inBatch = t_runningBatchQueue == this;
+  m_innerQueue->runOnQueueSync([this, inBatch, &func]() {
+    if (!inBatch) {
+      runBatch();
+    }
+    func();
+  });
+}
+
+void BatchingMessageQueue::quitSynchronous() {
+  {
+    std::scoped_lock lock{m_mutex};
+    m_batch.clear();
+  }
+  m_innerQueue->quitSynchronous();
+}
+
+} // namespace Mso::React
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cxxreact/MessageQueueThread.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mso::React {
+
+// Coalesces the tasks run on it into as few tasks of the inner queue as possible.  The first task starts a batch, which
+// is posted to the inner queue, and the tasks that follow join it until the inner queue starts running it, so the tasks
+// posted in one JS turn usually run as one task.  The tasks run in the order they were posted, which is why the tasks
+// that have to be ordered with the batched ones, like the mount transactions, are run on this queue too.
+struct BatchingMessageQueue : facebook::react::MessageQueueThread,
+                              std::enable_shared_from_this<BatchingMessageQueue> {
+  BatchingMessageQueue(std::shared_ptr<facebook::react::MessageQueueThread> innerQueue) noexcept;
+
+ public: // MessageQueueThread implementation
+  void runOnQueue(std::function<void()> &&func) override;
+
+  // The pending batch is run first, so that the tasks still run in order, unless this is called from a task of the
+  // running batch
+  void runOnQueueSync(std::function<void()> &&func) override;
+
+  void quitSynchronous() override;
+
+ private:
+  void postBatch();
+  void runBatch();
+
+ private:
+  const std::shared_ptr<facebook::react::MessageQueueThread> m_innerQueue;
+  std::mutex m_mutex;
+  // A task that runs the batch is pending on the inner queue whenever the batch is not empty
+  std::vector<std::function<void()>> m_batch;
+};
+
+} // namespace Mso::React
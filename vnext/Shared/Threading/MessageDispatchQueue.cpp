@@ -16,11 +16,13 @@ namespace Mso::React {
 MessageDispatchQueue::MessageDispatchQueue(
     Mso::DispatchQueue const &dispatchQueue,
     Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-    Mso::Promise<void> &&whenQuit) noexcept
+    Mso::Promise<void> &&whenQuit,
+    std::shared_ptr<Mso::DispatchQueueMetrics> metrics) noexcept
     : m_dispatchQueue{dispatchQueue},
       m_stopped{false},
       m_errorHandler{std::move(errorHandler)},
-      m_whenQuit{std::move(whenQuit)} {}
+      m_whenQuit{std::move(whenQuit)},
+      m_metrics{std::move(metrics)} {}
 
 MessageDispatchQueue::~MessageDispatchQueue() noexcept {}
 
@@ -29,11 +31,17 @@ void MessageDispatchQueue::runOnQueue(std::function<void()> &&func) {
     return;
   }
 
-  m_dispatchQueue.Post([pThis = shared_from_this(), func = std::move(func)]() noexcept {
+  Mso::DispatchTask task{[pThis = shared_from_this(), func = std::move(func)]() noexcept {
     if (!pThis->m_stopped) {
       pThis->tryFunc(func);
     }
-  });
+  }};
+
+  if (m_metrics) {
+    task = Mso::MakeMeasuredDispatchTask(m_metrics, std::move(task));
+  }
+
+  m_dispatchQueue.Post(std::move(task));
 }
 
 void MessageDispatchQueue::tryFunc(const std::function<void()> &func) noexcept {
@@ -95,11 +103,13 @@ void MessageDispatchQueue::quitSynchronous() {
 MessageDispatchQueue2::MessageDispatchQueue2(
     Mso::React::IDispatchQueue2 &dispatchQueue,
     Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-    Mso::Promise<void> &&whenQuit) noexcept
+    Mso::Promise<void> &&whenQuit,
+    std::shared_ptr<Mso::DispatchQueueMetrics> metrics) noexcept
     : m_stopped{false},
       m_errorHandler{std::move(errorHandler)},
       m_whenQuit{std::move(whenQuit)},
-      m_dispatchQueue{&dispatchQueue} {}
+      m_dispatchQueue{&dispatchQueue},
+      m_metrics{std::move(metrics)} {}
 
 MessageDispatchQueue2::~MessageDispatchQueue2() noexcept {}
 
@@ -108,11 +118,17 @@ void MessageDispatchQueue2::runOnQueue(std::function<void()> &&func) {
     return;
   }
 
-  m_dispatchQueue->Post([pThis = shared_from_this(), func = std::move(func)]() noexcept {
+  Mso::DispatchTask task{[pThis = shared_from_this(), func = std::move(func)]() noexcept {
     if (!pThis->m_stopped) {
       pThis->tryFunc(func);
     }
-  });
+  }};
+
+  if (m_metrics) {
+    task = Mso::MakeMeasuredDispatchTask(m_metrics, std::move(task));
+  }
+
+  m_dispatchQueue->Post(std::move(task));
 }
 
 void MessageDispatchQueue2::tryFunc(const std::function<void()> &func) noexcept {
@@ -5,6 +5,7 @@
 
 #include <IReactDispatcher.h>
 #include <cxxreact/MessageQueueThread.h>
+#include <dispatchQueue/dispatchQueueMetrics.h>
 #include <functional/FunctorRef.h>
 #include <future/Future.h>
 #include <memory>
@@ -15,7 +16,8 @@ struct MessageDispatchQueue : facebook::react::MessageQueueThread, std::enable_s
   MessageDispatchQueue(
       Mso::DispatchQueue const &dispatchQueue,
       Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-      Mso::Promise<void> &&whenQuit = nullptr) noexcept;
+      Mso::Promise<void> &&whenQuit = nullptr,
+      std::shared_ptr<Mso::DispatchQueueMetrics> metrics = nullptr) noexcept;
 
   ~MessageDispatchQueue() noexcept override;
 
@@ -42,6 +44,7 @@ struct MessageDispatchQueue : facebook::react::MessageQueueThread, std::enable_s
   Mso::DispatchQueue m_dispatchQueue;
   Mso::Functor<void(const Mso::ErrorCode &)> m_errorHandler;
   const Mso::Promise<void> m_whenQuit;
+  const std::shared_ptr<Mso::DispatchQueueMetrics> m_metrics; // Records the tasks posted with runOnQueue
 };
 
 struct MessageDispatchQueue2 : facebook::react::MessageQueueThread,
@@ -49,7 +52,8 @@ struct MessageDispatchQueue2 : facebook::react::MessageQueueThread,
   MessageDispatchQueue2(
       Mso::React::IDispatchQueue2 &dispatchQueue,
       Mso::Functor<void(const Mso::ErrorCode &)> &&errorHandler,
-      Mso::Promise<void> &&whenQuit = nullptr) noexcept;
+      Mso::Promise<void> &&whenQuit = nullptr,
+      std::shared_ptr<Mso::DispatchQueueMetrics> metrics = nullptr) noexcept;
 
   ~MessageDispatchQueue2() noexcept override;
 
@@ -72,6 +76,7 @@ struct MessageDispatchQueue2 : facebook::react::MessageQueueThread,
   Mso::CntPtr<Mso::React::IDispatchQueue2> m_dispatchQueue;
   Mso::Functor<void(const Mso::ErrorCode &)> m_errorHandler;
   const Mso::Promise<void> m_whenQuit;
+  const std::shared_ptr<Mso::DispatchQueueMetrics> m_metrics; // Records the tasks posted with runOnQueue
 };
 
 } // namespace Mso::React
@@ -3,6 +3,7 @@
 
 #include "pch.h"
 
+#include <JSI/V8CodeCacheStore.h>
 #include <V8JsiRuntime.h>
 #include "V8JSIRuntimeHolder.h"
 
@@ -59,7 +60,7 @@ void V8JSIRuntimeHolder::initRuntime() noexcept {
   args.debuggerRuntimeName = debuggerRuntimeName_;
 
   args.foreground_task_runner = std::make_shared<TaskRunnerAdapter>(jsQueue_);
-  args.preparedScriptStore = std::move(preparedScriptStore_);
+  args.preparedScriptStore = Microsoft::ReactNative::V8CodeCacheStore::Create(std::move(preparedScriptStore_));
   args.flags.enableMultiThread = enableMultiThreadingSupport_;
 
   runtime_ = v8runtime::makeV8Runtime(std::move(args));
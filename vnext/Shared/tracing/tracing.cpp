@@ -8,7 +8,11 @@
 #include <winmeta.h>
 #include "tracing/fbsystrace.h"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <iterator>
+#include <mutex>
 #include <string>
 
 // Define the GUID to use in TraceLoggingProviderRegister
@@ -391,6 +395,343 @@ void error(const char *msg) {
       g_hTraceLoggingProvider, "Trace", TraceLoggingLevel(WINEVENT_LEVEL_ERROR), TraceLoggingString(msg, "message"));
 }
 
+void logMountingTransaction(
+    int32_t surfaceId,
+    int64_t transactionNumber,
+    uint32_t createCount,
+    uint32_t deleteCount,
+    uint32_t insertCount,
+    uint32_t removeCount,
+    uint32_t updateCount,
+    uint32_t compositionObjectCreations,
+    uint32_t compositionPropertySets,
+    uint32_t compositionBrushUpdates,
+    double mountDurationMs,
+    double commitToMountLatencyMs) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "FabricMountingTransaction",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingInt32(surfaceId, "surfaceId"),
+      TraceLoggingInt64(transactionNumber, "transactionNumber"),
+      TraceLoggingUInt32(createCount, "createCount"),
+      TraceLoggingUInt32(deleteCount, "deleteCount"),
+      TraceLoggingUInt32(insertCount, "insertCount"),
+      TraceLoggingUInt32(removeCount, "removeCount"),
+      TraceLoggingUInt32(updateCount, "updateCount"),
+      TraceLoggingUInt32(compositionObjectCreations, "compositionObjectCreations"),
+      TraceLoggingUInt32(compositionPropertySets, "compositionPropertySets"),
+      TraceLoggingUInt32(compositionBrushUpdates, "compositionBrushUpdates"),
+      TraceLoggingFloat64(mountDurationMs, "mountDurationMs"),
+      TraceLoggingFloat64(commitToMountLatencyMs, "commitToMountLatencyMs"));
+}
+
+void logCompositionCommit(int32_t surfaceId, int64_t transactionNumber, double commitLatencyMs) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "FabricCompositionCommit",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingInt32(surfaceId, "surfaceId"),
+      TraceLoggingInt64(transactionNumber, "transactionNumber"),
+      TraceLoggingFloat64(commitLatencyMs, "commitLatencyMs"));
+}
+
+bool isMountTracing() {
+  return TraceLoggingProviderEnabled(g_hTraceLoggingProvider, WINEVENT_LEVEL_INFO, 0);
+}
+
+void logImageLoad(const char *uri, uint64_t bodyBytes, uint64_t bytesCopied) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "FabricImageLoad",
+      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+      TraceLoggingString(uri, "uri"),
+      TraceLoggingUInt64(bodyBytes, "bodyBytes"),
+      TraceLoggingUInt64(bytesCopied, "bytesCopied"));
+}
+
+void logDispatchTask(
+    std::string_view queueName,
+    std::string_view taskName,
+    double waitTimeMs,
+    double runTimeMs,
+    uint64_t queueDepth) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "DispatchQueueTask",
+      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+      TraceLoggingCountedString(queueName.data(), static_cast<USHORT>(queueName.size()), "queueName"),
+      TraceLoggingCountedString(taskName.data(), static_cast<USHORT>(taskName.size()), "taskName"),
+      TraceLoggingFloat64(waitTimeMs, "waitTimeMs"),
+      TraceLoggingFloat64(runTimeMs, "runTimeMs"),
+      TraceLoggingUInt64(queueDepth, "queueDepth"));
+}
+
+void logLongTask(
+    std::string_view queueName,
+    std::string_view taskName,
+    std::string_view origin,
+    double waitTimeMs,
+    double runTimeMs,
+    std::string_view jsStack) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "LongTask",
+      TraceLoggingLevel(WINEVENT_LEVEL_WARNING),
+      TraceLoggingCountedString(queueName.data(), static_cast<USHORT>(queueName.size()), "queueName"),
+      TraceLoggingCountedString(taskName.data(), static_cast<USHORT>(taskName.size()), "taskName"),
+      TraceLoggingCountedString(origin.data(), static_cast<USHORT>(origin.size()), "origin"),
+      TraceLoggingFloat64(waitTimeMs, "waitTimeMs"),
+      TraceLoggingFloat64(runTimeMs, "runTimeMs"),
+      TraceLoggingCountedString(jsStack.data(), static_cast<USHORT>(jsStack.size()), "jsStack"));
+}
+
+void logPreparedScriptLoad(const char *sourceUrl, const char *prepareTag, bool hit) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "PreparedScriptLoad",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString(sourceUrl, "sourceUrl"),
+      TraceLoggingString(prepareTag, "prepareTag"),
+      TraceLoggingBool(hit, "hit"));
+}
+
+static_assert(sizeof(ActivityId) == sizeof(GUID));
+
+ActivityId logStartupPhaseStart(const char *phase) {
+  GUID activityId{};
+  EventActivityIdControl(EVENT_ACTIVITY_CTRL_CREATE_ID, &activityId);
+  TraceLoggingWriteActivity(
+      g_hTraceLoggingProvider,
+      "ReactStartupPhase",
+      &activityId,
+      nullptr,
+      TraceLoggingOpcode(WINEVENT_OPCODE_START),
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString(phase, "phase"));
+
+  ActivityId result;
+  memcpy(result.data(), &activityId, sizeof(activityId));
+  return result;
+}
+
+void logStartupPhaseStop(const char *phase, const ActivityId &activityId, double durationMs) {
+  TraceLoggingWriteActivity(
+      g_hTraceLoggingProvider,
+      "ReactStartupPhase",
+      reinterpret_cast<const GUID *>(activityId.data()),
+      nullptr,
+      TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString(phase, "phase"),
+      TraceLoggingFloat64(durationMs, "durationMs"));
+}
+
+void logBundleLoadStop(const ActivityId &activityId, double durationMs, uint64_t byteCount, bool cacheHit) {
+  TraceLoggingWriteActivity(
+      g_hTraceLoggingProvider,
+      "ReactStartupPhase",
+      reinterpret_cast<const GUID *>(activityId.data()),
+      nullptr,
+      TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString("BundleLoad", "phase"),
+      TraceLoggingFloat64(durationMs, "durationMs"),
+      TraceLoggingUInt64(byteCount, "byteCount"),
+      TraceLoggingBool(cacheHit, "cacheHit"));
+}
+
+ActivityId logJSSamplingProfileStart(int64_t profileTimeUs) {
+  GUID activityId{};
+  EventActivityIdControl(EVENT_ACTIVITY_CTRL_CREATE_ID, &activityId);
+  TraceLoggingWriteActivity(
+      g_hTraceLoggingProvider,
+      "JSSamplingProfile",
+      &activityId,
+      nullptr,
+      TraceLoggingOpcode(WINEVENT_OPCODE_START),
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingInt64(profileTimeUs, "profileTimeUs"));
+
+  ActivityId result;
+  memcpy(result.data(), &activityId, sizeof(activityId));
+  return result;
+}
+
+void logJSSamplingProfileStop(const ActivityId &activityId, int64_t profileTimeUs, uint64_t sampleCount) {
+  TraceLoggingWriteActivity(
+      g_hTraceLoggingProvider,
+      "JSSamplingProfile",
+      reinterpret_cast<const GUID *>(activityId.data()),
+      nullptr,
+      TraceLoggingOpcode(WINEVENT_OPCODE_STOP),
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingInt64(profileTimeUs, "profileTimeUs"),
+      TraceLoggingUInt64(sampleCount, "sampleCount"));
+}
+
+bool isReactPerfTracing() {
+  return TraceLoggingProviderEnabled(g_hTraceLoggingProvider, WINEVENT_LEVEL_VERBOSE, 0);
+}
+
+constexpr size_t ReactPerfEntryCapacity = 1024;
+
+std::mutex g_reactPerfEntriesMutex;
+std::vector<ReactPerfEntry> g_reactPerfEntries;
+// Where the next entry goes once the buffer is full, which is also the oldest entry
+size_t g_nextReactPerfEntry = 0;
+
+static void recordReactPerfEntry(ReactPerfEntry &&entry) {
+  std::scoped_lock lock{g_reactPerfEntriesMutex};
+  if (g_reactPerfEntries.size() < ReactPerfEntryCapacity) {
+    g_reactPerfEntries.push_back(std::move(entry));
+  } else {
+    g_reactPerfEntries[g_nextReactPerfEntry] = std::move(entry);
+  }
+  g_nextReactPerfEntry = (g_nextReactPerfEntry + 1) % ReactPerfEntryCapacity;
+}
+
+std::vector<ReactPerfEntry> getReactPerfEntries() {
+  std::scoped_lock lock{g_reactPerfEntriesMutex};
+  std::vector<ReactPerfEntry> entries;
+  entries.reserve(g_reactPerfEntries.size());
+  // Until the buffer is full, the next entry is past the end
+  auto oldest = g_reactPerfEntries.begin() + std::min(g_nextReactPerfEntry, g_reactPerfEntries.size());
+  std::rotate_copy(g_reactPerfEntries.begin(), oldest, g_reactPerfEntries.end(), std::back_inserter(entries));
+  return entries;
+}
+
+void logReactPerfMeasure(std::string_view name, int64_t startTimeUs, int64_t endTimeUs, std::string_view track) {
+  recordReactPerfEntry({std::string(name), std::string(track), startTimeUs, endTimeUs, false});
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "ReactPerfMeasure",
+      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+      TraceLoggingCountedString(name.data(), static_cast<USHORT>(name.size()), "name"),
+      TraceLoggingCountedString(track.data(), static_cast<USHORT>(track.size()), "track"),
+      TraceLoggingInt64(startTimeUs, "startTimeUs"),
+      TraceLoggingInt64(endTimeUs, "endTimeUs"),
+      TraceLoggingFloat64(static_cast<double>(endTimeUs - startTimeUs) / 1000, "durationMs"));
+}
+
+void logReactPerfMark(std::string_view name, int64_t timeUs, std::string_view track) {
+  recordReactPerfEntry({std::string(name), std::string(track), timeUs, timeUs, true});
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "ReactPerfMark",
+      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+      TraceLoggingCountedString(name.data(), static_cast<USHORT>(name.size()), "name"),
+      TraceLoggingCountedString(track.data(), static_cast<USHORT>(track.size()), "track"),
+      TraceLoggingInt64(timeUs, "timeUs"));
+}
+
+void logJSSample(
+    uint64_t profileId,
+    uint64_t threadId,
+    int64_t timeUs,
+    std::string_view functionName,
+    std::string_view scriptUrl,
+    int32_t lineNumber,
+    int32_t columnNumber,
+    uint32_t stackDepth) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "JSSample",
+      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+      TraceLoggingUInt64(profileId, "profileId"),
+      TraceLoggingUInt64(threadId, "threadId"),
+      TraceLoggingInt64(timeUs, "timeUs"),
+      TraceLoggingCountedString(functionName.data(), static_cast<USHORT>(functionName.size()), "functionName"),
+      TraceLoggingCountedString(scriptUrl.data(), static_cast<USHORT>(scriptUrl.size()), "scriptUrl"),
+      TraceLoggingInt32(lineNumber, "lineNumber"),
+      TraceLoggingInt32(columnNumber, "columnNumber"),
+      TraceLoggingUInt32(stackDepth, "stackDepth"));
+}
+
+void logHeapSnapshot(double durationMs, uint64_t byteCount, bool succeeded) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "JSHeapSnapshot",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingFloat64(durationMs, "durationMs"),
+      TraceLoggingUInt64(byteCount, "byteCount"),
+      TraceLoggingBool(succeeded, "succeeded"));
+}
+
+void logJSGarbageCollection(const char *reason, double durationMs, bool succeeded) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "JSGarbageCollection",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString(reason, "reason"),
+      TraceLoggingFloat64(durationMs, "durationMs"),
+      TraceLoggingBool(succeeded, "succeeded"));
+}
+
+void logMemoryUsage(const char *category, const char *type, uint64_t count, uint64_t byteCount) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "ReactMemoryUsage",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString(category, "category"),
+      TraceLoggingString(type, "type"),
+      TraceLoggingUInt64(count, "count"),
+      TraceLoggingUInt64(byteCount, "byteCount"));
+}
+
+void logV8CodeCacheLoad(const char *sourceUrl, bool hit, uint64_t byteCount, double compileTimeSavedMs) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "V8CodeCacheLoad",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString(sourceUrl, "sourceUrl"),
+      TraceLoggingBool(hit, "hit"),
+      TraceLoggingUInt64(byteCount, "byteCount"),
+      TraceLoggingFloat64(compileTimeSavedMs, "compileTimeSavedMs"));
+}
+
+void logV8CodeCacheStore(const char *sourceUrl, uint64_t byteCount, double compileTimeMs) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "V8CodeCacheStore",
+      TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+      TraceLoggingString(sourceUrl, "sourceUrl"),
+      TraceLoggingUInt64(byteCount, "byteCount"),
+      TraceLoggingFloat64(compileTimeMs, "compileTimeMs"));
+}
+
+void logNativeModuleCall(
+    std::string_view moduleName,
+    std::string_view methodName,
+    uint32_t threadId,
+    double argMarshalingMs,
+    double executionMs) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "NativeModuleCall",
+      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+      TraceLoggingCountedString(moduleName.data(), static_cast<USHORT>(moduleName.size()), "moduleName"),
+      TraceLoggingCountedString(methodName.data(), static_cast<USHORT>(methodName.size()), "methodName"),
+      TraceLoggingUInt32(threadId, "threadId"),
+      TraceLoggingFloat64(argMarshalingMs, "argMarshalingMs"),
+      TraceLoggingFloat64(executionMs, "executionMs"));
+}
+
+void logNativeModuleResult(
+    std::string_view moduleName,
+    std::string_view methodName,
+    uint32_t threadId,
+    double resultMarshalingMs) {
+  TraceLoggingWrite(
+      g_hTraceLoggingProvider,
+      "NativeModuleResult",
+      TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+      TraceLoggingCountedString(moduleName.data(), static_cast<USHORT>(moduleName.size()), "moduleName"),
+      TraceLoggingCountedString(methodName.data(), static_cast<USHORT>(methodName.size()), "methodName"),
+      TraceLoggingUInt32(threadId, "threadId"),
+      TraceLoggingFloat64(resultMarshalingMs, "resultMarshalingMs"));
+}
+
 } // namespace tracing
 } // namespace react
 } // namespace facebook
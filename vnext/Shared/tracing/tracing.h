@@ -1,5 +1,12 @@
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
 // forward declaration.
 namespace facebook {
 namespace jsi {
@@ -15,6 +22,152 @@ void initializeJSHooks(facebook::jsi::Runtime &runtime, bool isProfiling);
 
 void log(const char *msg);
 void error(const char *msg);
+
+void logMountingTransaction(
+    int32_t surfaceId,
+    int64_t transactionNumber,
+    uint32_t createCount,
+    uint32_t deleteCount,
+    uint32_t insertCount,
+    uint32_t removeCount,
+    uint32_t updateCount,
+    uint32_t compositionObjectCreations,
+    uint32_t compositionPropertySets,
+    uint32_t compositionBrushUpdates,
+    double mountDurationMs,
+    double commitToMountLatencyMs);
+
+// Logged once the compositor has committed the frame that shows a mounting transaction, with the time from the end of
+// the mount to the end of that commit
+void logCompositionCommit(int32_t surfaceId, int64_t transactionNumber, double commitLatencyMs);
+
+// Whether a trace session listens to the events of the Fabric mounting, so that the compositor commits are only
+// followed when they are logged
+bool isMountTracing();
+
+// bytesCopied counts every copy of the body made in memory while it was loaded
+void logImageLoad(const char *uri, uint64_t bodyBytes, uint64_t bytesCopied);
+
+// waitTimeMs is the time from posting the task to starting it, and queueDepth the number of tasks left waiting
+void logDispatchTask(
+    std::string_view queueName,
+    std::string_view taskName,
+    double waitTimeMs,
+    double runTimeMs,
+    uint64_t queueDepth);
+
+// Logged for each task that runs longer than the long task threshold, with the origin that it ran for, like a module
+// method, a timer, an event or a mount transaction, and the JS stack sampled while it ran, when they are known
+void logLongTask(
+    std::string_view queueName,
+    std::string_view taskName,
+    std::string_view origin,
+    double waitTimeMs,
+    double runTimeMs,
+    std::string_view jsStack);
+
+// Logged for each script load that looks up its prepared script, which is only compiled again when it misses
+void logPreparedScriptLoad(const char *sourceUrl, const char *prepareTag, bool hit);
+
+// The bytes of the GUID of an ETW activity
+using ActivityId = std::array<uint8_t, 16>;
+
+// Each phase of the startup is logged as a ReactStartupPhase activity: a start event and a stop event that share an
+// activity id, so that trace viewers show the phases on one timeline. The phases overlap, so their durations do not
+// add up. The bundle load also logs the size of the bundle, and whether its prepared script was found in the cache.
+ActivityId logStartupPhaseStart(const char *phase);
+void logStartupPhaseStop(const char *phase, const ActivityId &activityId, double durationMs);
+void logBundleLoadStop(const ActivityId &activityId, double durationMs, uint64_t byteCount, bool cacheHit);
+
+// A capture of the JS sampling profiler is logged as a JSSamplingProfile activity. Its events carry the
+// profileTimeUs of the steady clock in microseconds, which is the time base of the samples in the captured profile,
+// so that the samples can be lined up with the other events of the trace.
+ActivityId logJSSamplingProfileStart(int64_t profileTimeUs);
+void logJSSamplingProfileStop(const ActivityId &activityId, int64_t profileTimeUs, uint64_t sampleCount);
+
+// Whether a trace session listens to the React perf markers and the JS samples below, so that they are only collected
+// when they are written somewhere.
+bool isReactPerfTracing();
+
+// The marks and measures of the Web Performance API, such as those of React's scheduler and components tracks. Their
+// times are in microseconds of the steady clock, like the profileTimeUs of the JS sampling profile.
+void logReactPerfMeasure(std::string_view name, int64_t startTimeUs, int64_t endTimeUs, std::string_view track);
+void logReactPerfMark(std::string_view name, int64_t timeUs, std::string_view track);
+
+// The marks and measures logged above are also kept in a process wide ring buffer of the last ones, whether a trace
+// session listens or not, so that they can be written on demand. A mark ends when it starts.
+struct ReactPerfEntry {
+  std::string name;
+  std::string track;
+  int64_t startTimeUs;
+  int64_t endTimeUs;
+  bool isMark;
+};
+
+// The entries in the ring buffer, oldest first
+std::vector<ReactPerfEntry> getReactPerfEntries();
+
+// Logged for each sample of a JS sampling profile that the inspector captured, with the innermost frame of its stack.
+// A sample with an empty stack was taken while the JS thread was idle.
+void logJSSample(
+    uint64_t profileId,
+    uint64_t threadId,
+    int64_t timeUs,
+    std::string_view functionName,
+    std::string_view scriptUrl,
+    int32_t lineNumber,
+    int32_t columnNumber,
+    uint32_t stackDepth);
+
+void logHeapSnapshot(double durationMs, uint64_t byteCount, bool succeeded);
+
+// The reason tells what asked for the collection, such as the app entering the background
+void logJSGarbageCollection(const char *reason, double durationMs, bool succeeded);
+
+// Logged for each category of the memory report, see Mso::React::MemoryReport. The type is empty unless the category
+// is broken down by type, and the byte count is 0 when it is not known.
+void logMemoryUsage(const char *category, const char *type, uint64_t count, uint64_t byteCount);
+
+// Logged for each lookup of the V8 code cache of a script. A hit saves the compile time that was measured when the
+// code cache was produced, which is 0 when it is not known. A miss is followed by a store once V8 compiled the script.
+void logV8CodeCacheLoad(const char *sourceUrl, bool hit, uint64_t byteCount, double compileTimeSavedMs);
+void logV8CodeCacheStore(const char *sourceUrl, uint64_t byteCount, double compileTimeMs);
+
+// Logged for each call of a native module method while the native module profiler is enabled, with the thread it ran
+// on. The result is logged as its own event, since callbacks and promises may write it later, on another thread.
+void logNativeModuleCall(
+    std::string_view moduleName,
+    std::string_view methodName,
+    uint32_t threadId,
+    double argMarshalingMs,
+    double executionMs);
+void logNativeModuleResult(
+    std::string_view moduleName,
+    std::string_view methodName,
+    uint32_t threadId,
+    double resultMarshalingMs);
+
+// Logs the startup phase from its construction to its destruction. The phase must be a string literal.
+class StartupPhaseScope {
+ public:
+  explicit StartupPhaseScope(const char *phase) noexcept
+      : m_phase{phase}, m_activityId{logStartupPhaseStart(phase)}, m_startTime{std::chrono::steady_clock::now()} {}
+
+  ~StartupPhaseScope() noexcept {
+    logStartupPhaseStop(
+        m_phase,
+        m_activityId,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_startTime).count());
+  }
+
+  StartupPhaseScope(const StartupPhaseScope &) = delete;
+  StartupPhaseScope &operator=(const StartupPhaseScope &) = delete;
+
+ private:
+  const char *m_phase;
+  ActivityId m_activityId;
+  std::chrono::steady_clock::time_point m_startTime;
+};
 } // namespace tracing
 } // namespace react
 } // namespace facebook
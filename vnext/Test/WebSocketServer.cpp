@@ -122,11 +122,9 @@ void BaseWebSocketSession<SocketLayer>::OnRead(error_code ec, size_t /*transferr
       return Read();
     }
 
-    // Obtain raw pointer to underlying buffer memory.
-    // multi_buffer -> ConstBufferSequence -> const_buffer -> void* data()
-    // https://stackoverflow.com/questions/9510684
-    auto data = boost::asio::buffer_cast<uint8_t*>(*boost::asio::buffer_sequence_begin(m_buffer.data()));
-    m_binaryMessage = m_callbacks.BinaryMessageFactory({data, data + m_buffer.size()});
+    // A multi_buffer may hold a large message in several non-contiguous buffers.
+    auto message = buffers_to_string(m_buffer.data());
+    m_binaryMessage = m_callbacks.BinaryMessageFactory({message.begin(), message.end()});
     m_buffer.consume(m_buffer.size());
 
     m_stream->binary(true);